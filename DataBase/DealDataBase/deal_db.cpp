@@ -1,202 +1,123 @@
 #include "deal_db.hpp"
 
-#include <algorithm>
-
-#include "Logger/events_log.hpp"
+#include "ChangeLog/change_journal.hpp"
+#include "ChangeLog/change_stream.hpp"
+#include "DateTime/coarse_clock.hpp"
 #include "Person/Employee/internal_employee.hpp"
 #include "TenantContext/tenant_context.hpp"
 
 const std::vector<DealPtr> DealDataBase::empty_vector;
+
+DealDataBase::DealDataBase(std::shared_ptr<StringPool> string_pool)
+    : string_pool(std::move(string_pool)), store("Deal", *this->string_pool)
+{
+}
 //
 void DealDataBase::add(const DealPtr& deal)
 {
     if (deal == nullptr) return;
 
-    if (this->by_id.find(deal->getId()) != this->by_id.end()) {
-        return;
-    }
-
-    this->by_id[deal->getId()] = deal;
-
-    if (!deal->getManager().expired()) {
-        auto deal_manager = deal->getManager().lock();
-        this->by_manager[deal_manager->getId()].push_back(deal);
-    }
-
-    if (!deal->getOwner().expired()) {
-        auto owner = deal->getOwner().lock();
-        this->by_owner[owner->getId()].push_back(deal);
-    }
-
-    this->by_total_amount.emplace(deal->getTotalAmount(), deal);
-    this->by_paid_amount.emplace(deal->getPaidAmount(), deal);
-
-    if (deal->getStatus() != Deal::Status::Other) {
-        this->by_status[deal->getStatus()].push_back(deal);
-    } else if (deal->getOtherStatus().has_value()) {
-        this->by_other_status[deal->getOtherStatus().value()].push_back(deal);
-    }
-    if (deal->getDealPriority() != Priority::null) {
-        this->by_priority[deal->getDealPriority()].push_back(deal);
-    }
-
-    this->by_creation_date.emplace(deal->getCreationDate(), deal);
-
-    if (deal->getDrawingDate()) {
-        this->by_drawing_date.emplace(*deal->getDrawingDate(), deal);
-    }
-    if (deal->getDateApproval()) {
-        this->by_approval_date.emplace(*deal->getDateApproval(), deal);
-    }
-
-    this->by_contract_number.emplace(deal->getContractNumber(), deal);
+    if (!this->store.insert(deal)) return;
+    ChangeJournal::getInstance().setInitialState(deal->change_logs, deal->getInitialState());
 
-    if (!deal->getTitle().empty()) {
-        std::string lower_title = deal->getTitle();
-        std::transform(lower_title.begin(), lower_title.end(), lower_title.begin(), ::tolower);
-        this->by_title_substr_search.emplace(lower_title, deal);
-    }
+    ChangeStream::getInstance().publish(
+        ChangeEvent::entity(ChangeEvent::Type::Add, EntityType::Deal, deal->getId())
+    );
 }
 
 void DealDataBase::soft_remove(const BigUint& id)
 {
-    auto deal_it = by_id.find(id);
-    if (deal_it == by_id.end()) {
-        return;
-    }
-
-    DealPtr deal = deal_it->second;
-
-    auto    deal_manager = deal->getManager().lock();
-    if (deal_manager) {
-        auto manager_id = deal_manager->getId();
-        safeRemoveFromVector(by_manager, manager_id, deal, __LINE__, "by_manager");
-    }
-
-    auto owner = deal->getOwner().lock();
-    if (owner) {
-        auto owner_id = owner->getId();
-        safeRemoveFromVector(by_owner, owner_id, deal, __LINE__, "by_owner");
-    }
-
-    safeRemoveFromMap(by_total_amount, deal->getTotalAmount(), deal, __LINE__, "by_total_amount");
-    safeRemoveFromMap(by_paid_amount, deal->getPaidAmount(), deal, __LINE__, "by_paid_amount");
-
-    if (deal->getStatus() != Deal::Status::Other) {
-        safeRemoveFromVector(by_status, deal->getStatus(), deal, __LINE__, "by_status");
-    } else if (deal->getOtherStatus().has_value()) {
-        safeRemoveFromVector(
-            by_other_status, deal->getOtherStatus().value(), deal, __LINE__, "by_status"
-        );
-    }
-    if (deal->getDealPriority() != Priority::null) {
-        safeRemoveFromVector(by_priority, deal->getDealPriority(), deal, __LINE__, "by_priority");
-    }
-
-    safeRemoveFromMap(
-        by_creation_date, deal->getCreationDate(), deal, __LINE__, "by_creation_date"
-    );
-    if (deal->getDrawingDate()) {
-        auto drawing_date = deal->getDrawingDate();
-        safeRemoveFromMap(by_drawing_date, *drawing_date, deal, __LINE__, "by_drawing_date");
-    }
-    if (deal->getDateApproval()) {
-        auto approval_date = deal->getDateApproval();
-        safeRemoveFromMap(by_approval_date, *approval_date, deal, __LINE__, "by_approval_date");
-    }
-
-    safeRemoveFromMap(
-        by_contract_number, deal->getContractNumber(), deal, __LINE__, "by_contract_number"
-    );
-
-    if (!deal->getTitle().empty()) {
-        std::string lower_title = deal->getTitle();
-        std::transform(lower_title.begin(), lower_title.end(), lower_title.begin(), ::tolower);
-        safeRemoveFromMap(by_title_substr_search, lower_title, deal, __LINE__, "by_title_substr");
-    }
+    DealPtr deal = this->store.find(id);
+    if (deal == nullptr) return;
 
+    this->store.erase(deal);
     this->removed.push_back({Date(), deal});
-    this->by_id.erase(deal->getId());
+
+    ChangeStream::getInstance().publish(ChangeEvent::entity(
+        ChangeEvent::Type::SoftRemove, EntityType::Deal, deal->getId(), Date()
+    ));
 }
 
 void DealDataBase::hard_remove(const size_t index, TenantContext& context)
 {
     if (index < this->removed.size()) {
-        this->removed.erase(this->removed.begin() + index);
-
         const auto& deal    = removed[index].second;
         auto        deal_id = deal->getId();
 
         context.task_data_base.removeDeal(deal_id);
+        ChangeJournal::getInstance().drop(deal->change_logs);
 
         this->removed.erase(this->removed.begin() + index);
+        ChangeStream::getInstance().publish(ChangeEvent::entity(
+            ChangeEvent::Type::HardRemove, EntityType::Deal, deal_id
+        ));
     }
 }
 
-auto DealDataBase::size() const -> size_t { return this->by_id.size(); }
+auto DealDataBase::size() const -> size_t { return this->store.size(); }
 
-bool DealDataBase::empty() const { return this->by_id.empty(); }
+bool DealDataBase::empty() const { return this->store.empty(); }
 
-auto DealDataBase::getAll() const -> const std::unordered_map<BigUint, DealPtr>&
+auto DealDataBase::getStringPool() const -> const StringPool& { return *this->string_pool; }
+
+auto DealDataBase::getAll() const -> const FlatHashMap<BigUint, DealPtr>&
 {
-    return this->by_id;
+    return this->store.get<ById>().entries();
 }
 
 auto DealDataBase::getByManager() const -> const std::unordered_map<BigUint, std::vector<DealPtr>>&
 {
-    return this->by_manager;
+    return this->store.get<ByManager>().entries();
 }
 
 auto DealDataBase::getByOwner() const -> const std::unordered_map<BigUint, std::vector<DealPtr>>&
 {
-    return this->by_manager;
+    return this->store.get<ByOwner>().entries();
 }
 
 auto DealDataBase::getByTotalAmount() const -> const std::multimap<Money, DealPtr>&
 {
-    return this->by_total_amount;
+    return this->store.get<ByTotalAmount>().entries();
 }
 
 auto DealDataBase::getByPaidAmount() const -> const std::multimap<Money, DealPtr>&
 {
-    return this->by_paid_amount;
+    return this->store.get<ByPaidAmount>().entries();
 }
 
-auto DealDataBase::getByStatus() const
-    -> const std::unordered_map<Deal::Status, std::vector<DealPtr>>&
+auto DealDataBase::getByStatus() const -> const std::unordered_map<Deal::Status, RoaringBitmap>&
 {
-    return this->by_status;
+    return this->store.get<ByStatus>().entries();
 }
 
-auto DealDataBase::getByPriority() const
-    -> const std::unordered_map<Priority, std::vector<DealPtr>>&
+auto DealDataBase::getByPriority() const -> const std::unordered_map<Priority, RoaringBitmap>&
 {
-    return this->by_priority;
+    return this->store.get<ByPriority>().entries();
 }
 
 auto DealDataBase::getByCreationDate() const -> const std::multimap<Date, DealPtr>&
 {
-    return this->by_creation_date;
+    return this->store.get<ByCreationDate>().entries();
 }
 
 auto DealDataBase::getByDrawingDate() const -> const std::multimap<Date, DealPtr>&
 {
-    return this->by_drawing_date;
+    return this->store.get<ByDrawingDate>().entries();
 }
 
 auto DealDataBase::getByApprovalDate() const -> const std::multimap<Date, DealPtr>&
 {
-    return this->by_approval_date;
+    return this->store.get<ByApprovalDate>().entries();
 }
 
-auto DealDataBase::getByContractNumber() const -> const std::unordered_map<std::string, DealPtr>&
+auto DealDataBase::getByContractNumber() const -> const FlatHashMap<std::string, DealPtr>&
 {
-    return this->by_contract_number;
+    return this->store.get<ByContractNumber>().entries();
 }
 
-auto DealDataBase::getByTitleSubstr() const -> const std::multimap<std::string, DealPtr>&
+auto DealDataBase::getRows() const -> const RoaringBitmap&
 {
-    return this->by_title_substr_search;
+    return this->store.rows();
 }
 
 auto DealDataBase::getRemoved() const -> const std::vector<std::pair<Date, DealPtr>>&
@@ -206,449 +127,308 @@ auto DealDataBase::getRemoved() const -> const std::vector<std::pair<Date, DealP
 
 auto DealDataBase::findById(const BigUint& id) const -> const DealPtr
 {
-    auto deal = this->by_id.find(id);
-    if (deal != this->by_id.end()) {
-        return deal->second;
-    }
-    return nullptr;
+    return this->store.find(id);
 }
 
 auto DealDataBase::findByManager(const BigUint& manager_id) const -> const std::vector<DealPtr>&
 {
-    auto deals_it = this->by_manager.find(manager_id);
-    if (deals_it != this->by_manager.end()) {
-        return deals_it->second;
-    }
-    return empty_vector;
+    return this->store.get<ByManager>().find(manager_id);
 }
 
 auto DealDataBase::findByOwner(const BigUint& owner_id) const -> const std::vector<DealPtr>&
 {
-    auto deals_it = this->by_owner.find(owner_id);
-    if (deals_it != this->by_owner.end()) {
-        return deals_it->second;
-    }
-    return empty_vector;
+    return this->store.get<ByOwner>().find(owner_id);
 }
 
 auto DealDataBase::findByTotalAmount(const Money& amount) const -> std::vector<DealPtr>
 {
-    auto deals = this->by_total_amount.equal_range(amount);
-    if (deals.first == deals.second) return empty_vector;
-
-    std::vector<DealPtr> result;
-    for (auto it = deals.first; it != deals.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByTotalAmount>().find(amount);
 }
 
 auto DealDataBase::findByPaidAmount(const Money& amount) const -> std::vector<DealPtr>
 {
-    auto deals = this->by_paid_amount.equal_range(amount);
-    if (deals.first == deals.second) return empty_vector;
+    return this->store.get<ByPaidAmount>().find(amount);
+}
 
-    std::vector<DealPtr> result;
-    for (auto it = deals.first; it != deals.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+auto DealDataBase::findByStatus(Deal::Status status) const -> std::vector<DealPtr>
+{
+    return this->store.entitiesOf(this->store.get<ByStatus>().find(status));
 }
 
-auto DealDataBase::findByStatus(Deal::Status status) const -> const std::vector<DealPtr>&
+auto DealDataBase::findByPriority(Priority priority) const -> std::vector<DealPtr>
 {
-    auto deals_it = this->by_status.find(status);
-    if (deals_it != this->by_status.end()) {
-        return deals_it->second;
-    }
-    return empty_vector;
+    return this->store.entitiesOf(this->store.get<ByPriority>().find(priority));
 }
 
-auto DealDataBase::findByPriority(Priority priority) const -> const std::vector<DealPtr>&
+auto DealDataBase::findByRows(const RoaringBitmap& rows) const -> std::vector<DealPtr>
 {
-    auto deals_it = this->by_priority.find(priority);
-    if (deals_it != this->by_priority.end()) {
-        return deals_it->second;
-    }
-    return empty_vector;
+    return this->store.entitiesOf(rows);
 }
 
 auto DealDataBase::findByCreationDate(const Date& date) const -> std::vector<DealPtr>
 {
-    auto deals = this->by_creation_date.equal_range(date);
-    if (deals.first == deals.second) return empty_vector;
-
-    std::vector<DealPtr> result;
-    for (auto it = deals.first; it != deals.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByCreationDate>().find(date);
 }
 
 auto DealDataBase::findByDrawingDate(const Date& date) const -> std::vector<DealPtr>
 {
-    auto deals = this->by_drawing_date.equal_range(date);
-    if (deals.first == deals.second) return empty_vector;
-
-    std::vector<DealPtr> result;
-    for (auto it = deals.first; it != deals.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByDrawingDate>().find(date);
 }
 
 auto DealDataBase::findByApprovalDate(const Date& date) const -> std::vector<DealPtr>
 {
-    auto deals = this->by_approval_date.equal_range(date);
-    if (deals.first == deals.second) return empty_vector;
-
-    std::vector<DealPtr> result;
-    for (auto it = deals.first; it != deals.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByApprovalDate>().find(date);
 }
 
 auto DealDataBase::findByContractNumber(const std::string& contract_number) const -> const DealPtr
 {
-    auto deal = this->by_contract_number.find(contract_number);
-    if (deal != this->by_contract_number.end()) {
-        return deal->second;
-    }
-    return nullptr;
+    return this->store.get<ByContractNumber>().find(contract_number);
 }
 
 auto DealDataBase::findByTitleSubstr(const std::string& substr) const -> std::vector<DealPtr>
 {
     if (substr.empty()) return empty_vector;
 
-    auto key = substr;
-    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
-
-    auto first = this->by_title_substr_search.lower_bound(key);
-    key.back()++;
-    auto second = this->by_title_substr_search.lower_bound(key);
+    return this->store.get<ByTitle>().find(indexes::lowerCase(substr));
+}
 
-    if (first == second) return empty_vector;
-    std::vector<DealPtr> result;
-    for (auto it = first; it != second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+auto DealDataBase::update(const BigUint& id, const InternalEmployeePtr& changer) -> Update
+{
+    return Update(*this, this->store.find(id), changer);
 }
 
-auto DealDataBase::changeManager(
+void DealDataBase::changeManager(
     const BigUint& id, const WeakInternalEmployee& manager, const InternalEmployeePtr& changer
 )
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
-
-    DealPtr deal = deal_it->second;
-
-    auto    old_manager = deal->getManager().lock();
-    auto    new_manager = manager.lock();
-    if (deal->setManager(manager, changer)) {
-        if (old_manager) {
-            auto old_manager_id = old_manager->getId();
-            safeRemoveFromVector(this->by_manager, old_manager_id, deal, __LINE__, "by_manager");
-        }
-        if (new_manager) {
-            auto new_manager_id = new_manager->getId();
-            this->by_manager[new_manager_id].push_back(deal);
-        }
-    }
+    this->update(id, changer).setManager(manager).apply();
 }
 
-auto DealDataBase::changeOwner(
+void DealDataBase::changeOwner(
     const BigUint& id, const WeakPersonPtr& owner, const InternalEmployeePtr& changer
 )
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
-
-    DealPtr deal = deal_it->second;
-
-    auto    old_owner = deal->getOwner().lock();
-    auto    new_owner = owner.lock();
-    if (deal->setOwner(owner, changer)) {
-        if (old_owner) {
-            auto old_owner_id = old_owner->getId();
-            safeRemoveFromVector(this->by_owner, old_owner_id, deal, __LINE__, "by_owner");
-        }
-        if (new_owner) {
-            this->by_owner[new_owner->getId()].push_back(deal);
-        }
-    }
+    this->update(id, changer).setOwner(owner).apply();
 }
 
-auto DealDataBase::changeTotalAmount(
+void DealDataBase::changeTotalAmount(
     const BigUint& id, const Money& total_amount, const InternalEmployeePtr& changer
 )
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
-
-    DealPtr deal = deal_it->second;
-
-    auto    old_amount = deal->getTotalAmount();
-
-    if (deal->changeTotalAmount(total_amount, changer)) {
-        safeRemoveFromMap(this->by_total_amount, old_amount, deal, __LINE__, "by_total_amount");
-        this->by_total_amount.emplace(total_amount, deal);
-    }
+    this->update(id, changer).setTotalAmount(total_amount).apply();
 }
 
-auto DealDataBase::changePaidAmount(
+void DealDataBase::changePaidAmount(
     const BigUint& id, const Money& paid_amount, const InternalEmployeePtr& changer
 )
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
-
-    DealPtr deal = deal_it->second;
-
-    auto    old_amount = deal->getPaidAmount();
-
-    if (deal->changePaidAmount(paid_amount, changer)) {
-        safeRemoveFromMap(this->by_paid_amount, old_amount, deal, __LINE__, "by_paid_amount");
-        this->by_paid_amount.emplace(paid_amount, deal);
-    }
+    this->update(id, changer).setPaidAmount(paid_amount).apply();
 }
 
-auto DealDataBase::changeStatus(
+void DealDataBase::changeStatus(
     const BigUint& id, const Deal::Status status, const InternalEmployeePtr& changer
 )
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
-
-    DealPtr      deal = deal_it->second;
-
-    Deal::Status old_status = deal->getStatus();
-
-    if (deal->changeStatus(status, changer)) {
-        if (deal->getStatus() != Deal::Status::Other) {
-            safeRemoveFromVector(this->by_status, old_status, deal, __LINE__, "by_status");
-        } else if (deal->getOtherStatus().has_value()) {
-            safeRemoveFromVector(
-                this->by_other_status,
-                deal->getOtherStatus().value(),
-                deal,
-                __LINE__,
-                "by_other_status"
-            );
-        }
-        if (status != Deal::Status::Other) {
-            this->by_status[status].push_back(deal);
-        }
-    }
+    this->update(id, changer).setStatus(status).apply();
 }
 
-auto DealDataBase::changeOtherStatus(
+void DealDataBase::changeOtherStatus(
     const BigUint& id, const OptionalStr& status, const InternalEmployeePtr& changer
 )
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
-
-    DealPtr     deal = deal_it->second;
-
-    OptionalStr old_status = deal->getOtherStatus();
-
-    if (deal->changeOtherStatus(status, changer)) {
-        if (old_status.has_value()) {
-            safeRemoveFromVector(
-                this->by_other_status, old_status.value(), deal, __LINE__, "by_other_status"
-            );
-        } else if (deal->getStatus() != Deal::Status::Other) {
-            safeRemoveFromVector(this->by_status, deal->getStatus(), deal, __LINE__, "by_status");
-        }
-        if (status.has_value()) {
-            this->by_other_status[status.value()].push_back(deal);
-        }
-    }
+    this->update(id, changer).setOtherStatus(status).apply();
 }
 
-auto DealDataBase::changePriority(
+void DealDataBase::changePriority(
     const BigUint& id, const Priority priority, const InternalEmployeePtr& changer
 )
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
-
-    DealPtr deal = deal_it->second;
-
-    auto    old_priority = deal->getDealPriority();
-
-    if (deal->changeDealPriority(priority, changer)) {
-        if (old_priority != Priority::null) {
-            safeRemoveFromVector(this->by_priority, old_priority, deal, __LINE__, "by_priority");
-        } else if (priority != Priority::null) {
-            this->by_priority[priority].push_back(deal);
-        }
-    }
+    this->update(id, changer).setPriority(priority).apply();
 }
 
-auto DealDataBase::changeCreationDate(
+void DealDataBase::changeCreationDate(
     const BigUint& id, const Date& date, const InternalEmployeePtr& changer
 )
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
+    this->update(id, changer).setCreationDate(date).apply();
+}
 
-    DealPtr deal = deal_it->second;
+void DealDataBase::changeDrawingDate(
+    const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
+)
+{
+    this->update(id, changer).setDrawingDate(date).apply();
+}
 
-    auto    old_date = deal->getCreationDate();
+void DealDataBase::changeApprovalDate(
+    const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
+)
+{
+    this->update(id, changer).setApprovalDate(date).apply();
+}
 
-    if (deal->setCreationDate(date, changer)) {
-        safeRemoveFromMap(this->by_creation_date, old_date, deal, __LINE__, "by_creation_date");
-        this->by_creation_date.emplace(date, deal);
-    }
+void DealDataBase::changeContractNumber(
+    const BigUint& id, const std::string& number, const InternalEmployeePtr& changer
+)
+{
+    this->update(id, changer).setContractNumber(number).apply();
 }
 
-auto DealDataBase::changeDrawingDate(
-    const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer
+void DealDataBase::changeTitle(
+    const BigUint& id, const std::string& title, const InternalEmployeePtr& changer
 )
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
+    this->update(id, changer).setTitle(title).apply();
+}
 
-    DealPtr deal = deal_it->second;
+void DealDataBase::removeManager(const BigUint& id) { this->store.get<ByManager>().eraseKey(id); }
 
-    auto    old_date = deal->getDrawingDate();
+void DealDataBase::removeOwner(const BigUint& id) { this->store.get<ByOwner>().eraseKey(id); }
 
-    if (deal->setDrawingDate(date, changer)) {
-        if (old_date) {
-            safeRemoveFromMap(this->by_drawing_date, *old_date, deal, __LINE__, "by_drawing_date");
-        }
-        if (date) {
-            this->by_drawing_date.emplace(*date, deal);
-        }
-    }
+DealDataBase::Update::Update(DealDataBase& data_base, DealPtr deal, InternalEmployeePtr changer)
+    : data_base(data_base), deal(std::move(deal)), changer(std::move(changer))
+{
 }
 
-auto DealDataBase::changeApprovalDate(
-    const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer
-)
+auto DealDataBase::Update::setManager(const WeakInternalEmployee& manager) -> Update&
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
+    this->manager = manager;
+    return *this;
+}
 
-    DealPtr deal = deal_it->second;
+auto DealDataBase::Update::setOwner(const WeakPersonPtr& owner) -> Update&
+{
+    this->owner = owner;
+    return *this;
+}
 
-    auto    old_date = deal->getDateApproval();
+auto DealDataBase::Update::setTotalAmount(const Money& total_amount) -> Update&
+{
+    this->total_amount = total_amount;
+    return *this;
+}
 
-    if (deal->setDateApproval(date, changer)) {
-        if (old_date) {
-            safeRemoveFromMap(this->by_approval_date, *old_date, deal, __LINE__, "by_drawing_date");
-        }
-        if (date) {
-            this->by_approval_date.emplace(*date, deal);
-        }
-    }
+auto DealDataBase::Update::setPaidAmount(const Money& paid_amount) -> Update&
+{
+    this->paid_amount = paid_amount;
+    return *this;
 }
 
-auto DealDataBase::changeContractNumber(
-    const BigUint& id, const std::string& number, const InternalEmployeePtr& changer
-)
+auto DealDataBase::Update::setStatus(const Deal::Status status) -> Update&
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
+    this->status = status;
+    return *this;
+}
 
-    DealPtr     deal = deal_it->second;
+auto DealDataBase::Update::setOtherStatus(const OptionalStr& other_status) -> Update&
+{
+    this->other_status = other_status;
+    return *this;
+}
 
-    std::string old_number = deal->getContractNumber();
+auto DealDataBase::Update::setPriority(const Priority priority) -> Update&
+{
+    this->priority = priority;
+    return *this;
+}
 
-    if (deal->changeContractNumber(number, changer)) {
-        safeRemoveFromMap(
-            this->by_contract_number, old_number, deal, __LINE__, "by_contract_number"
-        );
-        this->by_contract_number.emplace(number, deal);
-    }
+auto DealDataBase::Update::setCreationDate(const Date& date) -> Update&
+{
+    this->creation_date = date;
+    return *this;
 }
 
-auto DealDataBase::changeTitle(
-    const BigUint& id, const std::string& title, const InternalEmployeePtr& changer
-)
+auto DealDataBase::Update::setDrawingDate(const OptionalDate& date) -> Update&
 {
-    auto deal_it = this->by_id.find(id);
-    if (deal_it == this->by_id.end()) return;
-
-    DealPtr     deal = deal_it->second;
-
-    std::string old_title = deal->getTitle();
-
-    if (deal->changeTitle(title, changer)) {
-        if (!old_title.empty()) {
-            auto old_key = old_title;
-            std::transform(old_key.begin(), old_key.end(), old_key.begin(), ::tolower);
-            safeRemoveFromMap(
-                this->by_title_substr_search, old_key, deal, __LINE__, "by_title_substr_search"
-            );
-        }
-        if (!title.empty()) {
-            auto new_key = title;
-            std::transform(new_key.begin(), new_key.end(), new_key.begin(), ::tolower);
-            this->by_title_substr_search.emplace(new_key, deal);
-        }
-    }
+    this->drawing_date = date;
+    return *this;
 }
 
-void DealDataBase::removeManager(const BigUint& id) { this->by_manager.erase(id); }
+auto DealDataBase::Update::setApprovalDate(const OptionalDate& date) -> Update&
+{
+    this->approval_date = date;
+    return *this;
+}
 
-void DealDataBase::removeOwner(const BigUint& id) { this->by_owner.erase(id); }
+auto DealDataBase::Update::setContractNumber(const std::string& number) -> Update&
+{
+    this->contract_number = number;
+    return *this;
+}
 
-void DealDataBase::safeRemoveFromMap(
-    auto&              map,
-    const auto&        key,
-    const DealPtr&     deal,
-    const size_t       line,
-    const std::string& index_name
-)
+auto DealDataBase::Update::setTitle(const std::string& title) -> Update&
 {
-    auto range = map.equal_range(key);
-    for (auto it = range.first; it != range.second; ++it) {
-        if (it->second == deal) {
-            map.erase(it);
-            return;
-        }
-    }
-    this->logEmptyContainer(__FILE__, line, deal->getId().num, index_name);
+    this->title = title;
+    return *this;
 }
 
-void DealDataBase::safeRemoveFromVector(
-    auto&              map,
-    const auto&        key,
-    const DealPtr&     deal,
-    const size_t       line,
-    const std::string& index_name
-)
+auto DealDataBase::Update::apply() -> size_t
 {
-    auto& vec = map[key];
-    if (vec.empty()) {
-        this->logEmptyContainer(__FILE__, line, deal->getId().num, index_name);
+    if (this->deal == nullptr) return 0;
 
-    } else {
-        vec.erase(std::remove(vec.begin(), vec.end(), deal), vec.end());
-        if (vec.empty()) {
-            map.erase(key);
-        }
+    Store&           store   = this->data_base.store;
+    const DealPtr&   deal    = this->deal;
+    const auto&      changer = this->changer;
+    size_t           logged  = deal->getChangeLogs().size();
+    CoarseClock::Pin pin;  // one timestamp for the whole group
+
+    if (this->manager) {
+        store.update<ByManager>(deal, [&] { return deal->setManager(*this->manager, changer); });
+    }
+    if (this->owner) {
+        store.update<ByOwner>(deal, [&] { return deal->setOwner(*this->owner, changer); });
+    }
+    if (this->total_amount) {
+        store.update<ByTotalAmount>(deal, [&] {
+            return deal->changeTotalAmount(*this->total_amount, changer);
+        });
+    }
+    if (this->paid_amount) {
+        store.update<ByPaidAmount>(deal, [&] {
+            return deal->changePaidAmount(*this->paid_amount, changer);
+        });
     }
-}
 
-void DealDataBase::logEmptyContainer(
-    const std::string& file,
-    const size_t       line,
-    const std::string& deal_id,
-    const std::string& index_name
-)
-{
-    EventLog::getInstance().log(
-        LOG_LEVEL::ERROR,
-        file,
-        line,
-        "Data inconsistency in " + index_name + "\nDeal: " + deal_id +
-            "\nExpected entry is missing."
-    );
-}
\ No newline at end of file
+    // the status and the other status together decide which index holds the deal
+    if (this->status || this->other_status) {
+        store.update<ByStatus, ByOtherStatus>(deal, [&] {
+            bool changed = false;
+            if (this->status) changed |= deal->changeStatus(*this->status, changer);
+            if (this->other_status) {
+                changed |= deal->changeOtherStatus(*this->other_status, changer);
+            }
+            return changed;
+        });
+    }
+
+    if (this->priority) {
+        store.update<ByPriority>(deal, [&] {
+            return deal->changeDealPriority(*this->priority, changer);
+        });
+    }
+    if (this->creation_date) {
+        store.update<ByCreationDate>(deal, [&] {
+            return deal->setCreationDate(*this->creation_date, changer);
+        });
+    }
+    if (this->drawing_date) {
+        store.update<ByDrawingDate>(deal, [&] {
+            return deal->setDrawingDate(*this->drawing_date, changer);
+        });
+    }
+    if (this->approval_date) {
+        store.update<ByApprovalDate>(deal, [&] {
+            return deal->setDateApproval(*this->approval_date, changer);
+        });
+    }
+    if (this->contract_number) {
+        store.update<ByContractNumber>(deal, [&] {
+            return deal->changeContractNumber(*this->contract_number, changer);
+        });
+    }
+    if (this->title) {
+        store.update<ByTitle>(deal, [&] { return deal->changeTitle(*this->title, changer); });
+    }
+
+    return deal->getChangeLogs().size() - logged;
+}
@@ -1,13 +1,25 @@
 #pragma once
 #pragma once
 #include <map>
+#include <optional>
 #include <unordered_map>
 
 #include "Deal/deal.hpp"
+#include "IndexedStore/indexed_store.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 
 class DealDataBase {
 public:
+    using Symbol = StringPool::Symbol;
+
+    class Update;
+
+    /// Other status keys are interned in `string_pool`, which is shared by all data bases of
+    /// one tenant. The pool of the current tenant by default, whose symbols the deals already
+    /// keep.
+    explicit DealDataBase(std::shared_ptr<StringPool> string_pool = StringPool::current());
+
     void add(const DealPtr& deal);
     void soft_remove(const BigUint& id);
     void hard_remove(const size_t index, TenantContext& context);
@@ -16,18 +28,19 @@ public:
     /// @{
     auto size() const -> size_t;
     bool empty() const;
-    auto getAll() const -> const std::unordered_map<BigUint, DealPtr>&;
+    auto getStringPool() const -> const StringPool&;
+    auto getAll() const -> const FlatHashMap<BigUint, DealPtr>&;
     auto getByManager() const -> const std::unordered_map<BigUint, std::vector<DealPtr>>&;
     auto getByOwner() const -> const std::unordered_map<BigUint, std::vector<DealPtr>>&;
     auto getByTotalAmount() const -> const std::multimap<Money, DealPtr>&;
     auto getByPaidAmount() const -> const std::multimap<Money, DealPtr>&;
-    auto getByStatus() const -> const std::unordered_map<Deal::Status, std::vector<DealPtr>>&;
-    auto getByPriority() const -> const std::unordered_map<Priority, std::vector<DealPtr>>&;
+    auto getByStatus() const -> const std::unordered_map<Deal::Status, RoaringBitmap>&;
+    auto getByPriority() const -> const std::unordered_map<Priority, RoaringBitmap>&;
     auto getByCreationDate() const -> const std::multimap<Date, DealPtr>&;
     auto getByDrawingDate() const -> const std::multimap<Date, DealPtr>&;
     auto getByApprovalDate() const -> const std::multimap<Date, DealPtr>&;
-    auto getByContractNumber() const -> const std::unordered_map<std::string, DealPtr>&;
-    auto getByTitleSubstr() const -> const std::multimap<std::string, DealPtr>&;
+    auto getByContractNumber() const -> const FlatHashMap<std::string, DealPtr>&;
+    auto getRows() const -> const RoaringBitmap&;
     auto getRemoved() const -> const std::vector<std::pair<Date, DealPtr>>&;
     /// @}
 
@@ -40,8 +53,8 @@ public:
     auto findByTotalAmount(const Money& amount) const -> std::vector<DealPtr>;
     auto findByPaidAmount(const Money& amount) const -> std::vector<DealPtr>;
 
-    auto findByStatus(Deal::Status status) const -> const std::vector<DealPtr>&;
-    auto findByPriority(Priority priority) const -> const std::vector<DealPtr>&;
+    auto findByStatus(Deal::Status status) const -> std::vector<DealPtr>;
+    auto findByPriority(Priority priority) const -> std::vector<DealPtr>;
 
     auto findByCreationDate(const Date& date) const -> std::vector<DealPtr>;
     auto findByDrawingDate(const Date& date) const -> std::vector<DealPtr>;
@@ -49,44 +62,49 @@ public:
 
     auto findByContractNumber(const std::string& contract_number) const -> const DealPtr;
     auto findByTitleSubstr(const std::string& substr) const -> std::vector<DealPtr>;
+    /// Deals in `rows`, a combination of the status and priority bitmaps
+    auto findByRows(const RoaringBitmap& rows) const -> std::vector<DealPtr>;
     /// @}
 
     /// @name Change functions
     /// @{
-    auto changeManager(
+    /// Collects changes to the deal with `id`, see `Update`. One-field changes below are
+    /// updates of one field.
+    auto update(const BigUint& id, const InternalEmployeePtr& changer) -> Update;
+    void changeManager(
         const BigUint& id, const WeakInternalEmployee& manager, const InternalEmployeePtr& changer
     );
-    auto changeOwner(
+    void changeOwner(
         const BigUint& id, const WeakPersonPtr& owner, const InternalEmployeePtr& changer
     );
-    auto changeTotalAmount(
+    void changeTotalAmount(
         const BigUint& id, const Money& total_amount, const InternalEmployeePtr& changer
     );
-    auto changePaidAmount(
+    void changePaidAmount(
         const BigUint& id, const Money& paid_amount, const InternalEmployeePtr& changer
     );
-    auto changeStatus(
+    void changeStatus(
         const BigUint& id, const Deal::Status status, const InternalEmployeePtr& changer
     );
-    auto changeOtherStatus(
+    void changeOtherStatus(
         const BigUint& id, const OptionalStr& status, const InternalEmployeePtr& changer
     );
-    auto changePriority(
+    void changePriority(
         const BigUint& id, const Priority priority, const InternalEmployeePtr& changer
     );
-    auto changeCreationDate(
+    void changeCreationDate(
         const BigUint& id, const Date& date, const InternalEmployeePtr& changer
     );
-    auto changeDrawingDate(
-        const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer
+    void changeDrawingDate(
+        const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
     );
-    auto changeApprovalDate(
-        const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer
+    void changeApprovalDate(
+        const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
     );
-    auto changeContractNumber(
+    void changeContractNumber(
         const BigUint& id, const std::string& number, const InternalEmployeePtr& changer
     );
-    auto changeTitle(
+    void changeTitle(
         const BigUint& id, const std::string& title, const InternalEmployeePtr& changer
     );
     /// @}
@@ -98,50 +116,105 @@ public:
     /// @}
 
 private:
-    static const std::vector<DealPtr>                 empty_vector;
-
-    std::unordered_map<BigUint, DealPtr>              by_id;
-    std::unordered_map<BigUint, std::vector<DealPtr>> by_manager;
-    std::unordered_map<BigUint, std::vector<DealPtr>> by_owner;
-
-    //
-    std::multimap<Money, DealPtr> by_total_amount;
-    std::multimap<Money, DealPtr> by_paid_amount;
-
-    //
-    std::unordered_map<Deal::Status, std::vector<DealPtr>> by_status;
-    std::unordered_map<std::string, std::vector<DealPtr>>  by_other_status;
-    std::unordered_map<Priority, std::vector<DealPtr>>     by_priority;
-
-    //
-    std::multimap<Date, DealPtr> by_creation_date;
-    std::multimap<Date, DealPtr> by_drawing_date;
-    std::multimap<Date, DealPtr> by_approval_date;
-
-    //
-    std::unordered_map<std::string, DealPtr> by_contract_number;
-    std::multimap<std::string, DealPtr>      by_title_substr_search;
-    std::vector<std::pair<Date, DealPtr>>    removed;
-    //
-    void safeRemoveFromMap(
-        auto&              map,
-        const auto&        key,
-        const DealPtr&     deal,
-        const size_t       line,
-        const std::string& index_name
-    );
-    void safeRemoveFromVector(
-        auto&              map,
-        const auto&        key,
-        const DealPtr&     deal,
-        const size_t       line,
-        const std::string& index_name
-    );
+    using ById      = indexes::Unique<Deal, indexes::Get<&Deal::getId>, "by_id">;
+    using ByManager = indexes::Bucket<Deal, indexes::IdOf<&Deal::getManager>, "by_manager">;
+    using ByOwner   = indexes::Bucket<Deal, indexes::IdOf<&Deal::getOwner>, "by_owner">;
+    using ByTotalAmount =
+        indexes::Ordered<Deal, indexes::Get<&Deal::getTotalAmount>, "by_total_amount">;
+    using ByPaidAmount =
+        indexes::Ordered<Deal, indexes::Get<&Deal::getPaidAmount>, "by_paid_amount">;
+    using ByStatus = indexes::Bitmap<
+        Deal,
+        indexes::Except<&Deal::getStatus, Deal::Status::Other>,
+        "by_status">;
+    using ByOtherStatus = indexes::Bucket<
+        Deal,
+        indexes::Interned<
+            indexes::Other<&Deal::getStatus, Deal::Status::Other, &Deal::getOtherStatus>>,
+        "by_other_status">;
+    using ByPriority = indexes::Bitmap<
+        Deal,
+        indexes::Except<&Deal::getDealPriority, Priority::null>,
+        "by_priority">;
+    using ByCreationDate =
+        indexes::Ordered<Deal, indexes::Get<&Deal::getCreationDate>, "by_creation_date">;
+    using ByDrawingDate =
+        indexes::Ordered<Deal, indexes::Get<&Deal::getDrawingDate>, "by_drawing_date">;
+    using ByApprovalDate =
+        indexes::Ordered<Deal, indexes::Get<&Deal::getDateApproval>, "by_approval_date">;
+    using ByContractNumber =
+        indexes::Unique<Deal, indexes::Get<&Deal::getContractNumber>, "by_contract_number">;
+    using ByTitle = indexes::Substring<
+        Deal,
+        indexes::Lower<indexes::NonEmpty<&Deal::getTitle>>,
+        "by_title_substr_search">;
+    using Store = IndexedStore<
+        Deal,
+        ById,
+        ByManager,
+        ByOwner,
+        ByTotalAmount,
+        ByPaidAmount,
+        ByStatus,
+        ByOtherStatus,
+        ByPriority,
+        ByCreationDate,
+        ByDrawingDate,
+        ByApprovalDate,
+        ByContractNumber,
+        ByTitle>;
+
+    static const std::vector<DealPtr>     empty_vector;
+    std::shared_ptr<StringPool>           string_pool;
+    Store                                 store;
+    std::vector<std::pair<Date, DealPtr>> removed;
+};
+
+/**
+ * @class DealDataBase::Update
+ * @brief Changes to several fields of one deal, applied together.
+ *
+ * Works like `ClientDataBase::Update`: one lookup, one timestamp for the whole group of change
+ * log entries and one move per affected index.
+ */
+class DealDataBase::Update {
+public:
+    auto setManager(const WeakInternalEmployee& manager) -> Update&;
+    auto setOwner(const WeakPersonPtr& owner) -> Update&;
+    auto setTotalAmount(const Money& total_amount) -> Update&;
+    auto setPaidAmount(const Money& paid_amount) -> Update&;
+    auto setStatus(const Deal::Status status) -> Update&;
+    auto setOtherStatus(const OptionalStr& other_status) -> Update&;
+    auto setPriority(const Priority priority) -> Update&;
+    auto setCreationDate(const Date& date) -> Update&;
+    auto setDrawingDate(const OptionalDate& date) -> Update&;
+    auto setApprovalDate(const OptionalDate& date) -> Update&;
+    auto setContractNumber(const std::string& number) -> Update&;
+    auto setTitle(const std::string& title) -> Update&;
+
+    /// Returns how many fields changed: the last that many change log entries of the deal.
+    /// Does nothing if the deal is not in the data base.
+    auto apply() -> size_t;
 
-    void logEmptyContainer(
-        const std::string& file,
-        const size_t       line,
-        const std::string& deal_id,
-        const std::string& index_name
-    );
-};
\ No newline at end of file
+private:
+    friend class DealDataBase;
+
+    Update(DealDataBase& data_base, DealPtr deal, InternalEmployeePtr changer);
+
+    DealDataBase&       data_base;
+    DealPtr             deal;  // nullptr if there is no such deal
+    InternalEmployeePtr changer;
+
+    std::optional<WeakInternalEmployee> manager;
+    std::optional<WeakPersonPtr>        owner;
+    std::optional<Money>                total_amount;
+    std::optional<Money>                paid_amount;
+    std::optional<Deal::Status>         status;
+    std::optional<OptionalStr>          other_status;
+    std::optional<Priority>             priority;
+    std::optional<Date>                 creation_date;
+    std::optional<OptionalDate>         drawing_date;
+    std::optional<OptionalDate>         approval_date;
+    std::optional<std::string>          contract_number;
+    std::optional<std::string>          title;
+};
@@ -0,0 +1,420 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace flat_hash {
+    /// murmur3 fmix64 finalizer. The table takes the slot from the high bits of a hash and the
+    /// control byte from the low ones, so every bit must depend on the whole key.
+    constexpr auto mix(uint64_t value) -> uint64_t
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33;
+        return value;
+    }
+
+    /// `std::hash` of the key, mixed. Transparent, so a table can be searched by any type the
+    /// hash accepts.
+    template <typename Key>
+    struct Hash {
+        using is_transparent = void;
+
+        auto operator()(const Key& key) const -> size_t
+        {
+            return static_cast<size_t>(mix(std::hash<Key>{}(key)));
+        }
+    };
+
+    /// Text keys are hashed as views, so views and literals find them without a `std::string`
+    template <>
+    struct Hash<std::string> {
+        using is_transparent = void;
+
+        auto operator()(const std::string_view key) const -> size_t
+        {
+            return static_cast<size_t>(mix(std::hash<std::string_view>{}(key)));
+        }
+    };
+
+    /// @name Control bytes
+    /// A full slot holds the low 7 bits of the hash of its key, so a full byte is never negative
+    /// @{
+    using ctrl_t = int8_t;
+
+    inline constexpr ctrl_t empty       = -128;
+    inline constexpr ctrl_t deleted     = -2;
+    inline constexpr size_t group_width = 16;
+    /// @}
+
+    /// Control bytes of `group_width` consecutive slots, matched all at once. Bit i of a mask
+    /// stands for slot i of the group.
+    class Group {
+    public:
+#if defined(__SSE2__)
+        explicit Group(const ctrl_t* ctrl)
+            : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+        {
+        }
+
+        auto match(const ctrl_t value) const -> uint32_t
+        {
+            return static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), this->ctrl))
+            );
+        }
+        auto matchEmpty() const -> uint32_t { return this->match(empty); }
+        /// Empty or deleted slots, the only bytes below -1
+        auto matchFree() const -> uint32_t
+        {
+            return static_cast<uint32_t>(
+                _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), this->ctrl))
+            );
+        }
+
+    private:
+        __m128i ctrl;
+#else
+        explicit Group(const ctrl_t* ctrl) { memcpy(this->ctrl, ctrl, group_width); }
+
+        auto match(const ctrl_t value) const -> uint32_t
+        {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < group_width; ++i) {
+                if (this->ctrl[i] == value) mask |= uint32_t{1} << i;
+            }
+            return mask;
+        }
+        auto matchEmpty() const -> uint32_t { return this->match(empty); }
+        auto matchFree() const -> uint32_t
+        {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < group_width; ++i) {
+                if (this->ctrl[i] < -1) mask |= uint32_t{1} << i;
+            }
+            return mask;
+        }
+
+    private:
+        ctrl_t ctrl[group_width];
+#endif
+    };
+}  // namespace flat_hash
+
+/**
+ * @class FlatHashMap
+ * @brief Open-addressing hash map with its entries stored inline, SwissTable style.
+ *
+ * Each slot has a control byte: empty, deleted, or 7 bits of the hash of its key. A lookup
+ * matches the control bytes of a whole group of slots at once (SSE2 where available) and reads
+ * only the keys whose byte matched, so it seldom follows a pointer or compares a key it did not
+ * want. Groups are probed quadratically. Erased slots become tombstones, and the table is rebuilt
+ * when entries and tombstones fill 7/8 of it.
+ *
+ * Entries move when the table is rebuilt, so an insertion invalidates iterators and references.
+ * Lookups accept any type the hash and the equality do, e.g. `std::string_view` for text keys.
+ */
+template <
+    typename Key,
+    typename Value,
+    typename Hash  = flat_hash::Hash<Key>,
+    typename Equal = std::equal_to<>>
+class FlatHashMap {
+    using ctrl_t = flat_hash::ctrl_t;
+
+public:
+    using key_type    = Key;
+    using mapped_type = Value;
+    using value_type  = std::pair<Key, Value>;
+    using size_type   = size_t;
+
+    template <bool is_const>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = FlatHashMap::value_type;
+        using difference_type   = ptrdiff_t;
+        using reference = std::conditional_t<is_const, const value_type&, value_type&>;
+        using pointer   = std::conditional_t<is_const, const value_type*, value_type*>;
+
+        Iterator() = default;
+
+        operator Iterator<true>() const { return {this->ctrl, this->slot, this->last}; }
+
+        auto operator*() const -> reference { return *this->slot; }
+        auto operator->() const -> pointer { return this->slot; }
+        auto operator++() -> Iterator&
+        {
+            ++this->ctrl;
+            ++this->slot;
+            this->skipFree();
+            return *this;
+        }
+        auto operator++(int) -> Iterator
+        {
+            Iterator result = *this;
+            ++*this;
+            return result;
+        }
+        bool operator==(const Iterator& other) const { return this->slot == other.slot; }
+
+    private:
+        friend class FlatHashMap;
+        friend class Iterator<!is_const>;
+
+        Iterator(const ctrl_t* ctrl, const pointer slot, const ctrl_t* last)
+            : ctrl(ctrl), slot(slot), last(last)
+        {
+        }
+
+        void skipFree()
+        {
+            while (this->ctrl != this->last && *this->ctrl < 0) {
+                ++this->ctrl;
+                ++this->slot;
+            }
+        }
+
+        const ctrl_t* ctrl = nullptr;
+        pointer       slot = nullptr;
+        const ctrl_t* last = nullptr;
+    };
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap() = default;
+    FlatHashMap(const FlatHashMap& other)
+    {
+        this->reserve(other.size());
+        for (const value_type& entry : other) this->emplace(entry.first, entry.second);
+    }
+    FlatHashMap(FlatHashMap&& other) noexcept { this->swap(other); }
+    ~FlatHashMap() { this->release(); }
+
+    auto operator=(FlatHashMap other) noexcept -> FlatHashMap&
+    {
+        this->swap(other);
+        return *this;
+    }
+
+    void swap(FlatHashMap& other) noexcept
+    {
+        std::swap(this->ctrl, other.ctrl);
+        std::swap(this->slots, other.slots);
+        std::swap(this->capacity, other.capacity);
+        std::swap(this->used, other.used);
+        std::swap(this->deleted, other.deleted);
+    }
+
+    /// @name Iteration, in no particular order
+    /// @{
+    auto begin() -> iterator { return this->iteratorFrom<false>(0); }
+    auto end() -> iterator { return this->iteratorAt<false>(this->capacity); }
+    auto begin() const -> const_iterator { return this->iteratorFrom<true>(0); }
+    auto end() const -> const_iterator { return this->iteratorAt<true>(this->capacity); }
+    /// @}
+
+    auto size() const -> size_t { return this->used; }
+    bool empty() const { return this->used == 0; }
+
+    template <typename K>
+    auto find(const K& key) -> iterator
+    {
+        return this->iteratorAt<false>(this->indexOf(key));
+    }
+    template <typename K>
+    auto find(const K& key) const -> const_iterator
+    {
+        return this->iteratorAt<true>(this->indexOf(key));
+    }
+    template <typename K>
+    bool contains(const K& key) const
+    {
+        return this->indexOf(key) != this->capacity;
+    }
+
+    /// Adds `key` with a value built from `args` unless the key is there. Returns the entry of
+    /// the key and whether it was added.
+    template <typename... Args>
+    auto emplace(const Key& key, Args&&... args) -> std::pair<iterator, bool>
+    {
+        size_t index = this->indexOf(key);
+        if (index != this->capacity) return {this->iteratorAt<false>(index), false};
+
+        if (this->used + this->deleted >= this->capacity - this->capacity / 8) this->grow();
+
+        const size_t hash = this->hasher(key);
+        index             = this->freeSlot(hash);
+        if (this->ctrl[index] == flat_hash::deleted) --this->deleted;
+        std::construct_at(
+            this->slots + index,
+            std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(std::forward<Args>(args)...)
+        );
+        this->setCtrl(index, static_cast<ctrl_t>(hash & 0x7F));
+        ++this->used;
+        return {this->iteratorAt<false>(index), true};
+    }
+    auto operator[](const Key& key) -> Value& { return this->emplace(key).first->second; }
+
+    void erase(const iterator position)
+    {
+        const size_t index = static_cast<size_t>(position.slot - this->slots);
+        std::destroy_at(this->slots + index);
+        this->setCtrl(index, flat_hash::deleted);
+        --this->used;
+        ++this->deleted;
+    }
+    template <typename K>
+    auto erase(const K& key) -> size_t
+    {
+        iterator position = this->find(key);
+        if (position == this->end()) return 0;
+
+        this->erase(position);
+        return 1;
+    }
+
+    void clear()
+    {
+        this->release();
+        this->ctrl.reset();
+        this->slots    = nullptr;
+        this->capacity = 0;
+        this->used     = 0;
+        this->deleted  = 0;
+    }
+    /// Makes room for `count` entries without rebuilding the table
+    void reserve(const size_t count)
+    {
+        if (count == 0 || count < this->capacity - this->capacity / 8) return;
+        this->rehash(std::bit_ceil(std::max(count + count / 7 + 1, flat_hash::group_width)));
+    }
+
+private:
+    /// `capacity + group_width` bytes. The first `group_width` are repeated at the end, so the
+    /// group starting at any slot is one unaligned load.
+    std::unique_ptr<ctrl_t[]>   ctrl;
+    value_type*                 slots    = nullptr;
+    size_t                      capacity = 0;  // a power of two, or 0
+    size_t                      used     = 0;
+    size_t                      deleted  = 0;
+    [[no_unique_address]] Hash  hasher;
+    [[no_unique_address]] Equal equal;
+
+    template <bool is_const>
+    auto iteratorAt(const size_t index) const -> Iterator<is_const>
+    {
+        const ctrl_t* first = this->ctrl.get();
+        return {first + index, this->slots + index, first + this->capacity};
+    }
+    template <bool is_const>
+    auto iteratorFrom(const size_t index) const -> Iterator<is_const>
+    {
+        Iterator<is_const> result = this->iteratorAt<is_const>(index);
+        result.skipFree();
+        return result;
+    }
+
+    /// Slot of `key`, or `capacity` if it is not there
+    template <typename K>
+    auto indexOf(const K& key) const -> size_t
+    {
+        if (this->capacity == 0) return this->capacity;
+
+        const size_t hash     = this->hasher(key);
+        const size_t mask     = this->capacity - 1;
+        const auto   h2       = static_cast<ctrl_t>(hash & 0x7F);
+        size_t       position = (hash >> 7) & mask;
+        for (size_t step = flat_hash::group_width;; step += flat_hash::group_width) {
+            flat_hash::Group group(this->ctrl.get() + position);
+            for (uint32_t match = group.match(h2); match != 0; match &= match - 1) {
+                const size_t index = (position + std::countr_zero(match)) & mask;
+                if (this->equal(this->slots[index].first, key)) return index;
+            }
+            if (group.matchEmpty() != 0) return this->capacity;
+            position = (position + step) & mask;
+        }
+    }
+
+    /// First empty or deleted slot on the probe sequence of `hash`. The load limit keeps one.
+    auto freeSlot(const size_t hash) const -> size_t
+    {
+        const size_t mask     = this->capacity - 1;
+        size_t       position = (hash >> 7) & mask;
+        for (size_t step = flat_hash::group_width;; step += flat_hash::group_width) {
+            flat_hash::Group group(this->ctrl.get() + position);
+            if (uint32_t free = group.matchFree(); free != 0) {
+                return (position + std::countr_zero(free)) & mask;
+            }
+            position = (position + step) & mask;
+        }
+    }
+
+    void setCtrl(const size_t index, const ctrl_t value)
+    {
+        this->ctrl[index] = value;
+        if (index < flat_hash::group_width) this->ctrl[this->capacity + index] = value;
+    }
+
+    /// Doubles the table, or only clears the tombstones if they take most of it
+    void grow()
+    {
+        if (this->capacity == 0) {
+            this->rehash(flat_hash::group_width);
+        } else if (this->used < this->capacity * 7 / 16) {
+            this->rehash(this->capacity);
+        } else {
+            this->rehash(this->capacity * 2);
+        }
+    }
+
+    void rehash(const size_t new_capacity)
+    {
+        FlatHashMap table;
+        table.ctrl     = std::make_unique<ctrl_t[]>(new_capacity + flat_hash::group_width);
+        table.slots    = std::allocator<value_type>().allocate(new_capacity);
+        table.capacity = new_capacity;
+        std::fill_n(table.ctrl.get(), new_capacity + flat_hash::group_width, flat_hash::empty);
+
+        for (size_t index = 0; index < this->capacity; ++index) {
+            if (this->ctrl[index] < 0) continue;
+
+            const size_t hash   = table.hasher(this->slots[index].first);
+            const size_t target = table.freeSlot(hash);
+            std::construct_at(table.slots + target, std::move(this->slots[index]));
+            table.setCtrl(target, this->ctrl[index]);
+            ++table.used;
+        }
+        this->swap(table);
+    }
+
+    /// Destroys the entries and frees the slots, leaving the members as they are
+    void release()
+    {
+        if (this->slots == nullptr) return;
+
+        for (size_t index = 0; index < this->capacity; ++index) {
+            if (this->ctrl[index] >= 0) std::destroy_at(this->slots + index);
+        }
+        std::allocator<value_type>().deallocate(this->slots, this->capacity);
+    }
+};
@@ -0,0 +1,214 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <source_location>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "IndexedStore/flat_hash_map.hpp"
+#include "IndexedStore/indexes.hpp"
+#include "IndexedStore/roaring_bitmap.hpp"
+#include "Logger/events_log.hpp"
+
+/**
+ * @class IndexedStore
+ * @brief Entities of one kind together with every index over them.
+ *
+ * Indexes are template arguments (see `indexes`), so adding, removing and re-keying an entity
+ * unrolls at compile time into direct calls on each index, with no virtual dispatch. The first
+ * index is the primary one and must be a `indexes::Unique` over the id. An entry that should be
+ * in an index but is not is logged as a data inconsistency at the caller's location.
+ *
+ * Every entity also gets a dense row number, reused once the entity is removed, which
+ * `indexes::Bitmap` indexes file instead of the entity. `entitiesOf` turns rows back into
+ * entities.
+ */
+template <typename Entity, typename... Index>
+class IndexedStore {
+public:
+    using entity_ptr = std::shared_ptr<Entity>;
+    using Primary    = std::tuple_element_t<0, std::tuple<Index...>>;
+
+    /// `entity_name` names the entity in logs. `context` (the string pool) is handed to the key
+    /// functions that take it.
+    template <typename... Context>
+    explicit IndexedStore(std::string entity_name, Context&... context)
+        : entity_name(std::move(entity_name)), indexes(Index(context...)...)
+    {
+    }
+
+    /// Adds the entity to every index. Returns false, adding nothing, if its id is taken.
+    bool insert(const entity_ptr& entity)
+    {
+        Primary& primary = std::get<Primary>(this->indexes);
+        if (primary.find(primary.keysOf(*entity)) != nullptr) return false;
+
+        this->takeRow(entity);
+        std::apply(
+            [&](auto&... index) {
+                (index.insert(index.keysOf(*entity), this->entryOf(index, entity)), ...);
+            },
+            this->indexes
+        );
+        return true;
+    }
+
+    /// Removes the entity from every index
+    void erase(
+        const entity_ptr&          entity,
+        const std::source_location location = std::source_location::current()
+    )
+    {
+        std::apply(
+            [&](auto&... index) {
+                (this->eraseFrom(index, index.filedKeysOf(*entity), entity, location), ...);
+            },
+            this->indexes
+        );
+        this->freeRow(entity);
+    }
+
+    /// Runs `change`, which returns whether it changed the entity, then moves the entity in each
+    /// `Changed` index from its keys before the change to its keys after it. Indexes whose keys
+    /// stayed the same are not touched.
+    template <typename... Changed, typename Change>
+    bool update(
+        const entity_ptr&          entity,
+        Change&&                   change,
+        const std::source_location location = std::source_location::current()
+    )
+    {
+        std::tuple<typename Changed::keys_type...> before(
+            this->get<Changed>().filedKeysOf(*entity)...
+        );
+        if (!std::forward<Change>(change)()) return false;
+
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (this->move(this->get<Changed>(), std::get<I>(before), entity, location), ...);
+        }(std::index_sequence_for<Changed...>());
+        return true;
+    }
+
+    auto find(const typename Primary::key_type& id) const -> entity_ptr
+    {
+        return std::get<Primary>(this->indexes).find(id);
+    }
+    auto size() const -> size_t { return std::get<Primary>(this->indexes).entries().size(); }
+    bool empty() const { return this->size() == 0; }
+
+    /// Rows of all entities, to take the complement of a bitmap filter in
+    auto rows() const -> const RoaringBitmap& { return this->live_rows; }
+    /// Entities in the given rows, in row order. Rows without an entity are skipped.
+    auto entitiesOf(const RoaringBitmap& rows) const -> std::vector<entity_ptr>
+    {
+        std::vector<entity_ptr> entities;
+        entities.reserve(rows.size());
+        rows.forEach([&](const uint32_t row) {
+            if (row < this->row_entities.size() && this->row_entities[row] != nullptr) {
+                entities.push_back(this->row_entities[row]);
+            }
+        });
+        return entities;
+    }
+
+    template <typename I>
+    auto get() -> I&
+    {
+        return std::get<I>(this->indexes);
+    }
+    template <typename I>
+    auto get() const -> const I&
+    {
+        return std::get<I>(this->indexes);
+    }
+
+private:
+    static constexpr uint32_t no_row = static_cast<uint32_t>(-1);
+
+    std::string          entity_name;
+    std::tuple<Index...> indexes;
+
+    std::vector<entity_ptr>              row_entities;  // null at free rows
+    FlatHashMap<const Entity*, uint32_t> row_numbers;
+    std::vector<uint32_t>                free_rows;
+    RoaringBitmap                        live_rows;
+
+    void takeRow(const entity_ptr& entity)
+    {
+        uint32_t row = static_cast<uint32_t>(this->row_entities.size());
+        if (this->free_rows.empty()) {
+            this->row_entities.push_back(entity);
+        } else {
+            row = this->free_rows.back();
+            this->free_rows.pop_back();
+            this->row_entities[row] = entity;
+        }
+        this->row_numbers.emplace(entity.get(), row);
+        this->live_rows.add(row);
+    }
+    void freeRow(const entity_ptr& entity)
+    {
+        auto number = this->row_numbers.find(entity.get());
+        if (number == this->row_numbers.end()) return;
+
+        const uint32_t row = number->second;
+        this->row_numbers.erase(number);
+        this->row_entities[row] = nullptr;
+        this->free_rows.push_back(row);
+        this->live_rows.remove(row);
+    }
+    /// Row of a stored entity, or `no_row`, which no index holds
+    auto rowOf(const entity_ptr& entity) const -> uint32_t
+    {
+        auto number = this->row_numbers.find(entity.get());
+        return number != this->row_numbers.end() ? number->second : no_row;
+    }
+
+    /// What `index` files the entity under: its row for a bitmap index, the entity otherwise
+    auto entryOf(const auto& index, const entity_ptr& entity) const -> decltype(auto)
+    {
+        if constexpr (std::remove_cvref_t<decltype(index)>::by_row) {
+            return this->rowOf(entity);
+        } else {
+            return (entity);
+        }
+    }
+
+    template <typename I>
+    void move(
+        I&                           index,
+        const typename I::keys_type& before,
+        const entity_ptr&            entity,
+        const std::source_location&  location
+    )
+    {
+        decltype(auto) after = index.keysOf(*entity);
+        if (after == before) return;
+
+        this->eraseFrom(index, before, entity, location);
+        index.insert(after, this->entryOf(index, entity));
+    }
+
+    void eraseFrom(
+        auto&                       index,
+        const auto&                 keys,
+        const entity_ptr&           entity,
+        const std::source_location& location
+    )
+    {
+        if (index.erase(keys, this->entryOf(index, entity))) return;
+
+        EventLog::getInstance().log(
+            LOG_LEVEL::ERROR,
+            location.file_name(),
+            location.line(),
+            "Data inconsistency in " + std::string(index.index_name) + "\n" + this->entity_name +
+                ": " + entity->getId().toString() + "\nExpected entry is missing."
+        );
+    }
+};
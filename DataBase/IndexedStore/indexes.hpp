@@ -0,0 +1,756 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "BigNum/big_uint.hpp"
+#include "IndexedStore/flat_hash_map.hpp"
+#include "IndexedStore/roaring_bitmap.hpp"
+#include "TenantContext/string_pool.hpp"
+
+/**
+ * @brief Index kinds and key functions of `IndexedStore`.
+ *
+ * An index is named by a string literal, used in consistency logs, and reads the keys of an
+ * entity through a `KeyOf` function object. `KeyOf` returns one key, an optional key (no entry
+ * while empty) or a vector of keys (one entry per key). `entries()` hands out the container of
+ * an index as is. Removing or re-keying an entity costs the same however many entities share its
+ * keys.
+ */
+namespace indexes {
+    /// String literal usable as a template argument
+    template <size_t N>
+    struct Name {
+        constexpr Name(const char (&text)[N]) { std::copy_n(text, N, this->text); }
+        constexpr auto view() const -> std::string_view { return {this->text, N - 1}; }
+
+        char text[N];
+    };
+
+    /// @name Shapes of the value returned by `KeyOf`
+    /// @{
+    template <typename Keys>
+    struct KeyList {
+        using key_type = Keys;
+
+        static void forEach(const Keys& key, auto&& function) { function(key); }
+        static auto map(const Keys& key, auto&& function) { return function(key); }
+    };
+
+    template <typename Key>
+    struct KeyList<std::optional<Key>> {
+        using key_type = Key;
+
+        static void forEach(const std::optional<Key>& key, auto&& function)
+        {
+            if (key) function(*key);
+        }
+        static auto map(const std::optional<Key>& key, auto&& function)
+        {
+            using Result = std::decay_t<decltype(function(*key))>;
+            return key ? std::optional<Result>(function(*key)) : std::nullopt;
+        }
+    };
+
+    template <typename Key>
+    struct KeyList<std::vector<Key>> {
+        using key_type = Key;
+
+        static void forEach(const std::vector<Key>& keys, auto&& function)
+        {
+            for (const Key& key : keys) function(key);
+        }
+        static auto map(const std::vector<Key>& keys, auto&& function)
+        {
+            std::vector<std::decay_t<decltype(function(keys.front()))>> result;
+            result.reserve(keys.size());
+            for (const Key& key : keys) result.push_back(function(key));
+            return result;
+        }
+    };
+    /// @}
+
+    /// `T` built from the store's context arguments if it takes them, default-built otherwise
+    template <typename T, typename... Context>
+    auto make(Context&... context) -> T
+    {
+        if constexpr (std::is_constructible_v<T, Context&...>) {
+            return T(context...);
+        } else {
+            return T();
+        }
+    }
+
+    inline auto lowerCase(const std::string_view text) -> std::string
+    {
+        std::string result(text);
+        std::transform(result.begin(), result.end(), result.begin(), [](const unsigned char ch) {
+            return static_cast<char>(::tolower(ch));
+        });
+        return result;
+    }
+
+    namespace detail {
+        template <typename T>
+        auto idOf(const std::weak_ptr<T>& pointer) -> std::optional<BigUint>
+        {
+            auto object = pointer.lock();
+            if (!object) return std::nullopt;
+            return object->getId();
+        }
+
+        template <typename T>
+        auto idOf(const std::shared_ptr<T>& pointer) -> std::optional<BigUint>
+        {
+            if (!pointer) return std::nullopt;
+            return pointer->getId();
+        }
+
+        template <typename Pointer>
+        auto idOf(const std::vector<Pointer>& pointers) -> std::vector<BigUint>
+        {
+            std::vector<BigUint> result;
+            result.reserve(pointers.size());
+            for (const Pointer& pointer : pointers) {
+                if (auto id = idOf(pointer)) result.push_back(*id);
+            }
+            return result;
+        }
+
+        auto collect(auto first, const auto last)
+        {
+            std::vector<std::decay_t<decltype(first->second)>> result;
+            for (; first != last; ++first) result.push_back(first->second);
+            return result;
+        }
+
+        /// Every three consecutive bytes of the text packed into one number, sorted, each once
+        inline auto trigrams(const std::string_view text) -> std::vector<uint32_t>
+        {
+            std::vector<uint32_t> result;
+            if (text.size() < 3) return result;
+
+            result.reserve(text.size() - 2);
+            for (size_t i = 0; i + 2 < text.size(); ++i) {
+                result.push_back(
+                    static_cast<uint32_t>(static_cast<uint8_t>(text[i])) << 16 |
+                    static_cast<uint32_t>(static_cast<uint8_t>(text[i + 1])) << 8 |
+                    static_cast<uint32_t>(static_cast<uint8_t>(text[i + 2]))
+                );
+            }
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+            return result;
+        }
+
+        /// Increasing document numbers, each stored as the LEB128 varint of its distance from the
+        /// one before, so a common trigram costs about a byte per document
+        class PostingList {
+        public:
+            /// `number` must be greater than every number already in the list
+            void push(const uint32_t number)
+            {
+                uint32_t delta = number - this->last;
+                while (delta >= 0x80) {
+                    this->bytes.push_back(static_cast<uint8_t>(delta | 0x80));
+                    delta >>= 7;
+                }
+                this->bytes.push_back(static_cast<uint8_t>(delta));
+                this->last = number;
+                ++this->count;
+            }
+
+            auto size() const -> size_t { return this->count; }
+
+            auto decode() const -> std::vector<uint32_t>
+            {
+                std::vector<uint32_t> result;
+                result.reserve(this->count);
+                this->forEach([&](const uint32_t number) { result.push_back(number); });
+                return result;
+            }
+            /// Keeps the numbers of the sorted `numbers` that are in the list
+            void intersect(std::vector<uint32_t>& numbers) const
+            {
+                auto kept = numbers.begin();
+                auto next = numbers.begin();
+                this->forEach([&](const uint32_t number) {
+                    while (next != numbers.end() && *next < number) ++next;
+                    if (next != numbers.end() && *next == number) *kept++ = *next++;
+                });
+                numbers.erase(kept, numbers.end());
+            }
+
+        private:
+            std::vector<uint8_t> bytes;
+            uint32_t             last  = 0;
+            uint32_t             count = 0;
+
+            void forEach(auto&& function) const
+            {
+                uint32_t number = 0;
+                uint32_t delta  = 0;
+                int      shift  = 0;
+                for (const uint8_t byte : this->bytes) {
+                    delta |= static_cast<uint32_t>(byte & 0x7F) << shift;
+                    shift += 7;
+                    if (byte & 0x80) continue;
+
+                    number += delta;
+                    function(number);
+                    delta = 0;
+                    shift = 0;
+                }
+            }
+        };
+    }  // namespace detail
+
+    /// @name Key functions
+    /// @{
+
+    /// Value of a getter, e.g. `Get<&Deal::getTotalAmount>`
+    template <auto getter>
+    struct Get {
+        decltype(auto) operator()(const auto& entity) const { return std::invoke(getter, entity); }
+    };
+
+    /// Value of a getter unless it is `skipped`, e.g. the enum value that defers to a free text
+    template <auto getter, auto skipped>
+    struct Except {
+        auto operator()(const auto& entity) const
+        {
+            auto value = std::invoke(getter, entity);
+            return value != skipped ? std::optional(value) : std::nullopt;
+        }
+    };
+
+    /// Free text that stands in for an enum value equal to `other`, e.g. the other type of a
+    /// client whose type is `other`. Wrap it in `Interned`.
+    template <auto getter, auto other, auto text_getter>
+    struct Other {
+        auto operator()(const auto& entity) const
+        {
+            const auto& text = std::invoke(text_getter, entity);
+            using Text       = std::remove_cvref_t<decltype(*text)>;
+            if (std::invoke(getter, entity) != other || !text) return std::optional<Text>();
+            return std::optional<Text>(*text);
+        }
+    };
+
+    /// Text of a getter unless it is empty. The view points into the entity; wrap it in `Lower`.
+    template <auto getter>
+    struct NonEmpty {
+        auto operator()(const auto& entity) const -> std::optional<std::string_view>
+        {
+            const std::string& text = std::invoke(getter, entity);
+            if (text.empty()) return std::nullopt;
+            return std::string_view(text);
+        }
+    };
+
+    /// Id of the object a pointer refers to, or of every object of a vector of pointers.
+    /// Null and expired pointers have no key.
+    template <auto getter>
+    struct IdOf {
+        auto operator()(const auto& entity) const
+            -> decltype(detail::idOf(std::invoke(getter, entity)))
+        {
+            return detail::idOf(std::invoke(getter, entity));
+        }
+    };
+
+    /// Lower-case copies of the text keys of `KeyOf`, for case-insensitive search
+    template <typename KeyOf>
+    struct Lower {
+        auto operator()(const auto& entity) const
+        {
+            decltype(auto) keys = this->key_of(entity);
+            return KeyList<std::remove_cvref_t<decltype(keys)>>::map(keys, lowerCase);
+        }
+
+        [[no_unique_address]] KeyOf key_of;
+    };
+
+    /// Text keys of `KeyOf` interned in the tenant string pool. Keys the entity already keeps as
+    /// `InternedStr` of the same pool give their symbol as is. `find` only looks the others up,
+    /// so removing an entity does not grow the pool; a text that is not there maps to
+    /// `StringPool::none`, which no entry has.
+    template <typename KeyOf>
+    class Interned {
+    public:
+        explicit Interned(StringPool& pool) : pool(&pool) {}
+
+        auto operator()(const auto& entity) const
+        {
+            decltype(auto) keys = this->key_of(entity);
+            return KeyList<std::remove_cvref_t<decltype(keys)>>::map(
+                keys, [this](const auto& key) {
+                    if (auto symbol = this->symbolOf(key)) return *symbol;
+                    return this->pool->intern(std::string_view(key));
+                }
+            );
+        }
+        auto find(const auto& entity) const
+        {
+            decltype(auto) keys = this->key_of(entity);
+            return KeyList<std::remove_cvref_t<decltype(keys)>>::map(
+                keys, [this](const auto& key) {
+                    if (auto symbol = this->symbolOf(key)) return *symbol;
+                    return this->pool->find(std::string_view(key)).value_or(StringPool::none);
+                }
+            );
+        }
+
+    private:
+        StringPool*                 pool;
+        [[no_unique_address]] KeyOf key_of;
+
+        auto symbolOf(const auto& key) const -> std::optional<StringPool::Symbol>
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<decltype(key)>, InternedStr>) {
+                if (key.getPool() == this->pool) return key.getSymbol();
+            }
+            return std::nullopt;
+        }
+    };
+    /// @}
+
+    /// Name and key function shared by every index kind
+    template <typename Entity, typename KeyOf, Name name>
+    class Keyed {
+    public:
+        using entity_ptr = std::shared_ptr<Entity>;
+        using keys_type  = std::remove_cvref_t<std::invoke_result_t<const KeyOf&, const Entity&>>;
+        using key_type   = typename KeyList<keys_type>::key_type;
+
+        static constexpr std::string_view index_name = name.view();
+        /// Whether the index files the row of an entity (see `IndexedStore`) instead of the entity
+        static constexpr bool by_row = false;
+
+        template <typename... Context>
+        explicit Keyed(Context&... context) : key_of(make<KeyOf>(context...))
+        {
+        }
+
+        /// Keys of the entity in its current state
+        decltype(auto) keysOf(const Entity& entity) const { return this->key_of(entity); }
+        /// Keys of the entity as they were filed, which adds nothing to the context the way
+        /// `keysOf` may (see `Interned`). For erasing and re-keying.
+        decltype(auto) filedKeysOf(const Entity& entity) const
+        {
+            if constexpr (requires { this->key_of.find(entity); }) {
+                return this->key_of.find(entity);
+            } else {
+                return this->key_of(entity);
+            }
+        }
+
+    protected:
+        static void forEach(const keys_type& keys, auto&& function)
+        {
+            KeyList<keys_type>::forEach(keys, function);
+        }
+
+    private:
+        [[no_unique_address]] KeyOf key_of;
+    };
+
+    /// At most one entity per key, in a flat table: ids, contract numbers, external ids
+    template <typename Entity, typename KeyOf, Name name>
+    class Unique : public Keyed<Entity, KeyOf, name> {
+        using Base = Keyed<Entity, KeyOf, name>;
+
+    public:
+        using typename Base::entity_ptr;
+        using typename Base::key_type;
+        using typename Base::keys_type;
+        using container_type = FlatHashMap<key_type, entity_ptr>;
+        using Base::Base;
+
+        void insert(const keys_type& keys, const entity_ptr& entity)
+        {
+            this->forEach(keys, [&](const key_type& key) { this->by_key.emplace(key, entity); });
+        }
+        /// False if one of the entries was missing
+        bool erase(const keys_type& keys, const entity_ptr& entity)
+        {
+            bool found = true;
+            this->forEach(keys, [&](const key_type& key) {
+                auto it = this->by_key.find(key);
+                if (it == this->by_key.end() || it->second != entity) {
+                    found = false;
+                    return;
+                }
+                this->by_key.erase(it);
+            });
+            return found;
+        }
+
+        /// Takes anything the key hashes and compares with, e.g. a `std::string_view` for text
+        template <typename Key>
+        auto find(const Key& key) const -> entity_ptr
+        {
+            auto it = this->by_key.find(key);
+            return it != this->by_key.end() ? it->second : nullptr;
+        }
+        auto entries() const -> const container_type& { return this->by_key; }
+
+    private:
+        container_type by_key;
+    };
+
+    /// Any number of entities per key, sorted by key: amounts and dates. Each entity keeps the
+    /// iterators of its entries, so removing it does not walk the entities with an equal key.
+    template <typename Entity, typename KeyOf, Name name>
+    class Ordered : public Keyed<Entity, KeyOf, name> {
+        using Base = Keyed<Entity, KeyOf, name>;
+
+    public:
+        using typename Base::entity_ptr;
+        using typename Base::key_type;
+        using typename Base::keys_type;
+        using container_type = std::multimap<key_type, entity_ptr>;
+        using Base::Base;
+
+        void insert(const keys_type& keys, const entity_ptr& entity)
+        {
+            this->forEach(keys, [&](const key_type& key) {
+                this->positions.emplace(entity.get(), this->by_key.emplace(key, entity));
+            });
+        }
+        bool erase(const keys_type& keys, const entity_ptr& entity)
+        {
+            bool found = true;
+            this->forEach(keys, [&](const key_type& key) {
+                auto [first, last] = this->positions.equal_range(entity.get());
+                auto position      = std::find_if(first, last, [&](const auto& entry) {
+                    const key_type& entry_key = entry.second->first;
+                    return !(entry_key < key) && !(key < entry_key);
+                });
+                if (position == last) {
+                    found = false;
+                    return;
+                }
+                this->by_key.erase(position->second);
+                this->positions.erase(position);
+            });
+            return found;
+        }
+
+        auto find(const key_type& key) const -> std::vector<entity_ptr>
+        {
+            auto [first, last] = this->by_key.equal_range(key);
+            return detail::collect(first, last);
+        }
+        /// Entities with keys in [first, last)
+        auto findRange(const key_type& first, const key_type& last) const
+            -> std::vector<entity_ptr>
+        {
+            if (!(first < last)) return {};
+            return detail::collect(this->by_key.lower_bound(first), this->by_key.lower_bound(last));
+        }
+        auto entries() const -> const container_type& { return this->by_key; }
+
+    private:
+        container_type                                                            by_key;
+        std::unordered_multimap<const Entity*, typename container_type::iterator> positions;
+    };
+
+    /// Texts searched for any fragment: lower-cased names, emails, titles, phone digits.
+    ///
+    /// A trigram index: every three consecutive bytes of a text map to the documents (entities)
+    /// whose texts contain them. A fragment of three bytes or more narrows the documents down to
+    /// those holding all its trigrams, and each of them is then checked for the fragment itself.
+    /// Shorter fragments are checked against every document.
+    ///
+    /// Posting lists store document numbers as LEB128 deltas, and a removed entity only frees its
+    /// document. Once freed documents outnumber live ones, the index is rebuilt from the live ones,
+    /// so removal stays O(1) amortized.
+    template <typename Entity, typename KeyOf, Name name>
+    class Substring : public Keyed<Entity, KeyOf, name> {
+        using Base = Keyed<Entity, KeyOf, name>;
+
+    public:
+        using typename Base::entity_ptr;
+        using typename Base::key_type;
+        using typename Base::keys_type;
+        using Base::Base;
+
+        void insert(const keys_type& keys, const entity_ptr& entity)
+        {
+            Document document{entity, {}};
+            this->forEach(keys, [&](const key_type& text) { document.texts.emplace_back(text); });
+            if (document.texts.empty()) return;
+
+            this->add(std::move(document));
+        }
+        bool erase(const keys_type& keys, const entity_ptr& entity)
+        {
+            auto number = this->numbers.find(entity.get());
+            if (number == this->numbers.end()) {
+                bool has_text = false;
+                this->forEach(keys, [&](const key_type&) { has_text = true; });
+                return !has_text;
+            }
+
+            this->documents[number->second] = Document();
+            this->numbers.erase(number);
+            if (this->documents.size() > 2 * this->numbers.size() + rebuild_slack) this->rebuild();
+            return true;
+        }
+
+        /// Entities with a text containing `fragment`, each once, oldest first
+        auto find(const std::string_view fragment) const -> std::vector<entity_ptr>
+        {
+            std::vector<entity_ptr> result;
+            if (fragment.size() < 3) {
+                for (const Document& document : this->documents) {
+                    if (document.contains(fragment)) result.push_back(document.entity);
+                }
+                return result;
+            }
+
+            std::vector<const detail::PostingList*> lists;
+            for (const uint32_t trigram : detail::trigrams(fragment)) {
+                auto list = this->postings.find(trigram);
+                if (list == this->postings.end()) return result;
+                lists.push_back(&list->second);
+            }
+            std::sort(lists.begin(), lists.end(), [](const auto* first, const auto* second) {
+                return first->size() < second->size();
+            });
+
+            std::vector<uint32_t> candidates = lists.front()->decode();
+            for (size_t i = 1; i < lists.size() && !candidates.empty(); ++i) {
+                lists[i]->intersect(candidates);
+            }
+            for (const uint32_t number : candidates) {
+                const Document& document = this->documents[number];
+                if (document.contains(fragment)) result.push_back(document.entity);
+            }
+            return result;
+        }
+        auto size() const -> size_t { return this->numbers.size(); }
+
+    private:
+        /// Texts of one entity. A freed document has no entity and matches nothing.
+        struct Document {
+            entity_ptr               entity;
+            std::vector<std::string> texts;
+
+            bool contains(const std::string_view fragment) const
+            {
+                return std::any_of(this->texts.begin(), this->texts.end(), [&](const auto& text) {
+                    return text.find(fragment) != std::string::npos;
+                });
+            }
+        };
+
+        static constexpr size_t rebuild_slack = 64;
+
+        std::vector<Document>                      documents;
+        FlatHashMap<const Entity*, uint32_t>       numbers;
+        FlatHashMap<uint32_t, detail::PostingList> postings;
+
+        void add(Document document)
+        {
+            const auto number = static_cast<uint32_t>(this->documents.size());
+
+            std::vector<uint32_t> trigrams;
+            for (const std::string& text : document.texts) {
+                const std::vector<uint32_t> text_trigrams = detail::trigrams(text);
+                trigrams.insert(trigrams.end(), text_trigrams.begin(), text_trigrams.end());
+            }
+            std::sort(trigrams.begin(), trigrams.end());
+            trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+            for (const uint32_t trigram : trigrams) this->postings[trigram].push(number);
+
+            this->numbers.emplace(document.entity.get(), number);
+            this->documents.push_back(std::move(document));
+        }
+
+        /// Renumbers the live documents from zero and drops the freed ones from every list
+        void rebuild()
+        {
+            std::vector<Document> live;
+            live.reserve(this->numbers.size());
+            for (Document& document : this->documents) {
+                if (document.entity) live.push_back(std::move(document));
+            }
+
+            this->documents.clear();
+            this->numbers.clear();
+            this->postings.clear();
+            for (Document& document : live) this->add(std::move(document));
+        }
+    };
+
+    /// Entities grouped in a vector per key: names, emails, phone keys, owners, managers, tags.
+    /// Each entry remembers its place in the group and is removed by moving the last entity
+    /// of the group into it, so the order within a group is not kept. `Map` holds the groups;
+    /// `FlatHashMap` suits keys looked up on every request.
+    template <
+        typename Entity,
+        typename KeyOf,
+        Name name,
+        template <typename...> class Map = std::unordered_map>
+    class Bucket : public Keyed<Entity, KeyOf, name> {
+        using Base = Keyed<Entity, KeyOf, name>;
+
+    public:
+        using typename Base::entity_ptr;
+        using typename Base::key_type;
+        using typename Base::keys_type;
+        using container_type = Map<key_type, std::vector<entity_ptr>>;
+        using Base::Base;
+
+        void insert(const keys_type& keys, const entity_ptr& entity)
+        {
+            this->forEach(keys, [&](const key_type& key) {
+                auto& group = this->by_key[key];
+                this->positions.emplace(entity.get(), group.size());
+                group.push_back(entity);
+            });
+        }
+        bool erase(const keys_type& keys, const entity_ptr& entity)
+        {
+            bool found = true;
+            this->forEach(keys, [&](const key_type& key) {
+                auto bucket = this->by_key.find(key);
+                if (bucket == this->by_key.end()) {
+                    found = false;
+                    return;
+                }
+                auto position = this->positionOf(entity.get(), bucket->second);
+                if (position == this->positions.end()) {
+                    found = false;
+                    return;
+                }
+                this->eraseAt(bucket, position);
+            });
+            return found;
+        }
+        /// Drops the whole group, e.g. when the object the key refers to is deleted
+        void eraseKey(const key_type& key)
+        {
+            auto bucket = this->by_key.find(key);
+            if (bucket == this->by_key.end()) return;
+
+            for (const entity_ptr& entity : bucket->second) {
+                this->positions.erase(this->positionOf(entity.get(), bucket->second));
+            }
+            this->by_key.erase(bucket);
+        }
+
+        auto find(const key_type& key) const -> const std::vector<entity_ptr>&
+        {
+            auto bucket = this->by_key.find(key);
+            return bucket != this->by_key.end() ? bucket->second : empty;
+        }
+        auto entries() const -> const container_type& { return this->by_key; }
+
+    private:
+        /// Index of each entry of an entity in its group. The group is not recorded, since a flat
+        /// `Map` moves groups: an index is taken to be an entry in a group if that group holds the
+        /// entity at it. If two groups both hold the entity at that index, either record will do,
+        /// because the records of an entity differ only by index.
+        using positions_type = std::unordered_multimap<const Entity*, size_t>;
+
+        static constexpr size_t                     any_index = static_cast<size_t>(-1);
+        static inline const std::vector<entity_ptr> empty;
+
+        container_type by_key;
+        positions_type positions;
+
+        /// Entry of `entity` in `group` at `index`. An entity is in a group more than once only if
+        /// it has the key more than once, and then any of its entries will do.
+        auto positionOf(
+            const Entity*                  entity,
+            const std::vector<entity_ptr>& group,
+            const size_t                   index = any_index
+        ) -> typename positions_type::iterator
+        {
+            auto [first, last] = this->positions.equal_range(entity);
+            for (; first != last; ++first) {
+                const size_t position = first->second;
+                if (index != any_index && position != index) continue;
+                if (position < group.size() && group[position].get() == entity) return first;
+            }
+            return this->positions.end();
+        }
+
+        void eraseAt(
+            const typename container_type::iterator bucket,
+            const typename positions_type::iterator position
+        )
+        {
+            auto&        group = bucket->second;
+            const size_t index = position->second;
+            const size_t back  = group.size() - 1;
+            if (index != back) {
+                this->positionOf(group[back].get(), group, back)->second = index;
+                group[index] = std::move(group[back]);
+            }
+            group.pop_back();
+            this->positions.erase(position);
+            if (group.empty()) this->by_key.erase(bucket);
+        }
+    };
+
+    /// Rows of entities (see `IndexedStore`) in a compressed bitmap per key: enums and flags, where
+    /// a few keys are shared by many entities. A filter over several of them is a few bitwise
+    /// operations on whole bitmaps, and its count never touches the entities. A row appears once
+    /// per key, so `KeyOf` must not return the same key twice.
+    template <typename Entity, typename KeyOf, Name name>
+    class Bitmap : public Keyed<Entity, KeyOf, name> {
+        using Base = Keyed<Entity, KeyOf, name>;
+
+    public:
+        using typename Base::key_type;
+        using typename Base::keys_type;
+        using container_type = std::unordered_map<key_type, RoaringBitmap>;
+        using Base::Base;
+
+        static constexpr bool by_row = true;
+
+        void insert(const keys_type& keys, const uint32_t row)
+        {
+            this->forEach(keys, [&](const key_type& key) { this->by_key[key].add(row); });
+        }
+        bool erase(const keys_type& keys, const uint32_t row)
+        {
+            bool found = true;
+            this->forEach(keys, [&](const key_type& key) {
+                auto bitmap = this->by_key.find(key);
+                if (bitmap == this->by_key.end() || !bitmap->second.remove(row)) {
+                    found = false;
+                    return;
+                }
+                if (bitmap->second.empty()) this->by_key.erase(bitmap);
+            });
+            return found;
+        }
+
+        auto find(const key_type& key) const -> const RoaringBitmap&
+        {
+            auto bitmap = this->by_key.find(key);
+            return bitmap != this->by_key.end() ? bitmap->second : empty;
+        }
+        auto entries() const -> const container_type& { return this->by_key; }
+
+    private:
+        static inline const RoaringBitmap empty;
+
+        container_type by_key;
+    };
+}  // namespace indexes
@@ -0,0 +1,326 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+/**
+ * @class RoaringBitmap
+ * @brief Compressed set of 32-bit row numbers, after Roaring bitmaps.
+ *
+ * Rows are split by their high 16 bits into chunks of 65536. A chunk holding at most 4096 rows
+ * keeps their low 16 bits as a sorted array; a fuller one keeps a 65536-bit bitset, so no chunk
+ * takes more than 8 KiB. And, or and and-not go chunk by chunk, word by word where both chunks are
+ * bitsets, and `size()` adds up the counts the chunks keep.
+ */
+class RoaringBitmap {
+public:
+    /// False if the row was there already
+    bool add(const uint32_t row)
+    {
+        auto chunk = this->chunkOf(row);
+        if (chunk == this->chunks.end() || chunk->key != high(row)) {
+            chunk = this->chunks.insert(chunk, Chunk(high(row)));
+        }
+        return chunk->add(low(row));
+    }
+    /// False if the row was not there
+    bool remove(const uint32_t row)
+    {
+        auto chunk = this->chunkOf(row);
+        if (chunk == this->chunks.end() || chunk->key != high(row)) return false;
+        if (!chunk->remove(low(row))) return false;
+
+        if (chunk->count == 0) this->chunks.erase(chunk);
+        return true;
+    }
+    bool contains(const uint32_t row) const
+    {
+        auto chunk = std::lower_bound(
+            this->chunks.begin(), this->chunks.end(), high(row), [](const Chunk& c, uint16_t key) {
+                return c.key < key;
+            }
+        );
+        return chunk != this->chunks.end() && chunk->key == high(row) && chunk->contains(low(row));
+    }
+
+    auto size() const -> size_t
+    {
+        size_t result = 0;
+        for (const Chunk& chunk : this->chunks) result += chunk.count;
+        return result;
+    }
+    bool empty() const { return this->chunks.empty(); }
+
+    /// Calls `function` with every row, in increasing order
+    void forEach(auto&& function) const
+    {
+        for (const Chunk& chunk : this->chunks) {
+            const uint32_t base = static_cast<uint32_t>(chunk.key) << 16;
+            chunk.forEach([&](const uint16_t value) { function(base | value); });
+        }
+    }
+
+    /// @name Set operations
+    /// @{
+    friend auto operator&(const RoaringBitmap& first, const RoaringBitmap& second) -> RoaringBitmap
+    {
+        RoaringBitmap result;
+        auto          left  = first.chunks.begin();
+        auto          right = second.chunks.begin();
+        while (left != first.chunks.end() && right != second.chunks.end()) {
+            if (left->key < right->key) {
+                ++left;
+            } else if (right->key < left->key) {
+                ++right;
+            } else {
+                Chunk chunk = Chunk::intersect(*left++, *right++);
+                if (chunk.count != 0) result.chunks.push_back(std::move(chunk));
+            }
+        }
+        return result;
+    }
+    friend auto operator|(const RoaringBitmap& first, const RoaringBitmap& second) -> RoaringBitmap
+    {
+        RoaringBitmap result;
+        auto          left  = first.chunks.begin();
+        auto          right = second.chunks.begin();
+        while (left != first.chunks.end() || right != second.chunks.end()) {
+            if (right == second.chunks.end() ||
+                (left != first.chunks.end() && left->key < right->key)) {
+                result.chunks.push_back(*left++);
+            } else if (left == first.chunks.end() || right->key < left->key) {
+                result.chunks.push_back(*right++);
+            } else {
+                result.chunks.push_back(Chunk::unite(*left++, *right++));
+            }
+        }
+        return result;
+    }
+    /// Rows of `first` that are not in `second`
+    friend auto operator-(const RoaringBitmap& first, const RoaringBitmap& second) -> RoaringBitmap
+    {
+        RoaringBitmap result;
+        auto          right = second.chunks.begin();
+        for (const Chunk& left : first.chunks) {
+            while (right != second.chunks.end() && right->key < left.key) ++right;
+            if (right == second.chunks.end() || right->key != left.key) {
+                result.chunks.push_back(left);
+                continue;
+            }
+            Chunk chunk = Chunk::subtract(left, *right);
+            if (chunk.count != 0) result.chunks.push_back(std::move(chunk));
+        }
+        return result;
+    }
+
+    auto operator&=(const RoaringBitmap& other) -> RoaringBitmap& { return *this = *this & other; }
+    auto operator|=(const RoaringBitmap& other) -> RoaringBitmap& { return *this = *this | other; }
+    auto operator-=(const RoaringBitmap& other) -> RoaringBitmap& { return *this = *this - other; }
+    /// @}
+
+private:
+    /// Rows sharing their high 16 bits. `words` is empty while the chunk is an array.
+    struct Chunk {
+        static constexpr uint32_t max_array  = 4096;
+        static constexpr size_t   word_count = 65536 / 64;
+
+        uint16_t              key   = 0;
+        uint32_t              count = 0;
+        std::vector<uint16_t> values;
+        std::vector<uint64_t> words;
+
+        explicit Chunk(const uint16_t key) : key(key) {}
+
+        bool isBitset() const { return !this->words.empty(); }
+
+        bool contains(const uint16_t value) const
+        {
+            if (this->isBitset()) return (this->words[value >> 6] >> (value & 63)) & 1;
+            return std::binary_search(this->values.begin(), this->values.end(), value);
+        }
+        bool add(const uint16_t value)
+        {
+            if (!this->isBitset()) {
+                auto it = std::lower_bound(this->values.begin(), this->values.end(), value);
+                if (it != this->values.end() && *it == value) return false;
+                if (this->count < max_array) {
+                    this->values.insert(it, value);
+                    ++this->count;
+                    return true;
+                }
+                this->toBitset();
+            }
+            uint64_t& word = this->words[value >> 6];
+            const uint64_t bit = uint64_t{1} << (value & 63);
+            if (word & bit) return false;
+            word |= bit;
+            ++this->count;
+            return true;
+        }
+        bool remove(const uint16_t value)
+        {
+            if (!this->isBitset()) {
+                auto it = std::lower_bound(this->values.begin(), this->values.end(), value);
+                if (it == this->values.end() || *it != value) return false;
+                this->values.erase(it);
+                --this->count;
+                return true;
+            }
+            uint64_t& word = this->words[value >> 6];
+            const uint64_t bit = uint64_t{1} << (value & 63);
+            if (!(word & bit)) return false;
+            word &= ~bit;
+            --this->count;
+            if (this->count <= max_array) this->toArray();
+            return true;
+        }
+
+        void forEach(auto&& function) const
+        {
+            if (!this->isBitset()) {
+                for (const uint16_t value : this->values) function(value);
+                return;
+            }
+            for (size_t i = 0; i < word_count; ++i) {
+                for (uint64_t word = this->words[i]; word != 0; word &= word - 1) {
+                    function(static_cast<uint16_t>(i * 64 + std::countr_zero(word)));
+                }
+            }
+        }
+
+        void toBitset()
+        {
+            this->words.assign(word_count, 0);
+            for (const uint16_t value : this->values) {
+                this->words[value >> 6] |= uint64_t{1} << (value & 63);
+            }
+            this->values = {};
+        }
+        void toArray()
+        {
+            std::vector<uint16_t> values;
+            values.reserve(this->count);
+            this->forEach([&](const uint16_t value) { values.push_back(value); });
+            this->values = std::move(values);
+            this->words  = {};
+        }
+        /// Recounts a bitset filled word by word and turns it into an array if it is small enough
+        void settle()
+        {
+            this->count = 0;
+            for (const uint64_t word : this->words) this->count += std::popcount(word);
+            if (this->count <= max_array) this->toArray();
+        }
+
+        static auto intersect(const Chunk& first, const Chunk& second) -> Chunk
+        {
+            Chunk result(first.key);
+            if (first.isBitset() && second.isBitset()) {
+                result.words.resize(word_count);
+                for (size_t i = 0; i < word_count; ++i) {
+                    result.words[i] = first.words[i] & second.words[i];
+                }
+                result.settle();
+            } else if (!first.isBitset() && !second.isBitset()) {
+                std::set_intersection(
+                    first.values.begin(),
+                    first.values.end(),
+                    second.values.begin(),
+                    second.values.end(),
+                    std::back_inserter(result.values)
+                );
+                result.count = static_cast<uint32_t>(result.values.size());
+            } else {
+                const Chunk& array  = first.isBitset() ? second : first;
+                const Chunk& bitset = first.isBitset() ? first : second;
+                for (const uint16_t value : array.values) {
+                    if (bitset.contains(value)) result.values.push_back(value);
+                }
+                result.count = static_cast<uint32_t>(result.values.size());
+            }
+            return result;
+        }
+        static auto unite(const Chunk& first, const Chunk& second) -> Chunk
+        {
+            if (!first.isBitset() && !second.isBitset() &&
+                first.count + second.count <= max_array) {
+                Chunk result(first.key);
+                std::set_union(
+                    first.values.begin(),
+                    first.values.end(),
+                    second.values.begin(),
+                    second.values.end(),
+                    std::back_inserter(result.values)
+                );
+                result.count = static_cast<uint32_t>(result.values.size());
+                return result;
+            }
+
+            Chunk result = first.isBitset() ? first : second;
+            if (!result.isBitset()) result.toBitset();
+            const Chunk& other = first.isBitset() ? second : first;
+            if (other.isBitset()) {
+                for (size_t i = 0; i < word_count; ++i) result.words[i] |= other.words[i];
+            } else {
+                for (const uint16_t value : other.values) {
+                    result.words[value >> 6] |= uint64_t{1} << (value & 63);
+                }
+            }
+            result.settle();
+            return result;
+        }
+        static auto subtract(const Chunk& first, const Chunk& second) -> Chunk
+        {
+            Chunk result(first.key);
+            if (!first.isBitset()) {
+                for (const uint16_t value : first.values) {
+                    if (!second.contains(value)) result.values.push_back(value);
+                }
+                result.count = static_cast<uint32_t>(result.values.size());
+                return result;
+            }
+
+            result.words = first.words;
+            if (second.isBitset()) {
+                for (size_t i = 0; i < word_count; ++i) result.words[i] &= ~second.words[i];
+            } else {
+                for (const uint16_t value : second.values) {
+                    result.words[value >> 6] &= ~(uint64_t{1} << (value & 63));
+                }
+            }
+            result.settle();
+            return result;
+        }
+    };
+
+    std::vector<Chunk> chunks;  // sorted by key
+
+    static auto high(const uint32_t row) -> uint16_t { return static_cast<uint16_t>(row >> 16); }
+    static auto low(const uint32_t row) -> uint16_t { return static_cast<uint16_t>(row); }
+
+    auto chunkOf(const uint32_t row) -> std::vector<Chunk>::iterator
+    {
+        return std::lower_bound(
+            this->chunks.begin(), this->chunks.end(), high(row), [](const Chunk& c, uint16_t key) {
+                return c.key < key;
+            }
+        );
+    }
+
+#ifdef _TESTING
+public:
+    /// Whether the chunk of `row` keeps a bitset rather than an array
+    bool _isBitset(const uint32_t row) const
+    {
+        for (const Chunk& chunk : this->chunks) {
+            if (chunk.key == high(row)) return chunk.isBitset();
+        }
+        return false;
+    }
+#endif  // _TESTING
+};
@@ -3,11 +3,23 @@
 #include <unordered_map>
 
 #include "DataModels/Interaction/base_interaction.hpp"
+#include "IndexedStore/indexed_store.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 
 using InteractionType = BaseInteraction::InteractionType;
 class InteractionDataBase {
 public:
+    class Update;
+
+    using Symbol = StringPool::Symbol;
+
+    /// Tags are interned in `string_pool`, which is shared by all data bases of one tenant. The
+    /// pool of the current tenant by default, whose symbols the interactions already keep.
+    explicit InteractionDataBase(
+        std::shared_ptr<StringPool> string_pool = StringPool::current()
+    );
+
     void add(const InteractionPtr& interaction);
     void safe_remove(const BigUint& id, const Date& remove_date);
     void hard_remove(const size_t index);
@@ -16,19 +28,19 @@ public:
     /// @{
     auto size() const -> size_t;
     bool empty() const;
-    auto getAll() const -> const std::unordered_map<BigUint, InteractionPtr>&;
-    auto getByExternalId() const -> const std::unordered_map<std::string, InteractionPtr>&;
-    auto getByTitle() const -> const std::multimap<std::string, InteractionPtr>&;
+    auto getStringPool() const -> const StringPool&;
+    auto getAll() const -> const FlatHashMap<BigUint, InteractionPtr>&;
+    auto getByExternalId() const -> const FlatHashMap<std::string, InteractionPtr>&;
     auto getByCreatedDate() const -> const std::multimap<Date, InteractionPtr>&;
     auto getByStartDate() const -> const std::multimap<Date, InteractionPtr>&;
     auto getByEndDate() const -> const std::multimap<Date, InteractionPtr>&;
-    auto getByType() const
-        -> const std::unordered_map<InteractionType, std::vector<InteractionPtr>>&;
-    auto getByPriority() const -> const std::unordered_map<Priority, std::vector<InteractionPtr>>&;
-    auto getByTags() const -> const std::unordered_map<std::string, std::vector<InteractionPtr>>&;
+    auto getByType() const -> const std::unordered_map<InteractionType, RoaringBitmap>&;
+    auto getByPriority() const -> const std::unordered_map<Priority, RoaringBitmap>&;
+    auto getByTags() const -> const std::unordered_map<Symbol, std::vector<InteractionPtr>>&;
     auto getByManager() const -> const std::unordered_map<BigUint, std::vector<InteractionPtr>>&;
     auto getByParticipants() const
         -> const std::unordered_map<BigUint, std::vector<InteractionPtr>>&;
+    auto getRows() const -> const RoaringBitmap&;
     auto getRemoved() const -> const std::vector<std::pair<Date, InteractionPtr>>&;
     ///@}
 
@@ -50,15 +62,19 @@ public:
     auto findByEndDateRange(const Date& first_date, const Date& second_date) const
         -> const std::vector<InteractionPtr>;
 
-    auto findByType(const InteractionType type) const -> const std::vector<InteractionPtr>&;
-    auto findByPriority(const Priority priority) const -> const std::vector<InteractionPtr>&;
+    auto findByType(const InteractionType type) const -> const std::vector<InteractionPtr>;
+    auto findByPriority(const Priority priority) const -> const std::vector<InteractionPtr>;
     auto findByTag(const std::string& tag) const -> const std::vector<InteractionPtr>&;
     auto findByManger(const BigUint& id) const -> const std::vector<InteractionPtr>&;
     auto findByParticipants(const BigUint& id) const -> const std::vector<InteractionPtr>&;
+    /// Interactions in `rows`, a combination of the type and priority bitmaps
+    auto findByRows(const RoaringBitmap& rows) const -> const std::vector<InteractionPtr>;
     /// @}
 
     /// @name Change functions
     /// @{
+    /// Collects changes to the interaction with `id` to apply them at once, see `Update`
+    auto update(const BigUint& id, const InternalEmployeePtr& changer) -> Update;
     void changeExternalId(
         const BigUint& id, const OptionalStr& external_id, const InternalEmployeePtr& changer
     );
@@ -66,9 +82,11 @@ public:
         const BigUint& id, const std::string& title, const InternalEmployeePtr& changer
     );
     void changeStartDate(
-        const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer
+        const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
+    );
+    void changeEndDate(
+        const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
     );
-    void changeEndDate(const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer);
     void changePriority(
         const BigUint& id, const Priority priority, const InternalEmployeePtr& changer
     );
@@ -92,44 +110,87 @@ public:
     /// @}
 
 private:
-    static const std::vector<InteractionPtr>                         empty_vector;
-    std::unordered_map<BigUint, InteractionPtr>                      by_id;
-    std::unordered_map<std::string, InteractionPtr>                  by_external_id;
-    std::multimap<std::string, InteractionPtr>                       by_title_substr_search;
-
-    std::multimap<Date, InteractionPtr>                              by_created_date;
-    std::multimap<Date, InteractionPtr>                              by_start_date;
-    std::multimap<Date, InteractionPtr>                              by_end_date;
-
-    std::unordered_map<InteractionType, std::vector<InteractionPtr>> by_type;
-    std::unordered_map<Priority, std::vector<InteractionPtr>>        by_priority;
-    std::unordered_map<std::string, std::vector<InteractionPtr>>     by_tags;
-
-    //
-    std::unordered_map<BigUint, std::vector<InteractionPtr>> by_manager;
-    std::unordered_map<BigUint, std::vector<InteractionPtr>> by_participants;
-    std::vector<std::pair<Date, InteractionPtr>>             removed;
-
-    //
-    void safeRemoveFromMap(
-        auto&                 map,
-        const auto&           key,
-        const InteractionPtr& interaction,
-        const size_t          line,
-        const std::string&    index_name
-    );
-    void safeRemoveFromVector(
-        auto&                 map,
-        const auto&           key,
-        const InteractionPtr& interaction,
-        const size_t          line,
-        const std::string&    index_name
-    );
+    using Interaction = BaseInteraction;
+    using ById        = indexes::Unique<Interaction, indexes::Get<&Interaction::getId>, "by_id">;
+    using ByExternalId =
+        indexes::Unique<Interaction, indexes::Get<&Interaction::getExternalId>, "by_external_id">;
+    using ByTitle = indexes::Substring<
+        Interaction,
+        indexes::Lower<indexes::NonEmpty<&Interaction::getTitle>>,
+        "by_title_substr_search">;
+    using ByCreatedDate = indexes::Ordered<
+        Interaction,
+        indexes::Get<&Interaction::getCreatedDate>,
+        "by_created_date">;
+    using ByStartDate =
+        indexes::Ordered<Interaction, indexes::Get<&Interaction::getStartDate>, "by_start_date">;
+    using ByEndDate =
+        indexes::Ordered<Interaction, indexes::Get<&Interaction::getEndDate>, "by_end_date">;
+    using ByType = indexes::Bitmap<Interaction, indexes::Get<&Interaction::getType>, "by_type">;
+    using ByPriority =
+        indexes::Bitmap<Interaction, indexes::Get<&Interaction::getPriority>, "by_priority">;
+    using ByTags = indexes::Bucket<
+        Interaction,
+        indexes::Interned<indexes::Get<&Interaction::getTags>>,
+        "by_tags">;
+    using ByManager =
+        indexes::Bucket<Interaction, indexes::IdOf<&Interaction::getManager>, "by_manager">;
+    using ByParticipants = indexes::Bucket<
+        Interaction,
+        indexes::IdOf<&Interaction::getParticipants>,
+        "by_participants">;
+    using Store = IndexedStore<
+        Interaction,
+        ById,
+        ByExternalId,
+        ByTitle,
+        ByCreatedDate,
+        ByStartDate,
+        ByEndDate,
+        ByType,
+        ByPriority,
+        ByTags,
+        ByManager,
+        ByParticipants>;
+
+    static const std::vector<InteractionPtr>     empty_vector;
+    std::shared_ptr<StringPool>                  string_pool;
+    Store                                        store;
+    std::vector<std::pair<Date, InteractionPtr>> removed;
+};
 
-    void logEmptyContainer(
-        const std::string& file,
-        const size_t       line,
-        const std::string& interaction_id,
-        const std::string& index_name
-    );
+/**
+ * @class InteractionDataBase::Update
+ * @brief Changes to several fields of one interaction, applied together.
+ *
+ * Rescheduling usually moves the start and the end date at once; with `Update` both are logged
+ * under one date and each date index is updated once.
+ */
+class InteractionDataBase::Update {
+public:
+    auto setExternalId(const OptionalStr& external_id) -> Update&;
+    auto setTitle(const std::string& title) -> Update&;
+    auto setStartDate(const OptionalDate& date) -> Update&;
+    auto setEndDate(const OptionalDate& date) -> Update&;
+    auto setPriority(const Priority priority) -> Update&;
+    auto setManager(const WeakInternalEmployee& manager) -> Update&;
+
+    /// Returns how many fields changed, 0 if the interaction is not in the data base
+    auto apply() -> size_t;
+
+private:
+    friend class InteractionDataBase;
+
+    Update(InteractionDataBase& data_base, InteractionPtr interaction, InternalEmployeePtr changer);
+
+    InteractionDataBase& data_base;
+    InteractionPtr       interaction;  // nullptr if there is no such interaction
+    InternalEmployeePtr  changer;
+
+    std::optional<OptionalStr>          external_id;
+    std::optional<std::string>          title;
+    std::optional<OptionalDate>         start_date;
+    std::optional<OptionalDate>         end_date;
+    std::optional<Priority>             priority;
+    std::optional<WeakInternalEmployee> manager;
 };
@@ -1,176 +1,44 @@
 #include "client_db.hpp"
 
-#include <algorithm>
 #include <string>
 #include <vector>
 
-#include "Logger/events_log.hpp"
+#include "ChangeLog/change_journal.hpp"
+#include "ChangeLog/change_stream.hpp"
+#include "DateTime/coarse_clock.hpp"
 #include "Person/Employee/internal_employee.hpp"
 #include "TenantContext/tenant_context.hpp"
 
 const std::vector<ClientPtr> ClientDataBase::empty_vector;
+
+ClientDataBase::ClientDataBase(std::shared_ptr<StringPool> string_pool)
+    : string_pool(std::move(string_pool)), store("Client id", *this->string_pool)
+{
+}
 //
 void ClientDataBase::add(const ClientPtr& client)
 {
     if (client == nullptr) return;
 
-    if (this->by_id.find(client->getId()) != this->by_id.end()) {
-        return;
-    }
-    this->by_id[client->getId()] = client;
-    this->by_name.emplace(client->getName(), client);
-
-    std::string lower_name = client->getName();
-    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
-
-    this->by_name_substr_search.emplace(lower_name, client);
-
-    if (client->getEmail()) {
-        this->by_email.emplace(client->getEmail().value(), client);
-
-        std::string lower_email = client->getEmail().value();
-        std::transform(lower_email.begin(), lower_email.end(), lower_email.begin(), ::tolower);
-        this->by_email_substr_search.emplace(lower_email, client);
-    }
-    for (auto& email : client->getMoreEmails()) {
-        this->by_email.emplace(email, client);
-
-        std::string lower_email = email;
-        std::transform(lower_email.begin(), lower_email.end(), lower_email.begin(), ::tolower);
-        this->by_email_substr_search.emplace(lower_email, client);
-    }
-
-    if (client->getPhoneNumber()) {
-        this->by_phone.emplace(client->getPhoneNumber()->getNumber(), client);
-
-        this->by_phone_substr_search.emplace(client->getPhoneNumber()->getNumber(), client);
-    }
-    for (auto& number : client->getMorePhoneNumbers()) {
-        this->by_phone.emplace(number.getNumber(), client);
-
-        this->by_phone_substr_search.emplace(number.getNumber(), client);
-    }
-
-    if (!client->getOwner().expired()) {
-        this->by_owner[client->getOwner().lock()->getId()].push_back(client);
-    }
-
-    if (client->getType() != Client::ClientType::other) {
-        this->by_type[client->getType()].push_back(client);
-    } else {
-        if (client->getOtherType().has_value()) {
-            this->by_other_type[client->getOtherType().value()].push_back(client);
-        }
-    }
-
-    if (client->getLeadSource() != Client::LeadSource::other) {
-        this->by_lead_source[client->getLeadSource()].push_back(client);
-    } else {
-        if (client->getOtherLeadSource().has_value()) {
-            this->by_other_lead_source[client->getOtherLeadSource().value()].push_back(client);
-        }
-    }
-
-    this->by_marketing_consent[client->getMarketingConsent()].push_back(client);
+    if (!this->store.insert(client)) return;
+    ChangeJournal::getInstance().setInitialState(client->change_logs, client->getInitialState());
 
-    if (client->getLeadStatus().has_value()) {
-        this->by_lead_status[client->getLeadStatus().value()].push_back(client);
-    }
+    ChangeStream::getInstance().publish(
+        ChangeEvent::entity(ChangeEvent::Type::Add, EntityType::Client, client->getId())
+    );
 }
 
 void ClientDataBase::soft_remove(const BigUint& id, const Date& remove_date)
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) {
-        return;
-    }
-
-    ClientPtr          client = id_it->second;
-
-    const std::string& name       = client->getName();
-    std::string        lower_name = name;
-    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
-
-    safeRemoveFromMap(by_name, name, client, __LINE__, "by_name");
-    safeRemoveFromMap(by_name_substr_search, lower_name, client, __LINE__, "by_name_substr_search");
-
-    if (client->getEmail().has_value()) {
-        const std::string& email       = client->getEmail().value();
-        std::string        lower_email = email;
-        std::transform(lower_email.begin(), lower_email.end(), lower_email.begin(), ::tolower);
-
-        safeRemoveFromMap(by_email, email, client, __LINE__, "by_email");
-        safeRemoveFromMap(
-            by_email_substr_search, lower_email, client, __LINE__, "by_email_substr_search"
-        );
-    }
-
-    for (const std::string& more_email : client->getMoreEmails()) {
-        std::string lower_more_email = more_email;
-        std::transform(
-            lower_more_email.begin(), lower_more_email.end(), lower_more_email.begin(), ::tolower
-        );
-
-        safeRemoveFromMap(by_email, more_email, client, __LINE__, "by_email");
-        safeRemoveFromMap(
-            by_email_substr_search, lower_more_email, client, __LINE__, "by_email_substr_search"
-        );
-    }
-
-    if (client->getPhoneNumber()) {
-        const std::string& phone = client->getPhoneNumber()->getNumber();
-
-        safeRemoveFromMap(by_phone, phone, client, __LINE__, "by_phone");
-        safeRemoveFromMap(
-            by_phone_substr_search, phone, client, __LINE__, "by_phone_substr_search"
-        );
-    }
-
-    for (const auto& more_phone : client->getMorePhoneNumbers()) {
-        const std::string& phone_str = more_phone.getNumber();
-
-        safeRemoveFromMap(by_phone, phone_str, client, __LINE__, "by_phone");
-        safeRemoveFromMap(
-            by_phone_substr_search, phone_str, client, __LINE__, "by_phone_substr_search"
-        );
-    }
-
-    if (!client->getOwner().expired()) {
-        BigUint owner_id = client->getOwner().lock()->getId();
-        safeRemoveFromVector(by_owner, owner_id, client, __LINE__, "by_owner");
-    }
-
-    Client::ClientType type = client->getType();
-    if (type != Client::ClientType::other) {
-        safeRemoveFromVector(by_type, type, client, __LINE__, "by_type");
-    } else if (client->getOtherType().has_value()) {
-        const std::string& other_type = client->getOtherType().value();
-        safeRemoveFromVector(by_other_type, other_type, client, __LINE__, "by_other_type");
-    }
-
-    Client::LeadSource lead_source = client->getLeadSource();
-    if (lead_source != Client::LeadSource::other) {
-        safeRemoveFromVector(by_lead_source, lead_source, client, __LINE__, "by_lead_source");
-    } else if (client->getOtherLeadSource().has_value()) {
-        const std::string& other_lead_source = client->getOtherLeadSource().value();
-        safeRemoveFromVector(
-            by_other_lead_source, other_lead_source, client, __LINE__, "by_other_lead_source"
-        );
-    }
-
-    bool marketing_consent = client->getMarketingConsent();
-    safeRemoveFromVector(
-        by_marketing_consent, marketing_consent, client, __LINE__, "by_marketing_consent"
-    );
-
-    if (client->getLeadStatus().has_value()) {
-        Client::LeadStatus status = client->getLeadStatus().value();
-        safeRemoveFromVector(by_lead_status, status, client, __LINE__, "by_lead_status");
-    }
+    ClientPtr client = this->store.find(id);
+    if (client == nullptr) return;
 
+    this->store.erase(client);
     this->removed.push_back({remove_date, client});
 
-    by_id.erase(id_it);
+    ChangeStream::getInstance().publish(ChangeEvent::entity(
+        ChangeEvent::Type::SoftRemove, EntityType::Client, client->getId(), remove_date
+    ));
 }
 
 void ClientDataBase::hard_remove(const size_t index, TenantContext& context)
@@ -181,75 +49,87 @@ void ClientDataBase::hard_remove(const size_t index, TenantContext& context)
 
         context.task_data_base.removeParty(client_id);
         context.interaction_data_base.removeParticipant(client_id);
+        ChangeJournal::getInstance().drop(client->change_logs);
 
         this->removed.erase(this->removed.begin() + index);
+        ChangeStream::getInstance().publish(ChangeEvent::entity(
+            ChangeEvent::Type::HardRemove, EntityType::Client, client_id
+        ));
     }
 }
 
-auto ClientDataBase::size() const -> size_t { return this->by_id.size(); }
+auto ClientDataBase::size() const -> size_t { return this->store.size(); }
 
-bool ClientDataBase::empty() const { return this->by_id.empty(); }
+bool ClientDataBase::empty() const { return this->store.empty(); }
 
-auto ClientDataBase::getAll() const -> const std::unordered_map<BigUint, ClientPtr>&
+auto ClientDataBase::getStringPool() const -> const StringPool& { return *this->string_pool; }
+
+auto ClientDataBase::getAll() const -> const FlatHashMap<BigUint, ClientPtr>&
 {
-    return this->by_id;
+    return this->store.get<ById>().entries();
 }
 
-auto ClientDataBase::getByName() const -> const std::unordered_multimap<std::string, ClientPtr>&
+auto ClientDataBase::getByName() const
+    -> const std::unordered_map<std::string, std::vector<ClientPtr>>&
 {
-    return this->by_name;
+    return this->store.get<ByName>().entries();
 }
 
-auto ClientDataBase::getByEmail() const -> const std::unordered_multimap<std::string, ClientPtr>&
+auto ClientDataBase::getByEmail() const -> const FlatHashMap<std::string, std::vector<ClientPtr>>&
 {
-    return this->by_email;
+    return this->store.get<ByEmail>().entries();
 }
 
-auto ClientDataBase::getByPhone() const -> const std::unordered_multimap<std::string, ClientPtr>&
+auto ClientDataBase::getByPhone() const
+    -> const FlatHashMap<PhoneNumber::Key, std::vector<ClientPtr>>&
 {
-    return this->by_phone;
+    return this->store.get<ByPhone>().entries();
 }
 
 auto ClientDataBase::getByOwner() const
     -> const std::unordered_map<BigUint, std::vector<ClientPtr>>&
 {
-    return this->by_owner;
+    return this->store.get<ByOwner>().entries();
 }
 
 auto ClientDataBase::getByType() const
-    -> const std::unordered_map<Client::ClientType, std::vector<ClientPtr>>&
+    -> const std::unordered_map<Client::ClientType, RoaringBitmap>&
 {
-    return this->by_type;
+    return this->store.get<ByType>().entries();
 }
 
 auto ClientDataBase::getByOtherType() const
-    -> const std::unordered_map<std::string, std::vector<ClientPtr>>&
+    -> const std::unordered_map<Symbol, std::vector<ClientPtr>>&
 {
-    return this->by_other_type;
+    return this->store.get<ByOtherType>().entries();
 }
 
 auto ClientDataBase::getByLeadSource() const
-    -> const std::unordered_map<Client::LeadSource, std::vector<ClientPtr>>&
+    -> const std::unordered_map<Client::LeadSource, RoaringBitmap>&
 {
-    return this->by_lead_source;
+    return this->store.get<ByLeadSource>().entries();
 }
 
 auto ClientDataBase::getByOtherLeadSource() const
-    -> const std::unordered_map<std::string, std::vector<ClientPtr>>&
+    -> const std::unordered_map<Symbol, std::vector<ClientPtr>>&
 {
-    return this->by_other_lead_source;
+    return this->store.get<ByOtherLeadSource>().entries();
 }
 
-auto ClientDataBase::getByMarketingConsent() const
-    -> const std::unordered_map<bool, std::vector<ClientPtr>>&
+auto ClientDataBase::getByMarketingConsent() const -> const std::unordered_map<bool, RoaringBitmap>&
 {
-    return this->by_marketing_consent;
+    return this->store.get<ByMarketingConsent>().entries();
 }
 
 auto ClientDataBase::getByLeadStatus() const
-    -> const std::unordered_map<Client::LeadStatus, std::vector<ClientPtr>>&
+    -> const std::unordered_map<Client::LeadStatus, RoaringBitmap>&
 {
-    return this->by_lead_status;
+    return this->store.get<ByLeadStatus>().entries();
+}
+
+auto ClientDataBase::getRows() const -> const RoaringBitmap&
+{
+    return this->store.rows();
 }
 
 auto ClientDataBase::getRemoved() const -> const std::vector<std::pair<Date, ClientPtr>>&
@@ -259,23 +139,12 @@ auto ClientDataBase::getRemoved() const -> const std::vector<std::pair<Date, Cli
 
 auto ClientDataBase::findById(const BigUint& id) const -> const ClientPtr
 {
-    auto client = this->by_id.find(id);
-    if (client != this->by_id.end()) {
-        return client->second;
-    }
-    return nullptr;
+    return this->store.find(id);
 }
 
 auto ClientDataBase::findByName(const std::string& name) const -> const std::vector<ClientPtr>
 {
-    auto clients = this->by_name.equal_range(name);
-    if (clients.first == clients.second) return empty_vector;
-
-    std::vector<ClientPtr> result;
-    for (auto it = clients.first; it != clients.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByName>().find(name);
 }
 
 auto ClientDataBase::findByNameSubstr(const std::string& substr) const
@@ -283,32 +152,12 @@ auto ClientDataBase::findByNameSubstr(const std::string& substr) const
 {
     if (substr.empty()) return empty_vector;
 
-    std::string key = substr;
-    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
-
-    auto first = this->by_name_substr_search.lower_bound(key);
-    key.back()++;
-    auto second = this->by_name_substr_search.lower_bound(key);
-
-    if (first == second) return empty_vector;
-
-    std::vector<ClientPtr> result;
-    for (auto it = first; it != second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByNameSubstr>().find(indexes::lowerCase(substr));
 }
 
 auto ClientDataBase::findByEmail(const std::string& email) const -> const std::vector<ClientPtr>
 {
-    auto clients = this->by_email.equal_range(email);
-    if (clients.first == clients.second) return empty_vector;
-
-    std::vector<ClientPtr> result;
-    for (auto it = clients.first; it != clients.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByEmail>().find(email);
 }
 
 auto ClientDataBase::findByEmailSubstr(const std::string& substr) const
@@ -316,33 +165,20 @@ auto ClientDataBase::findByEmailSubstr(const std::string& substr) const
 {
     if (substr.empty()) return empty_vector;
 
-    std::string key = substr;
-    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
-
-    auto first = this->by_email_substr_search.lower_bound(key);
-    key.back()++;
-    auto second = this->by_email_substr_search.lower_bound(key);
-
-    if (first == second) return empty_vector;
-
-    std::vector<ClientPtr> result;
-    for (auto it = first; it != second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByEmailSubstr>().find(indexes::lowerCase(substr));
 }
 
 auto ClientDataBase::findByPhone(const std::string& phone) const -> const std::vector<ClientPtr>
 {
-    auto clients = this->by_phone.equal_range(phone);
-    if (clients.first == clients.second) return empty_vector;
+    auto number = PhoneNumber::tryParse(phone);
+    if (!number) return empty_vector;
 
-    std::vector<ClientPtr> result;
-    for (auto it = clients.first; it != clients.second; ++it) {
-        result.push_back(it->second);
-    }
+    return this->findByPhone(*number);
+}
 
-    return result;
+auto ClientDataBase::findByPhone(const PhoneNumber& phone) const -> const std::vector<ClientPtr>
+{
+    return this->store.get<ByPhone>().find(phone.getKey());
 }
 
 auto ClientDataBase::findByPhoneSubstr(const std::string& substr) const
@@ -350,410 +186,173 @@ auto ClientDataBase::findByPhoneSubstr(const std::string& substr) const
 {
     if (substr.empty()) return empty_vector;
 
-    std::string key = substr;
-
-    //
-    auto first = this->by_phone_substr_search.lower_bound(key);
-    key.back()++;
-    auto second = this->by_phone_substr_search.lower_bound(key);
-
-    if (first == second) return empty_vector;
-
-    std::vector<ClientPtr> result;
-    for (auto it = first; it != second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByPhoneSubstr>().find(substr);
 }
 
 auto ClientDataBase::findByOwner(const BigUint& id) const -> const std::vector<ClientPtr>&
 {
-    auto clients = this->by_owner.find(id);
-    if (clients != this->by_owner.end()) {
-        return clients->second;
-    }
-    return empty_vector;
+    return this->store.get<ByOwner>().find(id);
 }
 
-auto ClientDataBase::findByType(const Client::ClientType type) const
-    -> const std::vector<ClientPtr>&
+auto ClientDataBase::findByType(const Client::ClientType type) const -> const std::vector<ClientPtr>
 {
-    auto clients = this->by_type.find(type);
-    if (clients != this->by_type.end()) {
-        return clients->second;
-    }
-    return empty_vector;
+    return this->store.entitiesOf(this->store.get<ByType>().find(type));
 }
 
 auto ClientDataBase::findByOtherType(const std::string& type) const -> const std::vector<ClientPtr>&
 {
-    auto clients = this->by_other_type.find(type);
-    if (clients != this->by_other_type.end()) {
-        return clients->second;
-    }
-    return empty_vector;
+    auto symbol = this->string_pool->find(type);
+    if (!symbol) return empty_vector;
+
+    return this->store.get<ByOtherType>().find(*symbol);
 }
 
 auto ClientDataBase::findByLeadSource(const Client::LeadSource source) const
-    -> const std::vector<ClientPtr>&
+    -> const std::vector<ClientPtr>
 {
-    auto clients = this->by_lead_source.find(source);
-    if (clients != this->by_lead_source.end()) {
-        return clients->second;
-    }
-    return empty_vector;
+    return this->store.entitiesOf(this->store.get<ByLeadSource>().find(source));
 }
 
 auto ClientDataBase::findByOtherLeadSource(const std::string& source) const
     -> const std::vector<ClientPtr>&
 {
-    auto clients = this->by_other_lead_source.find(source);
-    if (clients != this->by_other_lead_source.end()) {
-        return clients->second;
-    }
-    return empty_vector;
+    auto symbol = this->string_pool->find(source);
+    if (!symbol) return empty_vector;
+
+    return this->store.get<ByOtherLeadSource>().find(*symbol);
 }
 
 auto ClientDataBase::findByMarketingConsent(const bool consent) const
-    -> const std::vector<ClientPtr>&
+    -> const std::vector<ClientPtr>
 {
-    auto clients = this->by_marketing_consent.find(consent);
-    if (clients != this->by_marketing_consent.end()) {
-        return clients->second;
-    }
-    return empty_vector;
+    return this->store.entitiesOf(this->store.get<ByMarketingConsent>().find(consent));
 }
 
 auto ClientDataBase::findByLeadStatus(const Client::LeadStatus status) const
-    -> const std::vector<ClientPtr>&
+    -> const std::vector<ClientPtr>
 {
-    auto clients = this->by_lead_status.find(status);
-    if (clients != this->by_lead_status.end()) {
-        return clients->second;
-    }
-    return empty_vector;
+    return this->store.entitiesOf(this->store.get<ByLeadStatus>().find(status));
+}
+
+auto ClientDataBase::findByRows(const RoaringBitmap& rows) const -> const std::vector<ClientPtr>
+{
+    return this->store.entitiesOf(rows);
+}
+
+auto ClientDataBase::update(const BigUint& id, const InternalEmployeePtr& changer) -> Update
+{
+    return Update(*this, this->store.find(id), changer);
 }
 
 void ClientDataBase::changeName(
     const BigUint& id, const std::string& name, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr   client   = id_it->second;
-    std::string old_name = client->getName();
-
-    if (client->setName(name, changer)) {
-        // by_name
-        safeRemoveFromMap(this->by_name, old_name, client, __LINE__, "by_name");
-        this->by_name.emplace(name, client);
-
-        // by_name_substr_search
-        std::transform(old_name.begin(), old_name.end(), old_name.begin(), ::tolower);
-        std::string new_name = name;
-        std::transform(new_name.begin(), new_name.end(), new_name.begin(), ::tolower);
-
-        safeRemoveFromMap(
-            this->by_name_substr_search, old_name, client, __LINE__, "by_name_substr_search"
-        );
-        this->by_name_substr_search.emplace(new_name, client);
-    }
+    this->update(id, changer).setName(name).apply();
 }
 
 void ClientDataBase::changeEmail(
     const BigUint& id, const OptionalStr& email, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-    ClientPtr client    = id_it->second;
-    auto      old_email = client->getEmail();
-
-    if (client->setEmail(email, changer)) {
-        if (old_email.has_value()) {
-            std::string old_email_str = old_email.value();
-            safeRemoveFromMap(this->by_email, old_email_str, client, __LINE__, "by_email");
-            std::transform(
-                old_email_str.begin(), old_email_str.end(), old_email_str.begin(), ::tolower
-            );
-            safeRemoveFromMap(
-                this->by_email_substr_search,
-                old_email_str,
-                client,
-                __LINE__,
-                "by_email_substr_search"
-            );
-        }
-        if (email.has_value()) {
-            std::string new_email = email.value();
-            this->by_email.emplace(new_email, client);
-            std::transform(new_email.begin(), new_email.end(), new_email.begin(), ::tolower);
-            this->by_email_substr_search.emplace(new_email, client);
-        }
-    }
+    this->update(id, changer).setEmail(email).apply();
 }
 
 void ClientDataBase::addMoreEmail(
     const BigUint& id, const std::string& email, const InternalEmployeePtr& changer
 )
 {
-    auto client = this->by_id.find(id);
-    if (client == this->by_id.end()) return;
-
-    if (client->second->addMoreEmails(email, changer)) {
-        this->by_email.emplace(email, client->second);
+    ClientPtr client = this->store.find(id);
+    if (client == nullptr) return;
 
-        std::string lower_email = email;
-        std::transform(lower_email.begin(), lower_email.end(), lower_email.begin(), ::tolower);
-        this->by_email_substr_search.emplace(lower_email, client->second);
-    }
+    this->store.update<ByEmail, ByEmailSubstr>(client, [&] {
+        return client->addMoreEmails(email, changer);
+    });
 }
 
 void ClientDataBase::delMoreEmail(
     const BigUint& id, size_t index, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr client = id_it->second;
-    if (client->getMoreEmails().size() <= index) return;
-
-    std::string old_email = client->getMoreEmails()[index];
+    ClientPtr client = this->store.find(id);
+    if (client == nullptr) return;
 
-    if (client->delMoreEmails(index, changer)) {
-        safeRemoveFromMap(this->by_email, old_email, client, __LINE__, "by_email");
-        std::transform(old_email.begin(), old_email.end(), old_email.begin(), ::tolower);
-        safeRemoveFromMap(
-            this->by_email_substr_search, old_email, client, __LINE__, "by_email_substr_search"
-        );
-    }
+    this->store.update<ByEmail, ByEmailSubstr>(client, [&] {
+        return client->delMoreEmails(index, changer);
+    });
 }
 
 void ClientDataBase::changePhone(
     const BigUint& id, const PhoneNumberPtr& number, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr client = id_it->second;
-
-    auto      old_number = client->getPhoneNumber();
-
-    if (client->setPhoneNumber(number, changer)) {
-        if (old_number) {
-            safeRemoveFromMap(
-                this->by_phone, old_number->getNumber(), client, __LINE__, "by_phone"
-            );
-            safeRemoveFromMap(
-                this->by_phone_substr_search,
-                old_number->getNumber(),
-                client,
-                __LINE__,
-                "by_phone_substr_search"
-            );
-        }
-        if (number) {
-            this->by_phone.emplace(number->getNumber(), client);
-            this->by_phone_substr_search.emplace(number->getNumber(), client);
-        }
-    }
+    this->update(id, changer).setPhoneNumber(number).apply();
 }
 
 void ClientDataBase::addMorePhone(
     const BigUint& id, const PhoneNumber& number, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
+    ClientPtr client = this->store.find(id);
+    if (client == nullptr) return;
 
-    ClientPtr client = id_it->second;
-    if (client->addMorePhoneNumber(number, changer)) {
-        this->by_phone.emplace(number.getNumber(), client);
-        this->by_phone_substr_search.emplace(number.getNumber(), client);
-    }
+    this->store.update<ByPhone, ByPhoneSubstr>(client, [&] {
+        return client->addMorePhoneNumber(number, changer);
+    });
 }
 
 void ClientDataBase::delMorePhone(
     const BigUint& id, size_t index, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr client = id_it->second;
-    if (client->getMorePhoneNumbers().size() <= index) return;
-
-    auto old_number = client->getMorePhoneNumbers()[index];
-
-    if (client->delMorePhoneNumber(index, changer)) {
-        std::string old_number_str = old_number.getNumber();
+    ClientPtr client = this->store.find(id);
+    if (client == nullptr) return;
 
-        safeRemoveFromMap(this->by_phone, old_number_str, client, __LINE__, "by_phone");
-        safeRemoveFromMap(
-            this->by_phone_substr_search, old_number_str, client, __LINE__, "by_phone_substr_search"
-        );
-    }
+    this->store.update<ByPhone, ByPhoneSubstr>(client, [&] {
+        return client->delMorePhoneNumber(index, changer);
+    });
 }
 
 void ClientDataBase::changeOwner(
     const BigUint& id, const WeakInternalEmployee& owner, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr client = id_it->second;
-
-    auto      old_owner = client->getOwner();
-
-    if (client->setOwner(owner, changer)) {
-        if (!old_owner.expired()) {
-            safeRemoveFromVector(
-                this->by_owner, old_owner.lock()->getId(), client, __LINE__, "by_owner"
-            );
-        }
-        if (!owner.expired()) {
-            this->by_owner[owner.lock()->getId()].push_back(client);
-        }
-    }
+    this->update(id, changer).setOwner(owner).apply();
 }
 
 void ClientDataBase::changeType(
     const BigUint& id, const Client::ClientType type, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr client = id_it->second;
-
-    auto      old_type = client->getType();
-
-    if (client->setType(type, changer)) {
-        if (old_type != Client::ClientType::other) {
-            safeRemoveFromVector(this->by_type, old_type, client, __LINE__, "by_type");
-        } else if (client->getOtherType()) {
-            safeRemoveFromVector(
-                this->by_other_type,
-                client->getOtherType().value(),
-                client,
-                __LINE__,
-                "by_other_type"
-            );
-        }
-        if (type != Client::ClientType::other) {
-            this->by_type[type].push_back(client);
-        }
-    }
+    this->update(id, changer).setType(type).apply();
 }
 
 void ClientDataBase::changeOtherType(
     const BigUint& id, const std::string& type, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr client = id_it->second;
-
-    auto      old_other_type = client->getOtherType();
-
-    if (client->setOtherType(type, changer)) {
-        if (client->getType() != Client::ClientType::other) {
-            safeRemoveFromVector(this->by_type, client->getType(), client, __LINE__, "by_type");
-        } else if (old_other_type) {
-            safeRemoveFromVector(
-                this->by_other_type, old_other_type.value(), client, __LINE__, "by_other_type"
-            );
-        }
-        this->by_other_type[type].push_back(client);
-    }
+    this->update(id, changer).setOtherType(type).apply();
 }
 
 void ClientDataBase::changeLeadSource(
     const BigUint& id, const Client::LeadSource source, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr client = id_it->second;
-
-    auto      old_lead_source = client->getLeadSource();
-
-    if (client->setLeadSource(source, changer)) {
-        if (old_lead_source != Client::LeadSource::other) {
-            safeRemoveFromVector(
-                this->by_lead_source, old_lead_source, client, __LINE__, "by_lead_source"
-            );
-        } else if (client->getOtherLeadSource()) {
-            safeRemoveFromVector(
-                this->by_other_lead_source,
-                client->getOtherLeadSource().value(),
-                client,
-                __LINE__,
-                "by_other_lead_source"
-            );
-        }
-        if (source != Client::LeadSource::other) {
-            this->by_lead_source[source].push_back(client);
-        }
-    }
+    this->update(id, changer).setLeadSource(source).apply();
 }
 
 void ClientDataBase::changeOtherLeadSource(
     const BigUint& id, const std::string& source, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr client = id_it->second;
-
-    auto      old_other_lead_source = client->getOtherLeadSource();
-
-    if (client->setOtherLeadSource(source, changer)) {
-        if (client->getLeadSource() != Client::LeadSource::other) {
-            safeRemoveFromVector(
-                this->by_lead_source, client->getLeadSource(), client, __LINE__, "by_lead_source"
-            );
-        } else if (old_other_lead_source) {
-            safeRemoveFromVector(
-                this->by_other_lead_source,
-                old_other_lead_source.value(),
-                client,
-                __LINE__,
-                "by_other_lead_source"
-            );
-        }
-        this->by_other_lead_source[source].push_back(client);
-    }
+    this->update(id, changer).setOtherLeadSource(source).apply();
 }
 
 void ClientDataBase::changeMarketingConsent(
     const BigUint& id, const bool consent, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    ClientPtr client = id_it->second;
-
-    auto      old_marketing_consent = client->getMarketingConsent();
-
-    if (client->setMarketingConsent(consent, changer)) {
-        safeRemoveFromVector(
-            this->by_marketing_consent,
-            old_marketing_consent,
-            client,
-            __LINE__,
-            "by_marketing_consent"
-        );
-        this->by_marketing_consent[consent].push_back(client);
-    }
+    this->update(id, changer).setMarketingConsent(consent).apply();
 }
 
 void ClientDataBase::changeLeadStatus(
@@ -762,77 +361,138 @@ void ClientDataBase::changeLeadStatus(
     const InternalEmployeePtr&              changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
+    this->update(id, changer).setLeadStatus(status).apply();
+}
 
-    ClientPtr client = id_it->second;
+void ClientDataBase::removeOwner(const BigUint& id) { this->store.get<ByOwner>().eraseKey(id); }
 
-    auto      old_lead_status = client->getLeadStatus();
+ClientDataBase::Update::Update(
+    ClientDataBase& data_base, ClientPtr client, InternalEmployeePtr changer
+)
+    : data_base(data_base), client(std::move(client)), changer(std::move(changer))
+{
+}
 
-    if (client->setLeadStatus(status, changer)) {
-        if (old_lead_status) {
-            safeRemoveFromVector(
-                this->by_lead_status, old_lead_status.value(), client, __LINE__, "by_lead_status"
-            );
-        }
-        if (status) {
-            this->by_lead_status[status.value()].push_back(client);
-        }
-    }
+auto ClientDataBase::Update::setName(const std::string& name) -> Update&
+{
+    this->name = name;
+    return *this;
 }
 
-void ClientDataBase::removeOwner(const BigUint& id) { this->by_owner.erase(id); }
+auto ClientDataBase::Update::setEmail(const OptionalStr& email) -> Update&
+{
+    this->email = email;
+    return *this;
+}
 
-void ClientDataBase::safeRemoveFromMap(
-    auto&              map,
-    const auto&        key,
-    const ClientPtr&   client,
-    const size_t       line,
-    const std::string& index_name
-)
+auto ClientDataBase::Update::setPhoneNumber(const PhoneNumberPtr& number) -> Update&
 {
-    auto range = map.equal_range(key);
-    for (auto it = range.first; it != range.second; ++it) {
-        if (it->second == client) {
-            map.erase(it);
-            return;
-        }
-    }
-    this->logEmptyContainer(__FILE__, line, client->getId().num, index_name);
+    this->phone_number = number;
+    return *this;
 }
 
-void ClientDataBase::safeRemoveFromVector(
-    auto&              map,
-    const auto&        key,
-    const ClientPtr&   client,
-    const size_t       line,
-    const std::string& index_name
-)
+auto ClientDataBase::Update::setOwner(const WeakInternalEmployee& owner) -> Update&
 {
-    auto& vec = map[key];
-    if (vec.empty()) {
-        this->logEmptyContainer(__FILE__, line, client->getId().num, index_name);
+    this->owner = owner;
+    return *this;
+}
 
-    } else {
-        vec.erase(std::remove(vec.begin(), vec.end(), client), vec.end());
-        if (vec.empty()) {
-            map.erase(key);
-        }
-    }
+auto ClientDataBase::Update::setType(const Client::ClientType type) -> Update&
+{
+    this->type = type;
+    return *this;
 }
 
-void ClientDataBase::logEmptyContainer(
-    const std::string& file,
-    const size_t       line,
-    const std::string& client_id,
-    const std::string& index_name
-)
+auto ClientDataBase::Update::setOtherType(const std::string& other_type) -> Update&
 {
-    EventLog::getInstance().log(
-        LOG_LEVEL::ERROR,
-        file,
-        line,
-        "Data inconsistency in " + index_name + "\nClient id: " + client_id +
-            "\nExpected entry is missing."
-    );
-}
\ No newline at end of file
+    this->other_type = other_type;
+    return *this;
+}
+
+auto ClientDataBase::Update::setLeadSource(const Client::LeadSource lead_source) -> Update&
+{
+    this->lead_source = lead_source;
+    return *this;
+}
+
+auto ClientDataBase::Update::setOtherLeadSource(const std::string& other_lead_source) -> Update&
+{
+    this->other_lead_source = other_lead_source;
+    return *this;
+}
+
+auto ClientDataBase::Update::setMarketingConsent(const bool marketing_consent) -> Update&
+{
+    this->marketing_consent = marketing_consent;
+    return *this;
+}
+
+auto ClientDataBase::Update::setLeadStatus(const std::optional<Client::LeadStatus>& lead_status)
+    -> Update&
+{
+    this->lead_status = lead_status;
+    return *this;
+}
+
+auto ClientDataBase::Update::apply() -> size_t
+{
+    if (this->client == nullptr) return 0;
+
+    Store&           store   = this->data_base.store;
+    const ClientPtr& client  = this->client;
+    const auto&      changer = this->changer;
+    size_t           logged  = client->getChangeLogs().size();
+    CoarseClock::Pin pin;  // one timestamp for the whole group
+
+    if (this->name) {
+        store.update<ByName, ByNameSubstr>(client, [&] {
+            return client->setName(*this->name, changer);
+        });
+    }
+    if (this->email) {
+        store.update<ByEmail, ByEmailSubstr>(client, [&] {
+            return client->setEmail(*this->email, changer);
+        });
+    }
+    if (this->phone_number) {
+        store.update<ByPhone, ByPhoneSubstr>(client, [&] {
+            return client->setPhoneNumber(*this->phone_number, changer);
+        });
+    }
+    if (this->owner) {
+        store.update<ByOwner>(client, [&] { return client->setOwner(*this->owner, changer); });
+    }
+
+    // the type and the other type together decide which index holds the client
+    if (this->type || this->other_type) {
+        store.update<ByType, ByOtherType>(client, [&] {
+            bool changed = false;
+            if (this->type) changed |= client->setType(*this->type, changer);
+            if (this->other_type) changed |= client->setOtherType(*this->other_type, changer);
+            return changed;
+        });
+    }
+    if (this->lead_source || this->other_lead_source) {
+        store.update<ByLeadSource, ByOtherLeadSource>(client, [&] {
+            bool changed = false;
+            if (this->lead_source) changed |= client->setLeadSource(*this->lead_source, changer);
+            if (this->other_lead_source) {
+                changed |= client->setOtherLeadSource(*this->other_lead_source, changer);
+            }
+            return changed;
+        });
+    }
+
+    if (this->marketing_consent) {
+        store.update<ByMarketingConsent>(client, [&] {
+            return client->setMarketingConsent(*this->marketing_consent, changer);
+        });
+    }
+    if (this->lead_status) {
+        store.update<ByLeadStatus>(client, [&] {
+            return client->setLeadStatus(*this->lead_status, changer);
+        });
+    }
+
+    return client->getChangeLogs().size() - logged;
+}
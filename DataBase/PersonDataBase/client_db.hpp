@@ -1,12 +1,27 @@
 #pragma once
 #include <map>
+#include <optional>
 #include <unordered_map>
 
+#include "IndexedStore/indexed_store.hpp"
 #include "Person/Client/client.hpp"
+#include "PersonDataBase/person_keys.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 
 class ClientDataBase {
 public:
+    using Symbol = StringPool::Symbol;
+
+    class Update;
+
+    /// Other type and other lead source keys are interned in `string_pool`, which is shared by
+    /// all data bases of one tenant. The pool of the current tenant by default, whose symbols the
+    /// clients already keep.
+    explicit ClientDataBase(
+        std::shared_ptr<StringPool> string_pool = StringPool::current()
+    );
+
     void add(const ClientPtr& client);
     void soft_remove(const BigUint& id, const Date& remove_date);
     void hard_remove(const size_t index, TenantContext& context);
@@ -15,20 +30,19 @@ public:
     /// @{
     auto size() const -> size_t;
     bool empty() const;
-    auto getAll() const -> const std::unordered_map<BigUint, ClientPtr>&;
-    auto getByName() const -> const std::unordered_multimap<std::string, ClientPtr>&;
-    auto getByEmail() const -> const std::unordered_multimap<std::string, ClientPtr>&;
-    auto getByPhone() const -> const std::unordered_multimap<std::string, ClientPtr>&;
+    auto getStringPool() const -> const StringPool&;
+    auto getAll() const -> const FlatHashMap<BigUint, ClientPtr>&;
+    auto getByName() const -> const std::unordered_map<std::string, std::vector<ClientPtr>>&;
+    auto getByEmail() const -> const FlatHashMap<std::string, std::vector<ClientPtr>>&;
+    auto getByPhone() const -> const FlatHashMap<PhoneNumber::Key, std::vector<ClientPtr>>&;
     auto getByOwner() const -> const std::unordered_map<BigUint, std::vector<ClientPtr>>&;
-    auto getByType() const -> const std::unordered_map<Client::ClientType, std::vector<ClientPtr>>&;
-    auto getByOtherType() const -> const std::unordered_map<std::string, std::vector<ClientPtr>>&;
-    auto getByLeadSource() const
-        -> const std::unordered_map<Client::LeadSource, std::vector<ClientPtr>>&;
-    auto getByOtherLeadSource() const
-        -> const std::unordered_map<std::string, std::vector<ClientPtr>>&;
-    auto getByMarketingConsent() const -> const std::unordered_map<bool, std::vector<ClientPtr>>&;
-    auto getByLeadStatus() const
-        -> const std::unordered_map<Client::LeadStatus, std::vector<ClientPtr>>&;
+    auto getByType() const -> const std::unordered_map<Client::ClientType, RoaringBitmap>&;
+    auto getByOtherType() const -> const std::unordered_map<Symbol, std::vector<ClientPtr>>&;
+    auto getByLeadSource() const -> const std::unordered_map<Client::LeadSource, RoaringBitmap>&;
+    auto getByOtherLeadSource() const -> const std::unordered_map<Symbol, std::vector<ClientPtr>>&;
+    auto getByMarketingConsent() const -> const std::unordered_map<bool, RoaringBitmap>&;
+    auto getByLeadStatus() const -> const std::unordered_map<Client::LeadStatus, RoaringBitmap>&;
+    auto getRows() const -> const RoaringBitmap&;
     auto getRemoved() const -> const std::vector<std::pair<Date, ClientPtr>>&;
     /// @}
 
@@ -40,18 +54,26 @@ public:
     auto findByEmail(const std::string& email) const -> const std::vector<ClientPtr>;
     auto findByEmailSubstr(const std::string& substr) const -> const std::vector<ClientPtr>;
     auto findByPhone(const std::string& phone) const -> const std::vector<ClientPtr>;
+    auto findByPhone(const PhoneNumber& phone) const -> const std::vector<ClientPtr>;
     auto findByPhoneSubstr(const std::string& substr) const -> const std::vector<ClientPtr>;
     auto findByOwner(const BigUint& id) const -> const std::vector<ClientPtr>&;
-    auto findByType(const Client::ClientType type) const -> const std::vector<ClientPtr>&;
+    auto findByType(const Client::ClientType type) const -> const std::vector<ClientPtr>;
     auto findByOtherType(const std::string& type) const -> const std::vector<ClientPtr>&;
-    auto findByLeadSource(const Client::LeadSource source) const -> const std::vector<ClientPtr>&;
+    auto findByLeadSource(const Client::LeadSource source) const -> const std::vector<ClientPtr>;
     auto findByOtherLeadSource(const std::string& source) const -> const std::vector<ClientPtr>&;
-    auto findByMarketingConsent(const bool consent) const -> const std::vector<ClientPtr>&;
-    auto findByLeadStatus(const Client::LeadStatus status) const -> const std::vector<ClientPtr>&;
+    auto findByMarketingConsent(const bool consent) const -> const std::vector<ClientPtr>;
+    auto findByLeadStatus(const Client::LeadStatus status) const -> const std::vector<ClientPtr>;
+    /// Clients in `rows`. Bitmaps from the getters above combine into segments: e.g. the leads
+    /// of a status without marketing consent are that status's bitmap minus the consent bitmap
+    /// of `true`, and `size()` of it counts them without reading any client.
+    auto findByRows(const RoaringBitmap& rows) const -> const std::vector<ClientPtr>;
     /// @}
 
     /// @name Change functions
     /// @{
+    /// Collects changes to the client with `id`, see `Update`. One-field changes below are
+    /// updates of one field.
+    auto update(const BigUint& id, const InternalEmployeePtr& changer) -> Update;
     void changeName(const BigUint& id, const std::string& name, const InternalEmployeePtr& changer);
     void changeEmail(
         const BigUint& id, const OptionalStr& email, const InternalEmployeePtr& changer
@@ -101,44 +123,113 @@ public:
     /// @}
 
 private:
-    static const std::vector<ClientPtr>             empty_vector;
-    std::unordered_map<BigUint, ClientPtr>          by_id;
-    std::unordered_multimap<std::string, ClientPtr> by_name;
-    std::multimap<std::string, ClientPtr>           by_name_substr_search;
-    std::unordered_multimap<std::string, ClientPtr> by_email;
-    std::multimap<std::string, ClientPtr>           by_email_substr_search;
-    std::unordered_multimap<std::string, ClientPtr> by_phone;
-    std::multimap<std::string, ClientPtr>           by_phone_substr_search;
-
-    //
-    std::unordered_map<BigUint, std::vector<ClientPtr>>            by_owner;
-    std::unordered_map<Client::ClientType, std::vector<ClientPtr>> by_type;
-    std::unordered_map<std::string, std::vector<ClientPtr>>        by_other_type;
-    std::unordered_map<Client::LeadSource, std::vector<ClientPtr>> by_lead_source;
-    std::unordered_map<std::string, std::vector<ClientPtr>>        by_other_lead_source;
-    std::unordered_map<bool, std::vector<ClientPtr>>               by_marketing_consent;
-    std::unordered_map<Client::LeadStatus, std::vector<ClientPtr>> by_lead_status;
-    std::vector<std::pair<Date, ClientPtr>>                        removed;
-    //
-    void safeRemoveFromMap(
-        auto&              map,
-        const auto&        key,
-        const ClientPtr&   client,
-        const size_t       line,
-        const std::string& index_name
-    );
-    void safeRemoveFromVector(
-        auto&              map,
-        const auto&        key,
-        const ClientPtr&   client,
-        const size_t       line,
-        const std::string& index_name
-    );
+    using ById   = indexes::Unique<Client, indexes::Get<&Client::getId>, "by_id">;
+    using ByName = indexes::Bucket<Client, indexes::Get<&Client::getName>, "by_name">;
+    using ByNameSubstr = indexes::Substring<
+        Client,
+        indexes::Lower<indexes::Get<&Client::getName>>,
+        "by_name_substr_search">;
+    using ByEmail = indexes::Bucket<Client, person_keys::Emails, "by_email", FlatHashMap>;
+    using ByEmailSubstr = indexes::Substring<
+        Client,
+        indexes::Lower<person_keys::Emails>,
+        "by_email_substr_search">;
+    using ByPhone = indexes::Bucket<Client, person_keys::PhoneKeys, "by_phone", FlatHashMap>;
+    using ByPhoneSubstr =
+        indexes::Substring<Client, person_keys::PhoneNumbers, "by_phone_substr_search">;
+    using ByOwner = indexes::Bucket<Client, indexes::IdOf<&Client::getOwner>, "by_owner">;
+    using ByType  = indexes::Bitmap<
+        Client,
+        indexes::Except<&Client::getType, Client::ClientType::other>,
+        "by_type">;
+    using ByOtherType = indexes::Bucket<
+        Client,
+        indexes::Interned<
+            indexes::Other<&Client::getType, Client::ClientType::other, &Client::getOtherType>>,
+        "by_other_type">;
+    using ByLeadSource = indexes::Bitmap<
+        Client,
+        indexes::Except<&Client::getLeadSource, Client::LeadSource::other>,
+        "by_lead_source">;
+    using ByOtherLeadSource = indexes::Bucket<
+        Client,
+        indexes::Interned<indexes::Other<
+            &Client::getLeadSource,
+            Client::LeadSource::other,
+            &Client::getOtherLeadSource>>,
+        "by_other_lead_source">;
+    using ByMarketingConsent = indexes::Bitmap<
+        Client,
+        indexes::Get<&Client::getMarketingConsent>,
+        "by_marketing_consent">;
+    using ByLeadStatus =
+        indexes::Bitmap<Client, indexes::Get<&Client::getLeadStatus>, "by_lead_status">;
+    using Store = IndexedStore<
+        Client,
+        ById,
+        ByName,
+        ByNameSubstr,
+        ByEmail,
+        ByEmailSubstr,
+        ByPhone,
+        ByPhoneSubstr,
+        ByOwner,
+        ByType,
+        ByOtherType,
+        ByLeadSource,
+        ByOtherLeadSource,
+        ByMarketingConsent,
+        ByLeadStatus>;
 
-    void logEmptyContainer(
-        const std::string& file,
-        const size_t       line,
-        const std::string& client_id,
-        const std::string& index_name
-    );
+    static const std::vector<ClientPtr>     empty_vector;
+    std::shared_ptr<StringPool>             string_pool;
+    Store                                   store;
+    std::vector<std::pair<Date, ClientPtr>> removed;
+};
+
+/**
+ * @class ClientDataBase::Update
+ * @brief Changes to several fields of one client, applied together.
+ *
+ * `ClientDataBase::update` looks the client up once. `apply` makes every change under one
+ * timestamp, so the change log gets one group of entries with the same date and changer, and
+ * moves the client in each affected index once, from its key before the first change to its
+ * key after the last. Fields are changed in the order of the setters below.
+ */
+class ClientDataBase::Update {
+public:
+    auto setName(const std::string& name) -> Update&;
+    auto setEmail(const OptionalStr& email) -> Update&;
+    auto setPhoneNumber(const PhoneNumberPtr& number) -> Update&;
+    auto setOwner(const WeakInternalEmployee& owner) -> Update&;
+    auto setType(const Client::ClientType type) -> Update&;
+    auto setOtherType(const std::string& other_type) -> Update&;
+    auto setLeadSource(const Client::LeadSource lead_source) -> Update&;
+    auto setOtherLeadSource(const std::string& other_lead_source) -> Update&;
+    auto setMarketingConsent(const bool marketing_consent) -> Update&;
+    auto setLeadStatus(const std::optional<Client::LeadStatus>& lead_status) -> Update&;
+
+    /// Returns how many fields changed: the last that many change log entries of the client.
+    /// Does nothing if the client is not in the data base.
+    auto apply() -> size_t;
+
+private:
+    friend class ClientDataBase;
+
+    Update(ClientDataBase& data_base, ClientPtr client, InternalEmployeePtr changer);
+
+    ClientDataBase&     data_base;
+    ClientPtr           client;  // nullptr if there is no such client
+    InternalEmployeePtr changer;
+
+    std::optional<std::string>                       name;
+    std::optional<OptionalStr>                       email;
+    std::optional<PhoneNumberPtr>                    phone_number;
+    std::optional<WeakInternalEmployee>              owner;
+    std::optional<Client::ClientType>                type;
+    std::optional<std::string>                       other_type;
+    std::optional<Client::LeadSource>                lead_source;
+    std::optional<std::string>                       other_lead_source;
+    std::optional<bool>                              marketing_consent;
+    std::optional<std::optional<Client::LeadStatus>> lead_status;
 };
\ No newline at end of file
@@ -3,11 +3,24 @@
 #include <unordered_map>
 
 #include "Company/company.hpp"
+#include "IndexedStore/indexed_store.hpp"
+#include "Person/Employee/external_employee.hpp"
+#include "PersonDataBase/person_keys.hpp"
+#include "TenantContext/string_pool.hpp"
 
 using CompanyId = BigUint;
 class ExternalEmployeeDataBase {
 public:
-    ExternalEmployeeDataBase() = default;
+    class Update;
+
+    using Symbol = StringPool::Symbol;
+
+    /// Status, role and department keys are interned in `string_pool`, which is shared by all
+    /// data bases of one tenant. The pool of the current tenant by default, whose symbols the
+    /// employees already keep.
+    explicit ExternalEmployeeDataBase(
+        std::shared_ptr<StringPool> string_pool = StringPool::current()
+    );
 
     void add(const ExternalEmployeePtr& employee);
     void soft_remove(const BigUint& id, const Date& remove_date);
@@ -17,26 +30,29 @@ public:
     /// @{
     auto size() const -> size_t;
     bool empty() const;
-    auto getAll() const -> const std::unordered_map<BigUint, ExternalEmployeePtr>&;
-    auto getByName() const -> const std::unordered_multimap<std::string, ExternalEmployeePtr>&;
-    auto getByEmail() const -> const std::unordered_multimap<std::string, ExternalEmployeePtr>&;
-    auto getByPhone() const -> const std::unordered_multimap<std::string, ExternalEmployeePtr>&;
+    auto getStringPool() const -> const StringPool&;
+    auto getAll() const -> const FlatHashMap<BigUint, ExternalEmployeePtr>&;
+    auto getByName() const
+        -> const std::unordered_map<std::string, std::vector<ExternalEmployeePtr>>&;
+    auto getByEmail() const -> const FlatHashMap<std::string, std::vector<ExternalEmployeePtr>>&;
+    auto getByPhone() const
+        -> const FlatHashMap<PhoneNumber::Key, std::vector<ExternalEmployeePtr>>&;
     auto getByCompany() const
         -> const std::unordered_map<CompanyId, std::vector<ExternalEmployeePtr>>&;
-    auto getByStatus() const
-        -> const std::unordered_map<EmployeeStatus, std::vector<ExternalEmployeePtr>>&;
+    auto getByStatus() const -> const std::unordered_map<EmployeeStatus, RoaringBitmap>&;
     auto getByOtherStatus() const
-        -> const std::unordered_map<std::string, std::vector<ExternalEmployeePtr>>&;
-    auto getByAccessRole() const
-        -> const std::unordered_map<AccessRole, std::vector<ExternalEmployeePtr>>&;
+        -> const std::unordered_map<Symbol, std::vector<ExternalEmployeePtr>>&;
+    auto getByAccessRole() const -> const std::unordered_map<AccessRole, RoaringBitmap>&;
     auto getByOtherAccessRole() const
+        -> const std::unordered_map<Symbol, std::vector<ExternalEmployeePtr>>&;
+    auto getByInfluenceLevel() const
+        -> const std::unordered_map<ExternalEmployee::InfluenceLevel, RoaringBitmap>&;
+    auto getByTimeZone() const -> const std::unordered_map<int, RoaringBitmap>&;
+    auto getByJobTitle() const
         -> const std::unordered_map<std::string, std::vector<ExternalEmployeePtr>>&;
-    auto getByInfluenceLevel() const -> const
-        std::unordered_map<ExternalEmployee::InfluenceLevel, std::vector<ExternalEmployeePtr>>&;
-    auto getByTimeZone() const -> const std::unordered_map<int, std::vector<ExternalEmployeePtr>>&;
-    auto getByJobTitle() const -> const std::unordered_multimap<std::string, ExternalEmployeePtr>&;
     auto getByDepartment() const
-        -> const std::unordered_multimap<std::string, ExternalEmployeePtr>&;
+        -> const std::unordered_map<Symbol, std::vector<ExternalEmployeePtr>>&;
+    auto getRows() const -> const RoaringBitmap&;
     auto getRemoved() const -> const std::vector<std::pair<Date, ExternalEmployeePtr>>&;
     /// @}
 
@@ -50,27 +66,32 @@ public:
     auto findByEmailSubstr(const std::string& substr) const
         -> const std::vector<ExternalEmployeePtr>;
     auto findByPhone(const std::string& phone) const -> const std::vector<ExternalEmployeePtr>;
+    auto findByPhone(const PhoneNumber& phone) const -> const std::vector<ExternalEmployeePtr>;
     auto findByPhoneSubstr(const std::string& substr) const
         -> const std::vector<ExternalEmployeePtr>;
     auto findByCompany(const CompanyId& id) const -> const std::vector<ExternalEmployeePtr>&;
 
-    auto findByStatus(const EmployeeStatus status) const -> const std::vector<ExternalEmployeePtr>&;
+    auto findByStatus(const EmployeeStatus status) const -> const std::vector<ExternalEmployeePtr>;
     auto findByOtherStatus(const std::string& status) const
         -> const std::vector<ExternalEmployeePtr>&;
-    auto findByAccessRole(const AccessRole role) const -> const std::vector<ExternalEmployeePtr>&;
+    auto findByAccessRole(const AccessRole role) const -> const std::vector<ExternalEmployeePtr>;
     auto findByOtherAccessRole(const std::string& role) const
         -> const std::vector<ExternalEmployeePtr>&;
     auto findByInfluence(const ExternalEmployee::InfluenceLevel level) const
-        -> const std::vector<ExternalEmployeePtr>&;
-    auto findByTimeZone(const int time_zone) const -> const std::vector<ExternalEmployeePtr>&;
+        -> const std::vector<ExternalEmployeePtr>;
+    auto findByTimeZone(const int time_zone) const -> const std::vector<ExternalEmployeePtr>;
     auto findByJobTitle(const std::string& job_title) const
         -> const std::vector<ExternalEmployeePtr>;
     auto findByDepartment(const std::string& department) const
         -> const std::vector<ExternalEmployeePtr>;
+    /// Employees in `rows`, a combination of the status, role, influence and time zone bitmaps
+    auto findByRows(const RoaringBitmap& rows) const -> const std::vector<ExternalEmployeePtr>;
     /// @}
 
     /// @name Change functions
     /// @{
+    /// Collects changes to the employee with `id`, see `Update`
+    auto update(const BigUint& id, const InternalEmployeePtr& changer) -> Update;
     void changeName(const BigUint& id, const std::string& name, const InternalEmployeePtr& changer);
     void changeEmail(
         const BigUint& id, const OptionalStr& email, const InternalEmployeePtr& changer
@@ -124,47 +145,127 @@ public:
     /// @}
 
 private:
-    static const std::vector<ExternalEmployeePtr>                   empty_vector;
-    std::unordered_map<BigUint, ExternalEmployeePtr>                by_id;
-    std::unordered_multimap<std::string, ExternalEmployeePtr>       by_name;
-    std::multimap<std::string, ExternalEmployeePtr>                 by_name_substr_search;
-    std::unordered_multimap<std::string, ExternalEmployeePtr>       by_email;
-    std::multimap<std::string, ExternalEmployeePtr>                 by_email_substr_search;
-    std::unordered_multimap<std::string, ExternalEmployeePtr>       by_phone;
-    std::multimap<std::string, ExternalEmployeePtr>                 by_phone_substr_search;
-    std::unordered_map<CompanyId, std::vector<ExternalEmployeePtr>> by_company;
-    //
-    std::unordered_map<EmployeeStatus, std::vector<ExternalEmployeePtr>> by_status;
-    std::unordered_map<std::string, std::vector<ExternalEmployeePtr>>    by_other_status;
-    std::unordered_map<AccessRole, std::vector<ExternalEmployeePtr>>     by_access_role;
-    std::unordered_map<std::string, std::vector<ExternalEmployeePtr>>    by_other_access_role;
-    std::unordered_map<ExternalEmployee::InfluenceLevel, std::vector<ExternalEmployeePtr>>
-                                                              by_influence_level;
-    std::unordered_map<int, std::vector<ExternalEmployeePtr>> by_time_zone;
-
-    std::unordered_multimap<std::string, ExternalEmployeePtr> by_job_title;
-    std::unordered_multimap<std::string, ExternalEmployeePtr> by_department;
-    std::vector<std::pair<Date, ExternalEmployeePtr>>         removed;
-    //
-    void safeRemoveFromMap(
-        auto&                      map,
-        const auto&                key,
-        const ExternalEmployeePtr& employee,
-        const size_t               line,
-        const std::string&         index_name
-    );
-    void safeRemoveFromVector(
-        auto&                      map,
-        const auto&                key,
-        const ExternalEmployeePtr& employee,
-        const size_t               line,
-        const std::string&         index_name
-    );
+    using Employee = ExternalEmployee;
+    using ById     = indexes::Unique<Employee, indexes::Get<&Employee::getId>, "by_id">;
+    using ByName   = indexes::Bucket<Employee, indexes::Get<&Employee::getName>, "by_name">;
+    using ByNameSubstr = indexes::Substring<
+        Employee,
+        indexes::Lower<indexes::Get<&Employee::getName>>,
+        "by_name_substr_search">;
+    using ByEmail = indexes::Bucket<Employee, person_keys::Emails, "by_email", FlatHashMap>;
+    using ByEmailSubstr = indexes::Substring<
+        Employee,
+        indexes::Lower<person_keys::Emails>,
+        "by_email_substr_search">;
+    using ByPhone = indexes::Bucket<Employee, person_keys::PhoneKeys, "by_phone", FlatHashMap>;
+    using ByPhoneSubstr =
+        indexes::Substring<Employee, person_keys::PhoneNumbers, "by_phone_substr_search">;
+    using ByCompany =
+        indexes::Bucket<Employee, indexes::IdOf<&Employee::getCompany>, "by_company">;
+    using ByStatus = indexes::Bitmap<
+        Employee,
+        indexes::Except<&Employee::getStatus, EmployeeStatus::other>,
+        "by_status">;
+    using ByOtherStatus = indexes::Bucket<
+        Employee,
+        indexes::Interned<
+            indexes::Other<&Employee::getStatus, EmployeeStatus::other, &Employee::getOtherStatus>>,
+        "by_other_status">;
+    using ByAccessRole = indexes::Bitmap<
+        Employee,
+        indexes::Except<&Employee::getAccessRole, AccessRole::other>,
+        "by_access_role">;
+    using ByOtherAccessRole = indexes::Bucket<
+        Employee,
+        indexes::Interned<
+            indexes::Other<&Employee::getAccessRole, AccessRole::other, &Employee::getOtherRole>>,
+        "by_other_access_role">;
+    using ByInfluenceLevel = indexes::Bitmap<
+        Employee,
+        indexes::Get<&Employee::getDecisionInfluence>,
+        "by_decision_influence">;
+    using ByTimeZone =
+        indexes::Bitmap<Employee, indexes::Get<&Employee::getTimeZone>, "by_time_zone">;
+    using ByJobTitle =
+        indexes::Bucket<Employee, indexes::Get<&Employee::getJobTitle>, "by_job_title">;
+    using ByDepartment = indexes::Bucket<
+        Employee,
+        indexes::Interned<indexes::Get<&Employee::getDepartment>>,
+        "by_department">;
+    using Store = IndexedStore<
+        Employee,
+        ById,
+        ByName,
+        ByNameSubstr,
+        ByEmail,
+        ByEmailSubstr,
+        ByPhone,
+        ByPhoneSubstr,
+        ByCompany,
+        ByStatus,
+        ByOtherStatus,
+        ByAccessRole,
+        ByOtherAccessRole,
+        ByInfluenceLevel,
+        ByTimeZone,
+        ByJobTitle,
+        ByDepartment>;
 
-    void logEmptyContainer(
-        const std::string& file,
-        const size_t       line,
-        const std::string& employee_id,
-        const std::string& index_name
+    static const std::vector<ExternalEmployeePtr>     empty_vector;
+    std::shared_ptr<StringPool>                       string_pool;
+    Store                                             store;
+    std::vector<std::pair<Date, ExternalEmployeePtr>> removed;
+};
+
+/**
+ * @class ExternalEmployeeDataBase::Update
+ * @brief Changes to several fields of one external employee, applied together.
+ *
+ * Every change is logged with the same date and moves the employee in each affected index
+ * once; a status and an other status set together make one index update, and so do a role and
+ * an other role.
+ */
+class ExternalEmployeeDataBase::Update {
+public:
+    auto setName(const std::string& name) -> Update&;
+    auto setEmail(const OptionalStr& email) -> Update&;
+    auto setPhoneNumber(const PhoneNumberPtr& number) -> Update&;
+    auto setCompany(const ExternalCompanyPtr& company) -> Update&;
+    auto setStatus(const EmployeeStatus status) -> Update&;
+    auto setOtherStatus(const OptionalStr& other_status) -> Update&;
+    auto setAccessRole(const AccessRole role) -> Update&;
+    auto setOtherRole(const OptionalStr& other_role) -> Update&;
+    auto setInfluence(const std::optional<ExternalEmployee::InfluenceLevel> level) -> Update&;
+    auto setTimeZone(const int time_zone) -> Update&;
+    auto setJobTitle(const OptionalStr& title) -> Update&;
+    auto setDepartment(const OptionalStr& department) -> Update&;
+
+    /// Returns how many fields changed, 0 if the employee is not in the data base
+    auto apply() -> size_t;
+
+private:
+    friend class ExternalEmployeeDataBase;
+
+    Update(
+        ExternalEmployeeDataBase& data_base,
+        ExternalEmployeePtr       employee,
+        InternalEmployeePtr       changer
     );
+
+    ExternalEmployeeDataBase& data_base;
+    ExternalEmployeePtr       employee;  // nullptr if there is no such employee
+    InternalEmployeePtr       changer;
+
+    std::optional<std::string>                                     name;
+    std::optional<OptionalStr>                                     email;
+    std::optional<PhoneNumberPtr>                                  phone_number;
+    std::optional<ExternalCompanyPtr>                              company;
+    std::optional<EmployeeStatus>                                  status;
+    std::optional<OptionalStr>                                     other_status;
+    std::optional<AccessRole>                                      access_role;
+    std::optional<OptionalStr>                                     other_role;
+    std::optional<std::optional<ExternalEmployee::InfluenceLevel>> influence;
+    std::optional<int>                                             time_zone;
+    std::optional<OptionalStr>                                     job_title;
+    std::optional<OptionalStr>                                     department;
 };
\ No newline at end of file
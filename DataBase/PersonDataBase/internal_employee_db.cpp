@@ -1,191 +1,47 @@
 #include "internal_employee_db.hpp"
 
-#include <algorithm>
 #include <string>
 
-#include "Logger/events_log.hpp"
+#include "ChangeLog/change_journal.hpp"
+#include "ChangeLog/change_stream.hpp"
+#include "DateTime/coarse_clock.hpp"
 #include "TenantContext/tenant_context.hpp"
 
 const std::vector<InternalEmployeePtr> InternalEmployeeDataBase::empty_vector;
 
+InternalEmployeeDataBase::InternalEmployeeDataBase(std::shared_ptr<StringPool> string_pool)
+    : string_pool(std::move(string_pool)), store("Internal Employee", *this->string_pool)
+{
+}
 //
 void InternalEmployeeDataBase::add(const InternalEmployeePtr& employee)
 {
     if (employee == nullptr) return;
 
-    if (this->by_id.find(employee->getId()) != this->by_id.end()) {
-        return;
-    }
-    this->by_id[employee->getId()] = employee;
-    this->by_name.emplace(employee->getName(), employee);
-
-    std::string lower_name = employee->getName();
-    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
-
-    this->by_name_substr_search.emplace(lower_name, employee);
-
-    if (employee->getEmail()) {
-        this->by_email.emplace(employee->getEmail().value(), employee);
-
-        std::string lower_email = employee->getEmail().value();
-        std::transform(lower_email.begin(), lower_email.end(), lower_email.begin(), ::tolower);
-        this->by_email_substr_search.emplace(lower_email, employee);
-    }
-    for (auto& email : employee->getMoreEmails()) {
-        this->by_email.emplace(email, employee);
-
-        std::string lower_email = email;
-        std::transform(lower_email.begin(), lower_email.end(), lower_email.begin(), ::tolower);
-        this->by_email_substr_search.emplace(lower_email, employee);
-    }
-
-    if (employee->getPhoneNumber()) {
-        this->by_phone.emplace(employee->getPhoneNumber()->getNumber(), employee);
-
-        this->by_phone_substr_search.emplace(employee->getPhoneNumber()->getNumber(), employee);
-    }
-    for (auto& number : employee->getMorePhoneNumbers()) {
-        this->by_phone.emplace(number.getNumber(), employee);
-
-        this->by_phone_substr_search.emplace(number.getNumber(), employee);
-    }
-
-    if (employee->getDepartment()) {
-        this->by_department.emplace(employee->getDepartment().value(), employee);
-    }
-
-    if (employee->getStatus() != EmployeeStatus::other) {
-        this->by_status[employee->getStatus()].push_back(employee);
-    } else if (employee->getOtherStatus()) {
-        this->by_other_status[employee->getOtherStatus().value()].push_back(employee);
-    }
-
-    if (employee->getAccessRole() != AccessRole::other) {
-        this->by_access_role[employee->getAccessRole()].push_back(employee);
-    } else if (employee->getOtherRole()) {
-        this->by_other_access_role[employee->getOtherRole().value()].push_back(employee);
-    }
-
-    this->by_time_zone[employee->getTimeZone()].push_back(employee);
-
-    if (!employee->getManager().expired()) {
-        this->by_manager[employee->getManager().lock()->getId()].push_back(employee);
-    }
-    if (employee->getPosition()) {
-        this->by_position.emplace(employee->getPosition().value(), employee);
-    }
-    this->by_is_active[employee->getIsActive()].push_back(employee);
+    if (!this->store.insert(employee)) return;
+    ChangeJournal::getInstance().setInitialState(
+        employee->change_logs, employee->getInitialState()
+    );
 
-    if (employee->getSalesTerritory()) {
-        this->by_sales_territory.emplace(employee->getSalesTerritory().value(), employee);
-    }
+    ChangeStream::getInstance().publish(ChangeEvent::entity(
+        ChangeEvent::Type::Add, EntityType::InternalEmployee, employee->getId()
+    ));
 }
 
 void InternalEmployeeDataBase::soft_remove(const BigUint& id, const Date& remove_date)
 {
-    auto employee_it = by_id.find(id);
-    if (employee_it == by_id.end()) {
-        return;
-    }
-
-    InternalEmployeePtr employee = employee_it->second;
-
-    safeRemoveFromMap(by_name, employee->getName(), employee, __LINE__, "by_name");
-
-    std::string lower_name = employee->getName();
-    std::transform(lower_name.begin(), lower_name.end(), lower_name.begin(), ::tolower);
-    safeRemoveFromMap(
-        by_name_substr_search, lower_name, employee, __LINE__, "by_name_substr_search"
-    );
-
-    if (employee->getEmail().has_value()) {
-        const std::string& email = employee->getEmail().value();
-
-        safeRemoveFromMap(by_email, email, employee, __LINE__, "by_email");
-
-        std::string lower_email = email;
-        std::transform(lower_email.begin(), lower_email.end(), lower_email.begin(), ::tolower);
-        safeRemoveFromMap(
-            by_email_substr_search, lower_email, employee, __LINE__, "by_email_substr_search"
-        );
-    }
-
-    for (const std::string& more_email : employee->getMoreEmails()) {
-        safeRemoveFromMap(by_email, more_email, employee, __LINE__, "by_email");
-
-        std::string lower_more_email = more_email;
-        std::transform(
-            lower_more_email.begin(), lower_more_email.end(), lower_more_email.begin(), ::tolower
-        );
-        safeRemoveFromMap(
-            by_email_substr_search, lower_more_email, employee, __LINE__, "by_email_substr_search"
-        );
-    }
-
-    if (employee->getPhoneNumber()) {
-        const std::string& phone = employee->getPhoneNumber()->getNumber();
-
-        safeRemoveFromMap(by_phone, phone, employee, __LINE__, "by_phone");
-        safeRemoveFromMap(
-            by_phone_substr_search, phone, employee, __LINE__, "by_phone_substr_search"
-        );
-    }
-
-    for (const auto& more_phone : employee->getMorePhoneNumbers()) {
-        const std::string& phone_str = more_phone.getNumber();
-
-        safeRemoveFromMap(by_phone, phone_str, employee, __LINE__, "by_phone");
-        safeRemoveFromMap(
-            by_phone_substr_search, phone_str, employee, __LINE__, "by_phone_substr_search"
-        );
-    }
-
-    if (employee->getDepartment()) {
-        const std::string& department = employee->getDepartment().value();
-        safeRemoveFromMap(this->by_department, department, employee, __LINE__, "by_department");
-    }
-
-    if (employee->getStatus() != EmployeeStatus::other) {
-        const auto status = employee->getStatus();
-        safeRemoveFromVector(this->by_status, status, employee, __LINE__, "by_status");
-    } else if (employee->getOtherStatus()) {
-        const std::string& status = employee->getOtherStatus().value();
-        safeRemoveFromVector(this->by_other_status, status, employee, __LINE__, "by_other_status");
-    }
-
-    if (employee->getAccessRole() != AccessRole::other) {
-        const auto role = employee->getAccessRole();
-        safeRemoveFromVector(this->by_access_role, role, employee, __LINE__, "by_access_role");
-    } else if (employee->getOtherRole()) {
-        const std::string& role = employee->getOtherRole().value();
-        safeRemoveFromVector(
-            this->by_other_access_role, role, employee, __LINE__, "by_other_access_role"
-        );
-    }
-    safeRemoveFromVector(
-        this->by_time_zone, employee->getTimeZone(), employee, __LINE__, "by_time_zone"
-    );
-
-    this->by_manager.erase(employee->getId());
-
-    if (employee->getPosition()) {
-        const std::string& position = employee->getPosition().value();
-        safeRemoveFromMap(this->by_position, position, employee, __LINE__, "by_position");
-    }
-
-    safeRemoveFromVector(
-        this->by_is_active, employee->getIsActive(), employee, __LINE__, "by_is_active"
-    );
+    InternalEmployeePtr employee = this->store.find(id);
+    if (employee == nullptr) return;
 
-    if (employee->getSalesTerritory()) {
-        const std::string& territory = employee->getSalesTerritory().value();
-        safeRemoveFromMap(
-            this->by_sales_territory, territory, employee, __LINE__, "by_sales_territory"
-        );
-    }
+    this->store.erase(employee);
     this->removed.push_back({remove_date, employee});
 
-    by_id.erase(employee_it);
+    ChangeStream::getInstance().publish(ChangeEvent::entity(
+        ChangeEvent::Type::SoftRemove,
+        EntityType::InternalEmployee,
+        employee->getId(),
+        remove_date
+    ));
 }
 
 void InternalEmployeeDataBase::hard_remove(const size_t index, TenantContext& context)
@@ -202,97 +58,110 @@ void InternalEmployeeDataBase::hard_remove(const size_t index, TenantContext& co
         context.task_data_base.removeParty(employee_id);
         context.interaction_data_base.removeManager(employee_id);
         context.interaction_data_base.removeParticipant(employee_id);
-        
+        ChangeJournal::getInstance().drop(employee->change_logs);
+
         this->removed.erase(this->removed.begin() + index);
+        ChangeStream::getInstance().publish(ChangeEvent::entity(
+            ChangeEvent::Type::HardRemove, EntityType::InternalEmployee, employee_id
+        ));
     }
 }
 
-auto InternalEmployeeDataBase::size() const -> size_t { return this->by_id.size(); }
+auto InternalEmployeeDataBase::size() const -> size_t { return this->store.size(); }
+
+bool InternalEmployeeDataBase::empty() const { return this->store.empty(); }
 
-bool InternalEmployeeDataBase::empty() const { return this->by_id.empty(); }
+auto InternalEmployeeDataBase::getStringPool() const -> const StringPool&
+{
+    return *this->string_pool;
+}
 
-auto InternalEmployeeDataBase::getAll() const
-    -> const std::unordered_map<BigUint, InternalEmployeePtr>&
+auto InternalEmployeeDataBase::getAll() const -> const FlatHashMap<BigUint, InternalEmployeePtr>&
 {
-    return this->by_id;
+    return this->store.get<ById>().entries();
 }
 
 auto InternalEmployeeDataBase::getByName() const
-    -> const std::unordered_multimap<std::string, InternalEmployeePtr>&
+    -> const std::unordered_map<std::string, std::vector<InternalEmployeePtr>>&
 {
-    return this->by_name;
+    return this->store.get<ByName>().entries();
 }
 
 auto InternalEmployeeDataBase::getByEmail() const
-    -> const std::unordered_multimap<std::string, InternalEmployeePtr>&
+    -> const FlatHashMap<std::string, std::vector<InternalEmployeePtr>>&
 {
-    return this->by_email;
+    return this->store.get<ByEmail>().entries();
 }
 
 auto InternalEmployeeDataBase::getByPhone() const
-    -> const std::unordered_multimap<std::string, InternalEmployeePtr>&
+    -> const FlatHashMap<PhoneNumber::Key, std::vector<InternalEmployeePtr>>&
 {
-    return this->by_phone;
+    return this->store.get<ByPhone>().entries();
 }
 
 auto InternalEmployeeDataBase::getByDepartment() const
-    -> const std::unordered_multimap<std::string, InternalEmployeePtr>&
+    -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&
 {
-    return this->by_department;
+    return this->store.get<ByDepartment>().entries();
 }
 
 auto InternalEmployeeDataBase::getByStatus() const
-    -> const std::unordered_map<EmployeeStatus, std::vector<InternalEmployeePtr>>&
+    -> const std::unordered_map<EmployeeStatus, RoaringBitmap>&
 {
-    return this->by_status;
+    return this->store.get<ByStatus>().entries();
 }
 
 auto InternalEmployeeDataBase::getByOtherStatus() const
-    -> const std::unordered_map<std::string, std::vector<InternalEmployeePtr>>&
+    -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&
 {
-    return this->by_other_status;
+    return this->store.get<ByOtherStatus>().entries();
 }
 
 auto InternalEmployeeDataBase::getByAccessRole() const
-    -> const std::unordered_map<AccessRole, std::vector<InternalEmployeePtr>>&
+    -> const std::unordered_map<AccessRole, RoaringBitmap>&
 {
-    return this->by_access_role;
+    return this->store.get<ByAccessRole>().entries();
 }
 
 auto InternalEmployeeDataBase::getByOtherAccessRole() const
-    -> const std::unordered_map<std::string, std::vector<InternalEmployeePtr>>&
+    -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&
 {
-    return this->by_other_access_role;
+    return this->store.get<ByOtherAccessRole>().entries();
 }
 
 auto InternalEmployeeDataBase::getByTimeZone() const
-    -> const std::unordered_map<int, std::vector<InternalEmployeePtr>>&
+    -> const std::unordered_map<int, RoaringBitmap>&
 {
-    return this->by_time_zone;
+    return this->store.get<ByTimeZone>().entries();
 }
 
 auto InternalEmployeeDataBase::getByManager() const
     -> const std::unordered_map<BigUint, std::vector<InternalEmployeePtr>>&
 {
-    return this->by_manager;
+    return this->store.get<ByManager>().entries();
 }
 
 auto InternalEmployeeDataBase::getByPosition() const
-    -> const std::unordered_multimap<std::string, InternalEmployeePtr>&
+    -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&
 {
-    return this->by_position;
+    return this->store.get<ByPosition>().entries();
 }
 
 auto InternalEmployeeDataBase::getByIsActive() const
-    -> const std::unordered_map<bool, std::vector<InternalEmployeePtr>>&
+    -> const std::unordered_map<bool, RoaringBitmap>&
 {
-    return this->by_is_active;
+    return this->store.get<ByIsActive>().entries();
 }
 
 auto InternalEmployeeDataBase::getSalesTerritory() const
-    -> const std::unordered_multimap<std::string, InternalEmployeePtr>&
+    -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&
 {
-    return this->by_sales_territory;
+    return this->store.get<BySalesTerritory>().entries();
+}
+
+auto InternalEmployeeDataBase::getRows() const -> const RoaringBitmap&
+{
+    return this->store.rows();
 }
 
 auto InternalEmployeeDataBase::getRemoved() const
@@ -303,662 +172,445 @@ auto InternalEmployeeDataBase::getRemoved() const
 
 auto InternalEmployeeDataBase::findById(const BigUint& id) const -> const InternalEmployeePtr
 {
-    auto employee = this->by_id.find(id);
-    if (employee != this->by_id.end()) {
-        return employee->second;
-    }
-    return nullptr;
+    return this->store.find(id);
 }
 
 auto InternalEmployeeDataBase::findByName(const std::string& name) const
     -> const std::vector<InternalEmployeePtr>
 {
-    auto employees = this->by_name.equal_range(name);
-    if (employees.first == employees.second) return empty_vector;
-
-    std::vector<InternalEmployeePtr> result;
-    for (auto it = employees.first; it != employees.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByName>().find(name);
 }
 
 auto InternalEmployeeDataBase::findByNameSubstr(const std::string& substr) const
     -> const std::vector<InternalEmployeePtr>
 {
     if (substr.empty()) return empty_vector;
-    std::string key = substr;
-    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
-
-    auto first = this->by_name_substr_search.lower_bound(key);
-    key.back()++;
-    auto second = this->by_name_substr_search.lower_bound(key);
 
-    if (first == second) return empty_vector;
-    std::vector<InternalEmployeePtr> result;
-    for (auto it = first; it != second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByNameSubstr>().find(indexes::lowerCase(substr));
 }
 
 auto InternalEmployeeDataBase::findByEmail(const std::string& email) const
     -> const std::vector<InternalEmployeePtr>
 {
-    auto employees = this->by_email.equal_range(email);
-    if (employees.first == employees.second) return empty_vector;
-
-    std::vector<InternalEmployeePtr> result;
-    for (auto it = employees.first; it != employees.second; ++it) result.push_back(it->second);
-
-    return result;
+    return this->store.get<ByEmail>().find(email);
 }
 
 auto InternalEmployeeDataBase::findByEmailSubstr(const std::string& substr) const
     -> const std::vector<InternalEmployeePtr>
 {
     if (substr.empty()) return empty_vector;
-    std::string key = substr;
-    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
-
-    auto first = this->by_email_substr_search.lower_bound(key);
-    key.back()++;
-    auto second = this->by_email_substr_search.lower_bound(key);
 
-    if (first == second) return empty_vector;
-    std::vector<InternalEmployeePtr> result;
-    for (auto it = first; it != second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByEmailSubstr>().find(indexes::lowerCase(substr));
 }
 
 auto InternalEmployeeDataBase::findByPhone(const std::string& phone) const
     -> const std::vector<InternalEmployeePtr>
 {
-    auto employees = this->by_phone.equal_range(phone);
-    if (employees.first == employees.second) return empty_vector;
+    auto number = PhoneNumber::tryParse(phone);
+    if (!number) return empty_vector;
 
-    std::vector<InternalEmployeePtr> result;
-    for (auto it = employees.first; it != employees.second; ++it) {
-        result.push_back(it->second);
-    }
+    return this->findByPhone(*number);
+}
 
-    return result;
+auto InternalEmployeeDataBase::findByPhone(const PhoneNumber& phone) const
+    -> const std::vector<InternalEmployeePtr>
+{
+    return this->store.get<ByPhone>().find(phone.getKey());
 }
 
 auto InternalEmployeeDataBase::findByPhoneSubstr(const std::string& substr) const
     -> const std::vector<InternalEmployeePtr>
 {
     if (substr.empty()) return empty_vector;
-    std::string key = substr;
-
-    auto        first = this->by_phone_substr_search.lower_bound(key);
-    key.back()++;
-    auto second = this->by_phone_substr_search.lower_bound(key);
 
-    if (first == second) return empty_vector;
-    std::vector<InternalEmployeePtr> result;
-    for (auto it = first; it != second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByPhoneSubstr>().find(substr);
 }
 
 auto InternalEmployeeDataBase::findByDepartment(const std::string& department) const
     -> const std::vector<InternalEmployeePtr>
 {
-    auto range = this->by_department.equal_range(department);
-    if (range.first == range.second) return empty_vector;
+    auto symbol = this->string_pool->find(department);
+    if (!symbol) return empty_vector;
 
-    std::vector<InternalEmployeePtr> result;
-    for (auto it = range.first; it != range.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByDepartment>().find(*symbol);
 }
 
 auto InternalEmployeeDataBase::findByStatus(const EmployeeStatus status) const
-    -> const std::vector<InternalEmployeePtr>&
+    -> const std::vector<InternalEmployeePtr>
 {
-    auto it = this->by_status.find(status);
-    if (it == this->by_status.end()) return empty_vector;
-    return it->second;
+    return this->store.entitiesOf(this->store.get<ByStatus>().find(status));
 }
 
 auto InternalEmployeeDataBase::findByOtherStatus(const std::string& status) const
     -> const std::vector<InternalEmployeePtr>&
 {
-    auto it = this->by_other_status.find(status);
-    if (it == this->by_other_status.end()) return empty_vector;
-    return it->second;
+    auto symbol = this->string_pool->find(status);
+    if (!symbol) return empty_vector;
+
+    return this->store.get<ByOtherStatus>().find(*symbol);
 }
 
 auto InternalEmployeeDataBase::findByAccessRole(const AccessRole role) const
-    -> const std::vector<InternalEmployeePtr>&
+    -> const std::vector<InternalEmployeePtr>
 {
-    auto it = this->by_access_role.find(role);
-    if (it == this->by_access_role.end()) return empty_vector;
-    return it->second;
+    return this->store.entitiesOf(this->store.get<ByAccessRole>().find(role));
 }
 
 auto InternalEmployeeDataBase::findByOtherAccessRole(const std::string& role) const
     -> const std::vector<InternalEmployeePtr>&
 {
-    auto it = this->by_other_access_role.find(role);
-    if (it == this->by_other_access_role.end()) return empty_vector;
-    return it->second;
+    auto symbol = this->string_pool->find(role);
+    if (!symbol) return empty_vector;
+
+    return this->store.get<ByOtherAccessRole>().find(*symbol);
 }
 
 auto InternalEmployeeDataBase::findByTimeZone(const int time_zone) const
-    -> const std::vector<InternalEmployeePtr>&
+    -> const std::vector<InternalEmployeePtr>
 {
-    auto it = this->by_time_zone.find(time_zone);
-    if (it == this->by_time_zone.end()) return empty_vector;
-    return it->second;
+    return this->store.entitiesOf(this->store.get<ByTimeZone>().find(time_zone));
 }
 
 auto InternalEmployeeDataBase::findByManager(const BigUint& id) const
     -> const std::vector<InternalEmployeePtr>&
 {
-    auto it = this->by_manager.find((id));
-    if (it == this->by_manager.end()) return empty_vector;
-    return it->second;
+    return this->store.get<ByManager>().find(id);
 }
 
 auto InternalEmployeeDataBase::findByPosition(const std::string& position) const
     -> const std::vector<InternalEmployeePtr>
 {
-    auto range = this->by_position.equal_range(position);
-    if (range.first == range.second) return empty_vector;
+    auto symbol = this->string_pool->find(position);
+    if (!symbol) return empty_vector;
 
-    std::vector<InternalEmployeePtr> result;
-    for (auto it = range.first; it != range.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByPosition>().find(*symbol);
 }
 
 auto InternalEmployeeDataBase::findByIsActive(const bool is_active) const
-    -> const std::vector<InternalEmployeePtr>&
+    -> const std::vector<InternalEmployeePtr>
 {
-    auto it = this->by_is_active.find(is_active);
-    if (it == this->by_is_active.end()) return empty_vector;
-    return it->second;
+    return this->store.entitiesOf(this->store.get<ByIsActive>().find(is_active));
+}
+
+auto InternalEmployeeDataBase::findByRows(const RoaringBitmap& rows) const
+    -> const std::vector<InternalEmployeePtr>
+{
+    return this->store.entitiesOf(rows);
 }
 
 auto InternalEmployeeDataBase::findBySalesTerritory(const std::string& sales) const
     -> const std::vector<InternalEmployeePtr>
 {
-    auto range = this->by_sales_territory.equal_range(sales);
-    if (range.first == range.second) return empty_vector;
+    auto symbol = this->string_pool->find(sales);
+    if (!symbol) return empty_vector;
 
-    std::vector<InternalEmployeePtr> result;
-    for (auto it = range.first; it != range.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<BySalesTerritory>().find(*symbol);
+}
+
+auto InternalEmployeeDataBase::update(const BigUint& id, const InternalEmployeePtr& changer)
+    -> Update
+{
+    return Update(*this, this->store.find(id), changer);
 }
 
 void InternalEmployeeDataBase::changeName(
     const BigUint& id, const std::string& name, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-    std::string         old_name = employee->getName();
-
-    if (employee->setName(name, changer)) {
-        // by_name
-        safeRemoveFromMap(this->by_name, old_name, employee, __LINE__, "by_name");
-        this->by_name.emplace(name, employee);
-
-        // by_name_substr_search
-        std::transform(old_name.begin(), old_name.end(), old_name.begin(), ::tolower);
-        std::string new_name = name;
-        std::transform(new_name.begin(), new_name.end(), new_name.begin(), ::tolower);
-
-        safeRemoveFromMap(
-            this->by_name_substr_search, old_name, employee, __LINE__, "by_name_substr_search"
-        );
-        this->by_name_substr_search.emplace(new_name, employee);
-    }
+    this->update(id, changer).setName(name).apply();
 }
 
 void InternalEmployeeDataBase::changeEmail(
     const BigUint& id, const OptionalStr& email, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-    InternalEmployeePtr employee  = id_it->second;
-    auto                old_email = employee->getEmail();
-
-    if (employee->setEmail(email, changer)) {
-        if (old_email.has_value()) {
-            std::string old_email_str = old_email.value();
-
-            safeRemoveFromMap(this->by_email, old_email_str, employee, __LINE__, "by_email");
-            std::transform(
-                old_email_str.begin(), old_email_str.end(), old_email_str.begin(), ::tolower
-            );
-            safeRemoveFromMap(
-                this->by_email_substr_search,
-                old_email_str,
-                employee,
-                __LINE__,
-                "by_email_substr_search"
-            );
-        }
-        if (email.has_value()) {
-            std::string new_email = email.value();
-            this->by_email.emplace(new_email, employee);
-            std::transform(new_email.begin(), new_email.end(), new_email.begin(), ::tolower);
-            this->by_email_substr_search.emplace(new_email, employee);
-        }
-    }
+    this->update(id, changer).setEmail(email).apply();
 }
 
 void InternalEmployeeDataBase::addMoreEmail(
     const BigUint& id, const std::string& email, const InternalEmployeePtr& changer
 )
 {
-    auto employee = this->by_id.find(id);
-    if (employee == this->by_id.end()) return;
-
-    if (employee->second->addMoreEmails(email, changer)) {
-        this->by_email.emplace(email, employee->second);
+    InternalEmployeePtr employee = this->store.find(id);
+    if (employee == nullptr) return;
 
-        std::string lower_email = email;
-        std::transform(lower_email.begin(), lower_email.end(), lower_email.begin(), ::tolower);
-        this->by_email_substr_search.emplace(lower_email, employee->second);
-    }
+    this->store.update<ByEmail, ByEmailSubstr>(employee, [&] {
+        return employee->addMoreEmails(email, changer);
+    });
 }
 
 void InternalEmployeeDataBase::delMoreEmail(
     const BigUint& id, size_t index, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-    if (employee->getMoreEmails().size() <= index) return;
-
-    std::string old_email = employee->getMoreEmails()[index];
+    InternalEmployeePtr employee = this->store.find(id);
+    if (employee == nullptr) return;
 
-    if (employee->delMoreEmails(index, changer)) {
-        safeRemoveFromMap(this->by_email, old_email, employee, __LINE__, "by_email");
-        std::transform(old_email.begin(), old_email.end(), old_email.begin(), ::tolower);
-        safeRemoveFromMap(
-            this->by_email_substr_search, old_email, employee, __LINE__, "by_email_substr_search"
-        );
-    }
+    this->store.update<ByEmail, ByEmailSubstr>(employee, [&] {
+        return employee->delMoreEmails(index, changer);
+    });
 }
 
 void InternalEmployeeDataBase::changePhone(
     const BigUint& id, const PhoneNumberPtr& number, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    auto                old_number = employee->getPhoneNumber();
-
-    if (employee->setPhoneNumber(number, changer)) {
-        if (old_number) {
-            safeRemoveFromMap(
-                this->by_phone, old_number->getNumber(), employee, __LINE__, "by_phone"
-            );
-            safeRemoveFromMap(
-                this->by_phone_substr_search,
-                old_number->getNumber(),
-                employee,
-                __LINE__,
-                "by_phone_substr_search"
-            );
-        }
-        if (number) {
-            this->by_phone.emplace(number->getNumber(), employee);
-            this->by_phone_substr_search.emplace(number->getNumber(), employee);
-        }
-    }
+    this->update(id, changer).setPhoneNumber(number).apply();
 }
 
 void InternalEmployeeDataBase::addMorePhone(
     const BigUint& id, const PhoneNumber& number, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
+    InternalEmployeePtr employee = this->store.find(id);
+    if (employee == nullptr) return;
 
-    InternalEmployeePtr employee = id_it->second;
-    if (employee->addMorePhoneNumber(number, changer)) {
-        this->by_phone.emplace(number.getNumber(), employee);
-        this->by_phone_substr_search.emplace(number.getNumber(), employee);
-    }
+    this->store.update<ByPhone, ByPhoneSubstr>(employee, [&] {
+        return employee->addMorePhoneNumber(number, changer);
+    });
 }
 
 void InternalEmployeeDataBase::delMorePhone(
     const BigUint& id, size_t index, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-    if (employee->getMorePhoneNumbers().size() <= index) return;
-
-    auto old_number = employee->getMorePhoneNumbers()[index];
-
-    if (employee->delMorePhoneNumber(index, changer)) {
-        std::string old_number_str = old_number.getNumber();
+    InternalEmployeePtr employee = this->store.find(id);
+    if (employee == nullptr) return;
 
-        safeRemoveFromMap(this->by_phone, old_number_str, employee, __LINE__, "by_phone");
-        safeRemoveFromMap(
-            this->by_phone_substr_search,
-            old_number_str,
-            employee,
-            __LINE__,
-            "by_phone_substr_search"
-        );
-    }
+    this->store.update<ByPhone, ByPhoneSubstr>(employee, [&] {
+        return employee->delMorePhoneNumber(index, changer);
+    });
 }
 
 void InternalEmployeeDataBase::changeDepartment(
     const BigUint& id, const OptionalStr& department, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    const auto&         old_department = employee->getDepartment();
-
-    if (employee->setDepartment(department, changer)) {
-        if (old_department) {
-            safeRemoveFromMap(
-                this->by_department, old_department.value(), employee, __LINE__, "by_department"
-            );
-        }
-        if (department) {
-            this->by_department.emplace(department.value(), employee);
-        }
-    }
+    this->update(id, changer).setDepartment(department).apply();
 }
 
 void InternalEmployeeDataBase::changeStatus(
     const BigUint& id, const EmployeeStatus status, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    EmployeeStatus      old_status = employee->getStatus();
-
-    if (employee->setStatus(status, changer)) {
-        if (old_status != EmployeeStatus::other) {
-            safeRemoveFromVector(this->by_status, old_status, employee, __LINE__, "by_status");
-        } else if (employee->getOtherStatus()) {
-            const std::string& status = employee->getOtherStatus().value();
-            safeRemoveFromVector(
-                this->by_other_status, status, employee, __LINE__, "by_other_status"
-            );
-        }
-        if (status != EmployeeStatus::other) {
-            this->by_status[status].push_back(employee);
-        }
-    }
+    this->update(id, changer).setStatus(status).apply();
 }
 
 void InternalEmployeeDataBase::changeOtherStatus(
     const BigUint& id, const OptionalStr& status, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    const auto&         old_status = employee->getOtherStatus();
-
-    if (employee->setOtherStatus(status, changer)) {
-        if (old_status) {
-            safeRemoveFromVector(
-                this->by_other_status, old_status.value(), employee, __LINE__, "by_other_status"
-            );
-        } else if (employee->getStatus() != EmployeeStatus::other) {
-            const auto status = employee->getStatus();
-            safeRemoveFromVector(this->by_status, status, employee, __LINE__, "by_status");
-        }
-        if (status) {
-            this->by_other_status[status.value()].push_back(employee);
-        }
-    }
+    this->update(id, changer).setOtherStatus(status).apply();
 }
 
 void InternalEmployeeDataBase::changeAccessRole(
     const BigUint& id, const AccessRole role, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    AccessRole          old_role = employee->getAccessRole();
-
-    if (employee->setAccessRole(role, changer)) {
-        if (old_role != AccessRole::other) {
-            safeRemoveFromVector(
-                this->by_access_role, old_role, employee, __LINE__, "by_access_role"
-            );
-        } else if (employee->getOtherRole()) {
-            const std::string& role = employee->getOtherRole().value();
-            safeRemoveFromVector(
-                this->by_other_access_role, role, employee, __LINE__, "by_other_access_role"
-            );
-        }
-        if (role != AccessRole::other) {
-            this->by_access_role[role].push_back(employee);
-        }
-    }
+    this->update(id, changer).setAccessRole(role).apply();
 }
 
 void InternalEmployeeDataBase::changeOtherAccessRole(
     const BigUint& id, const OptionalStr& role, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    const auto&         old_role = employee->getOtherRole();
-
-    if (employee->setOtherRole(role, changer)) {
-        if (old_role) {
-            safeRemoveFromVector(
-                this->by_other_access_role,
-                old_role.value(),
-                employee,
-                __LINE__,
-                "by_other_access_role"
-            );
-        } else if (employee->getAccessRole() != AccessRole::other) {
-            const auto role = employee->getAccessRole();
-            safeRemoveFromVector(this->by_access_role, role, employee, __LINE__, "by_access_role");
-        }
-        if (role) {
-            this->by_other_access_role[role.value()].push_back(employee);
-        }
-    }
+    this->update(id, changer).setOtherRole(role).apply();
 }
 
 void InternalEmployeeDataBase::changeTimeZone(
     const BigUint& id, const int time_zone, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    const int           old_time_zone = employee->getTimeZone();
-
-    if (employee->setTimeZone(time_zone, changer)) {
-        safeRemoveFromVector(this->by_time_zone, old_time_zone, employee, __LINE__, "by_time_zone");
-        this->by_time_zone[time_zone].push_back(employee);
-    }
+    this->update(id, changer).setTimeZone(time_zone).apply();
 }
 
 void InternalEmployeeDataBase::changePosition(
     const BigUint& id, const OptionalStr& position, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    const auto          old_position = employee->getPosition();
-
-    if (employee->setPosition(position, changer)) {
-        if (old_position) {
-            safeRemoveFromMap(
-                this->by_position, old_position.value(), employee, __LINE__, "by_position"
-            );
-        }
-        if (position) {
-            this->by_position.emplace(position.value(), employee);
-        }
-    }
+    this->update(id, changer).setPosition(position).apply();
 }
 
 void InternalEmployeeDataBase::changeManager(
     const BigUint& id, const WeakInternalEmployee& manager, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    const auto          old_manager = employee->getManager();
-
-    if (employee->setManager(manager, changer)) {
-        if (!old_manager.expired()) {
-            safeRemoveFromVector(
-                this->by_manager, old_manager.lock()->getId(), employee, __LINE__, "by_manager"
-            );
-        }
-        if (!manager.expired()) {
-            this->by_manager[manager.lock()->getId()].push_back(employee);
-        }
-    }
+    this->update(id, changer).setManager(manager).apply();
 }
 
 void InternalEmployeeDataBase::changeIsActive(
     const BigUint& id, const bool is_active, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    const bool          old_active = employee->getIsActive();
-
-    if (employee->setIsActive(is_active, changer)) {
-        safeRemoveFromVector(this->by_is_active, old_active, employee, __LINE__, "by_is_active");
-        this->by_is_active[is_active].push_back(employee);
-    }
+    this->update(id, changer).setIsActive(is_active).apply();
 }
 
 void InternalEmployeeDataBase::changeSalesTerritory(
     const BigUint& id, OptionalStr& sales_territory, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = by_id.find(id);
-    if (id_it == by_id.end()) return;
-
-    InternalEmployeePtr employee = id_it->second;
-
-    const auto          old_sales = employee->getSalesTerritory();
-
-    if (employee->setSalesTerritory(sales_territory, changer)) {
-        if (old_sales) {
-            safeRemoveFromMap(
-                this->by_sales_territory,
-                old_sales.value(),
-                employee,
-                __LINE__,
-                "by_sales_territory"
-            );
-        }
-        if (sales_territory) {
-            this->by_sales_territory.emplace(sales_territory.value(), employee);
-        }
-    }
+    this->update(id, changer).setSalesTerritory(sales_territory).apply();
 }
 
-void InternalEmployeeDataBase::safeRemoveFromMap(
-    auto&                      map,
-    const auto&                key,
-    const InternalEmployeePtr& employee,
-    const size_t               line,
-    const std::string&         index_name
+InternalEmployeeDataBase::Update::Update(
+    InternalEmployeeDataBase& data_base, InternalEmployeePtr employee, InternalEmployeePtr changer
 )
+    : data_base(data_base), employee(std::move(employee)), changer(std::move(changer))
 {
-    auto range = map.equal_range(key);
-    for (auto it = range.first; it != range.second; ++it) {
-        if (it->second == employee) {
-            map.erase(it);
-            return;
-        }
-    }
-    this->logEmptyContainer(__FILE__, line, employee->getId().num, index_name);
 }
 
-void InternalEmployeeDataBase::safeRemoveFromVector(
-    auto&                      map,
-    const auto&                key,
-    const InternalEmployeePtr& employee,
-    const size_t               line,
-    const std::string&         index_name
-)
+auto InternalEmployeeDataBase::Update::setName(const std::string& name) -> Update&
+{
+    this->name = name;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setEmail(const OptionalStr& email) -> Update&
 {
-    auto& vec = map[key];
-    if (vec.empty()) {
-        this->logEmptyContainer(__FILE__, line, employee->getId().num, index_name);
+    this->email = email;
+    return *this;
+}
 
-    } else {
-        vec.erase(std::remove(vec.begin(), vec.end(), employee), vec.end());
-        if (vec.empty()) {
-            map.erase(key);
-        }
-    }
+auto InternalEmployeeDataBase::Update::setPhoneNumber(const PhoneNumberPtr& number) -> Update&
+{
+    this->phone_number = number;
+    return *this;
 }
 
-void InternalEmployeeDataBase::logEmptyContainer(
-    const std::string& file,
-    const size_t       line,
-    const std::string& employee_id,
-    const std::string& index_name
-)
+auto InternalEmployeeDataBase::Update::setDepartment(const OptionalStr& department) -> Update&
 {
-    EventLog::getInstance().log(
-        LOG_LEVEL::ERROR,
-        file,
-        line,
-        "Data inconsistency in " + index_name + "\nInternal Employee: " + employee_id +
-            "\nExpected entry is missing."
-    );
+    this->department = department;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setStatus(const EmployeeStatus status) -> Update&
+{
+    this->status = status;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setOtherStatus(const OptionalStr& other_status) -> Update&
+{
+    this->other_status = other_status;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setAccessRole(const AccessRole role) -> Update&
+{
+    this->access_role = role;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setOtherRole(const OptionalStr& other_role) -> Update&
+{
+    this->other_role = other_role;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setTimeZone(const int time_zone) -> Update&
+{
+    this->time_zone = time_zone;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setPosition(const OptionalStr& position) -> Update&
+{
+    this->position = position;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setManager(const WeakInternalEmployee& manager) -> Update&
+{
+    this->manager = manager;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setIsActive(const bool is_active) -> Update&
+{
+    this->is_active = is_active;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::setSalesTerritory(const OptionalStr& sales_territory)
+    -> Update&
+{
+    this->sales_territory = sales_territory;
+    return *this;
+}
+
+auto InternalEmployeeDataBase::Update::apply() -> size_t
+{
+    if (this->employee == nullptr) return 0;
+
+    Store&                     store    = this->data_base.store;
+    const InternalEmployeePtr& employee = this->employee;
+    const auto&                changer  = this->changer;
+    size_t                     logged   = employee->getChangeLogs().size();
+    CoarseClock::Pin           pin;  // one timestamp for the whole group
+
+    if (this->name) {
+        store.update<ByName, ByNameSubstr>(employee, [&] {
+            return employee->setName(*this->name, changer);
+        });
+    }
+    if (this->email) {
+        store.update<ByEmail, ByEmailSubstr>(employee, [&] {
+            return employee->setEmail(*this->email, changer);
+        });
+    }
+    if (this->phone_number) {
+        store.update<ByPhone, ByPhoneSubstr>(employee, [&] {
+            return employee->setPhoneNumber(*this->phone_number, changer);
+        });
+    }
+    if (this->department) {
+        store.update<ByDepartment>(employee, [&] {
+            return employee->setDepartment(*this->department, changer);
+        });
+    }
+    if (this->status || this->other_status) {
+        store.update<ByStatus, ByOtherStatus>(employee, [&] {
+            bool changed = false;
+            if (this->status) changed |= employee->setStatus(*this->status, changer);
+            if (this->other_status) {
+                changed |= employee->setOtherStatus(*this->other_status, changer);
+            }
+            return changed;
+        });
+    }
+    if (this->access_role || this->other_role) {
+        store.update<ByAccessRole, ByOtherAccessRole>(employee, [&] {
+            bool changed = false;
+            if (this->access_role) changed |= employee->setAccessRole(*this->access_role, changer);
+            if (this->other_role) changed |= employee->setOtherRole(*this->other_role, changer);
+            return changed;
+        });
+    }
+    if (this->time_zone) {
+        store.update<ByTimeZone>(employee, [&] {
+            return employee->setTimeZone(*this->time_zone, changer);
+        });
+    }
+    if (this->position) {
+        store.update<ByPosition>(employee, [&] {
+            return employee->setPosition(*this->position, changer);
+        });
+    }
+    if (this->manager) {
+        store.update<ByManager>(employee, [&] {
+            return employee->setManager(*this->manager, changer);
+        });
+    }
+    if (this->is_active) {
+        store.update<ByIsActive>(employee, [&] {
+            return employee->setIsActive(*this->is_active, changer);
+        });
+    }
+    if (this->sales_territory) {
+        store.update<BySalesTerritory>(employee, [&] {
+            return employee->setSalesTerritory(*this->sales_territory, changer);
+        });
+    }
+
+    return employee->getChangeLogs().size() - logged;
 }
\ No newline at end of file
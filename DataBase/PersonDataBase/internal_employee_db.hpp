@@ -3,12 +3,26 @@
 #include <map>
 #include <unordered_map>
 
+#include "IndexedStore/indexed_store.hpp"
 #include "Person/Employee/internal_employee.hpp"
+#include "PersonDataBase/person_keys.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 using InternalEmployeePtr = std::shared_ptr<InternalEmployee>;
 
 class InternalEmployeeDataBase {
 public:
+    class Update;
+
+    using Symbol = StringPool::Symbol;
+
+    /// Department, status, role, position and territory keys are interned in `string_pool`,
+    /// which is shared by all data bases of one tenant. The pool of the current tenant by
+    /// default, whose symbols the employees already keep.
+    explicit InternalEmployeeDataBase(
+        std::shared_ptr<StringPool> string_pool = StringPool::current()
+    );
+
     void add(const InternalEmployeePtr& person);
     void soft_remove(const BigUint& id, const Date& remove_date);
     void hard_remove(const size_t index, TenantContext& context);
@@ -17,27 +31,30 @@ public:
     /// @{
     auto size() const -> size_t;
     bool empty() const;
-    auto getAll() const -> const std::unordered_map<BigUint, InternalEmployeePtr>&;
-    auto getByName() const -> const std::unordered_multimap<std::string, InternalEmployeePtr>&;
-    auto getByEmail() const -> const std::unordered_multimap<std::string, InternalEmployeePtr>&;
-    auto getByPhone() const -> const std::unordered_multimap<std::string, InternalEmployeePtr>&;
+    auto getStringPool() const -> const StringPool&;
+    auto getAll() const -> const FlatHashMap<BigUint, InternalEmployeePtr>&;
+    auto getByName() const
+        -> const std::unordered_map<std::string, std::vector<InternalEmployeePtr>>&;
+    auto getByEmail() const -> const FlatHashMap<std::string, std::vector<InternalEmployeePtr>>&;
+    auto getByPhone() const
+        -> const FlatHashMap<PhoneNumber::Key, std::vector<InternalEmployeePtr>>&;
     auto getByDepartment() const
-        -> const std::unordered_multimap<std::string, InternalEmployeePtr>&;
-    auto getByStatus() const
-        -> const std::unordered_map<EmployeeStatus, std::vector<InternalEmployeePtr>>&;
+        -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&;
+    auto getByStatus() const -> const std::unordered_map<EmployeeStatus, RoaringBitmap>&;
     auto getByOtherStatus() const
-        -> const std::unordered_map<std::string, std::vector<InternalEmployeePtr>>&;
-    auto getByAccessRole() const
-        -> const std::unordered_map<AccessRole, std::vector<InternalEmployeePtr>>&;
+        -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&;
+    auto getByAccessRole() const -> const std::unordered_map<AccessRole, RoaringBitmap>&;
     auto getByOtherAccessRole() const
-        -> const std::unordered_map<std::string, std::vector<InternalEmployeePtr>>&;
-    auto getByTimeZone() const -> const std::unordered_map<int, std::vector<InternalEmployeePtr>>&;
+        -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&;
+    auto getByTimeZone() const -> const std::unordered_map<int, RoaringBitmap>&;
     auto getByManager() const
         -> const std::unordered_map<BigUint, std::vector<InternalEmployeePtr>>&;
-    auto getByPosition() const -> const std::unordered_multimap<std::string, InternalEmployeePtr>&;
-    auto getByIsActive() const -> const std::unordered_map<bool, std::vector<InternalEmployeePtr>>&;
+    auto getByPosition() const
+        -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&;
+    auto getByIsActive() const -> const std::unordered_map<bool, RoaringBitmap>&;
     auto getSalesTerritory() const
-        -> const std::unordered_multimap<std::string, InternalEmployeePtr>&;
+        -> const std::unordered_map<Symbol, std::vector<InternalEmployeePtr>>&;
+    auto getRows() const -> const RoaringBitmap&;
     auto getRemoved() const -> const std::vector<std::pair<Date, InternalEmployeePtr>>&;
     /// @}
 
@@ -51,28 +68,34 @@ public:
     auto findByEmailSubstr(const std::string& substr) const
         -> const std::vector<InternalEmployeePtr>;
     auto findByPhone(const std::string& phone) const -> const std::vector<InternalEmployeePtr>;
+    auto findByPhone(const PhoneNumber& phone) const -> const std::vector<InternalEmployeePtr>;
     auto findByPhoneSubstr(const std::string& substr) const
         -> const std::vector<InternalEmployeePtr>;
     auto findByDepartment(const std::string& department) const
         -> const std::vector<InternalEmployeePtr>;
-    auto findByStatus(const EmployeeStatus status) const -> const std::vector<InternalEmployeePtr>&;
+    auto findByStatus(const EmployeeStatus status) const -> const std::vector<InternalEmployeePtr>;
     auto findByOtherStatus(const std::string& status) const
         -> const std::vector<InternalEmployeePtr>&;
-    auto findByAccessRole(const AccessRole role) const -> const std::vector<InternalEmployeePtr>&;
+    auto findByAccessRole(const AccessRole role) const -> const std::vector<InternalEmployeePtr>;
     auto findByOtherAccessRole(const std::string& role) const
         -> const std::vector<InternalEmployeePtr>&;
-    auto findByTimeZone(const int time_zone) const -> const std::vector<InternalEmployeePtr>&;
+    auto findByTimeZone(const int time_zone) const -> const std::vector<InternalEmployeePtr>;
     auto findByManager(const BigUint& id) const -> const std::vector<InternalEmployeePtr>&;
     auto findByPosition(const std::string& position) const
         -> const std::vector<InternalEmployeePtr>;
-    auto findByIsActive(const bool is_active) const -> const std::vector<InternalEmployeePtr>&;
+    auto findByIsActive(const bool is_active) const -> const std::vector<InternalEmployeePtr>;
     auto findBySalesTerritory(const std::string& sales) const
         -> const std::vector<InternalEmployeePtr>;
+    /// Employees in `rows`, a combination of the status, role, time zone and activity bitmaps
+    auto findByRows(const RoaringBitmap& rows) const -> const std::vector<InternalEmployeePtr>;
 
     /// @}
 
     /// @name Change functions
     /// @{
+    /// Collects changes to the employee with `id`, see `Update`. The one-field changes below
+    /// go through it as well.
+    auto update(const BigUint& id, const InternalEmployeePtr& changer) -> Update;
     void changeName(const BigUint& id, const std::string& name, const InternalEmployeePtr& changer);
     void changeEmail(
         const BigUint& id, const OptionalStr& email, const InternalEmployeePtr& changer
@@ -121,47 +144,135 @@ public:
     /// @}
 
 private:
-    static const std::vector<InternalEmployeePtr>             empty_vector;
-    std::unordered_map<BigUint, InternalEmployeePtr>          by_id;
-    std::unordered_multimap<std::string, InternalEmployeePtr> by_name;
-    std::multimap<std::string, InternalEmployeePtr>           by_name_substr_search;
-    std::unordered_multimap<std::string, InternalEmployeePtr> by_email;
-    std::multimap<std::string, InternalEmployeePtr>           by_email_substr_search;
-    std::unordered_multimap<std::string, InternalEmployeePtr> by_phone;
-    std::multimap<std::string, InternalEmployeePtr>           by_phone_substr_search;
-    //
-    std::unordered_multimap<std::string, InternalEmployeePtr>            by_department;
-    std::unordered_map<EmployeeStatus, std::vector<InternalEmployeePtr>> by_status;
-    std::unordered_map<std::string, std::vector<InternalEmployeePtr>>    by_other_status;
-    std::unordered_map<AccessRole, std::vector<InternalEmployeePtr>>     by_access_role;
-    std::unordered_map<std::string, std::vector<InternalEmployeePtr>>    by_other_access_role;
-    std::unordered_map<int, std::vector<InternalEmployeePtr>>            by_time_zone;
-
-    std::unordered_map<BigUint, std::vector<InternalEmployeePtr>>        by_manager;
-    std::unordered_multimap<std::string, InternalEmployeePtr>            by_position;
-    std::unordered_map<bool, std::vector<InternalEmployeePtr>>           by_is_active;
-    std::unordered_multimap<std::string, InternalEmployeePtr>            by_sales_territory;
-    std::vector<std::pair<Date, InternalEmployeePtr>>                    removed;
-    //
-    void safeRemoveFromMap(
-        auto&                      map,
-        const auto&                key,
-        const InternalEmployeePtr& employee,
-        const size_t               line,
-        const std::string&         index_name
-    );
-    void safeRemoveFromVector(
-        auto&                      map,
-        const auto&                key,
-        const InternalEmployeePtr& employee,
-        const size_t               line,
-        const std::string&         index_name
-    );
+    using Employee = InternalEmployee;
+    using ById     = indexes::Unique<Employee, indexes::Get<&Employee::getId>, "by_id">;
+    using ByName   = indexes::Bucket<Employee, indexes::Get<&Employee::getName>, "by_name">;
+    using ByNameSubstr = indexes::Substring<
+        Employee,
+        indexes::Lower<indexes::Get<&Employee::getName>>,
+        "by_name_substr_search">;
+    using ByEmail = indexes::Bucket<Employee, person_keys::Emails, "by_email", FlatHashMap>;
+    using ByEmailSubstr = indexes::Substring<
+        Employee,
+        indexes::Lower<person_keys::Emails>,
+        "by_email_substr_search">;
+    using ByPhone = indexes::Bucket<Employee, person_keys::PhoneKeys, "by_phone", FlatHashMap>;
+    using ByPhoneSubstr =
+        indexes::Substring<Employee, person_keys::PhoneNumbers, "by_phone_substr_search">;
+    using ByDepartment = indexes::Bucket<
+        Employee,
+        indexes::Interned<indexes::Get<&Employee::getDepartment>>,
+        "by_department">;
+    using ByStatus = indexes::Bitmap<
+        Employee,
+        indexes::Except<&Employee::getStatus, EmployeeStatus::other>,
+        "by_status">;
+    using ByOtherStatus = indexes::Bucket<
+        Employee,
+        indexes::Interned<
+            indexes::Other<&Employee::getStatus, EmployeeStatus::other, &Employee::getOtherStatus>>,
+        "by_other_status">;
+    using ByAccessRole = indexes::Bitmap<
+        Employee,
+        indexes::Except<&Employee::getAccessRole, AccessRole::other>,
+        "by_access_role">;
+    using ByOtherAccessRole = indexes::Bucket<
+        Employee,
+        indexes::Interned<
+            indexes::Other<&Employee::getAccessRole, AccessRole::other, &Employee::getOtherRole>>,
+        "by_other_access_role">;
+    using ByTimeZone =
+        indexes::Bitmap<Employee, indexes::Get<&Employee::getTimeZone>, "by_time_zone">;
+    using ByManager =
+        indexes::Bucket<Employee, indexes::IdOf<&Employee::getManager>, "by_manager">;
+    using ByPosition = indexes::Bucket<
+        Employee,
+        indexes::Interned<indexes::Get<&Employee::getPosition>>,
+        "by_position">;
+    using ByIsActive =
+        indexes::Bitmap<Employee, indexes::Get<&Employee::getIsActive>, "by_is_active">;
+    using BySalesTerritory = indexes::Bucket<
+        Employee,
+        indexes::Interned<indexes::Get<&Employee::getSalesTerritory>>,
+        "by_sales_territory">;
+    using Store = IndexedStore<
+        Employee,
+        ById,
+        ByName,
+        ByNameSubstr,
+        ByEmail,
+        ByEmailSubstr,
+        ByPhone,
+        ByPhoneSubstr,
+        ByDepartment,
+        ByStatus,
+        ByOtherStatus,
+        ByAccessRole,
+        ByOtherAccessRole,
+        ByTimeZone,
+        ByManager,
+        ByPosition,
+        ByIsActive,
+        BySalesTerritory>;
 
-    void logEmptyContainer(
-        const std::string& file,
-        const size_t       line,
-        const std::string& employee_id,
-        const std::string& index_name
+    static const std::vector<InternalEmployeePtr>     empty_vector;
+    std::shared_ptr<StringPool>                       string_pool;
+    Store                                             store;
+    std::vector<std::pair<Date, InternalEmployeePtr>> removed;
+};
+
+/**
+ * @class InternalEmployeeDataBase::Update
+ * @brief Changes to several fields of one internal employee, applied together.
+ *
+ * `apply` makes the changes under one timestamp, so they form one group of change log entries,
+ * and moves the employee in each affected index once. The status and the other status go
+ * through one index update, as do the role and the other role, since together they decide
+ * which bitmap or bucket holds the employee.
+ */
+class InternalEmployeeDataBase::Update {
+public:
+    auto setName(const std::string& name) -> Update&;
+    auto setEmail(const OptionalStr& email) -> Update&;
+    auto setPhoneNumber(const PhoneNumberPtr& number) -> Update&;
+    auto setDepartment(const OptionalStr& department) -> Update&;
+    auto setStatus(const EmployeeStatus status) -> Update&;
+    auto setOtherStatus(const OptionalStr& other_status) -> Update&;
+    auto setAccessRole(const AccessRole role) -> Update&;
+    auto setOtherRole(const OptionalStr& other_role) -> Update&;
+    auto setTimeZone(const int time_zone) -> Update&;
+    auto setPosition(const OptionalStr& position) -> Update&;
+    auto setManager(const WeakInternalEmployee& manager) -> Update&;
+    auto setIsActive(const bool is_active) -> Update&;
+    auto setSalesTerritory(const OptionalStr& sales_territory) -> Update&;
+
+    /// Returns how many fields changed. Does nothing if the employee is not in the data base.
+    auto apply() -> size_t;
+
+private:
+    friend class InternalEmployeeDataBase;
+
+    Update(
+        InternalEmployeeDataBase& data_base,
+        InternalEmployeePtr       employee,
+        InternalEmployeePtr       changer
     );
+
+    InternalEmployeeDataBase& data_base;
+    InternalEmployeePtr       employee;  // nullptr if there is no such employee
+    InternalEmployeePtr       changer;
+
+    std::optional<std::string>          name;
+    std::optional<OptionalStr>          email;
+    std::optional<PhoneNumberPtr>       phone_number;
+    std::optional<OptionalStr>          department;
+    std::optional<EmployeeStatus>       status;
+    std::optional<OptionalStr>          other_status;
+    std::optional<AccessRole>           access_role;
+    std::optional<OptionalStr>          other_role;
+    std::optional<int>                  time_zone;
+    std::optional<OptionalStr>          position;
+    std::optional<WeakInternalEmployee> manager;
+    std::optional<bool>                 is_active;
+    std::optional<OptionalStr>          sales_territory;
 };
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+#include <string>
+#include <vector>
+
+#include "Person/person.hpp"
+#include "PhoneNumber/phone_number.hpp"
+
+/**
+ * @brief Key functions of the contact indexes shared by the person data bases.
+ *
+ * A person is found by the primary email or phone number and by every additional one, so each
+ * returns all of them, primary first.
+ */
+namespace person_keys {
+    struct Emails {
+        auto operator()(const Person& person) const -> std::vector<std::string>
+        {
+            std::vector<std::string> emails;
+            emails.reserve(person.getMoreEmails().size() + 1);
+            if (person.getEmail()) emails.push_back(*person.getEmail());
+            for (const std::string& email : person.getMoreEmails()) emails.push_back(email);
+            return emails;
+        }
+    };
+
+    struct PhoneKeys {
+        auto operator()(const Person& person) const -> std::vector<PhoneNumber::Key>
+        {
+            std::vector<PhoneNumber::Key> keys;
+            keys.reserve(person.getMorePhoneNumbers().size() + 1);
+            if (person.getPhoneNumber()) keys.push_back(person.getPhoneNumber()->getKey());
+            for (const PhoneNumber& number : person.getMorePhoneNumbers()) {
+                keys.push_back(number.getKey());
+            }
+            return keys;
+        }
+    };
+
+    /// Digits of the numbers, for search by fragment
+    struct PhoneNumbers {
+        auto operator()(const Person& person) const -> std::vector<std::string>
+        {
+            std::vector<std::string> numbers;
+            numbers.reserve(person.getMorePhoneNumbers().size() + 1);
+            if (person.getPhoneNumber()) numbers.push_back(person.getPhoneNumber()->getNumber());
+            for (const PhoneNumber& number : person.getMorePhoneNumbers()) {
+                numbers.push_back(number.getNumber());
+            }
+            return numbers;
+        }
+    };
+}  // namespace person_keys
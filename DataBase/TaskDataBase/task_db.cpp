@@ -1,8 +1,8 @@
 #include "task_db.hpp"
 
-#include <algorithm>
-
-#include "Logger/events_log.hpp"
+#include "ChangeLog/change_journal.hpp"
+#include "ChangeLog/change_stream.hpp"
+#include "DateTime/coarse_clock.hpp"
 #include "Person/Employee/internal_employee.hpp"
 
 const std::vector<TaskPtr> TaskDataBase::empty_vector;
@@ -12,168 +12,92 @@ void TaskDataBase::add(const TaskPtr& task)
 {
     if (task == nullptr) return;
 
-    if (this->by_id.find(task->getId()) != by_id.end()) return;
-
-    this->by_id[task->getId()] = task;
-
-    std::string title = task->getTitle();
-    if (!title.empty()) {
-        std::transform(title.begin(), title.end(), title.begin(), ::tolower);
-        this->by_title_substr_search.emplace(title, task);
-    }
-
-    this->by_status[task->getStatus()].push_back(task);
-    this->by_priority[task->getPriority()].push_back(task);
-
-    this->by_created_date.emplace(task->getCreatedDate(), task);
-    if (task->getDeadline()) {
-        this->by_deadline.emplace(*task->getDeadline(), task);
-    }
-    if (task->getStartDate()) {
-        this->by_start_date.emplace(*task->getStartDate(), task);
-    }
+    if (!this->store.insert(task)) return;
+    ChangeJournal::getInstance().setInitialState(task->change_logs, task->getInitialState());
 
-    if (!task->getCreatedBy().expired()) {
-        this->by_creator[task->getCreatedBy().lock()->getId()].push_back(task);
-    }
-
-    if (!task->getManager().expired()) {
-        this->by_manager[task->getManager().lock()->getId()].push_back(task);
-    }
-
-    for (auto& weak_deal : task->getDeals()) {
-        if (!weak_deal.expired()) {
-            this->by_deal.emplace(weak_deal.lock()->getId(), task);
-        }
-    }
-
-    for (auto& week_teem : task->getTeem()) {
-        if (!week_teem.expired()) {
-            this->by_party[week_teem.lock()->getId()].push_back(task);
-        }
-    }
+    ChangeStream::getInstance().publish(
+        ChangeEvent::entity(ChangeEvent::Type::Add, EntityType::Task, task->getId())
+    );
 }
 
 void TaskDataBase::safe_remove(const BigUint& id, const Date& remove_date)
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == by_id.end()) {
-        return;
-    }
-
-    TaskPtr     task = id_it->second;
-
-    std::string title = task->getTitle();
-    if (!title.empty()) {
-        std::transform(title.begin(), title.end(), title.begin(), ::tolower);
-        safeRemoveFromMap(
-            this->by_title_substr_search, title, task, __LINE__, "by_title_substr_search"
-        );
-    }
-    safeRemoveFromVector(this->by_status, task->getStatus(), task, __LINE__, "by_status");
-    safeRemoveFromVector(this->by_priority, task->getPriority(), task, __LINE__, "by_priority");
-    safeRemoveFromMap(
-        this->by_created_date, task->getCreatedDate(), task, __LINE__, "by_created_date"
-    );
-    if (task->getDeadline()) {
-        safeRemoveFromMap(this->by_deadline, *task->getDeadline(), task, __LINE__, "by_deadline");
-    }
-    if (task->getStartDate()) {
-        safeRemoveFromMap(
-            this->by_start_date, *task->getStartDate(), task, __LINE__, "by_start_date"
-        );
-    }
-    if (!task->getCreatedBy().expired()) {
-        auto creator_id = task->getCreatedBy().lock()->getId();
-        safeRemoveFromVector(this->by_creator, creator_id, task, __LINE__, "by_creator");
-    }
-    if (!task->getManager().expired()) {
-        auto manager_id = task->getManager().lock()->getId();
-        safeRemoveFromVector(this->by_manager, manager_id, task, __LINE__, "by_manager");
-    }
-    if (!task->getDeals().empty()) {
-        for (auto& weak_deal : task->getDeals()) {
-            if (!weak_deal.expired()) {
-                auto deal = weak_deal.lock();
-                safeRemoveFromMap(this->by_deal, deal->getId(), task, __LINE__, "by_deal");
-            }
-        }
-    }
-    if (!task->getTeem().empty()) {
-        for (auto& weak_teem : task->getTeem()) {
-            if (!weak_teem.expired()) {
-                auto teem = weak_teem.lock();
-                safeRemoveFromVector(this->by_party, teem->getId(), task, __LINE__, "by_teem");
-            }
-        }
-    }
+    TaskPtr task = this->store.find(id);
+    if (task == nullptr) return;
 
+    this->store.erase(task);
     this->removed.push_back({Date(), task});
-    this->by_id.erase(task->getId());
+
+    ChangeStream::getInstance().publish(ChangeEvent::entity(
+        ChangeEvent::Type::SoftRemove, EntityType::Task, task->getId(), remove_date
+    ));
 }
 
 void TaskDataBase::hard_remove(const size_t index)
 {
     if (index < this->removed.size()) {
+        BigUint id = this->removed[index].second->getId();
+        ChangeJournal::getInstance().drop(this->removed[index].second->change_logs);
         this->removed.erase(this->removed.begin() + index);
+        ChangeStream::getInstance().publish(
+            ChangeEvent::entity(ChangeEvent::Type::HardRemove, EntityType::Task, id)
+        );
     }
 }
 
-auto TaskDataBase::getAll() const -> const std::unordered_map<BigUint, TaskPtr>&
-{
-    return this->by_id;
-}
-
-auto TaskDataBase::getByTitle() const -> const std::multimap<std::string, TaskPtr>&
+auto TaskDataBase::getAll() const -> const FlatHashMap<BigUint, TaskPtr>&
 {
-    return this->by_title_substr_search;
+    return this->store.get<ById>().entries();
 }
 
-auto TaskDataBase::getByStatus() const
-    -> const std::unordered_map<Task::Status, std::vector<TaskPtr>>&
+auto TaskDataBase::getByStatus() const -> const std::unordered_map<Task::Status, RoaringBitmap>&
 {
-    return this->by_status;
+    return this->store.get<ByStatus>().entries();
 }
 
-auto TaskDataBase::getByPriority() const
-    -> const std::unordered_map<Priority, std::vector<TaskPtr>>&
+auto TaskDataBase::getByPriority() const -> const std::unordered_map<Priority, RoaringBitmap>&
 {
-    return this->by_priority;
+    return this->store.get<ByPriority>().entries();
 }
 
 auto TaskDataBase::getByCreatedDate() const -> const std::multimap<Date, TaskPtr>&
 {
-    return this->by_created_date;
+    return this->store.get<ByCreatedDate>().entries();
 }
 
 auto TaskDataBase::getByDeadline() const -> const std::multimap<Date, TaskPtr>&
 {
-    return this->by_deadline;
+    return this->store.get<ByDeadline>().entries();
 }
 
 auto TaskDataBase::getByStartDate() const -> const std::multimap<Date, TaskPtr>&
 {
-    return this->by_start_date;
+    return this->store.get<ByStartDate>().entries();
 }
 
 auto TaskDataBase::getByCreator() const -> const std::unordered_map<BigUint, std::vector<TaskPtr>>&
 {
-    return this->by_creator;
+    return this->store.get<ByCreator>().entries();
 }
 
 auto TaskDataBase::getByManager() const -> const std::unordered_map<BigUint, std::vector<TaskPtr>>&
 {
-    return this->by_manager;
+    return this->store.get<ByManager>().entries();
 }
 
-auto TaskDataBase::getByDeal() const -> const std::unordered_multimap<BigUint, TaskPtr>&
+auto TaskDataBase::getByDeal() const -> const std::unordered_map<BigUint, std::vector<TaskPtr>>&
 {
-    return this->by_deal;
+    return this->store.get<ByDeal>().entries();
 }
 
 auto TaskDataBase::getByParty() const -> const std::unordered_map<BigUint, std::vector<TaskPtr>>&
 {
-    return this->by_party;
+    return this->store.get<ByParty>().entries();
+}
+
+auto TaskDataBase::getRows() const -> const RoaringBitmap&
+{
+    return this->store.rows();
 }
 
 auto TaskDataBase::getRemoved() const -> const std::vector<std::pair<Date, TaskPtr>>&
@@ -181,366 +105,236 @@ auto TaskDataBase::getRemoved() const -> const std::vector<std::pair<Date, TaskP
     return this->removed;
 }
 
-auto TaskDataBase::size() const -> size_t { return this->by_id.size(); }
+auto TaskDataBase::size() const -> size_t { return this->store.size(); }
 
-bool TaskDataBase::empty() { return this->by_id.empty(); }
+bool TaskDataBase::empty() { return this->store.empty(); }
 
 auto TaskDataBase::findById(const BigUint& id) const -> const TaskPtr
 {
-    auto task = this->by_id.find(id);
-    if (task != this->by_id.end()) {
-        return task->second;
-    }
-    return nullptr;
+    return this->store.find(id);
 }
 
 auto TaskDataBase::findByTitleSubstr(const std::string& title) const -> const std::vector<TaskPtr>
 {
     if (title.empty()) return empty_vector;
 
-    std::string key = title;
-    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
-
-    auto first = this->by_title_substr_search.lower_bound(key);
-    key.back()++;
-    auto second = this->by_title_substr_search.lower_bound(key);
-
-    if (first == second) return empty_vector;
+    return this->store.get<ByTitle>().find(indexes::lowerCase(title));
+}
 
-    std::vector<TaskPtr> result;
-    for (auto it = first; it != second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+auto TaskDataBase::findByStatus(const Task::Status status) const -> const std::vector<TaskPtr>
+{
+    return this->store.entitiesOf(this->store.get<ByStatus>().find(status));
 }
 
-auto TaskDataBase::findByStatus(const Task::Status status) const -> const std::vector<TaskPtr>&
+auto TaskDataBase::findByPriority(const Priority priority) const -> const std::vector<TaskPtr>
 {
-    auto task = this->by_status.find(status);
-    if (task != this->by_status.end()) {
-        return task->second;
-    }
-    return empty_vector;
+    return this->store.entitiesOf(this->store.get<ByPriority>().find(priority));
 }
 
-auto TaskDataBase::findByPriority(const Priority priority) const -> const std::vector<TaskPtr>&
+auto TaskDataBase::findByRows(const RoaringBitmap& rows) const -> const std::vector<TaskPtr>
 {
-    auto task = this->by_priority.find(priority);
-    if (task != this->by_priority.end()) {
-        return task->second;
-    }
-    return empty_vector;
+    return this->store.entitiesOf(rows);
 }
 
 auto TaskDataBase::findByCreatedDate(const Date& date) const -> const std::vector<TaskPtr>
 {
-    auto task_range = this->by_created_date.equal_range(date);
-    if (task_range.first == task_range.second) return empty_vector;
-
-    std::vector<TaskPtr> result;
-    for (auto it = task_range.first; it != task_range.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByCreatedDate>().find(date);
 }
 
 auto TaskDataBase::findByDeadline(const Date& date) const -> const std::vector<TaskPtr>
 {
-    auto task_range = this->by_deadline.equal_range(date);
-    if (task_range.first == task_range.second) return empty_vector;
-
-    std::vector<TaskPtr> result;
-    for (auto it = task_range.first; it != task_range.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByDeadline>().find(date);
 }
 
 auto TaskDataBase::findByStartDate(const Date& date) const -> const std::vector<TaskPtr>
 {
-    auto task_range = this->by_start_date.equal_range(date);
-    if (task_range.first == task_range.second) return empty_vector;
-
-    std::vector<TaskPtr> result;
-    for (auto it = task_range.first; it != task_range.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByStartDate>().find(date);
 }
 
 auto TaskDataBase::findByCreator(const BigUint& id) const -> const std::vector<TaskPtr>&
 {
-    auto task = this->by_creator.find(id);
-    if (task != this->by_creator.end()) {
-        return task->second;
-    }
-    return empty_vector;
+    return this->store.get<ByCreator>().find(id);
 }
 
 auto TaskDataBase::findByManager(const BigUint& id) const -> const std::vector<TaskPtr>&
 {
-    auto task = this->by_manager.find(id);
-    if (task != this->by_manager.end()) {
-        return task->second;
-    }
-    return empty_vector;
+    return this->store.get<ByManager>().find(id);
 }
 
 auto TaskDataBase::findByDeal(const BigUint& id) const -> const std::vector<TaskPtr>
 {
-    auto task_range = this->by_deal.equal_range(id);
-    if (task_range.first == task_range.second) return empty_vector;
-
-    std::vector<TaskPtr> result;
-    for (auto it = task_range.first; it != task_range.second; ++it) {
-        result.push_back(it->second);
-    }
-    return result;
+    return this->store.get<ByDeal>().find(id);
 }
 
 auto TaskDataBase::findByParty(const BigUint& id) const -> const std::vector<TaskPtr>&
 {
-    auto task = this->by_party.find(id);
-    if (task != this->by_party.end()) {
-        return task->second;
-    }
-    return empty_vector;
+    return this->store.get<ByParty>().find(id);
+}
+
+auto TaskDataBase::update(const BigUint& id, const InternalEmployeePtr& changer) -> Update
+{
+    return Update(*this, this->store.find(id), changer);
 }
 
 void TaskDataBase::changeTitle(
     const BigUint& id, const std::string& title, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    TaskPtr task = id_it->second;
-    if (task->getTitle().empty()) return;
-
-    std::string old_title = task->getTitle();
-    if (task->setTitle(title, changer)) {
-        std::transform(old_title.begin(), old_title.end(), old_title.begin(), ::tolower);
-
-        safeRemoveFromMap(
-            this->by_title_substr_search, old_title, task, __LINE__, "by_title_substr_search"
-        );
-
-        std::string new_title = title;
-        std::transform(new_title.begin(), new_title.end(), new_title.begin(), ::tolower);
-        this->by_title_substr_search.emplace(new_title, task);
-    }
+    this->update(id, changer).setTitle(title).apply();
 }
 
 void TaskDataBase::changeStatus(
     const BigUint& id, const Task::Status status, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    TaskPtr task = id_it->second;
-
-    auto    old_status = task->getStatus();
-    if (task->setStatus(status, changer)) {
-        safeRemoveFromVector(this->by_status, old_status, task, __LINE__, "by_status");
-        this->by_status[status].push_back(task);
-    }
+    this->update(id, changer).setStatus(status).apply();
 }
 
 void TaskDataBase::changePriority(
     const BigUint& id, const Priority priority, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    TaskPtr task = id_it->second;
-
-    auto    old_priority = task->getPriority();
-    if (task->setPriority(priority, changer)) {
-        safeRemoveFromVector(this->by_priority, old_priority, task, __LINE__, "by_priority");
-        this->by_priority[priority].push_back(task);
-    }
+    this->update(id, changer).setPriority(priority).apply();
 }
 
 void TaskDataBase::changeDeadline(
-    const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer
+    const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    TaskPtr        task = id_it->second;
-
-    const DatePtr& old_date = task->getDeadline();
-    if (task->setDeadline(date, changer)) {
-        if (old_date) {
-            safeRemoveFromMap(this->by_deadline, *old_date, task, __LINE__, "by_deadline");
-        }
-        if (date) {
-            this->by_deadline.emplace(*date, task);
-        }
-    }
+    this->update(id, changer).setDeadline(date).apply();
 }
 
 void TaskDataBase::changeStartDate(
-    const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer
+    const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    TaskPtr        task = id_it->second;
-
-    const DatePtr& old_date = task->getStartDate();
-    if (task->setStartDate(date, changer)) {
-        if (old_date) {
-            safeRemoveFromMap(this->by_start_date, *old_date, task, __LINE__, "by_deadline");
-        }
-        if (date) {
-            this->by_start_date.emplace(*date, task);
-        }
-    }
+    this->update(id, changer).setStartDate(date).apply();
 }
 
 void TaskDataBase::changeManager(
     const BigUint& id, const WeakInternalEmployee& manager, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    TaskPtr     task = id_it->second;
-
-    const auto& old_manager = task->getManager();
-    if (task->setManager(manager, changer)) {
-        if (!old_manager.expired()) {
-            const BigUint& old_id = old_manager.lock()->getId();
-            safeRemoveFromVector(this->by_manager, old_id, task, __LINE__, "by_manager");
-        }
-        if (!manager.expired()) {
-            const BigUint& new_id = manager.lock()->getId();
-            this->by_manager[new_id].push_back(task);
-        }
-    }
+    this->update(id, changer).setManager(manager).apply();
 }
 
 void TaskDataBase::addDeal(
     const BigUint& id, const WeakDealPtr& deal, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
+    TaskPtr task = this->store.find(id);
+    if (task == nullptr) return;
 
-    TaskPtr task = id_it->second;
-    if (task->addDeal(deal, changer)) {
-        this->by_deal.emplace(deal.lock()->getId(), task);
-    }
+    this->store.update<ByDeal>(task, [&] { return task->addDeal(deal, changer); });
 }
 
 void TaskDataBase::delDeal(
     const BigUint& id, const size_t index, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
-
-    TaskPtr task = id_it->second;
-    if (task->getDeals().size() <= index) return;
-
-    auto old_deal = task->getDeals()[index];
+    TaskPtr task = this->store.find(id);
+    if (task == nullptr) return;
 
-    if (task->delDeal(index, changer)) {
-        safeRemoveFromMap(this->by_deal, old_deal.lock()->getId(), task, __LINE__, "by_deal");
-    }
+    this->store.update<ByDeal>(task, [&] { return task->delDeal(index, changer); });
 }
 
 void TaskDataBase::addParty(
     const BigUint& id, const WeakPersonPtr& person, const InternalEmployeePtr& changer
 )
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
+    TaskPtr task = this->store.find(id);
+    if (task == nullptr) return;
 
-    TaskPtr task = id_it->second;
-    if (task->addTeemMember(person, changer)) {
-        this->by_party[person.lock()->getId()].push_back(task);
-    }
+    this->store.update<ByParty>(task, [&] { return task->addTeemMember(person, changer); });
 }
 
 void TaskDataBase::delParty(const BigUint& id, size_t index, const InternalEmployeePtr& changer)
 {
-    auto id_it = this->by_id.find(id);
-    if (id_it == this->by_id.end()) return;
+    TaskPtr task = this->store.find(id);
+    if (task == nullptr) return;
 
-    TaskPtr task = id_it->second;
-    if (task->getTeem().size() <= index) return;
+    this->store.update<ByParty>(task, [&] { return task->delTeemMember(index, changer); });
+}
 
-    auto old_party = task->getTeem()[index];
+void TaskDataBase::removeCreator(const BigUint& id) { this->store.get<ByCreator>().eraseKey(id); }
 
-    if (task->delTeemMember(index, changer)) {
-        safeRemoveFromVector(this->by_party, old_party.lock()->getId(), task, __LINE__, "by_party");
-    }
-}
+void TaskDataBase::removeManager(const BigUint& id) { this->store.get<ByManager>().eraseKey(id); }
 
-void TaskDataBase::removeCreator(const BigUint& id) { this->by_creator.erase(id); }
+void TaskDataBase::removeParty(const BigUint& id) { this->store.get<ByParty>().eraseKey(id); }
 
-void TaskDataBase::removeManager(const BigUint& id) { this->by_manager.erase(id); }
+void TaskDataBase::removeDeal(const BigUint& id) { this->store.get<ByDeal>().eraseKey(id); }
 
-void TaskDataBase::removeParty(const BigUint& id) { this->by_party.erase(id); }
+TaskDataBase::Update::Update(TaskDataBase& data_base, TaskPtr task, InternalEmployeePtr changer)
+    : data_base(data_base), task(std::move(task)), changer(std::move(changer))
+{
+}
 
-void TaskDataBase::removeDeal(const BigUint& id) { this->by_deal.erase(id); }
+auto TaskDataBase::Update::setTitle(const std::string& title) -> Update&
+{
+    this->title = title;
+    return *this;
+}
 
-void TaskDataBase::safeRemoveFromMap(
-    auto&              map,
-    const auto&        key,
-    const TaskPtr&     task,
-    const size_t       line,
-    const std::string& index_name
-)
+auto TaskDataBase::Update::setStatus(const Task::Status status) -> Update&
 {
-    auto range = map.equal_range(key);
-    for (auto it = range.first; it != range.second; ++it) {
-        if (it->second == task) {
-            map.erase(it);
-            return;
-        }
-    }
-    this->logEmptyContainer(__FILE__, line, task->getId().num, index_name);
+    this->status = status;
+    return *this;
 }
 
-void TaskDataBase::safeRemoveFromVector(
-    auto&              map,
-    const auto&        key,
-    const TaskPtr&     task,
-    const size_t       line,
-    const std::string& index_name
-)
+auto TaskDataBase::Update::setPriority(const Priority priority) -> Update&
 {
-    auto& vec = map[key];
-    if (vec.empty()) {
-        this->logEmptyContainer(__FILE__, line, task->getId().num, index_name);
+    this->priority = priority;
+    return *this;
+}
 
-    } else {
-        vec.erase(std::remove(vec.begin(), vec.end(), task), vec.end());
-        if (vec.empty()) {
-            map.erase(key);
-        }
-    }
+auto TaskDataBase::Update::setDeadline(const OptionalDate& date) -> Update&
+{
+    this->deadline = date;
+    return *this;
 }
 
-void TaskDataBase::logEmptyContainer(
-    const std::string& file,
-    const size_t       line,
-    const std::string& task_id,
-    const std::string& index_name
-)
+auto TaskDataBase::Update::setStartDate(const OptionalDate& date) -> Update&
 {
-    EventLog::getInstance().log(
-        LOG_LEVEL::ERROR,
-        file,
-        line,
-        "Data inconsistency in " + index_name + "\nTask: " + task_id +
-            "\nExpected entry is missing."
-    );
+    this->start_date = date;
+    return *this;
+}
+
+auto TaskDataBase::Update::setManager(const WeakInternalEmployee& manager) -> Update&
+{
+    this->manager = manager;
+    return *this;
+}
+
+auto TaskDataBase::Update::apply() -> size_t
+{
+    if (this->task == nullptr) return 0;
+
+    Store&           store   = this->data_base.store;
+    const TaskPtr&   task    = this->task;
+    const auto&      changer = this->changer;
+    size_t           logged  = task->getChangeLogs().size();
+    CoarseClock::Pin pin;  // one timestamp for the whole group
+
+    if (this->title && !task->getTitle().empty()) {
+        store.update<ByTitle>(task, [&] { return task->setTitle(*this->title, changer); });
+    }
+    if (this->status) {
+        store.update<ByStatus>(task, [&] { return task->setStatus(*this->status, changer); });
+    }
+    if (this->priority) {
+        store.update<ByPriority>(task, [&] { return task->setPriority(*this->priority, changer); });
+    }
+    if (this->deadline) {
+        store.update<ByDeadline>(task, [&] { return task->setDeadline(*this->deadline, changer); });
+    }
+    if (this->start_date) {
+        store.update<ByStartDate>(task, [&] {
+            return task->setStartDate(*this->start_date, changer);
+        });
+    }
+    if (this->manager) {
+        store.update<ByManager>(task, [&] { return task->setManager(*this->manager, changer); });
+    }
+
+    return task->getChangeLogs().size() - logged;
 }
\ No newline at end of file
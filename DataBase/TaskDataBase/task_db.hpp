@@ -2,11 +2,14 @@
 #include <map>
 #include <unordered_map>
 
+#include "IndexedStore/indexed_store.hpp"
 #include "Task/task.hpp"
 #include "Usings/type_usings.hpp"
 
 class TaskDataBase {
 public:
+    class Update;
+
     void add(const TaskPtr& task);
     void safe_remove(const BigUint& id, const Date& remove_date);
     void hard_remove(const size_t index);
@@ -15,17 +18,17 @@ public:
     /// @{
     auto size() const -> size_t;
     bool empty();
-    auto getAll() const -> const std::unordered_map<BigUint, TaskPtr>&;
-    auto getByTitle() const -> const std::multimap<std::string, TaskPtr>&;
-    auto getByStatus() const -> const std::unordered_map<Task::Status, std::vector<TaskPtr>>&;
-    auto getByPriority() const -> const std::unordered_map<Priority, std::vector<TaskPtr>>&;
+    auto getAll() const -> const FlatHashMap<BigUint, TaskPtr>&;
+    auto getByStatus() const -> const std::unordered_map<Task::Status, RoaringBitmap>&;
+    auto getByPriority() const -> const std::unordered_map<Priority, RoaringBitmap>&;
     auto getByCreatedDate() const -> const std::multimap<Date, TaskPtr>&;
     auto getByDeadline() const -> const std::multimap<Date, TaskPtr>&;
     auto getByStartDate() const -> const std::multimap<Date, TaskPtr>&;
     auto getByCreator() const -> const std::unordered_map<BigUint, std::vector<TaskPtr>>&;
     auto getByManager() const -> const std::unordered_map<BigUint, std::vector<TaskPtr>>&;
-    auto getByDeal() const -> const std::unordered_multimap<BigUint, TaskPtr>&;
+    auto getByDeal() const -> const std::unordered_map<BigUint, std::vector<TaskPtr>>&;
     auto getByParty() const -> const std::unordered_map<BigUint, std::vector<TaskPtr>>&;
+    auto getRows() const -> const RoaringBitmap&;
     auto getRemoved() const -> const std::vector<std::pair<Date, TaskPtr>>&;
     /// @}
 
@@ -33,8 +36,8 @@ public:
     /// @{
     auto findById(const BigUint& id) const -> const TaskPtr;
     auto findByTitleSubstr(const std::string& title) const -> const std::vector<TaskPtr>;
-    auto findByStatus(const Task::Status status) const -> const std::vector<TaskPtr>&;
-    auto findByPriority(const Priority priority) const -> const std::vector<TaskPtr>&;
+    auto findByStatus(const Task::Status status) const -> const std::vector<TaskPtr>;
+    auto findByPriority(const Priority priority) const -> const std::vector<TaskPtr>;
     auto findByCreatedDate(const Date& date) const -> const std::vector<TaskPtr>;
     auto findByDeadline(const Date& date) const -> const std::vector<TaskPtr>;
     auto findByStartDate(const Date& date) const -> const std::vector<TaskPtr>;
@@ -42,10 +45,14 @@ public:
     auto findByManager(const BigUint& id) const -> const std::vector<TaskPtr>&;
     auto findByDeal(const BigUint& id) const -> const std::vector<TaskPtr>;
     auto findByParty(const BigUint& id) const -> const std::vector<TaskPtr>&;
+    /// Tasks in `rows`, a combination of the status and priority bitmaps
+    auto findByRows(const RoaringBitmap& rows) const -> const std::vector<TaskPtr>;
     /// @}
 
     /// @name Change functions
     /// @{
+    /// Starts an `Update` of the task with `id`. The one-field changes below are such updates.
+    auto update(const BigUint& id, const InternalEmployeePtr& changer) -> Update;
     void changeTitle(
         const BigUint& id, const std::string& title, const InternalEmployeePtr& changer
     );
@@ -55,9 +62,11 @@ public:
     void changePriority(
         const BigUint& id, const Priority priority, const InternalEmployeePtr& changer
     );
-    void changeDeadline(const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer);
+    void changeDeadline(
+        const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
+    );
     void changeStartDate(
-        const BigUint& id, const DatePtr& date, const InternalEmployeePtr& changer
+        const BigUint& id, const OptionalDate& date, const InternalEmployeePtr& changer
     );
     void changeManager(
         const BigUint& id, const WeakInternalEmployee& manager, const InternalEmployeePtr& changer
@@ -79,42 +88,72 @@ public:
     void removeDeal(const BigUint& id);
     /// @}
 private:
-    static const std::vector<TaskPtr>                      empty_vector;
-
-    std::unordered_map<BigUint, TaskPtr>                   by_id;
-    std::multimap<std::string, TaskPtr>                    by_title_substr_search;
-    std::unordered_map<Task::Status, std::vector<TaskPtr>> by_status;
-    std::unordered_map<Priority, std::vector<TaskPtr>>     by_priority;
-    std::multimap<Date, TaskPtr>                           by_created_date;
-    std::multimap<Date, TaskPtr>                           by_deadline;
-    std::multimap<Date, TaskPtr>                           by_start_date;
-    std::unordered_map<BigUint, std::vector<TaskPtr>>      by_creator;
-    std::unordered_map<BigUint, std::vector<TaskPtr>>      by_manager;
-    std::unordered_multimap<BigUint, TaskPtr>              by_deal;
-    std::unordered_map<BigUint, std::vector<TaskPtr>>      by_party;
-
-    std::vector<std::pair<Date, TaskPtr>>                  removed;
-
-    //
-    void safeRemoveFromMap(
-        auto&              map,
-        const auto&        key,
-        const TaskPtr&     task,
-        const size_t       line,
-        const std::string& index_name
-    );
-    void safeRemoveFromVector(
-        auto&              map,
-        const auto&        key,
-        const TaskPtr&     task,
-        const size_t       line,
-        const std::string& index_name
-    );
+    using ById          = indexes::Unique<Task, indexes::Get<&Task::getId>, "by_id">;
+    using ByTitle       = indexes::Substring<
+        Task, indexes::Lower<indexes::NonEmpty<&Task::getTitle>>, "by_title_substr_search">;
+    using ByStatus      = indexes::Bitmap<Task, indexes::Get<&Task::getStatus>, "by_status">;
+    using ByPriority    = indexes::Bitmap<Task, indexes::Get<&Task::getPriority>, "by_priority">;
+    using ByCreatedDate =
+        indexes::Ordered<Task, indexes::Get<&Task::getCreatedDate>, "by_created_date">;
+    using ByDeadline  = indexes::Ordered<Task, indexes::Get<&Task::getDeadline>, "by_deadline">;
+    using ByStartDate = indexes::Ordered<Task, indexes::Get<&Task::getStartDate>, "by_start_date">;
+    using ByCreator   = indexes::Bucket<Task, indexes::IdOf<&Task::getCreatedBy>, "by_creator">;
+    using ByManager   = indexes::Bucket<Task, indexes::IdOf<&Task::getManager>, "by_manager">;
+    using ByDeal      = indexes::Bucket<Task, indexes::IdOf<&Task::getDeals>, "by_deal">;
+    using ByParty     = indexes::Bucket<Task, indexes::IdOf<&Task::getTeem>, "by_party">;
+    using Store       = IndexedStore<
+        Task,
+        ById,
+        ByTitle,
+        ByStatus,
+        ByPriority,
+        ByCreatedDate,
+        ByDeadline,
+        ByStartDate,
+        ByCreator,
+        ByManager,
+        ByDeal,
+        ByParty>;
 
-    void logEmptyContainer(
-        const std::string& file,
-        const size_t       line,
-        const std::string& task_id,
-        const std::string& index_name
-    );
+    static const std::vector<TaskPtr>     empty_vector;
+
+    Store                                 store{"Task"};
+    std::vector<std::pair<Date, TaskPtr>> removed;
+};
+
+/**
+ * @class TaskDataBase::Update
+ * @brief Changes to several fields of one task, applied together.
+ *
+ * Setters only record the new values. `apply` makes the changes in the order of the setters,
+ * all with one date, and moves the task once in each index whose key it changes. A task with
+ * an empty title keeps it, as with `changeTitle`.
+ */
+class TaskDataBase::Update {
+public:
+    auto setTitle(const std::string& title) -> Update&;
+    auto setStatus(const Task::Status status) -> Update&;
+    auto setPriority(const Priority priority) -> Update&;
+    auto setDeadline(const OptionalDate& date) -> Update&;
+    auto setStartDate(const OptionalDate& date) -> Update&;
+    auto setManager(const WeakInternalEmployee& manager) -> Update&;
+
+    /// Returns how many fields changed. Does nothing if the task is not in the data base.
+    auto apply() -> size_t;
+
+private:
+    friend class TaskDataBase;
+
+    Update(TaskDataBase& data_base, TaskPtr task, InternalEmployeePtr changer);
+
+    TaskDataBase&       data_base;
+    TaskPtr             task;  // nullptr if there is no such task
+    InternalEmployeePtr changer;
+
+    std::optional<std::string>          title;
+    std::optional<Task::Status>         status;
+    std::optional<Priority>             priority;
+    std::optional<OptionalDate>         deadline;
+    std::optional<OptionalDate>         start_date;
+    std::optional<WeakInternalEmployee> manager;
 };
\ No newline at end of file
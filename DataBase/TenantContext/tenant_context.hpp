@@ -4,6 +4,7 @@
 #include "DataBase/PersonDataBase/external_employee_db.hpp"
 #include "DataBase/PersonDataBase/internal_employee_db.hpp"
 #include "DataBase/TaskDataBase/task_db.hpp"
+#include "TenantContext/string_pool.hpp"
 struct TenantContext {
     ClientDataBase&           client_data_base;
     ExternalEmployeeDataBase& external_employee_data_base;
@@ -11,4 +12,6 @@ struct TenantContext {
     DealDataBase&             deal_data_base;
     TaskDataBase&             task_data_base;
     InteractionDataBase&      interaction_data_base;
+    /// Interned strings of the tenant; every data base above is built on this pool
+    StringPool&               string_pool;
 };
\ No newline at end of file
@@ -1,74 +1,205 @@
-
 #include "big_uint.hpp"
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
+#include "BigNum/digits.hpp"
 #include "location.hpp"
 #include "stdexcept"
 
+namespace {
+    constexpr uint32_t decimal_base   = 1000000000;  // 10^9 fits a 32-bit limb
+    constexpr size_t   decimal_digits = 9;
+}  // namespace
+
 BigUint::BigUint(const std::string& num)
 {
-    if (num.size() == 0) {
+    if (!parse(num, *this)) {
         throw std::invalid_argument(errors::uint_constructor_error);
     }
-    for (size_t i = 0; i < num.size(); i++) {
-        if (!std::isdigit(num[i])) {
-            throw std::invalid_argument(errors::uint_constructor_error);
+}
+
+auto BigUint::parseBatch(const std::string_view* texts, BigUint* result, const size_t count)
+    -> size_t
+{
+    for (size_t i = 0; i < count; i++) {
+        if (!parse(texts[i], result[i])) return i;
+    }
+    return count;
+}
+
+bool BigUint::parse(const std::string_view num, BigUint& result)
+{
+    if (num.empty() || !digits::allDigits(num)) return false;
+
+    result.low       = 0;
+    result.high_size = 0;
+    result.high.reset();
+
+    size_t first = num.find_first_not_of('0');
+    if (first == std::string_view::npos) return true;
+
+    if (num.size() - first <= digits::max_u64_digits) {
+        result.low = digits::parse(num.data() + first, num.size() - first);
+        return true;
+    }
+
+    // Accumulate base 10^9 chunks into 32-bit limbs (least significant first), this keeps
+    // every intermediate product inside uint64_t.
+    std::vector<uint32_t> limbs;
+    size_t                chunk = (num.size() - first) % decimal_digits;
+    if (chunk == 0) chunk = decimal_digits;
+    for (size_t pos = first; pos < num.size(); pos += chunk, chunk = decimal_digits) {
+        uint64_t carry = digits::parse(num.data() + pos, chunk);
+        for (auto& limb : limbs) {
+            uint64_t cur = static_cast<uint64_t>(limb) * decimal_base + carry;
+            limb         = static_cast<uint32_t>(cur);
+            carry        = cur >> 32;
         }
+        if (carry != 0) limbs.push_back(static_cast<uint32_t>(carry));
+    }
+    if (limbs.size() % 2 != 0) limbs.push_back(0);
+
+    result.low = static_cast<uint64_t>(limbs[1]) << 32 | limbs[0];
+
+    size_t size = limbs.size() / 2 - 1;
+    while (size > 0 && limbs[size * 2] == 0 && limbs[size * 2 + 1] == 0) {
+        size--;
+    }
+    if (size == 0) return true;
+
+    result.high_size = static_cast<uint32_t>(size);
+    result.high      = std::make_unique<uint64_t[]>(size);
+    for (size_t i = 0; i < size; i++) {
+        result.high[i] = static_cast<uint64_t>(limbs[i * 2 + 3]) << 32 | limbs[i * 2 + 2];
+    }
+    return true;
+}
+
+BigUint::BigUint(const uint64_t num) : low(num) {}
+
+BigUint::BigUint(const BigUint& other) : low(other.low), high_size(other.high_size)
+{
+    if (other.high_size != 0) {
+        this->high = std::make_unique<uint64_t[]>(other.high_size);
+        std::copy(other.high.get(), other.high.get() + other.high_size, this->high.get());
     }
-    this->num = num.substr(num.find_first_not_of('0'), num.back());
 }
 
-BigUint::BigUint(const BigUint& other) : num(other.num) {}
+BigUint::BigUint(BigUint&& other) noexcept
+    : low(other.low), high_size(other.high_size), high(std::move(other.high))
+{
+    other.low       = 0;
+    other.high_size = 0;
+}
 
 BigUint& BigUint::operator=(const BigUint& other)
 {
     if (this != &other) {
-        this->num = other.num;
+        if (other.high_size == 0) {
+            this->high.reset();
+        } else {
+            if (this->high_size != other.high_size) {
+                this->high = std::make_unique<uint64_t[]>(other.high_size);
+            }
+            std::copy(other.high.get(), other.high.get() + other.high_size, this->high.get());
+        }
+        this->low       = other.low;
+        this->high_size = other.high_size;
     }
     return *this;
 }
 
-BigUint& BigUint::operator++()
+BigUint& BigUint::operator=(BigUint&& other) noexcept
 {
-    if (num.find_first_not_of('9') == std::string::npos) {
-        std::string newNum = "1";
-        newNum.insert(newNum.size(), std::string(this->num.size(), '0'));
-        this->num = newNum;
-        return (*this);
+    if (this != &other) {
+        this->low       = other.low;
+        this->high_size = other.high_size;
+        this->high      = std::move(other.high);
+        other.low       = 0;
+        other.high_size = 0;
     }
-    int i = static_cast<int>(num.size() - 1);
-    while (i >= 0) {
-        if (num[i] != '9') {
-            // Can increment this digit without carry
-            int digit = (num[i] - '0') + 1;
-            num[i]    = static_cast<char>(digit + '0');
-            return *this;
-        } else {
-            // Set to '0' and carry over
-            num[i] = '0';
-            --i;
-        }
+    return *this;
+}
+
+BigUint& BigUint::operator++()
+{
+    if (++this->low != 0) return *this;
+
+    // Carry over the 64-bit boundary
+    for (uint32_t i = 0; i < this->high_size; i++) {
+        if (++this->high[i] != 0) return *this;
     }
-    return (*this);
+    auto grown = std::make_unique<uint64_t[]>(this->high_size + 1);
+    std::copy(this->high.get(), this->high.get() + this->high_size, grown.get());
+    grown[this->high_size] = 1;
+    this->high             = std::move(grown);
+    this->high_size++;
+    return *this;
 }
 
-bool BigUint::operator<(const BigUint& other) const
+bool BigUint::operator==(const char* rhs) const { return this->toString() == rhs; }
+bool BigUint::operator!=(const char* rhs) const { return !(*this == rhs); }
+
+auto BigUint::toString() const -> std::string
 {
-    if (this->num.size() < other.num.size())
-        return true;
-    else if (this->num.size() > other.num.size())
-        return false;
+    if (this->high_size == 0) return std::to_string(this->low);
+
+    std::vector<uint32_t> limbs;
+    limbs.reserve((this->high_size + 1) * 2);
+    limbs.push_back(static_cast<uint32_t>(this->low));
+    limbs.push_back(static_cast<uint32_t>(this->low >> 32));
+    for (uint32_t i = 0; i < this->high_size; i++) {
+        limbs.push_back(static_cast<uint32_t>(this->high[i]));
+        limbs.push_back(static_cast<uint32_t>(this->high[i] >> 32));
+    }
 
-    for (size_t i = this->num.size(); i >= 0; i--) {
-        if (this->num[i] != other.num[i]) {
-            return (int)this->num[i] - '0' < (int)other.num[i] - '0';
+    // Repeated division by 10^9 yields the decimal chunks from the least significant one
+    std::vector<uint32_t> chunks;
+    while (!limbs.empty()) {
+        uint64_t rem = 0;
+        for (size_t i = limbs.size(); i-- > 0;) {
+            uint64_t cur = rem << 32 | limbs[i];
+            limbs[i]     = static_cast<uint32_t>(cur / decimal_base);
+            rem          = cur % decimal_base;
+        }
+        chunks.push_back(static_cast<uint32_t>(rem));
+        while (!limbs.empty() && limbs.back() == 0) {
+            limbs.pop_back();
         }
     }
-    return false;
+
+    std::string result = std::to_string(chunks.back());
+    for (size_t i = chunks.size() - 1; i-- > 0;) {
+        std::string chunk = std::to_string(chunks[i]);
+        result.append(decimal_digits - chunk.size(), '0');
+        result += chunk;
+    }
+    return result;
+}
+
+int BigUint::compareWide(const BigUint& other) const
+{
+    if (this->high_size != other.high_size) return this->high_size < other.high_size ? -1 : 1;
+    for (uint32_t i = this->high_size; i-- > 0;) {
+        if (this->high[i] != other.high[i]) return this->high[i] < other.high[i] ? -1 : 1;
+    }
+    if (this->low != other.low) return this->low < other.low ? -1 : 1;
+    return 0;
+}
+
+bool BigUint::equalWide(const BigUint& other) const
+{
+    if (this->high_size != other.high_size || this->low != other.low) return false;
+    return std::equal(this->high.get(), this->high.get() + this->high_size, other.high.get());
 }
 
-bool BigUint::operator==(const BigUint& other) const { return this->num == other.num; }
-bool BigUint::operator==(const char* rhs) const { return *this == std::string(rhs); }
-bool BigUint::operator!=(const BigUint& other) const { return this->num != other.num; }
-bool BigUint::operator!=(const char* rhs) const { return *this != std::string(rhs); }
+std::size_t BigUint::hashWide() const
+{
+    uint64_t result = mix(this->low);
+    for (uint32_t i = 0; i < this->high_size; i++) {
+        result = mix(result ^ (this->high[i] + 0x9e3779b97f4a7c15ULL + (result << 6)));
+    }
+    return static_cast<std::size_t>(result);
+}
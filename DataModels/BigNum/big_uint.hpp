@@ -1,12 +1,33 @@
 #pragma once
+#include <stdint.h>
+
+#include <cstddef>
+#include <memory>
 #include <string>
+#include <string_view>
 
+/**
+ * @struct BigUint
+ * @brief Unsigned integer of unlimited size used for entity ids.
+ *
+ * Values that fit into 64 bits are stored inline in `low`, so copying, comparing and hashing
+ * an id never touches the heap. Wider values keep their upper 64-bit limbs in `high`
+ * (least significant limb first). Decimal strings are produced only by `toString()`.
+ */
 struct BigUint {
     BigUint() = default;
     BigUint(const std::string& num);
+    explicit BigUint(const uint64_t num);
     BigUint(const BigUint& other);
+    BigUint(BigUint&& other) noexcept;
+
+    /// Parses a column of decimal ids into `result[0, count)`. Stops at the first text that is
+    /// not a valid id and returns its index, or `count` when every text was parsed.
+    static auto parseBatch(const std::string_view* texts, BigUint* result, const size_t count)
+        -> size_t;
 
     BigUint&    operator=(const BigUint& other);
+    BigUint&    operator=(BigUint&& other) noexcept;
     BigUint&    operator++();
 
     bool        operator<(const BigUint& other) const;
@@ -16,14 +37,65 @@ struct BigUint {
     bool        operator!=(const BigUint& other) const;
     bool        operator!=(const char* rhs) const;
 
-    std::string num = "0";
+    /// @name Getters
+    /// @{
+    auto        toString() const -> std::string;
+    auto        isWide() const -> bool;
+    /// Lowest 64 bits, the whole value unless `isWide()`
+    auto        getLow() const -> uint64_t;
+    auto        hash() const -> std::size_t;
+    /// @}
+
+private:
+    static constexpr uint64_t mix(uint64_t value);
+    static bool               parse(const std::string_view num, BigUint& result);
+
+    int                       compareWide(const BigUint& other) const;
+    bool                      equalWide(const BigUint& other) const;
+    std::size_t               hashWide() const;
+
+    uint64_t                    low       = 0;
+    uint32_t                    high_size = 0;
+    std::unique_ptr<uint64_t[]> high;
 };
+
+/// murmur3 fmix64 finalizer - spreads sequential ids over all bits of the hash
+constexpr uint64_t BigUint::mix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    value *= 0xc4ceb9fe1a85ec53ULL;
+    value ^= value >> 33;
+    return value;
+}
+
+inline bool BigUint::operator<(const BigUint& other) const
+{
+    if ((this->high_size | other.high_size) == 0) return this->low < other.low;
+    return this->compareWide(other) < 0;
+}
+
+inline bool BigUint::operator==(const BigUint& other) const
+{
+    if ((this->high_size | other.high_size) == 0) return this->low == other.low;
+    return this->equalWide(other);
+}
+
+inline bool BigUint::operator!=(const BigUint& other) const { return !(*this == other); }
+
+inline auto BigUint::isWide() const -> bool { return this->high_size != 0; }
+inline auto BigUint::getLow() const -> uint64_t { return this->low; }
+
+inline auto BigUint::hash() const -> std::size_t
+{
+    if (this->high_size == 0) return static_cast<std::size_t>(mix(this->low));
+    return this->hashWide();
+}
+
 namespace std {
     template <>
     struct hash<BigUint> {
-        std::size_t operator()(const BigUint& bigUint) const noexcept
-        {
-            return std::hash<std::string>{}(bigUint.num);
-        }
+        std::size_t operator()(const BigUint& bigUint) const noexcept { return bigUint.hash(); }
     };
-}  // namespace std
\ No newline at end of file
+}  // namespace std
@@ -0,0 +1,126 @@
+#include "digits.hpp"
+
+#include <string.h>
+
+#include <bit>
+
+#if SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+    /// Eight digits at once inside one 64-bit register (little-endian only)
+    uint32_t parseEight(const char* first)
+    {
+        uint64_t value;
+        memcpy(&value, first, sizeof(value));
+        value -= 0x3030303030303030ULL;
+        value = value * 10 + (value >> 8);  // pairs of digits in every other byte
+        value = ((value & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)) +
+                 ((value >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32))) >>
+                32;
+        return static_cast<uint32_t>(value);
+    }
+
+    auto prefixScalar(const char* begin, const char* first, const char* last) -> size_t
+    {
+        while (first != last && *first >= '0' && *first <= '9') ++first;
+        return static_cast<size_t>(first - begin);
+    }
+
+#if SIMD_X86
+    SIMD_TARGET("sse4.1")
+    uint64_t parseSixteen(const char* first)
+    {
+        __m128i value = _mm_sub_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(first)), _mm_set1_epi8('0')
+        );
+        // 16 x 1 digit -> 8 x 2 digits -> 4 x 4 digits -> 2 x 8 digits
+        value = _mm_maddubs_epi16(
+            value, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1)
+        );
+        value = _mm_madd_epi16(value, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+        value = _mm_packus_epi32(value, value);
+        value = _mm_madd_epi16(value, _mm_setr_epi16(10000, 1, 10000, 1, 0, 0, 0, 0));
+
+        uint64_t high = static_cast<uint32_t>(_mm_cvtsi128_si32(value));
+        uint64_t low  = static_cast<uint32_t>(_mm_extract_epi32(value, 1));
+        return high * 100000000 + low;
+    }
+
+    // The byte compares are signed, so non-ASCII bytes (>= 0x80) count as below '0'
+    SIMD_TARGET("sse4.1")
+    auto prefixSse41(const char* begin, const char* first, const char* last) -> size_t
+    {
+        const __m128i zero = _mm_set1_epi8('0');
+        const __m128i nine = _mm_set1_epi8('9');
+        for (; last - first >= 16; first += 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i wrong =
+                _mm_or_si128(_mm_cmplt_epi8(chunk, zero), _mm_cmpgt_epi8(chunk, nine));
+            uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(wrong));
+            if (mask != 0) return static_cast<size_t>(first - begin) + std::countr_zero(mask);
+        }
+        return prefixScalar(begin, first, last);
+    }
+
+    SIMD_TARGET("avx2")
+    auto prefixAvx2(const char* begin, const char* first, const char* last) -> size_t
+    {
+        const __m256i zero = _mm256_set1_epi8('0');
+        const __m256i nine = _mm256_set1_epi8('9');
+        for (; last - first >= 32; first += 32) {
+            __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            __m256i wrong = _mm256_or_si256(
+                _mm256_cmpgt_epi8(zero, chunk), _mm256_cmpgt_epi8(chunk, nine)
+            );
+            uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(wrong));
+            if (mask != 0) return static_cast<size_t>(first - begin) + std::countr_zero(mask);
+        }
+        return prefixSse41(begin, first, last);
+    }
+#endif
+}  // namespace
+
+auto digits::prefixLength(const char* first, const char* last) -> size_t
+{
+    return prefixLength(first, last, simd::supported());
+}
+
+auto digits::prefixLength(
+    const char* first, const char* last, [[maybe_unused]] const simd::Level level
+) -> size_t
+{
+#if SIMD_X86
+    if (level >= simd::Level::AVX2) return prefixAvx2(first, first, last);
+    if (level >= simd::Level::SSE41) return prefixSse41(first, first, last);
+#endif
+    return prefixScalar(first, first, last);
+}
+
+auto digits::parse(const char* first, size_t count) -> uint64_t
+{
+    return parse(first, count, simd::supported());
+}
+
+auto digits::parse(const char* first, size_t count, [[maybe_unused]] const simd::Level level)
+    -> uint64_t
+{
+    uint64_t value = 0;
+#if SIMD_X86
+    if (level >= simd::Level::SSE41 && count >= 16) {
+        value = parseSixteen(first);
+        first += 16;
+        count -= 16;
+    }
+#endif
+    if constexpr (std::endian::native == std::endian::little) {
+        for (; count >= 8; first += 8, count -= 8) {
+            value = value * 100000000 + parseEight(first);
+        }
+    }
+    for (; count > 0; ++first, --count) {
+        value = value * 10 + static_cast<uint64_t>(*first - '0');
+    }
+    return value;
+}
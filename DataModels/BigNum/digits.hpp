@@ -0,0 +1,34 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string_view>
+
+#include "Simd/simd.hpp"
+
+/**
+ * @brief Locale-independent validation and parsing of ASCII decimal digits.
+ *
+ * Shared by `BigUint`, `Money` and `PhoneNumber`. Validation checks 32 (AVX2) or 16 (SSE4.1)
+ * characters per step, parsing decodes 16 (SSE4.1) or 8 (SWAR) digits per step straight into
+ * the binary value. Both fall back to one character at a time for the tail. The vector paths
+ * are chosen when the process runs (see `simd::supported()`), not by the build flags.
+ */
+namespace digits {
+    inline constexpr size_t max_u64_digits = 19;  ///< every 19-digit number fits 64 bits
+
+    /// Length of the run of '0'...'9' at the start of [first, last)
+    auto prefixLength(const char* first, const char* last) -> size_t;
+    /// Same with the paths of `level`, which the CPU must support
+    auto prefixLength(const char* first, const char* last, const simd::Level level) -> size_t;
+
+    inline bool allDigits(const std::string_view text)
+    {
+        return prefixLength(text.data(), text.data() + text.size()) == text.size();
+    }
+
+    /// Value of `count` digits starting at `first`. The digits must already be validated and
+    /// `count` must not exceed `max_u64_digits`.
+    auto parse(const char* first, const size_t count) -> uint64_t;
+    auto parse(const char* first, const size_t count, const simd::Level level) -> uint64_t;
+}  // namespace digits
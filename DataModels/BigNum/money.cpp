@@ -2,226 +2,288 @@
 
 #include <stdexcept>
 
+#include "BigNum/digits.hpp"
 #include "location.hpp"
 
-Money::Money(const std::string& num, const Currencies currency)
-{
-    bool point = false;
-    for (auto& ex : num) {
-        if (!isdigit(ex)) {
-            if (ex == '.' && point == false) {
-                point = true;
-            } else {
-                throw std::runtime_error(errors::invalid_currency_format);
-            }
+#if !defined(__SIZEOF_INT128__) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+    using Units = Money::Units;
+
+    constexpr Units max_units =
+        ((Units(1) << (sizeof(Units) * 8 - 2)) - 1) * 2 + 1;  // numeric_limits is not
+                                                              // specialized for __int128
+    constexpr Units pow10(uint8_t exp)
+    {
+        Units result = 1;
+        while (exp-- > 0) {
+            result *= 10;
         }
+        return result;
     }
-    this->num        = num;
-    size_t point_pos = num.find_first_of('.');
-    if (point_pos != std::string::npos) {
-        size_t frac_size = num.size() - (point_pos + 1);
-        if (frac_size == 1) {
-            this->num.insert(num.size() - 1, "0");
-        }
-        if (frac_size > 2) {
-            throw std::runtime_error(errors::invalid_currency_format);
+
+    Units checkedAdd(const Units lhs, const Units rhs)
+    {
+        if ((rhs > 0 && lhs > max_units - rhs) || (rhs < 0 && lhs < -max_units - rhs)) {
+            throw std::overflow_error(errors::money_overflow);
         }
+        return lhs + rhs;
     }
-    if (point_pos == std::string::npos) this->num += ".00";
 
-    this->currency = currency;
-}
+    enum class ParseStatus : uint8_t { Ok, Invalid, Overflow };
 
-bool Money::operator<(const Money& other) const
-{
-    if (this->num.size() < other.num.size()) return true;
-    if (this->num.size() > other.num.size()) return false;
-    for (size_t i = 0; i < num.size(); i++) {
-        if (this->num[i] < other.num[i]) return true;
-        if (this->num[i] > other.num[i]) return false;
-    }
-    return false;
-}
+    /// "123", "123.", ".45" and "123.45" are accepted, at most `scale` fractional digits
+    ParseStatus tryParseUnits(const std::string_view num, const uint8_t scale, Units& result)
+    {
+        size_t           point = num.find('.');
+        std::string_view whole = num.substr(0, point);
+        std::string_view frac;
+        if (point != std::string_view::npos) frac = num.substr(point + 1);
 
-bool   Money::operator==(const Money& other) const { return this->num == other.num; }
+        if (!digits::allDigits(whole) || !digits::allDigits(frac) || frac.size() > scale) {
+            return ParseStatus::Invalid;
+        }
 
-bool   Money::operator!=(const Money& other) const { return this->num != other.num; }
+        // Up to 18 digits in total (after scaling) cannot overflow, decode them directly
+        if (whole.size() + scale < digits::max_u64_digits) {
+            Units integer  = static_cast<Units>(digits::parse(whole.data(), whole.size()));
+            Units fraction = static_cast<Units>(digits::parse(frac.data(), frac.size()));
+            result         = integer * pow10(scale) +
+                     fraction * pow10(static_cast<uint8_t>(scale - frac.size()));
+            return ParseStatus::Ok;
+        }
 
-Money& Money::operator+=(const std::string& other)
-{
-    size_t      leftDot = this->num.find_first_of('.');
-    std::string leftInteger;
-    std::string leftPennyStr = "00";
-    if (leftDot != std::string::npos) {
-        leftInteger  = this->num.substr(0, leftDot);
-        leftPennyStr = this->num.substr(leftDot + 1);
-    } else {
-        leftInteger = this->num;
-    }
-    if (leftPennyStr.size() < 2) {
-        leftPennyStr += std::string(2 - leftPennyStr.size(), '0');
-    } else if (leftPennyStr.size() > 2) {
-        leftPennyStr = leftPennyStr.substr(0, 2);
-    }
-    uint8_t     leftPenny = static_cast<uint8_t>(std::stoi(leftPennyStr));
-
-    size_t      rightDot = other.find_first_of('.');
-    std::string rightInteger;
-    std::string rightPennyStr = "00";
-    if (rightDot != std::string::npos) {
-        rightInteger  = other.substr(0, rightDot);
-        rightPennyStr = other.substr(rightDot + 1);
-    } else {
-        rightInteger = other;
-    }
-    if (rightPennyStr.size() < 2) {
-        rightPennyStr += std::string(2 - rightPennyStr.size(), '0');
-    } else if (rightPennyStr.size() > 2) {
-        rightPennyStr = rightPennyStr.substr(0, 2);
+        Units value = 0;
+        for (char ex : num) {
+            if (ex == '.') continue;
+            if (value > (max_units - (ex - '0')) / 10) return ParseStatus::Overflow;
+            value = value * 10 + (ex - '0');
+        }
+        Units factor = pow10(static_cast<uint8_t>(scale - frac.size()));
+        if (value > max_units / factor) return ParseStatus::Overflow;
+        result = value * factor;
+        return ParseStatus::Ok;
     }
-    uint8_t rightPenny = static_cast<uint8_t>(std::stoi(rightPennyStr));
-
-    int     pennySum = leftPenny + rightPenny;
-    int     carry    = (pennySum >= 100) ? 1 : 0;
-    pennySum %= 100;
-    std::string finalPennyStr = std::to_string(pennySum);
-    if (finalPennyStr.size() < 2) {
-        finalPennyStr = "0" + finalPennyStr;
+
+    Units parseUnits(const std::string_view num, const uint8_t scale)
+    {
+        Units result = 0;
+        switch (tryParseUnits(num, scale, result)) {
+            case ParseStatus::Ok:
+                break;
+            case ParseStatus::Invalid:
+                throw std::runtime_error(errors::invalid_currency_format);
+            case ParseStatus::Overflow:
+                throw std::overflow_error(errors::money_overflow);
+        }
+        return result;
     }
 
-    int         i = static_cast<int>(leftInteger.length()) - 1;
-    int         j = static_cast<int>(rightInteger.length()) - 1;
-    std::string result;
-    int         intCarry = carry;
-    while (i >= 0 || j >= 0 || intCarry != 0) {
-        int digit1 = 0;
-        if (i >= 0) {
-            digit1 = leftInteger[i] - '0';
-            i--;
+    /// |value| * mul / div with the requested rounding, div is a power of ten
+    Units mulDiv(
+        const Units value, const uint64_t mul, const uint64_t div, Money::Rounding rounding
+    )
+    {
+        bool  negative = value < 0;
+        Units quotient;
+        Units remainder;
+#if defined(_MONEY_INT128) && defined(__SIZEOF_INT128__)
+        Units magnitude = negative ? -value : value;
+        if (mul != 0 && magnitude > max_units / static_cast<Units>(mul)) {
+            throw std::overflow_error(errors::money_overflow);
         }
-        int digit2 = 0;
-        if (j >= 0) {
-            digit2 = rightInteger[j] - '0';
-            j--;
+        quotient  = magnitude * mul / div;
+        remainder = magnitude * mul % div;
+#else
+        uint64_t magnitude = negative ? 0 - static_cast<uint64_t>(value) : value;
+        uint64_t rem;
+        uint64_t quot;
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 product = static_cast<unsigned __int128>(magnitude) * mul;
+        if ((product >> 64) >= div) throw std::overflow_error(errors::money_overflow);
+        quot = static_cast<uint64_t>(product / div);
+        rem  = static_cast<uint64_t>(product % div);
+#else
+        uint64_t high;
+        uint64_t low = _umul128(magnitude, mul, &high);
+        if (high >= div) throw std::overflow_error(errors::money_overflow);
+        quot = _udiv128(high, low, div, &rem);
+#endif
+        if (quot > static_cast<uint64_t>(max_units)) {
+            throw std::overflow_error(errors::money_overflow);
         }
-        int sum = digit1 + digit2 + intCarry;
-        result.push_back((sum % 10) + '0');
-        intCarry = sum / 10;
+        quotient  = static_cast<Units>(quot);
+        remainder = static_cast<Units>(rem);
+#endif
+        Units half = static_cast<Units>(div) - remainder;  // remainder * 2 >= div <=> rem >= half
+        bool  round_up = false;
+        switch (rounding) {
+            case Money::Rounding::HalfUp:
+                round_up = remainder >= half;
+                break;
+            case Money::Rounding::HalfEven:
+                round_up = remainder > half || (remainder == half && quotient % 2 != 0);
+                break;
+            case Money::Rounding::Down:
+                round_up = false;
+                break;
+            case Money::Rounding::Up:
+                round_up = remainder != 0;
+                break;
+        }
+        if (round_up) quotient = checkedAdd(quotient, 1);
+        return negative ? -quotient : quotient;
     }
-    std::reverse(result.begin(), result.end());
+}  // namespace
+
+Money::Money(const std::string& num, const Currencies currency)
+    : currency(currency), scale(currencyScale(currency))
+{
+    this->units = parseUnits(num, this->scale);
+}
+
+Money::Money(const Units units, const Currencies currency)
+    : units(units), currency(currency), scale(currencyScale(currency))
+{
+}
 
-    if (result.empty()) {
-        result = "0";
+auto Money::parseBatch(
+    const std::string_view* texts,
+    const Currencies        currency,
+    Units*                  result,
+    const size_t            count
+) -> size_t
+{
+    uint8_t scale = currencyScale(currency);
+    for (size_t i = 0; i < count; i++) {
+        if (tryParseUnits(texts[i], scale, result[i]) != ParseStatus::Ok) return i;
     }
+    return count;
+}
+
+bool Money::operator<(const Money& other) const
+{
+    // minor units of different currencies have different scales, so compare within a currency
+    if (this->currency != other.currency) return this->currency < other.currency;
+    return this->units < other.units;
+}
+
+bool Money::operator==(const Money& other) const
+{
+    return this->units == other.units && this->currency == other.currency;
+}
 
-    num = result + '.' + finalPennyStr;
+bool   Money::operator!=(const Money& other) const { return !(*this == other); }
+
+Money& Money::operator+=(const std::string& other)
+{
+    this->units = checkedAdd(this->units, parseUnits(other, this->scale));
     return *this;
 }
 
 Money& Money::operator-=(const std::string& other)
 {
-    size_t      leftDot = this->num.find_first_of('.');
-    std::string leftInteger;
-    std::string leftPennyStr = "00";
-    if (leftDot != std::string::npos) {
-        leftInteger  = this->num.substr(0, leftDot);
-        leftPennyStr = this->num.substr(leftDot + 1);
-    } else {
-        leftInteger = this->num;
-    }
-    if (leftPennyStr.size() < 2) {
-        leftPennyStr += std::string(2 - leftPennyStr.size(), '0');
-    } else if (leftPennyStr.size() > 2) {
-        leftPennyStr = leftPennyStr.substr(0, 2);
-    }
-    int         leftPenny = std::stoi(leftPennyStr);
-
-    size_t      rightDot = other.find_first_of('.');
-    std::string rightInteger;
-    std::string rightPennyStr = "00";
-    if (rightDot != std::string::npos) {
-        rightInteger  = other.substr(0, rightDot);
-        rightPennyStr = other.substr(rightDot + 1);
-    } else {
-        rightInteger = other;
-    }
-    if (rightPennyStr.size() < 2) {
-        rightPennyStr += std::string(2 - rightPennyStr.size(), '0');
-    } else if (rightPennyStr.size() > 2) {
-        rightPennyStr = rightPennyStr.substr(0, 2);
+    Units rhs   = parseUnits(other, this->scale);
+    this->units = rhs > this->units ? 0 : this->units - rhs;
+    return *this;
+}
+
+Money& Money::operator+=(const Money& other)
+{
+    if (this->currency != other.currency) {
+        throw std::invalid_argument(errors::currency_mismatch);
     }
-    int  rightPenny = std::stoi(rightPennyStr);
-
-    bool is_negative = false;
-    if (leftInteger.length() < rightInteger.length()) {
-        is_negative = true;
-    } else if (leftInteger.length() == rightInteger.length()) {
-        if (leftInteger < rightInteger) {
-            is_negative = true;
-        } else if (leftInteger == rightInteger) {
-            if (leftPenny < rightPenny) {
-                is_negative = true;
-            }
-        }
+    this->units = checkedAdd(this->units, other.units);
+    return *this;
+}
+
+Money& Money::operator-=(const Money& other)
+{
+    if (this->currency != other.currency) {
+        throw std::invalid_argument(errors::currency_mismatch);
     }
+    this->units = other.units > this->units ? 0 : this->units - other.units;
+    return *this;
+}
+
+Money& Money::subtract(const std::string& other)
+{
+    return this->subtract(Money(parseUnits(other, this->scale), this->currency));
+}
 
-    if (is_negative) {
-        num = "0.00";
-        return *this;
+Money& Money::subtract(const Money& other)
+{
+    if (this->currency != other.currency) {
+        throw std::invalid_argument(errors::currency_mismatch);
     }
+    if (other.units > this->units) throw std::underflow_error(errors::money_underflow);
+    this->units -= other.units;
+    return *this;
+}
 
-    int pennyResult;
-    int borrow = 0;
-    if (leftPenny < rightPenny) {
-        pennyResult = leftPenny + 100 - rightPenny;
-        borrow      = 1;
-    } else {
-        pennyResult = leftPenny - rightPenny;
-        borrow      = 0;
+auto Money::multiply(const int64_t rate, const uint8_t rate_scale, const Rounding rounding) const
+    -> Money
+{
+    if (rate < 0 || rate_scale > 18) {
+        throw std::invalid_argument(errors::invalid_currency_format);
     }
-    std::string finalPennyStr = std::to_string(pennyResult);
-    if (finalPennyStr.size() < 2) {
-        finalPennyStr = "0" + finalPennyStr;
+    uint64_t div = static_cast<uint64_t>(pow10(rate_scale));
+    return Money(mulDiv(this->units, static_cast<uint64_t>(rate), div, rounding), this->currency);
+}
+
+void Money::multiplyBatch(
+    const Units*   units,
+    const int64_t* rates,
+    const uint8_t  rate_scale,
+    Units*         result,
+    const size_t   count,
+    const Rounding rounding
+)
+{
+    if (rate_scale > 18) throw std::invalid_argument(errors::invalid_currency_format);
+    uint64_t div = static_cast<uint64_t>(pow10(rate_scale));
+    for (size_t i = 0; i < count; i++) {
+        if (rates[i] < 0) throw std::invalid_argument(errors::invalid_currency_format);
+        result[i] = mulDiv(units[i], static_cast<uint64_t>(rates[i]), div, rounding);
     }
+}
 
-    int         i = static_cast<int>(leftInteger.length()) - 1;
-    int         j = static_cast<int>(rightInteger.length()) - 1;
-    std::string integerResultReversed;
-    int         intBorrow = borrow;
-    while (i >= 0 || j >= 0 || intBorrow != 0) {
-        int digit1 = 0;
-        if (i >= 0) {
-            digit1 = leftInteger[i] - '0';
-            i--;
-        }
-        int digit2 = 0;
-        if (j >= 0) {
-            digit2 = rightInteger[j] - '0';
-            j--;
-        }
-        int currentDiff = digit1 - digit2 - intBorrow;
-        if (currentDiff < 0) {
-            currentDiff += 10;
-            intBorrow = 1;
-        } else {
-            intBorrow = 0;
-        }
-        integerResultReversed.push_back(currentDiff + '0');
+auto Money::getUnits() const -> Units { return this->units; }
+auto Money::getScale() const -> uint8_t { return this->scale; }
+auto Money::getCurrency() const -> const Currencies& { return this->currency; }
+
+auto Money::toString() const -> std::string
+{
+    Units value = this->units < 0 ? -this->units : this->units;
+    Units pow   = pow10(this->scale);
+    Units whole = value / pow;
+    Units frac  = value % pow;
+
+    // 39 digits cover the whole __int128 range
+    char  buffer[48];
+    char* end = buffer + sizeof(buffer);
+    char* pos = end;
+
+    // Fraction: drop trailing zeros but keep at least two digits (or all when scale < 2)
+    uint8_t digits = this->scale;
+    uint8_t keep   = this->scale < 2 ? this->scale : 2;
+    while (digits > keep && frac % 10 == 0) {
+        frac /= 10;
+        digits--;
     }
-    std::reverse(integerResultReversed.begin(), integerResultReversed.end());
-
-    std::string finalIntegerResult;
-    if (integerResultReversed.empty()) {
-        finalIntegerResult = "0";
-    } else {
-        size_t firstDigit = integerResultReversed.find_first_not_of('0');
-        if (firstDigit == std::string::npos) {
-            finalIntegerResult = "0";
-        } else {
-            finalIntegerResult = integerResultReversed.substr(firstDigit);
-        }
+    for (uint8_t i = 0; i < digits; i++) {
+        *--pos = static_cast<char>('0' + frac % 10);
+        frac /= 10;
     }
+    if (digits != 0) *--pos = '.';
 
-    num = finalIntegerResult + '.' + finalPennyStr;
-    return *this;
-}
\ No newline at end of file
+    do {
+        *--pos = static_cast<char>('0' + whole % 10);
+        whole /= 10;
+    } while (whole != 0);
+    if (this->units < 0) *--pos = '-';
+
+    return std::string(pos, end);
+}
@@ -1,20 +1,95 @@
 #pragma once
+#include <stdint.h>
+
 #include <string>
+#include <string_view>
 #include <variant>
 
 #include "Currencies/currencies.hpp"
 
+/**
+ * @class Money
+ * @brief Fixed-point amount of money.
+ *
+ * The amount is kept as an integer number of minor units of its currency (cents for USD,
+ * satoshi for BTC). The number of fractional digits comes from `currencyScale()`.
+ * Building with `_MONEY_INT128` (GCC/Clang) widens the minor units to 128 bits.
+ */
 class Money {
 public:
-    Money(const std::string& num, const Currencies currency = ountriesCurrencies::USD);
+#if defined(_MONEY_INT128) && defined(__SIZEOF_INT128__)
+    using Units = __int128;
+#else
+    using Units = int64_t;
+#endif
+
+    /// Rounding applied when a result has more fractional digits than the currency allows
+    enum class Rounding : uint8_t {
+        HalfUp,    ///< 0.5 is rounded away from zero
+        HalfEven,  ///< 0.5 is rounded to the nearest even digit (banker's rounding)
+        Down,      ///< Truncate toward zero
+        Up         ///< Any remainder is rounded away from zero
+    };
+
+    Money(const std::string& num, const Currencies currency = CountriesCurrencies::USD);
+    Money(const Units units, const Currencies currency);
+
+    /// Parses a column of amounts in `currency` into minor units `result[0, count)`. Stops at
+    /// the first malformed or overflowing text and returns its index, or `count` when every
+    /// text was parsed.
+    static auto parseBatch(
+        const std::string_view* texts,
+        const Currencies        currency,
+        Units*                  result,
+        const size_t            count
+    ) -> size_t;
 
+    /// Orders by currency, then amount, so the amounts of one currency sit together
     bool        operator<(const Money& other) const;
     bool        operator==(const Money& other) const;
     bool        operator!=(const Money& other) const;
 
+    /// @name Arithmetic
+    /// Addition throws std::overflow_error instead of wrapping. `subtract` throws
+    /// std::underflow_error instead of going below zero, `operator-=` saturates at zero.
+    /// Mixing currencies throws std::invalid_argument.
+    /// @{
     Money&      operator+=(const std::string& other);
     Money&      operator-=(const std::string& other);
+    Money&      operator+=(const Money& other);
+    Money&      operator-=(const Money& other);
+    Money&      subtract(const std::string& other);
+    Money&      subtract(const Money& other);
+
+    /// Returns this amount multiplied by `rate / 10^rate_scale`, e.g. (10845, 4) is 1.0845
+    auto        multiply(
+               const int64_t  rate,
+               const uint8_t  rate_scale,
+               const Rounding rounding = Rounding::HalfEven
+           ) const -> Money;
+
+    /// Writes `units[i] * rates[i] / 10^rate_scale` into `result[i]` for the whole column.
+    /// Every rate shares one scale, so the divisor and its rounding threshold are set up once.
+    static void multiplyBatch(
+        const Units*   units,
+        const int64_t* rates,
+        const uint8_t  rate_scale,
+        Units*         result,
+        const size_t   count,
+        const Rounding rounding = Rounding::HalfEven
+    );
+    /// @}
+
+    /// @name Getters
+    /// @{
+    auto        getUnits() const -> Units;
+    auto        getScale() const -> uint8_t;
+    auto        getCurrency() const -> const Currencies&;
+    auto        toString() const -> std::string;
+    /// @}
 
-    std::string num;
+private:
+    Units       units = 0;
     Currencies  currency;
-};
\ No newline at end of file
+    uint8_t     scale;
+};
@@ -1,6 +1,8 @@
 #include "campaign.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 
 Campaign::Campaign(const BigUint& id) : id(id), type(CampaignType::other) {}
 
@@ -9,8 +11,8 @@ Campaign::Campaign(
     const std::string&           name,
     const CampaignType&          type,
     const OptionalStr&           other_type,
-    const DatePtr&               start_date,
-    const DatePtr&               end_date,
+    const OptionalDate&          start_date,
+    const OptionalDate&          end_date,
     const MoneyPtr&              budget,
     const MoneyPtr&              budget_spent,
     const uint32_t&              total_joined,
@@ -19,12 +21,12 @@ Campaign::Campaign(
     const std::optional<double>& conversion_rate,
     std::vector<Note>            notes,
     std::vector<CampaignLeadPtr> target_leads,
-    std::vector<ChangeLogPtr>    change_logs
+    ChangeChain                  change_logs
 )
     : id(id)
     , name(name)
     , type(type)
-    , other_type(other_type)
+    , other_type(InternedStr::fromOptional(other_type))
     , start_date(start_date)
     , end_date(end_date)
     , budget(budget)
@@ -37,13 +39,15 @@ Campaign::Campaign(
     , target_leads(std::move(target_leads))
     , change_logs(std::move(change_logs))
 {
+    this->change_logs.type = EntityType::Campaign;
+    this->change_logs.id   = id;
 }
 auto Campaign::getId() const -> const BigUint& { return id; }
 auto Campaign::getName() const -> const std::string& { return name; }
 auto Campaign::getType() const -> CampaignType { return type; }
-auto Campaign::getOtherType() const -> const OptionalStr& { return other_type; }
-auto Campaign::getStartDate() const -> const DatePtr& { return start_date; }
-auto Campaign::getEndDate() const -> const DatePtr& { return end_date; }
+auto Campaign::getOtherType() const -> const OptionalInterned& { return this->other_type; }
+auto Campaign::getStartDate() const -> const OptionalDate& { return start_date; }
+auto Campaign::getEndDate() const -> const OptionalDate& { return end_date; }
 auto Campaign::getBudget() const -> const MoneyPtr& { return budget; }
 auto Campaign::getBudgetSpent() const -> const MoneyPtr& { return this->budget_spent; }
 auto Campaign::getTotalJoined() const -> const uint32_t& { return total_joined; }
@@ -55,20 +59,23 @@ auto Campaign::getTargetLeads() const -> const std::vector<CampaignLeadPtr>&
 {
     return target_leads;
 }
-auto Campaign::getChangeLogs() const -> const std::vector<ChangeLogPtr>& { return change_logs; }
+auto Campaign::getChangeLogs() const -> ChangeLogView
+{
+    return ChangeLogView(this->change_logs);
+}
 
 bool Campaign::setName(const std::string& name, const InternalEmployeePtr& changer)
 {
     if (this->name != name) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->name)),
-            std::make_optional(std::make_shared<std::string>(name)),
+            ChangeValue::fromText(this->name),
+            ChangeValue::fromText(name),
             CampaignFields::Name,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->name = name;
         return true;
     }
@@ -78,17 +85,17 @@ bool Campaign::setName(const std::string& name, const InternalEmployeePtr& chang
 bool Campaign::setType(CampaignType type, const InternalEmployeePtr& changer)
 {
     if (this->type != type) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->other_type
-                ? std::make_optional(std::make_shared<std::string>(this->other_type.value()))
+                ? ChangeValue::fromText(this->other_type.value())
                 : std::make_optional<ChangeLog::ValueVariant>(this->type),
             std::make_optional(type),
             CampaignFields::Name,
             this->other_type ? ChangeLog::FieldType::String : ChangeLog::FieldType::CampaignType,
             ChangeLog::FieldType::CampaignType,
             ChangeLog::Action::Change
-        ));
+        );
         this->type       = type;
         this->other_type = std::nullopt;
         return true;
@@ -99,66 +106,54 @@ bool Campaign::setType(CampaignType type, const InternalEmployeePtr& changer)
 bool Campaign::setOtherType(const OptionalStr& other_type, const InternalEmployeePtr& changer)
 {
     if (this->other_type != other_type) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->other_type
-                ? std::make_optional(std::make_shared<std::string>(this->other_type.value()))
+                ? ChangeValue::fromText(this->other_type.value())
                 : std::make_optional<ChangeLog::ValueVariant>(this->type),
-            std::make_optional(std::make_shared<std::string>(other_type.value())),
+            ChangeValue::fromText(other_type.value()),
             CampaignFields::Name,
             this->other_type ? ChangeLog::FieldType::String : ChangeLog::FieldType::CampaignType,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
-        this->other_type = other_type;
+        );
+        this->other_type = InternedStr::fromOptional(other_type);
         this->type       = CampaignType::other;
         return true;
     }
     return false;
 }
 
-bool Campaign::setStartDate(const DatePtr& start_date, const InternalEmployeePtr& changer)
+bool Campaign::setStartDate(const OptionalDate& start_date, const InternalEmployeePtr& changer)
 {
-    if (this->start_date == nullptr || start_date == nullptr) {
-        if (this->start_date == start_date) {
-            return false;
-        }
-    } else if (*this->start_date == *start_date) {
-        return false;
-    }
+    if (this->start_date == start_date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->start_date),
-        PTR_TO_OPTIONAL(start_date),
+        OPTIONAL_TO_VALUE(this->start_date),
+        OPTIONAL_TO_VALUE(start_date),
         CampaignFields::StartDate,
         this->start_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         start_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->start_date = start_date;
     return true;
 }
 
-bool Campaign::setEndDate(const DatePtr& end_date, const InternalEmployeePtr& changer)
+bool Campaign::setEndDate(const OptionalDate& end_date, const InternalEmployeePtr& changer)
 {
-    if (this->end_date == nullptr || end_date == nullptr) {
-        if (this->end_date == end_date) {
-            return false;
-        }
-    } else if (*this->end_date == *end_date) {
-        return false;
-    }
+    if (this->end_date == end_date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->end_date),
-        PTR_TO_OPTIONAL(end_date),
+        OPTIONAL_TO_VALUE(this->end_date),
+        OPTIONAL_TO_VALUE(end_date),
         CampaignFields::EndDate,
         this->end_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         end_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->end_date = end_date;
     return true;
 }
@@ -173,7 +168,7 @@ bool Campaign::setBudget(const MoneyPtr& budget, const InternalEmployeePtr& chan
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->budget),
         PTR_TO_OPTIONAL(budget),
@@ -181,7 +176,7 @@ bool Campaign::setBudget(const MoneyPtr& budget, const InternalEmployeePtr& chan
         this->budget ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         budget ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->budget = budget;
     return true;
 }
@@ -196,7 +191,7 @@ bool Campaign::setBudgetSpent(const MoneyPtr& budget_spent, const InternalEmploy
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->budget_spent),
         PTR_TO_OPTIONAL(budget_spent),
@@ -204,7 +199,7 @@ bool Campaign::setBudgetSpent(const MoneyPtr& budget_spent, const InternalEmploy
         this->budget_spent ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         budget_spent ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->budget_spent = budget_spent;
     return true;
 }
@@ -212,7 +207,7 @@ bool Campaign::setBudgetSpent(const MoneyPtr& budget_spent, const InternalEmploy
 bool Campaign::setTotalJoined(uint32_t total_joined, const InternalEmployeePtr& changer)
 {
     if (this->total_joined != total_joined) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->total_joined),
             std::make_optional(total_joined),
@@ -220,7 +215,7 @@ bool Campaign::setTotalJoined(uint32_t total_joined, const InternalEmployeePtr&
             ChangeLog::FieldType::Uint,
             ChangeLog::FieldType::Uint,
             ChangeLog::Action::Change
-        ));
+        );
         this->total_joined = total_joined;
         return true;
     }
@@ -230,7 +225,7 @@ bool Campaign::setTotalJoined(uint32_t total_joined, const InternalEmployeePtr&
 bool Campaign::setTotalConverted(uint32_t total_converted, const InternalEmployeePtr& changer)
 {
     if (this->total_converted != total_converted) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->total_converted),
             std::make_optional(total_converted),
@@ -238,7 +233,7 @@ bool Campaign::setTotalConverted(uint32_t total_converted, const InternalEmploye
             ChangeLog::FieldType::Uint,
             ChangeLog::FieldType::Uint,
             ChangeLog::Action::Change
-        ));
+        );
         this->total_converted = total_converted;
         return true;
     }
@@ -248,7 +243,7 @@ bool Campaign::setTotalConverted(uint32_t total_converted, const InternalEmploye
 bool Campaign::setCreator(const WeakInternalEmployee& creator, const InternalEmployeePtr& changer)
 {
     if (this->creator.owner_before(creator) || creator.owner_before(this->creator)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->creator),
             WEAK_PTR_TO_OPTIONAL(creator),
@@ -258,7 +253,7 @@ bool Campaign::setCreator(const WeakInternalEmployee& creator, const InternalEmp
             !creator.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->creator = creator;
         return true;
     }
@@ -270,7 +265,7 @@ bool Campaign::setConversionRate(
 )
 {
     if (this->conversion_rate != conversion_rate) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->conversion_rate ? std::make_optional(this->conversion_rate.value())
                                   : std::nullopt,
@@ -279,7 +274,7 @@ bool Campaign::setConversionRate(
             this->conversion_rate ? ChangeLog::FieldType::Double : ChangeLog::FieldType::null,
             conversion_rate ? ChangeLog::FieldType::Double : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->conversion_rate = conversion_rate;
         return true;
     }
@@ -289,7 +284,7 @@ bool Campaign::setConversionRate(
 bool Campaign::addNote(const Note& note, const InternalEmployeePtr& changer)
 {
     if (std::find(this->notes.begin(), this->notes.end(), note) == this->notes.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(std::make_shared<Note>(note)),
@@ -297,7 +292,7 @@ bool Campaign::addNote(const Note& note, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Note,
             ChangeLog::Action::Add
-        ));
+        );
         this->notes.push_back(note);
         return true;
     }
@@ -307,7 +302,7 @@ bool Campaign::addNote(const Note& note, const InternalEmployeePtr& changer)
 bool Campaign::delNote(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->notes.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<Note>(this->notes[index])),
             std::nullopt,
@@ -315,7 +310,7 @@ bool Campaign::delNote(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Note,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->notes.erase(this->notes.begin() + index);
         return true;
     }
@@ -328,7 +323,7 @@ bool Campaign::addTargetLeads(
 {
     if (std::find(this->target_leads.begin(), this->target_leads.end(), target_lead) ==
         this->target_leads.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(target_lead),
@@ -336,7 +331,7 @@ bool Campaign::addTargetLeads(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::CampaignLead,
             ChangeLog::Action::Add
-        ));
+        );
         this->target_leads.push_back(target_lead);
         return true;
     }
@@ -346,7 +341,7 @@ bool Campaign::addTargetLeads(
 bool Campaign::delTargetLeads(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->target_leads.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->target_leads[index]),
             std::nullopt,
@@ -354,7 +349,7 @@ bool Campaign::delTargetLeads(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::CampaignLead,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->target_leads.erase(this->target_leads.begin() + index);
         return true;
     }
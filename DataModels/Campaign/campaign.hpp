@@ -2,7 +2,9 @@
 #include <vector>
 
 #include "BigNum/big_uint.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "Note/note.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 
 enum class CampaignType : uint8_t { Email, SocialAds, Webinar, Event, other, COUNT };
@@ -16,8 +18,8 @@ public:
         const std::string&           name,
         const CampaignType&          type,
         const OptionalStr&           other_type,
-        const DatePtr&               start_date,
-        const DatePtr&               end_date,
+        const OptionalDate&          start_date,
+        const OptionalDate&          end_date,
         const MoneyPtr&              budget,
         const MoneyPtr&              budget_spent,
         const uint32_t&              total_joined,
@@ -26,7 +28,7 @@ public:
         const std::optional<double>& conversion_rate,
         std::vector<Note>            notes,
         std::vector<CampaignLeadPtr> target_leads,
-        std::vector<ChangeLogPtr>    change_logs
+        ChangeChain                  change_logs
     );
 
     /// @name Getters
@@ -34,9 +36,9 @@ public:
     auto getId() const -> const BigUint&;
     auto getName() const -> const std::string&;
     auto getType() const -> CampaignType;
-    auto getOtherType() const -> const OptionalStr&;
-    auto getStartDate() const -> const DatePtr&;
-    auto getEndDate() const -> const DatePtr&;
+    auto getOtherType() const -> const OptionalInterned&;
+    auto getStartDate() const -> const OptionalDate&;
+    auto getEndDate() const -> const OptionalDate&;
     auto getBudget() const -> const MoneyPtr&;
     auto getBudgetSpent() const -> const MoneyPtr&;
     auto getTotalJoined() const -> const uint32_t&;
@@ -45,7 +47,7 @@ public:
     auto getConversionRate() const -> const std::optional<double>&;
     auto getNotes() const -> const std::vector<Note>&;
     auto getTargetLeads() const -> const std::vector<CampaignLeadPtr>&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
     /// @}
 
     /// @name Setters
@@ -53,8 +55,8 @@ public:
     bool setName(const std::string& name, const InternalEmployeePtr& changer);
     bool setType(CampaignType type, const InternalEmployeePtr& changer);
     bool setOtherType(const OptionalStr& other_type, const InternalEmployeePtr& changer);
-    bool setStartDate(const DatePtr& start_date, const InternalEmployeePtr& changer);
-    bool setEndDate(const DatePtr& end_date, const InternalEmployeePtr& changer);
+    bool setStartDate(const OptionalDate& start_date, const InternalEmployeePtr& changer);
+    bool setEndDate(const OptionalDate& end_date, const InternalEmployeePtr& changer);
     bool setBudget(const MoneyPtr& budget, const InternalEmployeePtr& changer);
     bool setBudgetSpent(const MoneyPtr& budget_spent, const InternalEmployeePtr& changer);
     bool setTotalJoined(uint32_t total_joined, const InternalEmployeePtr& changer);
@@ -75,9 +77,9 @@ private:
     BigUint              id;
     std::string          name;
     CampaignType         type;
-    OptionalStr          other_type;
-    DatePtr              start_date;
-    DatePtr              end_date;
+    OptionalInterned     other_type;
+    OptionalDate         start_date;
+    OptionalDate         end_date;
     MoneyPtr             budget;
     MoneyPtr             budget_spent;
     uint32_t             total_joined    = 0;
@@ -87,5 +89,5 @@ private:
     std::optional<double>        conversion_rate;
     std::vector<Note>            notes;
     std::vector<CampaignLeadPtr> target_leads;
-    std::vector<ChangeLogPtr>    change_logs;
+    ChangeChain                  change_logs{EntityType::Campaign, id};
 };
\ No newline at end of file
@@ -6,13 +6,13 @@ CampaignLead::CampaignLead(const CampaignPtr& campaign, const WeakClientPtr& lea
 }
 
 CampaignLead::CampaignLead(
-    const CampaignPtr& campaign, const WeakClientPtr& lead, const DatePtr& joined_date
+    const CampaignPtr& campaign, const WeakClientPtr& lead, const OptionalDate& joined_date
 )
     : campaign(campaign), client(lead), joined_date(joined_date)
 {
 }
 
-void CampaignLead::setConvertDate(const DatePtr& date)
+void CampaignLead::setConvertDate(const OptionalDate& date)
 {
     if (this->converted_date != date) this->converted_date = date;
 }
@@ -24,8 +24,8 @@ void CampaignLead::setConversionValue(const std::optional<Money> value)
 
 auto CampaignLead::getCampaign() const -> const CampaignPtr& { return this->campaign; }
 auto CampaignLead::getLead() const -> const WeakClientPtr& { return this->client; }
-auto CampaignLead::getJoinedDate() const -> const DatePtr& { return this->joined_date; }
-auto CampaignLead::getConvertedDate() const -> const DatePtr& { return this->converted_date; }
+auto CampaignLead::getJoinedDate() const -> const OptionalDate& { return this->joined_date; }
+auto CampaignLead::getConvertedDate() const -> const OptionalDate& { return this->converted_date; }
 auto CampaignLead::getConversionValue() const -> const std::optional<Money>&
 {
     return this->conversion_value;
@@ -8,12 +8,12 @@ class CampaignLead {
 public:
     CampaignLead(const CampaignPtr& campaign, const WeakClientPtr& lead);
     CampaignLead(
-        const CampaignPtr& campaign, const WeakClientPtr& lead, const DatePtr& joined_date
+        const CampaignPtr& campaign, const WeakClientPtr& lead, const OptionalDate& joined_date
     );
 
     /// @name Change functions
     /// @{
-    void setConvertDate(const DatePtr& date);
+    void setConvertDate(const OptionalDate& date);
     void setConversionValue(const std::optional<Money> value);
     /// @}
 
@@ -21,16 +21,16 @@ public:
     /// @{
     auto getCampaign() const -> const CampaignPtr&;
     auto getLead() const -> const WeakClientPtr&;
-    auto getJoinedDate() const -> const DatePtr&;
-    auto getConvertedDate() const -> const DatePtr&;
+    auto getJoinedDate() const -> const OptionalDate&;
+    auto getConvertedDate() const -> const OptionalDate&;
     auto getConversionValue() const -> const std::optional<Money>&;
     /// @}
 
 private:
     CampaignPtr   campaign;
     WeakClientPtr client;
-    DatePtr       joined_date;
-    DatePtr       converted_date;
+    OptionalDate  joined_date;
+    OptionalDate  converted_date;
     //
     std::optional<Money> conversion_value;
 };
\ No newline at end of file
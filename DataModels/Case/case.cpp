@@ -1,6 +1,8 @@
 #include "case.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 
 Case::Case(const BigUint& id) : id(id), status(CaseStatus::Open) {}
 
@@ -11,7 +13,7 @@ Case::Case(
     const CaseStatus&               status,
     const Priority&                 priority,
     const Date&                     create_date,
-    const DatePtr&                  resolved_date,
+    const OptionalDate&             resolved_date,
     const WeakInternalEmployee&     assigned_to,
     const WeakClientPtr&            related_client,
     std::vector<Note>               notes,
@@ -36,7 +38,7 @@ auto Case::getDescription() const -> const OptionalStr& { return this->descripti
 auto Case::getStatus() const -> CaseStatus { return this->status; }
 auto Case::getPriority() const -> Priority { return this->priority; }
 auto Case::getCreatedDate() const -> const Date& { return this->create_date; }
-auto Case::getResolvedDate() const -> const DatePtr& { return this->resolved_date; }
+auto Case::getResolvedDate() const -> const OptionalDate& { return this->resolved_date; }
 auto Case::getAssignedTo() const -> const WeakInternalEmployee& { return this->assigned_to; }
 auto Case::getRelatedClient() const -> const WeakClientPtr& { return this->related_client; }
 auto Case::getNotes() const -> const std::vector<Note>& { return this->notes; }
@@ -44,20 +46,23 @@ auto Case::getRelatedInteractions() const -> const std::vector<BaseInteractionPt
 {
     return this->related_interactions;
 }
-auto Case::getChangeLogs() const -> const std::vector<ChangeLogPtr>& { return this->change_logs; }
+auto Case::getChangeLogs() const -> ChangeLogView
+{
+    return ChangeLogView(this->change_logs);
+}
 
 bool Case::setTitle(const std::string& title, const InternalEmployeePtr& changer)
 {
     if (this->title != title) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->title)),
-            std::make_optional(std::make_shared<std::string>(title)),
+            ChangeValue::fromText(this->title),
+            ChangeValue::fromText(title),
             CaseField::Title,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->title = title;
         return true;
     }
@@ -67,7 +72,7 @@ bool Case::setTitle(const std::string& title, const InternalEmployeePtr& changer
 bool Case::setDescription(const OptionalStr& description, const InternalEmployeePtr& changer)
 {
     if (this->description != description) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->description),
             OPTIONAL_STR_TO_VALUE(description),
@@ -75,7 +80,7 @@ bool Case::setDescription(const OptionalStr& description, const InternalEmployee
             this->description ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             description ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->description = description;
         return true;
     }
@@ -85,7 +90,7 @@ bool Case::setDescription(const OptionalStr& description, const InternalEmployee
 bool Case::setStatus(const CaseStatus& status, const InternalEmployeePtr& changer)
 {
     if (this->status != status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->status),
             std::make_optional(status),
@@ -93,7 +98,7 @@ bool Case::setStatus(const CaseStatus& status, const InternalEmployeePtr& change
             ChangeLog::FieldType::CaseStatus,
             ChangeLog::FieldType::CaseStatus,
             ChangeLog::Action::Change
-        ));
+        );
         this->status = status;
         return true;
     }
@@ -103,7 +108,7 @@ bool Case::setStatus(const CaseStatus& status, const InternalEmployeePtr& change
 bool Case::setPriority(const Priority& priority, const InternalEmployeePtr& changer)
 {
     if (this->priority != priority) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->priority),
             std::make_optional(priority),
@@ -111,32 +116,26 @@ bool Case::setPriority(const Priority& priority, const InternalEmployeePtr& chan
             ChangeLog::FieldType::Priority,
             ChangeLog::FieldType::Priority,
             ChangeLog::Action::Change
-        ));
+        );
         this->priority = priority;
         return true;
     }
     return false;
 }
 
-bool Case::setResolvedDate(const DatePtr& resolved_date, const InternalEmployeePtr& changer)
+bool Case::setResolvedDate(const OptionalDate& resolved_date, const InternalEmployeePtr& changer)
 {
-    if (this->resolved_date == nullptr || resolved_date == nullptr) {
-        if (this->resolved_date == resolved_date) {
-            return false;
-        }
-    } else if (*this->resolved_date == *resolved_date) {
-        return false;
-    }
+    if (this->resolved_date == resolved_date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->resolved_date),
-        PTR_TO_OPTIONAL(resolved_date),
+        OPTIONAL_TO_VALUE(this->resolved_date),
+        OPTIONAL_TO_VALUE(resolved_date),
         CaseField::ResolvedDate,
         this->resolved_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         resolved_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->resolved_date = resolved_date;
     return true;
 }
@@ -147,7 +146,7 @@ bool Case::setAssignedTo(
 {
     if (this->assigned_to.owner_before(assigned_to) ||
         assigned_to.owner_before(this->assigned_to)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->assigned_to),
             WEAK_PTR_TO_OPTIONAL(assigned_to),
@@ -157,7 +156,7 @@ bool Case::setAssignedTo(
             !assigned_to.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                    : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->assigned_to = assigned_to;
         return true;
     }
@@ -168,7 +167,7 @@ bool Case::setRelatedClient(const WeakClientPtr& related_client, const InternalE
 {
     if (this->related_client.owner_before(related_client) ||
         related_client.owner_before(this->related_client)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->related_client),
             WEAK_PTR_TO_OPTIONAL(related_client),
@@ -178,7 +177,7 @@ bool Case::setRelatedClient(const WeakClientPtr& related_client, const InternalE
             !related_client.expired() ? ChangeLog::FieldType::WeakClient
                                       : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->related_client = related_client;
         return true;
     }
@@ -188,7 +187,7 @@ bool Case::setRelatedClient(const WeakClientPtr& related_client, const InternalE
 bool Case::addNote(const Note& note, const InternalEmployeePtr& changer)
 {
     if (std::find(this->notes.begin(), this->notes.end(), note) == this->notes.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(std::make_shared<Note>(note)),
@@ -196,7 +195,7 @@ bool Case::addNote(const Note& note, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Note,
             ChangeLog::Action::Add
-        ));
+        );
         this->notes.push_back(note);
         return true;
     }
@@ -206,7 +205,7 @@ bool Case::addNote(const Note& note, const InternalEmployeePtr& changer)
 bool Case::delNote(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->notes.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<Note>(this->notes[index])),
             std::nullopt,
@@ -214,7 +213,7 @@ bool Case::delNote(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Note,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->notes.erase(this->notes.begin() + index);
         return true;
     }
@@ -228,7 +227,7 @@ bool Case::addRelatedInteraction(
     if (std::find(
             this->related_interactions.begin(), this->related_interactions.end(), interaction
         ) == this->related_interactions.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(interaction),
@@ -236,7 +235,7 @@ bool Case::addRelatedInteraction(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::BaseInteraction,
             ChangeLog::Action::Add
-        ));
+        );
         this->related_interactions.push_back(interaction);
         return true;
     }
@@ -246,7 +245,7 @@ bool Case::addRelatedInteraction(
 bool Case::delRelatedInteraction(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->related_interactions.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->related_interactions[index]),
             std::nullopt,
@@ -254,7 +253,7 @@ bool Case::delRelatedInteraction(size_t index, const InternalEmployeePtr& change
             ChangeLog::FieldType::BaseInteraction,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->related_interactions.erase(this->related_interactions.begin() + index);
         return true;
     }
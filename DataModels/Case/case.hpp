@@ -3,6 +3,7 @@
 #include <vector>
 
 #include "BigNum/big_uint.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "DateTime/date.hpp"
 #include "Interaction/priority.hpp"
 #include "Note/note.hpp"
@@ -20,7 +21,7 @@ public:
         const CaseStatus&               status,
         const Priority&                 priority,
         const Date&                     create_date,
-        const DatePtr&                  resolved_date,
+        const OptionalDate&             resolved_date,
         const WeakInternalEmployee&     assigned_to,
         const WeakClientPtr&            related_client,
         std::vector<Note>               notes,
@@ -35,12 +36,12 @@ public:
     auto getStatus() const -> CaseStatus;
     auto getPriority() const -> Priority;
     auto getCreatedDate() const -> const Date&;
-    auto getResolvedDate() const -> const DatePtr&;
+    auto getResolvedDate() const -> const OptionalDate&;
     auto getAssignedTo() const -> const WeakInternalEmployee&;
     auto getRelatedClient() const -> const WeakClientPtr&;
     auto getNotes() const -> const std::vector<Note>&;
     auto getRelatedInteractions() const -> const std::vector<BaseInteractionPtr>&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
     /// @}
 
     /// @name Change functions
@@ -49,7 +50,7 @@ public:
     bool setDescription(const OptionalStr& description, const InternalEmployeePtr& changer);
     bool setStatus(const CaseStatus& status, const InternalEmployeePtr& changer);
     bool setPriority(const Priority& priority, const InternalEmployeePtr& changer);
-    bool setResolvedDate(const DatePtr& resolved_date, const InternalEmployeePtr& changer);
+    bool setResolvedDate(const OptionalDate& resolved_date, const InternalEmployeePtr& changer);
     bool setAssignedTo(const WeakInternalEmployee& assigned_to, const InternalEmployeePtr& changer);
     bool setRelatedClient(const WeakClientPtr& related_client, const InternalEmployeePtr& changer);
     bool addNote(const Note& note, const InternalEmployeePtr& changer);
@@ -66,11 +67,11 @@ private:
     CaseStatus           status;
     Priority             priority;
     Date                 create_date = Date();
-    DatePtr              resolved_date;
+    OptionalDate         resolved_date;
     WeakInternalEmployee assigned_to;
     WeakClientPtr        related_client;
     std::vector<Note>    notes;
     //
     std::vector<BaseInteractionPtr> related_interactions;
-    std::vector<ChangeLogPtr>       change_logs;
+    ChangeChain                     change_logs{EntityType::Case, id};
 };
\ No newline at end of file
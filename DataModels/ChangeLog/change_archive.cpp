@@ -0,0 +1,501 @@
+#include "change_archive.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+
+#include "ChangeLog/lz_codec.hpp"
+#include "location.hpp"
+
+namespace {
+    constexpr uint64_t segment_magic = 0x33474553474E4843ULL;  // "CHNGSEG3"
+
+    constexpr uint8_t money_index =
+        static_cast<uint8_t>(change_value::alternative_index<std::shared_ptr<Money>>);
+    constexpr uint8_t phone_index =
+        static_cast<uint8_t>(change_value::alternative_index<std::shared_ptr<PhoneNumber>>);
+    constexpr uint8_t address_index =
+        static_cast<uint8_t>(change_value::alternative_index<std::shared_ptr<Address>>);
+    constexpr uint8_t tax_index =
+        static_cast<uint8_t>(change_value::alternative_index<std::shared_ptr<TaxInfo>>);
+    using StringPairPtr = std::shared_ptr<std::pair<const std::string, const std::string>>;
+    constexpr uint8_t pair_index =
+        static_cast<uint8_t>(change_value::alternative_index<StringPairPtr>);
+
+    using AddressText =
+        std::pair<const std::string& (Address::*)() const, void (Address::*)(const std::string&)>;
+    using AddressNumber = std::pair<
+        const std::optional<double> (Address::*)() const,
+        void (Address::*)(std::optional<double>)>;
+
+    /// Every field of an address, in the order they are archived
+    constexpr AddressText address_texts[] = {
+        {&Address::getCountry, &Address::setCountry},
+        {&Address::getCountryCode, &Address::setCountryCode},
+        {&Address::getRegion, &Address::setRegion},
+        {&Address::getRegionCode, &Address::setRegionCode},
+        {&Address::getCity, &Address::setCity},
+        {&Address::getDistrict, &Address::setDistrict},
+        {&Address::getDependentLocality, &Address::setDependentLocality},
+        {&Address::getStreet, &Address::setStreet},
+        {&Address::getHouse, &Address::setHouseNumber},
+        {&Address::getBuilding, &Address::setBuilding},
+        {&Address::getApartment, &Address::setApartment},
+        {&Address::getFloor, &Address::setFloor},
+        {&Address::getEntrance, &Address::setEntrance},
+        {&Address::getPostalCode, &Address::setPostalCode},
+        {&Address::getPoBox, &Address::setPoBox},
+        {&Address::getLandmark, &Address::setLandmark},
+        {&Address::getDirections, &Address::setDirections},
+        {&Address::getFormattedAddress, &Address::setFormattedAddress},
+        {&Address::getStandardFormat, &Address::setStandardFormat},
+    };
+    constexpr AddressNumber address_numbers[] = {
+        {&Address::getLatitude, &Address::setLatitude},
+        {&Address::getLongitude, &Address::setLongitude},
+        {&Address::getAltitude, &Address::setAltitude},
+    };
+
+    template <typename T>
+    void put(std::string& out, const T value)
+    {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void putText(std::string& out, const std::string_view text)
+    {
+        put(out, static_cast<uint32_t>(text.size()));
+        out.append(text);
+    }
+
+    /// Bounds-checked reader over a decompressed block or the index of a segment
+    struct Reader {
+        std::string_view data;
+        size_t           position = 0;
+
+        auto bytes(const size_t count) -> std::string_view
+        {
+            if (count > this->data.size() - this->position) {
+                throw std::runtime_error(errors::archive_corrupt);
+            }
+            std::string_view result = this->data.substr(this->position, count);
+            this->position += count;
+            return result;
+        }
+
+        template <typename T>
+        auto get() -> T
+        {
+            T value;
+            memcpy(&value, this->bytes(sizeof(T)).data(), sizeof(T));
+            return value;
+        }
+
+        auto text() -> std::string { return std::string(this->bytes(this->get<uint32_t>())); }
+    };
+
+    /// Object held by `value`, null if it is another alternative or a null pointer
+    template <typename T>
+    auto objectOf(const ChangeValue& value, const uint8_t index) -> const T*
+    {
+        if (value.getKind() != ChangeValue::Kind::Object || value.getAlternative() != index) {
+            return nullptr;
+        }
+        return static_cast<const std::shared_ptr<T>*>(value.getObject())->get();
+    }
+
+    /// Writes money as its units and currency, a phone number as its digits and an address, tax
+    /// info or string pair as its fields. False for every other object.
+    bool writeObject(std::string& out, const ChangeValue& value)
+    {
+        const uint8_t index = value.getAlternative();
+        std::string   body;
+        if (auto* money = objectOf<Money>(value, money_index)) {
+            put(body, money->getUnits());
+            put(body, ChangeValue(money->getCurrency()).getInteger());
+        } else if (auto* phone = objectOf<PhoneNumber>(value, phone_index)) {
+            char  digits[PhoneNumber::max_chars];
+            char* end = phone->toChars(digits, digits + sizeof(digits));
+            put(body, static_cast<uint8_t>(end - digits));
+            body.append(digits, end);
+        } else if (auto* address = objectOf<Address>(value, address_index)) {
+            for (const auto& [getter, setter] : address_texts) putText(body, (address->*getter)());
+            for (const auto& [getter, setter] : address_numbers) {
+                std::optional<double> number = (address->*getter)();
+                put(body, number.has_value());
+                put(body, number.value_or(0));
+            }
+            put(body, address->getIsValidated());
+        } else if (auto* tax = objectOf<TaxInfo>(value, tax_index)) {
+            putText(body, tax->tax_type);
+            put(body, tax->rate);
+            putText(body, tax->code);
+            put(body, tax->is_default);
+        } else if (auto* pair = objectOf<StringPairPtr::element_type>(value, pair_index)) {
+            putText(body, pair->first);
+            putText(body, pair->second);
+        } else {
+            return false;
+        }
+        put(out, ChangeValue::Kind::Object);
+        put(out, index);
+        out.append(body);
+        return true;
+    }
+
+    /// Writes the value as its kind, alternative and payload. Objects `writeObject` does not
+    /// know are parts of the live entity graph (people, deals, documents, ...) that cannot be
+    /// rebuilt from disk, so they are written as their text; the record keeps their `type`.
+    void writeValue(std::string& out, const ChangeLog::FieldType type, const ChangeValue& value)
+    {
+        ChangeValue::Kind kind = value.getKind();
+        if (kind == ChangeValue::Kind::Object) {
+            if (writeObject(out, value)) return;
+
+            std::string text;
+            if (type != ChangeLog::FieldType::null) {
+                ChangeLog::writeValue(text, type, *value.toVariant());
+            }
+            put(out, ChangeValue::Kind::Text);
+            put(out, static_cast<uint8_t>(change_value::alternative_index<StringPtr>));
+            putText(out, text);
+            return;
+        }
+
+        put(out, kind);
+        put(out, value.getAlternative());
+        if (kind == ChangeValue::Kind::Integer) {
+            put(out, value.getInteger());
+        } else if (kind == ChangeValue::Kind::Real) {
+            put(out, value.getReal());
+        } else if (kind == ChangeValue::Kind::Text) {
+            putText(out, value.getText());
+        }
+    }
+
+    void writeRecord(std::string& out, const ChangeChain::Offset offset, const ChangeRecord& record)
+    {
+        put(out, offset);
+        put(out, record.entity);
+        put(out, record.prev);
+        put(out, record.changer);
+        put(out, record.minutes);
+        put(out, record.field_kind);
+        put(out, record.field);
+        put(out, record.old_type);
+        put(out, record.new_type);
+        put(out, record.action);
+        put(out, record.tenant);
+        put(out, record.entity_type);
+        writeValue(out, record.old_type, record.old_value);
+        writeValue(out, record.new_type, record.new_value);
+    }
+}  // namespace
+
+auto RetentionPolicy::ruleFor(const uint8_t field_kind, const EntityType entity_type) const
+    -> const Rule*
+{
+    for (const Rule& rule : this->rules) {
+        if (rule.entity_type && *rule.entity_type != entity_type) continue;
+        if (field_kind < 32 && (rule.kinds & (1U << field_kind)) != 0) return &rule;
+    }
+    return nullptr;
+}
+
+auto ArchiveBlock::find(const ChangeChain::Offset offset) const -> const ChangeRecord*
+{
+    auto it = std::lower_bound(this->offsets.begin(), this->offsets.end(), offset);
+    if (it == this->offsets.end() || *it != offset) return nullptr;
+    return &this->records[it - this->offsets.begin()];
+}
+
+void ChangeArchive::write(
+    const std::filesystem::path& directory, const std::vector<Offset>& offsets, const Read& read
+)
+{
+    if (offsets.empty()) return;
+    if (directory.empty()) throw std::runtime_error(errors::archive_missing);
+    std::filesystem::create_directories(directory);
+
+    Segment segment;
+    auto    time = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    );
+    segment.path = directory / ("changes-" + std::to_string(time.count()) + "-" +
+                                std::to_string(std::random_device()()) + ".seg");
+    if (std::filesystem::exists(segment.path)) throw std::runtime_error(errors::archive_exists);
+
+    std::ofstream file(segment.path, std::ios::binary);
+    if (!file) throw std::runtime_error(errors::file_open_error);
+
+    std::string header;
+    put(header, segment_magic);
+    file.write(header.data(), static_cast<std::streamsize>(header.size()));
+    uint64_t position = header.size();
+
+    std::string raw;
+    BlockInfo   block{};
+    auto        flush = [&] {
+        std::string compressed = lz_codec::compress(raw);
+        block.compressed_size  = static_cast<uint32_t>(compressed.size());
+        block.size             = static_cast<uint32_t>(raw.size());
+        block.position         = position;
+        file.write(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+        position += compressed.size();
+        segment.blocks.push_back(block);
+        raw.clear();
+        block = BlockInfo{};
+    };
+
+    for (Offset offset : offsets) {
+        if (block.count == 0) block.first = offset;
+        block.last = offset;
+        block.count++;
+        writeRecord(raw, offset, read(offset));
+        if (raw.size() >= block_size) flush();
+    }
+    if (block.count != 0) flush();
+
+    std::string index;
+    put(index, static_cast<uint64_t>(segment.blocks.size()));
+    for (const BlockInfo& info : segment.blocks) put(index, info);
+    put(index, position);
+    put(index, segment_magic);
+    file.write(index.data(), static_cast<std::streamsize>(index.size()));
+    file.close();
+    if (!file) throw std::runtime_error(errors::file_open_error);
+
+    this->addSegment(std::move(segment));
+}
+
+void ChangeArchive::open(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) throw std::runtime_error(errors::file_open_error);
+
+    // header magic, blocks, block count, blocks' info, index position, magic
+    constexpr uint64_t trailer_size = 2 * sizeof(uint64_t);
+    const uint64_t     size         = static_cast<uint64_t>(file.tellg());
+    if (size < sizeof(segment_magic) + sizeof(uint64_t) + trailer_size) {
+        throw std::runtime_error(errors::archive_corrupt);
+    }
+    auto read = [&file](const uint64_t position, const uint64_t count) {
+        std::string bytes(count, '\0');
+        file.seekg(static_cast<std::streamoff>(position));
+        file.read(bytes.data(), static_cast<std::streamsize>(count));
+        if (!file) throw std::runtime_error(errors::archive_corrupt);
+        return bytes;
+    };
+
+    std::string header  = read(0, sizeof(segment_magic));
+    std::string trailer = read(size - trailer_size, trailer_size);
+    Reader      header_reader{header};
+    Reader      trailer_reader{trailer};
+    uint64_t    index_position = trailer_reader.get<uint64_t>();
+    if (header_reader.get<uint64_t>() != segment_magic ||
+        trailer_reader.get<uint64_t>() != segment_magic || index_position < sizeof(segment_magic) ||
+        index_position > size - trailer_size - sizeof(uint64_t)) {
+        throw std::runtime_error(errors::archive_corrupt);
+    }
+
+    std::string index = read(index_position, size - trailer_size - index_position);
+    Reader      reader{index};
+    uint64_t    count = reader.get<uint64_t>();
+    if (count != (index.size() - sizeof(uint64_t)) / sizeof(BlockInfo) ||
+        index.size() != sizeof(uint64_t) + count * sizeof(BlockInfo)) {
+        throw std::runtime_error(errors::archive_corrupt);
+    }
+
+    Segment segment;
+    segment.path = path;
+    segment.blocks.reserve(count);
+    uint64_t end = sizeof(segment_magic);  // blocks follow each other up to the index
+    for (uint64_t i = 0; i < count; i++) {
+        BlockInfo block = reader.get<BlockInfo>();
+        if (block.position != end || block.count == 0 || block.first > block.last ||
+            (!segment.blocks.empty() && block.first <= segment.blocks.back().last)) {
+            throw std::runtime_error(errors::archive_corrupt);
+        }
+        end += block.compressed_size;
+        segment.blocks.push_back(block);
+    }
+    if (end != index_position) throw std::runtime_error(errors::archive_corrupt);
+
+    this->addSegment(std::move(segment));
+}
+
+auto ChangeArchive::load(const Offset offset) const -> std::shared_ptr<const ArchiveBlock>
+{
+    // blocks of different segments may overlap, so every block starting at or before the offset
+    // is a candidate until their reach falls short of it
+    auto it = std::upper_bound(
+        this->blocks.begin(),
+        this->blocks.end(),
+        offset,
+        [](const Offset key, const BlockRef& ref) { return key < ref.first; }
+    );
+    while (it != this->blocks.begin()) {
+        --it;
+        if (it->reach < offset) break;
+        if (it->last < offset) continue;
+
+        auto block = this->loadBlock(it->segment, it->block);
+        if (block->find(offset) != nullptr) return block;
+    }
+    throw std::out_of_range(errors::unknown_change);
+}
+
+auto ChangeArchive::getSegments() const -> std::vector<std::filesystem::path>
+{
+    std::vector<std::filesystem::path> result;
+    result.reserve(this->segments.size());
+    for (const Segment& segment : this->segments) result.push_back(segment.path);
+    return result;
+}
+
+void ChangeArchive::addSegment(Segment&& segment)
+{
+    const uint32_t index = static_cast<uint32_t>(this->segments.size());
+    for (uint32_t b = 0; b < segment.blocks.size(); b++) {
+        const BlockInfo& info = segment.blocks[b];
+        this->blocks.push_back(BlockRef{info.first, info.last, info.last, index, b});
+    }
+    this->segments.push_back(std::move(segment));
+
+    std::sort(this->blocks.begin(), this->blocks.end(), [](const BlockRef& a, const BlockRef& b) {
+        return a.first < b.first;
+    });
+    Offset reach = 0;
+    for (BlockRef& ref : this->blocks) {
+        reach     = std::max(reach, ref.last);
+        ref.reach = reach;
+    }
+}
+
+auto ChangeArchive::loadBlock(const uint32_t segment, const uint32_t block) const
+    -> std::shared_ptr<const ArchiveBlock>
+{
+    std::lock_guard<std::mutex> lock(this->cache_mutex);
+    auto                        cached = std::find_if(
+        this->cache.begin(), this->cache.end(), [&](const CachedBlock& entry) {
+            return entry.segment == segment && entry.block == block;
+        }
+    );
+    if (cached != this->cache.end()) {
+        this->cache.splice(this->cache.begin(), this->cache, cached);
+    } else {
+        const Segment& info = this->segments[segment];
+        this->cache.push_front(CachedBlock{segment, block, readBlock(info, info.blocks[block])});
+        if (this->cache.size() > cache_size) this->cache.pop_back();
+    }
+    return this->cache.front().data;
+}
+
+auto ChangeArchive::readBlock(const Segment& segment, const BlockInfo& block)
+    -> std::shared_ptr<const ArchiveBlock>
+{
+    std::ifstream file(segment.path, std::ios::binary);
+    if (!file) throw std::runtime_error(errors::file_open_error);
+
+    std::string compressed(block.compressed_size, '\0');
+    file.seekg(static_cast<std::streamoff>(block.position));
+    file.read(compressed.data(), static_cast<std::streamsize>(compressed.size()));
+    if (!file) throw std::runtime_error(errors::archive_corrupt);
+
+    auto result  = std::make_shared<ArchiveBlock>();
+    result->data = lz_codec::decompress(compressed, block.size);
+    result->offsets.reserve(block.count);
+    result->records.reserve(block.count);
+
+    auto readValue = [&result](Reader& reader) {
+        ChangeValue value;
+        value.kind        = reader.get<ChangeValue::Kind>();
+        value.alternative = reader.get<uint8_t>();
+        if (value.kind == ChangeValue::Kind::Integer) {
+            value.integer = reader.get<int64_t>();
+        } else if (value.kind == ChangeValue::Kind::Real) {
+            value.real = reader.get<double>();
+        } else if (value.kind == ChangeValue::Kind::Text) {
+            value.size = reader.get<uint32_t>();
+            value.text = reader.bytes(value.size).data();
+        } else if (value.kind == ChangeValue::Kind::Object && value.alternative == money_index) {
+            auto        units = reader.get<Money::Units>();
+            ChangeValue currency;
+            currency.kind        = ChangeValue::Kind::Integer;
+            currency.alternative = change_value::alternative_index<Currencies>;
+            currency.integer     = reader.get<int64_t>();
+
+            auto& money = result->objects.emplace_back(std::make_shared<Money>(
+                units, std::get<Currencies>(*currency.toVariant())
+            ));
+            value.object = &std::get<std::shared_ptr<Money>>(money);
+        } else if (value.kind == ChangeValue::Kind::Object && value.alternative == phone_index) {
+            auto number = PhoneNumber::tryParse(reader.bytes(reader.get<uint8_t>()));
+            if (!number) throw std::runtime_error(errors::archive_corrupt);
+
+            auto& phone  = result->objects.emplace_back(std::make_shared<PhoneNumber>(*number));
+            value.object = &std::get<std::shared_ptr<PhoneNumber>>(phone);
+        } else if (value.kind == ChangeValue::Kind::Object && value.alternative == address_index) {
+            auto address = std::make_shared<Address>();
+            for (const auto& [getter, setter] : address_texts) ((*address).*setter)(reader.text());
+            for (const auto& [getter, setter] : address_numbers) {
+                bool   has    = reader.get<bool>();
+                double number = reader.get<double>();
+                ((*address).*setter)(has ? std::optional(number) : std::nullopt);
+            }
+            address->setIsValidated(reader.get<bool>());
+
+            auto& object = result->objects.emplace_back(std::move(address));
+            value.object = &std::get<std::shared_ptr<Address>>(object);
+        } else if (value.kind == ChangeValue::Kind::Object && value.alternative == tax_index) {
+            auto tax        = std::make_shared<TaxInfo>();
+            tax->tax_type   = reader.text();
+            tax->rate       = reader.get<double>();
+            tax->code       = reader.text();
+            tax->is_default = reader.get<bool>();
+
+            auto& object = result->objects.emplace_back(std::move(tax));
+            value.object = &std::get<std::shared_ptr<TaxInfo>>(object);
+        } else if (value.kind == ChangeValue::Kind::Object && value.alternative == pair_index) {
+            std::string first  = reader.text();
+            std::string second = reader.text();
+
+            auto& object = result->objects.emplace_back(
+                std::make_shared<StringPairPtr::element_type>(std::move(first), std::move(second))
+            );
+            value.object = &std::get<StringPairPtr>(object);
+        } else if (value.kind != ChangeValue::Kind::Empty) {
+            throw std::runtime_error(errors::archive_corrupt);
+        }
+        return value;
+    };
+
+    Reader reader{result->data};
+    for (uint32_t i = 0; i < block.count; i++) {
+        ChangeRecord record;
+        Offset       offset = reader.get<Offset>();
+        record.entity       = reader.get<uint32_t>();
+        record.prev         = reader.get<Offset>();
+        record.changer      = reader.get<uint32_t>();
+        record.minutes      = reader.get<int32_t>();
+        record.field_kind   = reader.get<uint8_t>();
+        record.field        = reader.get<uint8_t>();
+        record.old_type     = reader.get<ChangeLog::FieldType>();
+        record.new_type     = reader.get<ChangeLog::FieldType>();
+        record.action       = reader.get<ChangeLog::Action>();
+        record.tenant       = reader.get<uint16_t>();
+        record.entity_type  = reader.get<EntityType>();
+        record.old_value    = readValue(reader);
+        record.new_value    = readValue(reader);
+        record.archived     = true;
+        result->offsets.push_back(offset);
+        result->records.push_back(record);
+    }
+    if (reader.position != result->data.size()) throw std::runtime_error(errors::archive_corrupt);
+    return result;
+}
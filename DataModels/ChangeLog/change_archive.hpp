@@ -0,0 +1,136 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <filesystem>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ChangeLog/change_kind.hpp"
+#include "ChangeLog/change_record.hpp"
+#include "DateTime/time_duration.hpp"
+
+/**
+ * @struct RetentionPolicy
+ * @brief How much history `ChangeJournal::compact` keeps in memory.
+ *
+ * A record goes to disk when the first rule covering its field kind and entity type finds it
+ * older than `max_age`, or finds `max_count` newer records of the same entity. Records no rule
+ * covers stay in memory. Clients and employees share `PersonFields`, so rules tell them apart
+ * by `entity_type`. Archived records are still found by audit queries unless their rule is not
+ * `searchable`.
+ */
+struct RetentionPolicy {
+    struct Rule {
+        uint32_t                    kinds = change_kind::all;  ///< `change_kind` mask
+        std::optional<EntityType>   entity_type;               ///< Empty for every type
+        std::optional<TimeDuration> max_age;
+        std::optional<uint32_t>     max_count;
+        bool searchable = true;  ///< False takes the archived records out of the audit index
+    };
+
+    std::filesystem::path directory;  ///< Where segments are written
+    std::vector<Rule>     rules;
+
+    auto ruleFor(const uint8_t field_kind, const EntityType entity_type) const -> const Rule*;
+};
+
+/**
+ * @struct ArchiveBlock
+ * @brief Records of one segment block, decoded.
+ *
+ * Text values point into `data`; money, phone numbers, addresses, tax info and string pairs into
+ * `objects`, where they are rebuilt. Other objects are parts of the live entity graph (people,
+ * deals, documents, ...) that cannot be rebuilt from disk: they were written as their text and
+ * come back as a `StringPtr`, still under the `FieldType` they were recorded with.
+ */
+struct ArchiveBlock {
+    std::string                         data;
+    std::deque<ChangeLog::ValueVariant> objects;  // a deque never moves its elements
+    std::vector<ChangeChain::Offset>    offsets;  // ascending
+    std::vector<ChangeRecord>           records;
+
+    auto find(const ChangeChain::Offset offset) const -> const ChangeRecord*;
+};
+
+/**
+ * @class ChangeArchive
+ * @brief Segment files of the records `ChangeJournal::compact` moved out of memory.
+ *
+ * A segment is a header, blocks of about `block_size` bytes of records compressed with
+ * `lz_codec`, and the index of its blocks. Indexes stay in memory (about 50 bytes per block), so
+ * a record is paged in with one read, and the last `cache_size` blocks read are kept. The blocks
+ * of every segment are kept sorted by their first offset, so finding one is a binary search.
+ *
+ * Segments use the byte order of the host. `open` reads the index of a segment back, e.g. after
+ * a restart. Offsets are those of the journal that wrote the segment, so an archive should only
+ * open the segments of one journal.
+ */
+class ChangeArchive {
+public:
+    using Offset = ChangeChain::Offset;
+    using Read   = std::function<const ChangeRecord&(Offset)>;
+
+    static constexpr size_t block_size = 64 * 1024;
+    static constexpr size_t cache_size = 8;
+
+    ChangeArchive()                                = default;
+    ChangeArchive(const ChangeArchive&)            = delete;
+    ChangeArchive& operator=(const ChangeArchive&) = delete;
+
+    /// Writes the records of `offsets`, ascending, into a new segment in `directory`. Segment
+    /// names carry the time and a random tag, so archives sharing a directory, in this process
+    /// or another, never pick the same one; an existing file is never overwritten.
+    void write(
+        const std::filesystem::path& directory, const std::vector<Offset>& offsets, const Read& read
+    );
+    /// Adds a segment `write` made, in this process or an earlier one. Throws
+    /// `std::runtime_error` if the file is not a whole segment.
+    void open(const std::filesystem::path& path);
+    /// Block holding `offset`; throws `std::out_of_range` if no segment has it
+    auto load(const Offset offset) const -> std::shared_ptr<const ArchiveBlock>;
+    auto getSegments() const -> std::vector<std::filesystem::path>;
+
+private:
+    struct BlockInfo {
+        Offset   first;
+        Offset   last;
+        uint32_t count;
+        uint32_t compressed_size;
+        uint32_t size;
+        uint64_t position;
+    };
+    struct Segment {
+        std::filesystem::path  path;
+        std::vector<BlockInfo> blocks;
+    };
+    struct BlockRef {
+        Offset   first;
+        Offset   last;
+        Offset   reach;  // greatest `last` of this and every earlier block
+        uint32_t segment;
+        uint32_t block;
+    };
+    struct CachedBlock {
+        uint32_t                            segment;
+        uint32_t                            block;
+        std::shared_ptr<const ArchiveBlock> data;
+    };
+
+    std::vector<Segment>           segments;
+    std::vector<BlockRef>          blocks;  // of every segment, by `first`
+    mutable std::mutex             cache_mutex;
+    mutable std::list<CachedBlock> cache;  // most recent first
+
+    void addSegment(Segment&& segment);
+    auto loadBlock(const uint32_t segment, const uint32_t block) const
+        -> std::shared_ptr<const ArchiveBlock>;
+    static auto readBlock(const Segment& segment, const BlockInfo& block)
+        -> std::shared_ptr<const ArchiveBlock>;
+};
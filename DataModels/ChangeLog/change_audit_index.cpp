@@ -0,0 +1,144 @@
+#include "change_audit_index.hpp"
+
+#include <algorithm>
+
+namespace {
+    constexpr int32_t minutes_per_day = 24 * 60;
+
+    auto dayOf(const int32_t minutes) -> int32_t
+    {
+        // rounds down for dates before the epoch too
+        int64_t value = minutes;
+        return static_cast<int32_t>(
+            value >= 0 ? value / minutes_per_day : (value - minutes_per_day + 1) / minutes_per_day
+        );
+    }
+
+    bool before(const ChangeAuditIndex::Entry& entry, const int32_t minutes, const uint32_t offset)
+    {
+        return entry.minutes < minutes || (entry.minutes == minutes && entry.offset < offset);
+    }
+}  // namespace
+
+void ChangeAuditIndex::add(const Entry& entry, const uint16_t tenant, const BigUint* changer)
+{
+    Tenant&                             index = this->tenantOf(tenant);
+    std::unique_lock<std::shared_mutex> lock(index.mutex);
+    insert(index.changes, entry);
+    if (changer != nullptr) insert(index.by_changer[*changer], entry);
+    this->count++;
+}
+
+void ChangeAuditIndex::remove(const Entry& entry, const uint16_t tenant, const BigUint* changer)
+{
+    Tenant&                             index = this->tenantOf(tenant);
+    std::unique_lock<std::shared_mutex> lock(index.mutex);
+    if (!erase(index.changes, entry)) return;
+    if (changer != nullptr) {
+        auto timeline = index.by_changer.find(*changer);
+        if (timeline != index.by_changer.end()) erase(timeline->second, entry);
+    }
+    this->count--;
+}
+
+auto ChangeAuditIndex::query(const AuditQuery& query, const uint16_t tenant) const -> AuditPage
+{
+    AuditPage page;
+    const Tenant* index = this->findTenant(tenant);
+    if (query.limit == 0 || index == nullptr) return page;
+
+    std::shared_lock<std::shared_mutex> lock(index->mutex);
+    const Timeline*                     timeline = &index->changes;
+    if (query.changer) {
+        auto it = index->by_changer.find(*query.changer);
+        if (it == index->by_changer.end()) return page;
+        timeline = &it->second;
+    }
+
+    // first position to return: right after the cursor, or the start of the range
+    int32_t  minutes = query.from ? query.from->getMinutes() : INT32_MIN;
+    uint32_t offset  = 0;
+    if (query.after &&
+        !before(Entry{query.after->minutes, query.after->offset, 0, 0, {}}, minutes, 0)) {
+        minutes = query.after->minutes;
+        offset  = query.after->offset + 1;
+    }
+    int32_t last = query.to ? query.to->getMinutes() : INT32_MAX;
+
+    uint8_t field_kind = 0;
+    uint8_t field      = 0;
+    if (query.field) {
+        field_kind = static_cast<uint8_t>(query.field->index());
+        field = std::visit([](auto value) { return static_cast<uint8_t>(value); }, *query.field);
+    }
+
+    for (auto day = timeline->lower_bound(dayOf(minutes)); day != timeline->end(); ++day) {
+        const auto& entries = day->second;
+        auto        it      = std::partition_point(entries.begin(), entries.end(), [&](auto& e) {
+            return before(e, minutes, offset);
+        });
+        for (; it != entries.end(); ++it) {
+            if (it->minutes > last) return page;
+            if (((query.kinds >> it->kind) & 1) == 0) continue;
+            if (query.entity_type && it->type != *query.entity_type) continue;
+            if (query.field && (it->kind != field_kind || it->field != field)) continue;
+
+            page.offsets.push_back(it->offset);
+            if (page.offsets.size() == query.limit) {
+                page.next = AuditCursor{it->minutes, it->offset};
+                return page;
+            }
+        }
+    }
+    return page;
+}
+
+auto ChangeAuditIndex::size() const -> size_t { return this->count; }
+
+auto ChangeAuditIndex::tenantOf(const uint16_t tenant) -> Tenant&
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        auto                                it = this->tenants.find(tenant);
+        if (it != this->tenants.end()) return it->second;
+    }
+    // nodes of an unordered_map never move, the tenant outlives the lock
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    return this->tenants.try_emplace(tenant).first->second;
+}
+
+auto ChangeAuditIndex::findTenant(const uint16_t tenant) const -> const Tenant*
+{
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    auto                                it = this->tenants.find(tenant);
+    return it == this->tenants.end() ? nullptr : &it->second;
+}
+
+void ChangeAuditIndex::insert(Timeline& timeline, const Entry& entry)
+{
+    auto& entries = timeline[dayOf(entry.minutes)];
+    if (entries.empty() || before(entries.back(), entry.minutes, entry.offset)) {
+        entries.push_back(entry);
+        return;
+    }
+    auto it = std::partition_point(entries.begin(), entries.end(), [&](auto& e) {
+        return before(e, entry.minutes, entry.offset);
+    });
+    entries.insert(it, entry);
+}
+
+bool ChangeAuditIndex::erase(Timeline& timeline, const Entry& entry)
+{
+    auto day = timeline.find(dayOf(entry.minutes));
+    if (day == timeline.end()) return false;
+
+    auto& entries = day->second;
+    auto  it      = std::partition_point(entries.begin(), entries.end(), [&](auto& e) {
+        return before(e, entry.minutes, entry.offset);
+    });
+    if (it == entries.end() || it->offset != entry.offset) return false;
+
+    entries.erase(it);
+    if (entries.empty()) timeline.erase(day);
+    return true;
+}
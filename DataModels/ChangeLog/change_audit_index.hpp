@@ -0,0 +1,97 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "BigNum/big_uint.hpp"
+#include "ChangeLog/change_chain.hpp"
+#include "ChangeLog/change_kind.hpp"
+
+/// Position in the audit order (change date, then journal offset) a page ended at
+struct AuditCursor {
+    int32_t             minutes;
+    ChangeChain::Offset offset;
+};
+
+/**
+ * @struct AuditQuery
+ * @brief Changes to look up in `ChangeAuditIndex`, every filter is optional.
+ */
+struct AuditQuery {
+    std::optional<BigUint>                 changer;  ///< Id of the changer, empty for anyone
+    std::optional<Date>                    from;     ///< Inclusive
+    std::optional<Date>                    to;       ///< Inclusive
+    uint32_t                               kinds = change_kind::all;  ///< `change_kind` mask
+    /// Type of the changed entity, empty for every type; tells clients from employees, whose
+    /// person fields share a kind
+    std::optional<EntityType>              entity_type;
+    std::optional<ChangeLog::FieldVariant> field;
+    size_t                                 limit = 100;
+    std::optional<AuditCursor>             after;  ///< `AuditPage::next` of the previous page
+};
+
+struct AuditPage {
+    std::vector<ChangeChain::Offset> offsets;  ///< Oldest first
+    std::optional<AuditCursor>       next;     ///< Set when the page is full
+};
+
+/**
+ * @class ChangeAuditIndex
+ * @brief Index of the journal's changes by tenant, date and changer.
+ *
+ * Every change is kept in day buckets sorted by (date, offset), once in the timeline of all
+ * changes of its tenant and once in the timeline of its changer there. Changers are keyed by
+ * id, so an employee loaded again keeps their history. A bucket only grows by its own changes, so
+ * changes with old dates are cheap to insert and no list ever has to move as a whole. The
+ * field kind, field and entity type are stored next to the offset, so filters never read the
+ * journal.
+ * Pages continue after the cursor of the previous one and are not disturbed by new changes.
+ * Each tenant has a lock of its own, so tenants add and query changes without waiting for each
+ * other.
+ */
+class ChangeAuditIndex {
+public:
+    struct Entry {
+        int32_t             minutes;
+        ChangeChain::Offset offset;
+        uint8_t             kind;
+        uint8_t             field;
+        EntityType          type;  ///< Fills padding, an entry stays 12 bytes
+    };
+
+    /// `changer` is null for changes by nobody
+    void add(const Entry& entry, const uint16_t tenant, const BigUint* changer);
+    /// Removes an entry added with the same tenant and changer; does nothing if there is none
+    void remove(const Entry& entry, const uint16_t tenant, const BigUint* changer);
+    /// Changes of `tenant` only
+    auto query(const AuditQuery& query, const uint16_t tenant) const -> AuditPage;
+    auto size() const -> size_t;
+
+private:
+    using Timeline = std::map<int32_t, std::vector<Entry>>;  // by day
+
+    struct Tenant {
+        mutable std::shared_mutex             mutex;
+        Timeline                              changes;
+        std::unordered_map<BigUint, Timeline> by_changer;
+    };
+
+    mutable std::shared_mutex            mutex;  // only guards the map of tenants
+    std::unordered_map<uint16_t, Tenant> tenants;
+    std::atomic<size_t>                  count = 0;
+
+    /// Index of `tenant`, added if it has none
+    auto tenantOf(const uint16_t tenant) -> Tenant&;
+    /// Index of `tenant`, null if it has none
+    auto findTenant(const uint16_t tenant) const -> const Tenant*;
+
+    static void insert(Timeline& timeline, const Entry& entry);
+    static bool erase(Timeline& timeline, const Entry& entry);
+};
@@ -0,0 +1,149 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "BigNum/big_uint.hpp"
+#include "Usings/type_usings.hpp"
+
+class EntityState;
+class InitialState;
+
+/// Type of the entity a `ChangeChain` belongs to
+enum class EntityType : uint8_t {
+    other,
+    Person,
+    Client,
+    InternalEmployee,
+    ExternalEmployee,
+    Deal,
+    Task,
+    Interaction,
+    InteractionResult,
+    Payment,
+    Document,
+    Company,
+    Campaign,
+    Case,
+    Report,
+    File,
+    COUNT
+};
+
+/**
+ * @struct ChangeChain
+ * @brief Handle of one entity's history inside the `ChangeJournal`.
+ *
+ * The journal links the records of an entity from the newest to the oldest, so the entity only
+ * keeps the offset of its newest record and the number of records. It also knows the type and
+ * id of its entity, which the journal hands on with each change. The chain owns that history:
+ * the journal drops its records when the chain is destroyed, whichever way its entity goes, and a
+ * copy of the chain gets a copy of the records.
+ */
+struct ChangeChain {
+    using Offset                 = uint32_t;
+    static constexpr Offset npos = UINT32_MAX;
+
+    uint32_t entity = npos;  ///< Assigned by the journal with the first record
+    Offset   head   = npos;  ///< Newest record
+    uint32_t count  = 0;
+    EntityType type = EntityType::other;  ///< Type of the entity the chain belongs to
+    BigUint    id;                        ///< Id of that entity
+
+    ChangeChain() = default;
+    explicit ChangeChain(const EntityType type, const BigUint& id = BigUint());
+    ChangeChain(ChangeChain&& other) noexcept;
+    ChangeChain& operator=(ChangeChain&& other);
+    ChangeChain(const ChangeChain& other);
+    ChangeChain& operator=(const ChangeChain& other);
+    /// Drops the records of the chain from the journal. Special members are defined in
+    /// change_journal.cpp.
+    ~ChangeChain();
+
+    /// Records a change, takes the arguments of the `ChangeLog` constructor.
+    /// Defined in change_journal.hpp.
+    template <typename... Args>
+    void append(Args&&... args);
+};
+
+/**
+ * @class ChangeLogView
+ * @brief Read-only history of one entity, oldest entry first.
+ *
+ * Entries are built from the journal records when they are read, the view holds the head and
+ * the count of the chain as they were when it was made. The first access to an entry other than
+ * the newest walks the chain once and keeps the offsets, so indexing and iterating are O(1) per
+ * entry after that. A view is not meant to be
+ * shared between threads.
+ */
+class ChangeLogView {
+public:
+    class Iterator;
+
+    explicit ChangeLogView(const ChangeChain& chain);
+
+    auto size() const -> size_t;
+    auto empty() const -> bool;
+    auto front() const -> ChangeLogPtr;
+    auto back() const -> ChangeLogPtr;
+    auto operator[](const size_t index) const -> ChangeLogPtr;
+    /// Journal offsets of every entry, oldest first
+    auto offsets() const -> std::vector<ChangeChain::Offset>;
+
+    auto begin() const -> Iterator;
+    auto end() const -> Iterator;
+
+private:
+    ChangeChain::Offset                      head;
+    uint32_t                                 count;
+    mutable std::vector<ChangeChain::Offset> cached_offsets;  // empty until first needed
+
+    auto offsetAt(const size_t index) const -> ChangeChain::Offset;
+};
+
+/// Walks the entries of a `ChangeLogView` in either direction, building each when it is read
+class ChangeLogView::Iterator {
+public:
+    using iterator_concept  = std::bidirectional_iterator_tag;
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = ChangeLogPtr;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = ChangeLogPtr;
+
+    Iterator() = default;
+    Iterator(const ChangeLogView* view, const size_t index) : view(view), index(index) {}
+
+    auto operator*() const -> ChangeLogPtr { return (*this->view)[this->index]; }
+
+    auto operator++() -> Iterator&
+    {
+        ++this->index;
+        return *this;
+    }
+    auto operator++(int) -> Iterator
+    {
+        Iterator previous = *this;
+        ++this->index;
+        return previous;
+    }
+    auto operator--() -> Iterator&
+    {
+        --this->index;
+        return *this;
+    }
+    auto operator--(int) -> Iterator
+    {
+        Iterator previous = *this;
+        --this->index;
+        return previous;
+    }
+
+    bool operator==(const Iterator& other) const { return this->index == other.index; }
+
+private:
+    const ChangeLogView* view  = nullptr;
+    size_t               index = 0;
+};
@@ -0,0 +1,638 @@
+#include "change_journal.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+
+#include "ChangeLog/change_stream.hpp"
+#include "UserSession/session_manager.hpp"
+#include "location.hpp"
+
+namespace {
+    using FieldVariant = ChangeLog::FieldVariant;
+    using FieldDecoder = FieldVariant (*)(uint8_t);
+
+    template <size_t... I>
+    constexpr auto makeFieldDecoders(std::index_sequence<I...>)
+    {
+        return std::array<FieldDecoder, sizeof...(I)>{[](uint8_t value) {
+            using Field = std::variant_alternative_t<I, FieldVariant>;
+            return FieldVariant(std::in_place_index<I>, static_cast<Field>(value));
+        }...};
+    }
+
+    /// Rebuilds the field from `Record::field_kind` and `Record::field`
+    constexpr auto field_decoders =
+        makeFieldDecoders(std::make_index_sequence<std::variant_size_v<FieldVariant>>());
+
+    thread_local uint16_t current_tenant = 0;
+}  // namespace
+
+ChangeJournal& ChangeJournal::getInstance()
+{
+    // never destroyed: entities kept in its values, or by other statics, drop their chains
+    // into it while the program exits
+    static ChangeJournal* instance = new ChangeJournal();
+    return *instance;
+}
+
+auto ChangeJournal::append(
+    ChangeChain&                           chain,
+    const std::weak_ptr<InternalEmployee>& changer,
+    const ChangeValue&                     old_value,
+    const ChangeValue&                     new_value,
+    const ChangeLog::FieldVariant          field,
+    const ChangeLog::FieldType             old_field_type,
+    const ChangeLog::FieldType             new_field_type,
+    const ChangeLog::Action                action,
+    const Date                             change_date
+) -> Offset
+{
+    Record record;
+    record.changer    = this->addChanger(changer);
+    record.minutes    = change_date.getMinutes();
+    record.field_kind = static_cast<uint8_t>(field.index());
+    record.field      = std::visit([](auto value) { return static_cast<uint8_t>(value); }, field);
+    record.old_type   = old_field_type;
+    record.new_type   = new_field_type;
+    record.action     = action;
+    record.tenant     = current_tenant;
+
+    Offset offset = this->store(chain, record, old_value, new_value, true);
+    SessionManager::getInstance().addChangeToSession(offset, record.field_kind, chain.type);
+    ChangeStream::getInstance().publish(
+        ChangeEvent::change(offset, chain, record.field_kind, record.minutes)
+    );
+    return offset;
+}
+
+auto ChangeJournal::compact(const RetentionPolicy& policy, const Date& now) -> size_t
+{
+    Garbage                             garbage;  // outlives the lock
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+
+    bool counted = std::any_of(policy.rules.begin(), policy.rules.end(), [](const auto& rule) {
+        return rule.max_count.has_value();
+    });
+    int64_t                                now_minutes = now.getMinutes();
+    std::unordered_map<uint32_t, uint32_t> newer;  // records seen so far by entity
+    std::vector<Offset>                    selected;
+
+    // newest first, so the records counted for an entity are the ones after the current one
+    for (size_t i = this->records.size(); i > 0; i--) {
+        Offset offset = static_cast<Offset>(i - 1);
+        if (!this->records.loaded(offset)) continue;  // archived as a whole
+
+        const Record& record = this->records[offset];
+        uint32_t      count  = counted ? newer[record.entity]++ : 0;
+        if (record.archived) continue;
+
+        const RetentionPolicy::Rule* rule = policy.ruleFor(record.field_kind, record.entity_type);
+        if (rule == nullptr) continue;
+        bool too_old =
+            rule->max_age && (now_minutes - record.minutes) * 60 > rule->max_age->getSeconds();
+        bool too_many = rule->max_count && count >= *rule->max_count;
+        if (too_old || too_many) selected.push_back(offset);
+    }
+    if (selected.empty()) return 0;
+
+    std::reverse(selected.begin(), selected.end());
+    this->archive.write(policy.directory, selected, [this](Offset offset) -> const Record& {
+        return this->records[offset];
+    });
+
+    for (Offset offset : selected) {
+        Record& record  = this->records[offset];
+        record.archived = true;
+        this->archived_counts[offset / records_per_chunk]++;
+        if (!policy.ruleFor(record.field_kind, record.entity_type)->searchable) {
+            auto changer_key = this->changerKey(record);
+            this->audit.remove(
+                {record.minutes, offset, record.field_kind, record.field, record.entity_type},
+                record.tenant,
+                changer_key ? &*changer_key : nullptr
+            );
+        }
+    }
+    std::lock_guard<std::mutex> checkpoint_lock(this->checkpoint_mutex);
+    this->trimCheckpoints(garbage);
+    this->releaseChunks(garbage);
+    return selected.size();
+}
+
+void ChangeJournal::drop(ChangeChain& chain)
+{
+    Garbage                             garbage;  // outlives the lock
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+
+    for (Offset offset = chain.head; offset != ChangeChain::npos;) {
+        Offset prev = ChangeChain::npos;
+        this->readLocked(offset, [&](const Record& record, const auto&) {
+            prev             = record.prev;
+            auto changer_key = this->changerKey(record);
+            this->audit.remove(
+                {record.minutes, offset, record.field_kind, record.field, record.entity_type},
+                record.tenant,
+                changer_key ? &*changer_key : nullptr
+            );
+        });
+        if (this->records.loaded(offset) && !this->records[offset].archived) {
+            Record& record   = this->records[offset];
+            record.old_value = ChangeValue();
+            record.new_value = ChangeValue();
+            record.archived  = true;  // nothing to write, the chunk just stops waiting for it
+            this->archived_counts[offset / records_per_chunk]++;
+        }
+        offset = prev;
+    }
+    {
+        std::lock_guard<std::mutex> checkpoint_lock(this->checkpoint_mutex);
+        auto                        it = this->checkpoints.find(chain.entity);
+        if (it != this->checkpoints.end()) {
+            std::move(
+                it->second.begin(), it->second.end(), std::back_inserter(garbage.checkpoints)
+            );
+            this->checkpoints.erase(it);
+        }
+    }
+    this->releaseChunks(garbage);
+    chain.entity = ChangeChain::npos;
+    chain.head   = ChangeChain::npos;
+    chain.count  = 0;
+}
+
+void ChangeJournal::copy(const ChangeChain& source, ChangeChain& target)
+{
+    // the storage keeps the values alive once the lock is gone
+    std::vector<std::pair<Record, std::shared_ptr<const void>>> copies(source.count);
+    {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        Offset                              offset = source.head;
+        for (size_t i = copies.size(); i > 0; i--) {
+            this->readLocked(offset, [&](const Record& record, const auto& storage) {
+                copies[i - 1] = {record, storage};
+            });
+            offset = copies[i - 1].first.prev;
+        }
+    }
+
+    std::optional<Checkpoint> initial;
+    {
+        std::lock_guard<std::mutex> lock(this->checkpoint_mutex);
+        auto                        it = this->checkpoints.find(source.entity);
+        if (it != this->checkpoints.end() && !it->second.empty() &&
+            it->second.front().offset == ChangeChain::npos) {
+            initial = it->second.front();
+        }
+    }
+    if (initial && target.head == ChangeChain::npos) {
+        if (target.entity == ChangeChain::npos) target.entity = this->entity_count++;
+        std::lock_guard<std::mutex> lock(this->checkpoint_mutex);
+        auto&                       list = this->checkpoints[target.entity];
+        if (list.empty()) list.push_back(std::move(*initial));
+    }
+
+    for (const auto& [record, storage] : copies) {
+        this->store(target, record, record.old_value, record.new_value, false);
+    }
+}
+
+void ChangeJournal::setInitialState(ChangeChain& chain, InitialState state)
+{
+    if (chain.head != ChangeChain::npos) return;
+    if (chain.entity == ChangeChain::npos) chain.entity = this->entity_count++;
+
+    std::lock_guard<std::mutex> lock(this->checkpoint_mutex);
+    auto& list = this->checkpoints[chain.entity];
+    if (!list.empty()) return;
+    state.state.retain(std::move(state.store));
+    list.push_back(Checkpoint{ChangeChain::npos, state.minutes, std::move(state.state)});
+}
+
+auto ChangeJournal::getRecord(const Offset offset) const -> Record
+{
+    Record result;
+    this->readRecord(offset, [&](const Record& record) { result = record; });
+    return result;
+}
+
+auto ChangeJournal::getEntry(const Offset offset) const -> ChangeLogPtr
+{
+    ChangeLogPtr entry;
+    this->readRecord(offset, [&](const Record& record) {
+        entry = std::make_shared<ChangeLog>(
+            this->getChanger(record),
+            record.old_value.toVariant(),
+            record.new_value.toVariant(),
+            getField(record),
+            record.old_type,
+            record.new_type,
+            record.action,
+            Date::fromMinutes(record.minutes)
+        );
+    });
+    return entry;
+}
+
+auto ChangeJournal::getChanger(const Record& record) const -> std::weak_ptr<InternalEmployee>
+{
+    if (record.changer == ChangeChain::npos) return {};
+
+    std::lock_guard<std::mutex> lock(this->changer_mutex);
+    return this->changers[record.changer];
+}
+
+auto ChangeJournal::getField(const Record& record) -> ChangeLog::FieldVariant
+{
+    return field_decoders[record.field_kind](record.field);
+}
+
+auto ChangeJournal::getStateAt(const ChangeChain& chain, const Date& date) const -> EntityState
+{
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+
+    EntityState state;
+    int32_t     minutes = date.getMinutes();
+    Offset  from    = ChangeChain::npos;
+    Offset  to      = chain.head;
+
+    std::unique_lock<std::mutex> checkpoint_lock(this->checkpoint_mutex);
+    auto                         it = this->checkpoints.find(chain.entity);
+    if (it != this->checkpoints.end()) {
+        // another thread may have added checkpoints past the head this thread saw
+        auto next = std::partition_point(
+            it->second.begin(), it->second.end(), [&](const Checkpoint& checkpoint) {
+                return checkpoint.minutes <= minutes &&
+                       (checkpoint.offset == ChangeChain::npos || checkpoint.offset <= chain.head);
+            }
+        );
+        if (next != it->second.begin()) {
+            state = std::prev(next)->state;
+            from  = std::prev(next)->offset;
+        }
+        if (next != it->second.end() && next->offset <= chain.head) to = next->offset;
+    }
+    checkpoint_lock.unlock();
+    this->replay(state, from, to, minutes);
+    return state;
+}
+
+auto ChangeJournal::queryAudit(const AuditQuery& query) const -> AuditPage
+{
+    return this->audit.query(query, current_tenant);
+}
+
+auto ChangeJournal::getArchive() const -> const ChangeArchive& { return this->archive; }
+
+auto ChangeJournal::size() const -> size_t
+{
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    return this->records.size();
+}
+
+auto ChangeJournal::addValue(change_journal::ValueStore& store, const ChangeValue& value)
+    -> ChangeValue
+{
+    ChangeValue result = value;
+    if (value.kind == ChangeValue::Kind::Text) {
+        result.text = store.addText(value.getText());
+    } else if (value.kind == ChangeValue::Kind::Object) {
+        result.object = store.addObject(*value.toVariant());
+    }
+    return result;
+}
+
+auto ChangeJournal::claimSlot() -> std::pair<Offset, std::shared_lock<std::shared_mutex>>
+{
+    for (;;) {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        if (auto offset = this->records.claim()) return {*offset, std::move(lock)};
+        lock.unlock();
+
+        // the chunks are full: add one unless another thread did meanwhile
+        std::unique_lock<std::shared_mutex> grow_lock(this->mutex);
+        size_t chunks = this->records.chunkCount();
+        if (this->records.size() < chunks * records_per_chunk) continue;
+        // npos is reserved, every handle must stay below it
+        if ((chunks + 1) * records_per_chunk > ChangeChain::npos) {
+            throw std::length_error(errors::change_journal_full);
+        }
+        this->records.grow();
+        this->values.push_back(std::make_shared<change_journal::ValueStore>());
+        this->value_mutexes.emplace_back();
+        this->archived_counts.push_back(0);
+    }
+}
+
+auto ChangeJournal::store(
+    ChangeChain&       chain,
+    Record             record,
+    const ChangeValue& old_value,
+    const ChangeValue& new_value,
+    const bool         audited
+) -> Offset
+{
+    auto [offset, lock] = this->claimSlot();
+    size_t chunk        = offset / records_per_chunk;
+    if (chain.entity == ChangeChain::npos) chain.entity = this->entity_count++;
+
+    record.entity      = chain.entity;
+    record.entity_type = chain.type;
+    record.prev        = chain.head;
+    record.archived    = false;
+    {
+        std::lock_guard<std::mutex> chunk_lock(this->value_mutexes[chunk]);
+        record.old_value = addValue(*this->values[chunk], old_value);
+        record.new_value = addValue(*this->values[chunk], new_value);
+    }
+
+    this->records[offset] = record;
+    chain.head            = offset;
+    chain.count++;
+    if (audited) {
+        auto changer_key = this->changerKey(record);
+        this->audit.add(
+            {record.minutes, offset, record.field_kind, record.field, record.entity_type},
+            record.tenant,
+            changer_key ? &*changer_key : nullptr
+        );
+    }
+    if (chain.count % checkpoint_interval == 0) this->addCheckpoint(chain);
+    return offset;
+}
+
+auto ChangeJournal::addChanger(const std::weak_ptr<InternalEmployee>& changer) -> uint32_t
+{
+    auto employee = changer.lock();
+    if (employee == nullptr) return ChangeChain::npos;
+
+    std::lock_guard<std::mutex> lock(this->changer_mutex);
+    // an address can be reused by a new employee once the old one is gone
+    auto it = this->changer_ids.find(employee.get());
+    if (it != this->changer_ids.end() && this->changers[it->second].lock() == employee) {
+        return it->second;
+    }
+    uint32_t id = static_cast<uint32_t>(this->changers.size());
+    this->changers.push_back(employee);
+    this->changer_keys.push_back(employee->getId());
+    this->changer_ids[employee.get()] = id;
+    return id;
+}
+
+void ChangeJournal::addCheckpoint(const ChangeChain& chain)
+{
+    EntityState state;
+    Offset      from = ChangeChain::npos;
+    {
+        std::lock_guard<std::mutex> lock(this->checkpoint_mutex);
+        auto                        it = this->checkpoints.find(chain.entity);
+        if (it != this->checkpoints.end() && !it->second.empty()) {
+            state = it->second.back().state;
+            from  = it->second.back().offset;
+        }
+    }
+    this->replay(state, from, chain.head, INT32_MAX);
+
+    // copied out of the chunks, which `compact` could not free while a checkpoint held them
+    size_t text_size = 0;
+    for (const auto& field : state.getFields()) {
+        if (field.value.getKind() != ChangeValue::Kind::Text) continue;
+        text_size += field.value.getText().size();
+    }
+    auto store = std::make_shared<change_journal::ValueStore>(std::max<size_t>(text_size, 1));
+    state.rebase(store, [&](const ChangeValue& value) { return addValue(*store, value); });
+
+    std::lock_guard<std::mutex> lock(this->checkpoint_mutex);
+    this->checkpoints[chain.entity].push_back(
+        Checkpoint{chain.head, this->records[chain.head].minutes, std::move(state)}
+    );
+}
+
+auto ChangeJournal::changerKey(const Record& record) const -> std::optional<BigUint>
+{
+    if (record.changer == ChangeChain::npos) return std::nullopt;
+
+    std::lock_guard<std::mutex> lock(this->changer_mutex);
+    return this->changer_keys[record.changer];
+}
+
+void ChangeJournal::releaseChunks(Garbage& garbage)
+{
+    size_t full_chunks = this->records.size() / records_per_chunk;
+    for (size_t chunk = 0; chunk < full_chunks; chunk++) {
+        if (this->archived_counts[chunk] != records_per_chunk || this->values[chunk] == nullptr) {
+            continue;
+        }
+        // states that still point into the store keep it alive
+        this->records.release(chunk);
+        garbage.stores.push_back(std::move(this->values[chunk]));
+    }
+}
+
+void ChangeJournal::trimCheckpoints(Garbage& garbage)
+{
+    auto archived = [this](const Checkpoint& checkpoint) {
+        if (checkpoint.offset == ChangeChain::npos) return false;
+        Offset offset = checkpoint.offset;
+        return !this->records.loaded(offset) || this->records[offset].archived;
+    };
+    for (auto& [entity, list] : this->checkpoints) {
+        // the newest one still saves replaying every archived record of the entity
+        auto newest = std::find_if(list.rbegin(), list.rend(), archived);
+        if (newest == list.rend()) continue;
+        auto end   = std::prev(newest.base());
+        auto first = std::stable_partition(list.begin(), end, [&](const Checkpoint& checkpoint) {
+            return !archived(checkpoint);
+        });
+        std::move(first, end, std::back_inserter(garbage.checkpoints));
+        list.erase(first, end);
+    }
+}
+
+void ChangeJournal::replay(
+    EntityState& state, const Offset from, const Offset to, const int32_t minutes
+) const
+{
+    std::vector<Offset> offsets;
+    for (Offset offset = to; offset != from && offset != ChangeChain::npos;) {
+        offsets.push_back(offset);
+        this->readLocked(offset, [&](const Record& record, const auto&) { offset = record.prev; });
+    }
+
+    for (auto it = offsets.rbegin(); it != offsets.rend(); ++it) {
+        bool done = false;
+        this->readLocked(*it, [&](const Record& record, const auto& storage) {
+            if (record.minutes > minutes) {
+                done = true;
+                return;
+            }
+            state.apply(
+                record.field_kind,
+                record.field,
+                record.action,
+                record.old_type,
+                record.old_value,
+                record.new_type,
+                record.new_value
+            );
+            state.retain(storage);
+        });
+        if (done) break;
+    }
+}
+
+InitialState::InitialState(const Date& date)
+    : minutes(date.getMinutes()), store(std::make_shared<change_journal::ValueStore>(256))
+{
+}
+
+void InitialState::set(
+    const ChangeLog::FieldVariant& field,
+    const ChangeLog::FieldType     type,
+    const ChangeValue&             value
+)
+{
+    if (value.empty()) return;
+    this->state.apply(
+        static_cast<uint8_t>(field.index()),
+        std::visit([](auto value) { return static_cast<uint8_t>(value); }, field),
+        ChangeLog::Action::Change,
+        ChangeLog::FieldType::null,
+        ChangeValue(),
+        type,
+        ChangeJournal::addValue(*this->store, value)
+    );
+}
+
+namespace change_journal {
+    ValueStore::ValueStore(const size_t text_chunk_size) : text_chunk_size(text_chunk_size) {}
+
+    auto ValueStore::addText(const std::string_view text) -> const char*
+    {
+        if (text.empty()) return nullptr;
+
+        char* data;
+        // long texts get their own block so they do not waste the tail of the current chunk
+        if (text.size() > this->text_chunk_size / 4) {
+            this->text_chunks.push_back(std::make_unique_for_overwrite<char[]>(text.size()));
+            data = this->text_chunks.back().get();
+        } else {
+            if (text.size() > this->text_left) {
+                this->text_chunks.push_back(
+                    std::make_unique_for_overwrite<char[]>(this->text_chunk_size)
+                );
+                this->text_cursor = this->text_chunks.back().get();
+                this->text_left   = this->text_chunk_size;
+            }
+            data = this->text_cursor;
+            this->text_cursor += text.size();
+            this->text_left -= text.size();
+        }
+        memcpy(data, text.data(), text.size());
+        return data;
+    }
+
+    auto ValueStore::addObject(const ChangeLog::ValueVariant& value) -> const void*
+    {
+        const auto& stored = this->objects.emplace_back(value);
+        return std::visit([](const auto& object) -> const void* { return &object; }, stored);
+    }
+}  // namespace change_journal
+
+TenantScope::TenantScope(const uint16_t tenant) : previous(current_tenant)
+{
+    current_tenant = tenant;
+}
+
+TenantScope::~TenantScope() { current_tenant = this->previous; }
+
+auto TenantScope::current() -> uint16_t { return current_tenant; }
+
+ChangeChain::ChangeChain(const EntityType type, const BigUint& id) : type(type), id(id) {}
+
+ChangeChain::ChangeChain(ChangeChain&& other) noexcept
+    : entity(other.entity)
+    , head(other.head)
+    , count(other.count)
+    , type(other.type)
+    , id(std::move(other.id))
+{
+    other.entity = npos;
+    other.head   = npos;
+    other.count  = 0;
+}
+
+ChangeChain::ChangeChain(const ChangeChain& other) : type(other.type), id(other.id)
+{
+    ChangeJournal::getInstance().copy(other, *this);
+}
+
+ChangeChain& ChangeChain::operator=(const ChangeChain& other)
+{
+    if (this == &other) return *this;
+    ChangeChain copy(other);
+    return *this = std::move(copy);
+}
+
+ChangeChain& ChangeChain::operator=(ChangeChain&& other)
+{
+    if (this == &other) return *this;
+    if (this->entity != npos) ChangeJournal::getInstance().drop(*this);
+    std::swap(this->entity, other.entity);
+    std::swap(this->head, other.head);
+    std::swap(this->count, other.count);
+    std::swap(this->type, other.type);
+    std::swap(this->id, other.id);
+    return *this;
+}
+
+ChangeChain::~ChangeChain()
+{
+    if (this->entity != npos) ChangeJournal::getInstance().drop(*this);
+}
+
+ChangeLogView::ChangeLogView(const ChangeChain& chain) : head(chain.head), count(chain.count) {}
+
+auto ChangeLogView::size() const -> size_t { return this->count; }
+auto ChangeLogView::empty() const -> bool { return this->count == 0; }
+auto ChangeLogView::front() const -> ChangeLogPtr { return (*this)[0]; }
+auto ChangeLogView::back() const -> ChangeLogPtr
+{
+    if (this->empty()) throw std::out_of_range(errors::unknown_change);
+    return ChangeJournal::getInstance().getEntry(this->head);
+}
+
+auto ChangeLogView::operator[](const size_t index) const -> ChangeLogPtr
+{
+    if (index >= this->count) throw std::out_of_range(errors::unknown_change);
+    return ChangeJournal::getInstance().getEntry(this->offsetAt(index));
+}
+
+auto ChangeLogView::offsets() const -> std::vector<ChangeChain::Offset>
+{
+    if (!this->cached_offsets.empty()) return this->cached_offsets;
+
+    std::vector<ChangeChain::Offset> result(this->count);
+    const auto&                      journal = ChangeJournal::getInstance();
+    ChangeChain::Offset              offset  = this->head;
+    for (size_t i = result.size(); i > 0; i--) {
+        result[i - 1] = offset;
+        offset        = journal.getRecord(offset).prev;
+    }
+    return result;
+}
+
+auto ChangeLogView::begin() const -> Iterator { return Iterator(this, 0); }
+auto ChangeLogView::end() const -> Iterator { return Iterator(this, this->count); }
+
+auto ChangeLogView::offsetAt(const size_t index) const -> ChangeChain::Offset
+{
+    // the newest entry is the one read most, it needs no walk
+    if (index + 1 == this->count) return this->head;
+    if (this->cached_offsets.empty()) this->cached_offsets = this->offsets();
+    return this->cached_offsets[index];
+}
@@ -0,0 +1,325 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ChangeLog/change_archive.hpp"
+#include "ChangeLog/change_audit_index.hpp"
+#include "ChangeLog/change_chain.hpp"
+#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_record.hpp"
+#include "ChangeLog/change_value.hpp"
+#include "ChangeLog/entity_state.hpp"
+#include "location.hpp"
+
+namespace change_journal {
+    /// Append-only array kept in fixed chunks, so an element never moves once it is written.
+    /// Slots are claimed with `claim`, which threads may call at once as long as no chunk is
+    /// added or released meanwhile. A whole chunk can be released; its elements must not be read
+    /// afterwards.
+    template <typename T, size_t ChunkSize>
+    class Chunked {
+    public:
+        /// Index of a free slot, or nothing if every chunk is full and `grow` is needed
+        auto claim() -> std::optional<uint32_t>
+        {
+            size_t count    = this->count.load(std::memory_order_relaxed);
+            size_t capacity = this->chunks.size() * ChunkSize;
+            do {
+                if (count >= capacity) return std::nullopt;
+            } while (!this->count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed)
+            );
+            return static_cast<uint32_t>(count);
+        }
+        void grow() { this->chunks.push_back(std::make_unique<T[]>(ChunkSize)); }
+        auto operator[](const uint32_t index) -> T&
+        {
+            return this->chunks[index / ChunkSize][index % ChunkSize];
+        }
+        auto operator[](const uint32_t index) const -> const T&
+        {
+            return this->chunks[index / ChunkSize][index % ChunkSize];
+        }
+        /// Slots claimed so far
+        auto size() const -> size_t { return this->count.load(std::memory_order_relaxed); }
+        auto chunkCount() const -> size_t { return this->chunks.size(); }
+        auto loaded(const uint32_t index) const -> bool
+        {
+            return this->chunks[index / ChunkSize] != nullptr;
+        }
+        void release(const size_t chunk) { this->chunks[chunk].reset(); }
+
+    private:
+        std::vector<std::unique_ptr<T[]>> chunks;
+        std::atomic<size_t>               count = 0;
+    };
+
+    /// Text and objects of the records of one chunk, freed with them by `compact`. Checkpoints
+    /// and initial states keep smaller ones of their own.
+    class ValueStore {
+    public:
+        explicit ValueStore(const size_t text_chunk_size = 16 * 1024);
+
+        auto addText(const std::string_view text) -> const char*;
+        auto addObject(const ChangeLog::ValueVariant& value) -> const void*;
+
+    private:
+        size_t                               text_chunk_size;
+        std::vector<std::unique_ptr<char[]>> text_chunks;
+        char*                                text_cursor = nullptr;
+        size_t                               text_left   = 0;
+        std::deque<ChangeLog::ValueVariant>  objects;  // a deque never moves its elements
+    };
+}  // namespace change_journal
+
+/**
+ * @class InitialState
+ * @brief Fields an entity was created with, the state its history starts from.
+ *
+ * An entity fills one with the fields its setters journal and its data base hands it to
+ * `ChangeJournal::setInitialState` when the entity is added. Values are copied in as they are set,
+ * so they may point to temporaries. List fields are left out.
+ */
+class InitialState {
+public:
+    explicit InitialState(const Date& date);
+
+    /// Field with the type its setter journals; an empty value leaves the field out
+    void set(
+        const ChangeLog::FieldVariant& field,
+        const ChangeLog::FieldType     type,
+        const ChangeValue&             value
+    );
+
+private:
+    friend class ChangeJournal;
+
+    int32_t                                     minutes;
+    EntityState                                 state;
+    std::shared_ptr<change_journal::ValueStore> store;
+};
+
+/**
+ * @class ChangeJournal
+ * @brief Append-only log of every change made to the data models.
+ *
+ * Each change is one fixed-size `Record`: the old and new `ChangeValue`, the entity chain, the
+ * field, the action, the changer and the minute of the change. Text and other objects are
+ * copied into a `ValueStore` per chunk of records, changers are stored once. A record takes
+ * 64 bytes and the journal itself only allocates when a chunk fills up. `ChangeLog` objects are
+ * only built when history is read, `ChangeRenderer` formats records without them. Models know
+ * nothing of their tenant, so the journal is one per process, like `SessionManager`: records
+ * carry the tenant of the `TenantScope` they were made in, and a `ChangeChain` drops the history
+ * of its entity when it is destroyed. Each append also updates the audit index, so changes by an
+ * employee or in a period are found without visiting entities.
+ *
+ * Appends and reads share the layout lock, which is only taken alone to add a chunk, `compact`
+ * and `drop`. Appends claim their slot without a lock and copy their values under the lock of
+ * their chunk; changers, checkpoints and each tenant of the audit index have locks of their own.
+ *
+ * `compact` moves old records to a `ChangeArchive` on disk and frees every chunk whose records
+ * are all archived. Reads page such records back in, so history reads the same either way,
+ * except that archived references into the entity graph come back as their text (see
+ * `ArchiveBlock`).
+ */
+class ChangeJournal {
+public:
+    using Offset = ChangeChain::Offset;
+
+    using Record = ChangeRecord;
+
+    static ChangeJournal& getInstance();
+
+    ChangeJournal(const ChangeJournal&)            = delete;
+    ChangeJournal& operator=(const ChangeJournal&) = delete;
+
+    /// Appends a record to the journal and to `chain`, and reports it to the current session
+    /// and to the `ChangeStream`
+    auto append(
+        ChangeChain&                           chain,
+        const std::weak_ptr<InternalEmployee>& changer,
+        const ChangeValue&                     old_value,
+        const ChangeValue&                     new_value,
+        const ChangeLog::FieldVariant          field,
+        const ChangeLog::FieldType             old_field_type,
+        const ChangeLog::FieldType             new_field_type,
+        const ChangeLog::Action                action,
+        const Date                             change_date = Date()
+    ) -> Offset;
+    /// Archives the records `policy` no longer keeps in memory as of `now` and frees the chunks
+    /// left without live records. Checkpoints of archived records go too, but for the newest
+    /// one of each entity. Appends and reads wait while it runs. Returns the records archived.
+    auto compact(const RetentionPolicy& policy, const Date& now = Date()) -> size_t;
+    /// Forgets the records of `chain`, whose entity is gone, and empties the chain. Called by the
+    /// chain when it is destroyed, and by the data bases when they remove an entity for good.
+    /// The records leave the audit index and their values are freed with their chunk; records
+    /// already archived stay in their segment. Offsets of the records held elsewhere, by a
+    /// session for one, read empty values until the chunk is freed and throw after.
+    void drop(ChangeChain& chain);
+    /// Appends a copy of each record of `source` to `target`, oldest first. The copies are not
+    /// reported and stay out of the audit index, which lists each change once.
+    void copy(const ChangeChain& source, ChangeChain& target);
+    /// Starts the history of `chain` from `state`, so `getStateAt` knows the fields that were
+    /// never changed. Ignored once the chain has records.
+    void setInitialState(ChangeChain& chain, InitialState state);
+
+    /// Calls `read` with the record under a shared lock, paging it in if it was archived. The
+    /// values of the record are only valid inside `read`, which must not call the journal.
+    template <typename Read>
+    void readRecord(const Offset offset, Read&& read) const
+    {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        if (offset >= this->records.size()) throw std::out_of_range(errors::unknown_change);
+        this->readLocked(offset, [&](const Record& record, const auto&) { read(record); });
+    }
+
+    /// @name Getters
+    /// @{
+    /// Copy of the record; use `readRecord` to read its values
+    auto getRecord(const Offset offset) const -> Record;
+    /// Builds the `ChangeLog` of a record
+    auto getEntry(const Offset offset) const -> ChangeLogPtr;
+    auto getChanger(const Record& record) const -> std::weak_ptr<InternalEmployee>;
+    static auto getField(const Record& record) -> ChangeLog::FieldVariant;
+    /// State the records of `chain` up to `date` leave behind. Starts from the last
+    /// checkpoint before the date, so at most `checkpoint_interval` records are replayed,
+    /// unless the date falls among archived records whose checkpoints `compact` dropped.
+    /// Dates of one chain are expected to grow with its records.
+    auto getStateAt(const ChangeChain& chain, const Date& date) const -> EntityState;
+    /// One page of changes across every entity of the current tenant, see `ChangeAuditIndex`
+    auto queryAudit(const AuditQuery& query) const -> AuditPage;
+    auto getArchive() const -> const ChangeArchive&;
+    auto size() const -> size_t;
+    /// @}
+
+private:
+    static constexpr size_t records_per_chunk = 4096;
+    /// A chain's state is saved after every this many of its records
+    static constexpr size_t checkpoint_interval = 64;
+
+    struct Checkpoint {
+        Offset      offset;   ///< Last record included, npos for the `InitialState`
+        int32_t     minutes;  ///< Date of that record
+        EntityState state;    ///< Owns its values, it holds no chunk alive
+    };
+
+    using ValueStorePtr = std::shared_ptr<change_journal::ValueStore>;
+
+    /// Values freed under the lock and destroyed after it: they may hold entities, whose chains
+    /// `drop` into the journal
+    struct Garbage {
+        std::vector<ValueStorePtr> stores;
+        std::vector<Checkpoint>    checkpoints;
+    };
+
+    friend class InitialState;
+
+    ChangeJournal() = default;
+
+    mutable std::shared_mutex mutex;  // layout: chunks, values and archived counts
+    change_journal::Chunked<Record, records_per_chunk>    records;
+    std::vector<ValueStorePtr>                            values;           // by record chunk
+    std::deque<std::mutex>                                value_mutexes;    // by record chunk
+    std::vector<uint32_t>                                 archived_counts;  // by record chunk
+    mutable std::mutex                                    changer_mutex;
+    std::vector<std::weak_ptr<InternalEmployee>>          changers;
+    std::vector<BigUint>                                  changer_keys;  // by changer, for audit
+    std::unordered_map<const InternalEmployee*, uint32_t> changer_ids;
+    std::atomic<uint32_t>                                 entity_count = 0;
+    mutable std::mutex                                    checkpoint_mutex;
+    std::unordered_map<uint32_t, std::vector<Checkpoint>> checkpoints;  // by entity
+    ChangeAuditIndex                                      audit;
+    ChangeArchive                                         archive;
+
+    /// Copy of `value` whose text and object live in `store`
+    static auto addValue(change_journal::ValueStore& store, const ChangeValue& value)
+        -> ChangeValue;
+    /// Claims a slot for a new record and returns it with the layout lock held shared
+    auto claimSlot() -> std::pair<Offset, std::shared_lock<std::shared_mutex>>;
+    /// Writes `record` as the newest record of `chain` with copies of the values
+    auto store(
+        ChangeChain&       chain,
+        Record             record,
+        const ChangeValue& old_value,
+        const ChangeValue& new_value,
+        const bool         audited
+    ) -> Offset;
+    auto addChanger(const std::weak_ptr<InternalEmployee>& changer) -> uint32_t;
+    void addCheckpoint(const ChangeChain& chain);
+    /// Id of the changer of `record` for the audit index, nothing if there is none
+    auto changerKey(const Record& record) const -> std::optional<BigUint>;
+    /// Frees the full chunks whose records are all archived or dropped
+    void releaseChunks(Garbage& garbage);
+    /// Drops the checkpoints of archived records but for the newest one of each entity
+    void trimCheckpoints(Garbage& garbage);
+    /// Applies the records after `from` up to `to` dated no later than `minutes`, oldest first
+    void replay(EntityState& state, const Offset from, const Offset to, const int32_t minutes)
+        const;
+
+    /// Calls `read(record, storage)` with the lock already held. `storage` is the shared
+    /// pointer owning the values: a `ValueStore`, or the `ArchiveBlock` the record was paged in.
+    template <typename Read>
+    void readLocked(const Offset offset, Read&& read) const
+    {
+        if (this->records.loaded(offset)) {
+            read(this->records[offset], this->values[offset / records_per_chunk]);
+            return;
+        }
+        std::shared_ptr<const ArchiveBlock> block = this->archive.load(offset);
+        read(*block->find(offset), block);
+    }
+
+#ifdef _TESTING
+public:
+    /// Storage of the values of the chunk holding `offset`, empty once the chunk is freed
+    auto _getValueStore(const Offset offset) const -> std::weak_ptr<const void>
+    {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        return this->values[offset / records_per_chunk];
+    }
+    auto _getCheckpointCount(const ChangeChain& chain) const -> size_t
+    {
+        std::lock_guard<std::mutex> lock(this->checkpoint_mutex);
+        auto it = this->checkpoints.find(chain.entity);
+        return it == this->checkpoints.end() ? 0 : it->second.size();
+    }
+#endif  // _TESTING
+};
+
+/**
+ * @class TenantScope
+ * @brief Makes the calling thread work for a tenant until the scope ends.
+ *
+ * Changes are tagged with the current tenant and audit queries only see that tenant's changes.
+ * Threads outside any scope work for tenant 0. The previous tenant is restored on exit.
+ */
+class TenantScope {
+public:
+    explicit TenantScope(const uint16_t tenant);
+    ~TenantScope();
+
+    TenantScope(const TenantScope&)            = delete;
+    TenantScope& operator=(const TenantScope&) = delete;
+
+    static auto current() -> uint16_t;
+
+private:
+    uint16_t previous;
+};
+
+template <typename... Args>
+void ChangeChain::append(Args&&... args)
+{
+    ChangeJournal::getInstance().append(*this, std::forward<Args>(args)...);
+}
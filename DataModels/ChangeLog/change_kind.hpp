@@ -0,0 +1,50 @@
+#pragma once
+#include <stdint.h>
+
+#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_value.hpp"
+
+/**
+ * @file change_kind.hpp
+ * @brief Field kinds, the alternatives of `ChangeLog::FieldVariant`, and masks of them.
+ *
+ * The kind of a change names the field enum that was changed, so a mask selects the changes of
+ * one store in `SessionChanges` and `ChangeAuditIndex`. Clients and employees share
+ * `PersonFields`, so the kind does not name the type of the entity; `SessionChanges` counts
+ * that by the `EntityType` of the change.
+ */
+namespace change_kind {
+    static_assert(std::variant_size_v<ChangeLog::FieldVariant> <= 32, "kinds fit a 32-bit mask");
+
+    /// Field kind of the `Fields` enum, the alternative of `ChangeLog::FieldVariant`
+    template <typename Fields>
+    inline constexpr uint8_t of = static_cast<uint8_t>(
+        change_value::AlternativeIndex<Fields, ChangeLog::FieldVariant>::value
+    );
+
+    template <typename... Fields>
+    inline constexpr uint32_t mask = ((uint32_t{1} << of<Fields>) | ...);
+
+    inline constexpr uint32_t all = UINT32_MAX;
+
+    /// @name Kinds of the entities of each store
+    /// @{
+    inline constexpr uint32_t interactions = mask<
+        BaseInteractionFields,
+        CommentarySocialNetworksFields,
+        CommentarySocialNetworksThreadFields,
+        CorrespondenceFields,
+        EmailLetterFields,
+        EmailThreadFields,
+        InteractionResultFields,
+        MeetingFields,
+        MeetingThreadFields,
+        MessageFields,
+        PhoneCallFields>;
+    inline constexpr uint32_t deals = mask<DealFields>;
+    inline constexpr uint32_t tasks = mask<TaskFields>;
+    /// Clients and employees share `PersonFields`
+    inline constexpr uint32_t people =
+        mask<PersonFields, ClientFields, InternalEmployeeFields, ExternalEmployeeFields>;
+    /// @}
+}  // namespace change_kind
@@ -1,6 +1,6 @@
 #include "change_log.hpp"
 
-#include <format>
+#include <charconv>
 #include <string>
 
 #include "DateTime/time_duration.hpp"
@@ -11,7 +11,6 @@
 #include "Payment/payment.hpp"
 #include "Person/Client/client.hpp"
 #include "Person/Employee/internal_employee.hpp"
-#include "UserSession/session_manager.hpp"
 #include "location.hpp"
 
 ChangeLog::ChangeLog(
@@ -33,431 +32,369 @@ ChangeLog::ChangeLog(
     , new_field_type(new_field_type)
     , action(action)
 {
-    SessionManager::getInstance().addChangeToSession(this);
 }
 
 ChangeLog::~ChangeLog() {}
 
-StringPtr ChangeLog::valueToStr(FieldType type, ValueVariant value, StringPtr& str)
+namespace {
+    /// "Name Surname" of a person still in the database, or `removed`
+    template <typename T>
+    void writeName(std::string& out, const std::weak_ptr<T>& weak, const std::string& removed)
+    {
+        auto person = weak.lock();
+        if (person == nullptr) {
+            out.append(removed);
+            return;
+        }
+        out.append(person->getName()).append(1, ' ').append(person->getSurname());
+    }
+
+    template <typename Enum>
+    void writeEnum(std::string& out, const ChangeLog::ValueVariant& value)
+    {
+        out.append(enumToStr(std::get<Enum>(value)));
+    }
+
+    void writeMoney(std::string& out, const Money& money)
+    {
+        out.append(money.toString()).append(1, ' ').append(currencyToString(money.getCurrency()));
+    }
+}  // namespace
+
+void ChangeLog::writeValue(std::string& out, const FieldType type, const ValueVariant& value)
 {
+    // objects paged in from a `ChangeArchive` come back as their text, under their own type
+    if (type != FieldType::String && std::holds_alternative<StringPtr>(value)) {
+        auto& text = std::get<StringPtr>(value);
+        if (text != nullptr) out.append(*text);
+        return;
+    }
     switch (type) {
         case FieldType::Int: {
-            str = std::make_shared<std::string>(std::to_string(std::get<int>(value)));
-            return str;
+            char buffer[16];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), std::get<int>(value));
+            out.append(buffer, result.ptr);
+            break;
         }
         case FieldType::Uint: {
-            str = std::make_shared<std::string>(std::to_string(std::get<uint32_t>(value)));
-            return str;
+            char buffer[16];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), std::get<uint32_t>(value));
+            out.append(buffer, result.ptr);
+            break;
         }
         case FieldType::Double: {
-            str = std::make_shared<std::string>(std::format("{}", std::get<double>(value)));
-            return str;
+            char buffer[32];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), std::get<double>(value));
+            out.append(buffer, result.ptr);
+            break;
         }
         case FieldType::String: {
-            str = std::get<StringPtr>(value);
-            return str;
+            auto& text = std::get<StringPtr>(value);
+            if (text != nullptr) out.append(*text);
+            break;
         }
         case FieldType::PhoneNumber: {
-            str = std::make_shared<std::string>(
-                std::get<std::shared_ptr<PhoneNumber>>(value)->getNumber()
-            );
-            return str;
+            out.append(std::get<std::shared_ptr<PhoneNumber>>(value)->getNumber());
+            break;
         }
         case FieldType::Date: {
-            str =
-                std::make_shared<std::string>(std::get<std::shared_ptr<Date>>(value)->getDateStr());
-            return str;
+            out.append(std::get<Date>(value).getDateStr());
+            break;
         }
         case FieldType::WeakPerson: {
-            auto& person_weak = std::get<std::weak_ptr<Person>>(value);
-            if (!person_weak.expired()) {
-                auto person = person_weak.lock();
-                str = std::make_shared<std::string>(person->getName() + ' ' + person->getSurname());
-            } else {
-                str = std::make_shared<std::string>(warning::person_removed);
-            }
-            return str;
+            writeName(out, std::get<WeakPersonPtr>(value), warning::person_removed);
+            break;
         }
         case FieldType::CallType: {
-            str = std::make_shared<std::string>(
-                this->callTypeToStr(std::get<PhoneCallData::CallType>(value))
-            );
-            return str;
+            writeEnum<PhoneCallData::CallType>(out, value);
+            break;
         }
         case FieldType::Meeting: {
-            str = std::make_shared<std::string>(std::get<std::shared_ptr<Meeting>>(value)->getTitle(
-            ));
-            return str;
+            out.append(std::get<std::shared_ptr<Meeting>>(value)->getTitle());
+            break;
         }
         case FieldType::WeakClient: {
-            auto& client_weak = std::get<std::weak_ptr<Client>>(value);
-            if (!client_weak.expired()) {
-                auto client = client_weak.lock();
-                str = std::make_shared<std::string>(client->getName() + ' ' + client->getSurname());
-            } else {
-                str = std::make_shared<std::string>(warning::client_removed);
-            }
-            return str;
+            writeName(out, std::get<WeakClientPtr>(value), warning::client_removed);
+            break;
         }
         case FieldType::WeakInternalEmployee: {
-            auto& employee_weak = std::get<std::weak_ptr<InternalEmployee>>(value);
-            if (!employee_weak.expired()) {
-                auto employee = employee_weak.lock();
-                str           = std::make_shared<std::string>(
-                    employee->getName() + ' ' + employee->getSurname()
-                );
-            } else {
-                str = std::make_shared<std::string>(warning::internal_employee_removed);
-            }
-
-            return str;
+            writeName(
+                out, std::get<WeakInternalEmployee>(value), warning::internal_employee_removed
+            );
+            break;
         }
         case FieldType::WeakExternalEmployee: {
-            auto& employee_weak = std::get<std::weak_ptr<ExternalEmployee>>(value);
-            if (!employee_weak.expired()) {
-                auto employee = employee_weak.lock();
-                str           = std::make_shared<std::string>(
-                    employee->getName() + ' ' + employee->getSurname()
-                );
-            } else {
-                str = std::make_shared<std::string>(warning::external_employee_removed);
-            }
+            writeName(
+                out, std::get<WeakExternalEmployee>(value), warning::external_employee_removed
+            );
+            break;
         }
         case FieldType::Bool: {
-            str = std::get<bool>(value) ? std::make_shared<std::string>("True")
-                                        : std::make_shared<std::string>("False");
-            return str;
+            out.append(std::get<bool>(value) ? "True" : "False");
+            break;
         }
         case FieldType::MeetingStatus: {
-            str = std::make_shared<std::string>(
-                meetingStatusToStr(std::get<Meeting::MeetingStatus>(value))
-            );
-            return str;
+            writeEnum<Meeting::MeetingStatus>(out, value);
+            break;
         }
         case FieldType::MeetingType: {
-            str =
-                std::make_shared<std::string>(meetingTypeToStr(std::get<Meeting::MeetingType>(value)
-                ));
-            return str;
+            writeEnum<Meeting::MeetingType>(out, value);
+            break;
         }
         case FieldType::MeetingOutcome: {
-            str = std::make_shared<std::string>(
-                meetingOutcomeToStr(std::get<Meeting::MeetingOutcome>(value))
-            );
-            return str;
+            writeEnum<Meeting::MeetingOutcome>(out, value);
+            break;
         }
         case FieldType::Document: {
-            str =
-                std::make_shared<std::string>(std::get<std::shared_ptr<Document>>(value)->getTitle()
-                );
-            return str;
+            out.append(std::get<std::shared_ptr<Document>>(value)->getTitle());
+            break;
         }
         case FieldType::WeakDeal: {
-            auto& weak_deal = std::get<WeakDealPtr>(value);
-            if (!weak_deal.expired()) {
-                auto deal = weak_deal.lock();
-                str       = std::make_shared<std::string>(deal->getTitle());
-            } else {
-                str = std::make_shared<std::string>(warning::deal_removed);
-            }
-            return str;
+            auto deal = std::get<WeakDealPtr>(value).lock();
+            out.append(deal != nullptr ? deal->getTitle() : warning::deal_removed);
+            break;
         }
         case FieldType::BaseInteraction: {
-            str = std::make_shared<std::string>(
-                std::get<std::shared_ptr<BaseInteraction>>(value)->getTitle()
-            );
-            return str;
+            out.append(std::get<std::shared_ptr<BaseInteraction>>(value)->getTitle());
+            break;
         }
         case FieldType::FileMetadata: {
-            str = std::make_shared<std::string>(
-                std::get<std::shared_ptr<FileMetadata>>(value)->getFileName()
-            );
-            return str;
+            out.append(std::get<std::shared_ptr<FileMetadata>>(value)->getFileName());
+            break;
         }
         case FieldType::Campaign: {
-            str = std::make_shared<std::string>(std::get<std::shared_ptr<Campaign>>(value)->getName(
-            ));
-            return str;
+            out.append(std::get<std::shared_ptr<Campaign>>(value)->getName());
+            break;
         }
         case FieldType::CampaignLead: {
-            auto lead = std::get<std::shared_ptr<CampaignLead>>(value)->getLead();
-            if (lead.expired()) {
-                str = std::make_shared<std::string>(warning::client_removed);
-            } else {
-                auto client = lead.lock();
-                str = std::make_shared<std::string>(client->getName() + ' ' + client->getSurname());
-            }
-            return str;
+            writeName(
+                out,
+                std::get<std::shared_ptr<CampaignLead>>(value)->getLead(),
+                warning::client_removed
+            );
+            break;
         }
         case FieldType::StringPair: {
             auto& pair =
                 std::get<std::shared_ptr<std::pair<const std::string, const std::string>>>(value);
-            str = std::make_shared<std::string>(pair->first + ' ' + pair->second);
-            return str;
+            out.append(pair->first).append(1, ' ').append(pair->second);
+            break;
         }
         case FieldType::PersonMoneyPair: {
             auto& pair = std::get<std::shared_ptr<WeakBuyerShare>>(value);
             if (pair->first.expired()) {
-                str = std::make_shared<std::string>(
-                    warning::person_removed + " " + pair->second.num + ' ' +
-                    currencyToString(pair->second.currency)
-                );
+                out.append(warning::person_removed).append(1, ' ');
             } else {
-                auto buyer = pair->first.lock();
-                str        = std::make_shared<std::string>(
-                    buyer->getName() + ' ' + buyer->getSurname() + " - " + pair->second.num + ' ' +
-                    currencyToString(pair->second.currency)
-                );
+                writeName(out, pair->first, warning::person_removed);
+                out.append(" - ");
             }
-
-            return str;
+            writeMoney(out, pair->second);
+            break;
         }
         case FieldType::ResultStatus: {
-            str = std::make_shared<std::string>(
-                interactionResultStatusToStr(std::get<InteractionResult::ResultStatus>(value))
-            );
-            return str;
+            writeEnum<InteractionResult::ResultStatus>(out, value);
+            break;
         }
         case FieldType::EmailLetter: {
-            str = std::make_shared<std::string>(
-                std::get<std::shared_ptr<EmailLetter>>(value)->getTitle()
-            );
-            return str;
+            out.append(std::get<std::shared_ptr<EmailLetter>>(value)->getTitle());
+            break;
         }
         case FieldType::EmailStatus: {
-            str = std::make_shared<std::string>(
-                emailStatusToStr(std::get<EmailLetter::EmailStatus>(value))
-            );
-            return str;
+            writeEnum<EmailLetter::EmailStatus>(out, value);
+            break;
         }
         case FieldType::EmailLetterType: {
-            str = std::make_shared<std::string>(
-                emailLetterTypeToStr(std::get<EmailLetter::EmailLetterType>(value))
-            );
-            return str;
+            writeEnum<EmailLetter::EmailLetterType>(out, value);
+            break;
         }
         case FieldType::Message: {
-            str = std::make_shared<std::string>(
-                std::get<std::shared_ptr<Message>>(value)->getMessage()
-            );
-            return str;
+            out.append(std::get<std::shared_ptr<Message>>(value)->getMessage());
+            break;
         }
         case FieldType::CommentarySocialNetworks: {
-            str = std::make_shared<std::string>(
-                std::get<std::shared_ptr<CommentarySocialNetworks>>(value)->getTitle()
-            );
-            return str;
+            out.append(std::get<std::shared_ptr<CommentarySocialNetworks>>(value)->getTitle());
+            break;
         }
         case FieldType::TimeDuration: {
-            str = std::make_shared<std::string>(
-                std::get<std::shared_ptr<TimeDuration>>(value)->getDurationStr()
-            );
-            return str;
+            char buffer[TimeDuration::max_chars];
+            out.append(buffer, std::get<TimeDuration>(value).format(buffer, std::end(buffer)));
+            break;
         }
         case FieldType::InteractionResult: {
-            str = std::make_shared<std::string>(
-                std::get<std::shared_ptr<InteractionResult>>(value)->getTitle()
-            );
-            return str;
+            out.append(std::get<std::shared_ptr<InteractionResult>>(value)->getTitle());
+            break;
         }
         case FieldType::Note: {
-            str = std::make_shared<std::string>(std::get<std::shared_ptr<Note>>(value)->getTitle());
-            return str;
+            out.append(std::get<std::shared_ptr<Note>>(value)->getTitle());
+            break;
         }
         case FieldType::InteractionType: {
-            str = std::make_shared<std::string>(
-                interactionTypeToStr(std::get<BaseInteraction::InteractionType>(value))
-            );
-            return str;
+            writeEnum<BaseInteraction::InteractionType>(out, value);
+            break;
         }
         case FieldType::Address: {
             auto& address = std::get<std::shared_ptr<Address>>(value);
-            str           = std::make_shared<std::string>(
-                address->getCountry() + ' ' + address->getCity() + ' ' + address->getStreet() +
-                ' ' + address->getHouse()
-            );
-            return str;
+            out.append(address->getCountry()).append(1, ' ').append(address->getCity());
+            out.append(1, ' ').append(address->getStreet()).append(1, ' ');
+            out.append(address->getHouse());
+            break;
         }
         case FieldType::Priority: {
-            str = std::make_shared<std::string>(priorityToStr(std::get<Priority>(value)));
-            return str;
+            writeEnum<Priority>(out, value);
+            break;
         }
         case FieldType::Currencies: {
-            str = std::make_shared<std::string>(currencyToString(std::get<Currencies>(value)));
-            return str;
+            out.append(currencyToString(std::get<Currencies>(value)));
+            break;
         }
         case FieldType::Payment: {
-            auto&       payment = std::get<std::shared_ptr<Payment>>(value);
-
-            std::string amount;
+            auto& payment = std::get<std::shared_ptr<Payment>>(value);
 
-            if (payment->getReceivedDate() != nullptr)
-                amount = payment->getRequestedAmount()->num;
+            if (payment->getReceivedDate())
+                out.append(payment->getRequestedAmount()->toString());
             else if (payment->getSendingAmount() != nullptr)
-                amount = payment->getSendingAmount()->num;
+                out.append(payment->getSendingAmount()->toString());
             else
-                amount = "NULL";
+                out.append("NULL");
 
-            str = std::make_shared<std::string>(
-                amount + ' ' + currencyToString(payment->getCurrency()) + ' ' +
-                paymentStatusToStr(payment->getPaymentStatus())
-            );
-            return str;
+            out.append(1, ' ').append(currencyToString(payment->getCurrency())).append(1, ' ');
+            out.append(enumToStr(payment->getPaymentStatus()));
+            break;
         }
         case FieldType::DealStatus: {
-            str = std::make_shared<std::string>(dealStatusToStr(std::get<Deal::Status>(value)));
-            return str;
+            writeEnum<Deal::Status>(out, value);
+            break;
         }
         case FieldType::Offer: {
-            str = std::make_shared<std::string>(std::get<std::shared_ptr<Offer>>(value)->getName());
-            return str;
+            out.append(std::get<std::shared_ptr<Offer>>(value)->getName());
+            break;
         }
         case FieldType::DocumentStatus: {
-            str = std::make_shared<std::string>(
-                documentStatusToStr(std::get<Document::DocumentStatus>(value))
-            );
-            return str;
+            writeEnum<Document::DocumentStatus>(out, value);
+            break;
         }
         case FieldType::Task: {
-            str = std::make_shared<std::string>(std::get<std::shared_ptr<Task>>(value)->getTitle());
-            return str;
+            out.append(std::get<std::shared_ptr<Task>>(value)->getTitle());
+            break;
         }
         case FieldType::TaskStatus: {
-            str = std::make_shared<std::string>(taskStatusToStr(std::get<Task::Status>(value)));
-            return str;
+            writeEnum<Task::Status>(out, value);
+            break;
         }
         case FieldType::Gender: {
-            str = std::make_shared<std::string>(genderToStr(std::get<Gender>(value)));
-            return str;
+            writeEnum<Gender>(out, value);
+            break;
         }
         case FieldType::Money: {
-            auto money = std::get<std::shared_ptr<Money>>(value);
-            str =
-                std::make_shared<std::string>(money->num + ' ' + currencyToString(money->currency));
-            return str;
+            writeMoney(out, *std::get<std::shared_ptr<Money>>(value));
+            break;
         }
         case FieldType::AccessLevel: {
-            str = std::make_shared<std::string>(accessLevelStr(std::get<AccessRole>(value)));
-            return str;
+            writeEnum<AccessRole>(out, value);
+            break;
         }
         case FieldType::EmployeeStatus: {
-            str =
-                std::make_shared<std::string>(employeeStatusToStr(std::get<EmployeeStatus>(value)));
-            return str;
+            writeEnum<EmployeeStatus>(out, value);
+            break;
         }
         case FieldType::ClientType: {
-            str =
-                std::make_shared<std::string>(clientTypeToStr(std::get<Client::ClientType>(value)));
-            return str;
+            writeEnum<Client::ClientType>(out, value);
+            break;
         }
         case FieldType::LeadStatus: {
-            str =
-                std::make_shared<std::string>(leadStatusToStr(std::get<Client::LeadStatus>(value)));
-            return str;
+            writeEnum<Client::LeadStatus>(out, value);
+            break;
         }
         case FieldType::LeadSource: {
-            str =
-                std::make_shared<std::string>(leadSourceToStr(std::get<Client::LeadSource>(value)));
-            return str;
+            writeEnum<Client::LeadSource>(out, value);
+            break;
         }
         case FieldType::Company: {
-            str = std::make_shared<std::string>(
-                std::get<std::shared_ptr<Company>>(value)->getCompanyName()
-            );
-            return str;
+            out.append(std::get<std::shared_ptr<Company>>(value)->getCompanyName());
+            break;
         }
         case FieldType::CompanyType: {
-            str = std::make_shared<std::string>(
-                companyTypeToStr(std::get<ExternalCompany::CompanyType>(value))
-            );
-            return str;
+            writeEnum<ExternalCompany::CompanyType>(out, value);
+            break;
         }
         case FieldType::CompanyRating: {
-            str = std::make_shared<std::string>(
-                companyRatingToStr(std::get<ExternalCompany::Rating>(value))
-            );
-            return str;
+            writeEnum<ExternalCompany::Rating>(out, value);
+            break;
         }
         case FieldType::CompanyRiskLevel: {
-            str = std::make_shared<std::string>(
-                companyRiskLevelToStr(std::get<ExternalCompany::RiskLevel>(value))
-            );
-            return str;
+            writeEnum<ExternalCompany::RiskLevel>(out, value);
+            break;
         }
         case FieldType::SocialNetwork: {
-            str =
-                std::make_shared<std::string>(std::get<std::shared_ptr<SocialNetwork>>(value)->name
-                );
-            return str;
+            out.append(std::get<std::shared_ptr<SocialNetwork>>(value)->name);
+            break;
         }
         case FieldType::TaxInfo: {
-            auto tax = std::get<std::shared_ptr<TaxInfo>>(value);
-            str      = std::make_shared<std::string>(tax->code + ' ' + std::to_string(tax->rate));
+            auto& tax = std::get<std::shared_ptr<TaxInfo>>(value);
+            out.append(tax->code).append(1, ' ').append(std::to_string(tax->rate));
+            break;
         }
         case FieldType::CompanyStatus: {
-            str = std::make_shared<std::string>(
-                companyStatusToStr(std::get<Company::CompanyStatus>(value))
-            );
-            return str;
+            writeEnum<Company::CompanyStatus>(out, value);
+            break;
         }
         case FieldType::CompanySize: {
-            str = std::make_shared<std::string>(
-                companySizeToStr(std::get<ExternalCompany::CompanySize>(value))
-            );
-            return str;
+            writeEnum<ExternalCompany::CompanySize>(out, value);
+            break;
         }
         case FieldType::ComplianceLevel: {
-            str = std::make_shared<std::string>(
-                companyComplianceLevelToStr(std::get<ExternalCompany::ComplianceLevel>(value))
-            );
-            return str;
+            writeEnum<ExternalCompany::ComplianceLevel>(out, value);
+            break;
         }
         case FieldType::InfluenceLevel: {
-            str = std::make_shared<std::string>(
-                influenceLevelToStr(std::get<ExternalEmployee::InfluenceLevel>(value))
-            );
-            return str;
+            writeEnum<ExternalEmployee::InfluenceLevel>(out, value);
+            break;
         }
         case FieldType::IntegrationStatus: {
-            str = std::make_shared<std::string>(
-                integrationStatusToStr(std::get<ExternalCompany::IntegrationStatus>(value))
-            );
-            return str;
+            writeEnum<ExternalCompany::IntegrationStatus>(out, value);
+            break;
         }
         case FieldType::ReportType: {
-            str = std::make_shared<std::string>(reportTypeToStr(std::get<ReportType>(value)));
-            return str;
+            writeEnum<ReportType>(out, value);
+            break;
         }
         case FieldType::ExportFormat: {
-            str = std::make_shared<std::string>(exportFormatToStr(std::get<ExportFormat>(value)));
-            return str;
+            writeEnum<ExportFormat>(out, value);
+            break;
         }
         case FieldType::CampaignType: {
-            str = std::make_shared<std::string>(campaignTypeToStr(std::get<CampaignType>(value)));
-            return str;
+            writeEnum<CampaignType>(out, value);
+            break;
         }
         case FieldType::CaseStatus: {
-            str = std::make_shared<std::string>(caseStatusToStr(std::get<CaseStatus>(value)));
-            return str;
+            writeEnum<CaseStatus>(out, value);
+            break;
         }
+        default:
+            break;
     }
-    return nullptr;
 }
 
-StringPtr ChangeLog::getOldValueStr()
+auto ChangeLog::valueToStr(const FieldType type, const std::optional<ValueVariant>& value)
+    -> StringPtr
 {
-    if (this->old_value_str != nullptr) return old_value_str;
-    if (this->old_value == std::nullopt || this->old_field_type == FieldType::null) return nullptr;
+    if (value == std::nullopt || type == FieldType::null) return nullptr;
+    // strings are already shared, hand out the same one
+    if (type == FieldType::String) return std::get<StringPtr>(*value);
 
-    return valueToStr(old_field_type, old_value.value(), old_value_str);
+    auto str = std::make_shared<std::string>();
+    writeValue(*str, type, *value);
+    return str;
 }
 
-StringPtr ChangeLog::getNewValueStr()
+StringPtr ChangeLog::getOldValueStr() const
 {
-    if (this->new_value_str != nullptr) return new_value_str;
-    if (this->new_value == std::nullopt || this->new_field_type == FieldType::null) return nullptr;
+    return valueToStr(this->old_field_type, this->old_value);
+}
 
-    return valueToStr(new_field_type, new_value.value(), new_value_str);
+StringPtr ChangeLog::getNewValueStr() const
+{
+    return valueToStr(this->new_field_type, this->new_value);
 }
 
 auto ChangeLog::getChanger() const -> std::weak_ptr<InternalEmployee>
@@ -474,597 +411,87 @@ auto ChangeLog::getNewValue() const -> const std::optional<ValueVariant>&
     return this->new_value;
 }
 auto ChangeLog::getField() const -> const FieldVariant { return this->field; }
+auto ChangeLog::getFieldStr() const -> std::string_view
+{
+    return std::visit([](auto field) { return enumToStr(field); }, this->field);
+}
 auto ChangeLog::getOldValueFieldType() const -> FieldType { return this->old_field_type; }
 auto ChangeLog::getNewValueFieldType() const -> FieldType { return this->new_field_type; }
 auto ChangeLog::getAction() const -> Action { return this->action; }
 
 //
-std::string ChangeLog::callTypeToStr(PhoneCallData::CallType type)
+std::string_view ChangeLog::callTypeToStr(PhoneCallData::CallType type) { return enumToStr(type); }
+std::string_view ChangeLog::meetingStatusToStr(Meeting::MeetingStatus status)
 {
-    switch (type) {
-        case PhoneCallData::CallType::incoming:
-            return call_type_str::incoming;
-        case PhoneCallData::CallType::missed:
-            return call_type_str::missed;
-        case PhoneCallData::CallType::outgoing:
-            return call_type_str::outgoing;
-    }
-    return std::string();
+    return enumToStr(status);
 }
-
-std::string ChangeLog::meetingStatusToStr(Meeting::MeetingStatus status)
+std::string_view ChangeLog::meetingTypeToStr(Meeting::MeetingType type) { return enumToStr(type); }
+std::string_view ChangeLog::meetingOutcomeToStr(Meeting::MeetingOutcome outcome)
 {
-    switch (status) {
-        case Meeting::MeetingStatus::Canceled:
-            return meeting_status_str::canceled;
-        case Meeting::MeetingStatus::Completed:
-            return meeting_status_str::completed;
-        case Meeting::MeetingStatus::InProgress:
-            return meeting_status_str::inProgress;
-        case Meeting::MeetingStatus::Postponed:
-            return meeting_status_str::postponed;
-        case Meeting::MeetingStatus::Scheduled:
-            return meeting_status_str::scheduled;
-    }
-    return std::string();
+    return enumToStr(outcome);
 }
-
-std::string ChangeLog::meetingTypeToStr(Meeting::MeetingType type)
+std::string_view ChangeLog::interactionResultStatusToStr(InteractionResult::ResultStatus status)
 {
-    switch (type) {
-        case Meeting::MeetingType::Negotiation:
-            return meeting_type_str::negotiation;
-        case Meeting::MeetingType::Presentation:
-            return meeting_type_str::presentation;
-        case Meeting::MeetingType::Training:
-            return meeting_type_str::training;
-        case Meeting::MeetingType::Other:
-            return meeting_type_str::other;
-    }
-    return std::string();
+    return enumToStr(status);
 }
-
-std::string ChangeLog::meetingOutcomeToStr(Meeting::MeetingOutcome outcome)
+std::string_view ChangeLog::emailStatusToStr(EmailLetter::EmailStatus status)
 {
-    switch (outcome) {
-        case Meeting::MeetingOutcome::ClosedWon:
-            return meeting_outcome_str::closedWon;
-        case Meeting::MeetingOutcome::ClosedLost:
-            return meeting_outcome_str::closedLost;
-        case Meeting::MeetingOutcome::ProgressMade:
-            return meeting_outcome_str::progressMade;
-        case Meeting::MeetingOutcome::FollowUpScheduled:
-            return meeting_outcome_str::followUpScheduled;
-        case Meeting::MeetingOutcome::InformationProvided:
-            return meeting_outcome_str::informationProvided;
-        case Meeting::MeetingOutcome::DecisionPending:
-            return meeting_outcome_str::decisionPending;
-        case Meeting::MeetingOutcome::AdditionalInfoNeeded:
-            return meeting_outcome_str::additionalInfoNeeded;
-        case Meeting::MeetingOutcome::Postponed:
-            return meeting_outcome_str::postponed;
-        case Meeting::MeetingOutcome::Canceled:
-            return meeting_outcome_str::canceled;
-        case Meeting::MeetingOutcome::Redirected:
-            return meeting_outcome_str::redirected;
-        case Meeting::MeetingOutcome::IssueIdentified:
-            return meeting_outcome_str::issueIdentified;
-        case Meeting::MeetingOutcome::Other:
-            return meeting_outcome_str::other;
-    }
-    return std::string();
+    return enumToStr(status);
 }
-
-std::string ChangeLog::interactionResultStatusToStr(InteractionResult::ResultStatus restultStatus)
+std::string_view ChangeLog::emailLetterTypeToStr(EmailLetter::EmailLetterType type)
 {
-    switch (restultStatus) {
-        case InteractionResult::ResultStatus::Canceled:
-            return interaction_result_status_str::canceled;
-        case InteractionResult::ResultStatus::Failure:
-            return interaction_result_status_str::failure;
-        case InteractionResult::ResultStatus::FollowUpNeeded:
-            return interaction_result_status_str::followUpNeeded;
-        case InteractionResult::ResultStatus::IssueIdentified:
-            return interaction_result_status_str::issueIdentified;
-        case InteractionResult::ResultStatus::NoOutcome:
-            return interaction_result_status_str::noOutcome;
-        case InteractionResult::ResultStatus::other:
-            return interaction_result_status_str::other;
-        case InteractionResult::ResultStatus::PartialSuccess:
-            return interaction_result_status_str::partialSuccess;
-        case InteractionResult::ResultStatus::Postponed:
-            return interaction_result_status_str::postponed;
-        case InteractionResult::ResultStatus::Success:
-            return interaction_result_status_str::success;
-    }
-    return std::string();
+    return enumToStr(type);
 }
-
-std::string ChangeLog::emailStatusToStr(EmailLetter::EmailStatus status)
+std::string_view ChangeLog::interactionTypeToStr(BaseInteraction::InteractionType type)
 {
-    switch (status) {
-        case EmailLetter::EmailStatus::Delivered:
-            return email_status_str::delivered;
-        case EmailLetter::EmailStatus::Draft:
-            return email_status_str::draft;
-        case EmailLetter::EmailStatus::Failed:
-            return email_status_str::failed;
-        case EmailLetter::EmailStatus::Forwarded:
-            return email_status_str::forwarded;
-        case EmailLetter::EmailStatus::Replied:
-            return email_status_str::replied;
-        case EmailLetter::EmailStatus::Scheduled:
-            return email_status_str::scheduled;
-        case EmailLetter::EmailStatus::Sent:
-            return email_status_str::sent;
-    }
-    return std::string();
+    return enumToStr(type);
 }
-
-std::string ChangeLog::emailLetterTypeToStr(EmailLetter::EmailLetterType type)
+std::string_view ChangeLog::paymentStatusToStr(PaymentStatus status) { return enumToStr(status); }
+std::string_view ChangeLog::dealStatusToStr(Deal::Status status) { return enumToStr(status); }
+std::string_view ChangeLog::documentStatusToStr(Document::DocumentStatus status)
 {
-    switch (type) {
-        case EmailLetter::EmailLetterType::incoming:
-            return email_letter_type_str::incoming;
-        case EmailLetter::EmailLetterType::outgoing:
-            return email_letter_type_str::outgoing;
-    }
-    return std::string();
+    return enumToStr(status);
 }
-
-std::string ChangeLog::interactionTypeToStr(BaseInteraction::InteractionType type)
+std::string_view ChangeLog::taskStatusToStr(Task::Status status) { return enumToStr(status); }
+std::string_view ChangeLog::genderToStr(Gender gender) { return enumToStr(gender); }
+std::string_view ChangeLog::employeeStatusToStr(EmployeeStatus status) { return enumToStr(status); }
+std::string_view ChangeLog::accessLevelStr(AccessRole level) { return enumToStr(level); }
+std::string_view ChangeLog::clientTypeToStr(Client::ClientType type) { return enumToStr(type); }
+std::string_view ChangeLog::leadStatusToStr(Client::LeadStatus status) { return enumToStr(status); }
+std::string_view ChangeLog::leadSourceToStr(Client::LeadSource source) { return enumToStr(source); }
+std::string_view ChangeLog::companyTypeToStr(ExternalCompany::CompanyType type)
 {
-    switch (type) {
-        case BaseInteraction::InteractionType::commentarySocialNetworks:
-            return interaction_type_str::commentarySocialNetworks;
-        case BaseInteraction::InteractionType::commentarySocialNetworksThread:
-            return interaction_type_str::commentarySocialNetworksThread;
-        case BaseInteraction::InteractionType::correspondence:
-            return interaction_type_str::correspondence;
-        case BaseInteraction::InteractionType::emailLetter:
-            return interaction_type_str::emailLetter;
-        case BaseInteraction::InteractionType::emailThread:
-            return interaction_type_str::emailThread;
-        case BaseInteraction::InteractionType::meeting:
-            return interaction_type_str::meeting;
-        case BaseInteraction::InteractionType::meetingThread:
-            return interaction_type_str::meetingThread;
-        case BaseInteraction::InteractionType::message:
-            return interaction_type_str::message;
-        case BaseInteraction::InteractionType::phoneCall:
-            return interaction_type_str::phoneCall;
-        case BaseInteraction::InteractionType::unknown:
-            return interaction_type_str::unknown;
-    }
-    return std::string();
+    return enumToStr(type);
 }
-
-std::string ChangeLog::paymentStatusToStr(PaymentStatus status)
+std::string_view ChangeLog::companyRatingToStr(ExternalCompany::Rating rating)
 {
-    switch (status) {
-        case PaymentStatus::pending:
-            return payment_status_str::pending;
-        case PaymentStatus::completed:
-            return payment_status_str::completed;
-        case PaymentStatus::failed:
-            return payment_status_str::failed;
-        case PaymentStatus::refunded:
-            return payment_status_str::refunded;
-        case PaymentStatus::partial:
-            return payment_status_str::partial;
-        case PaymentStatus::overdue:
-            return payment_status_str::overdue;
-    }
-    return std::string();
+    return enumToStr(rating);
 }
-
-std::string ChangeLog::dealStatusToStr(Deal::Status status)
-{
-    switch (status) {
-        case Deal::Status::Draft:
-            return deal_status_str::draft;
-        case Deal::Status::ReadyForCoordination:
-            return deal_status_str::readyForCoordination;
-        case Deal::Status::ReadyForSigned:
-            return deal_status_str::readyForSigned;
-        case Deal::Status::Coordination:
-            return deal_status_str::coordination;
-        case Deal::Status::SignedByCounterparty:
-            return deal_status_str::signedByCounterparty;
-        case Deal::Status::SignedBySecondSide:
-            return deal_status_str::signedBySecondSide;
-        case Deal::Status::AllSigned:
-            return deal_status_str::allSigned;
-        case Deal::Status::Deleted:
-            return deal_status_str::deleted;
-        case Deal::Status::Canceled:
-            return deal_status_str::canceled;
-        case Deal::Status::Registered:
-            return deal_status_str::registered;
-        case Deal::Status::BeginningDealBroken:
-            return deal_status_str::beginningDealBroken;
-        case Deal::Status::EndDealBroken:
-            return deal_status_str::endDealBroken;
-        case Deal::Status::ObligationsAreProcess:
-            return deal_status_str::obligationsAreProcess;
-        case Deal::Status::ObligationsAreFulfilled:
-            return deal_status_str::obligationsAreFulfilled;
-        case Deal::Status::ObligationsAreNotFulfilled:
-            return deal_status_str::obligationsAreNotFulfilled;
-        case Deal::Status::Other:
-            return deal_status_str::other;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::documentStatusToStr(Document::DocumentStatus status)
-{
-    switch (status) {
-        case Document::DocumentStatus::Active:
-            return document_status_str::active;
-        case Document::DocumentStatus::Archived:
-            return document_status_str::archived;
-        case Document::DocumentStatus::Draft:
-            return document_status_str::draft;
-        case Document::DocumentStatus::Expired:
-            return document_status_str::expired;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::taskStatusToStr(Task::Status status)
-{
-    switch (status) {
-        case Task::Status::NotStarted:
-            return task_status_str::not_started;
-        case Task::Status::Completed:
-            return task_status_str::completed;
-        case Task::Status::InProgress:
-            return task_status_str::in_progress;
-        case Task::Status::Overdue:
-            return task_status_str::overdue;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::genderToStr(Gender gender)
-{
-    switch (gender) {
-        case Gender::female:
-            return gender_str::female;
-        case Gender::male:
-            return gender_str::male;
-        case Gender::unknown:
-            return gender_str::unknown;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::employeeStatusToStr(EmployeeStatus status)
-{
-    switch (status) {
-        case EmployeeStatus::active:
-            return employee_status_str::active;
-        case EmployeeStatus::vacation:
-            return employee_status_str::vacation;
-        case EmployeeStatus::fired:
-            return employee_status_str::fired;
-        case EmployeeStatus::education:
-            return employee_status_str::education;
-        case EmployeeStatus::internship:
-            return employee_status_str::internship;
-        case EmployeeStatus::probation:
-            return employee_status_str::probation;
-        case EmployeeStatus::suspended:
-            return employee_status_str::suspended;
-        case EmployeeStatus::sick_leave:
-            return employee_status_str::sick_leave;
-        case EmployeeStatus::retired:
-            return employee_status_str::retired;
-        case EmployeeStatus::other:
-            return employee_status_str::other;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::accessLevelStr(AccessRole level)
-{
-    switch (level) {
-        case AccessRole::Admin:
-            return access_level_str::admin;
-        case AccessRole::SalesRep:
-            return access_level_str::sales_rep;
-        case AccessRole::Executive:
-            return access_level_str::executive;
-        case AccessRole::Manager:
-            return access_level_str::manager;
-        case AccessRole::MarketingUser:
-            return access_level_str::marketing_user;
-        case AccessRole::ReadOnly:
-            return access_level_str::read_only;
-        case AccessRole::SalesManager:
-            return access_level_str::sales_manager;
-        case AccessRole::ServiceManager:
-            return access_level_str::service_manager;
-        case AccessRole::Support:
-            return access_level_str::support;
-        case AccessRole::DecisionMaker:
-            return access_level_str::decision_maker;
-        case AccessRole::Influencer:
-            return access_level_str::influencer;
-        case AccessRole::User:
-            return access_level_str::user;
-        case AccessRole::Gatekeeper:
-            return access_level_str::gatekeeper;
-        case AccessRole::other:
-            return access_level_str::other;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::clientTypeToStr(Client::ClientType type)
-{
-    switch (type) {
-        case Client::ClientType::Visitor:
-            return client_type_str::visitor;
-        case Client::ClientType::Lead:
-            return client_type_str::lead;
-        case Client::ClientType::Prospect:
-            return client_type_str::prospect;
-        case Client::ClientType::Costomer:
-            return client_type_str::customer;
-        case Client::ClientType::LoyalCostomer:
-            return client_type_str::loyal_customer;
-        case Client::ClientType::Panter:
-            return client_type_str::partner;
-        case Client::ClientType::PetentialClient:
-            return client_type_str::potential_client;
-        case Client::ClientType::LostCostomer:
-            return client_type_str::lost_customer;
-        case Client::ClientType::Analytical:
-            return client_type_str::analytical;
-        case Client::ClientType::Emotional:
-            return client_type_str::visitor;
-        case Client::ClientType::other:
-            return client_type_str::other;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::leadStatusToStr(Client::LeadStatus status)
-{
-    switch (status) {
-        case Client::LeadStatus::New:
-            return lead_status_str::new_;
-        case Client::LeadStatus::Open:
-            return lead_status_str::open;
-        case Client::LeadStatus::Working:
-            return lead_status_str::working;
-        case Client::LeadStatus::Qualified:
-            return lead_status_str::qualified;
-        case Client::LeadStatus::Unqualified:
-            return lead_status_str::unqualified;
-        case Client::LeadStatus::Converted:
-            return lead_status_str::converted;
-        case Client::LeadStatus::Closed:
-            return lead_status_str::closed;
-        case Client::LeadStatus::Disqualified:
-            return lead_status_str::disqualified;
-        case Client::LeadStatus::Nurturing:
-            return lead_status_str::nurturing;
-        case Client::LeadStatus::Lost:
-            return lead_status_str::lost;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::leadSourceToStr(Client::LeadSource source)
-{
-    switch (source) {
-        case Client::LeadSource::Website:
-            return lead_source_str::website;
-        case Client::LeadSource::Referral:
-            return lead_source_str::referral;
-        case Client::LeadSource::EmailCampaing:
-            return lead_source_str::email_campaign;
-        case Client::LeadSource::SocialMedia:
-            return lead_source_str::social_media;
-        case Client::LeadSource::other:
-            return lead_source_str::other;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::companyTypeToStr(ExternalCompany::CompanyType type)
+std::string_view ChangeLog::companyRiskLevelToStr(ExternalCompany::RiskLevel risk_level)
 {
-    switch (type) {
-        case ExternalCompany::CompanyType::Client:
-            return company_type_str::client;
-        case ExternalCompany::CompanyType::Partner:
-            return company_type_str::partner;
-        case ExternalCompany::CompanyType::Vendor:
-            return company_type_str::vendor;
-        case ExternalCompany::CompanyType::Prospect:
-            return company_type_str::prospect;
-        case ExternalCompany::CompanyType::Supplier:
-            return company_type_str::supplier;
-        case ExternalCompany::CompanyType::Other:
-            return company_type_str::other;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::companyRatingToStr(ExternalCompany::Rating rating)
-{
-    switch (rating) {
-        case ExternalCompany::Rating::Hot:
-            return rating_str::hot;
-        case ExternalCompany::Rating::Warm:
-            return rating_str::warm;
-        case ExternalCompany::Rating::Cold:
-            return rating_str::cold;
-        case ExternalCompany::Rating::Inactive:
-            return rating_str::inactive;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::companyRiskLevelToStr(ExternalCompany::RiskLevel risk_level)
-{
-    switch (risk_level) {
-        case ExternalCompany::RiskLevel::Low:
-            return risk_level_str::low;
-        case ExternalCompany::RiskLevel::Medium:
-            return risk_level_str::medium;
-        case ExternalCompany::RiskLevel::High:
-            return risk_level_str::high;
-        case ExternalCompany::RiskLevel::Critical:
-            return risk_level_str::critical;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::companyStatusToStr(Company::CompanyStatus status)
-{
-    switch (status) {
-        case Company::CompanyStatus::Active:
-            return company_status_str::active;
-        case Company::CompanyStatus::Archived:
-            return company_status_str::archived;
-        case Company::CompanyStatus::Inactive:
-            return company_status_str::inactive;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::companySizeToStr(ExternalCompany::CompanySize size)
-{
-    switch (size) {
-        case ExternalCompany::CompanySize::Enterprise:
-            return company_size_str::enterprise;
-        case ExternalCompany::CompanySize::Large:
-            return company_size_str::large;
-        case ExternalCompany::CompanySize::Medium:
-            return company_size_str::medium;
-        case ExternalCompany::CompanySize::Micro:
-            return company_size_str::micro;
-        case ExternalCompany::CompanySize::Small:
-            return company_size_str::small;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::companyComplianceLevelToStr(ExternalCompany::ComplianceLevel level)
-{
-    switch (level) {
-        case ExternalCompany::ComplianceLevel::Compliant:
-            return compliance_level_str::compliant;
-        case ExternalCompany::ComplianceLevel::NonCompliant:
-            return compliance_level_str::non_compliant;
-        case ExternalCompany::ComplianceLevel::Warning:
-            return compliance_level_str::warning;
-    }
-    return std::string();
+    return enumToStr(risk_level);
 }
-
-std::string ChangeLog::influenceLevelToStr(ExternalEmployee::InfluenceLevel level)
+std::string_view ChangeLog::companyStatusToStr(Company::CompanyStatus status)
 {
-    switch (level) {
-        case ExternalEmployee::InfluenceLevel::Critical:
-            return influence_level_str::critical;
-        case ExternalEmployee::InfluenceLevel::High:
-            return influence_level_str::high;
-        case ExternalEmployee::InfluenceLevel::Low:
-            return influence_level_str::low;
-        case ExternalEmployee::InfluenceLevel::Medium:
-            return influence_level_str::medium;
-        case ExternalEmployee::InfluenceLevel::VeryLow:
-            return influence_level_str::very_low;
-    }
-    return std::string();
+    return enumToStr(status);
 }
-
-std::string ChangeLog::integrationStatusToStr(ExternalCompany::IntegrationStatus status)
+std::string_view ChangeLog::companySizeToStr(ExternalCompany::CompanySize size)
 {
-    switch (status) {
-        case ExternalCompany::IntegrationStatus::Connected:
-            return integration_status_str::connected;
-        case ExternalCompany::IntegrationStatus::Failed:
-            return integration_status_str::failed;
-        case ExternalCompany::IntegrationStatus::Pending:
-            return integration_status_str::pending;
-    }
-    return std::string();
+    return enumToStr(size);
 }
-
-std::string ChangeLog::reportTypeToStr(ReportType type)
+std::string_view ChangeLog::companyComplianceLevelToStr(ExternalCompany::ComplianceLevel level)
 {
-    switch (type) {
-        case ReportType::SalesSummary:
-            return report_type_str::SalesSummary;
-        case ReportType::Pipeline:
-            return report_type_str::Pipeline;
-        case ReportType::RevenueByManager:
-            return report_type_str::RevenueByManager;
-        case ReportType::ClientActivity:
-            return report_type_str::ClientActivity;
-        case ReportType::ProductPerformance:
-            return report_type_str::ProductPerformance;
-        case ReportType::EmployeeKPI:
-            return report_type_str::EmployeeKPI;
-        case ReportType::InteractionSummary:
-            return report_type_str::InteractionSummary;
-        case ReportType::FinancialForecast:
-            return report_type_str::FinancialForecast;
-        case ReportType::other:
-            return report_type_str::other;
-    }
-    return std::string();
+    return enumToStr(level);
 }
-
-std::string ChangeLog::exportFormatToStr(ExportFormat format)
+std::string_view ChangeLog::influenceLevelToStr(ExternalEmployee::InfluenceLevel level)
 {
-    switch (format) {
-        case ExportFormat::CSV:
-            return export_format_str::CSV;
-        case ExportFormat::PDF:
-            return export_format_str::PDF;
-        case ExportFormat::JSON:
-            return export_format_str::JSON;
-        case ExportFormat::XLSX:
-            return export_format_str::XLSX;
-    }
-    return std::string();
+    return enumToStr(level);
 }
-
-std::string ChangeLog::campaignTypeToStr(CampaignType type)
+std::string_view ChangeLog::integrationStatusToStr(ExternalCompany::IntegrationStatus status)
 {
-    switch (type) {
-        case CampaignType::Email:
-            return campaign_type_str::email;
-        case CampaignType::Event:
-            return campaign_type_str::event;
-        case CampaignType::SocialAds:
-            return campaign_type_str::social_ads;
-        case CampaignType::Webinar:
-            return campaign_type_str::webinar;
-        case CampaignType::other:
-            return campaign_type_str::other;
-    }
-    return std::string();
-}
-
-std::string ChangeLog::caseStatusToStr(CaseStatus status)
-{
-    switch (status) {
-        case CaseStatus::Open:
-            return case_status_str::open;
-        case CaseStatus::Closed:
-            return case_status_str::closed;
-        case CaseStatus::InProgress:
-            return case_status_str::in_progress;
-        case CaseStatus::Resolved:
-            return case_status_str::resolved;
-    }
-    return std::string();
+    return enumToStr(status);
 }
+std::string_view ChangeLog::reportTypeToStr(ReportType type) { return enumToStr(type); }
+std::string_view ChangeLog::exportFormatToStr(ExportFormat format) { return enumToStr(format); }
+std::string_view ChangeLog::campaignTypeToStr(CampaignType type) { return enumToStr(type); }
+std::string_view ChangeLog::caseStatusToStr(CaseStatus status) { return enumToStr(status); }
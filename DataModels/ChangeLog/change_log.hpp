@@ -8,6 +8,7 @@
 #include "Campaign/campaign.hpp"
 #include "Campaign/campaign_lead.hpp"
 #include "Case/case.hpp"
+#include "ChangeLog/enum_tables.hpp"
 #include "ChangeLog/fields_enums.hpp"
 #include "Company/ExternalCompany/external_company.hpp"
 #include "Currencies/currencies.hpp"
@@ -36,6 +37,7 @@
  *
  * This structure logs changes such as additions, removals, or modifications to various fields,
  * including their types, old and new values, and the employee responsible for the change.
+ * Entries are built from `ChangeJournal` records when history is read.
  */
 class ChangeLog {
 public:
@@ -144,7 +146,7 @@ public:
         int,
         uint32_t,
         std::shared_ptr<PhoneNumber>,
-        std::shared_ptr<Date>,
+        Date,
         WeakPersonPtr,
         WeakClientPtr,
         std::shared_ptr<Meeting>,
@@ -159,7 +161,7 @@ public:
         std::shared_ptr<EmailLetter>,
         std::shared_ptr<Message>,
         std::shared_ptr<CommentarySocialNetworks>,
-        std::shared_ptr<TimeDuration>,
+        TimeDuration,
         std::shared_ptr<InteractionResult>,
         std::shared_ptr<Note>,
         std::shared_ptr<std::pair<std::weak_ptr<Person>, Money>>,
@@ -221,10 +223,15 @@ public:
     virtual ~ChangeLog();
 
     /// @name New/Old value to str
+    /// Text is built on every call and not kept on the entry; `ChangeRenderer` formats many
+    /// entries into one buffer.
     /// @{
-    StringPtr valueToStr(FieldType type, ValueVariant value, StringPtr& str);
-    StringPtr getOldValueStr();
-    StringPtr getNewValueStr();
+    /// Appends the text of `value` to `out`
+    static void writeValue(std::string& out, const FieldType type, const ValueVariant& value);
+    static auto valueToStr(const FieldType type, const std::optional<ValueVariant>& value)
+        -> StringPtr;
+    StringPtr getOldValueStr() const;
+    StringPtr getNewValueStr() const;
     /// @}
 
     /// @name Getters
@@ -234,6 +241,7 @@ public:
     auto getOldValue() const -> const std::optional<ValueVariant>&;
     auto getNewValue() const -> const std::optional<ValueVariant>&;
     auto getField() const -> const FieldVariant;
+    auto getFieldStr() const -> std::string_view;
     auto getOldValueFieldType() const -> FieldType;
     auto getNewValueFieldType() const -> FieldType;
     auto getAction() const -> Action;
@@ -242,8 +250,6 @@ public:
 private:
     std::weak_ptr<InternalEmployee> changer;
     Date                            change_date;
-    StringPtr                       old_value_str;
-    StringPtr                       new_value_str;
 
     std::optional<ValueVariant>     old_value;
     std::optional<ValueVariant>     new_value;
@@ -256,45 +262,51 @@ private:
 public:
     /// @name Enums value to str
     /// @{
-    static std::string callTypeToStr(PhoneCallData::CallType type);
-    static std::string meetingStatusToStr(Meeting::MeetingStatus status);
-    static std::string meetingTypeToStr(Meeting::MeetingType type);
-    static std::string meetingOutcomeToStr(Meeting::MeetingOutcome outcome);
-    static std::string interactionResultStatusToStr(InteractionResult::ResultStatus restultStatus);
-    static std::string emailStatusToStr(EmailLetter::EmailStatus status);
-    static std::string emailLetterTypeToStr(EmailLetter::EmailLetterType type);
-    static std::string interactionTypeToStr(BaseInteraction::InteractionType type);
-    static std::string paymentStatusToStr(PaymentStatus status);
-    static std::string dealStatusToStr(Deal::Status status);
-    static std::string documentStatusToStr(Document::DocumentStatus status);
-    static std::string taskStatusToStr(Task::Status status);
-    static std::string genderToStr(Gender gender);
-    static std::string employeeStatusToStr(EmployeeStatus status);
-    static std::string accessLevelStr(AccessRole level);
-    static std::string clientTypeToStr(Client::ClientType type);
-    static std::string leadStatusToStr(Client::LeadStatus status);
-    static std::string leadSourceToStr(Client::LeadSource source);
-    static std::string companyTypeToStr(ExternalCompany::CompanyType type);
-    static std::string companyRatingToStr(ExternalCompany::Rating rating);
-    static std::string companyRiskLevelToStr(ExternalCompany::RiskLevel risk_level);
-    static std::string companyStatusToStr(Company::CompanyStatus status);
-    static std::string companySizeToStr(ExternalCompany::CompanySize size);
-    static std::string companyComplianceLevelToStr(ExternalCompany::ComplianceLevel level);
-    static std::string influenceLevelToStr(ExternalEmployee::InfluenceLevel level);
-    static std::string integrationStatusToStr(ExternalCompany::IntegrationStatus status);
-    static std::string reportTypeToStr(ReportType type);
-    static std::string exportFormatToStr(ExportFormat format);
-    static std::string campaignTypeToStr(CampaignType type);
-    static std::string caseStatusToStr(CaseStatus status);
+    static std::string_view callTypeToStr(PhoneCallData::CallType type);
+    static std::string_view meetingStatusToStr(Meeting::MeetingStatus status);
+    static std::string_view meetingTypeToStr(Meeting::MeetingType type);
+    static std::string_view meetingOutcomeToStr(Meeting::MeetingOutcome outcome);
+    static std::string_view interactionResultStatusToStr(InteractionResult::ResultStatus status);
+    static std::string_view emailStatusToStr(EmailLetter::EmailStatus status);
+    static std::string_view emailLetterTypeToStr(EmailLetter::EmailLetterType type);
+    static std::string_view interactionTypeToStr(BaseInteraction::InteractionType type);
+    static std::string_view paymentStatusToStr(PaymentStatus status);
+    static std::string_view dealStatusToStr(Deal::Status status);
+    static std::string_view documentStatusToStr(Document::DocumentStatus status);
+    static std::string_view taskStatusToStr(Task::Status status);
+    static std::string_view genderToStr(Gender gender);
+    static std::string_view employeeStatusToStr(EmployeeStatus status);
+    static std::string_view accessLevelStr(AccessRole level);
+    static std::string_view clientTypeToStr(Client::ClientType type);
+    static std::string_view leadStatusToStr(Client::LeadStatus status);
+    static std::string_view leadSourceToStr(Client::LeadSource source);
+    static std::string_view companyTypeToStr(ExternalCompany::CompanyType type);
+    static std::string_view companyRatingToStr(ExternalCompany::Rating rating);
+    static std::string_view companyRiskLevelToStr(ExternalCompany::RiskLevel risk_level);
+    static std::string_view companyStatusToStr(Company::CompanyStatus status);
+    static std::string_view companySizeToStr(ExternalCompany::CompanySize size);
+    static std::string_view companyComplianceLevelToStr(ExternalCompany::ComplianceLevel level);
+    static std::string_view influenceLevelToStr(ExternalEmployee::InfluenceLevel level);
+    static std::string_view integrationStatusToStr(ExternalCompany::IntegrationStatus status);
+    static std::string_view reportTypeToStr(ReportType type);
+    static std::string_view exportFormatToStr(ExportFormat format);
+    static std::string_view campaignTypeToStr(CampaignType type);
+    static std::string_view caseStatusToStr(CaseStatus status);
     /// @}
 };
 
 #define PTR_TO_OPTIONAL(ptr) \
     (ptr == nullptr ? std::nullopt : std::make_optional<ChangeLog::ValueVariant>(ptr))
 
+#define OPTIONAL_TO_VALUE(opt) \
+    (opt ? std::make_optional<ChangeLog::ValueVariant>(*opt) : std::nullopt)
+
 #define WEAK_PTR_TO_OPTIONAL(ptr) \
     (ptr.lock() == nullptr ? std::nullopt : std::make_optional<ChangeLog::ValueVariant>(ptr))
 
-#define OPTIONAL_STR_TO_VALUE(STR)      \
-    (STR == std::nullopt ? std::nullopt \
-                         : std::make_optional(std::make_shared<std::string>(STR.value())))
\ No newline at end of file
+template <>
+struct EnumStrings<ChangeLog::Action> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        change_action_str::add, change_action_str::remove, change_action_str::change
+    });
+};
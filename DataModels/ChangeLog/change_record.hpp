@@ -0,0 +1,34 @@
+#pragma once
+#include <stdint.h>
+
+#include "ChangeLog/change_chain.hpp"
+#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_value.hpp"
+
+/**
+ * @struct ChangeRecord
+ * @brief One change as `ChangeJournal` stores it, 64 bytes (one cache line).
+ *
+ * The values point into the journal's storage, or into a block of `ChangeArchive` once the
+ * record has been paged back in from disk.
+ */
+struct ChangeRecord {
+    ChangeValue          old_value;
+    ChangeValue          new_value;
+    uint32_t             entity;
+    ChangeChain::Offset  prev;        ///< Previous record of the entity, or npos
+    uint32_t             changer;     ///< Index in the journal's changers, or npos
+    int32_t              minutes;     ///< `Date::getMinutes()` of the change
+    uint8_t              field_kind;  ///< Alternative of `ChangeLog::FieldVariant`
+    uint8_t              field;       ///< Enum value inside that alternative
+    ChangeLog::FieldType old_type;
+    ChangeLog::FieldType new_type;
+    ChangeLog::Action    action;
+    /// Written to a segment by `ChangeJournal::compact`, or dropped by `ChangeJournal::drop`.
+    /// Either way the record no longer keeps its chunk in memory.
+    bool     archived = false;
+    uint16_t tenant   = 0;  ///< `TenantScope` the change was made in
+    /// Type of the changed entity, which the field kind alone does not tell (clients and
+    /// employees share `PersonFields`)
+    EntityType entity_type = EntityType::other;
+};
@@ -0,0 +1,162 @@
+#include "change_renderer.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "location.hpp"
+
+namespace {
+    auto fieldName(const ChangeJournal::Record& record) -> std::string_view
+    {
+        return std::visit(
+            [](auto field) { return enumToStr(field); }, ChangeJournal::getField(record)
+        );
+    }
+
+    /// Replaces the column and row separators of `write` in [first, end of out)
+    void flatten(std::string& out, const size_t first)
+    {
+        std::replace_if(
+            out.begin() + first,
+            out.end(),
+            [](char ch) { return ch == '\t' || ch == '\n' || ch == '\r'; },
+            ' '
+        );
+    }
+}  // namespace
+
+auto ChangeTable::size() const -> size_t { return this->entries.size(); }
+auto ChangeTable::empty() const -> bool { return this->entries.empty(); }
+
+auto ChangeTable::operator[](const size_t index) const -> Row
+{
+    if (index >= this->entries.size()) throw std::out_of_range(errors::unknown_change);
+
+    const Entry&          entry  = this->entries[index];
+    ChangeJournal::Record record = this->journal->getRecord(entry.offset);
+    return Row{
+        entry.offset,
+        Date::fromMinutes(record.minutes),
+        record.action,
+        fieldName(record),
+        this->view(entry.changer),
+        this->view(entry.old_value),
+        this->view(entry.new_value)
+    };
+}
+
+auto ChangeTable::text() const -> std::string_view { return this->buffer; }
+
+auto ChangeTable::view(const Span span) const -> std::string_view
+{
+    return std::string_view(this->buffer).substr(span.begin, span.size);
+}
+
+ChangeRenderer::ChangeRenderer(const ChangeJournal& journal) : journal(journal) {}
+
+auto ChangeRenderer::render(const std::span<const ChangeChain::Offset> offsets) const
+    -> ChangeTable
+{
+    ChangeTable table;
+    table.journal = &this->journal;
+    table.entries.reserve(offsets.size());
+
+    std::unordered_map<uint32_t, ChangeTable::Span> changers;
+    auto append = [&table](auto&& write) {
+        ChangeTable::Span span;
+        span.begin = static_cast<uint32_t>(table.buffer.size());
+        write(table.buffer);
+        span.size = static_cast<uint32_t>(table.buffer.size() - span.begin);
+        return span;
+    };
+
+    for (ChangeChain::Offset offset : offsets) {
+        ChangeTable::Entry    entry;
+        ChangeJournal::Record record;
+        entry.offset = offset;
+        this->journal.readRecord(offset, [&](const ChangeJournal::Record& stored) {
+            record          = stored;
+            entry.old_value = append([&](std::string& out) {
+                writeValue(out, stored.old_type, stored.old_value);
+            });
+            entry.new_value = append([&](std::string& out) {
+                writeValue(out, stored.new_type, stored.new_value);
+            });
+        });
+        // the changer is looked up outside `readRecord`, which holds the journal's lock
+        if (record.changer != ChangeChain::npos) {
+            auto [it, added] = changers.try_emplace(record.changer);
+            if (added) {
+                it->second = append([&](std::string& out) { this->writeChanger(out, record); });
+            }
+            entry.changer = it->second;
+        }
+        table.entries.push_back(entry);
+    }
+    return table;
+}
+
+void ChangeRenderer::write(const std::span<const ChangeChain::Offset> offsets, const Sink& sink)
+{
+    this->block.clear();
+    this->block.reserve(block_size + block_size / 4);
+
+    std::string values;  // old and new value of the current record
+    for (ChangeChain::Offset offset : offsets) {
+        ChangeJournal::Record record;
+        size_t                split = 0;
+        values.clear();
+        this->journal.readRecord(offset, [&](const ChangeJournal::Record& stored) {
+            record = stored;
+            writeValue(values, stored.old_type, stored.old_value);
+            split = values.size();
+            writeValue(values, stored.new_type, stored.new_value);
+        });
+
+        this->block.append(Date::fromMinutes(record.minutes).getDateStr()).append(1, '\t');
+        this->writeChanger(this->block, record);
+        this->block.append(1, '\t').append(fieldName(record)).append(1, '\t');
+        this->block.append(enumToStr(record.action)).append(1, '\t');
+
+        size_t first = this->block.size();
+        this->block.append(values, 0, split);
+        flatten(this->block, first);
+        this->block.append(1, '\t');
+
+        first = this->block.size();
+        this->block.append(values, split);
+        flatten(this->block, first);
+        this->block.append(1, '\n');
+
+        if (this->block.size() >= block_size) {
+            sink(this->block);
+            this->block.clear();
+        }
+    }
+    if (!this->block.empty()) sink(this->block);
+}
+
+void ChangeRenderer::writeValue(
+    std::string& out, const ChangeLog::FieldType type, const ChangeValue& value
+)
+{
+    if (value.empty() || type == ChangeLog::FieldType::null) return;
+    if (value.getKind() == ChangeValue::Kind::Text) {
+        out.append(value.getText());
+        return;
+    }
+    ChangeLog::writeValue(out, type, *value.toVariant());
+}
+
+void ChangeRenderer::writeChanger(std::string& out, const ChangeJournal::Record& record) const
+{
+    if (record.changer == ChangeChain::npos) return;
+
+    auto changer = this->journal.getChanger(record).lock();
+    if (changer == nullptr) {
+        out.append(warning::internal_employee_removed);
+        return;
+    }
+    out.append(changer->getName()).append(1, ' ').append(changer->getSurname());
+}
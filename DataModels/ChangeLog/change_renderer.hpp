@@ -0,0 +1,91 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ChangeLog/change_journal.hpp"
+
+/**
+ * @class ChangeTable
+ * @brief Text of a batch of journal records kept in one buffer.
+ *
+ * Rows are views into the buffer, so a table of any size holds two allocations. Rows of the
+ * same changer share the changer's text.
+ */
+class ChangeTable {
+public:
+    struct Row {
+        ChangeChain::Offset offset;
+        Date                change_date;
+        ChangeLog::Action   action;
+        std::string_view    field;
+        std::string_view    changer;  ///< Empty when nobody is recorded
+        std::string_view    old_value;
+        std::string_view    new_value;
+    };
+
+    auto size() const -> size_t;
+    auto empty() const -> bool;
+    auto operator[](const size_t index) const -> Row;
+    /// All the text of the batch
+    auto text() const -> std::string_view;
+
+private:
+    friend class ChangeRenderer;
+
+    struct Span {
+        uint32_t begin = 0;
+        uint32_t size  = 0;
+    };
+    struct Entry {
+        ChangeChain::Offset offset;
+        Span                changer;
+        Span                old_value;
+        Span                new_value;
+    };
+
+    const ChangeJournal* journal = nullptr;
+    std::string          buffer;
+    std::vector<Entry>   entries;
+
+    auto view(const Span span) const -> std::string_view;
+};
+
+/**
+ * @class ChangeRenderer
+ * @brief Formats journal records as text in batches.
+ *
+ * Values are read straight from the records: text is copied from the journal arena, other
+ * values are written into the output buffer by `ChangeLog::writeValue`. No `ChangeLog` is built
+ * and nothing is cached, the caller owns every byte of output.
+ */
+class ChangeRenderer {
+public:
+    /// Receives the text of `write` block by block
+    using Sink = std::function<void(std::string_view)>;
+
+    static constexpr size_t block_size = 64 * 1024;
+
+    explicit ChangeRenderer(const ChangeJournal& journal = ChangeJournal::getInstance());
+
+    /// Rows for `offsets`, in the same order
+    auto render(const std::span<const ChangeChain::Offset> offsets) const -> ChangeTable;
+    /// Writes "date \t changer \t field \t action \t old \t new \n" per record and hands the
+    /// text to `sink` in blocks of about `block_size` bytes. Tabs and line breaks inside values
+    /// are written as spaces. The block buffer is reused by later calls.
+    void write(const std::span<const ChangeChain::Offset> offsets, const Sink& sink);
+
+    /// Appends the text of `value` to `out`
+    static void writeValue(std::string& out, ChangeLog::FieldType type, const ChangeValue& value);
+
+private:
+    const ChangeJournal& journal;
+    std::string          block;
+
+    void writeChanger(std::string& out, const ChangeJournal::Record& record) const;
+};
@@ -0,0 +1,269 @@
+#include "change_stream.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+#include <bit>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+#include "location.hpp"
+
+namespace {
+    /// Ids too wide for an event, numbered in the order they were first published. Never
+    /// shrinks, wide ids are rare.
+    class WideIds {
+    public:
+        static WideIds& getInstance()
+        {
+            static WideIds instance;
+            return instance;
+        }
+
+        auto number(const BigUint& id) -> uint64_t
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            auto [it, added] = this->numbers.try_emplace(id, this->ids.size());
+            if (added) this->ids.push_back(id);
+            return it->second;
+        }
+        auto get(const uint64_t number) const -> BigUint
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (number >= this->ids.size()) throw std::out_of_range(errors::unknown_wide_id);
+            return this->ids[number];
+        }
+
+    private:
+        mutable std::mutex                    mutex;
+        std::deque<BigUint>                   ids;
+        std::unordered_map<BigUint, uint64_t> numbers;
+    };
+
+    void setId(ChangeEvent& event, const BigUint& id)
+    {
+        event.wide_id = id.isWide();
+        event.id      = event.wide_id ? WideIds::getInstance().number(id) : id.getLow();
+    }
+}  // namespace
+
+auto ChangeEvent::change(
+    const ChangeChain::Offset offset,
+    const ChangeChain&        chain,
+    const uint8_t             field_kind,
+    const int32_t             minutes
+) -> ChangeEvent
+{
+    ChangeEvent event;
+    setId(event, chain.id);
+    event.offset      = offset;
+    event.minutes     = minutes;
+    event.type        = Type::Change;
+    event.entity_type = chain.type;
+    event.field_kind  = field_kind;
+    return event;
+}
+
+auto ChangeEvent::entity(
+    const Type type, const EntityType entity_type, const BigUint& id, const Date& date
+) -> ChangeEvent
+{
+    ChangeEvent event;
+    setId(event, id);
+    event.minutes     = date.getMinutes();
+    event.type        = type;
+    event.entity_type = entity_type;
+    return event;
+}
+
+auto ChangeEvent::getId() const -> BigUint
+{
+    if (this->wide_id) return WideIds::getInstance().get(this->id);
+    return BigUint(this->id);
+}
+
+ChangeStream& ChangeStream::getInstance()
+{
+    static ChangeStream instance;
+    return instance;
+}
+
+ChangeStream::ChangeStream(const size_t capacity, const Overflow overflow)
+    : mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+      overflow(overflow),
+      slots(std::make_unique<Slot[]>(this->mask + 1))
+{
+}
+
+auto ChangeStream::publish(ChangeEvent event) -> uint64_t
+{
+    uint64_t sequence = this->head.fetch_add(1, std::memory_order_relaxed);
+    uint64_t capacity = this->mask + 1;
+    Slot&    slot     = this->slots[sequence & this->mask];
+    event.sequence    = sequence;
+
+    if (sequence >= capacity) {
+        uint64_t reused = sequence - capacity;
+        bool     waited = false;
+        // the producer of the previous lap may not have finished this slot yet
+        while (slot.sequence.load(std::memory_order_acquire) != reused + 1) {
+            waited = true;
+            std::this_thread::yield();
+        }
+        if (this->overflow == Overflow::Wait) {
+            while (this->minCursor() <= reused) {
+                waited = true;
+                std::this_thread::yield();
+            }
+        }
+        if (waited) this->waits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t words[event_words];
+    memcpy(words, &event, sizeof(event));
+
+    slot.sequence.store(writing, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < event_words; i++) {
+        slot.words[i].store(words[i], std::memory_order_relaxed);
+    }
+    slot.sequence.store(sequence + 1, std::memory_order_release);
+    return sequence;
+}
+
+auto ChangeStream::subscribe() -> ChangeSubscription
+{
+    for (size_t i = 0; i < max_subscribers; i++) {
+        bool expected = false;
+        if (this->cursors[i].active.compare_exchange_strong(expected, true)) {
+            this->cursors[i].position.store(
+                this->head.load(std::memory_order_acquire), std::memory_order_release
+            );
+            return ChangeSubscription(this, i);
+        }
+    }
+    throw std::length_error(errors::stream_subscribers_full);
+}
+
+auto ChangeStream::getCapacity() const -> size_t { return this->mask + 1; }
+auto ChangeStream::getOverflow() const -> Overflow { return this->overflow; }
+
+auto ChangeStream::getStats() const -> Stats
+{
+    Stats stats{};
+    stats.published = this->head.load(std::memory_order_acquire);
+    stats.capacity  = this->mask + 1;
+    stats.waits     = this->waits.load(std::memory_order_relaxed);
+    stats.dropped   = this->dropped.load(std::memory_order_relaxed);
+    for (const Cursor& cursor : this->cursors) {
+        if (!cursor.active.load(std::memory_order_acquire)) continue;
+        uint64_t position = cursor.position.load(std::memory_order_acquire);
+        stats.subscribers++;
+        uint64_t lag  = stats.published - std::min(position, stats.published);
+        stats.max_lag = std::max(stats.max_lag, lag);
+    }
+    return stats;
+}
+
+auto ChangeStream::minCursor() const -> uint64_t
+{
+    uint64_t result = this->head.load(std::memory_order_acquire);
+    for (const Cursor& cursor : this->cursors) {
+        if (!cursor.active.load(std::memory_order_acquire)) continue;
+        result = std::min(result, cursor.position.load(std::memory_order_acquire));
+    }
+    return result;
+}
+
+ChangeSubscription::ChangeSubscription(ChangeStream* stream, const size_t cursor)
+    : stream(stream), cursor(cursor)
+{
+}
+
+ChangeSubscription::ChangeSubscription(ChangeSubscription&& other) noexcept
+    : stream(other.stream), cursor(other.cursor), dropped(other.dropped)
+{
+    other.stream = nullptr;
+}
+
+ChangeSubscription& ChangeSubscription::operator=(ChangeSubscription&& other) noexcept
+{
+    if (this != &other) {
+        this->release();
+        this->stream  = other.stream;
+        this->cursor  = other.cursor;
+        this->dropped = other.dropped;
+        other.stream  = nullptr;
+    }
+    return *this;
+}
+
+ChangeSubscription::~ChangeSubscription() { this->release(); }
+
+auto ChangeSubscription::read(const std::span<ChangeEvent> out) -> size_t
+{
+    if (this->stream == nullptr) return 0;
+
+    auto&    position = this->stream->cursors[this->cursor].position;
+    uint64_t next     = position.load(std::memory_order_relaxed);
+    uint64_t capacity = this->stream->mask + 1;
+    size_t   count    = 0;
+
+    while (count < out.size()) {
+        const auto& slot  = this->stream->slots[next & this->stream->mask];
+        uint64_t    first = slot.sequence.load(std::memory_order_acquire);
+
+        uint64_t words[ChangeStream::event_words];
+        for (size_t i = 0; i < ChangeStream::event_words; i++) {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        uint64_t second = slot.sequence.load(std::memory_order_relaxed);
+
+        if (first == next + 1 && second == first) {
+            memcpy(&out[count++], words, sizeof(ChangeEvent));
+            next++;
+            continue;
+        }
+        // a slot being written or not reached yet is only lost if a later lap claimed it. Under
+        // `Wait` that lap waits for this cursor, so nothing is lost however far `head` ran.
+        if (this->stream->overflow == ChangeStream::Overflow::Wait) break;
+        uint64_t head = this->stream->head.load(std::memory_order_acquire);
+        if (head <= next + capacity) break;
+
+        uint64_t skipped = head - capacity - next;
+        this->dropped += skipped;
+        this->stream->dropped.fetch_add(skipped, std::memory_order_relaxed);
+        next = head - capacity;
+    }
+    position.store(next, std::memory_order_release);
+    return count;
+}
+
+auto ChangeSubscription::active() const -> bool { return this->stream != nullptr; }
+
+auto ChangeSubscription::getPosition() const -> uint64_t
+{
+    if (this->stream == nullptr) return 0;
+    return this->stream->cursors[this->cursor].position.load(std::memory_order_relaxed);
+}
+
+auto ChangeSubscription::getLag() const -> uint64_t
+{
+    if (this->stream == nullptr) return 0;
+    uint64_t head     = this->stream->head.load(std::memory_order_acquire);
+    uint64_t position = this->getPosition();
+    return head > position ? head - position : 0;
+}
+
+auto ChangeSubscription::getDropped() const -> uint64_t { return this->dropped; }
+
+void ChangeSubscription::release()
+{
+    if (this->stream == nullptr) return;
+    this->stream->cursors[this->cursor].active.store(false, std::memory_order_release);
+    this->stream = nullptr;
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+#include "BigNum/big_uint.hpp"
+#include "ChangeLog/change_chain.hpp"
+#include "DateTime/date.hpp"
+
+/**
+ * @struct ChangeEvent
+ * @brief One mutation as the change stream delivers it, 32 bytes.
+ *
+ * A `Change` is a record appended to the `ChangeJournal`; `Add`, `SoftRemove` and `HardRemove`
+ * come from the data bases. Every event names its entity by type and id. Ids wider than 64 bits
+ * do not fit the event: it holds a number that `getId` turns back into the id.
+ */
+struct ChangeEvent {
+    enum class Type : uint8_t { Change, Add, SoftRemove, HardRemove };
+
+    uint64_t            sequence    = 0;  ///< Position in the stream, set by `publish`
+    uint64_t            id          = 0;  ///< Entity id, or the number of a wide one
+    ChangeChain::Offset offset      = ChangeChain::npos;  ///< Journal record of a change
+    int32_t             minutes     = 0;  ///< `Date::getMinutes()` of the event
+    Type                type        = Type::Change;
+    EntityType          entity_type = EntityType::other;
+    uint8_t             field_kind  = 0;      ///< Alternative of `ChangeLog::FieldVariant`
+    bool                wide_id     = false;  ///< `id` is the number of a wide id
+
+    static auto change(
+        const ChangeChain::Offset offset,
+        const ChangeChain&        chain,
+        const uint8_t             field_kind,
+        const int32_t             minutes
+    ) -> ChangeEvent;
+    static auto entity(
+        const Type type, const EntityType entity_type, const BigUint& id, const Date& date = Date()
+    ) -> ChangeEvent;
+
+    /// Id of the entity, wide ones included
+    auto getId() const -> BigUint;
+};
+
+static_assert(sizeof(ChangeEvent) == 32 && std::is_trivially_copyable_v<ChangeEvent>);
+
+class ChangeSubscription;
+
+/**
+ * @class ChangeStream
+ * @brief Change-data-capture feed of every journal record and data base add or removal.
+ *
+ * Events go into a ring buffer that every subscriber reads at its own cursor, in batches and
+ * without locks: producers claim a sequence with one atomic add and publish the slot under a
+ * per-slot sequence number, readers copy a slot and check that number did not move. Under
+ * `Overflow::Overwrite` producers never wait and a subscriber a whole buffer behind skips
+ * ahead, counting what it lost; under `Overflow::Wait` producers wait for the slowest
+ * subscriber instead. `getStats` reports the lag and both kinds of pressure. Models know
+ * nothing of their tenant, so the journal and the data bases publish to one stream per process.
+ */
+class ChangeStream {
+public:
+    enum class Overflow : uint8_t {
+        Overwrite,  ///< Slow subscribers lose the oldest events
+        Wait        ///< Producers wait until every subscriber has read the slot they reuse
+    };
+
+    struct Stats {
+        uint64_t published;    ///< Sequences claimed so far
+        uint64_t capacity;
+        uint32_t subscribers;
+        uint64_t max_lag;      ///< Events the slowest subscriber has still to read
+        uint64_t waits;        ///< Times a producer waited for a subscriber
+        uint64_t dropped;      ///< Events subscribers skipped because they were overwritten
+    };
+
+    static constexpr size_t max_subscribers  = 64;
+    static constexpr size_t default_capacity = 16 * 1024;
+
+    /// Stream the journal and the data bases publish to
+    static ChangeStream& getInstance();
+
+    /// `capacity` is rounded up to a power of two
+    explicit ChangeStream(
+        const size_t capacity = default_capacity, const Overflow overflow = Overflow::Overwrite
+    );
+
+    ChangeStream(const ChangeStream&)            = delete;
+    ChangeStream& operator=(const ChangeStream&) = delete;
+
+    /// Returns the sequence given to the event
+    auto publish(ChangeEvent event) -> uint64_t;
+    /// Subscriber that reads the events published from now on; throws `std::length_error`
+    /// when `max_subscribers` are subscribed
+    auto subscribe() -> ChangeSubscription;
+
+    /// @name Getters
+    /// @{
+    auto getCapacity() const -> size_t;
+    auto getOverflow() const -> Overflow;
+    auto getStats() const -> Stats;
+    /// @}
+
+private:
+    friend class ChangeSubscription;
+
+    static constexpr size_t   event_words = sizeof(ChangeEvent) / sizeof(uint64_t);
+    static constexpr uint64_t writing     = UINT64_MAX;  ///< Sequence of a slot being written
+
+    struct Slot {
+        std::atomic<uint64_t>                          sequence{0};  ///< Published seq + 1
+        std::array<std::atomic<uint64_t>, event_words> words{};
+    };
+    struct alignas(64) Cursor {
+        std::atomic<bool>     active{false};
+        std::atomic<uint64_t> position{0};  ///< Next sequence to read
+    };
+
+    const size_t                        mask;
+    const Overflow                      overflow;
+    std::unique_ptr<Slot[]>             slots;
+    std::array<Cursor, max_subscribers> cursors;
+    alignas(64) std::atomic<uint64_t>   head{0};  ///< Next sequence to claim
+    std::atomic<uint64_t>               waits{0};
+    std::atomic<uint64_t>               dropped{0};
+
+    /// Lowest cursor of the active subscribers, `head` if there is none
+    auto minCursor() const -> uint64_t;
+};
+
+/**
+ * @class ChangeSubscription
+ * @brief One subscriber's cursor in a `ChangeStream`, released when the object is destroyed.
+ *
+ * A subscription is read by one thread at a time; different subscriptions need no locking.
+ */
+class ChangeSubscription {
+public:
+    ChangeSubscription() = default;
+    ChangeSubscription(ChangeSubscription&& other) noexcept;
+    ChangeSubscription& operator=(ChangeSubscription&& other) noexcept;
+    ~ChangeSubscription();
+
+    /// Copies the next events, oldest first, into `out` and returns how many. Never waits:
+    /// stops at the first event that is not published yet.
+    auto read(std::span<ChangeEvent> out) -> size_t;
+
+    /// @name Getters
+    /// @{
+    auto active() const -> bool;
+    auto getPosition() const -> uint64_t;
+    /// Events published but not read yet
+    auto getLag() const -> uint64_t;
+    /// Events this subscriber skipped because they were overwritten before it read them
+    auto getDropped() const -> uint64_t;
+    /// @}
+
+private:
+    friend class ChangeStream;
+
+    ChangeSubscription(ChangeStream* stream, const size_t cursor);
+    void release();
+
+    ChangeStream* stream  = nullptr;
+    size_t        cursor  = 0;
+    uint64_t      dropped = 0;
+};
@@ -0,0 +1,123 @@
+#include "change_value.hpp"
+
+#include <array>
+#include <memory>
+#include <utility>
+
+namespace {
+    using ValueVariant = ChangeLog::ValueVariant;
+
+    template <typename T>
+    auto fromInteger(const int64_t value) -> T
+    {
+        if constexpr (std::is_same_v<T, Date>) {
+            return Date::fromMinutes(static_cast<int32_t>(value));
+        } else if constexpr (std::is_same_v<T, TimeDuration>) {
+            return TimeDuration::fromSeconds(value);
+        } else if constexpr (std::is_same_v<T, Currencies>) {
+            if (value < currency_table::crypto_base) {
+                return static_cast<CountriesCurrencies>(value);
+            }
+            return static_cast<CryptoCurrency>(value - currency_table::crypto_base);
+        } else {
+            return static_cast<T>(value);
+        }
+    }
+
+    using Decoder = ValueVariant (*)(const ChangeValue&);
+
+    template <size_t... I>
+    constexpr auto makeDecoders(std::index_sequence<I...>)
+    {
+        return std::array<Decoder, sizeof...(I)>{[](const ChangeValue& value) -> ValueVariant {
+            using T = std::variant_alternative_t<I, ValueVariant>;
+            if constexpr (std::is_same_v<T, double>) {
+                return ValueVariant(std::in_place_index<I>, value.getReal());
+            } else if constexpr (change_value::is_integer<T>) {
+                return ValueVariant(std::in_place_index<I>, fromInteger<T>(value.getInteger()));
+            } else {
+                if constexpr (std::is_same_v<T, StringPtr>) {
+                    if (value.getKind() == ChangeValue::Kind::Text) {
+                        return std::make_shared<std::string>(value.getText());
+                    }
+                }
+                return ValueVariant(
+                    std::in_place_index<I>, *static_cast<const T*>(value.getObject())
+                );
+            }
+        }...};
+    }
+
+    /// Rebuilds the alternative `ChangeValue::getAlternative()` names
+    constexpr auto decoders =
+        makeDecoders(std::make_index_sequence<std::variant_size_v<ValueVariant>>());
+
+    template <typename T>
+    struct IsWeak : std::false_type {};
+    template <typename T>
+    struct IsWeak<std::weak_ptr<T>> : std::true_type {};
+
+    using SameObject = bool (*)(const void*, const void*);
+
+    template <size_t... I>
+    constexpr auto makeSameObjects(std::index_sequence<I...>)
+    {
+        return std::array<SameObject, sizeof...(I)>{[](const void* first, const void* second) {
+            using T = std::variant_alternative_t<I, ValueVariant>;
+            if constexpr (change_value::is_integer<T> || std::is_same_v<T, double>) {
+                return false;  // never stored as an object
+            } else if constexpr (IsWeak<T>::value) {
+                // owners are compared, so expired pointers still match their own object
+                auto& lhs = *static_cast<const T*>(first);
+                auto& rhs = *static_cast<const T*>(second);
+                return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+            } else {
+                return *static_cast<const T*>(first) == *static_cast<const T*>(second);
+            }
+        }...};
+    }
+
+    /// Identity of the objects of the alternative `ChangeValue::getAlternative()` names
+    constexpr auto same_objects =
+        makeSameObjects(std::make_index_sequence<std::variant_size_v<ValueVariant>>());
+}  // namespace
+
+ChangeValue::ChangeValue(const std::optional<ChangeLog::ValueVariant>& value)
+{
+    if (value) std::visit([this](const auto& alternative) { this->assign(alternative); }, *value);
+}
+
+auto ChangeValue::fromText(const std::string_view text) -> ChangeValue
+{
+    ChangeValue value;
+    value.kind        = Kind::Text;
+    value.alternative = static_cast<uint8_t>(change_value::alternative_index<StringPtr>);
+    value.text        = text.data();
+    value.size        = static_cast<uint32_t>(text.size());
+    return value;
+}
+
+auto ChangeValue::same(const ChangeValue& first, const ChangeValue& second) -> bool
+{
+    if (first.kind != second.kind || first.alternative != second.alternative) return false;
+
+    switch (first.kind) {
+        case Kind::Empty:
+            return true;
+        case Kind::Integer:
+            return first.integer == second.integer;
+        case Kind::Real:
+            return first.real == second.real;
+        case Kind::Text:
+            return first.getText() == second.getText();
+        case Kind::Object:
+            return same_objects[first.alternative](first.object, second.object);
+    }
+    return false;
+}
+
+auto ChangeValue::toVariant() const -> std::optional<ChangeLog::ValueVariant>
+{
+    if (this->kind == Kind::Empty) return std::nullopt;
+    return decoders[this->alternative](*this);
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+#include "ChangeLog/change_log.hpp"
+
+namespace change_value {
+    template <typename T, typename Variant>
+    struct AlternativeIndex;
+
+    template <typename T, typename... Types>
+    struct AlternativeIndex<T, std::variant<Types...>> {
+        static constexpr size_t value = [] {
+            constexpr bool same[] = {std::is_same_v<T, Types>...};
+            for (size_t i = 0; i < sizeof...(Types); i++) {
+                if (same[i]) return i;
+            }
+            return sizeof...(Types);
+        }();
+    };
+
+    /// Index of `T` in `ChangeLog::ValueVariant`
+    template <typename T>
+    inline constexpr size_t alternative_index =
+        AlternativeIndex<T, ChangeLog::ValueVariant>::value;
+
+    template <typename T>
+    concept Alternative = alternative_index<T> < std::variant_size_v<ChangeLog::ValueVariant>;
+
+    /// Alternatives stored in `ChangeValue::getInteger()`
+    template <typename T>
+    inline constexpr bool is_integer = std::is_integral_v<T> || std::is_enum_v<T> ||
+                                       std::is_same_v<T, Date> ||
+                                       std::is_same_v<T, TimeDuration> ||
+                                       std::is_same_v<T, Currencies>;
+
+    template <typename T>
+    auto toInteger(const T& value) -> int64_t
+    {
+        if constexpr (std::is_same_v<T, Date>) {
+            return value.getMinutes();
+        } else if constexpr (std::is_same_v<T, TimeDuration>) {
+            return value.getSeconds();
+        } else if constexpr (std::is_same_v<T, Currencies>) {
+            return currencyId(value);
+        } else {
+            return static_cast<int64_t>(value);
+        }
+    }
+}  // namespace change_value
+
+/**
+ * @class ChangeValue
+ * @brief Old or new value of a change packed into 16 bytes.
+ *
+ * Numbers, enums, dates, durations and currencies are kept inline. Text and other objects are
+ * referenced: while a change is being appended they point to the caller's data, once the change
+ * is in the `ChangeJournal` they point to the journal's own storage. The exact
+ * `ChangeLog::ValueVariant` alternative is remembered, so `toVariant()` gives back what was
+ * recorded.
+ */
+class ChangeValue {
+public:
+    enum class Kind : uint8_t {
+        Empty,
+        Integer,  ///< Integers, bool, enums, dates (minutes), durations (seconds), currencies (id)
+        Real,
+        Text,
+        Object
+    };
+
+    ChangeValue() = default;
+    ChangeValue(std::nullopt_t) {}
+    ChangeValue(const std::optional<ChangeLog::ValueVariant>& value);
+
+    template <change_value::Alternative T>
+    ChangeValue(const T& value)
+    {
+        this->assign(value);
+    }
+
+    template <change_value::Alternative T>
+    ChangeValue(const std::optional<T>& value)
+    {
+        if (value) this->assign(*value);
+    }
+
+    /// String value without building a `StringPtr`
+    static auto fromText(const std::string_view text) -> ChangeValue;
+    /// Same alternative holding equal numbers, equal text or the very same object
+    static auto same(const ChangeValue& first, const ChangeValue& second) -> bool;
+
+    /// @name Getters
+    /// @{
+    auto empty() const -> bool { return this->kind == Kind::Empty; }
+    auto getKind() const -> Kind { return this->kind; }
+    /// Index of the alternative in `ChangeLog::ValueVariant`
+    auto getAlternative() const -> uint8_t { return this->alternative; }
+    auto getInteger() const -> int64_t { return this->integer; }
+    auto getReal() const -> double { return this->real; }
+    auto getText() const -> std::string_view { return std::string_view(this->text, this->size); }
+    /// The alternative named by `getAlternative()`
+    auto getObject() const -> const void* { return this->object; }
+    /// Rebuilds the recorded value, text comes back as a new `StringPtr`
+    auto toVariant() const -> std::optional<ChangeLog::ValueVariant>;
+    /// @}
+
+private:
+    friend class ChangeJournal;  // moves text and objects into its own storage
+    friend class ChangeArchive;  // decodes values paged in from disk
+
+    Kind     kind        = Kind::Empty;
+    uint8_t  alternative = 0;
+    uint32_t size        = 0;  ///< Length of the text
+    union {
+        int64_t     integer = 0;
+        double      real;
+        const char* text;
+        const void* object;
+    };
+
+    template <typename T>
+    void assign(const T& value)
+    {
+        this->alternative = static_cast<uint8_t>(change_value::alternative_index<T>);
+        if constexpr (std::is_same_v<T, double>) {
+            this->kind = Kind::Real;
+            this->real = value;
+        } else if constexpr (change_value::is_integer<T>) {
+            this->kind    = Kind::Integer;
+            this->integer = change_value::toInteger(value);
+        } else if constexpr (std::is_same_v<T, StringPtr>) {
+            if (value != nullptr) {
+                this->kind = Kind::Text;
+                this->text = value->data();
+                this->size = static_cast<uint32_t>(value->size());
+            } else {
+                this->kind   = Kind::Object;
+                this->object = &value;
+            }
+        } else {
+            this->kind   = Kind::Object;
+            this->object = &value;
+        }
+    }
+};
+
+static_assert(sizeof(ChangeValue) == 16);
+
+#define OPTIONAL_STR_TO_VALUE(STR) \
+    (STR == std::nullopt ? ChangeValue() : ChangeValue::fromText(STR.value()))
@@ -0,0 +1,120 @@
+#include "entity_state.hpp"
+
+#include <algorithm>
+
+#include "ChangeLog/change_renderer.hpp"
+
+namespace {
+    auto valueText(const ChangeLog::FieldType type, const ChangeValue& value) -> std::string
+    {
+        std::string text;
+        ChangeRenderer::writeValue(text, type, value);
+        return text;
+    }
+}  // namespace
+
+void EntityState::apply(
+    const uint8_t              kind,
+    const uint8_t              field,
+    const ChangeLog::Action    action,
+    const ChangeLog::FieldType old_type,
+    const ChangeValue&         old_value,
+    const ChangeLog::FieldType new_type,
+    const ChangeValue&         new_value
+)
+{
+    auto same_field = [kind, field](const Field& entry) {
+        return entry.kind == kind && entry.field == field;
+    };
+
+    switch (action) {
+        case ChangeLog::Action::Change: {
+            auto it = std::find_if(this->fields.rbegin(), this->fields.rend(), same_field);
+            if (it != this->fields.rend()) {
+                it->type  = new_type;
+                it->value = new_value;
+            } else {
+                this->fields.push_back(Field{kind, field, new_type, new_value});
+            }
+            break;
+        }
+        case ChangeLog::Action::Add: {
+            this->fields.push_back(Field{kind, field, new_type, new_value});
+            break;
+        }
+        case ChangeLog::Action::Remove: {
+            auto it = std::find_if(this->fields.rbegin(), this->fields.rend(), [&](auto& entry) {
+                return same_field(entry) && ChangeValue::same(entry.value, old_value);
+            });
+            // copies of an object (phone numbers, money, ...) are only equal by their text
+            if (it == this->fields.rend()) {
+                std::string text = valueText(old_type, old_value);
+                it = std::find_if(this->fields.rbegin(), this->fields.rend(), [&](auto& entry) {
+                    return same_field(entry) && valueText(entry.type, entry.value) == text;
+                });
+            }
+            if (it != this->fields.rend()) this->fields.erase(std::next(it).base());
+            break;
+        }
+    }
+}
+
+void EntityState::retain(std::shared_ptr<const void> storage)
+{
+    if (std::find(this->storage.begin(), this->storage.end(), storage) != this->storage.end()) {
+        return;
+    }
+    this->storage.push_back(std::move(storage));
+}
+
+auto EntityState::contains(const ChangeLog::FieldVariant& field) const -> bool
+{
+    return this->find(field) != nullptr;
+}
+
+auto EntityState::getValue(const ChangeLog::FieldVariant& field) const
+    -> std::optional<ChangeLog::ValueVariant>
+{
+    const Field* entry = this->find(field);
+    if (entry == nullptr) return std::nullopt;
+    return entry->value.toVariant();
+}
+
+auto EntityState::getValues(const ChangeLog::FieldVariant& field) const
+    -> std::vector<ChangeLog::ValueVariant>
+{
+    auto [kind, value] = key(field);
+
+    std::vector<ChangeLog::ValueVariant> result;
+    for (const Field& entry : this->fields) {
+        if (entry.kind != kind || entry.field != value || entry.value.empty()) continue;
+        result.push_back(*entry.value.toVariant());
+    }
+    return result;
+}
+
+auto EntityState::getValueStr(const ChangeLog::FieldVariant& field) const -> StringPtr
+{
+    const Field* entry = this->find(field);
+    if (entry == nullptr || entry->value.empty()) return nullptr;
+    return std::make_shared<std::string>(valueText(entry->type, entry->value));
+}
+
+auto EntityState::getFields() const -> const std::vector<Field>& { return this->fields; }
+
+auto EntityState::key(const ChangeLog::FieldVariant& field) -> std::pair<uint8_t, uint8_t>
+{
+    return {
+        static_cast<uint8_t>(field.index()),
+        std::visit([](auto value) { return static_cast<uint8_t>(value); }, field)
+    };
+}
+
+auto EntityState::find(const ChangeLog::FieldVariant& field) const -> const Field*
+{
+    auto [kind, value] = key(field);
+    for (auto it = this->fields.rbegin(); it != this->fields.rend(); ++it) {
+        if (it->kind == kind && it->field == value) return &*it;
+    }
+    return nullptr;
+}
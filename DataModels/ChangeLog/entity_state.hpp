@@ -0,0 +1,72 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_value.hpp"
+
+/**
+ * @class EntityState
+ * @brief Values of an entity's fields as its change history left them at some moment.
+ *
+ * Built by `ChangeJournal::getStateAt` from a checkpoint and the few records after it. A
+ * `Change` sets the field, `Add` puts one more value into a list field and `Remove` takes the
+ * matching one out. An entity added to a data base starts from the `InitialState` it was created
+ * with; list fields, and entities never added, only know what changed up to the moment. The
+ * state keeps alive the journal storage and archive blocks its values point into, so it stays
+ * valid after `ChangeJournal::compact`. Checkpoints `rebase` theirs onto storage of their own.
+ */
+class EntityState {
+public:
+    struct Field {
+        uint8_t              kind;   ///< Alternative of `ChangeLog::FieldVariant`
+        uint8_t              field;  ///< Enum value inside that alternative
+        ChangeLog::FieldType type;
+        ChangeValue          value;  ///< Points into storage the state retains
+    };
+
+    /// Replays one change
+    void apply(
+        const uint8_t              kind,
+        const uint8_t              field,
+        const ChangeLog::Action    action,
+        const ChangeLog::FieldType old_type,
+        const ChangeValue&         old_value,
+        const ChangeLog::FieldType new_type,
+        const ChangeValue&         new_value
+    );
+    /// Keeps `storage` alive as long as the state, once per storage
+    void retain(std::shared_ptr<const void> storage);
+    /// Replaces every value by `copy(value)`, which lives in `storage`, and retains `storage`
+    /// alone, so the state stops holding the storage of the records it was replayed from
+    template <typename Copy>
+    void rebase(std::shared_ptr<const void> storage, Copy&& copy)
+    {
+        for (Field& entry : this->fields) entry.value = copy(entry.value);
+        this->storage = {std::move(storage)};
+    }
+
+    /// @name Getters
+    /// @{
+    auto contains(const ChangeLog::FieldVariant& field) const -> bool;
+    /// Latest value of the field; nullopt if it was never set or set to nothing
+    auto getValue(const ChangeLog::FieldVariant& field) const
+        -> std::optional<ChangeLog::ValueVariant>;
+    /// Every value of a list field, oldest first
+    auto getValues(const ChangeLog::FieldVariant& field) const
+        -> std::vector<ChangeLog::ValueVariant>;
+    auto getValueStr(const ChangeLog::FieldVariant& field) const -> StringPtr;
+    auto getFields() const -> const std::vector<Field>&;
+    /// @}
+
+private:
+    std::vector<Field>                       fields;  // in the order they were first set
+    std::vector<std::shared_ptr<const void>> storage;
+
+    static auto key(const ChangeLog::FieldVariant& field) -> std::pair<uint8_t, uint8_t>;
+    auto        find(const ChangeLog::FieldVariant& field) const -> const Field*;
+};
@@ -0,0 +1,505 @@
+#pragma once
+#include "Campaign/campaign.hpp"
+#include "Case/case.hpp"
+#include "ChangeLog/fields_enums.hpp"
+#include "Company/ExternalCompany/external_company.hpp"
+#include "Deal/deal.hpp"
+#include "Document/document.hpp"
+#include "Interaction/email_letter.hpp"
+#include "Interaction/interaction_result.hpp"
+#include "Interaction/meeting.hpp"
+#include "Interaction/phone_call_data.hpp"
+#include "Payment/payment.hpp"
+#include "Person/Client/client.hpp"
+#include "Person/Employee/employee_enums.hpp"
+#include "Person/Employee/external_employee.hpp"
+#include "Report/report.hpp"
+#include "Task/task.hpp"
+#include "Usings/enum_strings.hpp"
+#include "location.hpp"
+
+/**
+ * @file enum_tables.hpp
+ * @brief `EnumStrings` specializations for the model enums and the change log field enums.
+ *
+ * Model enums map to their display text from location.hpp, field enums map to the enumerator
+ * name. The order of every table follows the order of the enum declaration.
+ */
+
+/// @name Model enums
+/// @{
+template <>
+struct EnumStrings<PhoneCallData::CallType> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        call_type_str::incoming, call_type_str::outgoing, call_type_str::missed
+    });
+};
+
+template <>
+struct EnumStrings<Meeting::MeetingStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        meeting_status_str::scheduled, meeting_status_str::inProgress,
+        meeting_status_str::completed, meeting_status_str::canceled, meeting_status_str::postponed
+    });
+};
+
+template <>
+struct EnumStrings<Meeting::MeetingType> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        meeting_type_str::negotiation, meeting_type_str::presentation, meeting_type_str::training,
+        meeting_type_str::other
+    });
+};
+
+template <>
+struct EnumStrings<Meeting::MeetingOutcome> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        meeting_outcome_str::closedWon, meeting_outcome_str::closedLost,
+        meeting_outcome_str::progressMade, meeting_outcome_str::followUpScheduled,
+        meeting_outcome_str::informationProvided, meeting_outcome_str::decisionPending,
+        meeting_outcome_str::additionalInfoNeeded, meeting_outcome_str::postponed,
+        meeting_outcome_str::canceled, meeting_outcome_str::redirected,
+        meeting_outcome_str::issueIdentified, meeting_outcome_str::other
+    });
+};
+
+template <>
+struct EnumStrings<InteractionResult::ResultStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        interaction_result_status_str::success, interaction_result_status_str::failure,
+        interaction_result_status_str::partialSuccess,
+        interaction_result_status_str::followUpNeeded, interaction_result_status_str::canceled,
+        interaction_result_status_str::postponed, interaction_result_status_str::issueIdentified,
+        interaction_result_status_str::noOutcome, interaction_result_status_str::other
+    });
+};
+
+template <>
+struct EnumStrings<EmailLetter::EmailStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        email_status_str::sent, email_status_str::delivered, email_status_str::failed,
+        email_status_str::draft, email_status_str::scheduled, email_status_str::replied,
+        email_status_str::forwarded
+    });
+};
+
+template <>
+struct EnumStrings<EmailLetter::EmailLetterType> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        email_letter_type_str::incoming, email_letter_type_str::outgoing
+    });
+};
+
+template <>
+struct EnumStrings<BaseInteraction::InteractionType> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        interaction_type_str::phoneCall, interaction_type_str::emailLetter,
+        interaction_type_str::emailThread, interaction_type_str::meeting,
+        interaction_type_str::meetingThread, interaction_type_str::message,
+        interaction_type_str::correspondence, interaction_type_str::commentarySocialNetworks,
+        interaction_type_str::commentarySocialNetworksThread, interaction_type_str::unknown
+    });
+};
+
+template <>
+struct EnumStrings<PaymentStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        payment_status_str::pending, payment_status_str::completed, payment_status_str::failed,
+        payment_status_str::refunded, payment_status_str::partial, payment_status_str::overdue
+    });
+};
+
+template <>
+struct EnumStrings<Deal::Status> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        deal_status_str::draft, deal_status_str::readyForCoordination,
+        deal_status_str::readyForSigned, deal_status_str::coordination,
+        deal_status_str::signedByCounterparty, deal_status_str::signedBySecondSide,
+        deal_status_str::allSigned, deal_status_str::deleted, deal_status_str::canceled,
+        deal_status_str::registered, deal_status_str::beginningDealBroken,
+        deal_status_str::endDealBroken, deal_status_str::obligationsAreProcess,
+        deal_status_str::obligationsAreFulfilled, deal_status_str::obligationsAreNotFulfilled,
+        deal_status_str::other
+    });
+};
+
+template <>
+struct EnumStrings<Document::DocumentStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        document_status_str::draft, document_status_str::active, document_status_str::expired,
+        document_status_str::archived
+    });
+};
+
+template <>
+struct EnumStrings<Task::Status> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        task_status_str::not_started, task_status_str::in_progress, task_status_str::completed,
+        task_status_str::overdue
+    });
+};
+
+template <>
+struct EnumStrings<Gender> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        gender_str::male, gender_str::female, gender_str::unknown
+    });
+};
+
+template <>
+struct EnumStrings<EmployeeStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        employee_status_str::active, employee_status_str::vacation, employee_status_str::fired,
+        employee_status_str::education, employee_status_str::internship,
+        employee_status_str::probation, employee_status_str::suspended,
+        employee_status_str::sick_leave, employee_status_str::retired, employee_status_str::other
+    });
+};
+
+template <>
+struct EnumStrings<AccessRole> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        access_level_str::admin, access_level_str::sales_rep, access_level_str::executive,
+        access_level_str::manager, access_level_str::marketing_user, access_level_str::read_only,
+        access_level_str::sales_manager, access_level_str::service_manager,
+        access_level_str::support, access_level_str::decision_maker, access_level_str::influencer,
+        access_level_str::user, access_level_str::gatekeeper, access_level_str::other
+    });
+};
+
+template <>
+struct EnumStrings<Client::ClientType> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        client_type_str::visitor, client_type_str::lead, client_type_str::prospect,
+        client_type_str::customer, client_type_str::loyal_customer, client_type_str::partner,
+        client_type_str::potential_client, client_type_str::lost_customer,
+        client_type_str::analytical, client_type_str::emotional, client_type_str::other
+    });
+};
+
+template <>
+struct EnumStrings<Client::LeadStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        lead_status_str::new_, lead_status_str::open, lead_status_str::working,
+        lead_status_str::qualified, lead_status_str::unqualified, lead_status_str::converted,
+        lead_status_str::closed, lead_status_str::disqualified, lead_status_str::nurturing,
+        lead_status_str::lost
+    });
+};
+
+template <>
+struct EnumStrings<Client::LeadSource> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        lead_source_str::website, lead_source_str::referral, lead_source_str::email_campaign,
+        lead_source_str::social_media, lead_source_str::other
+    });
+};
+
+template <>
+struct EnumStrings<Company::CompanyStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        company_status_str::active, company_status_str::inactive, company_status_str::archived
+    });
+};
+
+template <>
+struct EnumStrings<ExternalCompany::CompanyType> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        company_type_str::client, company_type_str::partner, company_type_str::vendor,
+        company_type_str::prospect, company_type_str::supplier, company_type_str::other
+    });
+};
+
+template <>
+struct EnumStrings<ExternalCompany::Rating> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        rating_str::hot, rating_str::warm, rating_str::cold, rating_str::inactive
+    });
+};
+
+template <>
+struct EnumStrings<ExternalCompany::RiskLevel> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        risk_level_str::low, risk_level_str::medium, risk_level_str::high, risk_level_str::critical
+    });
+};
+
+template <>
+struct EnumStrings<ExternalCompany::CompanySize> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        company_size_str::micro, company_size_str::small, company_size_str::medium,
+        company_size_str::large, company_size_str::enterprise
+    });
+};
+
+template <>
+struct EnumStrings<ExternalCompany::ComplianceLevel> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        compliance_level_str::compliant, compliance_level_str::warning,
+        compliance_level_str::non_compliant
+    });
+};
+
+template <>
+struct EnumStrings<ExternalCompany::IntegrationStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        integration_status_str::connected, integration_status_str::pending,
+        integration_status_str::failed
+    });
+};
+
+template <>
+struct EnumStrings<ExternalEmployee::InfluenceLevel> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        influence_level_str::critical, influence_level_str::high, influence_level_str::medium,
+        influence_level_str::low, influence_level_str::very_low
+    });
+};
+
+template <>
+struct EnumStrings<ReportType> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        report_type_str::SalesSummary, report_type_str::Pipeline, report_type_str::RevenueByManager,
+        report_type_str::ClientActivity, report_type_str::ProductPerformance,
+        report_type_str::EmployeeKPI, report_type_str::InteractionSummary,
+        report_type_str::FinancialForecast, report_type_str::other
+    });
+};
+
+template <>
+struct EnumStrings<ExportFormat> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        export_format_str::CSV, export_format_str::PDF, export_format_str::JSON,
+        export_format_str::XLSX
+    });
+};
+
+template <>
+struct EnumStrings<CampaignType> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        campaign_type_str::email, campaign_type_str::social_ads, campaign_type_str::webinar,
+        campaign_type_str::event, campaign_type_str::other
+    });
+};
+
+template <>
+struct EnumStrings<CaseStatus> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        case_status_str::open, case_status_str::in_progress, case_status_str::resolved,
+        case_status_str::closed
+    });
+};
+/// @}
+
+/// @name Change log fields
+/// @{
+template <>
+struct EnumStrings<PersonFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Name", "Surname", "Patronymic", "Birthday", "UpdateAt", "PhoneNumber", "MorePhoneNumber",
+        "Address", "MoreAddress", "Email", "RelatedDeals", "MoreEmail", "Gender", "OtherDocuments",
+        "OtherFiles", "InteractionHistory", "Tags", "PreferredLanguage", "Notes"
+    });
+};
+
+template <>
+struct EnumStrings<BaseInteractionFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Id", "ExternalID", "Title", "Description", "Subject", "InteractionDuration", "StartDate",
+        "EndDate", "Type", "Priority", "Tags", "MoreData", "Manager", "Checker", "Participants",
+        "Results", "Notes", "RelatedInteractions", "AttachmentFiles", "Campaigns"
+    });
+};
+
+template <>
+struct EnumStrings<CommentarySocialNetworksFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Nickname", "Author", "Commentary", "AnswerTo", "Answer", "DateSending", "IsFirst"
+    });
+};
+
+template <>
+struct EnumStrings<CommentarySocialNetworksThreadFields> {
+    static constexpr auto names = std::to_array<std::string_view>({"Comments"});
+};
+
+template <>
+struct EnumStrings<CorrespondenceFields> {
+    static constexpr auto names = std::to_array<std::string_view>({"Messages", "Platform"});
+};
+
+template <>
+struct EnumStrings<EmailLetterFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "FromEmailAddress", "ToEmailAddress", "LetterType", "EmailStatus", "CcEmailAddresses",
+        "BccEmailAddresses", "Sender", "Recipient", "Body", "SendDate", "ReceivedDate", "ReadTime",
+        "EmailProvider", "PreviousLetter", "NextLetter", "IsRead", "IsFlagged"
+    });
+};
+
+template <>
+struct EnumStrings<EmailThreadFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Letters", "Clients", "Employees"
+    });
+};
+
+template <>
+struct EnumStrings<InteractionResultFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "InteractionResultTitle", "Description", "ResultStatus", "Documents", "Deals",
+        "PlannedInteractions", "Files", "IdentifiedIssue", "Tags", "MoreData", "ChangeLogs"
+    });
+};
+
+template <>
+struct EnumStrings<MeetingFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Location", "MeetingStatus", "MeetingType", "Outcomes", "OtherOutcomes", "OtherType",
+        "Record", "Clients", "Employees", "Invitees", "PreviousMeeting", "NextMeeting",
+        "CreatedDate", "IsConfirmed", "IsVirtual"
+    });
+};
+
+template <>
+struct EnumStrings<MeetingThreadFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Meetings", "Clients", "Employees"
+    });
+};
+
+template <>
+struct EnumStrings<MessageFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Nickname", "Author", "Message", "Platform", "DateSending"
+    });
+};
+
+template <>
+struct EnumStrings<PhoneCallFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "FromNumber", "ToNumber", "StartCall", "EndCall", "CallCreator", "CallProvider", "CallType"
+    });
+};
+
+template <>
+struct EnumStrings<DocumentFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Id", "DocumentTitle", "DocumentName", "DocumentNumber", "Path", "EnteredForce",
+        "StoppedWorking", "DocumentPath", "Partners", "Status", "Creator", "File"
+    });
+};
+
+template <>
+struct EnumStrings<FileMetadataFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Id", "FileName", "FileFormat", "FilePath", "FileSize", "UploadDate", "Content"
+    });
+};
+
+template <>
+struct EnumStrings<DealFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "ContractNumber", "Title", "Description", "Source", "Tags", "Buyers", "TotalAmount",
+        "PaidAmount", "Currency", "OtherCurrency", "PaymentTransactions", "Status", "OtherStatus",
+        "DealPriority", "DrawingDate", "DateApproval", "CreationDate", "Manager",
+        "AssignedEmployees", "Offers", "Offerings", "Documents", "Task", "DealManager", "Owner"
+    });
+};
+
+template <>
+struct EnumStrings<TaskFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Title", "Description", "Subject", "Status", "Priority", "CreatedDate", "Deadline",
+        "StartDate", "ETC", "ATS", "CreatedBy", "Manager", "Deals", "Task", "File", "Notes",
+        "MoreData", "Teem"
+    });
+};
+
+template <>
+struct EnumStrings<InternalEmployeeFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Id", "Manager", "Position", "Department", "Role", "Status", "SalesTerritory",
+        "LastLoginDate", "LastActionDate", "TimeZone", "Leads", "CommissionRate", "Notes",
+        "MonthlyQuota", "Tasks", "OwnedDeals", "Documents", "BaseSalary", "Skills",
+        "PerformanceScore", "DirectReports", "HireDate", "DismissalDate", "IsActive",
+        "ManagerDeals", "ProposedOffers", "NextReviewDate"
+    });
+};
+
+template <>
+struct EnumStrings<ClientFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Owner", "Type", "OtherType", "LeadSource", "OtherLeadSource", "Interactions",
+        "ActivInteraction", "BoughtDeals", "ActivDeal", "InterestedOffers", "LeadStatus",
+        "LeadScore", "AnnualRevenue", "LifetimeValue", "Tags", "Notes", "MoreData",
+        "CommunicationChannel", "ReferralCode", "CustomerAcquisitionCost", "OwnedDeals",
+        "MarketingConsent"
+    });
+};
+
+template <>
+struct EnumStrings<CompanyFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "CompanyName", "LegalName", "WebsiteUrl", "SicCode", "PhoneNumber", "Email", "Notes",
+        "RegisteredAddress", "CreatedAt", "MorePhoneNumbers", "MoreEmails", "EmployeeCount",
+        "AnnualRevenue", "Industry", "CountryCode", "FoundedDate", "TaxId", "Status", "Budget",
+        "TaxRates", "Deals", "Tasks"
+    });
+};
+
+template <>
+struct EnumStrings<ExternalCompanyFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Type", "OtherType", "Size", "Rating", "RiskLevel", "AccountManager", "VatNumber",
+        "LastInteractionDate", "PreferredContactMethod", "PaymentTerms", "PreferredCurrency",
+        "WinRate", "Contacts", "ComplianceStatus", "AssociatedClients", "CreditLimit",
+        "TotalRevenueGenerated", "OutstandingBalance", "Documents", "ChurnProbability",
+        "ServiceLevelAgreement", "PreferredIntegrationTool", "IntegrationStatus"
+    });
+};
+
+template <>
+struct EnumStrings<ExternalEmployeeFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Company", "JobTitle", "Department", "Role", "OtherRole", "CurrentInteraction",
+        "LastContactDate", "InfluenceScore", "Salary", "AssignedDeals", "CompletedDeals",
+        "AssignedTasks", "CompletedTasks", "SocialNetworks", "MoreData", "Notes",
+        "InteractionHistory", "TimeZone", "PreferredContactTime", "DecisionInfluence",
+        "BudgetAuthority", "PainPoints", "Status"
+    });
+};
+
+template <>
+struct EnumStrings<PaymentFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "RequestedAmount", "SendingAmount", "ReceivedAmount", "TaxAmount", "Currencies",
+        "SendingDate", "ReceivedDate", "CreationDate", "PaymentStatus", "PaymentMethod", "Deal",
+        "Payer", "PayerCompany", "InvoiceNumber", "TransactionId", "PaymentPurpose", "Documents",
+        "Comments", "CreatedBy", "ChangeLogs"
+    });
+};
+
+template <>
+struct EnumStrings<ReportFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Type", "Data", "GeneratedDate", "Parameters", "Creator", "ExportFormat"
+    });
+};
+
+template <>
+struct EnumStrings<CampaignFields> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Name", "Type", "OtherType", "StartDate", "EndDate", "Budget", "BudgetSpent", "TotalJoined",
+        "TotalConverted", "Creator", "ConversionRate", "Notes", "TargetLeads"
+    });
+};
+
+template <>
+struct EnumStrings<CaseField> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        "Title", "Description", "Status", "Priority", "CreateDate", "ResolvedDate", "AssignedTo",
+        "RelatedClient", "Notes", "RelatedInteractions"
+    });
+};
+/// @}
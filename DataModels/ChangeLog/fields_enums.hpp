@@ -1,3 +1,4 @@
+#pragma once
 #include <stdint.h>
 enum class PersonFields : uint8_t {
     Name,
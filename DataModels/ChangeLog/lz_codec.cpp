@@ -0,0 +1,111 @@
+#include "lz_codec.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+#include <stdexcept>
+#include <vector>
+
+#include "location.hpp"
+
+namespace {
+    constexpr int    hash_bits    = 14;
+    constexpr size_t max_distance = UINT32_MAX;
+
+    auto hashOf(const char* data) -> uint32_t
+    {
+        uint32_t value;
+        memcpy(&value, data, sizeof(value));
+        return (value * 2654435761U) >> (32 - hash_bits);
+    }
+
+    void putVarint(std::string& out, size_t value)
+    {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    auto getVarint(const std::string_view data, size_t& position) -> size_t
+    {
+        size_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (position >= data.size()) throw std::runtime_error(errors::archive_corrupt);
+            uint8_t byte = static_cast<uint8_t>(data[position++]);
+            value |= static_cast<size_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) return value;
+        }
+        throw std::runtime_error(errors::archive_corrupt);
+    }
+}  // namespace
+
+auto lz_codec::compress(const std::string_view data) -> std::string
+{
+    std::string out;
+    out.reserve(data.size() / 2 + 16);
+
+    std::vector<uint32_t> table(size_t{1} << hash_bits, UINT32_MAX);
+    const char*           base    = data.data();
+    size_t                literal = 0;  // start of the pending literals
+    size_t                i       = 0;
+
+    while (i + min_match <= data.size()) {
+        uint32_t& slot      = table[hashOf(base + i)];
+        size_t    candidate = slot;
+        slot                = static_cast<uint32_t>(i);
+
+        if (candidate == UINT32_MAX || i - candidate > max_distance ||
+            memcmp(base + candidate, base + i, min_match) != 0) {
+            i++;
+            continue;
+        }
+
+        size_t length = min_match;
+        while (i + length < data.size() && base[candidate + length] == base[i + length]) {
+            length++;
+        }
+
+        putVarint(out, i - literal);
+        out.append(base + literal, i - literal);
+        putVarint(out, length - min_match);
+        putVarint(out, i - candidate);
+
+        i += length;
+        literal = i;
+    }
+
+    putVarint(out, data.size() - literal);
+    out.append(base + literal, data.size() - literal);
+    return out;
+}
+
+auto lz_codec::decompress(const std::string_view data, const size_t size) -> std::string
+{
+    std::string out;
+    out.reserve(size);
+
+    size_t position = 0;
+    while (true) {
+        size_t literals = getVarint(data, position);
+        if (literals > data.size() - position || literals > size - out.size()) {
+            throw std::runtime_error(errors::archive_corrupt);
+        }
+        out.append(data.data() + position, literals);
+        position += literals;
+        if (position == data.size()) break;
+
+        size_t length   = getVarint(data, position) + min_match;
+        size_t distance = getVarint(data, position);
+        if (distance == 0 || distance > out.size() || length > size - out.size()) {
+            throw std::runtime_error(errors::archive_corrupt);
+        }
+        // byte by byte, a match may overlap the bytes it produces
+        size_t from = out.size() - distance;
+        for (size_t k = 0; k < length; k++) out.push_back(out[from + k]);
+    }
+
+    if (out.size() != size) throw std::runtime_error(errors::archive_corrupt);
+    return out;
+}
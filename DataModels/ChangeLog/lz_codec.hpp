@@ -0,0 +1,22 @@
+#pragma once
+#include <stddef.h>
+
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Byte-oriented LZ77 compression of change archive blocks.
+ *
+ * The stream is a run of sequences: a varint count of literals, the literals, then a varint
+ * match length (minus `min_match`) and a varint distance back into the output. The last
+ * sequence has literals only. Matches are found through a single hash table of 4-byte
+ * prefixes, which favours speed over ratio; the repetitive field layout of change records
+ * still compresses several times.
+ */
+namespace lz_codec {
+    inline constexpr size_t min_match = 4;
+
+    auto compress(const std::string_view data) -> std::string;
+    /// Throws `std::runtime_error` when `data` does not decode to exactly `size` bytes
+    auto decompress(const std::string_view data, const size_t size) -> std::string;
+}  // namespace lz_codec
@@ -1,6 +1,8 @@
 #include "external_company.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 #include "Usings/type_usings.hpp"
 
 ExternalCompany::ExternalCompany(const BigUint& id)
@@ -22,7 +24,7 @@ ExternalCompany::ExternalCompany(
     const OptionalStr&                    email,
     const OptionalStr&                    country_code,
     const AddressPtr&                     registered_address,
-    const DatePtr&                        founded_date,
+    const OptionalDate&                   founded_date,
     const OptionalStr&                    tax_id,
     const std::optional<CompanyStatus>&   status,
     const std::optional<uint32_t>&        employee_count,
@@ -35,7 +37,7 @@ ExternalCompany::ExternalCompany(
     const RiskLevel&                      risk_level,
     const WeakInternalEmployee&           account_manager,
     const OptionalStr&                    VAT_number,
-    const DatePtr&                        last_interaction_date,
+    const OptionalDate&                   last_interaction_date,
     const OptionalStr&                    preferred_contact_method,
     const OptionalStr&                    payment_terms,
     const Currencies&                     preferred_currency,
@@ -79,7 +81,7 @@ ExternalCompany::ExternalCompany(
           std::move(more_emails)
       )
     , type(type)
-    , other_type(other_type)
+    , other_type(InternedStr::fromOptional(other_type))
     , size(size)
     , rating(rating)
     , risk_level(risk_level)
@@ -102,7 +104,7 @@ ExternalCompany::ExternalCompany(
 }
 
 auto ExternalCompany::getType() const -> CompanyType { return this->type; }
-auto ExternalCompany::getOtherType() const -> const OptionalStr& { return this->other_type; }
+auto ExternalCompany::getOtherType() const -> const OptionalInterned& { return this->other_type; }
 auto ExternalCompany::getSize() const -> CompanySize { return this->size; }
 auto ExternalCompany::getRating() const -> Rating { return this->rating; }
 auto ExternalCompany::getRiskLevel() const -> RiskLevel { return this->risk_level; }
@@ -111,7 +113,7 @@ auto ExternalCompany::getAccountManager() const -> const WeakInternalEmployee&
     return this->account_manager;
 }
 auto ExternalCompany::getVatNumber() const -> const OptionalStr& { return this->VAT_number; }
-auto ExternalCompany::getLastInteractionDate() const -> const DatePtr&
+auto ExternalCompany::getLastInteractionDate() const -> const OptionalDate&
 {
     return this->last_interaction_date;
 }
@@ -172,18 +174,16 @@ auto ExternalCompany::getChurnProbability() const -> const std::optional<double>
 bool ExternalCompany::setType(const CompanyType type, const InternalEmployeePtr& changer)
 {
     if (this->type != type) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_type ? std::make_optional<ChangeLog::ValueVariant>(
-                                   std::make_shared<std::string>(this->other_type.value())
-                               )
+            this->other_type ? ChangeValue::fromText(this->other_type.value())
                              : std::make_optional(this->type),
             std::make_optional(type),
             ExternalCompanyFields::Type,
             this->other_type ? ChangeLog::FieldType::String : ChangeLog::FieldType::CompanyType,
             ChangeLog::FieldType::CompanyType,
             ChangeLog::Action::Change
-        ));
+        );
         this->type       = type;
         this->other_type = std::nullopt;
         return true;
@@ -196,23 +196,19 @@ bool ExternalCompany::setOtherType(
 )
 {
     if (this->other_type != other_type) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_type ? std::make_optional<ChangeLog::ValueVariant>(
-                                   std::make_shared<std::string>(this->other_type.value())
-                               )
+            this->other_type ? ChangeValue::fromText(this->other_type.value())
                              : std::make_optional(this->type),
-            other_type.has_value() ? std::make_optional<ChangeLog::ValueVariant>(
-                                         std::make_shared<std::string>(other_type.value())
-                                     )
+            other_type.has_value() ? ChangeValue::fromText(other_type.value())
                                    : std::nullopt,
             ExternalCompanyFields::Type,
             this->other_type ? ChangeLog::FieldType::String : ChangeLog::FieldType::CompanyType,
             other_type.has_value() ? ChangeLog::FieldType::String
                                    : ChangeLog::FieldType::CompanyType,
             ChangeLog::Action::Change
-        ));
-        this->other_type = other_type;
+        );
+        this->other_type = InternedStr::fromOptional(other_type);
         this->type       = CompanyType::Other;
         return true;
     }
@@ -222,7 +218,7 @@ bool ExternalCompany::setOtherType(
 bool ExternalCompany::setRating(const Rating rating, const InternalEmployeePtr& changer)
 {
     if (this->rating != rating) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->rating),
             std::make_optional(rating),
@@ -230,7 +226,7 @@ bool ExternalCompany::setRating(const Rating rating, const InternalEmployeePtr&
             ChangeLog::FieldType::CompanyRating,
             ChangeLog::FieldType::CompanyRating,
             ChangeLog::Action::Change
-        ));
+        );
         this->rating = rating;
         return true;
     }
@@ -240,7 +236,7 @@ bool ExternalCompany::setRating(const Rating rating, const InternalEmployeePtr&
 bool ExternalCompany::setRiskLevel(const RiskLevel risk_level, const InternalEmployeePtr& changer)
 {
     if (this->risk_level != risk_level) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->risk_level),
             std::make_optional(risk_level),
@@ -248,7 +244,7 @@ bool ExternalCompany::setRiskLevel(const RiskLevel risk_level, const InternalEmp
             ChangeLog::FieldType::CompanyRiskLevel,
             ChangeLog::FieldType::CompanyRiskLevel,
             ChangeLog::Action::Change
-        ));
+        );
         this->risk_level = risk_level;
         return true;
     }
@@ -261,7 +257,7 @@ bool ExternalCompany::setAccountManager(
 {
     if (this->account_manager.owner_before(account_manager) ||
         account_manager.owner_before(this->account_manager)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->account_manager),
             WEAK_PTR_TO_OPTIONAL(account_manager),
@@ -271,7 +267,7 @@ bool ExternalCompany::setAccountManager(
             !account_manager.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                        : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->account_manager = account_manager;
         return true;
     }
@@ -279,26 +275,20 @@ bool ExternalCompany::setAccountManager(
 }
 
 bool ExternalCompany::setLastInteractionDate(
-    const DatePtr& last_interaction_date, const InternalEmployeePtr& changer
+    const OptionalDate& last_interaction_date, const InternalEmployeePtr& changer
 )
 {
-    if (this->last_interaction_date == nullptr || last_interaction_date == nullptr) {
-        if (this->last_interaction_date == last_interaction_date) {
-            return false;
-        }
-    } else if (*this->last_interaction_date == *last_interaction_date) {
-        return false;
-    }
+    if (this->last_interaction_date == last_interaction_date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->last_interaction_date),
-        PTR_TO_OPTIONAL(last_interaction_date),
+        OPTIONAL_TO_VALUE(this->last_interaction_date),
+        OPTIONAL_TO_VALUE(last_interaction_date),
         ExternalCompanyFields::LastInteractionDate,
         this->last_interaction_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         last_interaction_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->last_interaction_date = last_interaction_date;
     return true;
 }
@@ -315,7 +305,7 @@ bool ExternalCompany::setCreditLimit(
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->credit_limit),
         PTR_TO_OPTIONAL(credit_limit),
@@ -323,7 +313,7 @@ bool ExternalCompany::setCreditLimit(
         this->credit_limit ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         credit_limit ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->credit_limit = credit_limit;
     return true;
 }
@@ -340,7 +330,7 @@ bool ExternalCompany::setTotalRevenueGenerated(
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->total_revenue_generated),
         PTR_TO_OPTIONAL(total_revenue_generated),
@@ -348,7 +338,7 @@ bool ExternalCompany::setTotalRevenueGenerated(
         this->total_revenue_generated ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         total_revenue_generated ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->total_revenue_generated = total_revenue_generated;
     return true;
 }
@@ -365,7 +355,7 @@ bool ExternalCompany::setOutstandingBalance(
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->outstanding_balance),
         PTR_TO_OPTIONAL(outstanding_balance),
@@ -373,7 +363,7 @@ bool ExternalCompany::setOutstandingBalance(
         this->outstanding_balance ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         outstanding_balance ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->outstanding_balance = outstanding_balance;
     return true;
 }
@@ -383,7 +373,7 @@ bool ExternalCompany::setChurnProbability(
 )
 {
     if (this->churn_probability != churn_probability) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->churn_probability ? std::make_optional(this->churn_probability.value())
                                     : std::nullopt,
@@ -392,7 +382,7 @@ bool ExternalCompany::setChurnProbability(
             this->churn_probability ? ChangeLog::FieldType::Double : ChangeLog::FieldType::null,
             churn_probability ? ChangeLog::FieldType::Double : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->churn_probability = churn_probability;
         return true;
     }
@@ -412,7 +402,7 @@ bool ExternalCompany::addContact(
                 );
             }
         ) != this->contacts.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(contact),
@@ -420,7 +410,7 @@ bool ExternalCompany::addContact(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakExternalEmployee,
             ChangeLog::Action::Add
-        ));
+        );
         this->contacts.push_back(contact);
         return true;
     }
@@ -430,7 +420,7 @@ bool ExternalCompany::addContact(
 bool ExternalCompany::delContact(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->contacts.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->contacts[index]),
             std::nullopt,
@@ -438,7 +428,7 @@ bool ExternalCompany::delContact(size_t index, const InternalEmployeePtr& change
             ChangeLog::FieldType::WeakExternalEmployee,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->contacts.erase(this->contacts.begin() + index);
         return true;
     }
@@ -459,7 +449,7 @@ bool ExternalCompany::addAssociatedClient(
                 );
             }
         ) == this->associated_clients.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(associated_client),
@@ -467,7 +457,7 @@ bool ExternalCompany::addAssociatedClient(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakClient,
             ChangeLog::Action::Add
-        ));
+        );
         this->associated_clients.push_back(associated_client);
         return true;
     }
@@ -477,7 +467,7 @@ bool ExternalCompany::addAssociatedClient(
 bool ExternalCompany::delAssociatedClient(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->associated_clients.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->associated_clients[index]),
             std::nullopt,
@@ -485,7 +475,7 @@ bool ExternalCompany::delAssociatedClient(size_t index, const InternalEmployeePt
             ChangeLog::FieldType::WeakClient,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->associated_clients.erase(this->associated_clients.begin() + index);
         return true;
     }
@@ -496,7 +486,7 @@ bool ExternalCompany::addDocument(const FilePtr& document, const InternalEmploye
 {
     if (std::find(this->documents.begin(), this->documents.end(), document) ==
         this->documents.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(document),
@@ -504,7 +494,7 @@ bool ExternalCompany::addDocument(const FilePtr& document, const InternalEmploye
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::Action::Add
-        ));
+        );
         this->documents.push_back(document);
         return true;
     }
@@ -514,7 +504,7 @@ bool ExternalCompany::addDocument(const FilePtr& document, const InternalEmploye
 bool ExternalCompany::delDocument(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->documents.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->documents[index]),
             std::nullopt,
@@ -522,7 +512,7 @@ bool ExternalCompany::delDocument(size_t index, const InternalEmployeePtr& chang
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->documents.erase(this->documents.begin() + index);
         return true;
     }
@@ -556,7 +546,7 @@ void ExternalCompany::clearAssociatedClients()
 bool ExternalCompany::setSize(const CompanySize size, const InternalEmployeePtr& changer)
 {
     if (this->size != size) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->size),
             std::make_optional(size),
@@ -564,7 +554,7 @@ bool ExternalCompany::setSize(const CompanySize size, const InternalEmployeePtr&
             ChangeLog::FieldType::CompanySize,
             ChangeLog::FieldType::CompanySize,
             ChangeLog::Action::Change
-        ));
+        );
         this->size = size;
         return true;
     }
@@ -576,7 +566,7 @@ bool ExternalCompany::setVatNumber(
 )
 {
     if (this->VAT_number != VAT_number) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->VAT_number),
             OPTIONAL_STR_TO_VALUE(VAT_number),
@@ -584,7 +574,7 @@ bool ExternalCompany::setVatNumber(
             this->VAT_number ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             VAT_number ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->VAT_number = VAT_number;
         return true;
     }
@@ -596,7 +586,7 @@ bool ExternalCompany::setPreferredContactMethod(
 )
 {
     if (this->preferred_contact_method != preferred_contact_method) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->preferred_contact_method),
             OPTIONAL_STR_TO_VALUE(preferred_contact_method),
@@ -605,7 +595,7 @@ bool ExternalCompany::setPreferredContactMethod(
                                            : ChangeLog::FieldType::null,
             preferred_contact_method ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->preferred_contact_method = preferred_contact_method;
         return true;
     }
@@ -617,7 +607,7 @@ bool ExternalCompany::setPaymentTerms(
 )
 {
     if (this->payment_terms != payment_terms) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->payment_terms),
             OPTIONAL_STR_TO_VALUE(payment_terms),
@@ -625,7 +615,7 @@ bool ExternalCompany::setPaymentTerms(
             this->payment_terms ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             payment_terms ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->payment_terms = payment_terms;
         return true;
     }
@@ -637,7 +627,7 @@ bool ExternalCompany::setPreferredCurrency(
 )
 {
     if (this->preferred_currency != preferred_currency) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->preferred_currency),
             std::make_optional(preferred_currency),
@@ -645,7 +635,7 @@ bool ExternalCompany::setPreferredCurrency(
             ChangeLog::FieldType::Currencies,
             ChangeLog::FieldType::Currencies,
             ChangeLog::Action::Change
-        ));
+        );
         this->preferred_currency = preferred_currency;
         return true;
     }
@@ -657,7 +647,7 @@ bool ExternalCompany::setServiceLevelAgreement(
 )
 {
     if (this->service_level_agreement != service_level_agreement) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->service_level_agreement),
             OPTIONAL_STR_TO_VALUE(service_level_agreement),
@@ -666,7 +656,7 @@ bool ExternalCompany::setServiceLevelAgreement(
                                           : ChangeLog::FieldType::null,
             service_level_agreement ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->service_level_agreement = service_level_agreement;
         return true;
     }
@@ -678,7 +668,7 @@ bool ExternalCompany::setPreferredIntegrationTool(
 )
 {
     if (this->preferred_integration_tool != preferred_integration_tool) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->preferred_integration_tool),
             OPTIONAL_STR_TO_VALUE(preferred_integration_tool),
@@ -687,7 +677,7 @@ bool ExternalCompany::setPreferredIntegrationTool(
                                              : ChangeLog::FieldType::null,
             preferred_integration_tool ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->preferred_integration_tool = preferred_integration_tool;
         return true;
     }
@@ -699,7 +689,7 @@ bool ExternalCompany::setIntegrationStatus(
 )
 {
     if (this->integration_status != integration_status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->integration_status ? std::make_optional(this->integration_status.value())
                                      : std::nullopt,
@@ -710,7 +700,7 @@ bool ExternalCompany::setIntegrationStatus(
             integration_status ? ChangeLog::FieldType::IntegrationStatus
                                : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->integration_status = integration_status;
         return true;
     }
@@ -722,7 +712,7 @@ bool ExternalCompany::setWinRate(
 )
 {
     if (this->win_rate != win_rate) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->win_rate ? std::make_optional(this->win_rate.value()) : std::nullopt,
             win_rate ? std::make_optional(win_rate.value()) : std::nullopt,
@@ -730,7 +720,7 @@ bool ExternalCompany::setWinRate(
             this->win_rate ? ChangeLog::FieldType::Double : ChangeLog::FieldType::null,
             win_rate ? ChangeLog::FieldType::Double : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->win_rate = win_rate;
         return true;
     }
@@ -742,7 +732,7 @@ bool ExternalCompany::setComplianceStatus(
 )
 {
     if (this->compliance_status != compliance_status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->compliance_status ? std::make_optional(this->compliance_status.value())
                                     : std::nullopt,
@@ -752,7 +742,7 @@ bool ExternalCompany::setComplianceStatus(
                                     : ChangeLog::FieldType::null,
             compliance_status ? ChangeLog::FieldType::ComplianceLevel : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->compliance_status = compliance_status;
         return true;
     }
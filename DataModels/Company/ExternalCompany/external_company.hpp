@@ -1,6 +1,7 @@
 #pragma once
 #include "Company/company.hpp"
 #include "Currencies/currencies.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 
 class ExternalCompany : public Company {
@@ -24,7 +25,7 @@ public:
         const OptionalStr&                    email,
         const OptionalStr&                    country_code,
         const AddressPtr&                     registered_address,
-        const DatePtr&                        founded_date,
+        const OptionalDate&                   founded_date,
         const OptionalStr&                    tax_id,
         const std::optional<CompanyStatus>&   status,
         const std::optional<uint32_t>&        employee_count,
@@ -37,7 +38,7 @@ public:
         const RiskLevel&                      risk_level,
         const WeakInternalEmployee&           account_manager,
         const OptionalStr&                    VAT_number,
-        const DatePtr&                        last_interaction_date,
+        const OptionalDate&                   last_interaction_date,
         const OptionalStr&                    preferred_contact_method,
         const OptionalStr&                    payment_terms,
         const Currencies&                     preferred_currency,
@@ -60,13 +61,13 @@ public:
     /// @name Getters
     /// @{
     auto getType() const -> CompanyType;
-    auto getOtherType() const -> const OptionalStr&;
+    auto getOtherType() const -> const OptionalInterned&;
     auto getSize() const -> CompanySize;
     auto getRating() const -> Rating;
     auto getRiskLevel() const -> RiskLevel;
     auto getAccountManager() const -> const WeakInternalEmployee&;
     auto getVatNumber() const -> const OptionalStr&;
-    auto getLastInteractionDate() const -> const DatePtr&;
+    auto getLastInteractionDate() const -> const OptionalDate&;
     auto getPreferredContactMethod() const -> const OptionalStr&;
     auto getPaymentTerms() const -> const OptionalStr&;
     auto getPreferredCurrency() const -> const Currencies&;
@@ -96,7 +97,7 @@ public:
     );
     bool setVatNumber(const OptionalStr& VAT_number, const InternalEmployeePtr& changer);
     bool setLastInteractionDate(
-        const DatePtr& last_interaction_date, const InternalEmployeePtr& changer
+        const OptionalDate& last_interaction_date, const InternalEmployeePtr& changer
     );
     bool setCreditLimit(const MoneyPtr& credit_limit, const InternalEmployeePtr& changer);
     bool setTotalRevenueGenerated(
@@ -149,13 +150,13 @@ public:
     /// @}
 private:
     CompanyType          type;
-    OptionalStr          other_type;
+    OptionalInterned     other_type;
     CompanySize          size;
     Rating               rating;
     RiskLevel            risk_level;
     WeakInternalEmployee account_manager;
     OptionalStr          VAT_number;
-    DatePtr              last_interaction_date;
+    OptionalDate         last_interaction_date;
     OptionalStr          preferred_contact_method;
     OptionalStr          payment_terms;
     Currencies           preferred_currency;
@@ -1,6 +1,8 @@
 #include "company.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 
 Company::Company(const BigUint& id) : id(id) {}
 Company::Company(
@@ -13,7 +15,7 @@ Company::Company(
     const OptionalStr&                  email,
     const OptionalStr&                  country_code,
     const AddressPtr&                   registered_address,
-    const DatePtr&                      founded_date,
+    const OptionalDate&                 founded_date,
     const OptionalStr&                  tax_id,
     const std::optional<CompanyStatus>& status,
     const std::optional<uint32_t>&      employee_count,
@@ -70,13 +72,13 @@ auto Company::getEmployeeCount() const -> const std::optional<uint32_t>&
     return this->employee_count;
 }
 auto Company::getAnnualRevenue() const -> const MoneyPtr& { return this->annual_revenue; }
-auto Company::getChangeLogs() const -> const std::vector<ChangeLogPtr>&
+auto Company::getChangeLogs() const -> ChangeLogView
 {
-    return this->change_logs;
+    return ChangeLogView(this->change_logs);
 }
 auto Company::getIndustry() const -> const OptionalStr& { return this->industry; }
 auto Company::getCountryCode() const -> const OptionalStr& { return this->country_code; }
-auto Company::getFoundedDate() const -> const DatePtr& { return this->founded_date; }
+auto Company::getFoundedDate() const -> const OptionalDate& { return this->founded_date; }
 auto Company::getTaxRates() const -> const std::vector<TaxInfo>& { return this->tax_rates; }
 auto Company::getTaxId() const -> const OptionalStr& { return this->tax_id; }
 auto Company::getStatus() const -> const std::optional<CompanyStatus>& { return this->status; }
@@ -87,18 +89,15 @@ auto Company::getBudget() const -> const MoneyPtr& { return this->budget; }
 bool Company::setCompanyName(const std::string& company_name, const InternalEmployeePtr& changer)
 {
     if (this->company_name != company_name) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->company_name)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(company_name)
-            ),
+            ChangeValue::fromText(this->company_name),
+            ChangeValue::fromText(company_name),
             CompanyFields::CompanyName,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->company_name = company_name;
         return true;
     }
@@ -108,7 +107,7 @@ bool Company::setCompanyName(const std::string& company_name, const InternalEmpl
 bool Company::setLegalName(const OptionalStr& legal_name, const InternalEmployeePtr& changer)
 {
     if (this->legal_name != legal_name) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->legal_name),
             OPTIONAL_STR_TO_VALUE(legal_name),
@@ -116,7 +115,7 @@ bool Company::setLegalName(const OptionalStr& legal_name, const InternalEmployee
             this->legal_name ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             legal_name ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->legal_name = legal_name;
         return true;
     }
@@ -126,7 +125,7 @@ bool Company::setLegalName(const OptionalStr& legal_name, const InternalEmployee
 bool Company::setWebsiteUrl(const OptionalStr& website_url, const InternalEmployeePtr& changer)
 {
     if (this->website_url != website_url) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->website_url),
             OPTIONAL_STR_TO_VALUE(website_url),
@@ -134,7 +133,7 @@ bool Company::setWebsiteUrl(const OptionalStr& website_url, const InternalEmploy
             this->website_url ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             website_url ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->website_url = website_url;
         return true;
     }
@@ -151,7 +150,7 @@ bool Company::setPhoneNumber(const PhoneNumberPtr& phone_number, const InternalE
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->phone_number),
         PTR_TO_OPTIONAL(phone_number),
@@ -159,7 +158,7 @@ bool Company::setPhoneNumber(const PhoneNumberPtr& phone_number, const InternalE
         this->phone_number ? ChangeLog::FieldType::PhoneNumber : ChangeLog::FieldType::null,
         phone_number ? ChangeLog::FieldType::PhoneNumber : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->phone_number = phone_number;
     return true;
 }
@@ -167,7 +166,7 @@ bool Company::setPhoneNumber(const PhoneNumberPtr& phone_number, const InternalE
 bool Company::setEmail(const OptionalStr& email, const InternalEmployeePtr& changer)
 {
     if (this->email != email) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->email),
             OPTIONAL_STR_TO_VALUE(email),
@@ -175,7 +174,7 @@ bool Company::setEmail(const OptionalStr& email, const InternalEmployeePtr& chan
             this->email ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             email ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->email = email;
         return true;
     }
@@ -193,7 +192,7 @@ bool Company::setRegisteredAddress(
     } else if (*this->registered_address == *registered_address) {
         return false;
     }
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->registered_address),
         PTR_TO_OPTIONAL(registered_address),
@@ -201,7 +200,7 @@ bool Company::setRegisteredAddress(
         this->registered_address ? ChangeLog::FieldType::Address : ChangeLog::FieldType::null,
         registered_address ? ChangeLog::FieldType::Address : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->registered_address = registered_address;
     return true;
 }
@@ -211,7 +210,7 @@ bool Company::setEmployeeCount(
 )
 {
     if (this->employee_count != employee_count) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->employee_count ? std::make_optional(this->employee_count.value()) : std::nullopt,
             employee_count ? std::make_optional(employee_count.value()) : std::nullopt,
@@ -219,7 +218,7 @@ bool Company::setEmployeeCount(
             this->employee_count ? ChangeLog::FieldType::Uint : ChangeLog::FieldType::null,
             employee_count ? ChangeLog::FieldType::Uint : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->employee_count = employee_count;
         return true;
     }
@@ -236,7 +235,7 @@ bool Company::setAnnualRevenue(const MoneyPtr& annual_revenue, const InternalEmp
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->annual_revenue),
         PTR_TO_OPTIONAL(annual_revenue),
@@ -244,7 +243,7 @@ bool Company::setAnnualRevenue(const MoneyPtr& annual_revenue, const InternalEmp
         this->annual_revenue ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         annual_revenue ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->annual_revenue = annual_revenue;
     return true;
 }
@@ -252,7 +251,7 @@ bool Company::setAnnualRevenue(const MoneyPtr& annual_revenue, const InternalEmp
 bool Company::addNote(const Note& note, const InternalEmployeePtr& changer)
 {
     if (std::find(this->notes.begin(), this->notes.end(), note) == this->notes.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Note>(note)),
@@ -260,7 +259,7 @@ bool Company::addNote(const Note& note, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Note,
             ChangeLog::Action::Add
-        ));
+        );
         this->notes.push_back(note);
         return true;
     }
@@ -270,7 +269,7 @@ bool Company::addNote(const Note& note, const InternalEmployeePtr& changer)
 bool Company::delNote(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->notes.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Note>(this->notes[index])),
             std::nullopt,
@@ -278,7 +277,7 @@ bool Company::delNote(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Note,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->notes.erase(this->notes.begin() + index);
         return true;
     }
@@ -291,7 +290,7 @@ bool Company::addMorePhoneNumber(
 {
     if (std::find(this->more_phone_numbers.begin(), this->more_phone_numbers.end(), phone_number) ==
         this->more_phone_numbers.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(std::make_shared<PhoneNumber>(phone_number)
@@ -300,7 +299,7 @@ bool Company::addMorePhoneNumber(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::PhoneNumber,
             ChangeLog::Action::Add
-        ));
+        );
         this->more_phone_numbers.push_back(phone_number);
         return true;
     }
@@ -310,7 +309,7 @@ bool Company::addMorePhoneNumber(
 bool Company::delMorePhoneNumber(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->more_phone_numbers.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(
                 std::make_shared<PhoneNumber>(this->more_phone_numbers[index])
@@ -320,7 +319,7 @@ bool Company::delMorePhoneNumber(size_t index, const InternalEmployeePtr& change
             ChangeLog::FieldType::PhoneNumber,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->more_phone_numbers.erase(this->more_phone_numbers.begin() + index);
         return true;
     }
@@ -331,15 +330,15 @@ bool Company::addMoreEmail(const std::string& email, const InternalEmployeePtr&
 {
     if (std::find(this->more_emails.begin(), this->more_emails.end(), email) ==
         this->more_emails.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(email)),
+            ChangeValue::fromText(email),
             CompanyFields::MoreEmails,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add
-        ));
+        );
         this->more_emails.push_back(email);
         return true;
     }
@@ -349,17 +348,15 @@ bool Company::addMoreEmail(const std::string& email, const InternalEmployeePtr&
 bool Company::delMoreEmail(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->more_emails.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->more_emails[index])
-            ),
+            ChangeValue::fromText(this->more_emails[index]),
             std::nullopt,
             CompanyFields::MoreEmails,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->more_emails.erase(this->more_emails.begin() + index);
         return true;
     }
@@ -369,7 +366,7 @@ bool Company::delMoreEmail(size_t index, const InternalEmployeePtr& changer)
 bool Company::setIndustry(const OptionalStr& industry, const InternalEmployeePtr& changer)
 {
     if (this->industry != industry) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->industry),
             OPTIONAL_STR_TO_VALUE(industry),
@@ -377,7 +374,7 @@ bool Company::setIndustry(const OptionalStr& industry, const InternalEmployeePtr
             this->industry ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             industry ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->industry = industry;
         return true;
     }
@@ -387,7 +384,7 @@ bool Company::setIndustry(const OptionalStr& industry, const InternalEmployeePtr
 bool Company::setCountryCode(const OptionalStr& country_code, const InternalEmployeePtr& changer)
 {
     if (this->country_code != country_code) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->country_code),
             OPTIONAL_STR_TO_VALUE(country_code),
@@ -395,32 +392,26 @@ bool Company::setCountryCode(const OptionalStr& country_code, const InternalEmpl
             this->country_code ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             country_code ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->country_code = country_code;
         return true;
     }
     return false;
 }
 
-bool Company::setFoundedDate(const DatePtr& founded_date, const InternalEmployeePtr& changer)
+bool Company::setFoundedDate(const OptionalDate& founded_date, const InternalEmployeePtr& changer)
 {
-    if (this->founded_date == nullptr || founded_date == nullptr) {
-        if (this->founded_date == founded_date) {
-            return false;
-        }
-    } else if (*this->founded_date == *founded_date) {
-        return false;
-    }
+    if (this->founded_date == founded_date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->founded_date),
-        PTR_TO_OPTIONAL(founded_date),
+        OPTIONAL_TO_VALUE(this->founded_date),
+        OPTIONAL_TO_VALUE(founded_date),
         CompanyFields::FoundedDate,
         this->founded_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         founded_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->founded_date = founded_date;
     return true;
 }
@@ -428,7 +419,7 @@ bool Company::setFoundedDate(const DatePtr& founded_date, const InternalEmployee
 bool Company::setTaxId(const OptionalStr& tax_id, const InternalEmployeePtr& changer)
 {
     if (this->tax_id != tax_id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->tax_id),
             OPTIONAL_STR_TO_VALUE(tax_id),
@@ -436,7 +427,7 @@ bool Company::setTaxId(const OptionalStr& tax_id, const InternalEmployeePtr& cha
             this->tax_id ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             tax_id ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->tax_id = tax_id;
         return true;
     }
@@ -458,7 +449,7 @@ bool Company::setStatus(
                 ? std::nullopt
                 : std::make_optional<ChangeLog::ValueVariant>(CompanyStatus(status.value()));
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             old_value,
             new_value,
@@ -468,7 +459,7 @@ bool Company::setStatus(
             new_value == std::nullopt ? ChangeLog::FieldType::null
                                       : ChangeLog::FieldType::CompanyStatus,
             ChangeLog::Action::Change
-        ));
+        );
         this->status = status;
         return true;
     }
@@ -485,7 +476,7 @@ bool Company::setBudget(const MoneyPtr& budget, const InternalEmployeePtr& chang
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->budget),
         PTR_TO_OPTIONAL(budget),
@@ -493,7 +484,7 @@ bool Company::setBudget(const MoneyPtr& budget, const InternalEmployeePtr& chang
         this->budget ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         budget ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->budget = budget;
     return true;
 }
@@ -502,7 +493,7 @@ bool Company::addTaxRate(const TaxInfo& tax_rate, const InternalEmployeePtr& cha
 {
     if (std::find(this->tax_rates.begin(), this->tax_rates.end(), tax_rate) ==
         this->tax_rates.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(std::make_shared<TaxInfo>(tax_rate)),
@@ -510,7 +501,7 @@ bool Company::addTaxRate(const TaxInfo& tax_rate, const InternalEmployeePtr& cha
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::TaxInfo,
             ChangeLog::Action::Add
-        ));
+        );
         this->tax_rates.push_back(tax_rate);
         return true;
     }
@@ -520,7 +511,7 @@ bool Company::addTaxRate(const TaxInfo& tax_rate, const InternalEmployeePtr& cha
 bool Company::delTaxRate(size_t index, const InternalEmployeePtr& changer)
 {
     if (index < this->tax_rates.size()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(
                 std::make_shared<TaxInfo>(this->tax_rates[index])
@@ -530,7 +521,7 @@ bool Company::delTaxRate(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::TaxInfo,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->tax_rates.erase(this->tax_rates.begin() + index);
         return true;
     }
@@ -546,7 +537,7 @@ bool Company::addDeal(const WeakDealPtr& deal, const InternalEmployeePtr& change
                 return !(deal.owner_before(other_deal) || other_deal.owner_before(deal));
             }
         ) == this->deals.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(deal),
@@ -554,7 +545,7 @@ bool Company::addDeal(const WeakDealPtr& deal, const InternalEmployeePtr& change
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakDeal,
             ChangeLog::Action::Add
-        ));
+        );
         this->deals.push_back(deal);
         return true;
     }
@@ -564,7 +555,7 @@ bool Company::addDeal(const WeakDealPtr& deal, const InternalEmployeePtr& change
 bool Company::delDeal(size_t index, const InternalEmployeePtr& changer)
 {
     if (index < this->deals.size()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->deals[index]),
             std::nullopt,
@@ -572,7 +563,7 @@ bool Company::delDeal(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::WeakDeal,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->deals.erase(this->deals.begin() + index);
         return true;
     }
@@ -582,7 +573,7 @@ bool Company::delDeal(size_t index, const InternalEmployeePtr& changer)
 bool Company::addTask(const TaskPtr& task, const InternalEmployeePtr& changer)
 {
     if (std::find(this->tasks.begin(), this->tasks.end(), task) == this->tasks.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(task),
@@ -590,7 +581,7 @@ bool Company::addTask(const TaskPtr& task, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Task,
             ChangeLog::Action::Add
-        ));
+        );
         this->tasks.push_back(task);
         return true;
     }
@@ -600,7 +591,7 @@ bool Company::addTask(const TaskPtr& task, const InternalEmployeePtr& changer)
 bool Company::delTask(size_t index, const InternalEmployeePtr& changer)
 {
     if (index < this->tasks.size()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->tasks[index]),
             std::nullopt,
@@ -608,7 +599,7 @@ bool Company::delTask(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Task,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->tasks.erase(this->tasks.begin() + index);
         return true;
     }
@@ -4,6 +4,7 @@
 #include "Address/address.hpp"
 #include "BigNum/big_uint.hpp"
 #include "BigNum/money.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "DateTime/date.hpp"
 #include "Note/note.hpp"
 #include "Person/Employee/external_employee.hpp"
@@ -40,7 +41,7 @@ public:
         const OptionalStr&                  email,
         const OptionalStr&                  country_code,
         const AddressPtr&                   registered_address,
-        const DatePtr&                      founded_date,
+        const OptionalDate&                 founded_date,
         const OptionalStr&                  tax_id,
         const std::optional<CompanyStatus>& status,
         const std::optional<uint32_t>&      employee_count,
@@ -69,7 +70,7 @@ public:
     auto getCountryCode() const -> const OptionalStr&;
     auto getRegisteredAddress() const -> const AddressPtr&;
     auto getCreatedAt() const -> const Date&;
-    auto getFoundedDate() const -> const DatePtr&;
+    auto getFoundedDate() const -> const OptionalDate&;
     auto getTaxRates() const -> const std::vector<TaxInfo>&;
     auto getTaxId() const -> const OptionalStr&;
     auto getStatus() const -> const std::optional<CompanyStatus>&;
@@ -80,7 +81,7 @@ public:
     auto getEmployeeCount() const -> const std::optional<uint32_t>&;
     auto getAnnualRevenue() const -> const MoneyPtr&;
     auto getBudget() const -> const MoneyPtr&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
     /// @}
 
     /// @name Change functions
@@ -95,7 +96,7 @@ public:
     bool setRegisteredAddress(
         const AddressPtr& registered_address, const InternalEmployeePtr& changer
     );
-    bool setFoundedDate(const DatePtr& founded_date, const InternalEmployeePtr& changer);
+    bool setFoundedDate(const OptionalDate& founded_date, const InternalEmployeePtr& changer);
     bool setTaxId(const OptionalStr& tax_id, const InternalEmployeePtr& changer);
     bool setStatus(const std::optional<CompanyStatus>& status, const InternalEmployeePtr& changer);
     bool setEmployeeCount(
@@ -137,7 +138,7 @@ private:
     OptionalStr    country_code;
     AddressPtr     registered_address;
     Date           created_at;
-    DatePtr        founded_date;
+    OptionalDate   founded_date;
 
     MoneyPtr       annual_revenue;
     MoneyPtr       budget;
@@ -152,5 +153,5 @@ private:
     std::optional<uint32_t>      employee_count;
 
 protected:
-    std::vector<ChangeLogPtr> change_logs;
+    ChangeChain               change_logs{EntityType::Company, id};
 };
\ No newline at end of file
@@ -1,10 +1,16 @@
 #pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <variant>
-#include <unordered_map>
 
 /// Currencies that use bars according to the standard -> ISO_4217 Pblshd="2025-05-12"
-enum class ountriesCurrencies : uint8_t {
+enum class CountriesCurrencies : uint8_t {
 	AED, AFN, ALL, AMD, AOA, ARS, AUD, AWG, AZN, BAM, BBD, BDT, BGN,
 	BHD, BIF, BMD, BND, BOB, BOV, BRL, BSD, BTN, BWP, BYN, BZD, CAD,
 	CDF, CHE, CHF, CHW, CLF, CLP, CNY, COP, COU, CRC, CUP, CVE, CZK,
@@ -251,166 +257,206 @@ enum class CryptoCurrency : uint8_t {
 	USDTETH ///< Tether ETH
 };
 
-using Currencies = std::variant<ountriesCurrencies, CryptoCurrency>;
+using Currencies = std::variant<CountriesCurrencies, CryptoCurrency>;
+
+/// Static description of a currency
+struct CurrencyInfo {
+	std::string_view code;         ///< ISO 4217 alphabetic code, or the ticker of a crypto asset
+	uint8_t          minor_units;  ///< Digits after the point (ISO 4217 "minor unit" column)
+};
+
+/**
+ * Compile-time metadata of every currency, indexed by the enum value. Cryptocurrencies are
+ * kept with satoshi precision (8 digits).
+ */
+namespace currency_table {
+	inline constexpr auto countries = std::to_array<CurrencyInfo>({
+		{"AED", 2}, {"AFN", 2}, {"ALL", 2}, {"AMD", 2}, {"AOA", 2}, {"ARS", 2},
+		{"AUD", 2}, {"AWG", 2}, {"AZN", 2}, {"BAM", 2}, {"BBD", 2}, {"BDT", 2},
+		{"BGN", 2}, {"BHD", 3}, {"BIF", 0}, {"BMD", 2}, {"BND", 2}, {"BOB", 2},
+		{"BOV", 2}, {"BRL", 2}, {"BSD", 2}, {"BTN", 2}, {"BWP", 2}, {"BYN", 2},
+		{"BZD", 2}, {"CAD", 2}, {"CDF", 2}, {"CHE", 2}, {"CHF", 2}, {"CHW", 2},
+		{"CLF", 4}, {"CLP", 0}, {"CNY", 2}, {"COP", 2}, {"COU", 2}, {"CRC", 2},
+		{"CUP", 2}, {"CVE", 2}, {"CZK", 2}, {"DJF", 0}, {"DKK", 2}, {"DOP", 2},
+		{"DZD", 2}, {"EGP", 2}, {"ERN", 2}, {"ETB", 2}, {"EUR", 2}, {"FJD", 2},
+		{"FKP", 2}, {"GBP", 2}, {"GEL", 2}, {"GHS", 2}, {"GIP", 2}, {"GMD", 2},
+		{"GNF", 0}, {"GTQ", 2}, {"GYD", 2}, {"HKD", 2}, {"HNL", 2}, {"HTG", 2},
+		{"HUF", 2}, {"IDR", 2}, {"ILS", 2}, {"INR", 2}, {"IQD", 3}, {"IRR", 2},
+		{"ISK", 0}, {"JMD", 2}, {"JOD", 3}, {"JPY", 0}, {"KES", 2}, {"KGS", 2},
+		{"KHR", 2}, {"KMF", 0}, {"KPW", 2}, {"KRW", 0}, {"KWD", 3}, {"KYD", 2},
+		{"KZT", 2}, {"LAK", 2}, {"LBP", 2}, {"LKR", 2}, {"LRD", 2}, {"LSL", 2},
+		{"LYD", 3}, {"MAD", 2}, {"MDL", 2}, {"MGA", 2}, {"MKD", 2}, {"MMK", 2},
+		{"MNT", 2}, {"MOP", 2}, {"MRU", 2}, {"MUR", 2}, {"MVR", 2}, {"MWK", 2},
+		{"MXN", 2}, {"MXV", 2}, {"MYR", 2}, {"MZN", 2}, {"NAD", 2}, {"NGN", 2},
+		{"NIO", 2}, {"NOK", 2}, {"NPR", 2}, {"NZD", 2}, {"OMR", 3}, {"PAB", 2},
+		{"PEN", 2}, {"PGK", 2}, {"PHP", 2}, {"PKR", 2}, {"PLN", 2}, {"PYG", 0},
+		{"QAR", 2}, {"RON", 2}, {"RSD", 2}, {"RUB", 2}, {"RWF", 0}, {"SAR", 2},
+		{"SBD", 2}, {"SCR", 2}, {"SDG", 2}, {"SEK", 2}, {"SGD", 2}, {"SHP", 2},
+		{"SLE", 2}, {"SOS", 2}, {"SRD", 2}, {"SSP", 2}, {"STN", 2}, {"SVC", 2},
+		{"SYP", 2}, {"SZL", 2}, {"THB", 2}, {"TJS", 2}, {"TMT", 2}, {"TND", 3},
+		{"TOP", 2}, {"TRY", 2}, {"TTD", 2}, {"TWD", 2}, {"TZS", 2}, {"UAH", 2},
+		{"UGX", 0}, {"USD", 2}, {"USN", 2}, {"UYI", 0}, {"UYU", 2}, {"UYW", 4},
+		{"UZS", 2}, {"VED", 2}, {"VES", 2}, {"VND", 0}, {"VUV", 0}, {"WST", 2},
+		{"XAD", 2}, {"XAF", 0}, {"XAG", 2}, {"XAU", 2}, {"XBA", 2}, {"XBB", 2},
+		{"XBC", 2}, {"XBD", 2}, {"XCD", 2}, {"XCG", 2}, {"XDR", 2}, {"XOF", 0},
+		{"XPD", 2}, {"XPF", 0}, {"XPT", 2}, {"XSU", 2}, {"XTS", 2}, {"XUA", 2},
+		{"XXX", 2}, {"YER", 2}, {"ZAR", 2}, {"ZMW", 2}, {"ZWG", 2}
+	});
+	static_assert(countries.size() == static_cast<size_t>(CountriesCurrencies::ZWG) + 1);
+
+	inline constexpr auto crypto = std::to_array<CurrencyInfo>({
+		{"BTC", 8}, {"ETH", 8}, {"USDT", 8}, {"USDC", 8}, {"BNB", 8},
+		{"XRP", 8}, {"SOL", 8}, {"ADA", 8}, {"DOGE", 8}, {"DOT", 8},
+		{"LTC", 8}, {"BCH", 8}, {"XLM", 8}, {"XMR", 8}, {"DAI", 8},
+		{"TRX", 8}, {"MATIC", 8}, {"AVAX", 8}, {"LINK", 8}, {"UNI", 8},
+		{"ATOM", 8}, {"ETC", 8}, {"XTZ", 8}, {"EOS", 8}, {"NEO", 8},
+		{"VET", 8}, {"ALGO", 8}, {"ZEC", 8}, {"DASH", 8}, {"BSV", 8},
+		{"MIOTA", 8}, {"HBAR", 8}, {"CRO", 8}, {"FTT", 8}, {"KLAY", 8},
+		{"THETA", 8}, {"FLOW", 8}, {"GRT", 8}, {"SAND", 8}, {"MANA", 8},
+		{"AXS", 8}, {"GALA", 8}, {"ENJ", 8}, {"CHZ", 8}, {"BAT", 8},
+		{"COMP", 8}, {"AAVE", 8}, {"MKR", 8}, {"SNX", 8}, {"YFI", 8},
+		{"SUSHI", 8}, {"CRV", 8}, {"UST", 8}, {"LUNA", 8}, {"FTM", 8},
+		{"ONE", 8}, {"CELO", 8}, {"RVN", 8}, {"SC", 8}, {"AR", 8},
+		{"FIL", 8}, {"ICP", 8}, {"QNT", 8}, {"NEXO", 8}, {"CAKE", 8},
+		{"KSM", 8}, {"WAVES", 8}, {"ZIL", 8}, {"IOST", 8}, {"ONT", 8},
+		{"HOT", 8}, {"OMG", 8}, {"ZRX", 8}, {"REP", 8}, {"KNC", 8},
+		{"NMR", 8}, {"OXT", 8}, {"REN", 8}, {"LRC", 8}, {"CVC", 8},
+		{"STORJ", 8}, {"SNT", 8}, {"FUN", 8}, {"POWR", 8}, {"GNT", 8},
+		{"DNT", 8}, {"MLN", 8}, {"ANT", 8}, {"BAL", 8}, {"UMA", 8},
+		{"BAND", 8}, {"OCEAN", 8}, {"RSV", 8}, {"AMP", 8}, {"RAI", 8},
+		{"FEI", 8}, {"TRIBE", 8}, {"FORTH", 8}, {"RAD", 8}, {"API3", 8},
+		{"BADGER", 8}, {"RARI", 8}, {"NFTX", 8}, {"SOS", 8}, {"GTC", 8},
+		{"ILV", 8}, {"IMX", 8}, {"GODS", 8}, {"RLY", 8}, {"AUDIO", 8},
+		{"WOO", 8}, {"PERP", 8}, {"DYDX", 8}, {"RBN", 8}, {"ORCA", 8},
+		{"RAY", 8}, {"SRM", 8}, {"FIDA", 8}, {"MAPS", 8}, {"OXY", 8},
+		{"MSOL", 8}, {"ATLAS", 8}, {"POLIS", 8}, {"SBR", 8}, {"PORT", 8},
+		{"SLRS", 8}, {"SUNNY", 8}, {"STEP", 8}, {"COPE", 8}, {"LIKE", 8},
+		{"MNGO", 8}, {"FTT2", 8}, {"LUNA2", 8}, {"LUNC", 8}, {"USDN", 8},
+		{"USDP", 8}, {"BUSD", 8}, {"TUSD", 8}, {"HUSD", 8}, {"USDK", 8},
+		{"GUSD", 8}, {"SUSD", 8}, {"LUSD", 8}, {"FRAX", 8}, {"MIM", 8},
+		{"VAI", 8}, {"CUSD", 8}, {"CEUR", 8}, {"EURS", 8}, {"EURT", 8},
+		{"XAUT", 8}, {"PAXG", 8}, {"WBTC", 8}, {"RENBTC", 8}, {"SBTC", 8},
+		{"TBTC", 8}, {"STETH", 8}, {"RETH", 8}, {"AETH", 8}, {"SETH", 8},
+		{"WETH", 8}, {"CETH", 8}, {"YVETH", 8}, {"ALETH", 8}, {"DETH", 8},
+		{"UNIETH", 8}, {"PETH", 8}, {"GETH", 8}, {"XETH", 8}, {"HETH", 8},
+		{"POLYETH", 8}, {"ARETH", 8}, {"OPETH", 8}, {"AVAXETH", 8}, {"FTMETH", 8},
+		{"ONEETH", 8}, {"SOLETH", 8}, {"ADAETH", 8}, {"DOTETH", 8}, {"XRPETH", 8},
+		{"LTCETH", 8}, {"BCHETH", 8}, {"XLMETH", 8}, {"EOSETH", 8}, {"TRXETH", 8},
+		{"XTZETH", 8}, {"ATOMETH", 8}, {"NEOETH", 8}, {"VETETH", 8}, {"ICXETH", 8},
+		{"ONTETH", 8}, {"ZILETH", 8}, {"QTUMETH", 8}, {"BTGETH", 8}, {"DASHETH", 8},
+		{"ZECETH", 8}, {"XMRETH", 8}, {"DCRETH", 8}, {"SCETH", 8}, {"WAVESETH", 8},
+		{"STRATETH", 8}, {"ARKETH", 8}, {"PIVXETH", 8}, {"GRSETH", 8}, {"NAVETH", 8},
+		{"VTCETH", 8}, {"RVNETH", 8}, {"MNXETH", 8}, {"EMC2ETH", 8}, {"GNOETH", 8},
+		{"REPETH", 8}, {"BATETH", 8}, {"ZRXETH", 8}, {"KNCETH", 8}, {"SNTETH", 8},
+		{"FUNETH", 8}, {"LINKETH", 8}, {"MANAETH", 8}, {"LOOMETH", 8}, {"CVCETH", 8},
+		{"DNTETH", 8}, {"STORJETH", 8}, {"OMGETH", 8}, {"TUSDETH", 8}, {"USDCETH", 8},
+		{"USDTETH", 8}
+	});
+	static_assert(crypto.size() == static_cast<size_t>(CryptoCurrency::USDTETH) + 1);
+
+	/// Crypto ids start after the ISO currencies, see `currencyId`
+	inline constexpr uint16_t crypto_base = 256;
+
+	/// Up to 8 characters of a code packed into one integer
+	constexpr uint64_t packCode(std::string_view code) {
+		if (code.empty() || code.size() > 8) return 0;
+		uint64_t packed = 0;
+		for (char ch : code) packed = packed << 8 | static_cast<uint8_t>(ch);
+		return packed;
+	}
 
-inline std::string countriesCurrencyToString(ountriesCurrencies currency) {
-	static const std::unordered_map<ountriesCurrencies, std::string> currencyMap = {
-		{ountriesCurrencies::AED, "AED"}, {ountriesCurrencies::AFN, "AFN"}, {ountriesCurrencies::ALL, "ALL"},
-		{ountriesCurrencies::AMD, "AMD"}, {ountriesCurrencies::AOA, "AOA"}, {ountriesCurrencies::ARS, "ARS"},
-		{ountriesCurrencies::AUD, "AUD"}, {ountriesCurrencies::AWG, "AWG"}, {ountriesCurrencies::AZN, "AZN"},
-		{ountriesCurrencies::BAM, "BAM"}, {ountriesCurrencies::BBD, "BBD"}, {ountriesCurrencies::BDT, "BDT"},
-		{ountriesCurrencies::BGN, "BGN"}, {ountriesCurrencies::BHD, "BHD"}, {ountriesCurrencies::BIF, "BIF"},
-		{ountriesCurrencies::BMD, "BMD"}, {ountriesCurrencies::BND, "BND"}, {ountriesCurrencies::BOB, "BOB"},
-		{ountriesCurrencies::BOV, "BOV"}, {ountriesCurrencies::BRL, "BRL"}, {ountriesCurrencies::BSD, "BSD"},
-		{ountriesCurrencies::BTN, "BTN"}, {ountriesCurrencies::BWP, "BWP"}, {ountriesCurrencies::BYN, "BYN"},
-		{ountriesCurrencies::BZD, "BZD"}, {ountriesCurrencies::CAD, "CAD"}, {ountriesCurrencies::CDF, "CDF"},
-		{ountriesCurrencies::CHE, "CHE"}, {ountriesCurrencies::CHF, "CHF"}, {ountriesCurrencies::CHW, "CHW"},
-		{ountriesCurrencies::CLF, "CLF"}, {ountriesCurrencies::CLP, "CLP"}, {ountriesCurrencies::CNY, "CNY"},
-		{ountriesCurrencies::COP, "COP"}, {ountriesCurrencies::COU, "COU"}, {ountriesCurrencies::CRC, "CRC"},
-		{ountriesCurrencies::CUP, "CUP"}, {ountriesCurrencies::CVE, "CVE"}, {ountriesCurrencies::CZK, "CZK"},
-		{ountriesCurrencies::DJF, "DJF"}, {ountriesCurrencies::DKK, "DKK"}, {ountriesCurrencies::DOP, "DOP"},
-		{ountriesCurrencies::DZD, "DZD"}, {ountriesCurrencies::EGP, "EGP"}, {ountriesCurrencies::ERN, "ERN"},
-		{ountriesCurrencies::ETB, "ETB"}, {ountriesCurrencies::EUR, "EUR"}, {ountriesCurrencies::FJD, "FJD"},
-		{ountriesCurrencies::FKP, "FKP"}, {ountriesCurrencies::GBP, "GBP"}, {ountriesCurrencies::GEL, "GEL"},
-		{ountriesCurrencies::GHS, "GHS"}, {ountriesCurrencies::GIP, "GIP"}, {ountriesCurrencies::GMD, "GMD"},
-		{ountriesCurrencies::GNF, "GNF"}, {ountriesCurrencies::GTQ, "GTQ"}, {ountriesCurrencies::GYD, "GYD"},
-		{ountriesCurrencies::HKD, "HKD"}, {ountriesCurrencies::HNL, "HNL"}, {ountriesCurrencies::HTG, "HTG"},
-		{ountriesCurrencies::HUF, "HUF"}, {ountriesCurrencies::IDR, "IDR"}, {ountriesCurrencies::ILS, "ILS"},
-		{ountriesCurrencies::INR, "INR"}, {ountriesCurrencies::IQD, "IQD"}, {ountriesCurrencies::IRR, "IRR"},
-		{ountriesCurrencies::ISK, "ISK"}, {ountriesCurrencies::JMD, "JMD"}, {ountriesCurrencies::JOD, "JOD"},
-		{ountriesCurrencies::JPY, "JPY"}, {ountriesCurrencies::KES, "KES"}, {ountriesCurrencies::KGS, "KGS"},
-		{ountriesCurrencies::KHR, "KHR"}, {ountriesCurrencies::KMF, "KMF"}, {ountriesCurrencies::KPW, "KPW"},
-		{ountriesCurrencies::KRW, "KRW"}, {ountriesCurrencies::KWD, "KWD"}, {ountriesCurrencies::KYD, "KYD"},
-		{ountriesCurrencies::KZT, "KZT"}, {ountriesCurrencies::LAK, "LAK"}, {ountriesCurrencies::LBP, "LBP"},
-		{ountriesCurrencies::LKR, "LKR"}, {ountriesCurrencies::LRD, "LRD"}, {ountriesCurrencies::LSL, "LSL"},
-		{ountriesCurrencies::LYD, "LYD"}, {ountriesCurrencies::MAD, "MAD"}, {ountriesCurrencies::MDL, "MDL"},
-		{ountriesCurrencies::MGA, "MGA"}, {ountriesCurrencies::MKD, "MKD"}, {ountriesCurrencies::MMK, "MMK"},
-		{ountriesCurrencies::MNT, "MNT"}, {ountriesCurrencies::MOP, "MOP"}, {ountriesCurrencies::MRU, "MRU"},
-		{ountriesCurrencies::MUR, "MUR"}, {ountriesCurrencies::MVR, "MVR"}, {ountriesCurrencies::MWK, "MWK"},
-		{ountriesCurrencies::MXN, "MXN"}, {ountriesCurrencies::MXV, "MXV"}, {ountriesCurrencies::MYR, "MYR"},
-		{ountriesCurrencies::MZN, "MZN"}, {ountriesCurrencies::NAD, "NAD"}, {ountriesCurrencies::NGN, "NGN"},
-		{ountriesCurrencies::NIO, "NIO"}, {ountriesCurrencies::NOK, "NOK"}, {ountriesCurrencies::NPR, "NPR"},
-		{ountriesCurrencies::NZD, "NZD"}, {ountriesCurrencies::OMR, "OMR"}, {ountriesCurrencies::PAB, "PAB"},
-		{ountriesCurrencies::PEN, "PEN"}, {ountriesCurrencies::PGK, "PGK"}, {ountriesCurrencies::PHP, "PHP"},
-		{ountriesCurrencies::PKR, "PKR"}, {ountriesCurrencies::PLN, "PLN"}, {ountriesCurrencies::PYG, "PYG"},
-		{ountriesCurrencies::QAR, "QAR"}, {ountriesCurrencies::RON, "RON"}, {ountriesCurrencies::RSD, "RSD"},
-		{ountriesCurrencies::RUB, "RUB"}, {ountriesCurrencies::RWF, "RWF"}, {ountriesCurrencies::SAR, "SAR"},
-		{ountriesCurrencies::SBD, "SBD"}, {ountriesCurrencies::SCR, "SCR"}, {ountriesCurrencies::SDG, "SDG"},
-		{ountriesCurrencies::SEK, "SEK"}, {ountriesCurrencies::SGD, "SGD"}, {ountriesCurrencies::SHP, "SHP"},
-		{ountriesCurrencies::SLE, "SLE"}, {ountriesCurrencies::SOS, "SOS"}, {ountriesCurrencies::SRD, "SRD"},
-		{ountriesCurrencies::SSP, "SSP"}, {ountriesCurrencies::STN, "STN"}, {ountriesCurrencies::SVC, "SVC"},
-		{ountriesCurrencies::SYP, "SYP"}, {ountriesCurrencies::SZL, "SZL"}, {ountriesCurrencies::THB, "THB"},
-		{ountriesCurrencies::TJS, "TJS"}, {ountriesCurrencies::TMT, "TMT"}, {ountriesCurrencies::TND, "TND"},
-		{ountriesCurrencies::TOP, "TOP"}, {ountriesCurrencies::TRY, "TRY"}, {ountriesCurrencies::TTD, "TTD"},
-		{ountriesCurrencies::TWD, "TWD"}, {ountriesCurrencies::TZS, "TZS"}, {ountriesCurrencies::UAH, "UAH"},
-		{ountriesCurrencies::UGX, "UGX"}, {ountriesCurrencies::USD, "USD"}, {ountriesCurrencies::USN, "USN"},
-		{ountriesCurrencies::UYI, "UYI"}, {ountriesCurrencies::UYU, "UYU"}, {ountriesCurrencies::UYW, "UYW"},
-		{ountriesCurrencies::UZS, "UZS"}, {ountriesCurrencies::VED, "VED"}, {ountriesCurrencies::VES, "VES"},
-		{ountriesCurrencies::VND, "VND"}, {ountriesCurrencies::VUV, "VUV"}, {ountriesCurrencies::WST, "WST"},
-		{ountriesCurrencies::XAD, "XAD"}, {ountriesCurrencies::XAF, "XAF"}, {ountriesCurrencies::XAG, "XAG"},
-		{ountriesCurrencies::XAU, "XAU"}, {ountriesCurrencies::XBA, "XBA"}, {ountriesCurrencies::XBB, "XBB"},
-		{ountriesCurrencies::XBC, "XBC"}, {ountriesCurrencies::XBD, "XBD"}, {ountriesCurrencies::XCD, "XCD"},
-		{ountriesCurrencies::XCG, "XCG"}, {ountriesCurrencies::XDR, "XDR"}, {ountriesCurrencies::XOF, "XOF"},
-		{ountriesCurrencies::XPD, "XPD"}, {ountriesCurrencies::XPF, "XPF"}, {ountriesCurrencies::XPT, "XPT"},
-		{ountriesCurrencies::XSU, "XSU"}, {ountriesCurrencies::XTS, "XTS"}, {ountriesCurrencies::XUA, "XUA"},
-		{ountriesCurrencies::XXX, "XXX"}, {ountriesCurrencies::YER, "YER"}, {ountriesCurrencies::ZAR, "ZAR"},
-		{ountriesCurrencies::ZMW, "ZMW"}, {ountriesCurrencies::ZWG, "ZWG"}
+	struct CodeEntry {
+		uint64_t code;
+		uint16_t id;
 	};
 
-	auto it = currencyMap.find(currency);
-	return it != currencyMap.end() ? it->second : "unknow";
+	/// Every code sorted by its packed value. ISO codes win over tickers spelled the same (SOS).
+	inline constexpr auto by_code = [] {
+		std::array<CodeEntry, countries.size() + crypto.size()> entries{};
+		size_t                                                   size = 0;
+		for (size_t i = 0; i < countries.size(); i++) {
+			entries[size++] = {packCode(countries[i].code), static_cast<uint16_t>(i)};
+		}
+		for (size_t i = 0; i < crypto.size(); i++) {
+			entries[size++] = {packCode(crypto[i].code), static_cast<uint16_t>(crypto_base + i)};
+		}
+		// insertion sort: std::stable_sort is not constexpr before C++26
+		for (size_t i = 1; i < size; i++) {
+			CodeEntry entry = entries[i];
+			size_t    j     = i;
+			for (; j > 0 && entries[j - 1].code > entry.code; j--) entries[j] = entries[j - 1];
+			entries[j] = entry;
+		}
+		return entries;
+	}();
+}  // namespace currency_table
+
+constexpr const CurrencyInfo& currencyInfo(CountriesCurrencies currency) {
+	return currency_table::countries[static_cast<size_t>(currency)];
 }
 
-inline std::string cryptoCurrencyToString(CryptoCurrency crypto) {
-	static const std::unordered_map<CryptoCurrency, std::string> cryptoMap = {
-		{CryptoCurrency::BTC, "BTC"}, {CryptoCurrency::ETH, "ETH"}, {CryptoCurrency::USDT, "USDT"},
-		{CryptoCurrency::USDC, "USDC"}, {CryptoCurrency::BNB, "BNB"}, {CryptoCurrency::XRP, "XRP"},
-		{CryptoCurrency::SOL, "SOL"}, {CryptoCurrency::ADA, "ADA"}, {CryptoCurrency::DOGE, "DOGE"},
-		{CryptoCurrency::DOT, "DOT"}, {CryptoCurrency::LTC, "LTC"}, {CryptoCurrency::BCH, "BCH"},
-		{CryptoCurrency::XLM, "XLM"}, {CryptoCurrency::XMR, "XMR"}, {CryptoCurrency::DAI, "DAI"},
-		{CryptoCurrency::TRX, "TRX"}, {CryptoCurrency::MATIC, "MATIC"}, {CryptoCurrency::AVAX, "AVAX"},
-		{CryptoCurrency::LINK, "LINK"}, {CryptoCurrency::UNI, "UNI"}, {CryptoCurrency::ATOM, "ATOM"},
-		{CryptoCurrency::ETC, "ETC"}, {CryptoCurrency::XTZ, "XTZ"}, {CryptoCurrency::EOS, "EOS"},
-		{CryptoCurrency::NEO, "NEO"}, {CryptoCurrency::VET, "VET"}, {CryptoCurrency::ALGO, "ALGO"},
-		{CryptoCurrency::ZEC, "ZEC"}, {CryptoCurrency::DASH, "DASH"}, {CryptoCurrency::BSV, "BSV"},
-		{CryptoCurrency::MIOTA, "MIOTA"}, {CryptoCurrency::HBAR, "HBAR"}, {CryptoCurrency::CRO, "CRO"},
-		{CryptoCurrency::FTT, "FTT"}, {CryptoCurrency::KLAY, "KLAY"}, {CryptoCurrency::THETA, "THETA"},
-		{CryptoCurrency::FLOW, "FLOW"}, {CryptoCurrency::GRT, "GRT"},
-		{CryptoCurrency::SAND, "SAND"}, {CryptoCurrency::MANA, "MANA"}, {CryptoCurrency::AXS, "AXS"},
-		{CryptoCurrency::GALA, "GALA"}, {CryptoCurrency::ENJ, "ENJ"}, {CryptoCurrency::CHZ, "CHZ"},
-		{CryptoCurrency::BAT, "BAT"}, {CryptoCurrency::COMP, "COMP"}, {CryptoCurrency::AAVE, "AAVE"},
-		{CryptoCurrency::MKR, "MKR"}, {CryptoCurrency::SNX, "SNX"}, {CryptoCurrency::YFI, "YFI"},
-		{CryptoCurrency::SUSHI, "SUSHI"}, {CryptoCurrency::CRV, "CRV"}, {CryptoCurrency::UST, "UST"},
-		{CryptoCurrency::LUNA, "LUNA"}, {CryptoCurrency::FTM, "FTM"}, {CryptoCurrency::ONE, "ONE"},
-		{CryptoCurrency::CELO, "CELO"}, {CryptoCurrency::RVN, "RVN"}, {CryptoCurrency::SC, "SC"},
-		{CryptoCurrency::AR, "AR"}, {CryptoCurrency::FIL, "FIL"}, {CryptoCurrency::ICP, "ICP"},
-		{CryptoCurrency::QNT, "QNT"}, {CryptoCurrency::NEXO, "NEXO"}, {CryptoCurrency::CAKE, "CAKE"},
-		{CryptoCurrency::KSM, "KSM"}, {CryptoCurrency::WAVES, "WAVES"}, {CryptoCurrency::ZIL, "ZIL"},
-		{CryptoCurrency::IOST, "IOST"}, {CryptoCurrency::ONT, "ONT"}, {CryptoCurrency::HOT, "HOT"},
-		{CryptoCurrency::OMG, "OMG"}, {CryptoCurrency::ZRX, "ZRX"}, {CryptoCurrency::REP, "REP"},
-		{CryptoCurrency::KNC, "KNC"}, {CryptoCurrency::NMR, "NMR"}, {CryptoCurrency::OXT, "OXT"},
-		{CryptoCurrency::REN, "REN"}, {CryptoCurrency::LRC, "LRC"}, {CryptoCurrency::CVC, "CVC"},
-		{CryptoCurrency::STORJ, "STORJ"}, {CryptoCurrency::SNT, "SNT"}, {CryptoCurrency::FUN, "FUN"},
-		{CryptoCurrency::POWR, "POWR"}, {CryptoCurrency::GNT, "GNT"}, {CryptoCurrency::DNT, "DNT"},
-		{CryptoCurrency::MLN, "MLN"}, {CryptoCurrency::ANT, "ANT"}, {CryptoCurrency::BAL, "BAL"},
-		{CryptoCurrency::UMA, "UMA"}, {CryptoCurrency::BAND, "BAND"}, {CryptoCurrency::OCEAN, "OCEAN"},
-		{CryptoCurrency::RSV, "RSV"}, {CryptoCurrency::AMP, "AMP"}, {CryptoCurrency::RAI, "RAI"},
-		{CryptoCurrency::FEI, "FEI"}, {CryptoCurrency::TRIBE, "TRIBE"}, {CryptoCurrency::FORTH, "FORTH"},
-		{CryptoCurrency::RAD, "RAD"}, {CryptoCurrency::API3, "API3"}, {CryptoCurrency::BADGER, "BADGER"},
-		{CryptoCurrency::RARI, "RARI"}, {CryptoCurrency::NFTX, "NFTX"}, {CryptoCurrency::SOS, "SOS"},
-		{CryptoCurrency::GTC, "GTC"}, {CryptoCurrency::ILV, "ILV"}, {CryptoCurrency::IMX, "IMX"},
-		{CryptoCurrency::GODS, "GODS"}, {CryptoCurrency::RLY, "RLY"}, {CryptoCurrency::AUDIO, "AUDIO"},
-		{CryptoCurrency::WOO, "WOO"}, {CryptoCurrency::PERP, "PERP"}, {CryptoCurrency::DYDX, "DYDX"},
-		{CryptoCurrency::RBN, "RBN"}, {CryptoCurrency::ORCA, "ORCA"}, {CryptoCurrency::RAY, "RAY"},
-		{CryptoCurrency::SRM, "SRM"}, {CryptoCurrency::FIDA, "FIDA"}, {CryptoCurrency::MAPS, "MAPS"},
-		{CryptoCurrency::OXY, "OXY"}, {CryptoCurrency::MSOL, "MSOL"}, {CryptoCurrency::ATLAS, "ATLAS"},
-		{CryptoCurrency::POLIS, "POLIS"}, {CryptoCurrency::SBR, "SBR"}, {CryptoCurrency::PORT, "PORT"},
-		{CryptoCurrency::SLRS, "SLRS"}, {CryptoCurrency::SUNNY, "SUNNY"}, {CryptoCurrency::STEP, "STEP"},
-		{CryptoCurrency::COPE, "COPE"}, {CryptoCurrency::LIKE, "LIKE"}, {CryptoCurrency::MNGO, "MNGO"},
-		{CryptoCurrency::FTT2, "FTT2"}, {CryptoCurrency::LUNA2, "LUNA2"}, {CryptoCurrency::LUNC, "LUNC"},
-		{CryptoCurrency::USDN, "USDN"}, {CryptoCurrency::USDP, "USDP"}, {CryptoCurrency::BUSD, "BUSD"},
-		{CryptoCurrency::TUSD, "TUSD"}, {CryptoCurrency::HUSD, "HUSD"}, {CryptoCurrency::USDK, "USDK"},
-		{CryptoCurrency::GUSD, "GUSD"}, {CryptoCurrency::SUSD, "SUSD"}, {CryptoCurrency::LUSD, "LUSD"},
-		{CryptoCurrency::FRAX, "FRAX"}, {CryptoCurrency::MIM, "MIM"}, {CryptoCurrency::VAI, "VAI"},
-		{CryptoCurrency::CUSD, "CUSD"}, {CryptoCurrency::CEUR, "CEUR"}, {CryptoCurrency::EURS, "EURS"},
-		{CryptoCurrency::EURT, "EURT"}, {CryptoCurrency::XAUT, "XAUT"}, {CryptoCurrency::PAXG, "PAXG"},
-		{CryptoCurrency::WBTC, "WBTC"}, {CryptoCurrency::RENBTC, "RENBTC"}, {CryptoCurrency::SBTC, "SBTC"},
-		{CryptoCurrency::TBTC, "TBTC"}, {CryptoCurrency::STETH, "STETH"}, {CryptoCurrency::RETH, "RETH"},
-		{CryptoCurrency::AETH, "AETH"}, {CryptoCurrency::SETH, "SETH"}, {CryptoCurrency::WETH, "WETH"},
-		{CryptoCurrency::CETH, "CETH"}, {CryptoCurrency::YVETH, "YVETH"}, {CryptoCurrency::ALETH, "ALETH"},
-		{CryptoCurrency::DETH, "DETH"}, {CryptoCurrency::UNIETH, "UNIETH"}, {CryptoCurrency::PETH, "PETH"},
-		{CryptoCurrency::GETH, "GETH"}, {CryptoCurrency::XETH, "XETH"}, {CryptoCurrency::HETH, "HETH"},
-		{CryptoCurrency::POLYETH, "POLYETH"}, {CryptoCurrency::ARETH, "ARETH"}, {CryptoCurrency::OPETH, "OPETH"},
-		{CryptoCurrency::AVAXETH, "AVAXETH"}, {CryptoCurrency::FTMETH, "FTMETH"}, {CryptoCurrency::ONEETH, "ONEETH"},
-		{CryptoCurrency::SOLETH, "SOLETH"}, {CryptoCurrency::ADAETH, "ADAETH"}, {CryptoCurrency::DOTETH, "DOTETH"},
-		{CryptoCurrency::XRPETH, "XRPETH"}, {CryptoCurrency::LTCETH, "LTCETH"}, {CryptoCurrency::BCHETH, "BCHETH"},
-		{CryptoCurrency::XLMETH, "XLMETH"}, {CryptoCurrency::EOSETH, "EOSETH"}, {CryptoCurrency::TRXETH, "TRXETH"},
-		{CryptoCurrency::XTZETH, "XTZETH"}, {CryptoCurrency::ATOMETH, "ATOMETH"}, {CryptoCurrency::NEOETH, "NEOETH"},
-		{CryptoCurrency::VETETH, "VETETH"}, {CryptoCurrency::ICXETH, "ICXETH"}, {CryptoCurrency::ONTETH, "ONTETH"},
-		{CryptoCurrency::ZILETH, "ZILETH"}, {CryptoCurrency::QTUMETH, "QTUMETH"}, {CryptoCurrency::BTGETH, "BTGETH"},
-		{CryptoCurrency::DASHETH, "DASHETH"}, {CryptoCurrency::ZECETH, "ZECETH"}, {CryptoCurrency::XMRETH, "XMRETH"},
-		{CryptoCurrency::DCRETH, "DCRETH"}, {CryptoCurrency::SCETH, "SCETH"}, {CryptoCurrency::WAVESETH, "WAVESETH"},
-		{CryptoCurrency::STRATETH, "STRATETH"}, {CryptoCurrency::ARKETH, "ARKETH"}, {CryptoCurrency::PIVXETH, "PIVXETH"},
-		{CryptoCurrency::GRSETH, "GRSETH"}, {CryptoCurrency::NAVETH, "NAVETH"}, {CryptoCurrency::VTCETH, "VTCETH"},
-		{CryptoCurrency::RVNETH, "RVNETH"}, {CryptoCurrency::MNXETH, "MNXETH"}, {CryptoCurrency::EMC2ETH, "EMC2ETH"},
-		{CryptoCurrency::GNOETH, "GNOETH"}, {CryptoCurrency::REPETH, "REPETH"}, {CryptoCurrency::BATETH, "BATETH"},
-		{CryptoCurrency::ZRXETH, "ZRXETH"}, {CryptoCurrency::KNCETH, "KNCETH"}, {CryptoCurrency::SNTETH, "SNTETH"},
-		{CryptoCurrency::FUNETH, "FUNETH"}, {CryptoCurrency::LINKETH, "LINKETH"}, {CryptoCurrency::MANAETH, "MANAETH"},
-		{CryptoCurrency::LOOMETH, "LOOMETH"}, {CryptoCurrency::CVCETH, "CVCETH"}, {CryptoCurrency::DNTETH, "DNTETH"},
-		{CryptoCurrency::STORJETH, "STORJETH"}, {CryptoCurrency::OMGETH, "OMGETH"}, {CryptoCurrency::TUSDETH, "TUSDETH"},
-		{CryptoCurrency::USDCETH, "USDCETH"}, {CryptoCurrency::USDTETH, "USDTETH"}
-	};
+constexpr const CurrencyInfo& currencyInfo(CryptoCurrency crypto) {
+	return currency_table::crypto[static_cast<size_t>(crypto)];
+}
 
-	auto it = cryptoMap.find(crypto);
-	return it != cryptoMap.end() ? it->second : "unknow";
+constexpr const CurrencyInfo& currencyInfo(const Currencies& currencies) {
+	if (std::holds_alternative<CountriesCurrencies>(currencies)) {
+		return currencyInfo(std::get<CountriesCurrencies>(currencies));
+	}
+	return currencyInfo(std::get<CryptoCurrency>(currencies));
+}
+
+/// Dense number of a currency: ISO currencies take 0-255, cryptocurrencies 256 and up
+constexpr uint16_t currencyId(const Currencies& currencies) {
+	if (std::holds_alternative<CountriesCurrencies>(currencies)) {
+		return static_cast<uint16_t>(std::get<CountriesCurrencies>(currencies));
+	}
+	auto crypto = static_cast<uint16_t>(std::get<CryptoCurrency>(currencies));
+	return currency_table::crypto_base + crypto;
+}
+
+/// Reverse of `currencyInfo(...).code` (case-sensitive)
+constexpr std::optional<Currencies> currencyFromCode(std::string_view code) {
+	using currency_table::CodeEntry;
+	const auto& table  = currency_table::by_code;
+	uint64_t    packed = currency_table::packCode(code);
+	auto        it     = std::ranges::lower_bound(table, packed, {}, &CodeEntry::code);
+	if (packed == 0 || it == table.end() || it->code != packed) return std::nullopt;
+
+	if (it->id < currency_table::crypto_base) return static_cast<CountriesCurrencies>(it->id);
+	return static_cast<CryptoCurrency>(it->id - currency_table::crypto_base);
+}
+
+inline std::string countriesCurrencyToString(CountriesCurrencies currency) {
+	if (static_cast<size_t>(currency) >= currency_table::countries.size()) return "unknow";
+	return std::string(currencyInfo(currency).code);
+}
+
+inline std::string cryptoCurrencyToString(CryptoCurrency crypto) {
+	if (static_cast<size_t>(crypto) >= currency_table::crypto.size()) return "unknow";
+	return std::string(currencyInfo(crypto).code);
 }
 
 inline std::string currencyToString(const Currencies& currencies) {
-	if (std::holds_alternative<ountriesCurrencies>(currencies)) {
-		return countriesCurrencyToString(std::get<ountriesCurrencies>(currencies));
+	if (std::holds_alternative<CountriesCurrencies>(currencies)) {
+		return countriesCurrencyToString(std::get<CountriesCurrencies>(currencies));
 	}
 	else if (std::holds_alternative<CryptoCurrency>(currencies)) {
 		return cryptoCurrencyToString(std::get<CryptoCurrency>(currencies));
 	}
 	return std::string();
-}
\ No newline at end of file
+}
+
+/// Number of minor-unit digits of the currency (ISO 4217 "minor unit" column)
+constexpr uint8_t countriesCurrencyScale(CountriesCurrencies currency) {
+	return currencyInfo(currency).minor_units;
+}
+
+/// Cryptocurrencies are kept with satoshi precision (8 digits)
+constexpr uint8_t cryptoCurrencyScale(CryptoCurrency crypto) {
+	return currencyInfo(crypto).minor_units;
+}
+
+constexpr uint8_t currencyScale(const Currencies& currencies) {
+	return currencyInfo(currencies).minor_units;
+}
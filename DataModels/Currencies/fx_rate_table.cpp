@@ -0,0 +1,149 @@
+#include "fx_rate_table.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "location.hpp"
+
+namespace {
+    constexpr uint8_t max_rate_scale = 18;
+
+    constexpr int64_t pow10(uint8_t exp)
+    {
+        int64_t result = 1;
+        while (exp-- > 0) {
+            result *= 10;
+        }
+        return result;
+    }
+
+    int64_t checkedScale(const int64_t value, const uint8_t exp)
+    {
+        if (exp > max_rate_scale || value > INT64_MAX / pow10(exp)) {
+            throw std::overflow_error(errors::money_overflow);
+        }
+        return value * pow10(exp);
+    }
+}  // namespace
+
+void FxRateTable::setRate(
+    const Currencies& from,
+    const Currencies& to,
+    const Date&       effective,
+    const int64_t     rate,
+    const uint8_t     rate_scale
+)
+{
+    if (rate <= 0 || rate_scale > max_rate_scale) {
+        throw std::invalid_argument(errors::invalid_currency_format);
+    }
+    auto& history = this->rates[pairKey(from, to)];
+    auto  it      = std::lower_bound(
+        history.begin(), history.end(), effective,
+        [](const FxRate& rate, const Date& value) { return rate.effective < value; }
+    );
+    if (it != history.end() && it->effective == effective) {
+        *it = FxRate{effective, rate, rate_scale};
+    } else {
+        history.insert(it, FxRate{effective, rate, rate_scale});
+    }
+}
+
+auto FxRateTable::findRate(const Currencies& from, const Currencies& to, const Date& date) const
+    -> std::optional<FxRate>
+{
+    auto found = this->rates.find(pairKey(from, to));
+    if (found == this->rates.end()) return std::nullopt;
+
+    const auto& history = found->second;
+    auto        it      = std::upper_bound(
+        history.begin(), history.end(), date,
+        [](const Date& value, const FxRate& rate) { return value < rate.effective; }
+    );
+    if (it == history.begin()) return std::nullopt;
+    return *std::prev(it);
+}
+
+auto FxRateTable::convert(
+    const Money&          amount,
+    const Currencies&     to,
+    const Date&           date,
+    const Money::Rounding rounding
+) const -> Money
+{
+    Money::Units units = amount.getUnits();
+    Money::Units result;
+    this->convert(&units, &amount.getCurrency(), &result, 1, to, date, rounding);
+    return Money(result, to);
+}
+
+void FxRateTable::convert(
+    const Money::Units*   units,
+    const Currencies*     currencies,
+    Money::Units*         result,
+    const size_t          count,
+    const Currencies&     reporting,
+    const Date&           date,
+    const Money::Rounding rounding
+) const
+{
+    // a column rarely holds more than a handful of currencies: resolve each one once
+    std::vector<Currencies> distinct;
+    std::vector<UnitRate>   distinct_rates;
+    std::vector<uint16_t>   slots(count);
+    uint8_t                 common_scale = 0;
+    for (size_t i = 0; i < count; i++) {
+        auto it = std::ranges::find(distinct, currencies[i]);
+        if (it == distinct.end()) {
+            distinct_rates.push_back(this->unitRate(currencies[i], reporting, date));
+            common_scale = std::max(common_scale, distinct_rates.back().scale);
+            it           = distinct.insert(distinct.end(), currencies[i]);
+        }
+        slots[i] = static_cast<uint16_t>(it - distinct.begin());
+    }
+
+    std::vector<int64_t> multipliers(distinct_rates.size());
+    for (size_t i = 0; i < distinct_rates.size(); i++) {
+        const UnitRate& rate = distinct_rates[i];
+        multipliers[i] = checkedScale(rate.multiplier, common_scale - rate.scale);
+    }
+
+    std::vector<int64_t> column(count);
+    for (size_t i = 0; i < count; i++) {
+        column[i] = multipliers[slots[i]];
+    }
+    Money::multiplyBatch(units, column.data(), common_scale, result, count, rounding);
+}
+
+auto FxRateTable::size() const -> size_t
+{
+    size_t result = 0;
+    for (const auto& [key, history] : this->rates) {
+        result += history.size();
+    }
+    return result;
+}
+
+auto FxRateTable::pairKey(const Currencies& from, const Currencies& to) -> uint32_t
+{
+    return static_cast<uint32_t>(currencyId(from)) << 16 | currencyId(to);
+}
+
+auto FxRateTable::unitRate(const Currencies& from, const Currencies& to, const Date& date) const
+    -> UnitRate
+{
+    if (from == to) return UnitRate{1, 0};
+
+    auto rate = this->findRate(from, to, date);
+    if (!rate) throw std::out_of_range(errors::fx_rate_missing);
+
+    // fold the difference in minor units into the rate: JPY (0) -> USD (2) is rate * 100
+    uint8_t from_scale = currencyScale(from);
+    uint8_t to_scale   = currencyScale(to);
+    if (to_scale >= from_scale) {
+        return UnitRate{checkedScale(rate->rate, to_scale - from_scale), rate->rate_scale};
+    }
+    uint8_t scale = rate->rate_scale + (from_scale - to_scale);
+    if (scale > max_rate_scale) throw std::overflow_error(errors::money_overflow);
+    return UnitRate{rate->rate, scale};
+}
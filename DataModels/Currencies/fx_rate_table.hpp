@@ -0,0 +1,79 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "BigNum/money.hpp"
+#include "Currencies/currencies.hpp"
+#include "DateTime/date.hpp"
+
+/// Price of one major unit of the source currency in the target currency,
+/// `rate / 10^rate_scale`, valid from `effective` until the next rate of the pair
+struct FxRate {
+    Date    effective;
+    int64_t rate;
+    uint8_t rate_scale;
+};
+
+/**
+ * @class FxRateTable
+ * @brief In-memory history of exchange rates.
+ *
+ * Each currency pair keeps its rates sorted by effective date, so the rate in force on a date
+ * is one binary search. Rates are directional: converting back needs its own entry. Converting
+ * a currency into itself never needs a rate.
+ */
+class FxRateTable {
+public:
+    /// Adds a rate, replacing the one of the pair with the same effective date
+    void setRate(
+        const Currencies& from,
+        const Currencies& to,
+        const Date&       effective,
+        const int64_t     rate,
+        const uint8_t     rate_scale
+    );
+
+    /// Latest rate of the pair with `effective <= date`
+    auto findRate(const Currencies& from, const Currencies& to, const Date& date) const
+        -> std::optional<FxRate>;
+
+    /// Throws std::out_of_range when no rate is in force on `date`
+    auto convert(
+        const Money&          amount,
+        const Currencies&     to,
+        const Date&           date,
+        const Money::Rounding rounding = Money::Rounding::HalfEven
+    ) const -> Money;
+
+    /// Converts the column `units[i]` (minor units of `currencies[i]`) into minor units of
+    /// `reporting` as of `date`. Each distinct currency is looked up once, then the whole
+    /// column goes through `Money::multiplyBatch` with rates brought to one common scale.
+    void convert(
+        const Money::Units*   units,
+        const Currencies*     currencies,
+        Money::Units*         result,
+        const size_t          count,
+        const Currencies&     reporting,
+        const Date&           date,
+        const Money::Rounding rounding = Money::Rounding::HalfEven
+    ) const;
+
+    auto size() const -> size_t;
+
+private:
+    /// Rate of the pair in minor units: to_units = from_units * multiplier / 10^scale
+    struct UnitRate {
+        int64_t multiplier;
+        uint8_t scale;
+    };
+
+    std::unordered_map<uint32_t, std::vector<FxRate>> rates;  // sorted by `effective`
+
+    static auto pairKey(const Currencies& from, const Currencies& to) -> uint32_t;
+    auto        unitRate(const Currencies& from, const Currencies& to, const Date& date) const
+        -> UnitRate;
+};
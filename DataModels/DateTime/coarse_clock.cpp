@@ -0,0 +1,63 @@
+#include "coarse_clock.hpp"
+
+#include <chrono>
+#include <ctime>
+
+#include "date.hpp"
+
+std::atomic<int64_t> CoarseClock::next_refresh_ms{0};
+std::atomic<int32_t> CoarseClock::cached_minutes{CoarseClock::not_ready};
+
+namespace {
+    thread_local int32_t pinned_minutes = INT32_MIN;  // INT32_MIN while no pin is alive
+}  // namespace
+
+CoarseClock::Pin::Pin() : previous(pinned_minutes) { pinned_minutes = nowMinutes(); }
+CoarseClock::Pin::~Pin() { pinned_minutes = this->previous; }
+
+auto CoarseClock::nowMinutes() -> int32_t
+{
+    if (pinned_minutes != INT32_MIN) return pinned_minutes;
+
+    using namespace std::chrono;
+    int64_t now     = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+    int64_t due     = next_refresh_ms.load(std::memory_order_acquire);
+    int32_t minutes = cached_minutes.load(std::memory_order_acquire);
+    if (now < due && minutes != not_ready) return minutes;
+
+    // Only the thread that moves the deadline publishes the new value, the others use their
+    // own reading for this one call instead of waiting.
+    minutes = readLocalMinutes();
+    if (now >= due) {
+        if (next_refresh_ms.compare_exchange_strong(
+                due, now + refresh_interval_ms, std::memory_order_acq_rel
+            )) {
+            cached_minutes.store(minutes, std::memory_order_release);
+        }
+    } else {
+        int32_t expected = not_ready;
+        cached_minutes.compare_exchange_strong(expected, minutes, std::memory_order_acq_rel);
+    }
+    return minutes;
+}
+
+auto CoarseClock::readLocalMinutes() -> int32_t
+{
+    std::time_t t = std::time(nullptr);
+    std::tm     now;
+
+#ifdef _MSC_VER
+    localtime_s(&now, &t);  // Windows
+#else
+    localtime_r(&t, &now);  // POSIX, thread-safe
+#endif
+
+    return Date(
+               static_cast<uint16_t>(now.tm_year + 1900),
+               static_cast<uint8_t>(now.tm_mon + 1),
+               static_cast<uint8_t>(now.tm_mday),
+               static_cast<uint8_t>(now.tm_hour),
+               static_cast<uint8_t>(now.tm_min)
+    )
+        .getMinutes();
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <stdint.h>
+
+#include <atomic>
+
+/**
+ * @class CoarseClock
+ * @brief Process-wide wall clock with minute precision.
+ *
+ * The local time is read from the OS at most once per `refresh_interval_ms`, every other call
+ * returns the cached value. Reading is lock-free and safe from any number of threads. A `Pin`
+ * holds the time of one thread still, so several changes made together get one timestamp.
+ */
+class CoarseClock {
+public:
+    /// Makes `nowMinutes()` of the calling thread return the same minute until it ends
+    class Pin {
+    public:
+        Pin();
+        ~Pin();
+
+        Pin(const Pin&)            = delete;
+        Pin& operator=(const Pin&) = delete;
+
+    private:
+        int32_t previous;
+    };
+
+    static constexpr int64_t refresh_interval_ms = 1000;
+
+    /// Local time in minutes since 1970-01-01 00:00
+    static auto nowMinutes() -> int32_t;
+
+private:
+    static auto readLocalMinutes() -> int32_t;
+
+    static constexpr int32_t    not_ready = INT32_MIN;
+    static std::atomic<int64_t> next_refresh_ms;
+    static std::atomic<int32_t> cached_minutes;
+};
@@ -2,29 +2,79 @@
 
 #include <stdio.h>
 
-#include <ctime>
 #include <stdexcept>
 
+#if SIMD_X86
+#include <immintrin.h>
+#endif
+
+#include "DateTime/coarse_clock.hpp"
 #include "location.hpp"
 #include "stdexcept"
 
-Date::Date()
-{
-    std::time_t t = std::time(nullptr);
-    std::tm     now;
+namespace {
+    constexpr int32_t  minutes_in_day    = 24 * 60;
+    constexpr int64_t  seconds_in_minute = 60;
+    constexpr uint64_t unix_epoch_julian = 2440588;  // Julian day number of 1970-01-01
+
+    static_assert(sizeof(Date) == sizeof(int32_t) && sizeof(TimeDuration) == sizeof(int64_t));
+
+#if SIMD_X86
+    // Both return how many leading pairs they wrote, the caller does the rest one by one
+
+    SIMD_TARGET("avx2")
+    auto subtractAvx2(
+        const Date* end, const Date* start, TimeDuration* result, const size_t count
+    ) -> size_t
+    {
+        const __m256i zero   = _mm256_setzero_si256();
+        const __m256i factor = _mm256_set1_epi64x(seconds_in_minute);
+        size_t        i      = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256i diff = _mm256_sub_epi32(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(end + i)),
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start + i))
+            );
+            diff         = _mm256_max_epi32(diff, zero);
+            __m256i low  = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(diff));
+            __m256i high = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(diff, 1));
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(result + i), _mm256_mul_epi32(low, factor)
+            );
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(result + i + 4), _mm256_mul_epi32(high, factor)
+            );
+        }
+        return i;
+    }
 
-#ifdef _MSC_VER
-    localtime_s(&now, &t);  // Windows
-#else
-    now = *std::localtime(&t);  // Non-Windows
+    SIMD_TARGET("sse4.1")
+    auto subtractSse41(
+        const Date* end, const Date* start, TimeDuration* result, const size_t count
+    ) -> size_t
+    {
+        const __m128i zero   = _mm_setzero_si128();
+        const __m128i factor = _mm_set1_epi64x(seconds_in_minute);
+        size_t        i      = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i diff = _mm_sub_epi32(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(end + i)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(start + i))
+            );
+            diff         = _mm_max_epi32(diff, zero);
+            __m128i low  = _mm_cvtepi32_epi64(diff);
+            __m128i high = _mm_cvtepi32_epi64(_mm_srli_si128(diff, 8));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(result + i), _mm_mul_epi32(low, factor));
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(result + i + 2), _mm_mul_epi32(high, factor)
+            );
+        }
+        return i;
+    }
 #endif
+}  // namespace
 
-    this->d_year  = now.tm_year + 1900;
-    this->d_month = now.tm_mon;
-    this->d_day   = now.tm_mday;
-    this->d_hour  = now.tm_hour;
-    this->d_min   = now.tm_min;
-}
+Date::Date() : d_minutes(CoarseClock::nowMinutes()) {}
 
 Date::Date(
     const uint16_t year,
@@ -38,139 +88,153 @@ Date::Date(
 
     if (month < 1 || month > 12) throw std::invalid_argument(errors::month_incorrect);
 
-    if (month == 2) {         // February
-        if (year % 4 == 0) {  // Intercalary year
-            if (day > 29) throw std::invalid_argument(errors::day_incorrect);
-        } else {
-            if (day > 28) throw std::invalid_argument(errors::day_incorrect);
-        }
+    if (month == 2) {  // February
+        bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+        if (day < 1 || day > (leap ? 29 : 28)) throw std::invalid_argument(errors::day_incorrect);
     } else {
-        if (day > numberDaysInMonth(month)) throw std::invalid_argument(errors::day_incorrect);
+        if (day < 1 || day > numberDaysInMonth(month)) {
+            throw std::invalid_argument(errors::day_incorrect);
+        }
     }
 
     if (hour > 23) throw std::invalid_argument(errors::hour_incorrect);
 
     if (min > 59) throw std::invalid_argument(errors::min_incorrect);
 
-    this->d_year  = year;
-    this->d_month = month;
-    this->d_day   = day;
-    this->d_hour  = hour;
-    this->d_min   = min;
+    this->d_minutes = daysFromCivil(year, month, day) * minutes_in_day + hour * 60 + min;
 }
 
-Date::Date(const Date& ex)
-    : d_year(ex.d_year), d_month(ex.d_month), d_day(ex.d_day), d_hour(ex.d_hour), d_min(ex.d_min)
+auto Date::fromMinutes(const int32_t minutes) -> Date
 {
+    Date date(1970, 1, 1);
+    date.d_minutes = minutes;
+    return date;
 }
 
 TimeDuration Date::operator-(const Date& other) const
 {
     if (*this < other) throw std::runtime_error(errors::negative_date_range);
-    int min, hour, day, month, year;
-    min = hour = day = month = year = 0;
-
-    min += this->d_min - other.d_min;
-    if (min < 0) {
-        min += 60;
-        hour -= 1;
-    }
 
-    hour += this->d_hour - other.d_hour;
-    if (hour < 0) {
-        hour += 24;
-        day -= 1;
-    }
-
-    day += this->julian_day() - other.julian_day();
-    return TimeDuration(0, day, hour, min, 0);
-}
-
-Date& Date::operator=(const Date& other)
-{
-    if (this == &other) return *this;
-
-    this->d_year  = other.d_year;
-    this->d_month = other.d_month;
-    this->d_day   = other.d_day;
-    this->d_hour  = other.d_hour;
-    this->d_min   = other.d_min;
-    return *this;
-}
-
-bool Date::operator<(const Date& other) const
-{
-    if (this->d_year != other.d_year) return this->d_year < other.d_year;
-    if (this->d_month != other.d_month) return this->d_month < other.d_month;
-    if (this->d_day != other.d_day) return this->d_day < other.d_day;
-    if (this->d_hour != other.d_hour) return this->d_hour < other.d_hour;
-    return this->d_min < other.d_min;
+    return TimeDuration::fromSeconds(
+        (int64_t{this->d_minutes} - other.d_minutes) * seconds_in_minute
+    );
 }
 
-bool Date::operator!=(const Date& other) const
+void Date::subtract(const Date* end, const Date* start, TimeDuration* result, const size_t count)
 {
-    if (this->d_year != other.d_year) return true;
-    if (this->d_month != other.d_month) return true;
-    if (this->d_day != other.d_day) return true;
-    if (this->d_hour != other.d_hour) return true;
-    if (this->d_min != other.d_min) return true;
-    return false;
+    subtract(end, start, result, count, simd::supported());
 }
 
-bool Date::operator==(const Date& other) const
+void Date::subtract(
+    const Date*                        end,
+    const Date*                        start,
+    TimeDuration*                      result,
+    const size_t                       count,
+    [[maybe_unused]] const simd::Level level
+)
 {
-    if (this->d_year != other.d_year) return false;
-    if (this->d_month != other.d_month) return false;
-    if (this->d_day != other.d_day) return false;
-    if (this->d_hour != other.d_hour) return false;
-    if (this->d_min != other.d_min) return false;
-    return true;
+    size_t i = 0;
+#if SIMD_X86
+    if (level >= simd::Level::AVX2) {
+        i = subtractAvx2(end, start, result, count);
+    } else if (level >= simd::Level::SSE41) {
+        i = subtractSse41(end, start, result, count);
+    }
+#endif
+    for (; i < count; ++i) {
+        result[i] = TimeDuration::fromSeconds(
+            (int64_t{end[i].d_minutes} - start[i].d_minutes) * seconds_in_minute
+        );
+    }
 }
 
 auto Date::julian_day() const -> uint64_t
 {
-    int y = d_year, m = d_month, d = d_day;
-    if (m <= 2) {
-        y--;
-        m += 12;
-    }  // Jan/Feb as 13/14 of prev year
-    int a = y / 100;
-    int b = 2 - a + a / 4;
-    return int(365.25 * (y + 4716)) + int(30.6001 * (m + 1)) + d + b - 1524;
+    int32_t days = this->d_minutes / minutes_in_day;
+    if (this->d_minutes % minutes_in_day < 0) days--;
+    return unix_epoch_julian + days;
 }
 
 const std::string Date::getDateStr() const
 {
-    char min[2];
-    if (this->d_min <= 9) {
-        min[0] = '0';
-        min[1] = this->d_min + '0';
-    } else {
-        min[0] = '0' + (this->d_min / 10);
-        min[1] = '0' + (this->d_min % 10);
-    }
+    Civil   date = this->civil();
+    uint8_t min  = this->getMin();
+
+    char    min_str[2];
+    min_str[0] = static_cast<char>('0' + min / 10);
+    min_str[1] = static_cast<char>('0' + min % 10);
 
     return std::string(
-        std::to_string(this->d_day) + ' ' + this->monthToStr() + ' ' +
-        std::to_string(this->d_year) + ' ' + std::to_string(this->d_hour) + ':' + min[0] + min[1]
+        std::to_string(date.day) + ' ' + this->monthToStr(date.month) + ' ' +
+        std::to_string(date.year) + ' ' + std::to_string(this->getHour()) + ':' + min_str[0] +
+        min_str[1]
     );
 }
 
-uint16_t          Date::getYear() const { return this->d_year; }
-uint8_t           Date::getMonth() const { return this->d_month; }
-uint8_t           Date::getDay() const { return this->d_day; }
-uint8_t           Date::getHour() const { return this->d_hour; }
-uint8_t           Date::getMin() const { return this->d_min; }
+uint16_t Date::getYear() const { return this->civil().year; }
+uint8_t  Date::getMonth() const { return this->civil().month; }
+uint8_t  Date::getDay() const { return this->civil().day; }
+uint8_t  Date::getHour() const
+{
+    int32_t in_day = this->d_minutes % minutes_in_day;
+    if (in_day < 0) in_day += minutes_in_day;
+    return static_cast<uint8_t>(in_day / 60);
+}
+uint8_t Date::getMin() const
+{
+    int32_t min = this->d_minutes % 60;
+    return static_cast<uint8_t>(min < 0 ? min + 60 : min);
+}
 
 const std::string Date::toJsonFormat() const
 {
-    char buffer[20];
+    Civil date = this->civil();
+    char  buffer[20];
     snprintf(
-        buffer, sizeof(buffer), "%04d-%02d-%02dT%02d:%02d:00", d_year, d_month, d_day, d_hour, d_min
+        buffer,
+        sizeof(buffer),
+        "%04d-%02d-%02dT%02d:%02d:00",
+        date.year,
+        date.month,
+        date.day,
+        this->getHour(),
+        this->getMin()
     );
     return buffer;
 }
 
+// Howard Hinnant's days_from_civil / civil_from_days (proleptic Gregorian calendar)
+int32_t Date::daysFromCivil(int32_t year, uint32_t month, uint32_t day)
+{
+    year -= month <= 2;
+    const int32_t  era = (year >= 0 ? year : year - 399) / 400;
+    const uint32_t yoe = static_cast<uint32_t>(year - era * 400);
+    const uint32_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + static_cast<int32_t>(doe) - 719468;
+}
+
+Date::Civil Date::civilFromDays(int32_t days)
+{
+    days += 719468;
+    const int32_t  era   = (days >= 0 ? days : days - 146096) / 146097;
+    const uint32_t doe   = static_cast<uint32_t>(days - era * 146097);
+    const uint32_t yoe   = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const uint32_t doy   = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const uint32_t mp    = (5 * doy + 2) / 153;
+    const uint32_t day   = doy - (153 * mp + 2) / 5 + 1;
+    const uint32_t month = mp < 10 ? mp + 3 : mp - 9;
+    const int32_t  year  = static_cast<int32_t>(yoe) + era * 400 + (month <= 2);
+    return {static_cast<uint16_t>(year), static_cast<uint8_t>(month), static_cast<uint8_t>(day)};
+}
+
+Date::Civil Date::civil() const
+{
+    int32_t days = this->d_minutes / minutes_in_day;
+    if (this->d_minutes % minutes_in_day < 0) days--;
+    return civilFromDays(days);
+}
+
 uint8_t Date::numberDaysInMonth(const uint8_t month) const
 {
     switch (month) {
@@ -194,9 +258,9 @@ uint8_t Date::numberDaysInMonth(const uint8_t month) const
     }
 }
 
-const std::string Date::monthToStr() const
+const std::string Date::monthToStr(const uint8_t month) const
 {
-    switch (this->d_month) {
+    switch (month) {
         case 1:
             return month_str::january;
             break;
@@ -237,4 +301,4 @@ const std::string Date::monthToStr() const
             return "NULL";
             break;
     }
-}
\ No newline at end of file
+}
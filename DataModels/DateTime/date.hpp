@@ -1,7 +1,21 @@
 #pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
 #include <string>
 
+#include "Simd/simd.hpp"
 #include "time_duration.hpp"
+
+/**
+ * @struct Date
+ * @brief Calendar date with minute precision packed into one integer.
+ *
+ * The value is the number of minutes since 1970-01-01 00:00 (local time), so comparing and
+ * hashing dates is a single integer operation. Calendar fields are derived on request.
+ * The default constructor takes the current time from `CoarseClock`.
+ */
 struct Date {
     Date();
     Date(
@@ -11,13 +25,30 @@ struct Date {
         const uint8_t  hour = 0,
         const uint8_t  min  = 0
     );
-    Date(const Date& ex);
+    Date(const Date& ex)                  = default;
+
+    static auto  fromMinutes(const int32_t minutes) -> Date;
+
+    /// Writes `end[i] - start[i]` into `result[i]` for the whole batch, with SSE4.1/AVX2 when
+    /// the CPU running the process has them. Unlike `operator-`, a negative range gives a zero
+    /// duration.
+    static void  subtract(
+        const Date* end, const Date* start, TimeDuration* result, const size_t count
+    );
+    /// Same with the paths of `level`, which the CPU must support
+    static void  subtract(
+        const Date*       end,
+        const Date*       start,
+        TimeDuration*     result,
+        const size_t      count,
+        const simd::Level level
+    );
 
     TimeDuration operator-(const Date& other) const;
-    Date&        operator=(const Date& other);
-    bool         operator<(const Date& other) const;
-    bool         operator!=(const Date& other) const;
-    bool         operator==(const Date& other) const;
+    Date&        operator=(const Date& other) = default;
+    bool         operator<(const Date& other) const { return d_minutes < other.d_minutes; }
+    bool         operator!=(const Date& other) const { return d_minutes != other.d_minutes; }
+    bool         operator==(const Date& other) const { return d_minutes == other.d_minutes; }
 
 public:
     auto julian_day() const -> uint64_t;
@@ -27,18 +58,33 @@ public:
     auto getDay() const -> uint8_t;
     auto getHour() const -> uint8_t;
     auto getMin() const -> uint8_t;
+    auto getMinutes() const -> int32_t { return d_minutes; }
 
 public:
     const std::string toJsonFormat() const;
 
 private:
+    struct Civil {
+        uint16_t year;
+        uint8_t  month;
+        uint8_t  day;
+    };
+    static int32_t    daysFromCivil(int32_t year, uint32_t month, uint32_t day);
+    static Civil      civilFromDays(int32_t days);
+
+    Civil             civil() const;
     uint8_t           numberDaysInMonth(const uint8_t month) const;
-    const std::string monthToStr() const;
+    const std::string monthToStr(const uint8_t month) const;
 
-    uint16_t          d_year;
-    uint8_t           d_month;
-    uint8_t           d_day;
+    int32_t           d_minutes = 0;
+};
 
-    uint8_t           d_hour;
-    uint8_t           d_min;
-};
\ No newline at end of file
+namespace std {
+    template <>
+    struct hash<Date> {
+        std::size_t operator()(const Date& date) const noexcept
+        {
+            return std::hash<int32_t>{}(date.getMinutes());
+        }
+    };
+}  // namespace std
@@ -1,53 +1,100 @@
 #pragma once
+#include <stddef.h>
 #include <stdint.h>
 
 #include <string>
 
+/**
+ * @class TimeDuration
+ * @brief Non-negative span of time with second precision stored as one integer.
+ *
+ * Weeks, days, hours, minutes and seconds are derived on request, so copying, comparing and
+ * adding durations are single integer operations. Text is produced only when asked for, either
+ * into a caller buffer (`format`) or as a new string (`getDurationStr`).
+ */
 class TimeDuration {
 public:
-    TimeDuration() = default;
-    TimeDuration(
+    /// Units written by `format`, combined as a bit mask
+    enum Unit : uint8_t {
+        Week     = 1 << 0,
+        Day      = 1 << 1,
+        Hour     = 1 << 2,
+        Min      = 1 << 3,
+        Sec      = 1 << 4,
+        AllUnits = Week | Day | Hour | Min | Sec
+    };
+
+    static constexpr size_t max_chars = 64;  ///< Enough for every unit of any duration
+
+    constexpr TimeDuration() = default;
+    /// Overflowing fields are carried into the larger units
+    constexpr TimeDuration(
         const uint16_t week,
         const uint16_t day,
         const uint8_t  hour,
         const uint8_t  min,
         const uint8_t  sec
-    );
-    TimeDuration(const TimeDuration& other);
+    )
+        : seconds(
+              ((int64_t{week} * 7 + day) * 24 + hour) * 3600 + int64_t{min} * 60 + sec
+          )
+    {
+    }
+    constexpr TimeDuration(const TimeDuration& other) = default;
+
+    /// Negative values are clamped to zero
+    static constexpr auto fromSeconds(const int64_t seconds) -> TimeDuration
+    {
+        TimeDuration duration;
+        duration.seconds = seconds < 0 ? 0 : seconds;
+        return duration;
+    }
 
-    bool          operator!=(const TimeDuration& other) const;
-    bool          operator<=(const TimeDuration& other) const;
-    bool          operator==(const TimeDuration& other) const;
-    TimeDuration& operator+=(const TimeDuration& other);
-    TimeDuration& operator-=(const TimeDuration& other);
+    constexpr TimeDuration& operator=(const TimeDuration& other) = default;
+    constexpr bool operator!=(const TimeDuration& other) const { return seconds != other.seconds; }
+    constexpr bool operator<(const TimeDuration& other) const { return seconds < other.seconds; }
+    constexpr bool operator<=(const TimeDuration& other) const { return seconds <= other.seconds; }
+    constexpr bool operator==(const TimeDuration& other) const { return seconds == other.seconds; }
 
-    uint16_t      getWeek() const;
-    uint8_t       getDay() const;
-    uint8_t       getHour() const;
-    uint8_t       getMin() const;
-    uint8_t       getSec() const;
+    constexpr TimeDuration& operator+=(const TimeDuration& other)
+    {
+        this->seconds += other.seconds;
+        return *this;
+    }
+    /// Stops at zero instead of going negative
+    constexpr TimeDuration& operator-=(const TimeDuration& other)
+    {
+        this->seconds = this->seconds > other.seconds ? this->seconds - other.seconds : 0;
+        return *this;
+    }
 
-    void          showWeek(const bool week_on);
-    void          showDay(const bool day_on);
-    void          showHour(const bool hour_on);
-    void          showMin(const bool min_on);
-    void          showSec(const bool sec_on);
+    /// @name Getters
+    /// @{
+    constexpr auto getSeconds() const -> int64_t { return this->seconds; }
+    constexpr auto getWeek() const -> uint16_t
+    {
+        return static_cast<uint16_t>(this->seconds / (7 * 24 * 3600));
+    }
+    constexpr auto getDay() const -> uint8_t
+    {
+        return static_cast<uint8_t>(this->seconds / (24 * 3600) % 7);
+    }
+    constexpr auto getHour() const -> uint8_t
+    {
+        return static_cast<uint8_t>(this->seconds / 3600 % 24);
+    }
+    constexpr auto getMin() const -> uint8_t
+    {
+        return static_cast<uint8_t>(this->seconds / 60 % 60);
+    }
+    constexpr auto getSec() const -> uint8_t { return static_cast<uint8_t>(this->seconds % 60); }
+    /// @}
 
-    auto          getDurationStr() -> const std::string&;
+    /// Writes e.g. "1 wk, 5 d, 11 hr, 0 min, 0 sec" into [first, last) without a terminator.
+    /// Returns the end of the written text, or nullptr when the buffer is too small.
+    auto format(char* first, char* last, const uint8_t units = AllUnits) const -> char*;
+    auto getDurationStr(const uint8_t units = AllUnits) const -> std::string;
 
 private:
-    bool        week_on = true;
-    bool        day_on  = true;
-    bool        hour_on = true;
-    bool        min_on  = true;
-    bool        sec_on  = true;
-
-    uint16_t    week = 0;
-    uint8_t     day  = 0;
-    uint8_t     hour = 0;
-    uint8_t     min  = 0;
-    uint8_t     sec  = 0;
-
-    std::string duration_str;
-    void        makeDurationStr();
-};
\ No newline at end of file
+    int64_t seconds = 0;
+};
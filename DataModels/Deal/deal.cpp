@@ -1,8 +1,9 @@
 #include "deal.hpp"
 
+#include <algorithm>
 #include <utility>
 
-#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_journal.hpp"
 
 Deal::Deal(const BigUint& id) : id(id) {}
 
@@ -17,8 +18,8 @@ Deal::Deal(
     const Status&                     status,
     const OptionalStr&                other_status,
     const Priority&                   deal_priority,
-    const DatePtr&                    drawing_date,
-    const DatePtr&                    date_approval,
+    const OptionalDate&               drawing_date,
+    const OptionalDate&               date_approval,
     const Date&                       creation_date,
     const WeakPersonPtr&              owner,
     const WeakInternalEmployee&       manager,
@@ -39,14 +40,14 @@ Deal::Deal(
     , total_amount(total_amount)
     , paid_amount(paid_amount)
     , status(status)
-    , other_status(other_status)
+    , other_status(InternedStr::fromOptional(other_status))
     , deal_priority(deal_priority)
     , drawing_date(drawing_date)
     , date_approval(date_approval)
     , creation_date(creation_date)
     , owner(owner)
     , manager(manager)
-    , tags(std::move(tags))
+    , tags(InternedStr::fromList(tags))
     , buyers(std::move(buyers))
     , payment_transactions(std::move(payment_transactions))
     , assigned_employees(std::move(assigned_employees))
@@ -62,7 +63,7 @@ auto Deal::getContractNumber() const -> const std::string& { return contract_num
 auto Deal::getTitle() const -> const std::string& { return title; }
 auto Deal::getDescription() const -> const OptionalStr& { return description; }
 auto Deal::getSource() const -> const OptionalStr& { return source; }
-auto Deal::getTags() const -> const std::vector<std::string>& { return tags; }
+auto Deal::getTags() const -> const std::vector<InternedStr>& { return tags; }
 auto Deal::getBuyers() const -> const std::vector<WeakBuyerShare>& { return buyers; }
 auto Deal::getTotalAmount() const -> const Money& { return total_amount; }
 auto Deal::getPaidAmount() const -> const Money& { return paid_amount; }
@@ -71,10 +72,10 @@ auto Deal::getPaymentTransactions() const -> const std::vector<PaymentPtr>&
     return payment_transactions;
 }
 auto Deal::getStatus() const -> const Status& { return status; }
-auto Deal::getOtherStatus() const -> const OptionalStr& { return other_status; }
+auto Deal::getOtherStatus() const -> const OptionalInterned& { return this->other_status; }
 auto Deal::getDealPriority() const -> const Priority& { return deal_priority; }
-auto Deal::getDrawingDate() const -> const DatePtr& { return drawing_date; }
-auto Deal::getDateApproval() const -> const DatePtr& { return date_approval; }
+auto Deal::getDrawingDate() const -> const OptionalDate& { return drawing_date; }
+auto Deal::getDateApproval() const -> const OptionalDate& { return date_approval; }
 auto Deal::getCreationDate() const -> const Date& { return creation_date; }
 auto Deal::getAssignedEmployees() const -> const std::vector<WeakInternalEmployee>&
 {
@@ -86,20 +87,56 @@ auto Deal::getTasks() const -> const std::vector<TaskPtr>& { return tasks; }
 auto Deal::getOwner() const -> const WeakPersonPtr& { return owner; }
 auto Deal::getManager() const -> const WeakInternalEmployee& { return this->manager; }
 auto Deal::getOfferings() const -> const std::vector<OfferDealPtr>& { return offerings; }
-auto Deal::getChangeLogs() const -> const std::vector<ChangeLogPtr>& { return change_logs; }
+auto Deal::getChangeLogs() const -> ChangeLogView
+{
+    return ChangeLogView(this->change_logs);
+}
+auto Deal::getStateAt(const Date& date) const -> EntityState
+{
+    return ChangeJournal::getInstance().getStateAt(this->change_logs, date);
+}
+
+auto Deal::getInitialState() const -> InitialState
+{
+    using Type = ChangeLog::FieldType;
+
+    InitialState state(this->creation_date);
+    state.set(
+        DealFields::ContractNumber, Type::String, ChangeValue::fromText(this->contract_number)
+    );
+    state.set(DealFields::Title, Type::String, ChangeValue::fromText(this->title));
+    state.set(DealFields::Description, Type::String, OPTIONAL_STR_TO_VALUE(this->description));
+    state.set(DealFields::Source, Type::String, OPTIONAL_STR_TO_VALUE(this->source));
+    state.set(DealFields::TotalAmount, Type::Money, std::make_shared<Money>(this->total_amount));
+    state.set(DealFields::PaidAmount, Type::Money, std::make_shared<Money>(this->paid_amount));
+    if (this->other_status) {
+        state.set(DealFields::Status, Type::String, ChangeValue::fromText(*this->other_status));
+    } else {
+        state.set(DealFields::Status, Type::DealStatus, this->status);
+    }
+    state.set(DealFields::DealPriority, Type::Priority, this->deal_priority);
+    state.set(DealFields::DrawingDate, Type::Date, this->drawing_date);
+    state.set(DealFields::DateApproval, Type::Date, this->date_approval);
+    state.set(DealFields::CreationDate, Type::Date, this->creation_date);
+    state.set(DealFields::Owner, Type::WeakPerson, WEAK_PTR_TO_OPTIONAL(this->owner));
+    state.set(
+        DealFields::DealManager, Type::WeakInternalEmployee, WEAK_PTR_TO_OPTIONAL(this->manager)
+    );
+    return state;
+}
 
 bool Deal::changeContractNumber(const std::string& number, const InternalEmployeePtr& changer)
 {
     if (this->contract_number != number) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->contract_number)),
-            std::make_optional(std::make_shared<std::string>(number)),
+            ChangeValue::fromText(this->contract_number),
+            ChangeValue::fromText(number),
             DealFields::ContractNumber,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->contract_number = number;
         return true;
     }
@@ -109,15 +146,15 @@ bool Deal::changeContractNumber(const std::string& number, const InternalEmploye
 bool Deal::changeTitle(const std::string& title, const InternalEmployeePtr& changer)
 {
     if (this->title != title) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->title)),
-            std::make_optional(std::make_shared<std::string>(title)),
+            ChangeValue::fromText(this->title),
+            ChangeValue::fromText(title),
             DealFields::Title,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->title = title;
         return true;
     }
@@ -127,7 +164,7 @@ bool Deal::changeTitle(const std::string& title, const InternalEmployeePtr& chan
 bool Deal::changeDescription(const OptionalStr& description, const InternalEmployeePtr& changer)
 {
     if (this->description != description) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->description),
             OPTIONAL_STR_TO_VALUE(description),
@@ -135,7 +172,7 @@ bool Deal::changeDescription(const OptionalStr& description, const InternalEmplo
             this->description ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             description ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->description = description;
         return true;
     }
@@ -145,7 +182,7 @@ bool Deal::changeDescription(const OptionalStr& description, const InternalEmplo
 bool Deal::changeSource(const OptionalStr& source, const InternalEmployeePtr& changer)
 {
     if (this->source != source) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->source),
             OPTIONAL_STR_TO_VALUE(source),
@@ -153,7 +190,7 @@ bool Deal::changeSource(const OptionalStr& source, const InternalEmployeePtr& ch
             this->source ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             source ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->source = source;
         return true;
     }
@@ -163,7 +200,7 @@ bool Deal::changeSource(const OptionalStr& source, const InternalEmployeePtr& ch
 bool Deal::changeTotalAmount(const Money& amount, const InternalEmployeePtr& changer)
 {
     if (this->total_amount != amount) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<Money>(this->total_amount)),
             std::make_optional(std::make_shared<Money>(amount)),
@@ -171,7 +208,7 @@ bool Deal::changeTotalAmount(const Money& amount, const InternalEmployeePtr& cha
             ChangeLog::FieldType::Money,
             ChangeLog::FieldType::Money,
             ChangeLog::Action::Change
-        ));
+        );
         this->total_amount = amount;
         return true;
     }
@@ -181,7 +218,7 @@ bool Deal::changeTotalAmount(const Money& amount, const InternalEmployeePtr& cha
 bool Deal::changePaidAmount(const Money& amount, const InternalEmployeePtr& changer)
 {
     if (this->paid_amount != amount) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<Money>(this->paid_amount)),
             std::make_optional(std::make_shared<Money>(amount)),
@@ -189,7 +226,7 @@ bool Deal::changePaidAmount(const Money& amount, const InternalEmployeePtr& chan
             ChangeLog::FieldType::Money,
             ChangeLog::FieldType::Money,
             ChangeLog::Action::Change
-        ));
+        );
         this->paid_amount = amount;
         return true;
     }
@@ -199,11 +236,9 @@ bool Deal::changePaidAmount(const Money& amount, const InternalEmployeePtr& chan
 bool Deal::changeStatus(const Status status, const InternalEmployeePtr& changer)
 {
     if (this->status != status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_status ? std::make_optional<ChangeLog::ValueVariant>(
-                                     std::make_shared<std::string>(this->other_status.value())
-                                 )
+            this->other_status ? ChangeValue::fromText(this->other_status.value())
                                : std::make_optional<ChangeLog::ValueVariant>(this->status),
             std::make_optional<ChangeLog::ValueVariant>(status),
             DealFields::Status,
@@ -211,7 +246,7 @@ bool Deal::changeStatus(const Status status, const InternalEmployeePtr& changer)
                                : ChangeLog::FieldType::DealStatus,
             ChangeLog::FieldType::DealStatus,
             ChangeLog::Action::Change
-        ));
+        );
         this->other_status = std::nullopt;
         this->status       = status;
         return true;
@@ -222,24 +257,20 @@ bool Deal::changeStatus(const Status status, const InternalEmployeePtr& changer)
 bool Deal::changeOtherStatus(const OptionalStr& status, const InternalEmployeePtr& changer)
 {
     if (this->other_status != status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_status ? std::make_optional<ChangeLog::ValueVariant>(
-                                     std::make_shared<std::string>(this->other_status.value())
-                                 )
+            this->other_status ? ChangeValue::fromText(this->other_status.value())
                                : std::make_optional<ChangeLog::ValueVariant>(this->status),
-            status ? std::make_optional<ChangeLog::ValueVariant>(
-                         std::make_shared<std::string>(status.value())
-                     )
+            status ? ChangeValue::fromText(status.value())
                    : std::nullopt,
             DealFields::Status,
             this->other_status ? ChangeLog::FieldType::String
                                : ChangeLog::FieldType::DealStatus,
             status ? ChangeLog::FieldType::String : ChangeLog::FieldType::DealStatus,
             ChangeLog::Action::Change
-        ));
+        );
         this->status       = Status::Other;
-        this->other_status = status;
+        this->other_status = InternedStr::fromOptional(status);
         return true;
     }
     return false;
@@ -248,7 +279,7 @@ bool Deal::changeOtherStatus(const OptionalStr& status, const InternalEmployeePt
 bool Deal::changeDealPriority(const Priority priority, const InternalEmployeePtr& changer)
 {
     if (this->deal_priority != priority) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->deal_priority),
             std::make_optional(priority),
@@ -256,55 +287,43 @@ bool Deal::changeDealPriority(const Priority priority, const InternalEmployeePtr
             ChangeLog::FieldType::Priority,
             ChangeLog::FieldType::Priority,
             ChangeLog::Action::Change
-        ));
+        );
         this->deal_priority = priority;
         return true;
     }
     return false;
 }
 
-bool Deal::setDrawingDate(const DatePtr& date, const InternalEmployeePtr& changer)
+bool Deal::setDrawingDate(const OptionalDate& date, const InternalEmployeePtr& changer)
 {
-    if (this->drawing_date == nullptr || date == nullptr) {
-        if (this->drawing_date == date) {
-            return false;
-        }
-    } else if (*this->drawing_date == *date) {
-        return false;
-    }
+    if (this->drawing_date == date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->drawing_date),
-        PTR_TO_OPTIONAL(date),
+        OPTIONAL_TO_VALUE(this->drawing_date),
+        OPTIONAL_TO_VALUE(date),
         DealFields::DrawingDate,
         this->drawing_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->drawing_date = date;
     return true;
 }
 
-bool Deal::setDateApproval(const DatePtr& date, const InternalEmployeePtr& changer)
+bool Deal::setDateApproval(const OptionalDate& date, const InternalEmployeePtr& changer)
 {
-    if (this->date_approval == nullptr || date == nullptr) {
-        if (this->date_approval == date) {
-            return false;
-        }
-    } else if (*this->date_approval == *date) {
-        return false;
-    }
+    if (this->date_approval == date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->date_approval),
-        PTR_TO_OPTIONAL(date),
+        OPTIONAL_TO_VALUE(this->date_approval),
+        OPTIONAL_TO_VALUE(date),
         DealFields::DateApproval,
         this->date_approval ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->date_approval = date;
     return true;
 }
@@ -312,15 +331,15 @@ bool Deal::setDateApproval(const DatePtr& date, const InternalEmployeePtr& chang
 bool Deal::setCreationDate(const Date& date, const InternalEmployeePtr& changer)
 {
     if (this->creation_date != date) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_shared<Date>(this->creation_date),
-            std::make_shared<Date>(date),
+            this->creation_date,
+            date,
             DealFields::CreationDate,
             ChangeLog::FieldType::Date,
             ChangeLog::FieldType::Date,
             ChangeLog::Action::Change
-        ));
+        );
         this->creation_date = date;
         return true;
     }
@@ -330,7 +349,7 @@ bool Deal::setCreationDate(const Date& date, const InternalEmployeePtr& changer)
 bool Deal::setOwner(const WeakPersonPtr& owner, const InternalEmployeePtr& changer)
 {
     if (this->owner.owner_before(owner) || owner.owner_before(this->owner)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->owner),
             WEAK_PTR_TO_OPTIONAL(owner),
@@ -338,7 +357,7 @@ bool Deal::setOwner(const WeakPersonPtr& owner, const InternalEmployeePtr& chang
             !this->owner.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             !owner.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->owner = owner;
         return true;
     }
@@ -348,7 +367,7 @@ bool Deal::setOwner(const WeakPersonPtr& owner, const InternalEmployeePtr& chang
 bool Deal::setManager(const WeakInternalEmployee& manager, const InternalEmployeePtr& changer)
 {
     if (this->manager.owner_before(manager) || manager.owner_before(this->manager)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->manager),
             WEAK_PTR_TO_OPTIONAL(manager),
@@ -358,7 +377,7 @@ bool Deal::setManager(const WeakInternalEmployee& manager, const InternalEmploye
             !manager.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->manager = manager;
         return true;
     }
@@ -368,16 +387,16 @@ bool Deal::setManager(const WeakInternalEmployee& manager, const InternalEmploye
 bool Deal::addTag(const std::string& tag, const InternalEmployeePtr& changer)
 {
     if (std::find(this->tags.begin(), this->tags.end(), tag) == this->tags.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional(std::make_shared<std::string>(tag)),
+            ChangeValue::fromText(tag),
             DealFields::Tags,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add
-        ));
-        this->tags.push_back(tag);
+        );
+        this->tags.emplace_back(tag);
         return true;
     }
     return false;
@@ -386,15 +405,15 @@ bool Deal::addTag(const std::string& tag, const InternalEmployeePtr& changer)
 bool Deal::delTag(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->tags.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->tags[id])),
+            ChangeValue::fromText(this->tags[id]),
             std::nullopt,
             DealFields::Tags,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->tags.erase(this->tags.begin() + id);
         return true;
     }
@@ -412,7 +431,7 @@ bool Deal::addBuyer(
                 return !(buyer.owner_before(person.first) || person.first.owner_before(buyer));
             }
         ) == this->buyers.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(std::make_shared<WeakBuyerShare>(buyer, money)),
@@ -420,7 +439,7 @@ bool Deal::addBuyer(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::PersonMoneyPair,
             ChangeLog::Action::Add
-        ));
+        );
         this->buyers.push_back(std::make_pair(buyer, money));
         return true;
     }
@@ -430,7 +449,7 @@ bool Deal::addBuyer(
 bool Deal::delBuyer(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->buyers.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<WeakBuyerShare>(this->buyers[id])),
             std::nullopt,
@@ -438,7 +457,7 @@ bool Deal::delBuyer(const size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::PersonMoneyPair,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->buyers.erase(this->buyers.begin() + id);
         return true;
     }
@@ -449,7 +468,7 @@ bool Deal::updateBuyerMoney(size_t id, const Money& newMoney, const InternalEmpl
 {
     if (this->buyers.size() > id) {
         if (this->buyers[id].second != newMoney) {
-            this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+            this->change_logs.append(
                 changer,
                 std::make_optional(std::make_shared<WeakBuyerShare>(this->buyers[id])),
                 std::make_optional(std::make_shared<WeakBuyerShare>(
@@ -459,7 +478,7 @@ bool Deal::updateBuyerMoney(size_t id, const Money& newMoney, const InternalEmpl
                 ChangeLog::FieldType::PersonMoneyPair,
                 ChangeLog::FieldType::PersonMoneyPair,
                 ChangeLog::Action::Change
-            ));
+            );
             this->buyers[id].second = newMoney;
             return true;
         }
@@ -473,7 +492,7 @@ bool Deal::addPaymentTransaction(
 {
     if (std::find(this->payment_transactions.begin(), this->payment_transactions.end(), payment) ==
         this->payment_transactions.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(payment),
@@ -481,7 +500,7 @@ bool Deal::addPaymentTransaction(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Payment,
             ChangeLog::Action::Add
-        ));
+        );
         this->payment_transactions.push_back(payment);
         return true;
     }
@@ -492,7 +511,7 @@ bool Deal::delPaymentTransaction(size_t id, const InternalEmployeePtr& changer)
 {
     if (this->payment_transactions.size() > id) {
         auto removed = this->payment_transactions[id];
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(removed),
             std::nullopt,
@@ -500,7 +519,7 @@ bool Deal::delPaymentTransaction(size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Payment,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->payment_transactions.erase(this->payment_transactions.begin() + id);
         return true;
     }
@@ -520,7 +539,7 @@ bool Deal::addAssignedEmployee(
                 );
             }
         ) == this->assigned_employees.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(employee),
@@ -528,7 +547,7 @@ bool Deal::addAssignedEmployee(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakInternalEmployee,
             ChangeLog::Action::Add
-        ));
+        );
         this->assigned_employees.push_back(employee);
         return true;
     }
@@ -539,7 +558,7 @@ bool Deal::delAssignedEmployee(size_t id, const InternalEmployeePtr& changer)
 {
     if (this->assigned_employees.size() > id) {
         auto removed = this->assigned_employees[id];
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(removed),
             std::nullopt,
@@ -547,7 +566,7 @@ bool Deal::delAssignedEmployee(size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::WeakInternalEmployee,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->assigned_employees.erase(this->assigned_employees.begin() + id);
         return true;
     }
@@ -557,7 +576,7 @@ bool Deal::delAssignedEmployee(size_t id, const InternalEmployeePtr& changer)
 bool Deal::addOffer(const OfferDealPtr& offer, const InternalEmployeePtr& changer)
 {
     if (std::find(this->offers.begin(), this->offers.end(), offer) == this->offers.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(offer),
@@ -565,7 +584,7 @@ bool Deal::addOffer(const OfferDealPtr& offer, const InternalEmployeePtr& change
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::OfferDeal,
             ChangeLog::Action::Add
-        ));
+        );
         this->offers.push_back(offer);
         return true;
     }
@@ -575,7 +594,7 @@ bool Deal::addOffer(const OfferDealPtr& offer, const InternalEmployeePtr& change
 bool Deal::delOffer(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->offers.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->offers[index]),
             std::nullopt,
@@ -583,7 +602,7 @@ bool Deal::delOffer(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::OfferDeal,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->offers.erase(this->offers.begin() + index);
         return true;
     }
@@ -594,7 +613,7 @@ bool Deal::addDocument(const DocumentPtr& document, const InternalEmployeePtr& c
 {
     if (std::find(this->documents.begin(), this->documents.end(), document) ==
         this->documents.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(document),
@@ -602,7 +621,7 @@ bool Deal::addDocument(const DocumentPtr& document, const InternalEmployeePtr& c
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Document,
             ChangeLog::Action::Add
-        ));
+        );
         this->documents.push_back(document);
         return true;
     }
@@ -613,7 +632,7 @@ bool Deal::delDocument(size_t id, const InternalEmployeePtr& changer)
 {
     if (this->documents.size() > id) {
         auto removed = this->documents[id];
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(removed),
             std::nullopt,
@@ -621,7 +640,7 @@ bool Deal::delDocument(size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Document,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->documents.erase(this->documents.begin() + id);
         return true;
     }
@@ -631,7 +650,7 @@ bool Deal::delDocument(size_t id, const InternalEmployeePtr& changer)
 bool Deal::addTask(const TaskPtr& task, const InternalEmployeePtr& changer)
 {
     if (std::find(this->tasks.begin(), this->tasks.end(), task) == this->tasks.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(task),
@@ -639,7 +658,7 @@ bool Deal::addTask(const TaskPtr& task, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Task,
             ChangeLog::Action::Add
-        ));
+        );
         this->tasks.push_back(task);
         return true;
     }
@@ -649,7 +668,7 @@ bool Deal::addTask(const TaskPtr& task, const InternalEmployeePtr& changer)
 bool Deal::delTask(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->tasks.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->tasks[index]),
             std::nullopt,
@@ -657,7 +676,7 @@ bool Deal::delTask(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Task,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->tasks.erase(this->tasks.begin() + index);
         return true;
     }
@@ -668,7 +687,7 @@ bool Deal::addOffering(const OfferDealPtr& offering, const InternalEmployeePtr&
 {
     if (std::find(this->offerings.begin(), this->offerings.end(), offering) ==
         this->offerings.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(offering),
@@ -676,7 +695,7 @@ bool Deal::addOffering(const OfferDealPtr& offering, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::OfferDeal,
             ChangeLog::Action::Add
-        ));
+        );
         this->offerings.push_back(offering);
         return true;
     }
@@ -686,7 +705,7 @@ bool Deal::addOffering(const OfferDealPtr& offering, const InternalEmployeePtr&
 bool Deal::delOffering(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->offerings.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->offerings[index]),
             std::nullopt,
@@ -694,7 +713,7 @@ bool Deal::delOffering(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::OfferDeal,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->offerings.erase(this->offerings.begin() + index);
         return true;
     }
@@ -3,12 +3,14 @@
 
 #include "BigNum/big_uint.hpp"
 #include "BigNum/money.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "Currencies/currencies.hpp"
 #include "DateTime/date.hpp"
 #include "Document/document.hpp"
 #include "Interaction/priority.hpp"
 #include "Offering/offer_deal.hpp"
 #include "Payment/payment.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 
 struct Deal {
@@ -44,8 +46,8 @@ struct Deal {
         const Status&                     status,
         const OptionalStr&                other_status,
         const Priority&                   deal_priority,
-        const DatePtr&                    drawing_date,
-        const DatePtr&                    date_approval,
+        const OptionalDate&               drawing_date,
+        const OptionalDate&               date_approval,
         const Date&                       creation_date,
         const WeakPersonPtr&              owner,
         const WeakInternalEmployee&       manager,
@@ -66,16 +68,16 @@ struct Deal {
     auto getTitle() const -> const std::string&;
     auto getDescription() const -> const OptionalStr&;
     auto getSource() const -> const OptionalStr&;
-    auto getTags() const -> const std::vector<std::string>&;
+    auto getTags() const -> const std::vector<InternedStr>&;
     auto getBuyers() const -> const std::vector<WeakBuyerShare>&;
     auto getTotalAmount() const -> const Money&;
     auto getPaidAmount() const -> const Money&;
     auto getPaymentTransactions() const -> const std::vector<PaymentPtr>&;
     auto getStatus() const -> const Status&;
-    auto getOtherStatus() const -> const OptionalStr&;
+    auto getOtherStatus() const -> const OptionalInterned&;
     auto getDealPriority() const -> const Priority&;
-    auto getDrawingDate() const -> const DatePtr&;
-    auto getDateApproval() const -> const DatePtr&;
+    auto getDrawingDate() const -> const OptionalDate&;
+    auto getDateApproval() const -> const OptionalDate&;
     auto getCreationDate() const -> const Date&;
     auto getAssignedEmployees() const -> const std::vector<WeakInternalEmployee>&;
     auto getOffers() const -> const std::vector<OfferDealPtr>&;
@@ -84,7 +86,9 @@ struct Deal {
     auto getOwner() const -> const WeakPersonPtr&;
     auto getManager() const -> const WeakInternalEmployee&;
     auto getOfferings() const -> const std::vector<OfferDealPtr>&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
+    /// Fields as the change history had left them at `date`
+    auto getStateAt(const Date& date) const -> EntityState;
     /// @}
 
     /// @name Change functions
@@ -99,8 +103,8 @@ private:
     bool changeOtherStatus(const OptionalStr& status, const InternalEmployeePtr& changer);
     bool changeDealPriority(const Priority priority, const InternalEmployeePtr& changer);
     bool setCreationDate(const Date& date, const InternalEmployeePtr& changer);
-    bool setDrawingDate(const DatePtr& date, const InternalEmployeePtr& changer);
-    bool setDateApproval(const DatePtr& date, const InternalEmployeePtr& changer);
+    bool setDrawingDate(const OptionalDate& date, const InternalEmployeePtr& changer);
+    bool setDateApproval(const OptionalDate& date, const InternalEmployeePtr& changer);
     bool changeContractNumber(const std::string& number, const InternalEmployeePtr& changer);
     bool changeTitle(const std::string& title, const InternalEmployeePtr& changer);
 
@@ -149,6 +153,9 @@ public:
     friend class DealDataBase;
 
 private:
+    /// Fields the deal was created with, saved by `DealDataBase::add`
+    auto getInitialState() const -> InitialState;
+
     BigUint              id;
     std::string          contract_number;
     std::string          title;
@@ -157,17 +164,17 @@ private:
     Money                total_amount = Money("");
     Money                paid_amount  = Money("");
     Status               status       = Status::Draft;
-    OptionalStr          other_status;
+    OptionalInterned     other_status;
     Priority             deal_priority = Priority::Medium;
-    DatePtr              drawing_date;
-    DatePtr              date_approval;
+    OptionalDate         drawing_date;
+    OptionalDate         date_approval;
     Date                 creation_date = Date();
 
     WeakPersonPtr        owner;    // Person (Client/Employee) or CompanyPtr if company-level
     WeakInternalEmployee manager;  // Manager for accountability
 
     //
-    std::vector<std::string>          tags;
+    std::vector<InternedStr>          tags;
     std::vector<WeakBuyerShare>       buyers;
     std::vector<PaymentPtr>           payment_transactions;
     std::vector<WeakInternalEmployee> assigned_employees;
@@ -176,7 +183,7 @@ private:
     std::vector<TaskPtr>              tasks;
     std::vector<OfferDealPtr>         offerings;  // Internal offers in this deal
 
-    std::vector<ChangeLogPtr>         change_logs;
+    ChangeChain                       change_logs{EntityType::Deal, id};
 
 #ifdef _TESTING
 public:
@@ -204,10 +211,10 @@ public:
     bool _setCreationDate(const Date& date, const InternalEmployeePtr& changer) {
         return this->setCreationDate(date, changer);
     }
-    bool _setDrawingDate(const DatePtr& date, const InternalEmployeePtr& changer) {
+    bool _setDrawingDate(const OptionalDate& date, const InternalEmployeePtr& changer) {
         return this->setDrawingDate(date, changer);
     }
-    bool _setDateApproval(const DatePtr& date, const InternalEmployeePtr& changer) {
+    bool _setDateApproval(const OptionalDate& date, const InternalEmployeePtr& changer) {
         return this->setDateApproval(date, changer);
     }
     bool _changeContractNumber(const std::string& number, const InternalEmployeePtr& changer) {
@@ -1,8 +1,9 @@
 #include "document.hpp"
 
+#include <algorithm>
 #include <cstring>
 
-#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_journal.hpp"
 
 Document::Document(const BigUint& id) : id(id), status(DocumentStatus::Draft) {}
 
@@ -13,8 +14,8 @@ Document::Document(
     const std::string&          documentName,
     const std::string&          documentNumber,
     const std::string&          path,
-    const DatePtr&              enteredForce,
-    const DatePtr&              stoppedWorking,
+    const OptionalDate&         enteredForce,
+    const OptionalDate&         stoppedWorking,
     const DocumentStatus&       status,
     const WeakInternalEmployee& createdBy,
     std::vector<WeakPersonPtr>  partners,
@@ -40,29 +41,29 @@ auto Document::getTitle() const -> const std::string& { return this->title; }
 auto Document::getName() const -> const std::string& { return this->name; }
 auto Document::getNumber() const -> const std::string& { return this->number; }
 auto Document::getPath() const -> const std::string& { return this->path; }
-auto Document::getEnteredForce() const -> const DatePtr& { return this->entered_force; }
-auto Document::getStoppedWorking() const -> const DatePtr& { return this->stopped_working; }
+auto Document::getEnteredForce() const -> const OptionalDate& { return this->entered_force; }
+auto Document::getStoppedWorking() const -> const OptionalDate& { return this->stopped_working; }
 auto Document::getStatus() const -> DocumentStatus { return this->status; }
 auto Document::getCreatedBy() const -> const WeakInternalEmployee& { return this->created_by; }
 auto Document::getPartners() const -> const std::vector<WeakPersonPtr>& { return this->partners; }
 auto Document::getFiles() const -> const std::vector<FilePtr>& { return this->attachment_files; }
-auto Document::getChangeLogs() const -> const std::vector<ChangeLogPtr>&
+auto Document::getChangeLogs() const -> ChangeLogView
 {
-    return this->change_logs;
+    return ChangeLogView(this->change_logs);
 }
 
 bool Document::setDocumentTitle(const std::string& title, const InternalEmployeePtr& changer)
 {
     if (this->title != title) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->title)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(title)),
+            ChangeValue::fromText(this->title),
+            ChangeValue::fromText(title),
             DocumentFields::DocumentTitle,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->title = title;
         return true;
     }
@@ -72,15 +73,15 @@ bool Document::setDocumentTitle(const std::string& title, const InternalEmployee
 bool Document::setDocumentName(const std::string& name, const InternalEmployeePtr& changer)
 {
     if (this->name != name) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->name)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(name)),
+            ChangeValue::fromText(this->name),
+            ChangeValue::fromText(name),
             DocumentFields::DocumentName,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->name = name;
         return true;
     }
@@ -90,16 +91,15 @@ bool Document::setDocumentName(const std::string& name, const InternalEmployeePt
 bool Document::setDocumentNumber(const std::string& number, const InternalEmployeePtr& changer)
 {
     if (this->number != number) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->number)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(number)),
+            ChangeValue::fromText(this->number),
+            ChangeValue::fromText(number),
             DocumentFields::DocumentNumber,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->number = number;
         return true;
     }
@@ -109,63 +109,51 @@ bool Document::setDocumentNumber(const std::string& number, const InternalEmploy
 bool Document::setDocumentPath(const std::string& path, const InternalEmployeePtr& changer)
 {
     if (this->path != path) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->path)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(path)),
+            ChangeValue::fromText(this->path),
+            ChangeValue::fromText(path),
             DocumentFields::DocumentPath,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->path = path;
         return true;
     }
     return false;
 }
 
-bool Document::setEnteredForce(const DatePtr& date, const InternalEmployeePtr& changer)
+bool Document::setEnteredForce(const OptionalDate& date, const InternalEmployeePtr& changer)
 {
-    if (this->entered_force == nullptr || date == nullptr) {
-        if (this->entered_force == date) {
-            return false;
-        }
-    } else if (*this->entered_force == *date) {
-        return false;
-    }
+    if (this->entered_force == date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->entered_force),
-        PTR_TO_OPTIONAL(date),
+        OPTIONAL_TO_VALUE(this->entered_force),
+        OPTIONAL_TO_VALUE(date),
         DocumentFields::EnteredForce,
         this->entered_force ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->entered_force = date;
     return true;
 }
 
-bool Document::setStoppedWorking(const DatePtr& date, const InternalEmployeePtr& changer)
+bool Document::setStoppedWorking(const OptionalDate& date, const InternalEmployeePtr& changer)
 {
-    if (this->stopped_working == nullptr || date == nullptr) {
-        if (this->stopped_working == date) {
-            return false;
-        }
-    } else if (*this->stopped_working == *date) {
-        return false;
-    }
+    if (this->stopped_working == date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->stopped_working),
-        PTR_TO_OPTIONAL(date),
+        OPTIONAL_TO_VALUE(this->stopped_working),
+        OPTIONAL_TO_VALUE(date),
         DocumentFields::StoppedWorking,
         this->stopped_working ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->stopped_working = date;
     return true;
 }
@@ -173,7 +161,7 @@ bool Document::setStoppedWorking(const DatePtr& date, const InternalEmployeePtr&
 bool Document::setStatus(const DocumentStatus& status, const InternalEmployeePtr& changer)
 {
     if (this->status != status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->status),
             std::make_optional<ChangeLog::ValueVariant>(status),
@@ -181,7 +169,7 @@ bool Document::setStatus(const DocumentStatus& status, const InternalEmployeePtr
             ChangeLog::FieldType::DocumentStatus,
             ChangeLog::FieldType::DocumentStatus,
             ChangeLog::Action::Change
-        ));
+        );
         this->status = status;
         return true;
     }
@@ -191,7 +179,7 @@ bool Document::setStatus(const DocumentStatus& status, const InternalEmployeePtr
 bool Document::setCreatedBy(const WeakInternalEmployee& creator, const InternalEmployeePtr& changer)
 {
     if (this->created_by.owner_before(creator) || creator.owner_before(this->created_by)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->created_by),
             WEAK_PTR_TO_OPTIONAL(creator),
@@ -201,7 +189,7 @@ bool Document::setCreatedBy(const WeakInternalEmployee& creator, const InternalE
             !creator.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->created_by = creator;
         return true;
     }
@@ -219,7 +207,7 @@ bool Document::addPartner(const WeakPersonPtr& partner, const InternalEmployeePt
                 );
             }
         ) == this->partners.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(partner),
@@ -227,7 +215,7 @@ bool Document::addPartner(const WeakPersonPtr& partner, const InternalEmployeePt
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakPerson,
             ChangeLog::Action::Add
-        ));
+        );
         this->partners.push_back(partner);
         return true;
     }
@@ -237,7 +225,7 @@ bool Document::addPartner(const WeakPersonPtr& partner, const InternalEmployeePt
 bool Document::delPartner(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->partners.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->partners[id]),
             std::nullopt,
@@ -245,7 +233,7 @@ bool Document::delPartner(const size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::WeakPerson,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->partners.erase(this->partners.begin() + id);
         return true;
     }
@@ -256,7 +244,7 @@ bool Document::addFile(const FilePtr& file, const InternalEmployeePtr& changer)
 {
     if (std::find(this->attachment_files.begin(), this->attachment_files.end(), file) ==
         this->attachment_files.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(file),
@@ -264,7 +252,7 @@ bool Document::addFile(const FilePtr& file, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::Action::Add
-        ));
+        );
         this->attachment_files.push_back(file);
         return true;
     }
@@ -274,7 +262,7 @@ bool Document::addFile(const FilePtr& file, const InternalEmployeePtr& changer)
 bool Document::delFile(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->attachment_files.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->attachment_files[id]),
             std::nullopt,
@@ -282,7 +270,7 @@ bool Document::delFile(const size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->attachment_files.erase(this->attachment_files.begin() + id);
         return true;
     }
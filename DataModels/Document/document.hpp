@@ -2,6 +2,7 @@
 #include <vector>
 
 #include "BigNum/big_uint.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "DateTime/date.hpp"
 #include "Person/person.hpp"
 #include "Usings/type_usings.hpp"
@@ -17,8 +18,8 @@ public:
         const std::string&          documentName,
         const std::string&          documentNumber,
         const std::string&          path,
-        const DatePtr&              enteredForce,
-        const DatePtr&              stoppedWorking,
+        const OptionalDate&         enteredForce,
+        const OptionalDate&         stoppedWorking,
         const DocumentStatus&       status,
         const WeakInternalEmployee& createdBy,
         std::vector<WeakPersonPtr>  partners,
@@ -33,13 +34,13 @@ public:
     auto getName() const -> const std::string&;
     auto getNumber() const -> const std::string&;
     auto getPath() const -> const std::string&;
-    auto getEnteredForce() const -> const DatePtr&;
-    auto getStoppedWorking() const -> const DatePtr&;
+    auto getEnteredForce() const -> const OptionalDate&;
+    auto getStoppedWorking() const -> const OptionalDate&;
     auto getStatus() const -> DocumentStatus;
     auto getCreatedBy() const -> const WeakInternalEmployee&;
     auto getPartners() const -> const std::vector<WeakPersonPtr>&;
     auto getFiles() const -> const std::vector<FilePtr>&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
     ///@}
 
     /// @name Change functions
@@ -48,8 +49,8 @@ public:
     bool setDocumentName(const std::string& name, const InternalEmployeePtr& changer);
     bool setDocumentNumber(const std::string& number, const InternalEmployeePtr& changer);
     bool setDocumentPath(const std::string& path, const InternalEmployeePtr& changer);
-    bool setEnteredForce(const DatePtr& date, const InternalEmployeePtr& changer);
-    bool setStoppedWorking(const DatePtr& date, const InternalEmployeePtr& changer);
+    bool setEnteredForce(const OptionalDate& date, const InternalEmployeePtr& changer);
+    bool setStoppedWorking(const OptionalDate& date, const InternalEmployeePtr& changer);
     bool setStatus(const DocumentStatus& status, const InternalEmployeePtr& changer);
     bool setCreatedBy(const WeakInternalEmployee& creator, const InternalEmployeePtr& changer);
 
@@ -75,13 +76,13 @@ private:
     std::string          name;
     std::string          number;
     std::string          path;
-    DatePtr              entered_force;
-    DatePtr              stopped_working;
+    OptionalDate         entered_force;
+    OptionalDate         stopped_working;
     DocumentStatus       status;
     WeakInternalEmployee created_by;
 
     //
     std::vector<WeakPersonPtr> partners;
     std::vector<FilePtr>       attachment_files;
-    std::vector<ChangeLogPtr>  change_logs;
+    ChangeChain                change_logs{EntityType::Document, id};
 };
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "file_metadata.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_journal.hpp"
 
 FileMetadata::FileMetadata(const BigUint& id) : id(id) {}
 
@@ -27,9 +27,9 @@ auto FileMetadata::getFileFormat() const -> const std::string& { return this->fo
 auto FileMetadata::getFilePath() const -> const std::string& { return this->path; }
 auto FileMetadata::getFileSize() const -> bool { return this->size; }
 auto FileMetadata::getUploadDate() const -> const Date& { return this->upload_date; }
-auto FileMetadata::getChangeLogs() const -> const std::vector<ChangeLogPtr>&
+auto FileMetadata::getChangeLogs() const -> ChangeLogView
 {
-    return this->change_logs;
+    return ChangeLogView(this->change_logs);
 }
 auto FileMetadata::getHach() const -> const std::string& { return this->content_hash; }
 
@@ -38,15 +38,15 @@ bool FileMetadata::setFileName(
 )
 {
     if (this->name != file_name) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->name)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(file_name)),
+            ChangeValue::fromText(this->name),
+            ChangeValue::fromText(file_name),
             FileMetadataFields::FileName,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->name = file_name;
         return true;
     }
@@ -58,16 +58,15 @@ bool FileMetadata::setFileFormat(
 )
 {
     if (this->format != file_format) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->format)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(file_format)),
+            ChangeValue::fromText(this->format),
+            ChangeValue::fromText(file_format),
             FileMetadataFields::FileFormat,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->format = file_format;
         return true;
     }
@@ -79,15 +78,15 @@ bool FileMetadata::setFilePath(
 )
 {
     if (this->path != file_path) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->path)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(file_path)),
+            ChangeValue::fromText(this->path),
+            ChangeValue::fromText(file_path),
             FileMetadataFields::FilePath,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->path = file_path;
         return true;
     }
@@ -97,7 +96,7 @@ bool FileMetadata::setFilePath(
 bool FileMetadata::setFileSize(const bool size, const std::shared_ptr<InternalEmployee>& changer)
 {
     if (this->size != size) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->size),
             std::make_optional<ChangeLog::ValueVariant>(size),
@@ -105,7 +104,7 @@ bool FileMetadata::setFileSize(const bool size, const std::shared_ptr<InternalEm
             ChangeLog::FieldType::Uint,
             ChangeLog::FieldType::Uint,
             ChangeLog::Action::Change
-        ));
+        );
         this->size = size;
         return true;
     }
@@ -115,15 +114,15 @@ bool FileMetadata::setFileSize(const bool size, const std::shared_ptr<InternalEm
 bool FileMetadata::setUploadDate(const Date& date, const std::shared_ptr<InternalEmployee>& changer)
 {
     if (this->upload_date != date) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Date>(this->upload_date)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Date>(date)),
+            std::make_optional<ChangeLog::ValueVariant>(this->upload_date),
+            std::make_optional<ChangeLog::ValueVariant>(date),
             FileMetadataFields::UploadDate,
             ChangeLog::FieldType::Date,
             ChangeLog::FieldType::Date,
             ChangeLog::Action::Change
-        ));
+        );
         this->upload_date = date;
         return true;
     }
@@ -2,6 +2,7 @@
 #include <vector>
 
 #include "BigNum/big_uint.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "DateTime/date.hpp"
 #include "Usings/type_usings.hpp"
 
@@ -23,7 +24,7 @@ public:
     auto getFilePath() const -> const std::string&;
     auto getFileSize() const -> bool;
     auto getUploadDate() const -> const Date&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
     auto getHach() const -> const std::string&;
 
     bool setFileName(
@@ -49,5 +50,5 @@ private:
     std::string content_hash;
 
     //
-    std::vector<ChangeLogPtr> change_logs;
+    ChangeChain               change_logs{EntityType::File, id};
 };
@@ -1,6 +1,8 @@
 #include "base_interaction.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 #include "DateTime/date.hpp"
 #include "Task/task.hpp"
 
@@ -18,8 +20,8 @@ BaseInteraction::BaseInteraction(
     const std::optional<TimeDuration>& interaction_duration,
     const Priority&                    priority,
     const WeakInternalEmployee&        manager,
-    const DatePtr&                     start_date,
-    const DatePtr&                     end_date,
+    const OptionalDate&                start_date,
+    const OptionalDate&                end_date,
     const WeakInternalEmployee&        checker,
     const InteractionType&             type,
     std::vector<std::string>           tags,
@@ -42,7 +44,7 @@ BaseInteraction::BaseInteraction(
     , end_date(end_date)
     , checker(checker)
     , type(type)
-    , tags(std::move(tags))
+    , tags(InternedStr::fromList(tags))
     , results(std::move(results))
     , notes(std::move(notes))
     , more_data(std::move(more_data))
@@ -62,7 +64,7 @@ auto BaseInteraction::getInteractionDuration() const -> const std::optional<Time
     return this->interaction_duration;
 }
 auto BaseInteraction::getPriority() const -> Priority { return this->priority; }
-auto BaseInteraction::getTags() const -> const std::vector<std::string>& { return this->tags; }
+auto BaseInteraction::getTags() const -> const std::vector<InternedStr>& { return this->tags; }
 auto BaseInteraction::getResults() const -> const std::vector<InteractionResult>&
 {
     return this->results;
@@ -82,22 +84,45 @@ auto BaseInteraction::getAttachmentFiles() const -> const std::vector<FilePtr>&
     return this->attachment_files;
 }
 auto BaseInteraction::getCreatedDate() const -> const Date& { return this->created_date; }
-auto BaseInteraction::getStartDate() const -> const DatePtr& { return this->start_date; }
-auto BaseInteraction::getEndDate() const -> const DatePtr& { return this->end_date; }
+auto BaseInteraction::getStartDate() const -> const OptionalDate& { return this->start_date; }
+auto BaseInteraction::getEndDate() const -> const OptionalDate& { return this->end_date; }
 auto BaseInteraction::getChecker() const -> const WeakInternalEmployee& { return this->checker; }
 auto BaseInteraction::getParticipants() const -> const std::vector<WeakPersonPtr>&
 {
     return this->participants;
 }
 auto BaseInteraction::getType() const -> InteractionType { return this->type; }
-auto BaseInteraction::getChangeLogs() const -> const std::vector<ChangeLogPtr>&
+auto BaseInteraction::getChangeLogs() const -> ChangeLogView
+{
+    return ChangeLogView(this->change_logs);
+}
+auto BaseInteraction::getStateAt(const Date& date) const -> EntityState
+{
+    return ChangeJournal::getInstance().getStateAt(this->change_logs, date);
+}
+auto BaseInteraction::getInitialState() const -> InitialState
 {
-    return this->change_logs;
+    using Type   = ChangeLog::FieldType;
+    using Fields = BaseInteractionFields;
+
+    InitialState state(this->created_date);
+    state.set(Fields::ExternalID, Type::String, OPTIONAL_STR_TO_VALUE(this->external_id));
+    state.set(Fields::Title, Type::String, ChangeValue::fromText(this->title));
+    state.set(Fields::Description, Type::String, OPTIONAL_STR_TO_VALUE(this->description));
+    state.set(Fields::InteractionDuration, Type::TimeDuration, this->interaction_duration);
+    state.set(Fields::Priority, Type::Priority, this->priority);
+    state.set(Fields::Manager, Type::WeakInternalEmployee, WEAK_PTR_TO_OPTIONAL(this->manager));
+    state.set(Fields::Subject, Type::String, OPTIONAL_STR_TO_VALUE(this->subject));
+    state.set(Fields::StartDate, Type::Date, this->start_date);
+    state.set(Fields::EndDate, Type::Date, this->end_date);
+    state.set(Fields::Checker, Type::WeakInternalEmployee, WEAK_PTR_TO_OPTIONAL(this->checker));
+    return state;
 }
+
 bool BaseInteraction::setExternalId(const OptionalStr& id, const InternalEmployeePtr& changer)
 {
     if (this->external_id != id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->external_id),
             OPTIONAL_STR_TO_VALUE(id),
@@ -105,7 +130,7 @@ bool BaseInteraction::setExternalId(const OptionalStr& id, const InternalEmploye
             this->external_id ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             id ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->external_id = id;
         return true;
     }
@@ -115,15 +140,15 @@ bool BaseInteraction::setExternalId(const OptionalStr& id, const InternalEmploye
 bool BaseInteraction::setTitle(const std::string& title, const InternalEmployeePtr& changer)
 {
     if (this->title != title) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->title)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(title)),
+            ChangeValue::fromText(this->title),
+            ChangeValue::fromText(title),
             BaseInteractionFields::Title,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->title = title;
         return true;
     }
@@ -135,7 +160,7 @@ bool BaseInteraction::setDescription(
 )
 {
     if (this->description != description) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->description),
             OPTIONAL_STR_TO_VALUE(description),
@@ -143,7 +168,7 @@ bool BaseInteraction::setDescription(
             this->description ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             description ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->description = description;
         return true;
     }
@@ -155,23 +180,16 @@ bool BaseInteraction::setDuration(
 )
 {
     if (this->interaction_duration != duration) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->interaction_duration
-                ? std::make_optional<ChangeLog::ValueVariant>(
-                      std::make_shared<TimeDuration>(this->interaction_duration.value())
-                  )
-                : std::nullopt,
-            duration ? std::make_optional<ChangeLog::ValueVariant>(
-                           std::make_shared<TimeDuration>(duration.value())
-                       )
-                     : std::nullopt,
+            OPTIONAL_TO_VALUE(this->interaction_duration),
+            OPTIONAL_TO_VALUE(duration),
             BaseInteractionFields::InteractionDuration,
             this->interaction_duration ? ChangeLog::FieldType::TimeDuration
                                        : ChangeLog::FieldType::null,
             duration ? ChangeLog::FieldType::TimeDuration : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->interaction_duration = duration;
         return true;
     }
@@ -181,7 +199,7 @@ bool BaseInteraction::setDuration(
 bool BaseInteraction::setPriority(const Priority& priority, const InternalEmployeePtr& changer)
 {
     if (this->priority != priority) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->priority),
             std::make_optional<ChangeLog::ValueVariant>(priority),
@@ -189,7 +207,7 @@ bool BaseInteraction::setPriority(const Priority& priority, const InternalEmploy
             ChangeLog::FieldType::Priority,
             ChangeLog::FieldType::Priority,
             ChangeLog::Action::Change
-        ));
+        );
         this->priority = priority;
         return true;
     }
@@ -199,16 +217,16 @@ bool BaseInteraction::setPriority(const Priority& priority, const InternalEmploy
 bool BaseInteraction::addTag(const std::string& tag, const InternalEmployeePtr& changer)
 {
     if (std::find(this->tags.begin(), this->tags.end(), tag) == this->tags.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(tag)),
+            ChangeValue::fromText(tag),
             BaseInteractionFields::Tags,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add
-        ));
-        this->tags.push_back(tag);
+        );
+        this->tags.emplace_back(tag);
         return true;
     }
     return false;
@@ -217,17 +235,15 @@ bool BaseInteraction::addTag(const std::string& tag, const InternalEmployeePtr&
 bool BaseInteraction::delTag(const size_t index, const InternalEmployeePtr& changer)
 {
     if (this->tags.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->tags[index])
-            ),
+            ChangeValue::fromText(this->tags[index]),
             std::nullopt,
             BaseInteractionFields::Tags,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->tags.erase(this->tags.begin() + index);
         return true;
     }
@@ -236,7 +252,7 @@ bool BaseInteraction::delTag(const size_t index, const InternalEmployeePtr& chan
 
 bool BaseInteraction::addResult(const InteractionResult& result, const InternalEmployeePtr& changer)
 {
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         std::nullopt,
         std::make_optional<ChangeLog::ValueVariant>(std::make_shared<InteractionResult>(result)),
@@ -244,7 +260,7 @@ bool BaseInteraction::addResult(const InteractionResult& result, const InternalE
         ChangeLog::FieldType::null,
         ChangeLog::FieldType::InteractionResult,
         ChangeLog::Action::Add
-    ));
+    );
     this->results.push_back(result);
     return true;
 }
@@ -252,7 +268,7 @@ bool BaseInteraction::addResult(const InteractionResult& result, const InternalE
 bool BaseInteraction::delResult(const size_t index, const InternalEmployeePtr& changer)
 {
     if (this->results.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(
                 std::make_shared<InteractionResult>(this->results[index])
@@ -262,7 +278,7 @@ bool BaseInteraction::delResult(const size_t index, const InternalEmployeePtr& c
             ChangeLog::FieldType::InteractionResult,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->results.erase(this->results.begin() + index);
         return true;
     }
@@ -274,7 +290,7 @@ bool BaseInteraction::setManager(
 )
 {
     if (this->manager.owner_before(manager) || manager.owner_before(this->manager)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->manager),
             WEAK_PTR_TO_OPTIONAL(manager),
@@ -284,7 +300,7 @@ bool BaseInteraction::setManager(
             !manager.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->manager = manager;
         return true;
     }
@@ -293,7 +309,7 @@ bool BaseInteraction::setManager(
 
 bool BaseInteraction::addNote(const Note& note, const InternalEmployeePtr& changer)
 {
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         std::nullopt,
         std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Note>(note)),
@@ -301,7 +317,7 @@ bool BaseInteraction::addNote(const Note& note, const InternalEmployeePtr& chang
         ChangeLog::FieldType::null,
         ChangeLog::FieldType::Note,
         ChangeLog::Action::Add
-    ));
+    );
     this->notes.push_back(note);
     return true;
 }
@@ -309,7 +325,7 @@ bool BaseInteraction::addNote(const Note& note, const InternalEmployeePtr& chang
 bool BaseInteraction::delNote(const size_t index, const InternalEmployeePtr& changer)
 {
     if (this->notes.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Note>(this->notes[index])),
             std::nullopt,
@@ -317,7 +333,7 @@ bool BaseInteraction::delNote(const size_t index, const InternalEmployeePtr& cha
             ChangeLog::FieldType::Note,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->notes.erase(this->notes.begin() + index);
         return true;
     }
@@ -330,7 +346,7 @@ bool BaseInteraction::addMoreData(
 {
     auto pair = std::make_pair(title, data);
     if (std::find(this->more_data.begin(), this->more_data.end(), pair) == this->more_data.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(
@@ -340,7 +356,7 @@ bool BaseInteraction::addMoreData(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::StringPair,
             ChangeLog::Action::Add
-        ));
+        );
         this->more_data.push_back(pair);
         return true;
     }
@@ -350,7 +366,7 @@ bool BaseInteraction::addMoreData(
 bool BaseInteraction::delMoreData(const size_t index, const InternalEmployeePtr& changer)
 {
     if (this->more_data.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(
                 std::make_shared<std::pair<const std::string, const std::string>>(
@@ -362,7 +378,7 @@ bool BaseInteraction::delMoreData(const size_t index, const InternalEmployeePtr&
             ChangeLog::FieldType::StringPair,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->more_data.erase(this->more_data.begin() + index);
         return true;
     }
@@ -376,7 +392,7 @@ bool BaseInteraction::addRelatedInteractions(
     if (std::find(
             this->related_interactions.begin(), this->related_interactions.end(), interaction
         ) == this->related_interactions.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(interaction),
@@ -384,7 +400,7 @@ bool BaseInteraction::addRelatedInteractions(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::BaseInteraction,
             ChangeLog::Action::Add
-        ));
+        );
         this->related_interactions.push_back(interaction);
         return true;
     }
@@ -394,7 +410,7 @@ bool BaseInteraction::addRelatedInteractions(
 bool BaseInteraction::delRelatedInteractions(const size_t index, const InternalEmployeePtr& changer)
 {
     if (this->related_interactions.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->related_interactions[index]),
             std::nullopt,
@@ -402,7 +418,7 @@ bool BaseInteraction::delRelatedInteractions(const size_t index, const InternalE
             ChangeLog::FieldType::BaseInteraction,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->related_interactions.erase(this->related_interactions.begin() + index);
         return true;
     }
@@ -413,7 +429,7 @@ bool BaseInteraction::addAttachmentFiles(const FilePtr& file, const InternalEmpl
 {
     if (std::find(this->attachment_files.begin(), this->attachment_files.end(), file) ==
         this->attachment_files.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(file),
@@ -421,7 +437,7 @@ bool BaseInteraction::addAttachmentFiles(const FilePtr& file, const InternalEmpl
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::Action::Add
-        ));
+        );
         this->attachment_files.push_back(file);
         return true;
     }
@@ -431,7 +447,7 @@ bool BaseInteraction::addAttachmentFiles(const FilePtr& file, const InternalEmpl
 bool BaseInteraction::delAttachmentFiles(const size_t index, const InternalEmployeePtr& changer)
 {
     if (this->attachment_files.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->attachment_files[index]),
             std::nullopt,
@@ -439,7 +455,7 @@ bool BaseInteraction::delAttachmentFiles(const size_t index, const InternalEmplo
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->attachment_files.erase(this->attachment_files.begin() + index);
         return true;
     }
@@ -449,7 +465,7 @@ bool BaseInteraction::delAttachmentFiles(const size_t index, const InternalEmplo
 bool BaseInteraction::setSubject(const OptionalStr& subject, const InternalEmployeePtr& changer)
 {
     if (this->subject != subject) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->subject),
             OPTIONAL_STR_TO_VALUE(subject),
@@ -457,55 +473,43 @@ bool BaseInteraction::setSubject(const OptionalStr& subject, const InternalEmplo
             this->subject ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             subject ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->subject = subject;
         return true;
     }
     return false;
 }
 
-bool BaseInteraction::setStartDate(const DatePtr& date, const InternalEmployeePtr& changer)
+bool BaseInteraction::setStartDate(const OptionalDate& date, const InternalEmployeePtr& changer)
 {
-    if (this->start_date == nullptr || date == nullptr) {
-        if (this->start_date == date) {
-            return false;
-        }
-    } else if (*this->start_date == *date) {
-        return false;
-    }
+    if (this->start_date == date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->start_date),
-        PTR_TO_OPTIONAL(date),
+        OPTIONAL_TO_VALUE(this->start_date),
+        OPTIONAL_TO_VALUE(date),
         BaseInteractionFields::StartDate,
         this->start_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->start_date = date;
     return true;
 }
 
-bool BaseInteraction::setEndDate(const DatePtr& date, const InternalEmployeePtr& changer)
+bool BaseInteraction::setEndDate(const OptionalDate& date, const InternalEmployeePtr& changer)
 {
-    if (this->end_date == nullptr || date == nullptr) {
-        if (this->end_date == date) {
-            return false;
-        }
-    } else if (*this->end_date == *date) {
-        return false;
-    }
+    if (this->end_date == date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->end_date),
-        PTR_TO_OPTIONAL(date),
+        OPTIONAL_TO_VALUE(this->end_date),
+        OPTIONAL_TO_VALUE(date),
         BaseInteractionFields::EndDate,
         this->end_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->end_date = date;
     return true;
 }
@@ -515,7 +519,7 @@ bool BaseInteraction::setChecker(
 )
 {
     if (this->checker.owner_before(checker) || checker.owner_before(this->checker)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->checker),
             WEAK_PTR_TO_OPTIONAL(checker),
@@ -525,7 +529,7 @@ bool BaseInteraction::setChecker(
             !checker.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->checker = checker;
         return true;
     }
@@ -546,7 +550,7 @@ bool BaseInteraction::addParticipants(
                 );
             }
         ) == this->participants.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(participant),
@@ -554,7 +558,7 @@ bool BaseInteraction::addParticipants(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakPerson,
             ChangeLog::Action::Add
-        ));
+        );
         this->participants.push_back(participant);
         return true;
     }
@@ -564,7 +568,7 @@ bool BaseInteraction::addParticipants(
 bool BaseInteraction::delParticipants(const size_t index, const InternalEmployeePtr& changer)
 {
     if (this->participants.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->participants[index]),
             std::nullopt,
@@ -572,7 +576,7 @@ bool BaseInteraction::delParticipants(const size_t index, const InternalEmployee
             ChangeLog::FieldType::WeakPerson,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->participants.erase(this->participants.begin() + index);
         return true;
     }
@@ -593,7 +597,7 @@ bool BaseInteraction::addCampaign(
                      ) == this->campaigns.end();
 
     if (is_unique) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(campaign.lock()),
@@ -601,7 +605,7 @@ bool BaseInteraction::addCampaign(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Campaign,
             ChangeLog::Action::Add
-        ));
+        );
         this->campaigns.push_back(campaign);
         return true;
     }
@@ -611,7 +615,7 @@ bool BaseInteraction::addCampaign(
 bool BaseInteraction::delCampaign(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->campaigns.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->campaigns[index].lock()),
             std::nullopt,
@@ -619,21 +623,13 @@ bool BaseInteraction::delCampaign(size_t index, const InternalEmployeePtr& chang
             ChangeLog::FieldType::Campaign,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->campaigns.erase(this->campaigns.begin() + index);
         return true;
     }
     return false;
 }
 
-void BaseInteraction::addChangeLog(const ChangeLogPtr& changeLog)
-{
-    if (std::find(this->change_logs.begin(), this->change_logs.end(), changeLog) ==
-        this->change_logs.end()) {
-        this->change_logs.push_back(changeLog);
-    }
-}
-
 void BaseInteraction::clearParticipants()
 {
     this->participants.erase(
@@ -2,10 +2,12 @@
 #include <vector>
 
 #include "BigNum/big_uint.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "DateTime/time_duration.hpp"
 #include "FileMetadata/file_metadata.hpp"
 #include "Interaction/interaction_result.hpp"
 #include "Note/note.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 #include "priority.hpp"
 
@@ -34,8 +36,8 @@ struct BaseInteraction {
         const std::optional<TimeDuration>& interaction_duration,
         const Priority&                    priority,
         const WeakInternalEmployee&        manager,
-        const DatePtr&                     start_date,
-        const DatePtr&                     end_date,
+        const OptionalDate&                start_date,
+        const OptionalDate&                end_date,
         const WeakInternalEmployee&        checker,
         const InteractionType&             type,
         std::vector<std::string>           tags,
@@ -58,7 +60,7 @@ public:
     auto getSubject() const -> const OptionalStr&;
     auto getInteractionDuration() const -> const std::optional<TimeDuration>&;
     auto getPriority() const -> Priority;
-    auto getTags() const -> const std::vector<std::string>&;
+    auto getTags() const -> const std::vector<InternedStr>&;
     auto getResults() const -> const std::vector<InteractionResult>&;
     auto getManager() const -> const WeakInternalEmployee&;
     auto getNotes() const -> const std::vector<Note>&;
@@ -66,12 +68,14 @@ public:
     auto getRelatedInteractions() const -> const std::vector<InteractionPtr>&;
     auto getAttachmentFiles() const -> const std::vector<FilePtr>&;
     auto getCreatedDate() const -> const Date&;
-    auto getStartDate() const -> const DatePtr&;
-    auto getEndDate() const -> const DatePtr&;
+    auto getStartDate() const -> const OptionalDate&;
+    auto getEndDate() const -> const OptionalDate&;
     auto getChecker() const -> const WeakInternalEmployee&;
     auto getParticipants() const -> const std::vector<WeakPersonPtr>&;
     auto getType() const -> InteractionType;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
+    /// Fields as the change history had left them at `date`
+    auto getStateAt(const Date& date) const -> EntityState;
     /// @}
 
     /// @name Change functions
@@ -87,8 +91,8 @@ private:
 
     bool setManager(const WeakInternalEmployee& manager, const InternalEmployeePtr& changer);
 
-    bool setStartDate(const DatePtr& date, const InternalEmployeePtr& changer);
-    bool setEndDate(const DatePtr& date, const InternalEmployeePtr& changer);
+    bool setStartDate(const OptionalDate& date, const InternalEmployeePtr& changer);
+    bool setEndDate(const OptionalDate& date, const InternalEmployeePtr& changer);
 
     bool addParticipants(const WeakPersonPtr& participant, const InternalEmployeePtr& changer);
     bool delParticipants(const size_t index, const InternalEmployeePtr& changer);
@@ -125,8 +129,6 @@ public:
     bool delCampaign(size_t index, const InternalEmployeePtr& changer);
     /// @}
 
-    void addChangeLog(const ChangeLogPtr& changeLog);
-
     /// @name Auxiliary functions
     /// @{
     void clearParticipants();
@@ -141,12 +143,12 @@ private:
 
     std::optional<TimeDuration>    interaction_duration;
     Date                           created_date = Date();
-    DatePtr                        start_date;
-    DatePtr                        end_date;
+    OptionalDate                   start_date;
+    OptionalDate                   end_date;
 
     InteractionType                type;
     Priority                       priority;
-    std::vector<std::string>       tags;
+    std::vector<InternedStr>       tags;
     std::vector<StringPair>        more_data;
 
     WeakInternalEmployee           manager;
@@ -162,7 +164,10 @@ private:
     std::vector<WeakCampaignPtr>   campaigns;
 
 protected:
-    std::vector<ChangeLogPtr> change_logs;
+    ChangeChain               change_logs{EntityType::Interaction, id};
+
+    /// Fields of the interaction itself, saved by `InteractionDataBase::add`
+    auto getInitialState() const -> InitialState;
 
     friend class InteractionDataBase;
 
@@ -189,10 +194,10 @@ public:
         return this->setManager(manager, changer);
     }
 
-    bool _setStartDate(const DatePtr& date, const InternalEmployeePtr& changer) {
+    bool _setStartDate(const OptionalDate& date, const InternalEmployeePtr& changer) {
         return this->setStartDate(date, changer);
     }
-    bool _setEndDate(const DatePtr& date, const InternalEmployeePtr& changer) {
+    bool _setEndDate(const OptionalDate& date, const InternalEmployeePtr& changer) {
         return this->setEndDate(date, changer);
     }
 
@@ -1,6 +1,6 @@
 #include "commentary_social_networks.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_journal.hpp"
 #include "DateTime/time_duration.hpp"
 
 CommentarySocialNetworks::CommentarySocialNetworks(const BigUint& id)
@@ -17,8 +17,8 @@ CommentarySocialNetworks::CommentarySocialNetworks(
     const std::optional<TimeDuration>& interaction_duration,
     const Priority&                    priority,
     const WeakInternalEmployee&        manager,
-    const DatePtr&                     start_date,
-    const DatePtr&                     end_date,
+    const OptionalDate&                start_date,
+    const OptionalDate&                end_date,
     const WeakInternalEmployee&        checker,
     const InteractionType&             type,
     std::vector<std::string>           tags,
@@ -86,16 +86,15 @@ bool CommentarySocialNetworks::setNickname(
 )
 {
     if (this->nickname != nickname) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->nickname
-            )),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(nickname)),
+            ChangeValue::fromText(this->nickname),
+            ChangeValue::fromText(nickname),
             CommentarySocialNetworksFields::Nickname,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->nickname = nickname;
         return true;
     }
@@ -107,7 +106,7 @@ bool CommentarySocialNetworks::setAuthor(
 )
 {
     if (this->author.owner_before(author) || author.owner_before(this->author)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->author),
             WEAK_PTR_TO_OPTIONAL(author),
@@ -115,7 +114,7 @@ bool CommentarySocialNetworks::setAuthor(
             !this->author.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             !author.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->author = author;
         return true;
     }
@@ -127,17 +126,15 @@ bool CommentarySocialNetworks::setCommentary(
 )
 {
     if (this->commentary != commentary) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->commentary)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(commentary)),
+            ChangeValue::fromText(this->commentary),
+            ChangeValue::fromText(commentary),
             CommentarySocialNetworksFields::Commentary,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->commentary = commentary;
         return true;
     }
@@ -149,7 +146,7 @@ bool CommentarySocialNetworks::setAnswerTo(
 )
 {
     if (this->answer_to != answer_to) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->answer_to),
             PTR_TO_OPTIONAL(answer_to),
@@ -158,7 +155,7 @@ bool CommentarySocialNetworks::setAnswerTo(
                             : ChangeLog::FieldType::null,
             answer_to ? ChangeLog::FieldType::CommentarySocialNetworks : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->answer_to = answer_to;
         return true;
     }
@@ -170,7 +167,7 @@ bool CommentarySocialNetworks::setAnswer(
 )
 {
     if (this->answer != answer) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->answer),
             PTR_TO_OPTIONAL(answer),
@@ -179,7 +176,7 @@ bool CommentarySocialNetworks::setAnswer(
                          : ChangeLog::FieldType::null,
             answer ? ChangeLog::FieldType::CommentarySocialNetworks : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->answer = answer;
         return true;
     }
@@ -189,15 +186,15 @@ bool CommentarySocialNetworks::setAnswer(
 bool CommentarySocialNetworks::setDateSending(const Date& date, const InternalEmployeePtr& changer)
 {
     if (this->date_sending != date) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Date>(this->date_sending)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Date>(date)),
+            std::make_optional<ChangeLog::ValueVariant>(this->date_sending),
+            std::make_optional<ChangeLog::ValueVariant>(date),
             CommentarySocialNetworksFields::DateSending,
             ChangeLog::FieldType::Date,
             ChangeLog::FieldType::Date,
             ChangeLog::Action::Change
-        ));
+        );
         this->date_sending = date;
         return true;
     }
@@ -207,7 +204,7 @@ bool CommentarySocialNetworks::setDateSending(const Date& date, const InternalEm
 bool CommentarySocialNetworks::setIsFirst(bool first, const InternalEmployeePtr& changer)
 {
     if (this->is_first != first) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->is_first),
             std::make_optional<ChangeLog::ValueVariant>(first),
@@ -215,7 +212,7 @@ bool CommentarySocialNetworks::setIsFirst(bool first, const InternalEmployeePtr&
             ChangeLog::FieldType::Bool,
             ChangeLog::FieldType::Bool,
             ChangeLog::Action::Change
-        ));
+        );
         this->is_first = first;
         return true;
     }
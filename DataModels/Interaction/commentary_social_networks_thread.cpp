@@ -1,6 +1,8 @@
 #include "commentary_social_networks_thread.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 
 CommentarySocialNetworksThread::CommentarySocialNetworksThread(const BigUint& id)
     : BaseInteraction(id, InteractionType::commentarySocialNetworksThread)
@@ -16,8 +18,8 @@ CommentarySocialNetworksThread::CommentarySocialNetworksThread(
     const std::optional<TimeDuration>&       interaction_duration,
     const Priority&                          priority,
     const WeakInternalEmployee&              manager,
-    const DatePtr&                           start_date,
-    const DatePtr&                           end_date,
+    const OptionalDate&                      start_date,
+    const OptionalDate&                      end_date,
     const WeakInternalEmployee&              checker,
     const InteractionType&                   type,
     std::vector<std::string>                 tags,
@@ -65,7 +67,7 @@ bool CommentarySocialNetworksThread::addComment(
 )
 {
     if (std::find(this->comments.begin(), this->comments.end(), comment) == this->comments.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(comment),
@@ -73,7 +75,7 @@ bool CommentarySocialNetworksThread::addComment(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::CommentarySocialNetworks,
             ChangeLog::Action::Add
-        ));
+        );
         this->comments.push_back(comment);
         return true;
     }
@@ -83,7 +85,7 @@ bool CommentarySocialNetworksThread::addComment(
 bool CommentarySocialNetworksThread::delComment(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->comments.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->comments[id]),
             std::nullopt,
@@ -91,7 +93,7 @@ bool CommentarySocialNetworksThread::delComment(const size_t id, const InternalE
             ChangeLog::FieldType::CommentarySocialNetworks,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->comments.erase(this->comments.begin() + id);
         return true;
     }
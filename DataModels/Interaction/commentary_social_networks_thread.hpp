@@ -12,8 +12,8 @@ struct CommentarySocialNetworksThread : public BaseInteraction {
         const std::optional<TimeDuration>&       interaction_duration,
         const Priority&                          priority,
         const WeakInternalEmployee&              manager,
-        const DatePtr&                           start_date,
-        const DatePtr&                           end_date,
+        const OptionalDate&                      start_date,
+        const OptionalDate&                      end_date,
         const WeakInternalEmployee&              checker,
         const InteractionType&                   type,
         std::vector<std::string>                 tags,
@@ -1,6 +1,8 @@
 #include "correspondence.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 
 Correspondence::Correspondence(const BigUint& id)
     : BaseInteraction(id, InteractionType::correspondence)
@@ -16,8 +18,8 @@ Correspondence::Correspondence(
     const std::optional<TimeDuration>& interaction_duration,
     const Priority&                    priority,
     const WeakInternalEmployee&        manager,
-    const DatePtr&                     start_date,
-    const DatePtr&                     end_date,
+    const OptionalDate&                start_date,
+    const OptionalDate&                end_date,
     const WeakInternalEmployee&        checker,
     const InteractionType&             type,
     std::vector<std::string>           tags,
@@ -64,7 +66,7 @@ auto Correspondence::getPlatform() const -> const std::string& { return this->pl
 bool Correspondence::addMessage(const MessagePtr& message, const InternalEmployeePtr& changer)
 {
     if (std::find(this->messages.begin(), this->messages.end(), message) == this->messages.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(message),
@@ -72,7 +74,7 @@ bool Correspondence::addMessage(const MessagePtr& message, const InternalEmploye
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Message,
             ChangeLog::Action::Add
-        ));
+        );
         this->messages.push_back(message);
         return true;
     }
@@ -82,7 +84,7 @@ bool Correspondence::addMessage(const MessagePtr& message, const InternalEmploye
 bool Correspondence::delMessage(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->messages.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->messages[id]),
             std::nullopt,
@@ -90,7 +92,7 @@ bool Correspondence::delMessage(const size_t id, const InternalEmployeePtr& chan
             ChangeLog::FieldType::Message,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->messages.erase(this->messages.begin() + id);
         return true;
     }
@@ -100,16 +102,15 @@ bool Correspondence::delMessage(const size_t id, const InternalEmployeePtr& chan
 bool Correspondence::setPlatform(const std::string& platform, const InternalEmployeePtr& changer)
 {
     if (this->platform != platform) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->platform
-            )),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(platform)),
+            ChangeValue::fromText(this->platform),
+            ChangeValue::fromText(platform),
             CorrespondenceFields::Platform,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->platform = platform;
         return true;
     }
@@ -1,6 +1,8 @@
 #include "email_letter.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 #include "DateTime/date.hpp"
 
 EmailLetter::EmailLetter(const BigUint& id)
@@ -21,8 +23,8 @@ EmailLetter::EmailLetter(
     const std::optional<TimeDuration>& interaction_duration,
     const Priority&                    priority,
     const WeakInternalEmployee&        manager,
-    const DatePtr&                     start_date,
-    const DatePtr&                     end_date,
+    const OptionalDate&                start_date,
+    const OptionalDate&                end_date,
     const WeakInternalEmployee&        checker,
     const InteractionType&             type,
     std::vector<std::string>           tags,
@@ -41,9 +43,9 @@ EmailLetter::EmailLetter(
     const WeakPersonPtr&               sender,
     const WeakPersonPtr&               recipient,
     const std::string&                 body,
-    const DatePtr&                     send_date,
-    const DatePtr&                     received_date,
-    const DatePtr&                     read_time,
+    const OptionalDate&                send_date,
+    const OptionalDate&                received_date,
+    const OptionalDate&                read_time,
     const std::string&                 email_provider,
     const EmailLetterPtr&              previous_letter,
     const EmailLetterPtr&              next_letter,
@@ -109,9 +111,9 @@ auto EmailLetter::getBccEmailAddresses() const -> const std::vector<std::string>
 auto EmailLetter::getSender() const -> const WeakPersonPtr& { return this->sender; }
 auto EmailLetter::getRecipient() const -> const WeakPersonPtr& { return this->recipient; }
 auto EmailLetter::getBody() const -> const std::string& { return this->body; }
-auto EmailLetter::getSendDate() const -> const DatePtr { return this->send_date; }
-auto EmailLetter::getReceivedDate() const -> const DatePtr { return this->received_date; }
-auto EmailLetter::getReadTime() const -> const DatePtr { return this->read_time; }
+auto EmailLetter::getSendDate() const -> const OptionalDate { return this->send_date; }
+auto EmailLetter::getReceivedDate() const -> const OptionalDate { return this->received_date; }
+auto EmailLetter::getReadTime() const -> const OptionalDate { return this->read_time; }
 auto EmailLetter::getEmailProvider() const -> const std::string& { return this->email_provider; }
 auto EmailLetter::getPreviousLetter() const -> const EmailLetterPtr
 {
@@ -124,17 +126,15 @@ auto EmailLetter::getIsFlagged() const -> bool { return this->is_flagged; }
 bool EmailLetter::setFromEmailAddress(const std::string& email, const InternalEmployeePtr& changer)
 {
     if (this->from_email_address != email) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->from_email_address)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(email)),
+            ChangeValue::fromText(this->from_email_address),
+            ChangeValue::fromText(email),
             EmailLetterFields::FromEmailAddress,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->from_email_address = email;
         return true;
     }
@@ -144,17 +144,15 @@ bool EmailLetter::setFromEmailAddress(const std::string& email, const InternalEm
 bool EmailLetter::setToEmailAddress(const std::string& email, const InternalEmployeePtr& changer)
 {
     if (this->to_email_address != email) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->to_email_address)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(email)),
+            ChangeValue::fromText(this->to_email_address),
+            ChangeValue::fromText(email),
             EmailLetterFields::ToEmailAddress,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->to_email_address = email;
         return true;
     }
@@ -164,7 +162,7 @@ bool EmailLetter::setToEmailAddress(const std::string& email, const InternalEmpl
 bool EmailLetter::setLetterType(EmailLetterType type, const InternalEmployeePtr& changer)
 {
     if (this->letter_type != type) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->letter_type),
             std::make_optional<ChangeLog::ValueVariant>(type),
@@ -172,7 +170,7 @@ bool EmailLetter::setLetterType(EmailLetterType type, const InternalEmployeePtr&
             ChangeLog::FieldType::EmailLetterType,
             ChangeLog::FieldType::EmailLetterType,
             ChangeLog::Action::Change
-        ));
+        );
         this->letter_type = type;
         return true;
     }
@@ -182,7 +180,7 @@ bool EmailLetter::setLetterType(EmailLetterType type, const InternalEmployeePtr&
 bool EmailLetter::setEmailStatus(EmailStatus status, const InternalEmployeePtr& changer)
 {
     if (this->email_status != status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->email_status),
             std::make_optional<ChangeLog::ValueVariant>(status),
@@ -190,7 +188,7 @@ bool EmailLetter::setEmailStatus(EmailStatus status, const InternalEmployeePtr&
             ChangeLog::FieldType::EmailStatus,
             ChangeLog::FieldType::EmailStatus,
             ChangeLog::Action::Change
-        ));
+        );
         this->email_status = status;
         return true;
     }
@@ -201,15 +199,15 @@ bool EmailLetter::addCcEmailAddress(const std::string& address, const InternalEm
 {
     if (std::find(this->cc_email_addresses.begin(), this->cc_email_addresses.end(), address) ==
         this->cc_email_addresses.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(address)),
+            ChangeValue::fromText(address),
             EmailLetterFields::CcEmailAddresses,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add
-        ));
+        );
         this->cc_email_addresses.push_back(address);
         return true;
     }
@@ -219,17 +217,15 @@ bool EmailLetter::addCcEmailAddress(const std::string& address, const InternalEm
 bool EmailLetter::delCcEmailAddress(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->cc_email_addresses.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->cc_email_addresses[id])
-            ),
+            ChangeValue::fromText(this->cc_email_addresses[id]),
             std::nullopt,
             EmailLetterFields::CcEmailAddresses,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->cc_email_addresses.erase(this->cc_email_addresses.begin() + id);
         return true;
     }
@@ -240,15 +236,15 @@ bool EmailLetter::addBccEmailAddress(const std::string& address, const InternalE
 {
     if (std::find(this->bcc_email_addresses.begin(), this->bcc_email_addresses.end(), address) ==
         this->bcc_email_addresses.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(address)),
+            ChangeValue::fromText(address),
             EmailLetterFields::BccEmailAddresses,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add
-        ));
+        );
         this->bcc_email_addresses.push_back(address);
         return true;
     }
@@ -258,17 +254,15 @@ bool EmailLetter::addBccEmailAddress(const std::string& address, const InternalE
 bool EmailLetter::delBccEmailAddress(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->bcc_email_addresses.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->bcc_email_addresses[id])
-            ),
+            ChangeValue::fromText(this->bcc_email_addresses[id]),
             std::nullopt,
             EmailLetterFields::BccEmailAddresses,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->bcc_email_addresses.erase(this->bcc_email_addresses.begin() + id);
         return true;
     }
@@ -278,7 +272,7 @@ bool EmailLetter::delBccEmailAddress(const size_t id, const InternalEmployeePtr&
 bool EmailLetter::setSender(const WeakPersonPtr& sender, const InternalEmployeePtr& changer)
 {
     if (this->sender.owner_before(sender) || sender.owner_before(this->sender)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->sender),
             WEAK_PTR_TO_OPTIONAL(sender),
@@ -286,7 +280,7 @@ bool EmailLetter::setSender(const WeakPersonPtr& sender, const InternalEmployeeP
             !this->sender.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             !sender.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->sender = sender;
         return true;
     }
@@ -296,7 +290,7 @@ bool EmailLetter::setSender(const WeakPersonPtr& sender, const InternalEmployeeP
 bool EmailLetter::setRecipient(const WeakPersonPtr& recipient, const InternalEmployeePtr& changer)
 {
     if (this->recipient.owner_before(recipient) || recipient.owner_before(this->recipient)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->recipient),
             WEAK_PTR_TO_OPTIONAL(recipient),
@@ -305,7 +299,7 @@ bool EmailLetter::setRecipient(const WeakPersonPtr& recipient, const InternalEmp
                                        : ChangeLog::FieldType::null,
             !recipient.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->recipient = recipient;
         return true;
     }
@@ -315,86 +309,68 @@ bool EmailLetter::setRecipient(const WeakPersonPtr& recipient, const InternalEmp
 bool EmailLetter::setBody(const std::string& body, const InternalEmployeePtr& changer)
 {
     if (this->body != body) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->body)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(body)),
+            ChangeValue::fromText(this->body),
+            ChangeValue::fromText(body),
             EmailLetterFields::Body,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->body = body;
         return true;
     }
     return false;
 }
 
-bool EmailLetter::setSendDate(const DatePtr& date, const InternalEmployeePtr& changer)
+bool EmailLetter::setSendDate(const OptionalDate& date, const InternalEmployeePtr& changer)
 {
-    if (this->send_date == nullptr || date == nullptr) {
-        if (this->send_date == date) {
-            return false;
-        }
-    } else if (*this->send_date == *date) {
-        return false;
-    }
+    if (this->send_date == date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->send_date),
-        PTR_TO_OPTIONAL(date),
+        OPTIONAL_TO_VALUE(this->send_date),
+        OPTIONAL_TO_VALUE(date),
         EmailLetterFields::SendDate,
         this->send_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->send_date = date;
     return true;
 }
 
-bool EmailLetter::setReceivedDate(const DatePtr& date, const InternalEmployeePtr& changer)
+bool EmailLetter::setReceivedDate(const OptionalDate& date, const InternalEmployeePtr& changer)
 {
-    if (this->received_date == nullptr || date == nullptr) {
-        if (this->received_date == date) {
-            return false;
-        }
-    } else if (*this->received_date == *date) {
-        return false;
-    }
+    if (this->received_date == date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->received_date),
-        PTR_TO_OPTIONAL(date),
+        OPTIONAL_TO_VALUE(this->received_date),
+        OPTIONAL_TO_VALUE(date),
         EmailLetterFields::ReceivedDate,
         this->received_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->received_date = date;
     return true;
 }
 
-bool EmailLetter::setReadTime(const DatePtr& time, const InternalEmployeePtr& changer)
+bool EmailLetter::setReadTime(const OptionalDate& time, const InternalEmployeePtr& changer)
 {
-    if (this->read_time == nullptr || time == nullptr) {
-        if (this->read_time == time) {
-            return false;
-        }
-    } else if (*this->read_time == *time) {
-        return false;
-    }
+    if (this->read_time == time) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->read_time),
-        PTR_TO_OPTIONAL(time),
+        OPTIONAL_TO_VALUE(this->read_time),
+        OPTIONAL_TO_VALUE(time),
         EmailLetterFields::ReadTime,
         this->read_time ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         time ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->read_time = time;
     return true;
 }
@@ -402,17 +378,15 @@ bool EmailLetter::setReadTime(const DatePtr& time, const InternalEmployeePtr& ch
 bool EmailLetter::setEmailProvider(const std::string& provider, const InternalEmployeePtr& changer)
 {
     if (this->email_provider != provider) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->email_provider)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(provider)),
+            ChangeValue::fromText(this->email_provider),
+            ChangeValue::fromText(provider),
             EmailLetterFields::EmailProvider,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->email_provider = provider;
         return true;
     }
@@ -424,7 +398,7 @@ bool EmailLetter::setPreviousLetter(
 )
 {
     if (this->previous_letter != letter) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->previous_letter),
             PTR_TO_OPTIONAL(letter),
@@ -432,7 +406,7 @@ bool EmailLetter::setPreviousLetter(
             this->previous_letter ? ChangeLog::FieldType::EmailLetter : ChangeLog::FieldType::null,
             letter ? ChangeLog::FieldType::EmailLetter : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->previous_letter = letter;
         return true;
     }
@@ -442,7 +416,7 @@ bool EmailLetter::setPreviousLetter(
 bool EmailLetter::setNextLetter(const EmailLetterPtr& letter, const InternalEmployeePtr& changer)
 {
     if (this->next_letter != letter) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->next_letter),
             PTR_TO_OPTIONAL(letter),
@@ -450,7 +424,7 @@ bool EmailLetter::setNextLetter(const EmailLetterPtr& letter, const InternalEmpl
             this->next_letter ? ChangeLog::FieldType::EmailLetter : ChangeLog::FieldType::null,
             letter ? ChangeLog::FieldType::EmailLetter : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->next_letter = letter;
         return true;
     }
@@ -460,7 +434,7 @@ bool EmailLetter::setNextLetter(const EmailLetterPtr& letter, const InternalEmpl
 bool EmailLetter::setIsRead(bool is_read, const InternalEmployeePtr& changer)
 {
     if (this->is_read != is_read) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->is_read),
             std::make_optional<ChangeLog::ValueVariant>(is_read),
@@ -468,7 +442,7 @@ bool EmailLetter::setIsRead(bool is_read, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Bool,
             ChangeLog::FieldType::Bool,
             ChangeLog::Action::Change
-        ));
+        );
         this->is_read = is_read;
         return true;
     }
@@ -478,7 +452,7 @@ bool EmailLetter::setIsRead(bool is_read, const InternalEmployeePtr& changer)
 bool EmailLetter::setIsFlagged(bool is_flagged, const InternalEmployeePtr& changer)
 {
     if (this->is_flagged != is_flagged) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->is_flagged),
             std::make_optional<ChangeLog::ValueVariant>(is_flagged),
@@ -486,7 +460,7 @@ bool EmailLetter::setIsFlagged(bool is_flagged, const InternalEmployeePtr& chang
             ChangeLog::FieldType::Bool,
             ChangeLog::FieldType::Bool,
             ChangeLog::Action::Change
-        ));
+        );
         this->is_flagged = is_flagged;
         return true;
     }
@@ -25,8 +25,8 @@ struct EmailLetter : public BaseInteraction {
         const std::optional<TimeDuration>& interaction_duration,
         const Priority&                    priority,
         const WeakInternalEmployee&        manager,
-        const DatePtr&                     start_date,
-        const DatePtr&                     end_date,
+        const OptionalDate&                start_date,
+        const OptionalDate&                end_date,
         const WeakInternalEmployee&        checker,
         const InteractionType&             type,
         std::vector<std::string>           tags,
@@ -45,9 +45,9 @@ struct EmailLetter : public BaseInteraction {
         const WeakPersonPtr&               sender,
         const WeakPersonPtr&               recipient,
         const std::string&                 body,
-        const DatePtr&                     send_date,
-        const DatePtr&                     received_date,
-        const DatePtr&                     read_time,
+        const OptionalDate&                send_date,
+        const OptionalDate&                received_date,
+        const OptionalDate&                read_time,
         const std::string&                 email_provider,
         const EmailLetterPtr&              previous_letter,
         const EmailLetterPtr&              next_letter,
@@ -67,9 +67,9 @@ public:
     auto getSender() const -> const WeakPersonPtr&;
     auto getRecipient() const -> const WeakPersonPtr&;
     auto getBody() const -> const std::string&;
-    auto getSendDate() const -> const DatePtr;
-    auto getReceivedDate() const -> const DatePtr;
-    auto getReadTime() const -> const DatePtr;
+    auto getSendDate() const -> const OptionalDate;
+    auto getReceivedDate() const -> const OptionalDate;
+    auto getReadTime() const -> const OptionalDate;
     auto getEmailProvider() const -> const std::string&;
     auto getPreviousLetter() const -> const EmailLetterPtr;
     auto getNextLetter() const -> const EmailLetterPtr;
@@ -93,9 +93,9 @@ public:
     bool setSender(const WeakPersonPtr& sender, const InternalEmployeePtr& changer);
     bool setRecipient(const WeakPersonPtr& recipient, const InternalEmployeePtr& changer);
     bool setBody(const std::string& body, const InternalEmployeePtr& changer);
-    bool setSendDate(const DatePtr& date, const InternalEmployeePtr& changer);
-    bool setReceivedDate(const DatePtr& date, const InternalEmployeePtr& changer);
-    bool setReadTime(const DatePtr& time, const InternalEmployeePtr& changer);
+    bool setSendDate(const OptionalDate& date, const InternalEmployeePtr& changer);
+    bool setReceivedDate(const OptionalDate& date, const InternalEmployeePtr& changer);
+    bool setReadTime(const OptionalDate& time, const InternalEmployeePtr& changer);
     bool setEmailProvider(const std::string& provider, const InternalEmployeePtr& changer);
     bool setPreviousLetter(const EmailLetterPtr& letter, const InternalEmployeePtr& changer);
     bool setNextLetter(const EmailLetterPtr& letter, const InternalEmployeePtr& changer);
@@ -118,9 +118,9 @@ private:
 
     std::string              body;
 
-    DatePtr                  send_date;
-    DatePtr                  received_date;
-    DatePtr                  read_time;
+    OptionalDate             send_date;
+    OptionalDate             received_date;
+    OptionalDate             read_time;
 
     std::string              email_provider;
 
@@ -1,6 +1,8 @@
 #include "email_thread.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 
 EmailThread::EmailThread(const BigUint& id) : BaseInteraction(id, InteractionType::emailThread) {}
 
@@ -13,8 +15,8 @@ EmailThread::EmailThread(
     const std::optional<TimeDuration>& interaction_duration,
     const Priority&                    priority,
     const WeakInternalEmployee&        manager,
-    const DatePtr&                     start_date,
-    const DatePtr&                     end_date,
+    const OptionalDate&                start_date,
+    const OptionalDate&                end_date,
     const WeakInternalEmployee&        checker,
     const InteractionType&             type,
     std::vector<std::string>           tags,
@@ -64,7 +66,7 @@ auto EmailThread::getEmployees() const -> const std::vector<WeakInternalEmployee
 bool EmailThread::addLetter(const EmailLetterPtr& letter, const InternalEmployeePtr& changer)
 {
     if (std::find(this->letters.begin(), this->letters.end(), letter) == this->letters.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(letter),
@@ -72,7 +74,7 @@ bool EmailThread::addLetter(const EmailLetterPtr& letter, const InternalEmployee
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::EmailLetter,
             ChangeLog::Action::Add
-        ));
+        );
         this->letters.push_back(letter);
         return true;
     }
@@ -82,7 +84,7 @@ bool EmailThread::addLetter(const EmailLetterPtr& letter, const InternalEmployee
 bool EmailThread::delLetter(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->letters.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->letters[id]),
             std::nullopt,
@@ -90,7 +92,7 @@ bool EmailThread::delLetter(const size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::EmailLetter,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->letters.erase(this->letters.begin() + id);
         return true;
     }
@@ -106,7 +108,7 @@ bool EmailThread::addClient(const WeakClientPtr& client, const InternalEmployeeP
                 return !(client.owner_before(other_client) || other_client.owner_before(client));
             }
         ) == this->clients.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(client),
@@ -114,7 +116,7 @@ bool EmailThread::addClient(const WeakClientPtr& client, const InternalEmployeeP
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakClient,
             ChangeLog::Action::Add
-        ));
+        );
         this->clients.push_back(client);
         return true;
     }
@@ -124,7 +126,7 @@ bool EmailThread::addClient(const WeakClientPtr& client, const InternalEmployeeP
 bool EmailThread::delClient(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->clients.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->clients[id]),
             std::nullopt,
@@ -132,7 +134,7 @@ bool EmailThread::delClient(const size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::WeakClient,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->clients.erase(this->clients.begin() + id);
         return true;
     }
@@ -152,7 +154,7 @@ bool EmailThread::addEmployee(
                 );
             }
         ) == this->employees.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(employee),
@@ -160,7 +162,7 @@ bool EmailThread::addEmployee(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakInternalEmployee,
             ChangeLog::Action::Add
-        ));
+        );
         this->employees.push_back(employee);
         return true;
     }
@@ -170,7 +172,7 @@ bool EmailThread::addEmployee(
 bool EmailThread::delEmployee(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->employees.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->employees[id]),
             std::nullopt,
@@ -178,7 +180,7 @@ bool EmailThread::delEmployee(const size_t id, const InternalEmployeePtr& change
             ChangeLog::FieldType::WeakInternalEmployee,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->employees.erase(this->employees.begin() + id);
         return true;
     }
@@ -1,6 +1,8 @@
 #include "interaction_result.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 #include "Usings/type_usings.hpp"
 InteractionResult::InteractionResult(
     const std::string&          interaction_title,
@@ -25,7 +27,7 @@ InteractionResult::InteractionResult(
     , planned_interactions(std::move(planned_interactions))
     , files(std::move(files))
     , more_data(std::move(more_data))
-    , tags(std::move(tags))
+    , tags(InternedStr::fromList(tags))
 {
 }
 
@@ -57,10 +59,10 @@ auto InteractionResult::getMoreData() const -> const std::vector<StringPair>&
 {
     return this->more_data;
 }
-auto InteractionResult::getTags() const -> const std::vector<std::string>& { return this->tags; }
-auto InteractionResult::getChangeLogs() const -> const std::vector<ChangeLogPtr>&
+auto InteractionResult::getTags() const -> const std::vector<InternedStr>& { return this->tags; }
+auto InteractionResult::getChangeLogs() const -> ChangeLogView
 {
-    return this->change_logs;
+    return ChangeLogView(this->change_logs);
 }
 
 bool InteractionResult::setInteractionResultTitle(
@@ -68,18 +70,15 @@ bool InteractionResult::setInteractionResultTitle(
 )
 {
     if (this->interaction_result_title != title) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->interaction_result_title)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(title)),
+            ChangeValue::fromText(this->interaction_result_title),
+            ChangeValue::fromText(title),
             InteractionResultFields::InteractionResultTitle,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
         );
-        this->change_logs.emplace_back(changeLog);
         this->interaction_result_title = title;
         return true;
     }
@@ -91,18 +90,15 @@ bool InteractionResult::setDescription(
 )
 {
     if (this->description != description) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->description)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(description)),
+            ChangeValue::fromText(this->description),
+            ChangeValue::fromText(description),
             InteractionResultFields::Description,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
         );
-        this->change_logs.emplace_back(changeLog);
         this->description = description;
         return true;
     }
@@ -113,7 +109,7 @@ bool InteractionResult::addDocument(const DocumentPtr& document, const InternalE
 {
     if (std::find(this->documents.begin(), this->documents.end(), document) ==
         this->documents.end()) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(document),
@@ -122,7 +118,6 @@ bool InteractionResult::addDocument(const DocumentPtr& document, const InternalE
             ChangeLog::FieldType::Document,
             ChangeLog::Action::Add
         );
-        this->change_logs.emplace_back(changeLog);
         this->documents.push_back(document);
         return true;
     }
@@ -132,7 +127,7 @@ bool InteractionResult::addDocument(const DocumentPtr& document, const InternalE
 bool InteractionResult::delDocument(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->documents.size() > id) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->documents[id]),
             std::nullopt,
@@ -141,7 +136,6 @@ bool InteractionResult::delDocument(const size_t id, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
         );
-        this->change_logs.emplace_back(changeLog);
         this->documents.erase(this->documents.begin() + id);
         return true;
     }
@@ -157,7 +151,7 @@ bool InteractionResult::addDeal(const WeakDealPtr& deal, const InternalEmployeeP
                 return !(deal.owner_before(other_deal) || other_deal.owner_before(deal));
             }
         ) == this->deals.end()) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(deal),
@@ -166,7 +160,6 @@ bool InteractionResult::addDeal(const WeakDealPtr& deal, const InternalEmployeeP
             ChangeLog::FieldType::WeakDeal,
             ChangeLog::Action::Add
         );
-        this->change_logs.emplace_back(changeLog);
         this->deals.push_back(deal);
         return true;
     }
@@ -176,7 +169,7 @@ bool InteractionResult::addDeal(const WeakDealPtr& deal, const InternalEmployeeP
 bool InteractionResult::delDeal(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->deals.size() > id) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->deals[id]),
             std::nullopt,
@@ -185,7 +178,6 @@ bool InteractionResult::delDeal(const size_t id, const InternalEmployeePtr& chan
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
         );
-        this->change_logs.emplace_back(changeLog);
         this->deals.erase(this->deals.begin() + id);
         return true;
     }
@@ -199,7 +191,7 @@ bool InteractionResult::addPlannedInteraction(
     if (std::find(
             this->planned_interactions.begin(), this->planned_interactions.end(), interaction
         ) == this->planned_interactions.end()) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(interaction),
@@ -208,7 +200,6 @@ bool InteractionResult::addPlannedInteraction(
             ChangeLog::FieldType::BaseInteraction,
             ChangeLog::Action::Add
         );
-        this->change_logs.emplace_back(changeLog);
         this->planned_interactions.push_back(interaction);
         return true;
     }
@@ -218,7 +209,7 @@ bool InteractionResult::addPlannedInteraction(
 bool InteractionResult::delPlannedInteraction(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->planned_interactions.size() > id) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->planned_interactions[id]),
             std::nullopt,
@@ -227,7 +218,6 @@ bool InteractionResult::delPlannedInteraction(const size_t id, const InternalEmp
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
         );
-        this->change_logs.emplace_back(changeLog);
         this->planned_interactions.erase(this->planned_interactions.begin() + id);
         return true;
     }
@@ -237,7 +227,7 @@ bool InteractionResult::delPlannedInteraction(const size_t id, const InternalEmp
 bool InteractionResult::addFile(const FilePtr& file, const InternalEmployeePtr& changer)
 {
     if (std::find(this->files.begin(), this->files.end(), file) == this->files.end()) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(file),
@@ -246,7 +236,6 @@ bool InteractionResult::addFile(const FilePtr& file, const InternalEmployeePtr&
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::Action::Add
         );
-        this->change_logs.emplace_back(changeLog);
         this->files.push_back(file);
         return true;
     }
@@ -256,7 +245,7 @@ bool InteractionResult::addFile(const FilePtr& file, const InternalEmployeePtr&
 bool InteractionResult::delFile(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->files.size() > id) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->files[id]),
             std::nullopt,
@@ -265,7 +254,6 @@ bool InteractionResult::delFile(const size_t id, const InternalEmployeePtr& chan
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
         );
-        this->change_logs.emplace_back(changeLog);
         this->files.erase(this->files.begin() + id);
         return true;
     }
@@ -279,11 +267,9 @@ bool InteractionResult::setResultStatus(
     if (this->result_status != result_status) {
         bool isOther = !this->other_result_status.empty();
 
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            isOther ? std::make_optional<ChangeLog::ValueVariant>(
-                          std::make_shared<std::string>(this->other_result_status)
-                      )
+            isOther ? ChangeValue::fromText(this->other_result_status)
                     : std::make_optional<ChangeLog::ValueVariant>(this->result_status),
             std::make_optional<ChangeLog::ValueVariant>(result_status),
             InteractionResultFields::ResultStatus,
@@ -291,7 +277,6 @@ bool InteractionResult::setResultStatus(
             ChangeLog::FieldType::ResultStatus,
             ChangeLog::Action::Change
         );
-        this->change_logs.emplace_back(changeLog);
         this->other_result_status.clear();
         this->result_status = result_status;
         return true;
@@ -306,21 +291,16 @@ bool InteractionResult::setOtherResultStatus(
     if (this->other_result_status != other_result_status) {
         bool isOther = !this->other_result_status.empty();
 
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            isOther ? std::make_optional<ChangeLog::ValueVariant>(
-                          std::make_shared<std::string>(this->other_result_status)
-                      )
+            isOther ? ChangeValue::fromText(this->other_result_status)
                     : std::make_optional<ChangeLog::ValueVariant>(this->result_status),
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(other_result_status)
-            ),
+            ChangeValue::fromText(other_result_status),
             InteractionResultFields::ResultStatus,
             isOther ? ChangeLog::FieldType::String : ChangeLog::FieldType::ResultStatus,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
         );
-        this->change_logs.emplace_back(changeLog);
         this->result_status       = ResultStatus::other;
         this->other_result_status = other_result_status;
         return true;
@@ -333,18 +313,15 @@ bool InteractionResult::setIdentifiedIssue(
 )
 {
     if (this->identified_issue != issue) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->identified_issue)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(issue)),
+            ChangeValue::fromText(this->identified_issue),
+            ChangeValue::fromText(issue),
             InteractionResultFields::IdentifiedIssue,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
         );
-        this->change_logs.emplace_back(changeLog);
         this->identified_issue = issue;
         return true;
     }
@@ -357,7 +334,7 @@ bool InteractionResult::addMoreData(
 {
     auto pair = std::make_pair(title, data);
     if (std::find(this->more_data.begin(), this->more_data.end(), pair) == this->more_data.end()) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(
@@ -368,7 +345,6 @@ bool InteractionResult::addMoreData(
             ChangeLog::FieldType::StringPair,
             ChangeLog::Action::Add
         );
-        this->change_logs.emplace_back(changeLog);
         this->more_data.push_back(pair);
         return true;
     }
@@ -378,7 +354,7 @@ bool InteractionResult::addMoreData(
 bool InteractionResult::delMoreData(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->more_data.size() > id) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(
                 std::make_shared<std::pair<const std::string, const std::string>>(
@@ -391,7 +367,6 @@ bool InteractionResult::delMoreData(const size_t id, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
         );
-        this->change_logs.emplace_back(changeLog);
         this->more_data.erase(this->more_data.begin() + id);
         return true;
     }
@@ -401,17 +376,16 @@ bool InteractionResult::delMoreData(const size_t id, const InternalEmployeePtr&
 bool InteractionResult::addTag(const std::string& tag, const InternalEmployeePtr& changer)
 {
     if (std::find(this->tags.begin(), this->tags.end(), tag) == this->tags.end()) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(tag)),
+            ChangeValue::fromText(tag),
             InteractionResultFields::Tags,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add
         );
-        this->change_logs.emplace_back(changeLog);
-        this->tags.push_back(tag);
+        this->tags.emplace_back(tag);
         return true;
     }
     return false;
@@ -420,17 +394,15 @@ bool InteractionResult::addTag(const std::string& tag, const InternalEmployeePtr
 bool InteractionResult::delTag(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->tags.size() > id) {
-        auto changeLog = std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->tags[id]
-            )),
+            ChangeValue::fromText(this->tags[id]),
             std::nullopt,
             InteractionResultFields::Tags,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
         );
-        this->change_logs.emplace_back(changeLog);
         this->tags.erase(this->tags.begin() + id);
         return true;
     }
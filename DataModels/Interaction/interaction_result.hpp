@@ -3,7 +3,9 @@
 #include <string>
 #include <vector>
 
+#include "ChangeLog/change_chain.hpp"
 #include "FileMetadata/file_metadata.hpp"
+#include "TenantContext/string_pool.hpp"
 
 struct InteractionResult {
     enum class ResultStatus : uint8_t {
@@ -47,8 +49,8 @@ public:
     auto getOtherResultStatus() const -> const std::string&;
     auto getIdentifiedIssue() const -> const std::string&;
     auto getMoreData() const -> const std::vector<StringPair>&;
-    auto getTags() const -> const std::vector<std::string>&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getTags() const -> const std::vector<InternedStr>&;
+    auto getChangeLogs() const -> ChangeLogView;
     /// @}
 
     /// @name Change functions
@@ -101,8 +103,8 @@ private:
 
     std::string                 identified_issue;
 
-    std::vector<std::string>    tags;
+    std::vector<InternedStr>    tags;
     std::vector<StringPair>     more_data;
 
-    std::vector<ChangeLogPtr>   change_logs;
+    ChangeChain                 change_logs{EntityType::InteractionResult};
 };
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "meeting.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 #include "Usings/type_usings.hpp"
 Meeting::Meeting(const BigUint& id)
     : BaseInteraction(id, InteractionType::meeting)
@@ -20,8 +22,8 @@ Meeting::Meeting(
     const std::optional<TimeDuration>& interaction_duration,
     const Priority&                    priority,
     const WeakInternalEmployee&        manager,
-    const DatePtr&                     start_date,
-    const DatePtr&                     end_date,
+    const OptionalDate&                start_date,
+    const OptionalDate&                end_date,
     const WeakInternalEmployee&        checker,
     const InteractionType&             type,
     std::vector<std::string>           tags,
@@ -94,7 +96,7 @@ auto Meeting::getOtherOutcomes() const -> const std::vector<std::string>&
 {
     return this->other_outcomes;
 }
-auto Meeting::getOtherType() const -> const std::string& { return this->other_type; }
+auto Meeting::getOtherType() const -> const InternedStr& { return this->other_type; }
 auto Meeting::getRecord() const -> const std::string& { return this->record; }
 auto Meeting::getClients() const -> const std::vector<WeakClientPtr>& { return this->clients; }
 auto Meeting::getEmployees() const -> const std::vector<WeakInternalEmployee>&
@@ -111,7 +113,7 @@ auto Meeting::getIsVirtual() const -> bool { return this->is_virtual; }
 bool Meeting::setLocation(const AddressPtr& location, const InternalEmployeePtr& changer)
 {
     if (this->location != location) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->location),
             PTR_TO_OPTIONAL(location),
@@ -119,7 +121,7 @@ bool Meeting::setLocation(const AddressPtr& location, const InternalEmployeePtr&
             this->location ? ChangeLog::FieldType::Address : ChangeLog::FieldType::null,
             location ? ChangeLog::FieldType::Address : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->location = location;
         return true;
     }
@@ -129,7 +131,7 @@ bool Meeting::setLocation(const AddressPtr& location, const InternalEmployeePtr&
 bool Meeting::setMeetingStatus(const MeetingStatus status, const InternalEmployeePtr& changer)
 {
     if (this->meeting_status != status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->meeting_status),
             std::make_optional<ChangeLog::ValueVariant>(status),
@@ -137,7 +139,7 @@ bool Meeting::setMeetingStatus(const MeetingStatus status, const InternalEmploye
             ChangeLog::FieldType::MeetingStatus,
             ChangeLog::FieldType::MeetingStatus,
             ChangeLog::Action::Change
-        ));
+        );
         this->meeting_status = status;
         return true;
     }
@@ -147,22 +149,20 @@ bool Meeting::setMeetingStatus(const MeetingStatus status, const InternalEmploye
 bool Meeting::setMeetingType(const MeetingType type, const InternalEmployeePtr& changer)
 {
     if (this->meeting_type != type) {
-        bool isOtherType = !this->other_type.empty();
+        bool isOtherType = !this->other_type.view().empty();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            isOtherType ? std::make_optional<ChangeLog::ValueVariant>(
-                              std::make_shared<std::string>(this->other_type)
-                          )
+            isOtherType ? ChangeValue::fromText(this->other_type)
                         : std::make_optional<ChangeLog::ValueVariant>(this->meeting_type),
             std::make_optional<ChangeLog::ValueVariant>(type),
             MeetingFields::MeetingType,
             isOtherType ? ChangeLog::FieldType::String : ChangeLog::FieldType::MeetingType,
             ChangeLog::FieldType::MeetingType,
             ChangeLog::Action::Change
-        ));
+        );
         this->meeting_type = type;
-        this->other_type.clear();
+        this->other_type = InternedStr();
         return true;
     }
     return false;
@@ -171,7 +171,7 @@ bool Meeting::setMeetingType(const MeetingType type, const InternalEmployeePtr&
 bool Meeting::addOutcome(const MeetingOutcome outcome, const InternalEmployeePtr& changer)
 {
     if (std::find(this->outcomes.begin(), this->outcomes.end(), outcome) == this->outcomes.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(outcome),
@@ -179,7 +179,7 @@ bool Meeting::addOutcome(const MeetingOutcome outcome, const InternalEmployeePtr
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::MeetingOutcome,
             ChangeLog::Action::Add
-        ));
+        );
         this->outcomes.push_back(outcome);
         return true;
     }
@@ -189,7 +189,7 @@ bool Meeting::addOutcome(const MeetingOutcome outcome, const InternalEmployeePtr
 bool Meeting::delOutcome(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->outcomes.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->outcomes[id]),
             std::nullopt,
@@ -197,7 +197,7 @@ bool Meeting::delOutcome(const size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::MeetingOutcome,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->outcomes.erase(this->outcomes.begin() + id);
         return true;
     }
@@ -208,15 +208,15 @@ bool Meeting::addOtherOutcome(const std::string& outcome, const InternalEmployee
 {
     if (std::find(this->other_outcomes.begin(), this->other_outcomes.end(), outcome) ==
         this->other_outcomes.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(outcome)),
+            ChangeValue::fromText(outcome),
             MeetingFields::OtherOutcomes,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add
-        ));
+        );
         this->other_outcomes.push_back(outcome);
         return true;
     }
@@ -226,17 +226,15 @@ bool Meeting::addOtherOutcome(const std::string& outcome, const InternalEmployee
 bool Meeting::delOtherOutcome(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->other_outcomes.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->other_outcomes[id])
-            ),
+            ChangeValue::fromText(this->other_outcomes[id]),
             std::nullopt,
             MeetingFields::OtherOutcomes,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->other_outcomes.erase(this->other_outcomes.begin() + id);
         return true;
     }
@@ -246,21 +244,19 @@ bool Meeting::delOtherOutcome(const size_t id, const InternalEmployeePtr& change
 bool Meeting::setOtherType(const std::string& type, const InternalEmployeePtr& changer)
 {
     if (this->other_type != type) {
-        bool isOtherType = !this->other_type.empty();
+        bool isOtherType = !this->other_type.view().empty();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            isOtherType ? std::make_optional<ChangeLog::ValueVariant>(
-                              std::make_shared<std::string>(this->other_type)
-                          )
+            isOtherType ? ChangeValue::fromText(this->other_type)
                         : std::make_optional<ChangeLog::ValueVariant>(this->meeting_type),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(type)),
+            ChangeValue::fromText(type),
             MeetingFields::MeetingType,
             isOtherType ? ChangeLog::FieldType::String : ChangeLog::FieldType::MeetingType,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
-        this->other_type   = type;
+        );
+        this->other_type   = InternedStr(type);
         this->meeting_type = MeetingType::Other;
         return true;
     }
@@ -270,16 +266,15 @@ bool Meeting::setOtherType(const std::string& type, const InternalEmployeePtr& c
 bool Meeting::setRecord(const std::string& record, const InternalEmployeePtr& changer)
 {
     if (this->record != record) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->record)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(record)),
+            ChangeValue::fromText(this->record),
+            ChangeValue::fromText(record),
             MeetingFields::Record,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->record = record;
         return true;
     }
@@ -295,7 +290,7 @@ bool Meeting::addClient(const WeakClientPtr& client, const InternalEmployeePtr&
                 return !(client.owner_before(other_client) || other_client.owner_before(client));
             }
         ) == this->clients.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(client),
@@ -303,7 +298,7 @@ bool Meeting::addClient(const WeakClientPtr& client, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakClient,
             ChangeLog::Action::Add
-        ));
+        );
         this->clients.push_back(client);
         return true;
     }
@@ -313,7 +308,7 @@ bool Meeting::addClient(const WeakClientPtr& client, const InternalEmployeePtr&
 bool Meeting::delClient(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->clients.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->clients[id]),
             std::nullopt,
@@ -321,7 +316,7 @@ bool Meeting::delClient(const size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::WeakClient,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->clients.erase(this->clients.begin() + id);
         return true;
     }
@@ -339,7 +334,7 @@ bool Meeting::addEmployee(const WeakInternalEmployee& employee, const InternalEm
                 );
             }
         ) == this->employees.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(employee),
@@ -347,7 +342,7 @@ bool Meeting::addEmployee(const WeakInternalEmployee& employee, const InternalEm
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakInternalEmployee,
             ChangeLog::Action::Add
-        ));
+        );
         this->employees.push_back(employee);
         return true;
     }
@@ -357,7 +352,7 @@ bool Meeting::addEmployee(const WeakInternalEmployee& employee, const InternalEm
 bool Meeting::delEmployee(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->employees.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->employees[id]),
             std::nullopt,
@@ -365,7 +360,7 @@ bool Meeting::delEmployee(const size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::WeakInternalEmployee,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->employees.erase(this->employees.begin() + id);
         return true;
     }
@@ -383,7 +378,7 @@ bool Meeting::addInvitee(const WeakPersonPtr& invitee, const InternalEmployeePtr
                 );
             }
         ) == this->invitees.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(invitee),
@@ -391,7 +386,7 @@ bool Meeting::addInvitee(const WeakPersonPtr& invitee, const InternalEmployeePtr
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakPerson,
             ChangeLog::Action::Add
-        ));
+        );
         this->invitees.push_back(invitee);
         return true;
     }
@@ -401,7 +396,7 @@ bool Meeting::addInvitee(const WeakPersonPtr& invitee, const InternalEmployeePtr
 bool Meeting::delInvitee(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->invitees.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->invitees[id]),
             std::nullopt,
@@ -409,7 +404,7 @@ bool Meeting::delInvitee(const size_t id, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::WeakPerson,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->invitees.erase(this->invitees.begin() + id);
         return true;
     }
@@ -419,7 +414,7 @@ bool Meeting::delInvitee(const size_t id, const InternalEmployeePtr& changer)
 bool Meeting::setPreviousMeeting(const MeetingPtr& meeting, const InternalEmployeePtr& changer)
 {
     if (this->previous_meeting != meeting) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->previous_meeting),
             PTR_TO_OPTIONAL(meeting),
@@ -427,7 +422,7 @@ bool Meeting::setPreviousMeeting(const MeetingPtr& meeting, const InternalEmploy
             this->previous_meeting ? ChangeLog::FieldType::Meeting : ChangeLog::FieldType::null,
             meeting ? ChangeLog::FieldType::Meeting : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->previous_meeting = meeting;
         return true;
     }
@@ -437,7 +432,7 @@ bool Meeting::setPreviousMeeting(const MeetingPtr& meeting, const InternalEmploy
 bool Meeting::setNextMeeting(const MeetingPtr& meeting, const InternalEmployeePtr& changer)
 {
     if (this->next_meeting != meeting) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->next_meeting),
             PTR_TO_OPTIONAL(meeting),
@@ -445,7 +440,7 @@ bool Meeting::setNextMeeting(const MeetingPtr& meeting, const InternalEmployeePt
             this->next_meeting ? ChangeLog::FieldType::Meeting : ChangeLog::FieldType::null,
             meeting ? ChangeLog::FieldType::Meeting : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->next_meeting = meeting;
         return true;
     }
@@ -455,7 +450,7 @@ bool Meeting::setNextMeeting(const MeetingPtr& meeting, const InternalEmployeePt
 bool Meeting::setIsConfirmed(bool is_confirmed, const InternalEmployeePtr& changer)
 {
     if (this->is_confirmed != is_confirmed) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->is_confirmed),
             std::make_optional<ChangeLog::ValueVariant>(is_confirmed),
@@ -463,7 +458,7 @@ bool Meeting::setIsConfirmed(bool is_confirmed, const InternalEmployeePtr& chang
             ChangeLog::FieldType::Bool,
             ChangeLog::FieldType::Bool,
             ChangeLog::Action::Change
-        ));
+        );
         this->is_confirmed = is_confirmed;
         return true;
     }
@@ -473,7 +468,7 @@ bool Meeting::setIsConfirmed(bool is_confirmed, const InternalEmployeePtr& chang
 bool Meeting::setIsVirtual(bool is_virtual, const InternalEmployeePtr& changer)
 {
     if (this->is_virtual != is_virtual) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->is_virtual),
             std::make_optional<ChangeLog::ValueVariant>(is_virtual),
@@ -481,7 +476,7 @@ bool Meeting::setIsVirtual(bool is_virtual, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Bool,
             ChangeLog::FieldType::Bool,
             ChangeLog::Action::Change
-        ));
+        );
         this->is_virtual = is_virtual;
         return true;
     }
@@ -39,8 +39,8 @@ struct Meeting : public BaseInteraction {
         const std::optional<TimeDuration>& interaction_duration,
         const Priority&                    priority,
         const WeakInternalEmployee&        manager,
-        const DatePtr&                     start_date,
-        const DatePtr&                     end_date,
+        const OptionalDate&                start_date,
+        const OptionalDate&                end_date,
         const WeakInternalEmployee&        checker,
         const InteractionType&             type,
         std::vector<std::string>           tags,
@@ -75,7 +75,7 @@ public:
     auto getMeetingType() const -> MeetingType;
     auto getOutcomes() const -> const std::vector<MeetingOutcome>&;
     auto getOtherOutcomes() const -> const std::vector<std::string>&;
-    auto getOtherType() const -> const std::string&;
+    auto getOtherType() const -> const InternedStr&;
     auto getRecord() const -> const std::string&;
     auto getClients() const -> const std::vector<WeakClientPtr>&;
     auto getEmployees() const -> const std::vector<WeakInternalEmployee>&;
@@ -126,7 +126,7 @@ private:
     std::vector<MeetingOutcome>       outcomes;
     std::vector<std::string>          other_outcomes;
 
-    std::string                       other_type;
+    InternedStr                       other_type;
 
     std::string                       record;
 
@@ -1,6 +1,8 @@
 #include "meeting_thread.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 
 MeetingThread::MeetingThread(const BigUint& id)
     : BaseInteraction(id, InteractionType::meetingThread)
@@ -16,8 +18,8 @@ MeetingThread::MeetingThread(
     const std::optional<TimeDuration>& interaction_duration,
     const Priority&                    priority,
     const WeakInternalEmployee&        manager,
-    const DatePtr&                     start_date,
-    const DatePtr&                     end_date,
+    const OptionalDate&                start_date,
+    const OptionalDate&                end_date,
     const WeakInternalEmployee&        checker,
     const InteractionType&             type,
     std::vector<std::string>           tags,
@@ -70,7 +72,7 @@ auto MeetingThread::getEmployees() const -> const std::vector<WeakInternalEmploy
 bool MeetingThread::addMeeting(const MeetingPtr& meeting, const InternalEmployeePtr& changer)
 {
     if (std::find(this->meetings.begin(), this->meetings.end(), meeting) == this->meetings.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(meeting),
@@ -78,7 +80,7 @@ bool MeetingThread::addMeeting(const MeetingPtr& meeting, const InternalEmployee
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Meeting,
             ChangeLog::Action::Add
-        ));
+        );
         this->meetings.push_back(meeting);
         return true;
     }
@@ -88,7 +90,7 @@ bool MeetingThread::addMeeting(const MeetingPtr& meeting, const InternalEmployee
 bool MeetingThread::delMeeting(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->meetings.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->meetings[id]),
             std::nullopt,
@@ -96,7 +98,7 @@ bool MeetingThread::delMeeting(const size_t id, const InternalEmployeePtr& chang
             ChangeLog::FieldType::Meeting,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->meetings.erase(this->meetings.begin() + id);
         return true;
     }
@@ -112,7 +114,7 @@ bool MeetingThread::addClient(const WeakClientPtr& client, const InternalEmploye
                 return !(client.owner_before(other_client) || other_client.owner_before(client));
             }
         ) == this->clients.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(client),
@@ -120,7 +122,7 @@ bool MeetingThread::addClient(const WeakClientPtr& client, const InternalEmploye
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakClient,
             ChangeLog::Action::Add
-        ));
+        );
         this->clients.push_back(client);
         return true;
     }
@@ -130,7 +132,7 @@ bool MeetingThread::addClient(const WeakClientPtr& client, const InternalEmploye
 bool MeetingThread::delClient(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->clients.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->clients[id]),
             std::nullopt,
@@ -138,7 +140,7 @@ bool MeetingThread::delClient(const size_t id, const InternalEmployeePtr& change
             ChangeLog::FieldType::WeakClient,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->clients.erase(this->clients.begin() + id);
         return true;
     }
@@ -158,7 +160,7 @@ bool MeetingThread::addEmployee(
                 );
             }
         ) == this->employees.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(employee),
@@ -166,7 +168,7 @@ bool MeetingThread::addEmployee(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakInternalEmployee,
             ChangeLog::Action::Add
-        ));
+        );
         this->employees.push_back(employee);
         return true;
     }
@@ -176,7 +178,7 @@ bool MeetingThread::addEmployee(
 bool MeetingThread::delEmployee(const size_t id, const InternalEmployeePtr& changer)
 {
     if (this->employees.size() > id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->employees[id]),
             std::nullopt,
@@ -184,7 +186,7 @@ bool MeetingThread::delEmployee(const size_t id, const InternalEmployeePtr& chan
             ChangeLog::FieldType::WeakInternalEmployee,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->employees.erase(this->employees.begin() + id);
         return true;
     }
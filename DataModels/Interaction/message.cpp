@@ -1,6 +1,6 @@
 #include "message.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_journal.hpp"
 
 Message::Message(const BigUint& id) : BaseInteraction(id, InteractionType::message) {}
 
@@ -13,8 +13,8 @@ Message::Message(
     const std::optional<TimeDuration>& interaction_duration,
     const Priority&                    priority,
     const WeakInternalEmployee&        manager,
-    const DatePtr&                     start_date,
-    const DatePtr&                     end_date,
+    const OptionalDate&                start_date,
+    const OptionalDate&                end_date,
     const WeakInternalEmployee&        checker,
     const InteractionType&             type,
     std::vector<std::string>           tags,
@@ -68,16 +68,15 @@ auto Message::getDateSending() const -> const Date& { return date_sending; }
 bool Message::setNickname(const std::string& nickname, const InternalEmployeePtr& changer)
 {
     if (this->nickname != nickname) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->nickname
-            )),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(nickname)),
+            ChangeValue::fromText(this->nickname),
+            ChangeValue::fromText(nickname),
             MessageFields::Nickname,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->nickname = nickname;
         return true;
     }
@@ -87,7 +86,7 @@ bool Message::setNickname(const std::string& nickname, const InternalEmployeePtr
 bool Message::setAuthor(const WeakPersonPtr& author, const InternalEmployeePtr& changer)
 {
     if (this->author.owner_before(author) || author.owner_before(this->author)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->author),
             WEAK_PTR_TO_OPTIONAL(author),
@@ -95,7 +94,7 @@ bool Message::setAuthor(const WeakPersonPtr& author, const InternalEmployeePtr&
             !this->author.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             !author.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->author = author;
         return true;
     }
@@ -105,16 +104,15 @@ bool Message::setAuthor(const WeakPersonPtr& author, const InternalEmployeePtr&
 bool Message::setMessage(const std::string& message, const InternalEmployeePtr& changer)
 {
     if (this->message != message) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->message)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(message)),
+            ChangeValue::fromText(this->message),
+            ChangeValue::fromText(message),
             MessageFields::Message,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->message = message;
         return true;
     }
@@ -124,16 +122,15 @@ bool Message::setMessage(const std::string& message, const InternalEmployeePtr&
 bool Message::setPlatform(const std::string& platform, const InternalEmployeePtr& changer)
 {
     if (this->platform != platform) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(this->platform
-            )),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(platform)),
+            ChangeValue::fromText(this->platform),
+            ChangeValue::fromText(platform),
             MessageFields::Platform,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->platform = platform;
         return true;
     }
@@ -143,15 +140,15 @@ bool Message::setPlatform(const std::string& platform, const InternalEmployeePtr
 bool Message::setDateSending(const Date& date, const InternalEmployeePtr& changer)
 {
     if (this->date_sending != date) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Date>(this->date_sending)),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Date>(date)),
+            std::make_optional<ChangeLog::ValueVariant>(this->date_sending),
+            std::make_optional<ChangeLog::ValueVariant>(date),
             MessageFields::DateSending,
             ChangeLog::FieldType::Date,
             ChangeLog::FieldType::Date,
             ChangeLog::Action::Change
-        ));
+        );
         this->date_sending = date;
         return true;
     }
@@ -1,6 +1,6 @@
 #include "phone_call_data.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_journal.hpp"
 
 PhoneCallData::PhoneCallData(const BigUint& id) : BaseInteraction(id, InteractionType::phoneCall) {}
 
@@ -13,8 +13,8 @@ PhoneCallData::PhoneCallData(
     const std::optional<TimeDuration>& interaction_duration,
     const Priority&                    priority,
     const WeakInternalEmployee&        manager,
-    const DatePtr&                     start_date,
-    const DatePtr&                     end_date,
+    const OptionalDate&                start_date,
+    const OptionalDate&                end_date,
     const WeakInternalEmployee&        checker,
     const InteractionType&             type,
     std::vector<std::string>           tags,
@@ -26,8 +26,8 @@ PhoneCallData::PhoneCallData(
     std::vector<WeakPersonPtr>         participants,
     const PhoneNumberPtr&              from_number,
     const PhoneNumberPtr&              to_number,
-    const DatePtr&                     start_call,
-    const DatePtr&                     end_call,
+    const OptionalDate&                start_call,
+    const OptionalDate&                end_call,
     const WeakPersonPtr&               call_creator,
     const std::string&                 call_provider,
     const std::optional<CallType>&     call_type
@@ -65,8 +65,8 @@ PhoneCallData::PhoneCallData(
 
 auto PhoneCallData::getFromNumber() const -> const PhoneNumberPtr { return this->from_number; }
 auto PhoneCallData::getToNumber() const -> const PhoneNumberPtr { return this->to_number; }
-auto PhoneCallData::getStartCall() const -> const DatePtr { return this->start_call; }
-auto PhoneCallData::getEndCall() const -> const DatePtr { return this->end_call; }
+auto PhoneCallData::getStartCall() const -> const OptionalDate { return this->start_call; }
+auto PhoneCallData::getEndCall() const -> const OptionalDate { return this->end_call; }
 auto PhoneCallData::getCallType() const -> const std::optional<CallType> { return this->call_type; }
 auto PhoneCallData::getCallCreator() const -> const WeakPersonPtr& { return this->call_creator; }
 auto PhoneCallData::getCallProvider() const -> const std::string& { return this->call_provider; }
@@ -74,7 +74,7 @@ auto PhoneCallData::getCallProvider() const -> const std::string& { return this-
 bool PhoneCallData::setFromNumber(const PhoneNumberPtr& number, const InternalEmployeePtr& changer)
 {
     if (this->from_number != number) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->from_number),
             PTR_TO_OPTIONAL(number),
@@ -82,7 +82,7 @@ bool PhoneCallData::setFromNumber(const PhoneNumberPtr& number, const InternalEm
             this->from_number ? ChangeLog::FieldType::PhoneNumber : ChangeLog::FieldType::null,
             number ? ChangeLog::FieldType::PhoneNumber : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->from_number = number;
         return true;
     }
@@ -92,7 +92,7 @@ bool PhoneCallData::setFromNumber(const PhoneNumberPtr& number, const InternalEm
 bool PhoneCallData::setToNumber(const PhoneNumberPtr& number, const InternalEmployeePtr& changer)
 {
     if (this->to_number != number) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->to_number),
             PTR_TO_OPTIONAL(number),
@@ -100,55 +100,43 @@ bool PhoneCallData::setToNumber(const PhoneNumberPtr& number, const InternalEmpl
             this->to_number ? ChangeLog::FieldType::PhoneNumber : ChangeLog::FieldType::null,
             number ? ChangeLog::FieldType::PhoneNumber : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->to_number = number;
         return true;
     }
     return false;
 }
 
-bool PhoneCallData::setStartCall(const DatePtr& start, const InternalEmployeePtr& changer)
+bool PhoneCallData::setStartCall(const OptionalDate& start, const InternalEmployeePtr& changer)
 {
-    if (this->start_call == nullptr || start == nullptr) {
-        if (this->start_call == start) {
-            return false;
-        }
-    } else if (*this->start_call == *start) {
-        return false;
-    }
+    if (this->start_call == start) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->start_call),
-        PTR_TO_OPTIONAL(start),
+        OPTIONAL_TO_VALUE(this->start_call),
+        OPTIONAL_TO_VALUE(start),
         PhoneCallFields::StartCall,
         this->start_call ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         start ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->start_call = start;
     return true;
 }
 
-bool PhoneCallData::setEndCall(const DatePtr& end, const InternalEmployeePtr& changer)
+bool PhoneCallData::setEndCall(const OptionalDate& end, const InternalEmployeePtr& changer)
 {
-    if (this->end_call == nullptr || end == nullptr) {
-        if (this->end_call == end) {
-            return false;
-        }
-    } else if (*this->end_call == *end) {
-        return false;
-    }
+    if (this->end_call == end) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->end_call),
-        PTR_TO_OPTIONAL(end),
+        OPTIONAL_TO_VALUE(this->end_call),
+        OPTIONAL_TO_VALUE(end),
         PhoneCallFields::EndCall,
         this->end_call ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         end ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->end_call = end;
     return true;
 }
@@ -158,7 +146,7 @@ bool PhoneCallData::setCallType(
 )
 {
     if (this->call_type != type) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->call_type ? std::make_optional<ChangeLog::ValueVariant>(this->call_type.value())
                             : std::nullopt,
@@ -167,7 +155,7 @@ bool PhoneCallData::setCallType(
             this->call_type ? ChangeLog::FieldType::CallType : ChangeLog::FieldType::null,
             type ? ChangeLog::FieldType::CallType : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->call_type = type;
         return true;
     }
@@ -177,7 +165,7 @@ bool PhoneCallData::setCallType(
 bool PhoneCallData::setCallCreator(const WeakPersonPtr& creator, const InternalEmployeePtr& changer)
 {
     if (this->call_creator.owner_before(creator) || creator.owner_before(this->call_creator)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->call_creator),
             WEAK_PTR_TO_OPTIONAL(creator),
@@ -186,7 +174,7 @@ bool PhoneCallData::setCallCreator(const WeakPersonPtr& creator, const InternalE
                                           : ChangeLog::FieldType::null,
             !creator.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->call_creator = creator;
         return true;
     }
@@ -196,17 +184,15 @@ bool PhoneCallData::setCallCreator(const WeakPersonPtr& creator, const InternalE
 bool PhoneCallData::setCallProvider(const std::string& provider, const InternalEmployeePtr& changer)
 {
     if (this->call_provider != provider) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->call_provider)
-            ),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(provider)),
+            ChangeValue::fromText(this->call_provider),
+            ChangeValue::fromText(provider),
             PhoneCallFields::CallProvider,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->call_provider = provider;
         return true;
     }
@@ -15,8 +15,8 @@ struct PhoneCallData : public BaseInteraction {
         const std::optional<TimeDuration>& interaction_duration,
         const Priority&                    priority,
         const WeakInternalEmployee&        manager,
-        const DatePtr&                     start_date,
-        const DatePtr&                     end_date,
+        const OptionalDate&                start_date,
+        const OptionalDate&                end_date,
         const WeakInternalEmployee&        checker,
         const InteractionType&             type,
         std::vector<std::string>           tags,
@@ -28,8 +28,8 @@ struct PhoneCallData : public BaseInteraction {
         std::vector<WeakPersonPtr>         participants,
         const PhoneNumberPtr&              from_number,
         const PhoneNumberPtr&              to_number,
-        const DatePtr&                     start_call,
-        const DatePtr&                     end_call,
+        const OptionalDate&                start_call,
+        const OptionalDate&                end_call,
         const WeakPersonPtr&               call_creator,
         const std::string&                 call_provider,
         const std::optional<CallType>&     call_type
@@ -38,8 +38,8 @@ struct PhoneCallData : public BaseInteraction {
     /// @{
     auto getFromNumber() const -> const PhoneNumberPtr;
     auto getToNumber() const -> const PhoneNumberPtr;
-    auto getStartCall() const -> const DatePtr;
-    auto getEndCall() const -> const DatePtr;
+    auto getStartCall() const -> const OptionalDate;
+    auto getEndCall() const -> const OptionalDate;
     auto getCallType() const -> const std::optional<CallType>;
     auto getCallCreator() const -> const WeakPersonPtr&;
     auto getCallProvider() const -> const std::string&;
@@ -49,8 +49,8 @@ struct PhoneCallData : public BaseInteraction {
     /// @{
     bool setFromNumber(const PhoneNumberPtr& number, const InternalEmployeePtr& changer);
     bool setToNumber(const PhoneNumberPtr& number, const InternalEmployeePtr& changer);
-    bool setStartCall(const DatePtr& start, const InternalEmployeePtr& changer);
-    bool setEndCall(const DatePtr& end, const InternalEmployeePtr& changer);
+    bool setStartCall(const OptionalDate& start, const InternalEmployeePtr& changer);
+    bool setEndCall(const OptionalDate& end, const InternalEmployeePtr& changer);
     bool setCallType(const std::optional<CallType>& type, const InternalEmployeePtr& changer);
     bool setCallCreator(const WeakPersonPtr& creator, const InternalEmployeePtr& changer);
     bool setCallProvider(const std::string& provider, const InternalEmployeePtr& changer);
@@ -60,8 +60,8 @@ private:
     PhoneNumberPtr          from_number;  ///< Phone number that initiated the call
     PhoneNumberPtr          to_number;    ///< Phone number that received the call
 
-    DatePtr                 start_call;  ///< Date and time when the call started
-    DatePtr                 end_call;    ///< Date and time when the call ended
+    OptionalDate            start_call;  ///< Date and time when the call started
+    OptionalDate            end_call;    ///< Date and time when the call ended
 
     WeakPersonPtr           call_creator;  ///< Person who created or initiated the call
 
@@ -1,23 +1,20 @@
 #pragma once
 #include <stdint.h>
 
+#include "Usings/enum_strings.hpp"
 #include "location.hpp"
 
 enum class Priority : uint8_t { Low, Medium, High, Critical, null, COUNT };
 
-inline std::string priorityToStr(const Priority priority)
+template <>
+struct EnumStrings<Priority> {
+    static constexpr auto names = std::to_array<std::string_view>({
+        priority_str::low, priority_str::medium, priority_str::high, priority_str::critical,
+        priority_str::null
+    });
+};
+
+constexpr auto priorityToStr(const Priority priority) -> std::string_view
 {
-    switch (priority) {
-        case Priority::Low:
-            return priority_str::low;
-        case Priority::Medium:
-            return priority_str::medium;
-        case Priority::High:
-            return priority_str::high;
-        case Priority::Critical:
-            return priority_str::critical;
-        case Priority::null:
-            return priority_str::null;
-    }
-    return std::string();
+    return enumToStr(priority);
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "payment.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 #include "Deal/deal.hpp"
 
 Payment::Payment(const BigUint& id) : id(id), status(PaymentStatus::pending) {}
@@ -12,9 +14,9 @@ Payment::Payment(
     const MoneyPtr&             received_amount,
     const MoneyPtr&             tax_amount,
     const Currencies&           currency,
-    const DatePtr&              sending_date,
-    const DatePtr&              received_date,
-    const DatePtr&              creation_date,
+    const OptionalDate&         sending_date,
+    const OptionalDate&         received_date,
+    const OptionalDate&         creation_date,
     const PaymentStatus&        status,
     const OptionalStr&          payment_method,
     const WeakDealPtr&          deal,
@@ -57,9 +59,9 @@ auto Payment::getSendingAmount() const -> const MoneyPtr& { return this->sending
 auto Payment::getReceivedAmount() const -> const MoneyPtr& { return this->received_amount; }
 auto Payment::getTaxAmount() const -> const MoneyPtr& { return this->tax_amount; }
 auto Payment::getCurrency() const -> const Currencies& { return this->currency; }
-auto Payment::getSendingDate() const -> const DatePtr& { return this->sending_date; }
-auto Payment::getReceivedDate() const -> const DatePtr& { return this->received_date; }
-auto Payment::getCreationDate() const -> const DatePtr& { return this->creation_date; }
+auto Payment::getSendingDate() const -> const OptionalDate& { return this->sending_date; }
+auto Payment::getReceivedDate() const -> const OptionalDate& { return this->received_date; }
+auto Payment::getCreationDate() const -> const OptionalDate& { return this->creation_date; }
 auto Payment::getPaymentStatus() const -> PaymentStatus { return this->status; }
 auto Payment::getPaymentMethod() const -> const OptionalStr& { return this->payment_method; }
 auto Payment::getDeal() const -> const WeakDealPtr& { return this->deal; }
@@ -71,9 +73,9 @@ auto Payment::getDocuments() const -> const std::vector<DocumentPtr>& { return t
 auto Payment::getComments() const -> const std::vector<std::string>& { return this->comments; }
 auto Payment::getPaymentPurpose() const -> const OptionalStr& { return this->payment_purpose; }
 auto Payment::getCreatedBy() const -> const WeakInternalEmployee& { return this->created_by; }
-auto Payment::getChangeLogs() const -> const std::vector<ChangeLogPtr>&
+auto Payment::getChangeLogs() const -> ChangeLogView
 {
-    return this->change_logs;
+    return ChangeLogView(this->change_logs);
 }
 
 bool Payment::setRequestedAmount(
@@ -88,7 +90,7 @@ bool Payment::setRequestedAmount(
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->requested_amount),
         PTR_TO_OPTIONAL(requested_amount),
@@ -96,7 +98,7 @@ bool Payment::setRequestedAmount(
         this->requested_amount ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         requested_amount ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->requested_amount = requested_amount;
     return true;
 }
@@ -111,7 +113,7 @@ bool Payment::setSendingAmount(const MoneyPtr& sending_amount, const InternalEmp
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->sending_amount),
         PTR_TO_OPTIONAL(sending_amount),
@@ -119,7 +121,7 @@ bool Payment::setSendingAmount(const MoneyPtr& sending_amount, const InternalEmp
         this->sending_amount ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         sending_amount ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->sending_amount = sending_amount;
     return true;
 }
@@ -134,7 +136,7 @@ bool Payment::setReceivedAmount(const MoneyPtr& received_amount, const InternalE
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->received_amount),
         PTR_TO_OPTIONAL(received_amount),
@@ -142,7 +144,7 @@ bool Payment::setReceivedAmount(const MoneyPtr& received_amount, const InternalE
         this->received_amount ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         received_amount ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->received_amount = received_amount;
     return true;
 }
@@ -157,7 +159,7 @@ bool Payment::setTaxAmount(const MoneyPtr& tax_amount, const InternalEmployeePtr
         return false;
     }
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->tax_amount),
         PTR_TO_OPTIONAL(tax_amount),
@@ -165,7 +167,7 @@ bool Payment::setTaxAmount(const MoneyPtr& tax_amount, const InternalEmployeePtr
         this->tax_amount ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         tax_amount ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->tax_amount = tax_amount;
     return true;
 }
@@ -173,7 +175,7 @@ bool Payment::setTaxAmount(const MoneyPtr& tax_amount, const InternalEmployeePtr
 bool Payment::setCurrency(const Currencies& currency, const InternalEmployeePtr& changer)
 {
     if (this->currency != currency) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->currency),
             std::make_optional<ChangeLog::ValueVariant>(currency),
@@ -181,78 +183,60 @@ bool Payment::setCurrency(const Currencies& currency, const InternalEmployeePtr&
             ChangeLog::FieldType::Currencies,
             ChangeLog::FieldType::Currencies,
             ChangeLog::Action::Change
-        ));
+        );
         this->currency = currency;
         return true;
     }
     return false;
 }
 
-bool Payment::setSendingDate(const DatePtr& sending_date, const InternalEmployeePtr& changer)
+bool Payment::setSendingDate(const OptionalDate& sending_date, const InternalEmployeePtr& changer)
 {
-    if (this->sending_date == nullptr || sending_date == nullptr) {
-        if (this->sending_date == sending_date) {
-            return false;
-        }
-    } else if (*this->sending_date == *sending_date) {
-        return false;
-    }
+    if (this->sending_date == sending_date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->sending_date),
-        PTR_TO_OPTIONAL(sending_date),
+        OPTIONAL_TO_VALUE(this->sending_date),
+        OPTIONAL_TO_VALUE(sending_date),
         PaymentFields::SendingDate,
         this->sending_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         sending_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->sending_date = sending_date;
     return true;
 }
 
-bool Payment::setReceivedDate(const DatePtr& received_date, const InternalEmployeePtr& changer)
+bool Payment::setReceivedDate(const OptionalDate& received_date, const InternalEmployeePtr& changer)
 {
-    if (this->received_date == nullptr || received_date == nullptr) {
-        if (this->received_date == received_date) {
-            return false;
-        }
-    } else if (*this->received_date == *received_date) {
-        return false;
-    }
+    if (this->received_date == received_date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->received_date),
-        PTR_TO_OPTIONAL(received_date),
+        OPTIONAL_TO_VALUE(this->received_date),
+        OPTIONAL_TO_VALUE(received_date),
         PaymentFields::ReceivedDate,
         this->received_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         received_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->received_date = received_date;
     return true;
 }
 
-bool Payment::setCreationDate(const DatePtr& creation_date, const InternalEmployeePtr& changer)
+bool Payment::setCreationDate(const OptionalDate& creation_date, const InternalEmployeePtr& changer)
 {
-    if (this->creation_date == nullptr || creation_date == nullptr) {
-        if (this->creation_date == creation_date) {
-            return false;
-        }
-    } else if (*this->creation_date == *creation_date) {
-        return false;
-    }
+    if (this->creation_date == creation_date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->creation_date),
-        PTR_TO_OPTIONAL(creation_date),
+        OPTIONAL_TO_VALUE(this->creation_date),
+        OPTIONAL_TO_VALUE(creation_date),
         PaymentFields::CreationDate,
         this->creation_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         creation_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->creation_date = creation_date;
     return true;
 }
@@ -260,7 +244,7 @@ bool Payment::setCreationDate(const DatePtr& creation_date, const InternalEmploy
 bool Payment::setPaymentStatus(const PaymentStatus status, const InternalEmployeePtr& changer)
 {
     if (this->status != status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->status),
             std::make_optional<ChangeLog::ValueVariant>(status),
@@ -268,7 +252,7 @@ bool Payment::setPaymentStatus(const PaymentStatus status, const InternalEmploye
             ChangeLog::FieldType::PaymentStatus,
             ChangeLog::FieldType::PaymentStatus,
             ChangeLog::Action::Change
-        ));
+        );
         this->status = status;
         return true;
     }
@@ -280,7 +264,7 @@ bool Payment::setPaymentMethod(
 )
 {
     if (this->payment_method != payment_method) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->payment_method),
             OPTIONAL_STR_TO_VALUE(payment_method),
@@ -288,7 +272,7 @@ bool Payment::setPaymentMethod(
             this->payment_method ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             payment_method ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->payment_method = payment_method;
         return true;
     }
@@ -298,7 +282,7 @@ bool Payment::setPaymentMethod(
 bool Payment::setDeal(const WeakDealPtr& deal, const InternalEmployeePtr& changer)
 {
     if (this->deal.owner_before(deal) || deal.owner_before(this->deal)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->deal),
             WEAK_PTR_TO_OPTIONAL(deal),
@@ -306,7 +290,7 @@ bool Payment::setDeal(const WeakDealPtr& deal, const InternalEmployeePtr& change
             !this->deal.expired() ? ChangeLog::FieldType::WeakDeal : ChangeLog::FieldType::null,
             !deal.expired() ? ChangeLog::FieldType::WeakDeal : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->deal = deal;
         return true;
     }
@@ -316,7 +300,7 @@ bool Payment::setDeal(const WeakDealPtr& deal, const InternalEmployeePtr& change
 bool Payment::setPayer(const WeakPersonPtr& payer, const InternalEmployeePtr& changer)
 {
     if (this->payer.owner_before(payer) || payer.owner_before(this->payer)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->payer),
             WEAK_PTR_TO_OPTIONAL(payer),
@@ -324,7 +308,7 @@ bool Payment::setPayer(const WeakPersonPtr& payer, const InternalEmployeePtr& ch
             !this->payer.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             !payer.expired() ? ChangeLog::FieldType::WeakPerson : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->payer = payer;
         return true;
     }
@@ -334,7 +318,7 @@ bool Payment::setPayer(const WeakPersonPtr& payer, const InternalEmployeePtr& ch
 bool Payment::setPayerCompany(const CompanyPtr& payer_company, const InternalEmployeePtr& changer)
 {
     if (this->payer_company != payer_company) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->payer_company),
             PTR_TO_OPTIONAL(payer_company),
@@ -342,7 +326,7 @@ bool Payment::setPayerCompany(const CompanyPtr& payer_company, const InternalEmp
             this->payer_company ? ChangeLog::FieldType::Company : ChangeLog::FieldType::null,
             payer_company ? ChangeLog::FieldType::Company : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->payer_company = payer_company;
         return true;
     }
@@ -354,7 +338,7 @@ bool Payment::setInvoiceNumber(
 )
 {
     if (this->invoice_number != invoice_number) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->invoice_number),
             OPTIONAL_STR_TO_VALUE(invoice_number),
@@ -362,7 +346,7 @@ bool Payment::setInvoiceNumber(
             this->invoice_number ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             invoice_number ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->invoice_number = invoice_number;
         return true;
     }
@@ -374,7 +358,7 @@ bool Payment::setTransactionId(
 )
 {
     if (this->transaction_id != transaction_id) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->transaction_id),
             OPTIONAL_STR_TO_VALUE(transaction_id),
@@ -382,7 +366,7 @@ bool Payment::setTransactionId(
             this->transaction_id ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             transaction_id ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->transaction_id = transaction_id;
         return true;
     }
@@ -393,7 +377,7 @@ bool Payment::addDocument(const DocumentPtr& document, const InternalEmployeePtr
 {
     if (std::find(this->documents.begin(), this->documents.end(), document) ==
         this->documents.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(document),
@@ -401,7 +385,7 @@ bool Payment::addDocument(const DocumentPtr& document, const InternalEmployeePtr
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Document,
             ChangeLog::Action::Add
-        ));
+        );
         this->documents.push_back(document);
         return true;
     }
@@ -411,7 +395,7 @@ bool Payment::addDocument(const DocumentPtr& document, const InternalEmployeePtr
 bool Payment::delDocument(size_t index, const InternalEmployeePtr& changer)
 {
     if (index < this->documents.size()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->documents[index]),
             std::nullopt,
@@ -419,7 +403,7 @@ bool Payment::delDocument(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Document,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->documents.erase(this->documents.begin() + index);
         return true;
     }
@@ -429,15 +413,15 @@ bool Payment::delDocument(size_t index, const InternalEmployeePtr& changer)
 bool Payment::addComment(const std::string& comment, const InternalEmployeePtr& changer)
 {
     if (std::find(this->comments.begin(), this->comments.end(), comment) == this->comments.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(comment)),
+            ChangeValue::fromText(comment),
             PaymentFields::Comments,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add
-        ));
+        );
         this->comments.push_back(comment);
         return true;
     }
@@ -447,17 +431,15 @@ bool Payment::addComment(const std::string& comment, const InternalEmployeePtr&
 bool Payment::delComment(size_t index, const InternalEmployeePtr& changer)
 {
     if (index < this->comments.size()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->comments[index])
-            ),
+            ChangeValue::fromText(this->comments[index]),
             std::nullopt,
             PaymentFields::Comments,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->comments.erase(this->comments.begin() + index);
         return true;
     }
@@ -469,7 +451,7 @@ bool Payment::setPaymentPurpose(
 )
 {
     if (this->payment_purpose != payment_purpose) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->payment_purpose),
             OPTIONAL_STR_TO_VALUE(payment_purpose),
@@ -477,7 +459,7 @@ bool Payment::setPaymentPurpose(
             this->payment_purpose ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             payment_purpose ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->payment_purpose = payment_purpose;
         return true;
     }
@@ -489,7 +471,7 @@ bool Payment::setCreatedBy(
 )
 {
     if (this->created_by.owner_before(created_by) || created_by.owner_before(this->created_by)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->created_by),
             WEAK_PTR_TO_OPTIONAL(created_by),
@@ -499,7 +481,7 @@ bool Payment::setCreatedBy(
             !created_by.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                   : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->created_by = created_by;
         return true;
     }
@@ -1,6 +1,7 @@
 #pragma once
 #include "BigNum/big_uint.hpp"
 #include "BigNum/money.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "Company/company.hpp"
 #include "Currencies/currencies.hpp"
 #include "DateTime/date.hpp"
@@ -27,9 +28,9 @@ struct Payment {
         const MoneyPtr&             received_amount,
         const MoneyPtr&             tax_amount,
         const Currencies&           currency,
-        const DatePtr&              sending_date,
-        const DatePtr&              received_date,
-        const DatePtr&              creation_date,
+        const OptionalDate&         sending_date,
+        const OptionalDate&         received_date,
+        const OptionalDate&         creation_date,
         const PaymentStatus&        status,
         const OptionalStr&          payment_method,
         const WeakDealPtr&          deal,
@@ -51,9 +52,9 @@ struct Payment {
     auto getReceivedAmount() const -> const MoneyPtr&;
     auto getTaxAmount() const -> const MoneyPtr&;
     auto getCurrency() const -> const Currencies&;
-    auto getSendingDate() const -> const DatePtr&;
-    auto getReceivedDate() const -> const DatePtr&;
-    auto getCreationDate() const -> const DatePtr&;
+    auto getSendingDate() const -> const OptionalDate&;
+    auto getReceivedDate() const -> const OptionalDate&;
+    auto getCreationDate() const -> const OptionalDate&;
     auto getPaymentStatus() const -> PaymentStatus;
     auto getPaymentMethod() const -> const OptionalStr&;
     auto getDeal() const -> const WeakDealPtr&;
@@ -65,7 +66,7 @@ struct Payment {
     auto getComments() const -> const std::vector<std::string>&;
     auto getPaymentPurpose() const -> const OptionalStr&;
     auto getCreatedBy() const -> const WeakInternalEmployee&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
     /// @}
 
     /// @name Change functions
@@ -75,9 +76,9 @@ struct Payment {
     bool setReceivedAmount(const MoneyPtr& received_amount, const InternalEmployeePtr& changer);
     bool setTaxAmount(const MoneyPtr& tax_amount, const InternalEmployeePtr& changer);
     bool setCurrency(const Currencies& currency, const InternalEmployeePtr& changer);
-    bool setSendingDate(const DatePtr& sending_date, const InternalEmployeePtr& changer);
-    bool setReceivedDate(const DatePtr& received_date, const InternalEmployeePtr& changer);
-    bool setCreationDate(const DatePtr& creation_date, const InternalEmployeePtr& changer);
+    bool setSendingDate(const OptionalDate& sending_date, const InternalEmployeePtr& changer);
+    bool setReceivedDate(const OptionalDate& received_date, const InternalEmployeePtr& changer);
+    bool setCreationDate(const OptionalDate& creation_date, const InternalEmployeePtr& changer);
     bool setPaymentStatus(const PaymentStatus status, const InternalEmployeePtr& changer);
     bool setPaymentMethod(const OptionalStr& payment_method, const InternalEmployeePtr& changer);
     bool setDeal(const WeakDealPtr& deal, const InternalEmployeePtr& changer);
@@ -102,9 +103,9 @@ private:
     MoneyPtr      tax_amount;
     Currencies    currency;
 
-    DatePtr       sending_date;
-    DatePtr       received_date;
-    DatePtr       creation_date;
+    OptionalDate  sending_date;
+    OptionalDate  received_date;
+    OptionalDate  creation_date;
 
     PaymentStatus status;
 
@@ -123,5 +124,5 @@ private:
     std::vector<DocumentPtr>  documents;
     std::vector<std::string>  comments;
     WeakInternalEmployee      created_by;
-    std::vector<ChangeLogPtr> change_logs;
+    ChangeChain               change_logs{EntityType::Payment, id};
 };
\ No newline at end of file
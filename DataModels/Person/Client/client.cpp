@@ -1,7 +1,9 @@
 #include "client.hpp"
 
+#include <algorithm>
+
 #include "BigNum/big_uint.hpp"
-#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_journal.hpp"
 
 Client::Client(
     const BigUint&     id,
@@ -11,6 +13,7 @@ Client::Client(
 )
     : Person(id, name, surname, patronymic), lead_source(LeadSource::other), type(ClientType::other)
 {
+    this->change_logs.type = EntityType::Client;
 }
 Client::Client(
     const BigUint&                   id,
@@ -18,7 +21,7 @@ Client::Client(
     const std::string&               surname,
     const OptionalStr&               patronymic,
     const OptionalStr&               preferred_language,
-    const DatePtr&                   birthday,
+    const OptionalDate&              birthday,
     const PhoneNumberPtr&            phone_number,
     const AddressPtr&                address,
     const OptionalStr&               email,
@@ -70,9 +73,9 @@ Client::Client(
       )
     , owner(owner)
     , type(type)
-    , other_type(other_type)
+    , other_type(InternedStr::fromOptional(other_type))
     , lead_source(lead_source)
-    , other_lead_source(other_lead_source)
+    , other_lead_source(InternedStr::fromOptional(other_lead_source))
     , marketing_consent(marketing_consent)
     , preferred_communication_channel(preferred_communication_channel)
     , referral_code(referral_code)
@@ -83,13 +86,17 @@ Client::Client(
     , lifetime_value(lifetime_value)
     , interested_offers(std::move(interested_offers))
 {
+    this->change_logs.type = EntityType::Client;
 }
 
 auto Client::getOwner() const -> const WeakInternalEmployee& { return this->owner; }
 auto Client::getType() const -> ClientType { return this->type; }
-auto Client::getOtherType() const -> const OptionalStr& { return this->other_type; }
+auto Client::getOtherType() const -> const OptionalInterned& { return this->other_type; }
 auto Client::getLeadSource() const -> LeadSource { return this->lead_source; }
-auto Client::getOtherLeadSource() const -> const OptionalStr& { return this->other_lead_source; }
+auto Client::getOtherLeadSource() const -> const OptionalInterned&
+{
+    return this->other_lead_source;
+}
 auto Client::getMarketingConsent() const -> bool { return this->marketing_consent; }
 auto Client::getCommunicationChannel() const -> const OptionalStr&
 {
@@ -117,12 +124,45 @@ auto Client::getLifetimeValue() const -> const std::optional<Money>&
 
 auto Client::getOwnedDeals() const -> const std::vector<WeakDealPtr>& { return this->owned_deals; }
 
+auto Client::getInitialState() const -> InitialState
+{
+    using Type = ChangeLog::FieldType;
+    auto money = [](const std::optional<Money>& value) {
+        return value ? std::make_optional<ChangeLog::ValueVariant>(std::make_shared<Money>(*value))
+                     : std::nullopt;
+    };
+
+    InitialState state = Person::getInitialState();
+    state.set(ClientFields::Owner, Type::WeakInternalEmployee, WEAK_PTR_TO_OPTIONAL(this->owner));
+    state.set(ClientFields::Type, Type::ClientType, this->type);
+    state.set(ClientFields::OtherType, Type::String, OPTIONAL_STR_TO_VALUE(this->other_type));
+    state.set(ClientFields::LeadSource, Type::LeadSource, this->lead_source);
+    state.set(
+        ClientFields::OtherLeadSource, Type::String, OPTIONAL_STR_TO_VALUE(this->other_lead_source)
+    );
+    state.set(ClientFields::MarketingConsent, Type::Bool, this->marketing_consent);
+    state.set(
+        ClientFields::CommunicationChannel,
+        Type::String,
+        OPTIONAL_STR_TO_VALUE(this->preferred_communication_channel)
+    );
+    state.set(ClientFields::ReferralCode, Type::String, OPTIONAL_STR_TO_VALUE(this->referral_code));
+    state.set(
+        ClientFields::CustomerAcquisitionCost, Type::Money, money(this->customer_acquisition_cost)
+    );
+    state.set(ClientFields::LeadStatus, Type::LeadStatus, this->lead_status);
+    state.set(ClientFields::LeadScore, Type::Double, this->lead_score);
+    state.set(ClientFields::AnnualRevenue, Type::Money, money(this->annual_revenue));
+    state.set(ClientFields::LifetimeValue, Type::Money, money(this->lifetime_value));
+    return state;
+}
+
 bool Client::setOwner(const WeakInternalEmployee& owner, const InternalEmployeePtr& changer)
 {
     if (this->owner.owner_before(owner) || owner.owner_before(this->owner)) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->owner),
             WEAK_PTR_TO_OPTIONAL(owner),
@@ -133,7 +173,7 @@ bool Client::setOwner(const WeakInternalEmployee& owner, const InternalEmployeeP
                              : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->owner = owner;
         return true;
@@ -146,11 +186,9 @@ bool Client::setType(const ClientType type, const InternalEmployeePtr& changer)
     if (this->type != type) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_type ? std::make_optional<ChangeLog::ValueVariant>(
-                                   std::make_shared<std::string>(this->other_type.value())
-                               )
+            this->other_type ? ChangeValue::fromText(this->other_type.value())
                              : std::make_optional<ChangeLog::ValueVariant>(this->type),
             std::make_optional<ChangeLog::ValueVariant>(type),
             ClientFields::Type,
@@ -158,7 +196,7 @@ bool Client::setType(const ClientType type, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::ClientType,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->type       = type;
         this->other_type = std::nullopt;
@@ -172,21 +210,19 @@ bool Client::setOtherType(const std::string& other_type, const InternalEmployeeP
     if (this->other_type != other_type) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_type ? std::make_optional<ChangeLog::ValueVariant>(
-                                   std::make_shared<std::string>(this->other_type.value())
-                               )
+            this->other_type ? ChangeValue::fromText(this->other_type.value())
                              : std::make_optional<ChangeLog::ValueVariant>(this->type),
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(other_type)),
+            ChangeValue::fromText(other_type),
             ClientFields::OtherType,
             this->other_type ? ChangeLog::FieldType::String : ChangeLog::FieldType::ClientType,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
-        this->other_type = other_type;
+        this->other_type = InternedStr(other_type);
         this->type       = ClientType::other;
         return true;
     }
@@ -198,12 +234,10 @@ bool Client::setLeadSource(const LeadSource lead_source, const InternalEmployeeP
     if (this->lead_source != lead_source) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->other_lead_source
-                ? std::make_optional<ChangeLog::ValueVariant>(
-                      std::make_shared<std::string>(this->other_lead_source.value())
-                  )
+                ? ChangeValue::fromText(this->other_lead_source.value())
                 : std::make_optional<ChangeLog::ValueVariant>(this->lead_source),
             std::make_optional<ChangeLog::ValueVariant>(lead_source),
             ClientFields::LeadSource,
@@ -212,7 +246,7 @@ bool Client::setLeadSource(const LeadSource lead_source, const InternalEmployeeP
             ChangeLog::FieldType::LeadSource,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->lead_source       = lead_source;
         this->other_lead_source = std::nullopt;
@@ -228,25 +262,21 @@ bool Client::setOtherLeadSource(
     if (this->other_lead_source != other_lead_source) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->other_lead_source
-                ? std::make_optional<ChangeLog::ValueVariant>(
-                      std::make_shared<std::string>(this->other_lead_source.value())
-                  )
+                ? ChangeValue::fromText(this->other_lead_source.value())
                 : std::make_optional<ChangeLog::ValueVariant>(this->lead_source),
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(other_lead_source)
-            ),
+            ChangeValue::fromText(other_lead_source),
             ClientFields::OtherLeadSource,
             this->other_lead_source ? ChangeLog::FieldType::String
                                     : ChangeLog::FieldType::LeadSource,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
-        this->other_lead_source = other_lead_source;
+        this->other_lead_source = InternedStr(other_lead_source);
         this->lead_source       = LeadSource::other;
         return true;
     }
@@ -258,7 +288,7 @@ bool Client::setMarketingConsent(const bool marketing_consent, const InternalEmp
     if (this->marketing_consent != marketing_consent) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->marketing_consent),
             std::make_optional<ChangeLog::ValueVariant>(marketing_consent),
@@ -267,7 +297,7 @@ bool Client::setMarketingConsent(const bool marketing_consent, const InternalEmp
             ChangeLog::FieldType::Bool,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->marketing_consent = marketing_consent;
         return true;
@@ -280,7 +310,7 @@ bool Client::setCommunicationChannel(const OptionalStr& channel, const InternalE
     if (this->preferred_communication_channel != channel) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->preferred_communication_channel),
             OPTIONAL_STR_TO_VALUE(channel),
@@ -290,7 +320,7 @@ bool Client::setCommunicationChannel(const OptionalStr& channel, const InternalE
             channel ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->preferred_communication_channel = channel;
         return true;
@@ -303,7 +333,7 @@ bool Client::setReferralCode(const OptionalStr& code, const InternalEmployeePtr&
     if (this->referral_code != code) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->referral_code),
             OPTIONAL_STR_TO_VALUE(code),
@@ -312,7 +342,7 @@ bool Client::setReferralCode(const OptionalStr& code, const InternalEmployeePtr&
             code ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->referral_code = code;
         return true;
@@ -339,7 +369,7 @@ bool Client::setCustomerAcquisitionCost(
                   )
                 : std::nullopt;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::move(old_value),
             std::move(new_value),
@@ -348,7 +378,7 @@ bool Client::setCustomerAcquisitionCost(
             new_value ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->customer_acquisition_cost = money;
         return true;
@@ -370,7 +400,7 @@ bool Client::setLeadStatus(
             lead_status ? std::make_optional<ChangeLog::ValueVariant>(lead_status.value())
                         : std::nullopt;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::move(old_value),
             std::move(new_value),
@@ -379,7 +409,7 @@ bool Client::setLeadStatus(
             new_value ? ChangeLog::FieldType::LeadStatus : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->lead_status = lead_status;
         return true;
@@ -394,7 +424,7 @@ bool Client::setLeadScore(
     if (this->lead_score != lead_score) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->lead_score ? std::make_optional<ChangeLog::ValueVariant>(this->lead_score.value())
                              : std::nullopt,
@@ -405,7 +435,7 @@ bool Client::setLeadScore(
             lead_score ? ChangeLog::FieldType::Double : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->lead_score = lead_score;
         return true;
@@ -430,7 +460,7 @@ bool Client::setAnnualRevenue(
                              )
                            : std::nullopt;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::move(old_value),
             std::move(new_value),
@@ -439,7 +469,7 @@ bool Client::setAnnualRevenue(
             new_value ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->annual_revenue = annual_revenue;
         return true;
@@ -465,7 +495,7 @@ bool Client::setLifetimeValue(
                              )
                            : std::nullopt;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::move(old_value),
             std::move(new_value),
@@ -474,7 +504,7 @@ bool Client::setLifetimeValue(
             new_value ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->lifetime_value = lifetime_value;
         return true;
@@ -493,7 +523,7 @@ bool Client::addOwnedDeal(const WeakDealPtr& deal, const InternalEmployeePtr& ch
         ) == this->owned_deals.end()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(deal),
@@ -502,7 +532,7 @@ bool Client::addOwnedDeal(const WeakDealPtr& deal, const InternalEmployeePtr& ch
             ChangeLog::FieldType::WeakDeal,
             ChangeLog::Action::Add,
             update
-        ));
+        );
 
         this->updateAt(update);
         this->addRelatedDeals(deal, changer, update);
@@ -517,7 +547,7 @@ bool Client::delOwnedDeal(size_t index, const InternalEmployeePtr& changer)
     if (index < this->owned_deals.size()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->owned_deals[index]),
             std::nullopt,
@@ -526,7 +556,7 @@ bool Client::delOwnedDeal(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->delRelatedDeals(this->owned_deals[index], changer, update);
         this->owned_deals.erase(this->owned_deals.begin() + index);
@@ -544,7 +574,7 @@ bool Client::addInterestedOffer(
         ) == this->interested_offers.end()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(interested_offer),
@@ -553,7 +583,7 @@ bool Client::addInterestedOffer(
             ChangeLog::FieldType::Offer,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->interested_offers.push_back(interested_offer);
         return true;
@@ -566,7 +596,7 @@ bool Client::delInterestedOffer(size_t index, const InternalEmployeePtr& changer
     if (index < this->interested_offers.size()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->interested_offers[index]),
             std::nullopt,
@@ -575,7 +605,7 @@ bool Client::delInterestedOffer(size_t index, const InternalEmployeePtr& changer
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->interested_offers.erase(this->interested_offers.begin() + index);
         return true;
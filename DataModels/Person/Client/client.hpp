@@ -47,7 +47,7 @@ public:
         const std::string&               surname,
         const OptionalStr&               patronymic,
         const OptionalStr&               preferred_language,
-        const DatePtr&                   birthday,
+        const OptionalDate&              birthday,
         const PhoneNumberPtr&            phone_number,
         const AddressPtr&                address,
         const OptionalStr&               email,
@@ -82,9 +82,9 @@ public:
     /// @{
     auto getOwner() const -> const WeakInternalEmployee&;
     auto getType() const -> ClientType;
-    auto getOtherType() const -> const OptionalStr&;
+    auto getOtherType() const -> const OptionalInterned&;
     auto getLeadSource() const -> LeadSource;
-    auto getOtherLeadSource() const -> const OptionalStr&;
+    auto getOtherLeadSource() const -> const OptionalInterned&;
     auto getMarketingConsent() const -> bool;
     auto getCommunicationChannel() const -> const OptionalStr&;
     auto getReferralCode() const -> const OptionalStr&;
@@ -138,10 +138,10 @@ public:
 private:
     WeakInternalEmployee owner;
     ClientType           type;
-    OptionalStr          other_type;
+    OptionalInterned     other_type;
 
     LeadSource           lead_source;
-    OptionalStr          other_lead_source;
+    OptionalInterned     other_lead_source;
     bool                 marketing_consent;
     OptionalStr          preferred_communication_channel;
     OptionalStr          referral_code;
@@ -154,6 +154,9 @@ private:
     std::vector<WeakDealPtr>  owned_deals;
     std::vector<OfferPtr>     interested_offers;
 
+    /// Fields of the person and of the client, for `ClientDataBase::add`
+    auto getInitialState() const -> InitialState;
+
     friend class ClientDataBase;
 
 #ifdef _TESTING
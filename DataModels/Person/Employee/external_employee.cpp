@@ -1,6 +1,8 @@
 #include "Person/Employee/external_employee.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 ExternalEmployee::ExternalEmployee(
     const BigUint&     id,
     const std::string& name,
@@ -12,6 +14,7 @@ ExternalEmployee::ExternalEmployee(
     , status(EmployeeStatus::other)
     , time_zone(0)
 {
+    this->change_logs.type = EntityType::ExternalEmployee;
 }
 
 ExternalEmployee::ExternalEmployee(
@@ -20,7 +23,7 @@ ExternalEmployee::ExternalEmployee(
     const std::string&                   surname,
     const OptionalStr&                   patronymic,
     const OptionalStr&                   preferred_language,
-    const DatePtr&                       birthday,
+    const OptionalDate&                  birthday,
     const PhoneNumberPtr&                phone_number,
     const AddressPtr&                    address,
     const OptionalStr&                   email,
@@ -33,7 +36,7 @@ ExternalEmployee::ExternalEmployee(
     const AccessRole&                    access_role,
     const OptionalStr&                   other_role,
     const InteractionPtr&                current_interaction,
-    const DatePtr&                       last_contact_date,
+    const OptionalDate&                  last_contact_date,
     int                                  time_zone,
     const OptionalStr&                   preferred_contact_time,
     const std::optional<InfluenceLevel>& decision_influence,
@@ -78,11 +81,11 @@ ExternalEmployee::ExternalEmployee(
       )
     , company(company)
     , job_title(job_title)
-    , department(department)
+    , department(InternedStr::fromOptional(department))
     , status(status)
-    , other_status(other_status)
+    , other_status(InternedStr::fromOptional(other_status))
     , access_role(access_role)
-    , other_role(other_role)
+    , other_role(InternedStr::fromOptional(other_role))
     , current_interaction(current_interaction)
     , last_contact_date(last_contact_date)
     , time_zone(time_zone)
@@ -97,20 +100,24 @@ ExternalEmployee::ExternalEmployee(
     , assigned_tasks(assigned_tasks)
     , completed_tasks(completed_tasks)
 {
+    this->change_logs.type = EntityType::ExternalEmployee;
 }
 
 auto ExternalEmployee::getCompany() const -> const ExternalCompanyPtr& { return this->company; }
 auto ExternalEmployee::getJobTitle() const -> const OptionalStr& { return this->job_title; }
-auto ExternalEmployee::getDepartment() const -> const OptionalStr& { return this->department; }
+auto ExternalEmployee::getDepartment() const -> const OptionalInterned& { return this->department; }
 auto ExternalEmployee::getStatus() const -> EmployeeStatus { return this->status; }
-auto ExternalEmployee::getOtherStatus() const -> const OptionalStr& { return this->other_status; }
+auto ExternalEmployee::getOtherStatus() const -> const OptionalInterned&
+{
+    return this->other_status;
+}
 auto ExternalEmployee::getAccessRole() const -> AccessRole { return this->access_role; }
-auto ExternalEmployee::getOtherRole() const -> const OptionalStr& { return this->other_role; }
+auto ExternalEmployee::getOtherRole() const -> const OptionalInterned& { return this->other_role; }
 auto ExternalEmployee::getCurrentInteraction() const -> const InteractionPtr&
 {
     return this->current_interaction;
 }
-auto ExternalEmployee::getLastContactDate() const -> const DatePtr&
+auto ExternalEmployee::getLastContactDate() const -> const OptionalDate&
 {
     return this->last_contact_date;
 }
@@ -154,13 +161,51 @@ auto ExternalEmployee::getCompletedTasks() const -> const std::vector<TaskPtr>&
     return this->completed_tasks;
 }
 
+auto ExternalEmployee::getInitialState() const -> InitialState
+{
+    using Type   = ChangeLog::FieldType;
+    using Fields = ExternalEmployeeFields;
+
+    InitialState state = Person::getInitialState();
+    state.set(Fields::Company, Type::Company, PTR_TO_OPTIONAL(this->company));
+    state.set(Fields::JobTitle, Type::String, OPTIONAL_STR_TO_VALUE(this->job_title));
+    state.set(Fields::Department, Type::String, OPTIONAL_STR_TO_VALUE(this->department));
+    if (this->other_status) {
+        state.set(Fields::Status, Type::String, ChangeValue::fromText(*this->other_status));
+    } else {
+        state.set(Fields::Status, Type::EmployeeStatus, this->status);
+    }
+    if (this->other_role) {
+        state.set(Fields::Role, Type::String, ChangeValue::fromText(*this->other_role));
+    } else {
+        state.set(Fields::Role, Type::AccessLevel, this->access_role);
+    }
+    state.set(
+        Fields::CurrentInteraction,
+        Type::BaseInteraction,
+        PTR_TO_OPTIONAL(this->current_interaction)
+    );
+    state.set(Fields::LastContactDate, Type::Date, this->last_contact_date);
+    state.set(Fields::TimeZone, Type::Int, this->time_zone);
+    state.set(
+        Fields::PreferredContactTime,
+        Type::String,
+        OPTIONAL_STR_TO_VALUE(this->preferred_contact_time)
+    );
+    state.set(Fields::DecisionInfluence, Type::InfluenceLevel, this->decision_influence);
+    state.set(Fields::InfluenceScore, Type::Double, this->influence_score);
+    state.set(Fields::BudgetAuthority, Type::Money, PTR_TO_OPTIONAL(this->budget_authority));
+    state.set(Fields::Salary, Type::Money, PTR_TO_OPTIONAL(this->salary));
+    return state;
+}
+
 bool ExternalEmployee::setCompany(
     const ExternalCompanyPtr& company, const InternalEmployeePtr& changer
 )
 {
     if (this->company != company) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->company),
             PTR_TO_OPTIONAL(company),
@@ -169,7 +214,7 @@ bool ExternalEmployee::setCompany(
             company ? ChangeLog::FieldType::Company : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->company = company;
         return true;
@@ -182,7 +227,7 @@ bool ExternalEmployee::setJobTitle(const OptionalStr& title, const InternalEmplo
     if (this->job_title != title) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->job_title),
             OPTIONAL_STR_TO_VALUE(title),
@@ -191,7 +236,7 @@ bool ExternalEmployee::setJobTitle(const OptionalStr& title, const InternalEmplo
             title ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->job_title = title;
         return true;
@@ -206,7 +251,7 @@ bool ExternalEmployee::setDepartment(
     if (this->department != department) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->department),
             OPTIONAL_STR_TO_VALUE(department),
@@ -215,9 +260,9 @@ bool ExternalEmployee::setDepartment(
             department ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
-        this->department = department;
+        this->department = InternedStr::fromOptional(department);
         return true;
     }
     return false;
@@ -228,11 +273,9 @@ bool ExternalEmployee::setStatus(const EmployeeStatus status, const InternalEmpl
     if (this->status != status) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_status ? std::make_optional<ChangeLog::ValueVariant>(
-                                     std::make_shared<std::string>(this->other_status.value())
-                                 )
+            this->other_status ? ChangeValue::fromText(this->other_status.value())
                                : std::make_optional<ChangeLog::ValueVariant>(this->status),
             std::make_optional<ChangeLog::ValueVariant>(status),
             ExternalEmployeeFields::Status,
@@ -241,7 +284,7 @@ bool ExternalEmployee::setStatus(const EmployeeStatus status, const InternalEmpl
             ChangeLog::FieldType::EmployeeStatus,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->status       = status;
         this->other_status = std::nullopt;
@@ -255,11 +298,9 @@ bool ExternalEmployee::setOtherStatus(const OptionalStr& status, const InternalE
     if (this->other_status != status) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_status ? std::make_optional<ChangeLog::ValueVariant>(
-                                     std::make_shared<std::string>(this->other_status.value())
-                                 )
+            this->other_status ? ChangeValue::fromText(this->other_status.value())
                                : std::make_optional<ChangeLog::ValueVariant>(this->status),
             OPTIONAL_STR_TO_VALUE(status),
             ExternalEmployeeFields::Status,
@@ -268,9 +309,9 @@ bool ExternalEmployee::setOtherStatus(const OptionalStr& status, const InternalE
             status ? ChangeLog::FieldType::String : ChangeLog::FieldType::EmployeeStatus,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
-        this->other_status = status;
+        this->other_status = InternedStr::fromOptional(status);
         this->status       = EmployeeStatus::other;
         return true;
     }
@@ -284,11 +325,9 @@ bool ExternalEmployee::setAccessRole(
     if (this->access_role != access_role) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_role ? std::make_optional<ChangeLog::ValueVariant>(
-                                   std::make_shared<std::string>(this->other_role.value())
-                               )
+            this->other_role ? ChangeValue::fromText(this->other_role.value())
                              : std::make_optional<ChangeLog::ValueVariant>(this->access_role),
             std::make_optional<ChangeLog::ValueVariant>(access_role),
             ExternalEmployeeFields::Role,
@@ -296,7 +335,7 @@ bool ExternalEmployee::setAccessRole(
             ChangeLog::FieldType::AccessLevel,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->access_role = access_role;
         this->other_role  = std::nullopt;
@@ -312,11 +351,9 @@ bool ExternalEmployee::setOtherRole(
     if (this->other_role != other_role) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_role ? std::make_optional<ChangeLog::ValueVariant>(
-                                   std::make_shared<std::string>(this->other_role.value())
-                               )
+            this->other_role ? ChangeValue::fromText(this->other_role.value())
                              : std::make_optional<ChangeLog::ValueVariant>(this->access_role),
             OPTIONAL_STR_TO_VALUE(other_role),
             ExternalEmployeeFields::Role,
@@ -324,10 +361,10 @@ bool ExternalEmployee::setOtherRole(
             other_role ? ChangeLog::FieldType::String : ChangeLog::FieldType::AccessLevel,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->access_role = AccessRole::other;
-        this->other_role  = other_role;
+        this->other_role  = InternedStr::fromOptional(other_role);
         return true;
     }
     return false;
@@ -340,7 +377,7 @@ bool ExternalEmployee::setCurrentInteraction(
     if (this->current_interaction != current_interaction) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             PTR_TO_OPTIONAL(this->current_interaction),
             PTR_TO_OPTIONAL(current_interaction),
@@ -351,7 +388,7 @@ bool ExternalEmployee::setCurrentInteraction(
                                 : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->current_interaction = current_interaction;
         return true;
@@ -360,26 +397,22 @@ bool ExternalEmployee::setCurrentInteraction(
 }
 
 bool ExternalEmployee::setLastContactDate(
-    const DatePtr& last_contact_date, const InternalEmployeePtr& changer
+    const OptionalDate& last_contact_date, const InternalEmployeePtr& changer
 )
 {
-    if (this->last_contact_date == nullptr || last_contact_date == nullptr) {
-        if (this->last_contact_date == last_contact_date) return false;
-    } else if (*this->last_contact_date == *last_contact_date) {
-        return false;
-    }
+    if (this->last_contact_date == last_contact_date) return false;
     Date update = Date();
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->last_contact_date),
-        PTR_TO_OPTIONAL(last_contact_date),
+        OPTIONAL_TO_VALUE(this->last_contact_date),
+        OPTIONAL_TO_VALUE(last_contact_date),
         ExternalEmployeeFields::LastContactDate,
         this->last_contact_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         last_contact_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->updateAt(update);
     this->last_contact_date = last_contact_date;
     return true;
@@ -390,7 +423,7 @@ bool ExternalEmployee::setTimeZone(const int time_zone, const InternalEmployeePt
     if (this->time_zone != time_zone) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->time_zone),
             std::make_optional<ChangeLog::ValueVariant>(time_zone),
@@ -399,7 +432,7 @@ bool ExternalEmployee::setTimeZone(const int time_zone, const InternalEmployeePt
             ChangeLog::FieldType::Int,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->time_zone = time_zone;
         return true;
@@ -414,7 +447,7 @@ bool ExternalEmployee::setPreferredContactTime(
     if (this->preferred_contact_time != preferred_contact_time) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->preferred_contact_time),
             OPTIONAL_STR_TO_VALUE(preferred_contact_time),
@@ -424,7 +457,7 @@ bool ExternalEmployee::setPreferredContactTime(
             preferred_contact_time ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->preferred_contact_time = preferred_contact_time;
         return true;
@@ -448,7 +481,7 @@ bool ExternalEmployee::setDecisionInfluence(
                 ? std::make_optional<ChangeLog::ValueVariant>(decision_influence.value())
                 : std::nullopt;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::move(old_value),
             std::move(new_value),
@@ -457,7 +490,7 @@ bool ExternalEmployee::setDecisionInfluence(
             new_value ? ChangeLog::FieldType::InfluenceLevel : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->decision_influence = decision_influence;
         return true;
@@ -480,7 +513,7 @@ bool ExternalEmployee::setInfluenceScore(
             influence_score ? std::make_optional<ChangeLog::ValueVariant>(influence_score.value())
                             : std::nullopt;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::move(old_value),
             std::move(new_value),
@@ -489,7 +522,7 @@ bool ExternalEmployee::setInfluenceScore(
             new_value ? ChangeLog::FieldType::Double : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->influence_score = influence_score;
         return true;
@@ -508,7 +541,7 @@ bool ExternalEmployee::setBudgetAuthority(
     }
     Date update = Date();
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->budget_authority),
         PTR_TO_OPTIONAL(budget_authority),
@@ -517,7 +550,7 @@ bool ExternalEmployee::setBudgetAuthority(
         budget_authority ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->updateAt(update);
     this->budget_authority = budget_authority;
     return true;
@@ -532,7 +565,7 @@ bool ExternalEmployee::setSalary(const MoneyPtr& salary, const InternalEmployeeP
     }
     Date update = Date();
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->salary),
         PTR_TO_OPTIONAL(salary),
@@ -541,7 +574,7 @@ bool ExternalEmployee::setSalary(const MoneyPtr& salary, const InternalEmployeeP
         salary ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->updateAt(update);
     this->salary = salary;
     return true;
@@ -555,16 +588,16 @@ bool ExternalEmployee::addPainPoint(
         this->pain_points.end()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(pain_point)),
+            ChangeValue::fromText(pain_point),
             ExternalEmployeeFields::PainPoints,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->pain_points.push_back(pain_point);
         return true;
@@ -576,18 +609,16 @@ bool ExternalEmployee::delPainPoint(size_t index, const InternalEmployeePtr& cha
 {
     if (index < this->pain_points.size()) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional<ChangeLog::ValueVariant>(
-                std::make_shared<std::string>(this->pain_points[index])
-            ),
+            ChangeValue::fromText(this->pain_points[index]),
             std::nullopt,
             ExternalEmployeeFields::PainPoints,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->pain_points.erase(this->pain_points.begin() + index);
         return true;
@@ -608,7 +639,7 @@ bool ExternalEmployee::addAssignedDeal(
         ) == this->assigned_deals.end()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(assigned_deal),
@@ -617,7 +648,7 @@ bool ExternalEmployee::addAssignedDeal(
             ChangeLog::FieldType::WeakDeal,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->addRelatedDeals(assigned_deal, changer, update);
         this->assigned_deals.push_back(assigned_deal);
@@ -631,7 +662,7 @@ bool ExternalEmployee::delAssignedDeal(size_t index, const InternalEmployeePtr&
     if (index < this->assigned_deals.size()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->assigned_deals[index]),
             std::nullopt,
@@ -640,7 +671,7 @@ bool ExternalEmployee::delAssignedDeal(size_t index, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->delRelatedDeals(this->assigned_deals[index], changer, update);
         this->assigned_deals.erase(this->assigned_deals.begin() + index);
@@ -662,7 +693,7 @@ bool ExternalEmployee::addCompletedDeal(
         ) == this->completed_deals.end()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(completed_deal),
@@ -671,7 +702,7 @@ bool ExternalEmployee::addCompletedDeal(
             ChangeLog::FieldType::WeakDeal,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->addRelatedDeals(completed_deal, changer, update);
         this->completed_deals.push_back(completed_deal);
@@ -685,7 +716,7 @@ bool ExternalEmployee::delCompletedDeal(size_t index, const InternalEmployeePtr&
     if (index < this->completed_deals.size()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->completed_deals[index]),
             std::nullopt,
@@ -694,7 +725,7 @@ bool ExternalEmployee::delCompletedDeal(size_t index, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->delRelatedDeals(this->completed_deals[index], changer, update);
         this->completed_deals.erase(this->completed_deals.begin() + index);
@@ -711,7 +742,7 @@ bool ExternalEmployee::addAssignedTask(
         this->assigned_tasks.end()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(assigned_task),
@@ -720,7 +751,7 @@ bool ExternalEmployee::addAssignedTask(
             ChangeLog::FieldType::Task,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->assigned_tasks.push_back(assigned_task);
         return true;
@@ -733,7 +764,7 @@ bool ExternalEmployee::delAssignedTask(size_t index, const InternalEmployeePtr&
     if (index < this->assigned_tasks.size()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->assigned_tasks[index]),
             std::nullopt,
@@ -742,7 +773,7 @@ bool ExternalEmployee::delAssignedTask(size_t index, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->assigned_tasks.erase(this->assigned_tasks.begin() + index);
         return true;
@@ -758,7 +789,7 @@ bool ExternalEmployee::addCompletedTask(
         this->completed_tasks.end()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(completed_task),
@@ -767,7 +798,7 @@ bool ExternalEmployee::addCompletedTask(
             ChangeLog::FieldType::Task,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->completed_tasks.push_back(completed_task);
         return true;
@@ -780,7 +811,7 @@ bool ExternalEmployee::delCompletedTask(size_t index, const InternalEmployeePtr&
     if (index < this->completed_tasks.size()) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(this->completed_tasks[index]),
             std::nullopt,
@@ -789,7 +820,7 @@ bool ExternalEmployee::delCompletedTask(size_t index, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->completed_tasks.erase(this->completed_tasks.begin() + index);
         return true;
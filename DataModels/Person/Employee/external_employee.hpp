@@ -22,7 +22,7 @@ public:
         const std::string&                   surname,
         const OptionalStr&                   patronymic,
         const OptionalStr&                   preferred_language,
-        const DatePtr&                       birthday,
+        const OptionalDate&                  birthday,
         const PhoneNumberPtr&                phone_number,
         const AddressPtr&                    address,
         const OptionalStr&                   email,
@@ -35,7 +35,7 @@ public:
         const AccessRole&                    access_role,
         const OptionalStr&                   other_role,
         const InteractionPtr&                current_interaction,
-        const DatePtr&                       last_contact_date,
+        const OptionalDate&                  last_contact_date,
         int                                  time_zone,
         const OptionalStr&                   preferred_contact_time,
         const std::optional<InfluenceLevel>& decision_influence,
@@ -63,13 +63,13 @@ public:
     /// @{
     auto getCompany() const -> const ExternalCompanyPtr&;
     auto getJobTitle() const -> const OptionalStr&;
-    auto getDepartment() const -> const OptionalStr&;
+    auto getDepartment() const -> const OptionalInterned&;
     auto getStatus() const -> EmployeeStatus;
-    auto getOtherStatus() const -> const OptionalStr&;
+    auto getOtherStatus() const -> const OptionalInterned&;
     auto getAccessRole() const -> AccessRole;
-    auto getOtherRole() const -> const OptionalStr&;
+    auto getOtherRole() const -> const OptionalInterned&;
     auto getCurrentInteraction() const -> const InteractionPtr&;
-    auto getLastContactDate() const -> const DatePtr&;
+    auto getLastContactDate() const -> const OptionalDate&;
     auto getTimeZone() const -> int;
     auto getPreferredContactTime() const -> const OptionalStr&;
 
@@ -106,7 +106,9 @@ public:
     bool setCurrentInteraction(
         const InteractionPtr& current_interaction, const InternalEmployeePtr& changer
     );
-    bool setLastContactDate(const DatePtr& last_contact_date, const InternalEmployeePtr& changer);
+    bool setLastContactDate(
+        const OptionalDate& last_contact_date, const InternalEmployeePtr& changer
+    );
     bool setPreferredContactTime(
         const OptionalStr& preferred_contact_time, const InternalEmployeePtr& changer
     );
@@ -135,14 +137,14 @@ public:
 private:
     ExternalCompanyPtr company;
     OptionalStr        job_title;
-    OptionalStr        department;
+    OptionalInterned   department;
 
     EmployeeStatus     status;
-    OptionalStr        other_status;
+    OptionalInterned   other_status;
     AccessRole         access_role;
-    OptionalStr        other_role;
+    OptionalInterned   other_role;
     InteractionPtr     current_interaction;
-    DatePtr            last_contact_date;
+    OptionalDate       last_contact_date;
     int                time_zone;               /// UTC +/-
     OptionalStr        preferred_contact_time;  /// 9-12 UTC
 
@@ -160,6 +162,9 @@ private:
     std::vector<TaskPtr> assigned_tasks;
     std::vector<TaskPtr> completed_tasks;
 
+    /// Fields of the person and of the employee, for `ExternalEmployeeDataBase::add`
+    auto getInitialState() const -> InitialState;
+
     friend class ExternalEmployeeDataBase;
 
 #ifdef _TESTING
@@ -1,6 +1,8 @@
 #include "internal_employee.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 InternalEmployee::InternalEmployee(
     const BigUint&     id,
     const std::string& name,
@@ -13,6 +15,7 @@ InternalEmployee::InternalEmployee(
     , time_zone(0)
     , is_active(false)
 {
+    this->change_logs.type = EntityType::InternalEmployee;
 }
 
 InternalEmployee::InternalEmployee(
@@ -21,7 +24,7 @@ InternalEmployee::InternalEmployee(
     const std::string&                surname,
     const OptionalStr&                patronymic,
     const OptionalStr&                preferred_language,
-    const DatePtr&                    birthday,
+    const OptionalDate&               birthday,
     const PhoneNumberPtr&             phone_number,
     const AddressPtr&                 address,
     const OptionalStr&                email,
@@ -34,15 +37,15 @@ InternalEmployee::InternalEmployee(
     const EmployeeStatus&             status,
     const OptionalStr&                other_status,
     const OptionalStr&                sales_territory,
-    const DatePtr&                    last_login_date,
-    const DatePtr&                    last_action_date,
+    const OptionalDate&               last_login_date,
+    const OptionalDate&               last_action_date,
     int                               time_zone,
     const std::optional<double>&      commission_rate,
     const MoneyPtr&                   base_salary,
     const std::optional<double>&      performance_score,
-    const DatePtr&                    next_review_date,
-    const DatePtr&                    hire_date,
-    const DatePtr&                    dismissal_date,
+    const OptionalDate&               next_review_date,
+    const OptionalDate&               hire_date,
+    const OptionalDate&               dismissal_date,
     std::vector<WeakClientPtr>        leads,
     std::vector<Note>                 notes,
     std::vector<Money>                monthly_quota,
@@ -81,13 +84,13 @@ InternalEmployee::InternalEmployee(
           std::move(notes)
       )
     , manager(manager)
-    , position(position)
-    , department(department)
+    , position(InternedStr::fromOptional(position))
+    , department(InternedStr::fromOptional(department))
     , access_role(access_role)
-    , other_role(other_role)
+    , other_role(InternedStr::fromOptional(other_role))
     , status(status)
-    , other_status(other_status)
-    , sales_territory(sales_territory)
+    , other_status(InternedStr::fromOptional(other_status))
+    , sales_territory(InternedStr::fromOptional(sales_territory))
     , last_login_date(last_login_date)
     , last_action_date(last_action_date)
     , time_zone(time_zone)
@@ -105,35 +108,39 @@ InternalEmployee::InternalEmployee(
     , dismissal_date(dismissal_date)
     , is_active(false)
 {
+    this->change_logs.type = EntityType::InternalEmployee;
 }
 
 auto InternalEmployee::getManager() const -> const WeakInternalEmployee& { return this->manager; }
-auto InternalEmployee::getPosition() const -> const OptionalStr& { return this->position; }
-auto InternalEmployee::getDepartment() const -> const OptionalStr& { return this->department; }
+auto InternalEmployee::getPosition() const -> const OptionalInterned& { return this->position; }
+auto InternalEmployee::getDepartment() const -> const OptionalInterned& { return this->department; }
 auto InternalEmployee::getAccessRole() const -> AccessRole { return this->access_role; }
-auto InternalEmployee::getOtherRole() const -> const OptionalStr& { return this->other_role; }
+auto InternalEmployee::getOtherRole() const -> const OptionalInterned& { return this->other_role; }
 auto InternalEmployee::getStatus() const -> EmployeeStatus { return this->status; }
-auto InternalEmployee::getOtherStatus() const -> const OptionalStr& { return this->other_status; }
-auto InternalEmployee::getSalesTerritory() const -> const OptionalStr&
+auto InternalEmployee::getOtherStatus() const -> const OptionalInterned&
+{
+    return this->other_status;
+}
+auto InternalEmployee::getSalesTerritory() const -> const OptionalInterned&
 {
     return this->sales_territory;
 }
-auto InternalEmployee::getLastLoginDate() const -> const DatePtr& { return this->last_login_date; }
-auto InternalEmployee::getLastActionDate() const -> const DatePtr&
+auto InternalEmployee::getLastLoginDate() const -> const OptionalDate&
+{
+    return this->last_login_date;
+}
+auto InternalEmployee::getLastActionDate() const -> const OptionalDate&
 {
     return this->last_action_date;
 }
 auto InternalEmployee::getTimeZone() const -> int { return this->time_zone; }
 auto InternalEmployee::getIsActive() const -> bool { return this->is_active; }
-auto InternalEmployee::getNextReviewDate() const -> const DatePtr&
+auto InternalEmployee::getNextReviewDate() const -> const OptionalDate&
 {
     return this->next_review_date;
 }
-auto InternalEmployee::getHireDate() const -> const std::shared_ptr<Date>&
-{
-    return this->hire_date;
-}
-auto InternalEmployee::getDismissalDate() const -> const std::shared_ptr<Date>&
+auto InternalEmployee::getHireDate() const -> const OptionalDate& { return this->hire_date; }
+auto InternalEmployee::getDismissalDate() const -> const OptionalDate&
 {
     return this->dismissal_date;
 }
@@ -169,13 +176,47 @@ auto InternalEmployee::getDirectReports() const -> const std::vector<WeakInterna
 {
     return this->direct_reports;
 }
+auto InternalEmployee::getInitialState() const -> InitialState
+{
+    using Type   = ChangeLog::FieldType;
+    using Fields = InternalEmployeeFields;
+
+    InitialState state = Person::getInitialState();
+    state.set(Fields::Manager, Type::WeakInternalEmployee, WEAK_PTR_TO_OPTIONAL(this->manager));
+    state.set(Fields::Position, Type::String, OPTIONAL_STR_TO_VALUE(this->position));
+    state.set(Fields::Department, Type::String, OPTIONAL_STR_TO_VALUE(this->department));
+    // the other role and status replace the enum in the same field, as their setters log them
+    if (this->other_role) {
+        state.set(Fields::Role, Type::String, ChangeValue::fromText(*this->other_role));
+    } else {
+        state.set(Fields::Role, Type::AccessLevel, this->access_role);
+    }
+    if (this->other_status) {
+        state.set(Fields::Status, Type::String, ChangeValue::fromText(*this->other_status));
+    } else {
+        state.set(Fields::Status, Type::EmployeeStatus, this->status);
+    }
+    state.set(Fields::SalesTerritory, Type::String, OPTIONAL_STR_TO_VALUE(this->sales_territory));
+    state.set(Fields::LastLoginDate, Type::Date, this->last_login_date);
+    state.set(Fields::LastActionDate, Type::Date, this->last_action_date);
+    state.set(Fields::IsActive, Type::Bool, this->is_active);
+    state.set(Fields::NextReviewDate, Type::Date, this->next_review_date);
+    state.set(Fields::TimeZone, Type::Int, this->time_zone);
+    state.set(Fields::CommissionRate, Type::Double, this->commission_rate);
+    state.set(Fields::BaseSalary, Type::Money, PTR_TO_OPTIONAL(this->base_salary));
+    state.set(Fields::PerformanceScore, Type::Double, this->performance_score);
+    state.set(Fields::HireDate, Type::Date, this->hire_date);
+    state.set(Fields::DismissalDate, Type::Date, this->dismissal_date);
+    return state;
+}
+
 bool InternalEmployee::setManager(
     const WeakInternalEmployee& manager, const InternalEmployeePtr& changer
 )
 {
     if (this->manager.owner_before(manager) || manager.owner_before(this->manager)) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->manager),
             WEAK_PTR_TO_OPTIONAL(manager),
@@ -186,7 +227,7 @@ bool InternalEmployee::setManager(
                                : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->manager = manager;
         return true;
@@ -198,7 +239,7 @@ bool InternalEmployee::setPosition(const OptionalStr& position, const InternalEm
 {
     if (this->position != position) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->position),
             OPTIONAL_STR_TO_VALUE(position),
@@ -207,8 +248,8 @@ bool InternalEmployee::setPosition(const OptionalStr& position, const InternalEm
             position ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
-        this->position = position;
+        );
+        this->position = InternedStr::fromOptional(position);
         this->updateAt(update);
         return true;
     }
@@ -221,7 +262,7 @@ bool InternalEmployee::setDepartment(
 {
     if (this->department != department) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->department),
             OPTIONAL_STR_TO_VALUE(department),
@@ -230,9 +271,9 @@ bool InternalEmployee::setDepartment(
             department ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
-        this->department = department;
+        this->department = InternedStr::fromOptional(department);
         return true;
     }
     return false;
@@ -243,11 +284,9 @@ bool InternalEmployee::setAccessRole(const AccessRole role, const InternalEmploy
     if (this->access_role != role) {
         Date update   = Date();
         auto old_vale = this->other_role
-                          ? std::make_optional<ChangeLog::ValueVariant>(
-                                std::make_shared<std::string>(this->other_role.value())
-                            )
+                          ? ChangeValue::fromText(this->other_role.value())
                           : std::make_optional(this->access_role);
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::move(old_vale),
             std::make_optional(role),
@@ -256,7 +295,7 @@ bool InternalEmployee::setAccessRole(const AccessRole role, const InternalEmploy
             ChangeLog::FieldType::AccessLevel,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->access_role = role;
         this->other_role  = std::nullopt;
@@ -272,11 +311,9 @@ bool InternalEmployee::setOtherRole(
     if (this->other_role != other_role) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_role ? std::make_optional<ChangeLog::ValueVariant>(
-                                   std::make_shared<std::string>(this->other_role.value())
-                               )
+            this->other_role ? ChangeValue::fromText(this->other_role.value())
                              : std::make_optional<ChangeLog::ValueVariant>(this->access_role),
             OPTIONAL_STR_TO_VALUE(other_role),
             InternalEmployeeFields::Role,
@@ -284,10 +321,10 @@ bool InternalEmployee::setOtherRole(
             other_role ? ChangeLog::FieldType::String : ChangeLog::FieldType::AccessLevel,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->access_role = AccessRole::other;
-        this->other_role  = other_role;
+        this->other_role  = InternedStr::fromOptional(other_role);
         return true;
     }
     return false;
@@ -297,11 +334,9 @@ bool InternalEmployee::setStatus(const EmployeeStatus status, const InternalEmpl
 {
     if (this->status != status) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_status ? std::make_optional<ChangeLog::ValueVariant>(
-                                     std::make_shared<std::string>(this->other_status.value())
-                                 )
+            this->other_status ? ChangeValue::fromText(this->other_status.value())
                                : std::make_optional(this->status),
             std::make_optional(status),
             InternalEmployeeFields::Status,
@@ -310,7 +345,7 @@ bool InternalEmployee::setStatus(const EmployeeStatus status, const InternalEmpl
             ChangeLog::FieldType::EmployeeStatus,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->status       = status;
         this->other_status = std::nullopt;
@@ -324,11 +359,9 @@ bool InternalEmployee::setOtherStatus(const OptionalStr& status, const InternalE
     if (this->other_status != status) {
         Date update = Date();
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            this->other_status ? std::make_optional<ChangeLog::ValueVariant>(
-                                     std::make_shared<std::string>(this->other_status.value())
-                                 )
+            this->other_status ? ChangeValue::fromText(this->other_status.value())
                                : std::make_optional<ChangeLog::ValueVariant>(this->status),
             OPTIONAL_STR_TO_VALUE(status),
             InternalEmployeeFields::Status,
@@ -337,9 +370,9 @@ bool InternalEmployee::setOtherStatus(const OptionalStr& status, const InternalE
             status ? ChangeLog::FieldType::String : ChangeLog::FieldType::EmployeeStatus,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
-        this->other_status = status;
+        this->other_status = InternedStr::fromOptional(status);
         this->status       = EmployeeStatus::other;
         return true;
     }
@@ -352,7 +385,7 @@ bool InternalEmployee::setSalesTerritory(
 {
     if (this->sales_territory != sales_territory) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->sales_territory),
             OPTIONAL_STR_TO_VALUE(sales_territory),
@@ -361,67 +394,53 @@ bool InternalEmployee::setSalesTerritory(
             sales_territory ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
-        this->sales_territory = sales_territory;
+        this->sales_territory = InternedStr::fromOptional(sales_territory);
         return true;
     }
     return false;
 }
 
 bool InternalEmployee::setLastLoginDate(
-    const DatePtr& last_login_date, const InternalEmployeePtr& changer
+    const OptionalDate& last_login_date, const InternalEmployeePtr& changer
 )
 {
-    bool changed = true;
-    if (this->last_login_date == nullptr || last_login_date == nullptr) {
-        if (this->last_login_date == last_login_date) changed = false;
-    } else if (*this->last_login_date == *last_login_date) {
-        changed = false;
-    }
-
-    if (!changed) return false;
+    if (this->last_login_date == last_login_date) return false;
 
     Date update = Date();
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->last_login_date),
-        PTR_TO_OPTIONAL(last_login_date),
+        OPTIONAL_TO_VALUE(this->last_login_date),
+        OPTIONAL_TO_VALUE(last_login_date),
         InternalEmployeeFields::LastLoginDate,
         this->last_login_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         last_login_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->updateAt(update);
     this->last_login_date = last_login_date;
     return true;
 }
 
 bool InternalEmployee::setLastActionDate(
-    const DatePtr& last_action_date, const InternalEmployeePtr& changer
+    const OptionalDate& last_action_date, const InternalEmployeePtr& changer
 )
 {
-    bool changed = true;
-    if (this->last_action_date == nullptr || last_action_date == nullptr) {
-        if (this->last_action_date == last_action_date) changed = false;
-    } else if (*this->last_action_date == *last_action_date) {
-        changed = false;
-    }
-
-    if (!changed) return false;
+    if (this->last_action_date == last_action_date) return false;
 
     Date update = Date();
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->last_action_date),
-        PTR_TO_OPTIONAL(last_action_date),
+        OPTIONAL_TO_VALUE(this->last_action_date),
+        OPTIONAL_TO_VALUE(last_action_date),
         InternalEmployeeFields::LastActionDate,
         this->last_action_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         last_action_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->updateAt(update);
     this->last_action_date = last_action_date;
     return true;
@@ -431,7 +450,7 @@ bool InternalEmployee::setIsActive(bool is_active, const InternalEmployeePtr& ch
 {
     if (this->is_active != is_active) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->is_active),
             std::make_optional(is_active),
@@ -440,7 +459,7 @@ bool InternalEmployee::setIsActive(bool is_active, const InternalEmployeePtr& ch
             ChangeLog::FieldType::Bool,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->is_active = is_active;
         return true;
@@ -449,29 +468,22 @@ bool InternalEmployee::setIsActive(bool is_active, const InternalEmployeePtr& ch
 }
 
 bool InternalEmployee::setNextReviewDate(
-    const DatePtr& next_review_date, const InternalEmployeePtr& changer
+    const OptionalDate& next_review_date, const InternalEmployeePtr& changer
 )
 {
-    bool changed = true;
-    if (this->next_review_date == nullptr || next_review_date == nullptr) {
-        if (this->next_review_date == next_review_date) changed = false;
-    } else if (*this->next_review_date == *next_review_date) {
-        changed = false;
-    }
-
-    if (!changed) return false;
+    if (this->next_review_date == next_review_date) return false;
 
     Date update = Date();
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->next_review_date),
-        PTR_TO_OPTIONAL(next_review_date),
+        OPTIONAL_TO_VALUE(this->next_review_date),
+        OPTIONAL_TO_VALUE(next_review_date),
         InternalEmployeeFields::NextReviewDate,
         this->next_review_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         next_review_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->updateAt(update);
     this->next_review_date = next_review_date;
     return true;
@@ -481,7 +493,7 @@ bool InternalEmployee::setTimeZone(const int time_zone, const InternalEmployeePt
 {
     if (this->time_zone != time_zone) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->time_zone),
             std::make_optional(time_zone),
@@ -490,7 +502,7 @@ bool InternalEmployee::setTimeZone(const int time_zone, const InternalEmployeePt
             ChangeLog::FieldType::Int,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->time_zone = time_zone;
         return true;
@@ -504,7 +516,7 @@ bool InternalEmployee::setCommissionRate(
 {
     if (this->commission_rate != commission_rate) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->commission_rate,
             commission_rate,
@@ -515,7 +527,7 @@ bool InternalEmployee::setCommissionRate(
                                             : ChangeLog::FieldType::Double,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->commission_rate = commission_rate;
         return true;
@@ -537,7 +549,7 @@ bool InternalEmployee::setBaseSalary(
     if (!changed) return false;
 
     Date update = Date();
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->base_salary),
         PTR_TO_OPTIONAL(base_salary),
@@ -546,7 +558,7 @@ bool InternalEmployee::setBaseSalary(
         base_salary ? ChangeLog::FieldType::Money : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->updateAt(update);
     this->base_salary = base_salary;
     return true;
@@ -558,7 +570,7 @@ bool InternalEmployee::setPerformanceScore(
 {
     if (this->performance_score != performance_score) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->performance_score,
             performance_score,
@@ -567,7 +579,7 @@ bool InternalEmployee::setPerformanceScore(
             performance_score ? ChangeLog::FieldType::Double : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->updateAt(update);
         this->performance_score = performance_score;
         return true;
@@ -575,57 +587,45 @@ bool InternalEmployee::setPerformanceScore(
     return false;
 }
 
-bool InternalEmployee::setHireDate(const DatePtr& hire_date, const InternalEmployeePtr& changer)
+bool InternalEmployee::setHireDate(
+    const OptionalDate& hire_date, const InternalEmployeePtr& changer
+)
 {
-    bool changed = true;
-    if (this->hire_date == nullptr || hire_date == nullptr) {
-        if (this->hire_date == hire_date) changed = false;
-    } else if (*this->hire_date == *hire_date) {
-        changed = false;
-    }
-
-    if (!changed) return false;
+    if (this->hire_date == hire_date) return false;
 
     Date update = Date();
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->hire_date),
-        PTR_TO_OPTIONAL(hire_date),
+        OPTIONAL_TO_VALUE(this->hire_date),
+        OPTIONAL_TO_VALUE(hire_date),
         InternalEmployeeFields::HireDate,
         this->hire_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         hire_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->updateAt(update);
     this->hire_date = hire_date;
     return true;
 }
 
 bool InternalEmployee::setDismissalDate(
-    const DatePtr& dismissal_date, const InternalEmployeePtr& changer
+    const OptionalDate& dismissal_date, const InternalEmployeePtr& changer
 )
 {
-    bool changed = true;
-    if (this->dismissal_date == nullptr || dismissal_date == nullptr) {
-        if (this->dismissal_date == dismissal_date) changed = false;
-    } else if (*this->dismissal_date == *dismissal_date) {
-        changed = false;
-    }
-
-    if (!changed) return false;
+    if (this->dismissal_date == dismissal_date) return false;
 
     Date update = Date();
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->dismissal_date),
-        PTR_TO_OPTIONAL(dismissal_date),
+        OPTIONAL_TO_VALUE(this->dismissal_date),
+        OPTIONAL_TO_VALUE(dismissal_date),
         InternalEmployeeFields::DismissalDate,
         this->dismissal_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         dismissal_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->updateAt(update);
     this->dismissal_date = dismissal_date;
     return true;
@@ -641,7 +641,7 @@ bool InternalEmployee::addManagerDeal(const WeakDealPtr& deal, const InternalEmp
             }
         ) == this->managed_deals.end()) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(deal),
@@ -650,7 +650,7 @@ bool InternalEmployee::addManagerDeal(const WeakDealPtr& deal, const InternalEmp
             ChangeLog::FieldType::WeakDeal,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->addRelatedDeals(deal, changer, update);
         this->managed_deals.push_back(deal);
@@ -663,7 +663,7 @@ bool InternalEmployee::delManagerDeal(size_t index, const InternalEmployeePtr& c
 {
     if (this->managed_deals.size() > index) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->managed_deals[index]),
             std::nullopt,
@@ -672,7 +672,7 @@ bool InternalEmployee::delManagerDeal(size_t index, const InternalEmployeePtr& c
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->delRelatedDeals(this->managed_deals[index], changer, update);
         this->managed_deals.erase(this->managed_deals.begin() + index);
@@ -686,7 +686,7 @@ bool InternalEmployee::addProposedOffer(const OfferPtr& offer, const InternalEmp
     if (std::find(this->proposed_offers.begin(), this->proposed_offers.end(), offer) ==
         this->proposed_offers.end()) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(offer),
@@ -695,7 +695,7 @@ bool InternalEmployee::addProposedOffer(const OfferPtr& offer, const InternalEmp
             ChangeLog::FieldType::Offer,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->proposed_offers.push_back(offer);
         return true;
@@ -707,7 +707,7 @@ bool InternalEmployee::delProposedOffer(size_t index, const InternalEmployeePtr&
 {
     if (this->proposed_offers.size() > index) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->proposed_offers[index]),
             std::nullopt,
@@ -716,7 +716,7 @@ bool InternalEmployee::delProposedOffer(size_t index, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->proposed_offers.erase(this->proposed_offers.begin() + index);
         return true;
@@ -734,7 +734,7 @@ bool InternalEmployee::addLead(const WeakClientPtr& lead, const InternalEmployee
             }
         ) == this->leads.end()) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(lead),
@@ -743,7 +743,7 @@ bool InternalEmployee::addLead(const WeakClientPtr& lead, const InternalEmployee
             ChangeLog::FieldType::WeakClient,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->leads.push_back(lead);
         return true;
@@ -755,7 +755,7 @@ bool InternalEmployee::delLead(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->leads.size() > index) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->leads[index]),
             std::nullopt,
@@ -764,7 +764,7 @@ bool InternalEmployee::delLead(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->leads.erase(this->leads.begin() + index);
         return true;
@@ -777,7 +777,7 @@ bool InternalEmployee::addMonthlyQuota(const Money& quota, const InternalEmploye
     if (std::find(this->monthly_quota.begin(), this->monthly_quota.end(), quota) ==
         this->monthly_quota.end()) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(std::make_shared<Money>(quota)),
@@ -786,7 +786,7 @@ bool InternalEmployee::addMonthlyQuota(const Money& quota, const InternalEmploye
             ChangeLog::FieldType::Money,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->monthly_quota.push_back(quota);
         return true;
@@ -798,7 +798,7 @@ bool InternalEmployee::delMonthlyQuota(size_t index, const InternalEmployeePtr&
 {
     if (this->monthly_quota.size() > index) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<Money>(this->monthly_quota[index])),
             std::nullopt,
@@ -807,7 +807,7 @@ bool InternalEmployee::delMonthlyQuota(size_t index, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->monthly_quota.erase(this->monthly_quota.begin() + index);
         return true;
@@ -819,7 +819,7 @@ bool InternalEmployee::addTask(const TaskPtr& task, const InternalEmployeePtr& c
 {
     if (std::find(this->tasks.begin(), this->tasks.end(), task) == this->tasks.end()) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(task),
@@ -828,7 +828,7 @@ bool InternalEmployee::addTask(const TaskPtr& task, const InternalEmployeePtr& c
             ChangeLog::FieldType::Task,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->tasks.push_back(task);
         return true;
@@ -840,7 +840,7 @@ bool InternalEmployee::delTask(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->tasks.size() > index) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->tasks[index]),
             std::nullopt,
@@ -849,7 +849,7 @@ bool InternalEmployee::delTask(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->tasks.erase(this->tasks.begin() + index);
         return true;
@@ -862,7 +862,7 @@ bool InternalEmployee::addDocument(const DocumentPtr& document, const InternalEm
     if (std::find(this->documents.begin(), this->documents.end(), document) ==
         this->documents.end()) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(document),
@@ -871,7 +871,7 @@ bool InternalEmployee::addDocument(const DocumentPtr& document, const InternalEm
             ChangeLog::FieldType::Document,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->documents.push_back(document);
         return true;
@@ -883,7 +883,7 @@ bool InternalEmployee::delDocument(size_t index, const InternalEmployeePtr& chan
 {
     if (this->documents.size() > index) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->documents[index]),
             std::nullopt,
@@ -892,7 +892,7 @@ bool InternalEmployee::delDocument(size_t index, const InternalEmployeePtr& chan
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->documents.erase(this->documents.begin() + index);
         return true;
@@ -904,16 +904,16 @@ bool InternalEmployee::addSkill(const std::string& skill, const InternalEmployee
 {
     if (std::find(this->skills.begin(), this->skills.end(), skill) == this->skills.end()) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional(std::make_shared<std::string>(skill)),
+            ChangeValue::fromText(skill),
             InternalEmployeeFields::Skills,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->skills.push_back(skill);
         return true;
@@ -925,16 +925,16 @@ bool InternalEmployee::delSkill(size_t index, const InternalEmployeePtr& changer
 {
     if (this->skills.size() > index) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->skills[index])),
+            ChangeValue::fromText(this->skills[index]),
             std::nullopt,
             InternalEmployeeFields::Skills,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->skills.erase(this->skills.begin() + index);
         return true;
@@ -954,7 +954,7 @@ bool InternalEmployee::addDirectReport(
             }
         ) == this->direct_reports.end()) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(report),
@@ -963,7 +963,7 @@ bool InternalEmployee::addDirectReport(
             ChangeLog::FieldType::WeakInternalEmployee,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->updateAt(update);
         this->direct_reports.push_back(report);
         return true;
@@ -975,7 +975,7 @@ bool InternalEmployee::delDirectReport(size_t index, const InternalEmployeePtr&
 {
     if (this->direct_reports.size() > index) {
         Date update = Date();
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->direct_reports[index]),
             std::nullopt,
@@ -984,7 +984,7 @@ bool InternalEmployee::delDirectReport(size_t index, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->updateAt(update);
         this->direct_reports.erase(this->direct_reports.begin() + index);
         return true;
@@ -25,7 +25,7 @@ public:
         const std::string&                surname,
         const OptionalStr&                patronymic,
         const OptionalStr&                preferred_language,
-        const DatePtr&                    birthday,
+        const OptionalDate&               birthday,
         const PhoneNumberPtr&             phone_number,
         const AddressPtr&                 address,
         const OptionalStr&                email,
@@ -38,15 +38,15 @@ public:
         const EmployeeStatus&             status,
         const OptionalStr&                other_status,
         const OptionalStr&                sales_territory,
-        const DatePtr&                    last_login_date,
-        const DatePtr&                    last_action_date,
+        const OptionalDate&               last_login_date,
+        const OptionalDate&               last_action_date,
         int                               time_zone,
         const std::optional<double>&      commission_rate,
         const MoneyPtr&                   base_salary,
         const std::optional<double>&      performance_score,
-        const DatePtr&                    next_review_date,
-        const DatePtr&                    hire_date,
-        const DatePtr&                    dismissal_date,
+        const OptionalDate&               next_review_date,
+        const OptionalDate&               hire_date,
+        const OptionalDate&               dismissal_date,
         std::vector<WeakClientPtr>        leads,
         std::vector<Note>                 notes,
         std::vector<Money>                monthly_quota,
@@ -68,20 +68,20 @@ public:
     /// @name Getters
     /// @{
     auto getManager() const -> const WeakInternalEmployee&;
-    auto getPosition() const -> const OptionalStr&;
-    auto getDepartment() const -> const OptionalStr&;
+    auto getPosition() const -> const OptionalInterned&;
+    auto getDepartment() const -> const OptionalInterned&;
     auto getAccessRole() const -> AccessRole;
-    auto getOtherRole() const -> const OptionalStr&;
+    auto getOtherRole() const -> const OptionalInterned&;
     auto getStatus() const -> EmployeeStatus;
-    auto getOtherStatus() const -> const OptionalStr&;
-    auto getSalesTerritory() const -> const OptionalStr&;
-    auto getLastLoginDate() const -> const DatePtr&;
-    auto getLastActionDate() const -> const DatePtr&;
+    auto getOtherStatus() const -> const OptionalInterned&;
+    auto getSalesTerritory() const -> const OptionalInterned&;
+    auto getLastLoginDate() const -> const OptionalDate&;
+    auto getLastActionDate() const -> const OptionalDate&;
     auto getTimeZone() const -> int;
     auto getIsActive() const -> bool;
-    auto getNextReviewDate() const -> const DatePtr&;
-    auto getHireDate() const -> const DatePtr&;
-    auto getDismissalDate() const -> const DatePtr&;
+    auto getNextReviewDate() const -> const OptionalDate&;
+    auto getHireDate() const -> const OptionalDate&;
+    auto getDismissalDate() const -> const OptionalDate&;
 
     auto getManagedDeals() const -> const std::vector<WeakDealPtr>&;
     auto getProposedOffers() const -> const std::vector<OfferPtr>&;
@@ -113,11 +113,15 @@ private:
 
     // public functions
 public:
-    bool setLastLoginDate(const DatePtr& last_login_date, const InternalEmployeePtr& changer);
-    bool setLastActionDate(const DatePtr& last_action_date, const InternalEmployeePtr& changer);
-    bool setNextReviewDate(const DatePtr& next_review_date, const InternalEmployeePtr& changer);
-    bool setHireDate(const DatePtr& hire_date, const InternalEmployeePtr& changer);
-    bool setDismissalDate(const DatePtr& dismissal_date, const InternalEmployeePtr& changer);
+    bool setLastLoginDate(const OptionalDate& last_login_date, const InternalEmployeePtr& changer);
+    bool setLastActionDate(
+        const OptionalDate& last_action_date, const InternalEmployeePtr& changer
+    );
+    bool setNextReviewDate(
+        const OptionalDate& next_review_date, const InternalEmployeePtr& changer
+    );
+    bool setHireDate(const OptionalDate& hire_date, const InternalEmployeePtr& changer);
+    bool setDismissalDate(const OptionalDate& dismissal_date, const InternalEmployeePtr& changer);
 
     bool setCommissionRate(
         const std::optional<double>& commission_rate, const InternalEmployeePtr& changer
@@ -160,20 +164,20 @@ public:
 
 private:
     WeakInternalEmployee manager;
-    OptionalStr          position;
-    OptionalStr          department;
+    OptionalInterned     position;
+    OptionalInterned     department;
     AccessRole           access_role;
-    OptionalStr          other_role;
+    OptionalInterned     other_role;
     EmployeeStatus       status;
-    OptionalStr          other_status;
-    OptionalStr          sales_territory;
-    DatePtr              last_login_date;
-    DatePtr              last_action_date;
+    OptionalInterned     other_status;
+    OptionalInterned     sales_territory;
+    OptionalDate         last_login_date;
+    OptionalDate         last_action_date;
     int                  time_zone;  /// UTC +/-
     bool                 is_active;
-    DatePtr              next_review_date;
-    DatePtr              hire_date;
-    DatePtr              dismissal_date;
+    OptionalDate         next_review_date;
+    OptionalDate         hire_date;
+    OptionalDate         dismissal_date;
     MoneyPtr             base_salary;
 
     //
@@ -188,6 +192,9 @@ private:
     std::vector<std::string>          skills;
     std::vector<WeakInternalEmployee> direct_reports;
 
+    /// Fields of the person and of the employee, for `InternalEmployeeDataBase::add`
+    auto getInitialState() const -> InitialState;
+
     friend InternalEmployeeDataBase;
 
 #ifdef _TESTING
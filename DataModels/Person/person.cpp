@@ -1,7 +1,9 @@
 #include "person.hpp"
 
+#include <algorithm>
+
 #include "Campaign/campaign.hpp"
-#include "ChangeLog/change_log.hpp"
+#include "ChangeLog/change_journal.hpp"
 #include "Company/company.hpp"
 
 Person::Person(
@@ -20,7 +22,7 @@ Person::Person(
     const std::string&           surname,
     const OptionalStr&           patronymic,
     const OptionalStr&           preferred_language,
-    const DatePtr&               birthday,
+    const OptionalDate&          birthday,
     const PhoneNumberPtr&        phone_number,
     const AddressPtr&            address,
     const OptionalStr&           email,
@@ -52,7 +54,7 @@ Person::Person(
     , other_documents(std::move(other_documents))
     , other_files(std::move(other_files))
     , interaction_history(std::move(interaction_history))
-    , tags(std::move(tags))
+    , tags(InternedStr::fromList(tags))
     , notes(std::move(notes))
 {
     this->created_at = Date();
@@ -63,7 +65,7 @@ auto Person::getName() const -> const std::string& { return this->name; }
 auto Person::getSurname() const -> const std::string& { return this->surname; }
 auto Person::getPatronymic() const -> const OptionalStr& { return this->patronymic; }
 auto Person::getPreferredLanguage() const -> const OptionalStr& { return this->preferred_language; }
-auto Person::getBirthday() const -> const DatePtr& { return this->birthday; }
+auto Person::getBirthday() const -> const OptionalDate& { return this->birthday; }
 auto Person::getCreatedAt() const -> const Date& { return this->created_at; }
 auto Person::getUpdateAt() const -> const Date& { return this->update_at; }
 auto Person::getPhoneNumber() const -> const PhoneNumberPtr { return this->phone_number; }
@@ -105,25 +107,53 @@ auto Person::getInteractionHistory() const -> const std::vector<InteractionPtr>&
 {
     return this->interaction_history;
 }
-auto Person::getTags() const -> const std::vector<std::string>& { return this->tags; }
+auto Person::getTags() const -> const std::vector<InternedStr>& { return this->tags; }
 auto Person::getNotes() const -> const std::vector<Note>& { return this->notes; }
-auto Person::getChangeLogs() const -> const std::vector<ChangeLogPtr>& { return this->change_logs; }
+auto Person::getChangeLogs() const -> ChangeLogView
+{
+    return ChangeLogView(this->change_logs);
+}
+auto Person::getStateAt(const Date& date) const -> EntityState
+{
+    return ChangeJournal::getInstance().getStateAt(this->change_logs, date);
+}
+
+auto Person::getInitialState() const -> InitialState
+{
+    using Type = ChangeLog::FieldType;
+
+    InitialState state(this->created_at);
+    state.set(PersonFields::Name, Type::String, ChangeValue::fromText(this->name));
+    state.set(PersonFields::Surname, Type::String, ChangeValue::fromText(this->surname));
+    state.set(PersonFields::Patronymic, Type::String, OPTIONAL_STR_TO_VALUE(this->patronymic));
+    state.set(
+        PersonFields::PreferredLanguage,
+        Type::String,
+        OPTIONAL_STR_TO_VALUE(this->preferred_language)
+    );
+    state.set(PersonFields::Birthday, Type::Date, this->birthday);
+    state.set(PersonFields::PhoneNumber, Type::PhoneNumber, PTR_TO_OPTIONAL(this->phone_number));
+    state.set(PersonFields::Address, Type::Address, PTR_TO_OPTIONAL(this->address));
+    state.set(PersonFields::Email, Type::String, OPTIONAL_STR_TO_VALUE(this->email));
+    state.set(PersonFields::Gender, Type::Gender, this->gender);
+    return state;
+}
 
 bool Person::setName(const std::string& name, const InternalEmployeePtr& changer)
 {
     if (this->name != name) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->name)),
-            std::make_optional(std::make_shared<std::string>(name)),
+            ChangeValue::fromText(this->name),
+            ChangeValue::fromText(name),
             PersonFields::Name,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->name = name;
         return true;
     }
@@ -135,16 +165,16 @@ bool Person::setSurname(const std::string& surname, const InternalEmployeePtr& c
     if (this->surname != surname) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->surname)),
-            std::make_optional(std::make_shared<std::string>(surname)),
+            ChangeValue::fromText(this->surname),
+            ChangeValue::fromText(surname),
             PersonFields::Surname,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->surname = surname;
         return true;
     }
@@ -157,7 +187,7 @@ bool Person::setPatronymic(const OptionalStr& patronymic, const InternalEmployee
         Date update     = Date();
         this->update_at = update;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->patronymic),
             OPTIONAL_STR_TO_VALUE(patronymic),
@@ -166,7 +196,7 @@ bool Person::setPatronymic(const OptionalStr& patronymic, const InternalEmployee
             patronymic ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->patronymic = patronymic;
         return true;
     }
@@ -179,7 +209,7 @@ bool Person::setPreferredLanguage(const OptionalStr& lan, const InternalEmployee
         Date update     = Date();
         this->update_at = update;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->preferred_language),
             OPTIONAL_STR_TO_VALUE(lan),
@@ -188,37 +218,29 @@ bool Person::setPreferredLanguage(const OptionalStr& lan, const InternalEmployee
             lan ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->preferred_language = lan;
         return true;
     }
     return false;
 }
 
-bool Person::setBirthday(const DatePtr& birthday, const InternalEmployeePtr& changer)
+bool Person::setBirthday(const OptionalDate& birthday, const InternalEmployeePtr& changer)
 {
-    bool isChanged = false;
-
-    if (this->birthday == nullptr || birthday == nullptr) {
-        isChanged = (this->birthday != birthday);
-    } else {
-        isChanged = !(*this->birthday == *birthday);
-    }
-
-    if (isChanged) {
+    if (this->birthday != birthday) {
         Date update     = Date();
         this->update_at = update;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            PTR_TO_OPTIONAL(this->birthday),
-            PTR_TO_OPTIONAL(birthday),
+            OPTIONAL_TO_VALUE(this->birthday),
+            OPTIONAL_TO_VALUE(birthday),
             PersonFields::Birthday,
             this->birthday ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
             birthday ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->birthday = birthday;
         return true;
     }
@@ -238,7 +260,7 @@ bool Person::setPhoneNumber(const PhoneNumberPtr& number, const InternalEmployee
     Date update     = Date();
     this->update_at = update;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->phone_number),
         PTR_TO_OPTIONAL(number),
@@ -247,7 +269,7 @@ bool Person::setPhoneNumber(const PhoneNumberPtr& number, const InternalEmployee
         number ? ChangeLog::FieldType::PhoneNumber : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->phone_number = number;
     return true;
 }
@@ -265,7 +287,7 @@ bool Person::setAddress(const AddressPtr& address, const InternalEmployeePtr& ch
     Date update     = Date();
     this->update_at = update;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
         PTR_TO_OPTIONAL(this->address),
         PTR_TO_OPTIONAL(address),
@@ -274,7 +296,7 @@ bool Person::setAddress(const AddressPtr& address, const InternalEmployeePtr& ch
         address ? ChangeLog::FieldType::Address : ChangeLog::FieldType::null,
         ChangeLog::Action::Change,
         update
-    ));
+    );
     this->address = address;
     return true;
 }
@@ -285,7 +307,7 @@ bool Person::setEmail(const OptionalStr& email, const InternalEmployeePtr& chang
         Date update     = Date();
         this->update_at = update;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->email),
             OPTIONAL_STR_TO_VALUE(email),
@@ -294,7 +316,7 @@ bool Person::setEmail(const OptionalStr& email, const InternalEmployeePtr& chang
             email ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->email = email;
         return true;
     }
@@ -307,7 +329,7 @@ bool Person::setGender(const Gender gender, const InternalEmployeePtr& changer)
         Date update     = Date();
         this->update_at = update;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->gender),
             std::make_optional(gender),
@@ -316,7 +338,7 @@ bool Person::setGender(const Gender gender, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Gender,
             ChangeLog::Action::Change,
             update
-        ));
+        );
         this->gender = gender;
         return true;
     }
@@ -336,7 +358,7 @@ bool Person::addRelatedDeals(
         ) == this->related_deals.end()) {
         this->update_at = change_date;
 
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(weak_deal),
@@ -345,7 +367,7 @@ bool Person::addRelatedDeals(
             ChangeLog::FieldType::WeakDeal,
             ChangeLog::Action::Add,
             change_date
-        ));
+        );
         this->related_deals.push_back(weak_deal);
         return true;
     }
@@ -368,7 +390,7 @@ bool Person::delRelatedDeals(
         }
     );
     if (del_deal != this->related_deals.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(del_deal[0]),
             std::nullopt,
@@ -377,7 +399,7 @@ bool Person::delRelatedDeals(
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             change_date
-        ));
+        );
         this->related_deals.erase(del_deal);
         return true;
     }
@@ -390,7 +412,7 @@ bool Person::addMorePhoneNumber(const PhoneNumber& number, const InternalEmploye
         this->more_phone_numbers.end()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(std::make_shared<PhoneNumber>(number)),
@@ -399,7 +421,7 @@ bool Person::addMorePhoneNumber(const PhoneNumber& number, const InternalEmploye
             ChangeLog::FieldType::PhoneNumber,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->more_phone_numbers.push_back(number);
         return true;
     }
@@ -411,7 +433,7 @@ bool Person::delMorePhoneNumber(size_t index, const InternalEmployeePtr& changer
     if (this->more_phone_numbers.size() > index) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<PhoneNumber>(this->more_phone_numbers[index])),
             std::nullopt,
@@ -420,7 +442,7 @@ bool Person::delMorePhoneNumber(size_t index, const InternalEmployeePtr& changer
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->more_phone_numbers.erase(this->more_phone_numbers.begin() + index);
         return true;
     }
@@ -433,7 +455,7 @@ bool Person::addMoreAddress(const Address& address, const InternalEmployeePtr& c
         this->more_addresses.end()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(std::make_shared<Address>(address)),
@@ -442,7 +464,7 @@ bool Person::addMoreAddress(const Address& address, const InternalEmployeePtr& c
             ChangeLog::FieldType::Address,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->more_addresses.push_back(address);
         return true;
     }
@@ -454,7 +476,7 @@ bool Person::delMoreAddress(size_t index, const InternalEmployeePtr& changer)
     if (this->more_addresses.size() > index) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<Address>(this->more_addresses[index])),
             std::nullopt,
@@ -463,7 +485,7 @@ bool Person::delMoreAddress(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->more_addresses.erase(this->more_addresses.begin() + index);
         return true;
     }
@@ -476,16 +498,16 @@ bool Person::addMoreEmails(const std::string& email, const InternalEmployeePtr&
         this->more_emails.end()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional(std::make_shared<std::string>(email)),
+            ChangeValue::fromText(email),
             PersonFields::MoreEmail,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->more_emails.push_back(email);
         return true;
     }
@@ -497,16 +519,16 @@ bool Person::delMoreEmails(size_t index, const InternalEmployeePtr& changer)
     if (this->more_emails.size() > index) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->more_emails[index])),
+            ChangeValue::fromText(this->more_emails[index]),
             std::nullopt,
             PersonFields::MoreEmail,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->more_emails.erase(this->more_emails.begin() + index);
         return true;
     }
@@ -519,7 +541,7 @@ bool Person::addOtherDocument(const DocumentPtr& document, const InternalEmploye
         this->other_documents.end()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(document),
@@ -528,7 +550,7 @@ bool Person::addOtherDocument(const DocumentPtr& document, const InternalEmploye
             ChangeLog::FieldType::Document,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->other_documents.push_back(document);
         return true;
     }
@@ -540,7 +562,7 @@ bool Person::delOtherDocument(size_t index, const InternalEmployeePtr& changer)
     if (index < this->other_documents.size()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->other_documents[index]),
             std::nullopt,
@@ -549,7 +571,7 @@ bool Person::delOtherDocument(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->other_documents.erase(this->other_documents.begin() + index);
         return true;
     }
@@ -562,7 +584,7 @@ bool Person::addOtherFile(const FileMetadataPtr& file, const InternalEmployeePtr
         this->other_files.end()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(file),
@@ -571,7 +593,7 @@ bool Person::addOtherFile(const FileMetadataPtr& file, const InternalEmployeePtr
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->other_files.push_back(file);
         return true;
     }
@@ -583,7 +605,7 @@ bool Person::delOtherFile(size_t index, const InternalEmployeePtr& changer)
     if (index < this->other_files.size()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->other_files[index]),
             std::nullopt,
@@ -592,7 +614,7 @@ bool Person::delOtherFile(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->other_files.erase(this->other_files.begin() + index);
         return true;
     }
@@ -606,7 +628,7 @@ bool Person::addInteraction(const InteractionPtr& interaction, const InternalEmp
         ) == this->interaction_history.end()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(interaction),
@@ -615,7 +637,7 @@ bool Person::addInteraction(const InteractionPtr& interaction, const InternalEmp
             ChangeLog::FieldType::BaseInteraction,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->interaction_history.push_back(interaction);
         return true;
     }
@@ -627,7 +649,7 @@ bool Person::delInteraction(size_t index, const InternalEmployeePtr& changer)
     if (index < this->interaction_history.size()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->interaction_history[index]),
             std::nullopt,
@@ -636,7 +658,7 @@ bool Person::delInteraction(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->interaction_history.erase(this->interaction_history.begin() + index);
         return true;
     }
@@ -648,17 +670,17 @@ bool Person::addTag(const std::string& tag, const InternalEmployeePtr& changer)
     if (std::find(this->tags.begin(), this->tags.end(), tag) == this->tags.end()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional(std::make_shared<std::string>(tag)),
+            ChangeValue::fromText(tag),
             PersonFields::Tags,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add,
             update
-        ));
-        this->tags.push_back(tag);
+        );
+        this->tags.emplace_back(tag);
         return true;
     }
     return false;
@@ -669,16 +691,16 @@ bool Person::delTag(size_t index, const InternalEmployeePtr& changer)
     if (index < this->tags.size()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->tags[index])),
+            ChangeValue::fromText(this->tags[index]),
             std::nullopt,
             PersonFields::Tags,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->tags.erase(this->tags.begin() + index);
         return true;
     }
@@ -690,7 +712,7 @@ bool Person::addNote(const Note& note, const InternalEmployeePtr& changer)
     if (std::find(this->notes.begin(), this->notes.end(), note) == this->notes.end()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(std::make_shared<Note>(note)),
@@ -699,7 +721,7 @@ bool Person::addNote(const Note& note, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Note,
             ChangeLog::Action::Add,
             update
-        ));
+        );
         this->notes.push_back(note);
         return true;
     }
@@ -711,7 +733,7 @@ bool Person::delNote(size_t index, const InternalEmployeePtr& changer)
     if (index < this->notes.size()) {
         Date update     = Date();
         this->update_at = update;
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<Note>(this->notes[index])),
             std::nullopt,
@@ -720,7 +742,7 @@ bool Person::delNote(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove,
             update
-        ));
+        );
         this->notes.erase(this->notes.begin() + index);
         return true;
     }
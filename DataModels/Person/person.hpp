@@ -2,6 +2,7 @@
 #include <vector>
 
 #include "Address/address.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "DateTime/date.hpp"
 #include "Document/document.hpp"
 #include "FileMetadata/file_metadata.hpp"
@@ -9,6 +10,7 @@
 #include "Note/note.hpp"
 #include "PhoneNumber/phone_number.hpp"
 #include "SocialNetwork/social_network.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 
 #ifdef _DEBUG
@@ -30,7 +32,7 @@ public:
         const std::string&           surname,
         const OptionalStr&           patronymic,
         const OptionalStr&           preferred_language,
-        const DatePtr&               birthday,
+        const OptionalDate&          birthday,
         const PhoneNumberPtr&        phone_number,
         const AddressPtr&            address,
         const OptionalStr&           email,
@@ -56,7 +58,7 @@ public:
     auto getSurname() const -> const std::string&;
     auto getPatronymic() const -> const OptionalStr&;
     auto getPreferredLanguage() const -> const OptionalStr&;
-    auto getBirthday() const -> const DatePtr&;
+    auto getBirthday() const -> const OptionalDate&;
     auto getCreatedAt() const -> const Date&;
     auto getUpdateAt() const -> const Date&;
     auto getPhoneNumber() const -> const PhoneNumberPtr;
@@ -73,9 +75,11 @@ public:
     auto getOtherDocuments() const -> const std::vector<DocumentPtr>&;
     auto getOtherFiles() const -> const std::vector<FileMetadataPtr>&;
     auto getInteractionHistory() const -> const std::vector<InteractionPtr>&;
-    auto getTags() const -> const std::vector<std::string>&;
+    auto getTags() const -> const std::vector<InternedStr>&;
     auto getNotes() const -> const std::vector<Note>&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
+    /// Fields as the change history had left them at `date`
+    auto getStateAt(const Date& date) const -> EntityState;
     /// @}
 
     /// @name Change functions
@@ -97,7 +101,7 @@ public:
     bool setSurname(const std::string& surname, const InternalEmployeePtr& changer);
     bool setPatronymic(const OptionalStr& patronymic, const InternalEmployeePtr& changer);
     bool setPreferredLanguage(const OptionalStr& lan, const InternalEmployeePtr& changer);
-    bool setBirthday(const DatePtr& birthday, const InternalEmployeePtr& changer);
+    bool setBirthday(const OptionalDate& birthday, const InternalEmployeePtr& changer);
     bool setAddress(const AddressPtr& address, const InternalEmployeePtr& changer);
     bool setGender(const Gender gender, const InternalEmployeePtr& changer);
 
@@ -145,7 +149,7 @@ private:
     OptionalStr    patronymic;
     OptionalStr    preferred_language;
 
-    DatePtr        birthday;
+    OptionalDate   birthday;
     Date           created_at;
     Date           update_at;
     PhoneNumberPtr phone_number;
@@ -163,7 +167,7 @@ private:
     std::vector<DocumentPtr>     other_documents;
     std::vector<FileMetadataPtr> other_files;
     std::vector<InteractionPtr>  interaction_history;
-    std::vector<std::string>     tags;
+    std::vector<InternedStr>     tags;
     std::vector<Note>            notes;
 
     friend class ClientDataBase;
@@ -209,5 +213,8 @@ public:
 #endif  // _TESTING
 
 protected:
-    std::vector<ChangeLogPtr> change_logs;
+    /// Fields the person was created with, each kind of person adds its own
+    auto getInitialState() const -> InitialState;
+
+    ChangeChain               change_logs{EntityType::Person, id};
 };
\ No newline at end of file
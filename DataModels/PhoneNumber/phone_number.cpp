@@ -2,64 +2,89 @@
 
 #include <stdexcept>
 
+#include "BigNum/digits.hpp"
 #include "location.hpp"
 
+namespace {
+    constexpr PhoneNumber::Key value_mask = (PhoneNumber::Key(1) << 56) - 1;
+}  // namespace
+
 PhoneNumber::PhoneNumber(const std::string& phone_number)
 {
-    if (phone_number.size() < 11) {
+    if (!pack(phone_number, this->key)) {
         throw std::runtime_error(errors::phone_number_incorrect);
     }
+}
 
-    for (auto& ch : phone_number) {
-        if (!isdigit(ch)) {
-            throw std::runtime_error(errors::phone_number_incorrect);
-        }
-    }
+PhoneNumber::PhoneNumber(const Key key) : key(key) {}
 
-    this->country_code = std::stoi(phone_number.substr(0, phone_number.size() - 10));
-    this->area_code    = std::stoi(phone_number.substr(phone_number.size() - 10, 3));
-    this->exchange     = std::stoi(phone_number.substr(phone_number.size() - 7, 3));
-    this->number       = std::stoi(phone_number.substr(phone_number.size() - 4));
-    this->phone_number = phone_number;
+auto PhoneNumber::tryParse(std::string_view number) -> std::optional<PhoneNumber>
+{
+    Key key;
+    if (!pack(number, key)) return std::nullopt;
+    return PhoneNumber(key);
 }
 
-PhoneNumber::PhoneNumber(const PhoneNumber& phoneNumber)
+auto PhoneNumber::parseBatch(const std::string_view* numbers, Key* keys, const size_t count)
+    -> size_t
 {
-    this->country_code = phoneNumber.country_code;
-    this->area_code    = phoneNumber.area_code;
-    this->exchange     = phoneNumber.exchange;
-    this->number       = phoneNumber.number;
-    this->phone_number = phoneNumber.phone_number;
+    for (size_t i = 0; i < count; i++) {
+        if (!pack(numbers[i], keys[i])) return i;
+    }
+    return count;
 }
 
 void PhoneNumber::setNumber(const std::string& number)
 {
-    if (number.size() < 11) {
+    Key key;
+    if (!pack(number, key)) {
         throw std::runtime_error(errors::phone_number_incorrect);
     }
+    this->key = key;
+}
 
-    for (auto& ch : number) {
-        if (!isdigit(ch)) {
-            throw std::runtime_error(errors::phone_number_incorrect);
-        }
-    }
-
-    this->country_code = std::stoi(number.substr(0, number.size() - 10));
-    this->area_code    = std::stoi(number.substr(number.size() - 10, 3));
-    this->exchange     = std::stoi(number.substr(number.size() - 7, 3));
-    this->number       = std::stoi(number.substr(number.size() - 4));
-    this->phone_number = number;
+auto PhoneNumber::getNumber() const -> std::string
+{
+    char  buffer[max_chars];
+    char* end = this->toChars(buffer, buffer + sizeof(buffer));
+    return std::string(buffer, end);
 }
 
-const std::string& PhoneNumber::getNumber() const { return this->phone_number; }
+auto PhoneNumber::hash() const -> std::size_t
+{
+    // murmur3 finalizer
+    uint64_t result = this->key;
+    result ^= result >> 33;
+    result *= 0xff51afd7ed558ccdULL;
+    result ^= result >> 33;
+    result *= 0xc4ceb9fe1a85ec53ULL;
+    result ^= result >> 33;
+    return static_cast<std::size_t>(result);
+}
 
-//
-bool PhoneNumber::operator==(const PhoneNumber& other) const
+auto PhoneNumber::toChars(char* first, char* last, const bool with_plus) const -> char*
 {
-    return this->phone_number == other.phone_number;
+    uint8_t digits = this->getDigitCount();
+    if (last - first < digits + (with_plus ? 1 : 0)) return nullptr;
+
+    if (with_plus) *first++ = '+';
+
+    Key   value = this->key & value_mask;
+    char* end   = first + digits;
+    for (char* pos = end; pos != first;) {
+        *--pos = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return end;
 }
 
-bool PhoneNumber::operator!=(const PhoneNumber& other) const
+bool PhoneNumber::pack(std::string_view number, Key& key)
 {
-    return this->phone_number != other.phone_number;
+    if (!number.empty() && number.front() == '+') number.remove_prefix(1);
+    if (number.size() < min_digits || number.size() > max_digits) return false;
+
+    if (!digits::allDigits(number)) return false;
+
+    key = static_cast<Key>(number.size()) << 56 | digits::parse(number.data(), number.size());
+    return true;
 }
@@ -1,21 +1,65 @@
 #pragma once
+#include <stdint.h>
+
+#include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
 
+/**
+ * @struct PhoneNumber
+ * @brief Phone number normalized to E.164 digits and packed into one integer.
+ *
+ * The low 56 bits hold the digits as a decimal value, the high 8 bits hold the digit count so
+ * leading zeros survive a round trip. Comparing and hashing a number is a single integer
+ * operation and `getKey()` is used directly as the key of the phone indexes.
+ */
 struct PhoneNumber {
+    using Key = uint64_t;
+
+    static constexpr size_t min_digits = 11;
+    static constexpr size_t max_digits = 15;              ///< E.164 limit
+    static constexpr size_t max_chars  = max_digits + 1;  ///< Digits with the leading '+'
+
+    /// Accepts 11-15 digits with an optional leading '+', throws std::runtime_error otherwise
     PhoneNumber(const std::string& number);
-    PhoneNumber(const PhoneNumber& phone_number);
+    PhoneNumber(const PhoneNumber& phone_number) = default;
+
+    /// Same rules as the constructor, but returns std::nullopt instead of throwing
+    static auto tryParse(std::string_view number) -> std::optional<PhoneNumber>;
+    /// Packs a column of numbers into `keys[0, count)`. Stops at the first invalid number and
+    /// returns its index, or `count` when every number was packed.
+    static auto parseBatch(const std::string_view* numbers, Key* keys, const size_t count)
+        -> size_t;
 
-    void               setNumber(const std::string& number);
-    const std::string& getNumber() const;
+    void        setNumber(const std::string& number);
 
-    bool               operator==(const PhoneNumber& other) const;
-    bool               operator!=(const PhoneNumber& other) const;
+    /// @name Getters
+    /// @{
+    auto        getNumber() const -> std::string;
+    auto        getKey() const -> Key { return this->key; }
+    auto        getDigitCount() const -> uint8_t { return static_cast<uint8_t>(this->key >> 56); }
+    auto        hash() const -> std::size_t;
+    /// @}
+
+    /// Writes the digits into [first, last) without a terminator. Returns the end of the written
+    /// text, or nullptr when the buffer is too small (`max_chars` is always enough).
+    auto        toChars(char* first, char* last, bool with_plus = false) const -> char*;
+
+    PhoneNumber& operator=(const PhoneNumber& other) = default;
+    bool         operator==(const PhoneNumber& other) const { return this->key == other.key; }
+    bool         operator!=(const PhoneNumber& other) const { return this->key != other.key; }
 
 private:
-    uint16_t    country_code;  // 8
-    uint16_t    area_code;     // 800
-    uint16_t    exchange;      // 555
-    uint16_t    number;        // 3535
+    explicit PhoneNumber(const Key key);
+    static bool pack(std::string_view number, Key& key);
 
-    std::string phone_number;
+    Key         key = 0;
 };
+
+namespace std {
+    template <>
+    struct hash<PhoneNumber> {
+        std::size_t operator()(const PhoneNumber& number) const noexcept { return number.hash(); }
+    };
+}  // namespace std
@@ -1,20 +1,22 @@
 #include "report.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 
 Report::Report(
     const BigUint&                 id,
     const ReportType&              type,
     const OptionalStr&             other_type,
     std::vector<std::string>       data,
-    const DatePtr&                 generated_date,
+    const OptionalDate&            generated_date,
     const std::vector<StringPair>& parameters,
     const WeakInternalEmployee&    creator,
     const ExportFormat&            export_format
 )
     : id(id)
     , type(type)
-    , other_type(other_type)
+    , other_type(InternedStr::fromOptional(other_type))
     , data(std::move(data))
     , generated_date(generated_date)
     , parameters(parameters)
@@ -27,11 +29,11 @@ auto Report::getId() const -> const BigUint& { return this->id; }
 
 auto Report::getType() const -> ReportType { return this->type; }
 
-auto Report::getOtherType() const -> const OptionalStr& { return this->other_type; }
+auto Report::getOtherType() const -> const OptionalInterned& { return this->other_type; }
 
 auto Report::getData() const -> const std::vector<std::string>& { return this->data; }
 
-auto Report::getGeneratedDate() const -> const DatePtr& { return this->generated_date; }
+auto Report::getGeneratedDate() const -> const OptionalDate& { return this->generated_date; }
 
 auto Report::getParameters() const -> const std::vector<StringPair>& { return this->parameters; }
 
@@ -42,17 +44,17 @@ auto Report::getExportFormat() const -> ExportFormat { return this->export_forma
 bool Report::setType(ReportType type, const InternalEmployeePtr& changer)
 {
     if (this->type != type) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->other_type
-                ? std::make_optional(std::make_shared<std::string>(this->other_type.value()))
+                ? ChangeValue::fromText(this->other_type.value())
                 : std::make_optional<ChangeLog::ValueVariant>(this->type),
             std::make_optional(type),
             ReportFields::Type,
             this->other_type ? ChangeLog::FieldType::String : ChangeLog::FieldType::ReportType,
             ChangeLog::FieldType::ReportType,
             ChangeLog::Action::Change
-        ));
+        );
         this->type       = type;
         this->other_type = std::nullopt;
         return true;
@@ -63,18 +65,18 @@ bool Report::setType(ReportType type, const InternalEmployeePtr& changer)
 bool Report::setOtherType(const OptionalStr& other_type, const InternalEmployeePtr& changer)
 {
     if (this->other_type != other_type) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             this->other_type
-                ? std::make_optional(std::make_shared<std::string>(this->other_type.value()))
+                ? ChangeValue::fromText(this->other_type.value())
                 : std::make_optional<ChangeLog::ValueVariant>(this->type),
             OPTIONAL_STR_TO_VALUE(other_type),
             ReportFields::Type,
             this->other_type ? ChangeLog::FieldType::String : ChangeLog::FieldType::ReportType,
             other_type ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
-        this->other_type = other_type;
+        );
+        this->other_type = InternedStr::fromOptional(other_type);
         this->type       = ReportType::other;
         return true;
     }
@@ -84,15 +86,15 @@ bool Report::setOtherType(const OptionalStr& other_type, const InternalEmployeeP
 bool Report::addData(const std::string& data, const InternalEmployeePtr& changer)
 {
     if (std::find(this->data.begin(), this->data.end(), data) == this->data.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
-            std::make_optional(std::make_shared<std::string>(data)),
+            ChangeValue::fromText(data),
             ReportFields::Data,
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Add
-        ));
+        );
         this->data.push_back(data);
         return true;
     }
@@ -102,15 +104,15 @@ bool Report::addData(const std::string& data, const InternalEmployeePtr& changer
 bool Report::delData(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->data.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->data[index])),
+            ChangeValue::fromText(this->data[index]),
             std::nullopt,
             ReportFields::Data,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->data.erase(this->data.begin() + index);
         return true;
     }
@@ -121,7 +123,7 @@ bool Report::addParameter(const StringPair& parameter, const InternalEmployeePtr
 {
     if (std::find(this->parameters.begin(), this->parameters.end(), parameter) ==
         this->parameters.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional<ChangeLog::ValueVariant>(
@@ -131,7 +133,7 @@ bool Report::addParameter(const StringPair& parameter, const InternalEmployeePtr
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::StringPair,
             ChangeLog::Action::Add
-        ));
+        );
         this->parameters.push_back(parameter);
         return true;
     }
@@ -141,7 +143,7 @@ bool Report::addParameter(const StringPair& parameter, const InternalEmployeePtr
 bool Report::delParameter(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->parameters.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional<ChangeLog::ValueVariant>(
                 std::make_shared<std::pair<const std::string, const std::string>>(
@@ -153,7 +155,7 @@ bool Report::delParameter(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::StringPair,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->parameters.erase(this->parameters.begin() + index);
         return true;
     }
@@ -163,7 +165,7 @@ bool Report::delParameter(size_t index, const InternalEmployeePtr& changer)
 bool Report::setCreator(const WeakInternalEmployee& creator, const InternalEmployeePtr& changer)
 {
     if (this->creator.owner_before(creator) || creator.owner_before(this->creator)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->creator),
             WEAK_PTR_TO_OPTIONAL(creator),
@@ -173,7 +175,7 @@ bool Report::setCreator(const WeakInternalEmployee& creator, const InternalEmplo
             !creator.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->creator = creator;
         return true;
     }
@@ -183,7 +185,7 @@ bool Report::setCreator(const WeakInternalEmployee& creator, const InternalEmplo
 bool Report::setExportFormat(ExportFormat export_format, const InternalEmployeePtr& changer)
 {
     if (this->export_format != export_format) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->export_format),
             std::make_optional(export_format),
@@ -191,7 +193,7 @@ bool Report::setExportFormat(ExportFormat export_format, const InternalEmployeeP
             ChangeLog::FieldType::ExportFormat,
             ChangeLog::FieldType::ExportFormat,
             ChangeLog::Action::Change
-        ));
+        );
         this->export_format = export_format;
         return true;
     }
@@ -1,7 +1,9 @@
 #pragma once
 #include "BigNum/big_uint.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "DateTime/date.hpp"
 #include "Person/Employee/external_employee.hpp"
+#include "TenantContext/string_pool.hpp"
 #include "Usings/type_usings.hpp"
 
 enum class ReportType : uint8_t {
@@ -24,7 +26,7 @@ public:
         const ReportType&              type,
         const OptionalStr&             other_type,
         std::vector<std::string>       data,
-        const DatePtr&                 generated_date,
+        const OptionalDate&            generated_date,
         const std::vector<StringPair>& parameters,
         const WeakInternalEmployee&    creator,
         const ExportFormat&            export_format
@@ -34,9 +36,9 @@ public:
     /// @{
     auto getId() const -> const BigUint&;
     auto getType() const -> ReportType;
-    auto getOtherType() const -> const OptionalStr&;
+    auto getOtherType() const -> const OptionalInterned&;
     auto getData() const -> const std::vector<std::string>&;
-    auto getGeneratedDate() const -> const DatePtr&;
+    auto getGeneratedDate() const -> const OptionalDate&;
     auto getParameters() const -> const std::vector<StringPair>&;
     auto getCreator() const -> const WeakInternalEmployee&;
     auto getExportFormat() const -> ExportFormat;
@@ -60,12 +62,12 @@ public:
 private:
     BigUint                   id;
     ReportType                type;
-    OptionalStr               other_type;
+    OptionalInterned          other_type;
     std::vector<std::string>  data;
-    DatePtr                   generated_date;
+    OptionalDate              generated_date;
     std::vector<StringPair>   parameters;
     WeakInternalEmployee      creator;
     ExportFormat              export_format = ExportFormat::JSON;
 
-    std::vector<ChangeLogPtr> change_logs;
+    ChangeChain               change_logs{EntityType::Report, id};
 };
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * @brief Vector instruction sets picked when the process runs.
+ *
+ * The default build targets plain x86-64, so kernels with SSE4.1/AVX2 paths compile them with
+ * `SIMD_TARGET` and choose one by `simd::supported()` instead of relying on `-m` flags. Kernels
+ * also take the level explicitly, which lets the tests run every path the machine has.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_X86 1
+#define SIMD_TARGET(ISA) __attribute__((target(ISA)))
+#else
+#define SIMD_X86 0
+#define SIMD_TARGET(ISA)
+#endif
+
+namespace simd {
+    /// Ordered, a level includes every level below it
+    enum class Level : uint8_t { Scalar, SSE41, AVX2 };
+
+    /// Best level the CPU running the process supports, checked once
+    inline auto supported() -> Level
+    {
+#if SIMD_X86
+        static const Level level = [] {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) return Level::AVX2;
+            if (__builtin_cpu_supports("sse4.1")) return Level::SSE41;
+            return Level::Scalar;
+        }();
+        return level;
+#else
+        return Level::Scalar;
+#endif
+    }
+}  // namespace simd
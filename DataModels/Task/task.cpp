@@ -1,6 +1,8 @@
 #include "task.hpp"
 
-#include "ChangeLog/change_log.hpp"
+#include <algorithm>
+
+#include "ChangeLog/change_journal.hpp"
 Task::Task(const BigUint& id) : id(id), priority(Priority::Medium), status(Status::NotStarted) {}
 
 Task::Task(
@@ -10,10 +12,10 @@ Task::Task(
     const OptionalStr&          subject,
     const Status&               status,
     const Priority&             priority,
-    const DatePtr&              deadline,
-    const DatePtr&              start_date,
-    const DurationPtr&          ETC,
-    const DurationPtr&          ATS,
+    const OptionalDate&         deadline,
+    const OptionalDate&         start_date,
+    const OptionalDuration&     ETC,
+    const OptionalDuration&     ATS,
     const WeakInternalEmployee& created_by,
     const WeakInternalEmployee& manager,
     std::vector<WeakDealPtr>    deals,
@@ -47,10 +49,10 @@ auto Task::getSubject() const -> const OptionalStr& { return subject; }
 auto Task::getStatus() const -> Status { return status; }
 auto Task::getPriority() const -> Priority { return priority; }
 auto Task::getCreatedDate() const -> const Date& { return created_date; }
-auto Task::getDeadline() const -> const DatePtr& { return deadline; }
-auto Task::getStartDate() const -> const DatePtr& { return start_date; }
-auto Task::getETC() const -> const DurationPtr& { return ETC; }
-auto Task::getATS() const -> const DurationPtr& { return ATS; }
+auto Task::getDeadline() const -> const OptionalDate& { return deadline; }
+auto Task::getStartDate() const -> const OptionalDate& { return start_date; }
+auto Task::getETC() const -> const OptionalDuration& { return ETC; }
+auto Task::getATS() const -> const OptionalDuration& { return ATS; }
 auto Task::getCreatedBy() const -> const WeakInternalEmployee& { return created_by; }
 auto Task::getManager() const -> const WeakInternalEmployee& { return manager; }
 auto Task::getDeals() const -> const std::vector<WeakDealPtr>& { return this->deals; }
@@ -59,20 +61,45 @@ auto Task::getTasks() const -> const std::vector<TaskPtr>& { return this->attach
 auto Task::getNotes() const -> const std::vector<Note>& { return notes; }
 auto Task::getMoreData() const -> const std::vector<StringPair>& { return more_data; }
 auto Task::getTeem() const -> const std::vector<WeakPersonPtr>& { return teem; }
-auto Task::getChangeLogs() const -> const std::vector<ChangeLogPtr>& { return this->change_logs; }
+auto Task::getChangeLogs() const -> ChangeLogView
+{
+    return ChangeLogView(this->change_logs);
+}
+auto Task::getStateAt(const Date& date) const -> EntityState
+{
+    return ChangeJournal::getInstance().getStateAt(this->change_logs, date);
+}
+
+auto Task::getInitialState() const -> InitialState
+{
+    using Type = ChangeLog::FieldType;
+
+    InitialState state(this->created_date);
+    state.set(TaskFields::Title, Type::String, ChangeValue::fromText(this->title));
+    state.set(TaskFields::Description, Type::String, OPTIONAL_STR_TO_VALUE(this->description));
+    state.set(TaskFields::Subject, Type::String, OPTIONAL_STR_TO_VALUE(this->subject));
+    state.set(TaskFields::Status, Type::TaskStatus, this->status);
+    state.set(TaskFields::Priority, Type::Priority, this->priority);
+    state.set(TaskFields::Deadline, Type::Date, this->deadline);
+    state.set(TaskFields::StartDate, Type::Date, this->start_date);
+    state.set(TaskFields::ETC, Type::TimeDuration, this->ETC);
+    state.set(TaskFields::ATS, Type::TimeDuration, this->ATS);
+    state.set(TaskFields::Manager, Type::WeakInternalEmployee, WEAK_PTR_TO_OPTIONAL(this->manager));
+    return state;
+}
 
 bool Task::setTitle(const std::string& title, const InternalEmployeePtr& changer)
 {
     if (this->title != title) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
-            std::make_optional(std::make_shared<std::string>(this->title)),
-            std::make_optional(std::make_shared<std::string>(title)),
+            ChangeValue::fromText(this->title),
+            ChangeValue::fromText(title),
             TaskFields::Title,
             ChangeLog::FieldType::String,
             ChangeLog::FieldType::String,
             ChangeLog::Action::Change
-        ));
+        );
         this->title = title;
         return true;
     }
@@ -82,7 +109,7 @@ bool Task::setTitle(const std::string& title, const InternalEmployeePtr& changer
 bool Task::setDescription(const OptionalStr& description, const InternalEmployeePtr& changer)
 {
     if (this->description != description) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->description),
             OPTIONAL_STR_TO_VALUE(description),
@@ -90,7 +117,7 @@ bool Task::setDescription(const OptionalStr& description, const InternalEmployee
             this->description ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             description ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->description = description;
         return true;
     }
@@ -100,7 +127,7 @@ bool Task::setDescription(const OptionalStr& description, const InternalEmployee
 bool Task::setSubject(const OptionalStr& subject, const InternalEmployeePtr& changer)
 {
     if (this->subject != subject) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             OPTIONAL_STR_TO_VALUE(this->subject),
             OPTIONAL_STR_TO_VALUE(subject),
@@ -108,7 +135,7 @@ bool Task::setSubject(const OptionalStr& subject, const InternalEmployeePtr& cha
             this->subject ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             subject ? ChangeLog::FieldType::String : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->subject = subject;
         return true;
     }
@@ -118,7 +145,7 @@ bool Task::setSubject(const OptionalStr& subject, const InternalEmployeePtr& cha
 bool Task::setStatus(const Status& status, const InternalEmployeePtr& changer)
 {
     if (this->status != status) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->status),
             std::make_optional(status),
@@ -126,7 +153,7 @@ bool Task::setStatus(const Status& status, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::TaskStatus,
             ChangeLog::FieldType::TaskStatus,
             ChangeLog::Action::Change
-        ));
+        );
         this->status = status;
         return true;
     }
@@ -136,7 +163,7 @@ bool Task::setStatus(const Status& status, const InternalEmployeePtr& changer)
 bool Task::setPriority(const Priority& priority, const InternalEmployeePtr& changer)
 {
     if (this->priority != priority) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->priority),
             std::make_optional(priority),
@@ -144,105 +171,77 @@ bool Task::setPriority(const Priority& priority, const InternalEmployeePtr& chan
             ChangeLog::FieldType::Priority,
             ChangeLog::FieldType::Priority,
             ChangeLog::Action::Change
-        ));
+        );
         this->priority = priority;
         return true;
     }
     return false;
 }
 
-bool Task::setDeadline(const DatePtr& deadline, const InternalEmployeePtr& changer)
+bool Task::setDeadline(const OptionalDate& deadline, const InternalEmployeePtr& changer)
 {
-    bool changed = true;
-    if (this->deadline == nullptr || deadline == nullptr) {
-        if (this->deadline == deadline) changed = false;
-    } else if (*this->deadline == *deadline) {
-        changed = false;
-    }
-
-    if (!changed) return false;
+    if (this->deadline == deadline) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->deadline),
-        PTR_TO_OPTIONAL(deadline),
+        OPTIONAL_TO_VALUE(this->deadline),
+        OPTIONAL_TO_VALUE(deadline),
         TaskFields::Deadline,
         this->deadline ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         deadline ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->deadline = deadline;
     return true;
 }
 
-bool Task::setStartDate(const DatePtr& start_date, const InternalEmployeePtr& changer)
+bool Task::setStartDate(const OptionalDate& start_date, const InternalEmployeePtr& changer)
 {
-    bool changed = true;
-    if (this->start_date == nullptr || start_date == nullptr) {
-        if (this->start_date == start_date) changed = false;
-    } else if (*this->start_date == *start_date) {
-        changed = false;
-    }
-
-    if (!changed) return false;
+    if (this->start_date == start_date) return false;
 
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->start_date),
-        PTR_TO_OPTIONAL(start_date),
+        OPTIONAL_TO_VALUE(this->start_date),
+        OPTIONAL_TO_VALUE(start_date),
         TaskFields::StartDate,
         this->start_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         start_date ? ChangeLog::FieldType::Date : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->start_date = start_date;
     return true;
 }
 
-bool Task::setETC(const DurationPtr& ETC, const InternalEmployeePtr& changer)
+bool Task::setETC(const OptionalDuration& ETC, const InternalEmployeePtr& changer)
 {
-    bool changed = true;
-    if (this->ETC == nullptr || ETC == nullptr) {
-        if (this->ETC == ETC) changed = false;
-    } else if (*this->ETC == *ETC) {
-        changed = false;
-    }
+    if (this->ETC == ETC) return false;
 
-    if (!changed) return false;
-
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->ETC),
-        PTR_TO_OPTIONAL(ETC),
+        OPTIONAL_TO_VALUE(this->ETC),
+        OPTIONAL_TO_VALUE(ETC),
         TaskFields::ETC,
         this->ETC ? ChangeLog::FieldType::TimeDuration : ChangeLog::FieldType::null,
         ETC ? ChangeLog::FieldType::TimeDuration : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->ETC = ETC;
     return true;
 }
 
-bool Task::setATS(const DurationPtr& ATS, const InternalEmployeePtr& changer)
+bool Task::setATS(const OptionalDuration& ATS, const InternalEmployeePtr& changer)
 {
-    bool changed = true;
-    if (this->ATS == nullptr || ATS == nullptr) {
-        if (this->ATS == ATS) changed = false;
-    } else if (*this->ATS == *ATS) {
-        changed = false;
-    }
+    if (this->ATS == ATS) return false;
 
-    if (!changed) return false;
-
-    this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+    this->change_logs.append(
         changer,
-        PTR_TO_OPTIONAL(this->ATS),
-        PTR_TO_OPTIONAL(ATS),
+        OPTIONAL_TO_VALUE(this->ATS),
+        OPTIONAL_TO_VALUE(ATS),
         TaskFields::ATS,
         this->ATS ? ChangeLog::FieldType::TimeDuration : ChangeLog::FieldType::null,
         ATS ? ChangeLog::FieldType::TimeDuration : ChangeLog::FieldType::null,
         ChangeLog::Action::Change
-    ));
+    );
     this->ATS = ATS;
     return true;
 }
@@ -250,7 +249,7 @@ bool Task::setATS(const DurationPtr& ATS, const InternalEmployeePtr& changer)
 bool Task::setManager(const WeakInternalEmployee& weak_manager, const InternalEmployeePtr& changer)
 {
     if (this->manager.owner_before(weak_manager) || weak_manager.owner_before(this->manager)) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             WEAK_PTR_TO_OPTIONAL(this->manager),
             WEAK_PTR_TO_OPTIONAL(weak_manager),
@@ -260,7 +259,7 @@ bool Task::setManager(const WeakInternalEmployee& weak_manager, const InternalEm
             !weak_manager.expired() ? ChangeLog::FieldType::WeakInternalEmployee
                                     : ChangeLog::FieldType::null,
             ChangeLog::Action::Change
-        ));
+        );
         this->manager = weak_manager;
         return true;
     }
@@ -276,7 +275,7 @@ bool Task::addDeal(const WeakDealPtr& deal, const InternalEmployeePtr& changer)
                 return !(deal.owner_before(other_deal) || other_deal.owner_before(deal));
             }
         ) == this->deals.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             WEAK_PTR_TO_OPTIONAL(deal),
@@ -284,7 +283,7 @@ bool Task::addDeal(const WeakDealPtr& deal, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             !deal.expired() ? ChangeLog::FieldType::WeakDeal : ChangeLog::FieldType::null,
             ChangeLog::Action::Add
-        ));
+        );
         this->deals.push_back(deal);
         return true;
     }
@@ -294,7 +293,7 @@ bool Task::addDeal(const WeakDealPtr& deal, const InternalEmployeePtr& changer)
 bool Task::delDeal(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->deals.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->deals[index]),
             std::nullopt,
@@ -302,7 +301,7 @@ bool Task::delDeal(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::WeakDeal,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->attachment_tasks.erase(this->attachment_tasks.begin() + index);
         return true;
     }
@@ -313,7 +312,7 @@ bool Task::addTask(const TaskPtr& task, const InternalEmployeePtr& changer)
 {
     if (std::find(this->attachment_tasks.begin(), this->attachment_tasks.end(), task) ==
         this->attachment_tasks.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(task),
@@ -321,7 +320,7 @@ bool Task::addTask(const TaskPtr& task, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Task,
             ChangeLog::Action::Add
-        ));
+        );
         this->attachment_tasks.push_back(task);
         return true;
     }
@@ -331,7 +330,7 @@ bool Task::addTask(const TaskPtr& task, const InternalEmployeePtr& changer)
 bool Task::delTask(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->attachment_tasks.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->attachment_tasks[index]),
             std::nullopt,
@@ -339,7 +338,7 @@ bool Task::delTask(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Task,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->attachment_tasks.erase(this->attachment_tasks.begin() + index);
         return true;
     }
@@ -350,7 +349,7 @@ bool Task::addFile(const FilePtr& file, const InternalEmployeePtr& changer)
 {
     if (std::find(this->attachment_files.begin(), this->attachment_files.end(), file) ==
         this->attachment_files.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(file),
@@ -358,7 +357,7 @@ bool Task::addFile(const FilePtr& file, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::Action::Add
-        ));
+        );
         this->attachment_files.push_back(file);
         return true;
     }
@@ -368,7 +367,7 @@ bool Task::addFile(const FilePtr& file, const InternalEmployeePtr& changer)
 bool Task::delFile(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->attachment_files.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->attachment_files[index]),
             std::nullopt,
@@ -376,7 +375,7 @@ bool Task::delFile(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::FileMetadata,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->attachment_files.erase(this->attachment_files.begin() + index);
         return true;
     }
@@ -386,7 +385,7 @@ bool Task::delFile(size_t index, const InternalEmployeePtr& changer)
 bool Task::addNote(const Note& note, const InternalEmployeePtr& changer)
 {
     if (std::find(this->notes.begin(), this->notes.end(), note) == this->notes.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(std::make_shared<Note>(note)),
@@ -394,7 +393,7 @@ bool Task::addNote(const Note& note, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::Note,
             ChangeLog::Action::Add
-        ));
+        );
         this->notes.push_back(note);
         return true;
     }
@@ -404,7 +403,7 @@ bool Task::addNote(const Note& note, const InternalEmployeePtr& changer)
 bool Task::delNote(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->notes.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<Note>(this->notes[index])),
             std::nullopt,
@@ -412,7 +411,7 @@ bool Task::delNote(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::Note,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->notes.erase(this->notes.begin() + index);
         return true;
     }
@@ -425,7 +424,7 @@ bool Task::addMoreData(
 {
     auto pair = std::make_pair(title, data);
     if (std::find(this->more_data.begin(), this->more_data.end(), pair) == this->more_data.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(
@@ -435,7 +434,7 @@ bool Task::addMoreData(
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::StringPair,
             ChangeLog::Action::Add
-        ));
+        );
         this->more_data.push_back(pair);
         return true;
     }
@@ -445,7 +444,7 @@ bool Task::addMoreData(
 bool Task::delMoreData(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->more_data.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(std::make_shared<std::pair<const std::string, const std::string>>(
                 this->more_data[index]
@@ -455,7 +454,7 @@ bool Task::delMoreData(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::StringPair,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->more_data.erase(this->more_data.begin() + index);
         return true;
     }
@@ -467,7 +466,7 @@ bool Task::addTeemMember(const WeakPersonPtr& member, const InternalEmployeePtr&
     if (std::find_if(this->teem.begin(), this->teem.end(), [&member](const WeakPersonPtr& person) {
             return !(member.owner_before(person) || person.owner_before(member));
         }) == this->teem.end()) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::nullopt,
             std::make_optional(member),
@@ -475,7 +474,7 @@ bool Task::addTeemMember(const WeakPersonPtr& member, const InternalEmployeePtr&
             ChangeLog::FieldType::null,
             ChangeLog::FieldType::WeakPerson,
             ChangeLog::Action::Add
-        ));
+        );
         this->teem.push_back(member);
         return true;
     }
@@ -485,7 +484,7 @@ bool Task::addTeemMember(const WeakPersonPtr& member, const InternalEmployeePtr&
 bool Task::delTeemMember(size_t index, const InternalEmployeePtr& changer)
 {
     if (this->teem.size() > index) {
-        this->change_logs.emplace_back(std::make_shared<ChangeLog>(
+        this->change_logs.append(
             changer,
             std::make_optional(this->teem[index]),
             std::nullopt,
@@ -493,7 +492,7 @@ bool Task::delTeemMember(size_t index, const InternalEmployeePtr& changer)
             ChangeLog::FieldType::WeakPerson,
             ChangeLog::FieldType::null,
             ChangeLog::Action::Remove
-        ));
+        );
         this->teem.erase(this->teem.begin() + index);
         return true;
     }
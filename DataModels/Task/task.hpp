@@ -2,6 +2,7 @@
 #include <vector>
 
 #include "BigNum/big_uint.hpp"
+#include "ChangeLog/change_chain.hpp"
 #include "DateTime/date.hpp"
 #include "DateTime/time_duration.hpp"
 #include "FileMetadata/file_metadata.hpp"
@@ -21,10 +22,10 @@ public:
         const OptionalStr&          subject,
         const Status&               status,
         const Priority&             priority,
-        const DatePtr&              deadline,
-        const DatePtr&              start_date,
-        const DurationPtr&          ETC,
-        const DurationPtr&          ATS,
+        const OptionalDate&         deadline,
+        const OptionalDate&         start_date,
+        const OptionalDuration&     ETC,
+        const OptionalDuration&     ATS,
         const WeakInternalEmployee& created_by,
         const WeakInternalEmployee& manager,
         std::vector<WeakDealPtr>    deals,
@@ -43,10 +44,10 @@ public:
     auto getStatus() const -> Status;
     auto getPriority() const -> Priority;
     auto getCreatedDate() const -> const Date&;
-    auto getDeadline() const -> const DatePtr&;
-    auto getStartDate() const -> const DatePtr&;
-    auto getETC() const -> const DurationPtr&;
-    auto getATS() const -> const DurationPtr&;
+    auto getDeadline() const -> const OptionalDate&;
+    auto getStartDate() const -> const OptionalDate&;
+    auto getETC() const -> const OptionalDuration&;
+    auto getATS() const -> const OptionalDuration&;
     auto getCreatedBy() const -> const WeakInternalEmployee&;
     auto getManager() const -> const WeakInternalEmployee&;
     auto getDeals() const -> const std::vector<WeakDealPtr>&;
@@ -55,7 +56,9 @@ public:
     auto getNotes() const -> const std::vector<Note>&;
     auto getMoreData() const -> const std::vector<StringPair>&;
     auto getTeem() const -> const std::vector<WeakPersonPtr>&;
-    auto getChangeLogs() const -> const std::vector<ChangeLogPtr>&;
+    auto getChangeLogs() const -> ChangeLogView;
+    /// Fields as the change history had left them at `date`
+    auto getStateAt(const Date& date) const -> EntityState;
     /// @}
 
     /// @name Change functions
@@ -65,8 +68,8 @@ private:
     bool setTitle(const std::string& title, const InternalEmployeePtr& changer);
     bool setStatus(const Status& status, const InternalEmployeePtr& changer);
     bool setPriority(const Priority& priority, const InternalEmployeePtr& changer);
-    bool setDeadline(const DatePtr& deadline, const InternalEmployeePtr& changer);
-    bool setStartDate(const DatePtr& start_date, const InternalEmployeePtr& changer);
+    bool setDeadline(const OptionalDate& deadline, const InternalEmployeePtr& changer);
+    bool setStartDate(const OptionalDate& start_date, const InternalEmployeePtr& changer);
     bool setManager(const WeakInternalEmployee& weak_manager, const InternalEmployeePtr& changer);
 
     bool addDeal(const WeakDealPtr& deal, const InternalEmployeePtr& changer);
@@ -79,8 +82,8 @@ private:
 public:
     bool setDescription(const OptionalStr& description, const InternalEmployeePtr& changer);
     bool setSubject(const OptionalStr& subject, const InternalEmployeePtr& changer);
-    bool setETC(const DurationPtr& ETC, const InternalEmployeePtr& changer);
-    bool setATS(const DurationPtr& ATS, const InternalEmployeePtr& changer);
+    bool setETC(const OptionalDuration& ETC, const InternalEmployeePtr& changer);
+    bool setATS(const OptionalDuration& ATS, const InternalEmployeePtr& changer);
 
     bool addTask(const TaskPtr& task, const InternalEmployeePtr& changer);
     bool delTask(size_t index, const InternalEmployeePtr& changer);
@@ -105,6 +108,9 @@ public:
     friend class TaskDataBase;
 
 private:
+    /// Fields the task was created with, saved by `TaskDataBase::add`
+    auto getInitialState() const -> InitialState;
+
     BigUint              id;
     std::string          title;
     OptionalStr          description;
@@ -113,10 +119,10 @@ private:
     Priority             priority;
 
     Date                 created_date = Date();
-    DatePtr              deadline;
-    DatePtr              start_date;
-    DurationPtr          ETC;  ///< Estimated Time of Completion
-    DurationPtr          ATS;  ///< Actual Time Spent
+    OptionalDate         deadline;
+    OptionalDate         start_date;
+    OptionalDuration     ETC;  ///< Estimated Time of Completion
+    OptionalDuration     ATS;  ///< Actual Time Spent
 
     WeakInternalEmployee created_by;
     WeakInternalEmployee manager;
@@ -129,7 +135,7 @@ private:
     std::vector<StringPair>    more_data;
     std::vector<WeakPersonPtr> teem;
 
-    std::vector<ChangeLogPtr>  change_logs;
+    ChangeChain                change_logs{EntityType::Task, id};
 
 #ifdef _TESTING
 public:
@@ -145,11 +151,11 @@ public:
     {
         return this->setPriority(priority, changer);
     }
-    bool _setDeadline(const DatePtr& deadline, const InternalEmployeePtr& changer)
+    bool _setDeadline(const OptionalDate& deadline, const InternalEmployeePtr& changer)
     {
         return this->setDeadline(deadline, changer);
     }
-    bool _setStartDate(const DatePtr& start_date, const InternalEmployeePtr& changer)
+    bool _setStartDate(const OptionalDate& start_date, const InternalEmployeePtr& changer)
     {
         return this->setStartDate(start_date, changer);
     }
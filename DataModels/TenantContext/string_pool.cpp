@@ -0,0 +1,151 @@
+#include "string_pool.hpp"
+
+#include <string.h>
+
+#include <mutex>
+#include <stdexcept>
+
+#include "ChangeLog/change_journal.hpp"
+#include "location.hpp"
+
+namespace {
+    struct TenantPools {
+        std::mutex                                               mutex;
+        std::unordered_map<uint16_t, std::shared_ptr<StringPool>> pools;
+    };
+
+    auto tenantPools() -> TenantPools&
+    {
+        // leaked like the journal: models in static storage may keep entries of a pool until the
+        // very end of the process
+        static TenantPools* instance = new TenantPools();
+        return *instance;
+    }
+}  // namespace
+
+auto StringPool::ofTenant(const uint16_t tenant) -> const std::shared_ptr<StringPool>&
+{
+    TenantPools&                pools = tenantPools();
+    std::lock_guard<std::mutex> lock(pools.mutex);
+
+    std::shared_ptr<StringPool>& pool = pools.pools[tenant];
+    if (!pool) pool = std::make_shared<StringPool>();
+    return pool;
+}
+
+auto StringPool::current() -> const std::shared_ptr<StringPool>&
+{
+    return ofTenant(TenantScope::current());
+}
+
+auto StringPool::intern(const std::string_view text) -> Symbol { return this->entry(text).symbol; }
+
+auto StringPool::entry(const std::string_view text) -> const Entry&
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(this->mutex);
+        auto                                it = this->symbols.find(text);
+        if (it != this->symbols.end()) return *it->second;
+    }
+    std::unique_lock<std::shared_mutex> lock(this->mutex);
+    auto                                it = this->symbols.find(text);
+    if (it != this->symbols.end()) return *it->second;
+
+    if (this->entries.size() >= none || text.size() > UINT32_MAX) {
+        throw std::length_error(errors::string_pool_full);
+    }
+
+    Entry* entry  = this->allocate(text.size());
+    entry->pool   = this;
+    entry->symbol = static_cast<Symbol>(this->entries.size());
+    entry->size   = static_cast<uint32_t>(text.size());
+    if (!text.empty()) memcpy(entry + 1, text.data(), text.size());
+
+    this->entries.push_back(entry);
+    this->symbols.emplace(entry->view(), entry);
+    return *entry;
+}
+
+auto StringPool::find(const std::string_view text) const -> std::optional<Symbol>
+{
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    auto                                it = this->symbols.find(text);
+    if (it == this->symbols.end()) return std::nullopt;
+    return it->second->symbol;
+}
+
+auto StringPool::view(const Symbol symbol) const -> std::string_view
+{
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    if (symbol >= this->entries.size()) throw std::out_of_range(errors::unknown_symbol);
+    return this->entries[symbol]->view();
+}
+
+auto StringPool::size() const -> size_t
+{
+    std::shared_lock<std::shared_mutex> lock(this->mutex);
+    return this->entries.size();
+}
+
+auto StringPool::allocate(const size_t size) -> Entry*
+{
+    // whole entries, so the header of the next one stays aligned
+    const size_t count = 1 + (size + sizeof(Entry) - 1) / sizeof(Entry);
+    const size_t bytes = count * sizeof(Entry);
+
+    // long texts get their own block so they do not waste the tail of the current chunk
+    if (bytes > chunk_size / 4) {
+        this->chunks.push_back(std::make_unique_for_overwrite<Entry[]>(count));
+        return this->chunks.back().get();
+    }
+    if (bytes > this->left) {
+        this->chunks.push_back(std::make_unique_for_overwrite<Entry[]>(chunk_size / sizeof(Entry)));
+        this->cursor = reinterpret_cast<char*>(this->chunks.back().get());
+        this->left   = chunk_size;
+    }
+    Entry* entry = reinterpret_cast<Entry*>(this->cursor);
+    this->cursor += bytes;
+    this->left -= bytes;
+    return entry;
+}
+
+InternedStr::InternedStr(const std::string_view text)
+    : entry(&StringPool::current()->entry(text))
+{
+}
+
+InternedStr::InternedStr(StringPool& pool, const std::string_view text) : entry(&pool.entry(text))
+{
+}
+
+auto InternedStr::fromOptional(const OptionalStr& text) -> std::optional<InternedStr>
+{
+    if (!text) return std::nullopt;
+    return InternedStr(*text);
+}
+
+auto InternedStr::fromList(const std::vector<std::string>& texts) -> std::vector<InternedStr>
+{
+    std::vector<InternedStr> result;
+    result.reserve(texts.size());
+    StringPool& pool = *StringPool::current();
+    for (const std::string& text : texts) result.emplace_back(pool, text);
+    return result;
+}
+
+auto InternedStr::getSymbol() const -> StringPool::Symbol
+{
+    return this->entry ? this->entry->symbol : StringPool::none;
+}
+
+auto InternedStr::getPool() const -> const StringPool*
+{
+    return this->entry ? this->entry->pool : nullptr;
+}
+
+bool operator==(const InternedStr& first, const InternedStr& second)
+{
+    if (first.entry == second.entry) return true;
+    if (first.getPool() == second.getPool() && first.getPool()) return false;
+    return first.view() == second.view();
+}
@@ -0,0 +1,113 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Usings/type_usings.hpp"
+
+/**
+ * @class StringPool
+ * @brief Tenant-wide table of interned strings.
+ *
+ * Every distinct text is stored once and named by a dense 32-bit `Symbol`. Symbols are never
+ * reused and the text never moves, so `view()` stays valid for the lifetime of the pool and
+ * indexes over low-cardinality fields (departments, positions, tags, ...) can be keyed on the
+ * integer instead of holding their own copy of the string. Models keep those fields as
+ * `InternedStr`, interned in the pool of the tenant they are changed for (see `ofTenant`).
+ * The pool may be used from several threads.
+ */
+class StringPool {
+public:
+    using Symbol = uint32_t;
+
+    /// Symbol no text is given, for keys looked up without interning
+    static constexpr Symbol none = UINT32_MAX;
+
+    /// Header of an interned text, the text follows it in the same block
+    struct Entry {
+        const StringPool* pool;
+        Symbol            symbol;
+        uint32_t          size;
+
+        auto view() const -> std::string_view
+        {
+            return {reinterpret_cast<const char*>(this + 1), this->size};
+        }
+    };
+
+    StringPool()                             = default;
+    StringPool(const StringPool&)            = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /// Pool of the tenant, made on first use and kept for the rest of the process
+    static auto ofTenant(const uint16_t tenant) -> const std::shared_ptr<StringPool>&;
+    /// Pool of the tenant of the current `TenantScope`
+    static auto current() -> const std::shared_ptr<StringPool>&;
+
+    /// Symbol of the text, adding it on first use
+    auto intern(const std::string_view text) -> Symbol;
+    /// Entry of the text, adding it on first use
+    auto entry(const std::string_view text) -> const Entry&;
+    /// Symbol of the text if it was interned before; never adds
+    auto find(const std::string_view text) const -> std::optional<Symbol>;
+    auto view(const Symbol symbol) const -> std::string_view;
+    auto size() const -> size_t;
+
+private:
+    static constexpr size_t chunk_size = 16 * 1024;
+
+    mutable std::shared_mutex                          mutex;
+    std::vector<std::unique_ptr<Entry[]>>              chunks;
+    char*                                              cursor = nullptr;
+    size_t                                             left   = 0;
+    std::vector<const Entry*>                          entries;  // indexed by symbol
+    std::unordered_map<std::string_view, const Entry*> symbols;  // keys point into `chunks`
+
+    auto allocate(const size_t size) -> Entry*;
+};
+
+/**
+ * @class InternedStr
+ * @brief Text of a low-cardinality model field, kept as an entry of a tenant's `StringPool`.
+ *
+ * Costs one pointer however long the text is. Texts of the same pool compare by their entry,
+ * texts of different pools by their characters. A default-built one is the empty text of no
+ * pool.
+ */
+class InternedStr {
+public:
+    InternedStr() = default;
+    /// Interns the text in the pool of the current `TenantScope`
+    explicit InternedStr(const std::string_view text);
+    InternedStr(StringPool& pool, const std::string_view text);
+
+    /// @name Conversions of whole fields, interned in the pool of the current `TenantScope`
+    /// @{
+    static auto fromOptional(const OptionalStr& text) -> std::optional<InternedStr>;
+    static auto fromList(const std::vector<std::string>& texts) -> std::vector<InternedStr>;
+    /// @}
+
+    auto view() const -> std::string_view { return this->entry ? this->entry->view() : ""; }
+    auto str() const -> std::string { return std::string(this->view()); }
+    /// `StringPool::none` for the empty text of no pool
+    auto getSymbol() const -> StringPool::Symbol;
+    auto getPool() const -> const StringPool*;
+
+    operator std::string_view() const { return this->view(); }
+
+    friend bool operator==(const InternedStr& first, const InternedStr& second);
+    friend bool operator==(const InternedStr& first, const std::string_view second)
+    {
+        return first.view() == second;
+    }
+
+private:
+    const StringPool::Entry* entry = nullptr;
+};
@@ -0,0 +1,91 @@
+#include "session_changes.hpp"
+
+#include <bit>
+#include <mutex>
+#include <stdexcept>
+
+#include "location.hpp"
+
+SessionChanges::SessionChanges(const UserSession& session)
+{
+    std::lock_guard<std::mutex> lock(session.mutex);
+    this->offsets     = session.session_changes;
+    this->kinds       = session.change_kinds;
+    this->types       = session.entity_types;
+    this->counts      = session.change_kind_counts;
+    this->type_counts = session.entity_type_counts;
+}
+
+auto SessionChanges::size() const -> size_t { return this->offsets.size(); }
+auto SessionChanges::empty() const -> bool { return this->offsets.empty(); }
+auto SessionChanges::begin() const -> Iterator { return this->offsets.begin(); }
+auto SessionChanges::end() const -> Iterator { return this->offsets.end(); }
+
+auto SessionChanges::operator[](const size_t index) const -> Offset
+{
+    if (index >= this->offsets.size()) throw std::out_of_range(errors::unknown_change);
+    return this->offsets[index];
+}
+
+auto SessionChanges::getKind(const size_t index) const -> uint8_t
+{
+    if (index >= this->kinds.size()) throw std::out_of_range(errors::unknown_change);
+    return this->kinds[index];
+}
+
+auto SessionChanges::getEntityType(const size_t index) const -> EntityType
+{
+    if (index >= this->types.size()) throw std::out_of_range(errors::unknown_change);
+    return this->types[index];
+}
+
+auto SessionChanges::getEntry(const size_t index) const -> ChangeLogPtr
+{
+    return ChangeJournal::getInstance().getEntry((*this)[index]);
+}
+
+auto SessionChanges::countByKind() const -> const UserSession::ChangeKindCounts&
+{
+    return this->counts;
+}
+
+auto SessionChanges::count(const uint32_t kind_mask) const -> size_t
+{
+    size_t   result = 0;
+    uint32_t rest   = kind_mask;
+    while (rest != 0) {
+        result += this->counts[std::countr_zero(rest)];
+        rest &= rest - 1;
+    }
+    return result;
+}
+
+auto SessionChanges::filter(const uint32_t kind_mask) const -> std::vector<Offset>
+{
+    std::vector<Offset> result;
+    result.reserve(this->count(kind_mask));
+    for (size_t i = 0; i < this->offsets.size(); i++) {
+        if ((kind_mask >> this->kinds[i]) & 1) result.push_back(this->offsets[i]);
+    }
+    return result;
+}
+
+auto SessionChanges::countByEntityType() const -> const UserSession::EntityTypeCounts&
+{
+    return this->type_counts;
+}
+
+auto SessionChanges::count(const EntityType type) const -> size_t
+{
+    return this->type_counts[static_cast<size_t>(type)];
+}
+
+auto SessionChanges::filter(const EntityType type) const -> std::vector<Offset>
+{
+    std::vector<Offset> result;
+    result.reserve(this->count(type));
+    for (size_t i = 0; i < this->offsets.size(); i++) {
+        if (this->types[i] == type) result.push_back(this->offsets[i]);
+    }
+    return result;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "ChangeLog/change_journal.hpp"
+#include "ChangeLog/change_kind.hpp"
+#include "user_session.hpp"
+
+static_assert(
+    std::variant_size_v<ChangeLog::FieldVariant> <=
+    std::tuple_size_v<UserSession::ChangeKindCounts>
+);
+
+/**
+ * @class SessionChanges
+ * @brief Snapshot of the changes made during one session, oldest first.
+ *
+ * Copies the session's own offsets, field kinds and entity types under its lock and works on
+ * the copy, so changes the session makes later do not show up and no entity is visited.
+ * Entries are only built from the journal when asked for.
+ */
+class SessionChanges {
+public:
+    using Offset   = ChangeChain::Offset;
+    using Iterator = std::vector<Offset>::const_iterator;
+
+    explicit SessionChanges(const UserSession& session);
+
+    auto size() const -> size_t;
+    auto empty() const -> bool;
+    auto begin() const -> Iterator;
+    auto end() const -> Iterator;
+    auto operator[](const size_t index) const -> Offset;
+    auto getKind(const size_t index) const -> uint8_t;
+    auto getEntityType(const size_t index) const -> EntityType;
+    auto getEntry(const size_t index) const -> ChangeLogPtr;
+
+    /// Number of changes per field kind
+    auto countByKind() const -> const UserSession::ChangeKindCounts&;
+    /// Number of changes whose field kind is in `kind_mask`
+    auto count(const uint32_t kind_mask) const -> size_t;
+    /// Offsets of the changes whose field kind is in `kind_mask`, oldest first
+    auto filter(const uint32_t kind_mask) const -> std::vector<Offset>;
+
+    /// Number of changes per type of the changed entity
+    auto countByEntityType() const -> const UserSession::EntityTypeCounts&;
+    auto count(const EntityType type) const -> size_t;
+    /// Offsets of the changes of entities of `type`, oldest first
+    auto filter(const EntityType type) const -> std::vector<Offset>;
+
+    template <typename... Fields>
+    auto count() const -> size_t
+    {
+        return this->count(change_kind::mask<Fields...>);
+    }
+    template <typename... Fields>
+    auto filter() const -> std::vector<Offset>
+    {
+        return this->filter(change_kind::mask<Fields...>);
+    }
+
+private:
+    std::vector<Offset>           offsets;
+    std::vector<uint8_t>          kinds;
+    std::vector<EntityType>       types;
+    UserSession::ChangeKindCounts counts;
+    UserSession::EntityTypeCounts type_counts;
+};
@@ -1,22 +1,86 @@
 #include "session_manager.hpp"
 
-SessionManager& SessionManager::getInstance() {
+#include <functional>
+#include <mutex>
+
+namespace {
+    thread_local UserSessionPtr current_session;
+}  // namespace
+
+SessionManager& SessionManager::getInstance()
+{
     static SessionManager instance;
     return instance;
 }
 
-void SessionManager::setCurrentSession(const UserSessionPtr& session) {
-    this->current_session = session;
+void SessionManager::setCurrentSession(const UserSessionPtr& session)
+{
+    current_session = session;
+}
+
+UserSessionPtr SessionManager::getCurrentSession() const { return current_session; }
+
+void SessionManager::addChangeToSession(
+    const ChangeChain::Offset offset, const uint8_t field_kind, const EntityType entity_type
+)
+{
+    if (current_session) current_session->addChangeLog(offset, field_kind, entity_type);
 }
 
-UserSessionPtr SessionManager::getCurrentSession() const {
-    return this->current_session;
+bool SessionManager::addSession(const UserSessionPtr& session)
+{
+    Shard&                              shard = this->shardOf(session->getToken());
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.sessions.emplace(session->getToken(), session).second;
 }
 
-void SessionManager::addChangeToSession(ChangeLog* log) {
-    auto session = getCurrentSession();
-    if (session) {  
-        session->addChangeLog(log);  
+auto SessionManager::findSession(const std::string& token) const -> UserSessionPtr
+{
+    const Shard&                        shard = this->shardOf(token);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    auto it = shard.sessions.find(token);
+    return it != shard.sessions.end() ? it->second : nullptr;
+}
+
+bool SessionManager::removeSession(const std::string& token)
+{
+    Shard&                              shard = this->shardOf(token);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.sessions.erase(token) != 0;
+}
+
+auto SessionManager::size() const -> size_t
+{
+    size_t result = 0;
+    for (const Shard& shard : this->shards) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        result += shard.sessions.size();
     }
- 
-}
\ No newline at end of file
+    return result;
+}
+
+auto SessionManager::shardOf(const std::string& token) const -> const Shard&
+{
+    return this->shards[std::hash<std::string>()(token) % shard_count];
+}
+
+auto SessionManager::shardOf(const std::string& token) -> Shard&
+{
+    return this->shards[std::hash<std::string>()(token) % shard_count];
+}
+
+SessionScope::SessionScope(const UserSessionPtr& session)
+    : session(session), previous(current_session)
+{
+    current_session = session;
+}
+
+SessionScope::SessionScope(const std::string& token)
+    : SessionScope(SessionManager::getInstance().findSession(token))
+{
+}
+
+SessionScope::~SessionScope() { current_session = this->previous; }
+
+auto SessionScope::getSession() const -> const UserSessionPtr& { return this->session; }
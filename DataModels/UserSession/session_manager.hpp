@@ -1,15 +1,84 @@
 #pragma once
-#include "user_session.hpp"
+#include <stddef.h>
+
+#include <array>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
 #include "Usings/type_usings.hpp"
+#include "user_session.hpp"
 
+/**
+ * @class SessionManager
+ * @brief Process-wide registry of user sessions and the session of each worker thread.
+ *
+ * The current session is thread-local, so every thread attributes the changes it makes to the
+ * user it is serving. Sessions are registered by token in shards with a lock each, so threads
+ * looking up different tokens rarely wait for each other.
+ */
 class SessionManager {
 public:
     static SessionManager& getInstance();
-    void setCurrentSession(const UserSessionPtr& session);
+
+    SessionManager(const SessionManager&)            = delete;
+    SessionManager& operator=(const SessionManager&) = delete;
+
+    /// @name Session of the calling thread
+    /// @{
+    void           setCurrentSession(const UserSessionPtr& session);
     UserSessionPtr getCurrentSession() const;
-    void addChangeToSession(ChangeLog* log);
+    void           addChangeToSession(
+        const ChangeChain::Offset offset, const uint8_t field_kind, const EntityType entity_type
+    );
+    /// @}
+
+    /// @name Registry
+    /// @{
+    /// Returns false if a session with the same token is already registered
+    bool addSession(const UserSessionPtr& session);
+    auto findSession(const std::string& token) const -> UserSessionPtr;
+    /// Unregisters the session, it stays current for threads that still serve it
+    bool removeSession(const std::string& token);
+    auto size() const -> size_t;
+    /// @}
+
+private:
+    static constexpr size_t shard_count = 16;
+
+    struct Shard {
+        mutable std::shared_mutex                       mutex;
+        std::unordered_map<std::string, UserSessionPtr> sessions;
+    };
+
+    SessionManager() = default;
+
+    std::array<Shard, shard_count> shards;
+
+    auto shardOf(const std::string& token) const -> const Shard&;
+    auto shardOf(const std::string& token) -> Shard&;
+};
+
+/**
+ * @class SessionScope
+ * @brief Makes a session current for the calling thread until the scope ends.
+ *
+ * The previous session of the thread is restored on exit, so a worker can serve one request
+ * per scope.
+ */
+class SessionScope {
+public:
+    explicit SessionScope(const UserSessionPtr& session);
+    /// Session registered under `token`, no session if there is none
+    explicit SessionScope(const std::string& token);
+    ~SessionScope();
+
+    SessionScope(const SessionScope&)            = delete;
+    SessionScope& operator=(const SessionScope&) = delete;
+
+    auto getSession() const -> const UserSessionPtr&;
 
 private:
-    SessionManager() : current_session(nullptr) {}  // Explicit init to nullptr
-    UserSessionPtr current_session;
-};
\ No newline at end of file
+    UserSessionPtr session;
+    UserSessionPtr previous;
+};
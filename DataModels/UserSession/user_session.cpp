@@ -9,27 +9,59 @@ UserSession::UserSession(
 
 auto UserSession::getToken() const -> const std::string& { return this->token; }
 auto UserSession::getLoginTime() const -> const Date& { return this->login_time; }
-auto UserSession::getLogoutTime() const -> const DatePtr& { return this->logout_time; }
-auto UserSession::getSessionDuration() const -> const TimeDuration&
+auto UserSession::getLogoutTime() const -> OptionalDate
 {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->logout_time;
+}
+auto UserSession::getSessionDuration() const -> TimeDuration
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
     return this->session_duration;
 }
-auto UserSession::getIsActive() const -> bool { return this->is_active; }
+auto UserSession::getIsActive() const -> bool { return this->is_active.load(); }
 auto UserSession::getIpAddress() const -> const OptionalStr& { return this->ip_address; }
 auto UserSession::getDeviceInfo() const -> const OptionalStr& { return this->device_info; }
-auto UserSession::getSessionChanges() const -> const std::vector<ChangeLog*>&
+auto UserSession::getSessionChanges() const -> std::vector<ChangeChain::Offset>
 {
+    std::lock_guard<std::mutex> lock(this->mutex);
     return this->session_changes;
 }
 
-void UserSession::addChangeLog(ChangeLog* change_log)
+auto UserSession::getChangeCount() const -> size_t
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->session_changes.size();
+}
+auto UserSession::getChangeKindCounts() const -> ChangeKindCounts
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->change_kind_counts;
+}
+auto UserSession::getEntityTypeCounts() const -> EntityTypeCounts
 {
-    this->session_changes.push_back(change_log);
+    std::lock_guard<std::mutex> lock(this->mutex);
+    return this->entity_type_counts;
+}
+
+void UserSession::addChangeLog(
+    const ChangeChain::Offset offset, const uint8_t field_kind, const EntityType entity_type
+)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+    this->session_changes.push_back(offset);
+    this->change_kinds.push_back(field_kind);
+    this->entity_types.push_back(entity_type);
+    this->change_kind_counts[field_kind]++;
+    this->entity_type_counts[static_cast<size_t>(entity_type)]++;
 }
 
 void UserSession::logout()
 {
-    this->logout_time      = std::make_shared<Date>();
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (!this->is_active.load()) return;
+
+    this->logout_time      = Date();
     this->session_duration = *this->logout_time - this->login_time;
-    this->is_active        = false;
+    this->is_active.store(false);
 }
\ No newline at end of file
@@ -1,12 +1,35 @@
 #pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <mutex>
 #include <vector>
 
+#include "ChangeLog/change_chain.hpp"
 #include "DateTime/date.hpp"
 #include "DateTime/time_duration.hpp"
 #include "Usings/type_usings.hpp"
 
+/**
+ * @class UserSession
+ * @brief Login of one user and the changes made during it.
+ *
+ * Several worker threads may serve the same session at once, so the change list and the logout
+ * share a lock of the session and `getIsActive` reads an atomic flag without it.
+ * Next to the journal offset of each change the session keeps its field kind (the
+ * `ChangeLog::FieldVariant` alternative) and the type of the changed entity, with a count per
+ * kind and per type, so `SessionChanges` can count and filter a session's activity without
+ * touching the entities or the rest of the journal. The field kind alone does not tell clients
+ * from employees, whose person fields share `PersonFields`.
+ */
 class UserSession {
 public:
+    using ChangeKindCounts = std::array<uint32_t, 32>;  ///< Indexed by field kind
+    /// Indexed by `EntityType`
+    using EntityTypeCounts = std::array<uint32_t, static_cast<size_t>(EntityType::COUNT)>;
+
     UserSession(
         const std::string& token,
         const OptionalStr& ip_address,
@@ -17,28 +40,45 @@ public:
     /// @{
     auto getToken() const -> const std::string&;
     auto getLoginTime() const -> const Date&;
-    auto getLogoutTime() const -> const DatePtr&;
-    auto getSessionDuration() const -> const TimeDuration&;
+    /// Copied under the lock, empty while the session is active
+    auto getLogoutTime() const -> OptionalDate;
+    auto getSessionDuration() const -> TimeDuration;
     auto getIsActive() const -> bool;
     auto getIpAddress() const -> const OptionalStr&;
     auto getDeviceInfo() const -> const OptionalStr&;
-    auto getSessionChanges() const -> const std::vector<ChangeLog*>&;
+    /// Journal offsets of the changes made during the session, copied under the lock
+    auto getSessionChanges() const -> std::vector<ChangeChain::Offset>;
+    auto getChangeCount() const -> size_t;
+    /// Number of changes per field kind
+    auto getChangeKindCounts() const -> ChangeKindCounts;
+    /// Number of changes per type of the changed entity
+    auto getEntityTypeCounts() const -> EntityTypeCounts;
     /// @}
-    void addChangeLog(ChangeLog* change_log);
+    void addChangeLog(
+        const ChangeChain::Offset offset, const uint8_t field_kind, const EntityType entity_type
+    );
+    /// Only the first call ends the session
     void logout();
-    
+
 private:
     std::string  token;
 
     Date         login_time = Date();
-    DatePtr      logout_time;
+    OptionalDate logout_time;
     TimeDuration session_duration;
 
-    bool         is_active = true;
+    std::atomic<bool> is_active = true;
 
     OptionalStr  ip_address;
     OptionalStr  device_info;
 
     //
-    std::vector<ChangeLog*> session_changes;
+    friend class SessionChanges;  // copies the lists under the lock
+
+    mutable std::mutex               mutex;  ///< Guards the logout and the lists below
+    std::vector<ChangeChain::Offset> session_changes;
+    std::vector<uint8_t>             change_kinds;  ///< Field kind of each change
+    std::vector<EntityType>          entity_types;  ///< Type of the entity of each change
+    ChangeKindCounts                 change_kind_counts{};
+    EntityTypeCounts                 entity_type_counts{};
 };
\ No newline at end of file
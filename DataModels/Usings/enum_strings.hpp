@@ -0,0 +1,104 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <bit>
+#include <optional>
+#include <string_view>
+
+/**
+ * @struct EnumStrings
+ * @brief Compile-time name table of an enum.
+ *
+ * Specializations provide `static constexpr std::array<std::string_view, N> names` indexed by
+ * the enum value. `enumToStr` is a single array load, `enumFromStr` looks the text up in a
+ * perfect hash table built by the compiler, so neither allocates.
+ */
+template <typename Enum>
+struct EnumStrings;
+
+namespace enum_strings {
+    /// FNV-1a, used both at compile time to build the tables and at run time to probe them
+    constexpr auto hash(std::string_view text) -> uint64_t
+    {
+        uint64_t result = 0xcbf29ce484222325ULL;
+        for (char ch : text) {
+            result ^= static_cast<uint8_t>(ch);
+            result *= 0x100000001b3ULL;
+        }
+        return result;
+    }
+
+    /**
+     * @struct PerfectHash
+     * @brief Collision-free slot table for N names.
+     *
+     * A name lands in slot `(hash(name) * multiplier) >> shift`, slots hold the enum value + 1
+     * (0 means empty). The multiplier is searched at compile time until no two names collide.
+     */
+    template <size_t N>
+    struct PerfectHash {
+        static_assert(N < UINT8_MAX, "slot values are stored in uint8_t");
+        static constexpr size_t slot_count = std::bit_ceil(N * 4 < 8 ? size_t{8} : N * 4);
+        static constexpr int    shift      = 64 - std::countr_zero(slot_count);
+
+        uint64_t                        multiplier = 0;
+        std::array<uint8_t, slot_count> slots{};
+
+        constexpr auto slot(const uint64_t hash) const -> size_t
+        {
+            return static_cast<size_t>((hash * this->multiplier) >> shift);
+        }
+    };
+
+    template <size_t N>
+    constexpr auto buildPerfectHash(const std::array<std::string_view, N>& names) -> PerfectHash<N>
+    {
+        std::array<uint64_t, N> hashes{};
+        for (size_t i = 0; i < N; ++i) hashes[i] = hash(names[i]);
+
+        PerfectHash<N> table;
+        for (uint64_t seed = 1; seed < 100000; ++seed) {
+            table.multiplier = (seed * 0x9e3779b97f4a7c15ULL) | 1;
+            table.slots      = {};
+
+            bool collision   = false;
+            for (size_t i = 0; i < N && !collision; ++i) {
+                uint8_t& slot = table.slots[table.slot(hashes[i])];
+                if (slot != 0) collision = true;
+                slot = static_cast<uint8_t>(i + 1);
+            }
+            if (!collision) return table;
+        }
+        throw "enum names are not unique";  // only reachable at compile time
+    }
+
+    template <typename Enum>
+    inline constexpr auto parse_table = buildPerfectHash(EnumStrings<Enum>::names);
+}  // namespace enum_strings
+
+/// Name of the value, or an empty view for values outside the table
+template <typename Enum>
+constexpr auto enumToStr(const Enum value) -> std::string_view
+{
+    constexpr const auto& names = EnumStrings<Enum>::names;
+    if constexpr (requires { Enum::COUNT; }) {
+        static_assert(names.size() == static_cast<size_t>(Enum::COUNT), "table is incomplete");
+    }
+
+    size_t index = static_cast<size_t>(value);
+    return index < names.size() ? names[index] : std::string_view();
+}
+
+/// Exact (case-sensitive) reverse of `enumToStr`
+template <typename Enum>
+constexpr auto enumFromStr(const std::string_view text) -> std::optional<Enum>
+{
+    constexpr const auto& names = EnumStrings<Enum>::names;
+    constexpr const auto& table = enum_strings::parse_table<Enum>;
+
+    uint8_t slot = table.slots[table.slot(enum_strings::hash(text))];
+    if (slot == 0 || names[slot - 1] != text) return std::nullopt;
+    return static_cast<Enum>(slot - 1);
+}
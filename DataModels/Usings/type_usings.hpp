@@ -31,12 +31,12 @@ struct Meeting;
 struct Offer;
 class Company;
 class ExternalCompany;
+class InternedStr;
 class InternalEmployeeDataBase;
 class UserSession;
 struct TenantContext;
 
 using UserSessionPtr              = std::shared_ptr<UserSession>;
-using DurationPtr                 = std::shared_ptr<TimeDuration>;
 using FileMetadataPtr             = std::shared_ptr<FileMetadata>;
 using ExternalCompanyPtr          = std::shared_ptr<ExternalCompany>;
 using InteractionPtr              = std::shared_ptr<BaseInteraction>;
@@ -61,9 +61,11 @@ using CommentarySocialNetworksPtr = std::shared_ptr<CommentarySocialNetworks>;
 using WeakCampaignPtr             = std::weak_ptr<Campaign>;
 using StringPtr                   = std::shared_ptr<std::string>;
 using OptionalStr                 = std::optional<std::string>;
+using OptionalInterned            = std::optional<InternedStr>;
 using BaseInteractionPtr          = std::shared_ptr<BaseInteraction>;
 using MoneyPtr                    = std::shared_ptr<Money>;
-using DatePtr                     = std::shared_ptr<Date>;
+using OptionalDate                = std::optional<Date>;
+using OptionalDuration            = std::optional<TimeDuration>;
 using CampaignLeadPtr             = std::shared_ptr<CampaignLead>;
 using ChangeLogPtr                = std::shared_ptr<ChangeLog>;
 using CampaignPtr                 = std::shared_ptr<Campaign>;
@@ -15,7 +15,7 @@ void EventLog::log(
     const std::string& message
 )
 {
-    if (file->is_open()) {
+    if (file != nullptr && file->is_open()) {
         Date        date;
         std::string result;
         switch (level) {
@@ -34,10 +34,12 @@ void EventLog::log(
         result += date.getDateStr() + " - ";
 
         size_t start_file_name = message_file.find("Crm");
+        if (start_file_name == std::string::npos) start_file_name = 0;
         result += message_file.substr(start_file_name) + ":" + std::to_string(line) + " - ";
         result += message + '\n';
         std::lock_guard<std::mutex> lock(mt);
         file->write(result.c_str(), result.size());
+        file->flush();
     }
 }
 
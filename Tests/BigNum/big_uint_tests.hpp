@@ -12,9 +12,9 @@ namespace unit {
         BigUint     uint2(b);
         BigUint     uint3(c);
 
-        EXPECT_EQ(uint1.num, a);
-        EXPECT_EQ(uint2.num, b);
-        EXPECT_EQ(uint3.num, "4312");
+        EXPECT_EQ(uint1.toString(), a);
+        EXPECT_EQ(uint2.toString(), b);
+        EXPECT_EQ(uint3.toString(), "4312");
     }
 
     TEST(BigUintTest, InvalidConstructors)
@@ -55,4 +55,74 @@ namespace unit {
         EXPECT_TRUE(lint2 < rint2);
         EXPECT_FALSE(lint3 < rint3);
     }
+    TEST(BigUintTest, Zero)
+    {
+        EXPECT_EQ(BigUint("0").toString(), "0");
+        EXPECT_EQ(BigUint("0000"), BigUint());
+        EXPECT_EQ(BigUint().toString(), "0");
+    }
+    TEST(BigUintTest, WideValues)
+    {
+        std::string max_u64   = "18446744073709551615";
+        std::string over_u64  = "18446744073709551616";
+        std::string very_wide = "340282366920938463463374607431768211456";  // 2^128
+
+        BigUint     uint1(max_u64);
+        BigUint     uint2(over_u64);
+        BigUint     uint3(very_wide);
+
+        EXPECT_FALSE(uint1.isWide());
+        EXPECT_TRUE(uint2.isWide());
+        EXPECT_EQ(uint1.toString(), max_u64);
+        EXPECT_EQ(uint2.toString(), over_u64);
+        EXPECT_EQ(uint3.toString(), very_wide);
+
+        EXPECT_EQ(++uint1, over_u64.c_str());
+        EXPECT_EQ(uint1, uint2);
+        EXPECT_EQ(std::hash<BigUint>{}(uint1), std::hash<BigUint>{}(uint2));
+
+        EXPECT_TRUE(BigUint("99") < uint2);
+        EXPECT_TRUE(uint2 < uint3);
+        EXPECT_FALSE(uint3 < uint2);
+    }
+    TEST(BigUintTest, CopyAndMove)
+    {
+        BigUint wide("123456789012345678901234567890");
+        BigUint copy(wide);
+        EXPECT_EQ(copy, wide);
+
+        BigUint moved(std::move(copy));
+        EXPECT_EQ(moved.toString(), "123456789012345678901234567890");
+
+        BigUint assigned("1");
+        assigned = wide;
+        EXPECT_EQ(assigned, wide);
+        assigned = BigUint("7");
+        EXPECT_EQ(assigned, "7");
+    }
+    TEST(BigUintTest, Hash)
+    {
+        std::hash<BigUint> hasher;
+        EXPECT_EQ(hasher(BigUint("42")), hasher(BigUint(42)));
+        EXPECT_NE(hasher(BigUint("1")), hasher(BigUint("2")));
+    }
+    TEST(BigUintTest, ParseBatch)
+    {
+        std::string_view texts[] = {
+            "0", "18446744073709551615", "000123", "340282366920938463463374607431768211456",
+            "12x", "7"
+        };
+        BigUint          result[6];
+
+        EXPECT_EQ(BigUint::parseBatch(texts, result, 4), 4);
+        EXPECT_EQ(result[0], BigUint(uint64_t{0}));
+        EXPECT_EQ(result[1].toString(), "18446744073709551615");
+        EXPECT_FALSE(result[1].isWide());
+        EXPECT_EQ(result[2], BigUint(uint64_t{123}));
+        EXPECT_EQ(result[3].toString(), "340282366920938463463374607431768211456");
+
+        EXPECT_EQ(BigUint::parseBatch(texts, result, 6), 4);
+        EXPECT_EQ(BigUint::parseBatch(texts + 5, result + 5, 1), 1);
+        EXPECT_EQ(result[5], BigUint(uint64_t{7}));
+    }
 }  // namespace unit
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <string>
+#include <vector>
+
+#include "BigNum/digits.hpp"
+#include "Simd/simd.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    /// Every level the machine running the tests has, so each vector path is checked
+    inline auto runnableLevels() -> std::vector<simd::Level>
+    {
+        std::vector<simd::Level> levels{simd::Level::Scalar};
+        if (simd::supported() >= simd::Level::SSE41) levels.push_back(simd::Level::SSE41);
+        if (simd::supported() >= simd::Level::AVX2) levels.push_back(simd::Level::AVX2);
+        return levels;
+    }
+
+    TEST(DigitsTest, SupportedCoversTheBuildFlags)
+    {
+#if defined(__AVX2__)
+        EXPECT_EQ(simd::supported(), simd::Level::AVX2);
+#elif defined(__SSE4_1__)
+        EXPECT_GE(simd::supported(), simd::Level::SSE41);
+#endif
+        EXPECT_EQ(runnableLevels().back(), simd::supported());
+    }
+
+    TEST(DigitsTest, PrefixLengthOnEveryPath)
+    {
+        // 70 digits cover two AVX2 blocks, an SSE4.1 block and a scalar tail
+        const std::string digits_only = std::string("0123456789").append(60, '7');
+        for (const simd::Level level : runnableLevels()) {
+            SCOPED_TRACE(static_cast<int>(level));
+            const char* first = digits_only.data();
+            EXPECT_EQ(digits::prefixLength(first, first + digits_only.size(), level), 70);
+            EXPECT_EQ(digits::prefixLength(first, first, level), 0);
+
+            for (const char wrong : {'/', ':', ' ', '\x80', '\xFF'}) {
+                for (size_t position = 0; position < digits_only.size(); ++position) {
+                    std::string text = digits_only;
+                    text[position]   = wrong;
+                    EXPECT_EQ(
+                        digits::prefixLength(text.data(), text.data() + text.size(), level),
+                        position
+                    );
+                }
+            }
+        }
+    }
+
+    TEST(DigitsTest, ParseOnEveryPath)
+    {
+        const std::string text = "9876543210123456789";
+        for (const simd::Level level : runnableLevels()) {
+            SCOPED_TRACE(static_cast<int>(level));
+            for (size_t count = 0; count <= digits::max_u64_digits; ++count) {
+                const uint64_t expected = count == 0 ? 0 : std::stoull(text.substr(0, count));
+                EXPECT_EQ(digits::parse(text.data(), count, level), expected);
+            }
+            EXPECT_EQ(digits::parse("0000000000000000001", 19, level), 1);
+            EXPECT_EQ(digits::parse("1000000000000000000", 19, level), 1000000000000000000ULL);
+        }
+    }
+}  // namespace unit
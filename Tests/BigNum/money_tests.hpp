@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <vector>
+
 #include "gtest/gtest.h"
 #include "BigNum/money.hpp"
 
@@ -11,9 +14,9 @@ namespace unit {
         Money       money2(num2);
         Money       money3(num3);
 
-        EXPECT_EQ(money1.num, num1 + ".00");
-        EXPECT_EQ(money2.num, num2);
-        EXPECT_EQ(money3.num, num3 + ".00");
+        EXPECT_EQ(money1.toString(), num1 + ".00");
+        EXPECT_EQ(money2.toString(), num2);
+        EXPECT_EQ(money3.toString(), num3 + ".00");
     }
     TEST(MoneyTest, Less)
     {
@@ -31,36 +34,134 @@ namespace unit {
     {
         Money money("10");
         money += "";
-        EXPECT_EQ(money.num, "10.00");
+        EXPECT_EQ(money.toString(), "10.00");
 
         money += "0";
-        EXPECT_EQ(money.num, "10.00");
+        EXPECT_EQ(money.toString(), "10.00");
         
         money += "15";
-        EXPECT_EQ(money.num, "25.00");
+        EXPECT_EQ(money.toString(), "25.00");
 
         money += "0.10";
-        EXPECT_EQ(money.num, "25.10");
+        EXPECT_EQ(money.toString(), "25.10");
 
         money += "0.90";
-        EXPECT_EQ(money.num, "26.00");
+        EXPECT_EQ(money.toString(), "26.00");
     }
     TEST(MoneyTest, Subtraction)
     {
         Money money("10");
         money -= "";
-        EXPECT_EQ(money.num, "10.00");
+        EXPECT_EQ(money.toString(), "10.00");
 
         money -= "0";
-        EXPECT_EQ(money.num, "10.00");
+        EXPECT_EQ(money.toString(), "10.00");
 
         money -= "5";
-        EXPECT_EQ(money.num, "5.00");
+        EXPECT_EQ(money.toString(), "5.00");
 
         money -= "0.10";
-        EXPECT_EQ(money.num, "4.90");
+        EXPECT_EQ(money.toString(), "4.90");
 
         money -= "6.90";
-        EXPECT_EQ(money.num, "0.00");
+        EXPECT_EQ(money.toString(), "0.00");
+    }
+    TEST(MoneyTest, CurrencyScale)
+    {
+        Money yen("1500", CountriesCurrencies::JPY);
+        Money dinar("12.345", CountriesCurrencies::KWD);
+        Money btc("0.00000001", CryptoCurrency::BTC);
+
+        EXPECT_EQ(yen.getUnits(), 1500);
+        EXPECT_EQ(yen.toString(), "1500");
+        EXPECT_EQ(dinar.getUnits(), 12345);
+        EXPECT_EQ(dinar.toString(), "12.345");
+        EXPECT_EQ(btc.getUnits(), 1);
+        EXPECT_EQ(btc.toString(), "0.00000001");
+        EXPECT_EQ(Money("2.5", CryptoCurrency::BTC).toString(), "2.50");
+
+        EXPECT_THROW(Money("1.5", CountriesCurrencies::JPY), std::runtime_error);
+        EXPECT_THROW(Money("1.005"), std::runtime_error);
+        EXPECT_THROW(Money("1.0.0"), std::runtime_error);
+        EXPECT_THROW(Money("-1"), std::runtime_error);
+    }
+    TEST(MoneyTest, CheckedArithmetic)
+    {
+        Money usd("10.50");
+        usd += Money("0.75");
+        EXPECT_EQ(usd.toString(), "11.25");
+
+        // a payment larger than the balance is refused and leaves it as it was
+        EXPECT_THROW(usd.subtract(Money("20")), std::underflow_error);
+        EXPECT_THROW(usd.subtract("11.26"), std::underflow_error);
+        EXPECT_EQ(usd.toString(), "11.25");
+        usd.subtract("1.25");
+        EXPECT_EQ(usd.subtract(Money("10")).toString(), "0.00");
+        EXPECT_THROW(usd.subtract(Money("0", CountriesCurrencies::EUR)), std::invalid_argument);
+
+        // the operator saturates
+        usd += Money("5");
+        usd -= Money("20");
+        EXPECT_EQ(usd.toString(), "0.00");
+
+        EXPECT_THROW(usd += Money("1", CountriesCurrencies::EUR), std::invalid_argument);
+        EXPECT_THROW(usd -= Money("1", CountriesCurrencies::EUR), std::invalid_argument);
+
+        if constexpr (sizeof(Money::Units) == sizeof(int64_t)) {
+            Money huge("92233720368547758.07");
+            EXPECT_THROW(huge += "0.01", std::overflow_error);
+            EXPECT_THROW(Money("92233720368547758.08"), std::overflow_error);
+        }
+    }
+    TEST(MoneyTest, MultiplyByRate)
+    {
+        Money price("100.00");
+        EXPECT_EQ(price.multiply(10845, 4).toString(), "108.45");
+
+        Money cents("0.05");
+        EXPECT_EQ(cents.multiply(5, 1, Money::Rounding::HalfUp).toString(), "0.03");
+        EXPECT_EQ(cents.multiply(5, 1, Money::Rounding::HalfEven).toString(), "0.02");
+        EXPECT_EQ(cents.multiply(5, 1, Money::Rounding::Down).toString(), "0.02");
+        EXPECT_EQ(Money("0.01").multiply(1, 1, Money::Rounding::Up).toString(), "0.01");
+        EXPECT_EQ(Money("0.07").multiply(5, 1, Money::Rounding::HalfEven).toString(), "0.04");
+    }
+    TEST(MoneyTest, Compare)
+    {
+        EXPECT_TRUE(Money("9.99") < Money("10"));
+        EXPECT_TRUE(Money("100") == Money("100.00"));
+        EXPECT_TRUE(Money("1", CountriesCurrencies::EUR) != Money("1"));
+
+        // 1500 JPY and 15.00 USD are both 1500 minor units, amounts of a currency stay together
+        std::vector<Money> amounts{
+            Money("20"),
+            Money("1500", CountriesCurrencies::JPY),
+            Money("10"),
+            Money("100", CountriesCurrencies::JPY)
+        };
+        std::sort(amounts.begin(), amounts.end());
+        for (size_t i = 1; i < amounts.size(); i++) {
+            if (amounts[i].getCurrency() != amounts[i - 1].getCurrency()) continue;
+            EXPECT_LT(amounts[i - 1].getUnits(), amounts[i].getUnits());
+        }
+        EXPECT_EQ(amounts[0].getCurrency(), amounts[1].getCurrency());
+        EXPECT_EQ(amounts[2].getCurrency(), amounts[3].getCurrency());
+        Money yen("1500", CountriesCurrencies::JPY);
+        EXPECT_EQ(Money("10") < yen, Money("20") < yen);
+    }
+    TEST(MoneyTest, ParseBatch)
+    {
+        std::string_view texts[] = {"12.34", "0.5", ".07", "1000", "9000000000000000.5", "1.005"};
+        Money::Units     units[6] = {};
+
+        EXPECT_EQ(Money::parseBatch(texts, CountriesCurrencies::USD, units, 6), 5);
+        EXPECT_EQ(units[0], 1234);
+        EXPECT_EQ(units[1], 50);
+        EXPECT_EQ(units[2], 7);
+        EXPECT_EQ(units[3], 100000);
+        EXPECT_EQ(units[4], Money("9000000000000000.5").getUnits());
+
+        std::string_view yen[] = {"15", "1.5"};
+        EXPECT_EQ(Money::parseBatch(yen, CountriesCurrencies::JPY, units, 2), 1);
+        EXPECT_EQ(units[0], 15);
     }
 }  // namespace unit
\ No newline at end of file
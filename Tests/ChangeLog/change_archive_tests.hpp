@@ -0,0 +1,261 @@
+#include <algorithm>
+#include <filesystem>
+
+#include "ChangeLog/change_journal.hpp"
+#include "ChangeLog/lz_codec.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(ChangeArchiveTest, CodecRoundTrip)
+    {
+        std::string text;
+        for (int i = 0; i < 5000; i++) text += "record " + std::to_string(i % 97) + ";";
+        std::string noise;
+        for (int i = 0; i < 3000; i++) noise.push_back(static_cast<char>(i * 7919 % 251));
+
+        for (const std::string& data : {std::string(), std::string("abc"), text, noise}) {
+            std::string compressed = lz_codec::compress(data);
+            EXPECT_EQ(lz_codec::decompress(compressed, data.size()), data);
+        }
+        EXPECT_LT(lz_codec::compress(text).size(), text.size() / 4);
+        EXPECT_THROW(lz_codec::decompress(lz_codec::compress(text), text.size() - 1),
+                     std::runtime_error);
+    }
+
+    TEST(ChangeArchiveTest, CompactAndPageIn)
+    {
+        auto changer =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Archived", "Employee", std::nullopt);
+        auto&       journal = ChangeJournal::getInstance();
+        Date        start(1950, 1, 1, 0, 0);  // before the dates of the other tests
+        ChangeChain chain;
+        size_t      object_index = SIZE_MAX;
+        const int   count        = 2 * 4096;  // covers at least one whole chunk of records
+
+        for (int i = 0; i < count; i++) {
+            std::optional<ChangeLog::ValueVariant> value;
+            ChangeLog::FieldType                   type = ChangeLog::FieldType::String;
+
+            size_t after = object_index == SIZE_MAX ? 0 : i - object_index;
+            if (object_index == SIZE_MAX && journal.size() % 4096 == 0) {
+                object_index = i;
+                value        = WeakInternalEmployee(changer);
+                type         = ChangeLog::FieldType::WeakInternalEmployee;
+            } else if (after == 1) {
+                value = std::make_shared<Money>("12.50", CountriesCurrencies::EUR);
+                type  = ChangeLog::FieldType::Money;
+            } else if (after == 2) {
+                value = std::make_shared<PhoneNumber>("+0012345678901");
+                type  = ChangeLog::FieldType::PhoneNumber;
+            } else {
+                value = std::make_shared<std::string>("v" + std::to_string(i));
+            }
+            chain.append(
+                changer,
+                std::nullopt,
+                value,
+                TaskFields::Title,
+                ChangeLog::FieldType::null,
+                type,
+                ChangeLog::Action::Change,
+                Date::fromMinutes(start.getMinutes() + i)
+            );
+        }
+        ChangeLogView history(chain);
+        ASSERT_NE(object_index, SIZE_MAX);
+        StringPtr object_text = history[object_index]->getNewValueStr();
+        // the chunk starting at the object holds records of this chain only
+        std::weak_ptr<const void> chunk_values =
+            journal._getValueStore(history.offsets()[object_index]);
+        EXPECT_FALSE(chunk_values.expired());
+        EXPECT_EQ(journal._getCheckpointCount(chain), count / 64);
+
+        auto directory = std::filesystem::temp_directory_path() / "crm_change_archive_tests";
+        RetentionPolicy policy;
+        policy.directory = directory;
+        policy.rules.push_back(
+            {change_kind::tasks, std::nullopt, TimeDuration(0, 1, 0, 0, 0), std::nullopt, false}
+        );
+
+        Date now = Date::fromMinutes(start.getMinutes() + count + 24 * 60);
+        EXPECT_EQ(journal.compact(policy, now), count);
+        EXPECT_EQ(journal.compact(policy, now), 0);
+        ASSERT_FALSE(journal.getArchive().getSegments().empty());
+        // checkpoints own their values, so nothing holds the chunk any more
+        EXPECT_TRUE(chunk_values.expired());
+        EXPECT_EQ(journal._getCheckpointCount(chain), 1);
+        AuditQuery period;
+        period.from = start;
+        period.to   = now;
+        EXPECT_TRUE(journal.queryAudit(period).offsets.empty());
+        EXPECT_TRUE(std::filesystem::exists(journal.getArchive().getSegments().back()));
+
+        ASSERT_EQ(history.size(), count);
+        for (int i : {0, 1, 100, 4095, 4096, 5000, count - 1}) {
+            if (i - object_index <= 2) continue;
+            auto entry = history[i];
+            EXPECT_EQ(*entry->getNewValueStr(), "v" + std::to_string(i));
+            EXPECT_EQ(entry->getChangeDate(), Date::fromMinutes(start.getMinutes() + i));
+            EXPECT_EQ(entry->getChanger().lock(), changer);
+            EXPECT_EQ(entry->getField(), ChangeLog::FieldVariant(TaskFields::Title));
+        }
+
+        // objects are archived as their text, money and phone numbers as themselves
+        auto object = history[object_index];
+        EXPECT_EQ(object->getNewValueFieldType(), ChangeLog::FieldType::WeakInternalEmployee);
+        EXPECT_EQ(*object->getNewValueStr(), *object_text);
+        auto money = history[object_index + 1];
+        EXPECT_EQ(money->getNewValueFieldType(), ChangeLog::FieldType::Money);
+        EXPECT_EQ(
+            *std::get<std::shared_ptr<Money>>(*money->getNewValue()),
+            Money("12.50", CountriesCurrencies::EUR)
+        );
+        auto phone = history[object_index + 2];
+        EXPECT_EQ(phone->getNewValueFieldType(), ChangeLog::FieldType::PhoneNumber);
+        EXPECT_EQ(*phone->getNewValueStr(), "0012345678901");
+
+        auto offsets = history.offsets();
+        EXPECT_EQ(offsets.size(), count);
+        EXPECT_EQ(journal.getRecord(offsets[1]).prev, offsets[0]);
+
+        EntityState state = journal.getStateAt(chain, Date::fromMinutes(start.getMinutes() + 100));
+        EXPECT_EQ(*state.getValueStr(TaskFields::Title), "v100");
+        state = journal.getStateAt(chain, now);
+        EXPECT_EQ(*state.getValueStr(TaskFields::Title), "v" + std::to_string(count - 1));
+
+        std::filesystem::remove_all(directory);
+    }
+
+    // Clients and employees share `PersonFields`, so rules matched by field kind could not keep
+    // the history of one in memory while archiving the other
+    TEST(ChangeArchiveTest, RulesByEntityType)
+    {
+        auto&       journal = ChangeJournal::getInstance();
+        Date        start(1930, 1, 1, 0, 0);  // before the dates of the other tests
+        ChangeChain client(EntityType::Client);
+        ChangeChain employee(EntityType::InternalEmployee);
+        for (ChangeChain* chain : {&client, &employee}) {
+            chain->append(
+                InternalEmployeePtr(),
+                std::nullopt,
+                std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>("Name")),
+                PersonFields::Name,
+                ChangeLog::FieldType::null,
+                ChangeLog::FieldType::String,
+                ChangeLog::Action::Add,
+                start
+            );
+        }
+
+        auto directory = std::filesystem::temp_directory_path() / "crm_change_archive_types";
+        RetentionPolicy policy;
+        policy.directory = directory;
+        RetentionPolicy::Rule clients;
+        clients.kinds       = change_kind::people;
+        clients.entity_type = EntityType::Client;
+        clients.max_age     = TimeDuration(0, 1, 0, 0, 0);
+        policy.rules.push_back(clients);
+
+        EXPECT_EQ(journal.compact(policy, Date(1931, 1, 1, 0, 0)), 1);
+        EXPECT_TRUE(journal.getRecord(client.head).archived);
+        EXPECT_FALSE(journal.getRecord(employee.head).archived);
+        EXPECT_EQ(*ChangeLogView(client).back()->getNewValueStr(), "Name");
+
+        std::filesystem::remove_all(directory);
+    }
+
+    // Segments were named by a counter of their archive, so a second archive (or process)
+    // writing to the same directory overwrote the first one's files
+    TEST(ChangeArchiveTest, SegmentsOfArchivesSharingADirectoryStayApart)
+    {
+        auto directory = std::filesystem::temp_directory_path() / "crm_change_archive_shared";
+        std::filesystem::remove_all(directory);
+
+        std::vector<ChangeRecord> records(2);
+        for (uint32_t i = 0; i < records.size(); i++) {
+            records[i].entity  = i;
+            records[i].prev    = ChangeChain::npos;
+            records[i].changer = ChangeChain::npos;
+            records[i].minutes = static_cast<int32_t>(i);
+        }
+        auto read = [&](ChangeChain::Offset offset) -> const ChangeRecord& {
+            return records[offset];
+        };
+
+        ChangeArchive first;
+        ChangeArchive second;
+        first.write(directory, {0, 1}, read);
+        second.write(directory, {0, 1}, read);
+        first.write(directory, {0, 1}, read);
+
+        auto segments = first.getSegments();
+        segments.push_back(second.getSegments().front());
+        std::sort(segments.begin(), segments.end());
+        EXPECT_EQ(std::unique(segments.begin(), segments.end()), segments.end());
+        EXPECT_EQ(std::distance(std::filesystem::directory_iterator(directory), {}), 3);
+        EXPECT_EQ(first.load(1)->find(1)->entity, 1);
+        EXPECT_EQ(second.load(0)->find(0)->entity, 0);
+
+        std::filesystem::remove_all(directory);
+    }
+
+    // Values other than money and phone numbers came back as text, and the index written at the
+    // end of a segment was never read back
+    TEST(ChangeArchiveTest, SegmentsReopenWithTheirValues)
+    {
+        auto directory = std::filesystem::temp_directory_path() / "crm_change_archive_reopen";
+        std::filesystem::remove_all(directory);
+
+        auto address = std::make_shared<Address>("Norway", "Oslo", "Storgata", "1", "2", "0155");
+        address->setLatitude(59.91);
+        address->setIsValidated(true);
+        auto tax  = std::make_shared<TaxInfo>(TaxInfo{"VAT", 0.25, "NO-25", true});
+        auto pair = std::make_shared<std::pair<const std::string, const std::string>>("a", "b");
+
+        std::vector<ChangeRecord> records(10);
+        for (uint32_t i = 0; i < records.size(); i++) {
+            records[i].entity  = i;
+            records[i].prev    = ChangeChain::npos;
+            records[i].changer = ChangeChain::npos;
+            records[i].minutes = static_cast<int32_t>(i);
+        }
+        records[1].new_value = ChangeValue(address);
+        records[1].new_type  = ChangeLog::FieldType::Address;
+        records[5].new_value = ChangeValue(tax);
+        records[5].new_type  = ChangeLog::FieldType::TaxInfo;
+        records[9].new_value = ChangeValue(pair);
+        records[9].new_type  = ChangeLog::FieldType::StringPair;
+        auto read = [&](ChangeChain::Offset offset) -> const ChangeRecord& {
+            return records[offset];
+        };
+
+        // the two segments overlap: 3 and 7 fall between the offsets of the first one
+        ChangeArchive archive;
+        archive.write(directory, {1, 5, 9}, read);
+        archive.write(directory, {3, 7}, read);
+
+        ChangeArchive reopened;
+        for (const auto& segment : archive.getSegments()) reopened.open(segment);
+        for (ChangeChain::Offset offset : {1, 3, 5, 7, 9}) {
+            EXPECT_EQ(reopened.load(offset)->find(offset)->entity, offset);
+        }
+        EXPECT_THROW(reopened.load(4), std::out_of_range);
+        EXPECT_THROW(reopened.load(10), std::out_of_range);
+
+        auto value = [&](ChangeChain::Offset offset) {
+            return *reopened.load(offset)->find(offset)->new_value.toVariant();
+        };
+        EXPECT_EQ(*std::get<std::shared_ptr<Address>>(value(1)), *address);
+        EXPECT_EQ(std::get<std::shared_ptr<Address>>(value(1))->getLatitude(), 59.91);
+        EXPECT_TRUE(std::get<std::shared_ptr<Address>>(value(1))->getIsValidated());
+        EXPECT_EQ(*std::get<std::shared_ptr<TaxInfo>>(value(5)), *tax);
+        EXPECT_EQ(*std::get<decltype(pair)>(value(9)), *pair);
+
+        // a segment cut short is refused
+        auto path = archive.getSegments().front();
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+        EXPECT_THROW(ChangeArchive().open(path), std::runtime_error);
+
+        std::filesystem::remove_all(directory);
+    }
+}  // namespace unit
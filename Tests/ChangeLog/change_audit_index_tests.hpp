@@ -0,0 +1,159 @@
+#include "ChangeLog/change_journal.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(ChangeAuditIndexTest, Query)
+    {
+        auto first =
+            std::make_shared<InternalEmployee>(BigUint("1"), "First", "Auditor", std::nullopt);
+        auto second =
+            std::make_shared<InternalEmployee>(BigUint("2"), "Second", "Auditor", std::nullopt);
+        auto&       journal = ChangeJournal::getInstance();
+        Date        start(1990, 6, 1, 10, 0);
+        TenantScope tenant(1);  // the other tests change employees with the same ids
+        ChangeChain deal;
+        ChangeChain task;
+
+        auto change = [&](ChangeChain& chain, const InternalEmployeePtr& changer,
+                          ChangeLog::FieldVariant field, int minute) {
+            chain.append(
+                changer,
+                std::nullopt,
+                std::make_optional<ChangeLog::ValueVariant>(minute),
+                field,
+                ChangeLog::FieldType::null,
+                ChangeLog::FieldType::Int,
+                ChangeLog::Action::Change,
+                Date::fromMinutes(start.getMinutes() + minute)
+            );
+            return chain.head;
+        };
+
+        auto a0 = change(deal, first, DealFields::Title, 0);
+        auto a1 = change(task, first, TaskFields::Title, 1);
+        auto b2 = change(deal, second, DealFields::Title, 2);
+        auto a3 = change(deal, first, DealFields::Status, 3);
+        auto a4 = change(task, first, TaskFields::Title, 2 * 24 * 60);  // two days later
+        auto n5 = change(task, InternalEmployeePtr(), TaskFields::Title, 5);
+        auto a6 = change(deal, first, DealFields::Title, -1);  // dated before the others
+
+        AuditQuery by_first;
+        by_first.changer = first->getId();
+        EXPECT_EQ(journal.queryAudit(by_first).offsets, (std::vector{a6, a0, a1, a3, a4}));
+
+        AuditQuery period;
+        period.from = Date::fromMinutes(start.getMinutes());
+        period.to   = Date::fromMinutes(start.getMinutes() + 5);
+        EXPECT_EQ(journal.queryAudit(period).offsets, (std::vector{a0, a1, b2, a3, n5}));
+
+        period.kinds = change_kind::deals;
+        EXPECT_EQ(journal.queryAudit(period).offsets, (std::vector{a0, b2, a3}));
+
+        period.field = DealFields::Title;
+        EXPECT_EQ(journal.queryAudit(period).offsets, (std::vector{a0, b2}));
+
+        by_first.limit = 2;
+        auto page      = journal.queryAudit(by_first);
+        EXPECT_EQ(page.offsets, (std::vector{a6, a0}));
+        ASSERT_TRUE(page.next.has_value());
+
+        by_first.after = page.next;
+        page           = journal.queryAudit(by_first);
+        EXPECT_EQ(page.offsets, (std::vector{a1, a3}));
+
+        by_first.after = page.next;
+        page           = journal.queryAudit(by_first);
+        EXPECT_EQ(page.offsets, (std::vector{a4}));
+        EXPECT_FALSE(page.next.has_value());
+
+        AuditQuery unknown;
+        unknown.changer = BigUint("3");
+        EXPECT_TRUE(journal.queryAudit(unknown).offsets.empty());
+    }
+
+    // Clients and employees share `PersonFields`, so the kind mask alone cannot tell them apart
+    TEST(ChangeAuditIndexTest, EntityTypeFilter)
+    {
+        auto changer =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Type", "Auditor", std::nullopt);
+        auto&       journal = ChangeJournal::getInstance();
+        Date        start(1991, 6, 1, 10, 0);
+        TenantScope tenant(8);  // no other test changes anything there
+        ChangeChain client(EntityType::Client);
+        ChangeChain employee(EntityType::InternalEmployee);
+        for (ChangeChain* chain : {&client, &employee}) {
+            chain->append(
+                changer,
+                std::nullopt,
+                std::make_optional<ChangeLog::ValueVariant>(1),
+                PersonFields::Name,
+                ChangeLog::FieldType::null,
+                ChangeLog::FieldType::Int,
+                ChangeLog::Action::Change,
+                start
+            );
+        }
+
+        AuditQuery people;
+        people.changer = changer->getId();
+        people.kinds   = change_kind::people;
+        EXPECT_EQ(journal.queryAudit(people).offsets, (std::vector{client.head, employee.head}));
+
+        AuditQuery clients = people;
+        clients.entity_type = EntityType::Client;
+        EXPECT_EQ(journal.queryAudit(clients).offsets, std::vector{client.head});
+
+        AuditQuery employees = people;
+        employees.entity_type = EntityType::InternalEmployee;
+        EXPECT_EQ(journal.queryAudit(employees).offsets, std::vector{employee.head});
+    }
+
+    TEST(ChangeAuditIndexTest, TenantsAreKeptApart)
+    {
+        auto changer =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Same", "Id", std::nullopt);
+        auto&       journal = ChangeJournal::getInstance();
+        ChangeChain chain;
+        auto change = [&](const Date& date) {
+            chain.append(
+                changer,
+                std::nullopt,
+                std::make_optional<ChangeLog::ValueVariant>(1),
+                DealFields::Title,
+                ChangeLog::FieldType::null,
+                ChangeLog::FieldType::Int,
+                ChangeLog::Action::Change,
+                date
+            );
+            return chain.head;
+        };
+
+        ChangeChain::Offset second_offset;
+        ChangeChain::Offset third_offset;
+        {
+            TenantScope second(2);
+            second_offset = change(Date(1991, 1, 1, 10, 0));
+            {
+                TenantScope third(3);
+                third_offset = change(Date(1991, 1, 1, 11, 0));
+            }
+            EXPECT_EQ(TenantScope::current(), 2);
+        }
+        EXPECT_EQ(TenantScope::current(), 0);
+
+        AuditQuery by_changer;
+        by_changer.changer = changer->getId();
+        by_changer.from    = Date(1991, 1, 1);
+        by_changer.to      = Date(1991, 1, 2);
+        EXPECT_TRUE(journal.queryAudit(by_changer).offsets.empty());
+        {
+            TenantScope second(2);
+            EXPECT_EQ(journal.queryAudit(by_changer).offsets, std::vector{second_offset});
+        }
+        {
+            TenantScope third(3);
+            EXPECT_EQ(journal.queryAudit(by_changer).offsets, std::vector{third_offset});
+        }
+        EXPECT_EQ(journal.getRecord(second_offset).tenant, 2);
+    }
+}  // namespace unit
@@ -0,0 +1,208 @@
+#include <thread>
+
+#include "ChangeLog/change_journal.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(ChangeJournalTest, RecordSize) { EXPECT_EQ(sizeof(ChangeJournal::Record), 64); }
+
+    TEST(ChangeJournalTest, ChainHistory)
+    {
+        auto changer =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Name", "Surname", std::nullopt);
+        auto&       journal      = ChangeJournal::getInstance();
+        size_t      journal_size = journal.size();
+        ChangeChain first;
+        ChangeChain second;
+        Date        date(2024, 5, 17, 10, 30);
+
+        EXPECT_TRUE(ChangeLogView(first).empty());
+
+        first.append(
+            changer,
+            std::nullopt,
+            std::make_optional<ChangeLog::ValueVariant>(1),
+            PersonFields::Name,
+            ChangeLog::FieldType::null,
+            ChangeLog::FieldType::Int,
+            ChangeLog::Action::Add,
+            date
+        );
+        second.append(
+            InternalEmployeePtr(),
+            std::make_optional<ChangeLog::ValueVariant>(Deal::Status::Canceled),
+            std::nullopt,
+            DealFields::Status,
+            ChangeLog::FieldType::DealStatus,
+            ChangeLog::FieldType::null,
+            ChangeLog::Action::Remove
+        );
+        first.append(
+            changer,
+            std::make_optional<ChangeLog::ValueVariant>(1),
+            std::make_optional<ChangeLog::ValueVariant>(2),
+            TaskFields::Title,
+            ChangeLog::FieldType::Int,
+            ChangeLog::FieldType::Int,
+            ChangeLog::Action::Change,
+            date
+        );
+
+        EXPECT_EQ(journal.size(), journal_size + 3);
+        EXPECT_NE(first.entity, second.entity);
+
+        ChangeLogView history(first);
+        ASSERT_EQ(history.size(), 2);
+
+        auto added = history.front();
+        EXPECT_EQ(added->getChanger().lock(), changer);
+        EXPECT_FALSE(added->getOldValue().has_value());
+        EXPECT_EQ(std::get<int>(added->getNewValue().value()), 1);
+        EXPECT_EQ(added->getField(), ChangeLog::FieldVariant(PersonFields::Name));
+        EXPECT_EQ(added->getAction(), ChangeLog::Action::Add);
+        EXPECT_EQ(added->getChangeDate(), date);
+
+        auto changed = history.back();
+        EXPECT_EQ(std::get<int>(changed->getOldValue().value()), 1);
+        EXPECT_EQ(std::get<int>(changed->getNewValue().value()), 2);
+        EXPECT_EQ(changed->getField(), ChangeLog::FieldVariant(TaskFields::Title));
+        EXPECT_EQ(history[1]->getField(), changed->getField());
+
+        auto removed = ChangeLogView(second).back();
+        EXPECT_EQ(removed->getChanger().lock(), nullptr);
+        EXPECT_EQ(std::get<Deal::Status>(removed->getOldValue().value()), Deal::Status::Canceled);
+        EXPECT_FALSE(removed->getNewValue().has_value());
+
+        auto offsets = history.offsets();
+        ASSERT_EQ(offsets.size(), 2);
+        EXPECT_LT(offsets[0], offsets[1]);
+        EXPECT_EQ(journal.getRecord(offsets[1]).prev, offsets[0]);
+        EXPECT_THROW(history[2], std::out_of_range);
+    }
+
+    TEST(ChangeJournalTest, ViewIteratesBothWays)
+    {
+        static_assert(std::bidirectional_iterator<ChangeLogView::Iterator>);
+
+        ChangeChain chain;
+        for (int i = 0; i < 5; i++) {
+            chain.append(
+                InternalEmployeePtr(),
+                std::make_optional<ChangeLog::ValueVariant>(i),
+                std::make_optional<ChangeLog::ValueVariant>(i + 1),
+                TaskFields::Title,
+                ChangeLog::FieldType::Int,
+                ChangeLog::FieldType::Int,
+                ChangeLog::Action::Change
+            );
+        }
+        ChangeLogView history(chain);
+
+        std::vector<int> forward;
+        for (const ChangeLogPtr& log : history) {
+            forward.push_back(std::get<int>(log->getNewValue().value()));
+        }
+        EXPECT_EQ(forward, (std::vector{1, 2, 3, 4, 5}));
+
+        std::vector<int> backward;
+        for (auto it = history.end(); it != history.begin();) {
+            backward.push_back(std::get<int>((*--it)->getNewValue().value()));
+        }
+        EXPECT_EQ(backward, (std::vector{5, 4, 3, 2, 1}));
+
+        for (size_t i = 0; i < history.size(); i++) {
+            EXPECT_EQ(std::get<int>(history[i]->getNewValue().value()), static_cast<int>(i + 1));
+        }
+        EXPECT_EQ(history.offsets().size(), 5);
+        EXPECT_EQ(ChangeLogView(ChangeChain()).begin(), ChangeLogView(ChangeChain()).end());
+    }
+
+    TEST(ChangeJournalTest, ChainOwnsItsRecords)
+    {
+        TenantScope tenant(5);  // no other test changes anything as this changer there
+        auto        changer =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Name", "Surname", std::nullopt);
+        auto&      journal = ChangeJournal::getInstance();
+        AuditQuery by_changer;
+        by_changer.changer = changer->getId();
+
+        auto change = [&](ChangeChain& chain, const std::string& title) {
+            chain.append(
+                changer,
+                std::nullopt,
+                std::make_optional<ChangeLog::ValueVariant>(std::make_shared<std::string>(title)),
+                TaskFields::Title,
+                ChangeLog::FieldType::null,
+                ChangeLog::FieldType::String,
+                ChangeLog::Action::Change
+            );
+        };
+
+        ChangeChain::Offset offset;
+        {
+            ChangeChain chain;
+            change(chain, "First");
+            change(chain, "Second");
+            offset = chain.head;
+
+            ChangeChain copy = chain;
+            ASSERT_EQ(copy.count, 2);
+            EXPECT_NE(copy.entity, chain.entity);
+            auto first = ChangeLogView(copy).front();
+            EXPECT_EQ(*std::get<StringPtr>(first->getNewValue().value()), "First");
+            change(copy, "Third");
+            EXPECT_EQ(ChangeLogView(chain).size(), 2);
+            EXPECT_EQ(ChangeLogView(copy).size(), 3);
+            // a copy is not a change of its own
+            EXPECT_EQ(journal.queryAudit(by_changer).offsets.size(), 3);
+
+            ChangeChain moved = std::move(chain);
+            EXPECT_EQ(moved.head, offset);
+            EXPECT_EQ(chain.entity, ChangeChain::npos);
+        }
+        EXPECT_TRUE(journal.queryAudit(by_changer).offsets.empty());
+        EXPECT_TRUE(journal.getRecord(offset).new_value.empty());
+    }
+
+    TEST(ChangeJournalTest, ConcurrentAppends)
+    {
+        constexpr size_t thread_count = 4;
+        constexpr int    per_thread   = 3000;  // more than fits one chunk together
+
+        auto&                    journal      = ChangeJournal::getInstance();
+        size_t                   journal_size = journal.size();
+        std::vector<ChangeChain> chains(thread_count);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < thread_count; i++) {
+            threads.emplace_back([&, i] {
+                TenantScope tenant(static_cast<uint16_t>(10 + i));
+                for (int value = 0; value < per_thread; value++) {
+                    chains[i].append(
+                        InternalEmployeePtr(),
+                        std::nullopt,
+                        std::make_optional<ChangeLog::ValueVariant>(
+                            std::make_shared<std::string>(std::to_string(value))
+                        ),
+                        TaskFields::Title,
+                        ChangeLog::FieldType::null,
+                        ChangeLog::FieldType::String,
+                        ChangeLog::Action::Change
+                    );
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        EXPECT_EQ(journal.size(), journal_size + thread_count * per_thread);
+        for (const auto& chain : chains) {
+            ChangeLogView history(chain);
+            ASSERT_EQ(history.size(), per_thread);
+            int value = 0;
+            for (const ChangeLogPtr& log : history) {
+                EXPECT_EQ(
+                    *std::get<StringPtr>(log->getNewValue().value()), std::to_string(value++)
+                );
+            }
+        }
+    }
+}  // namespace unit
@@ -0,0 +1,127 @@
+#include "ChangeLog/change_renderer.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(ChangeRendererTest, Render)
+    {
+        auto changer =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Name", "Surname", std::nullopt);
+        ChangeChain chain;
+        Date        date(2024, 3, 9, 14, 5);
+
+        chain.append(
+            changer,
+            std::nullopt,
+            ChangeValue::fromText("Sales"),
+            PersonFields::Name,
+            ChangeLog::FieldType::null,
+            ChangeLog::FieldType::String,
+            ChangeLog::Action::Add,
+            date
+        );
+        chain.append(
+            changer,
+            std::make_optional<ChangeLog::ValueVariant>(Task::Status::NotStarted),
+            std::make_optional<ChangeLog::ValueVariant>(Task::Status::Completed),
+            TaskFields::Status,
+            ChangeLog::FieldType::TaskStatus,
+            ChangeLog::FieldType::TaskStatus,
+            ChangeLog::Action::Change,
+            date
+        );
+        chain.append(
+            InternalEmployeePtr(),
+            std::make_optional<ChangeLog::ValueVariant>(7),
+            std::nullopt,
+            DealFields::Status,
+            ChangeLog::FieldType::Int,
+            ChangeLog::FieldType::null,
+            ChangeLog::Action::Remove
+        );
+
+        auto offsets = ChangeLogView(chain).offsets();
+        auto table   = ChangeRenderer().render(offsets);
+        ASSERT_EQ(table.size(), 3);
+
+        auto added = table[0];
+        EXPECT_EQ(added.offset, offsets[0]);
+        EXPECT_EQ(added.change_date, date);
+        EXPECT_EQ(added.action, ChangeLog::Action::Add);
+        EXPECT_EQ(added.field, "Name");
+        EXPECT_EQ(added.changer, "Name Surname");
+        EXPECT_TRUE(added.old_value.empty());
+        EXPECT_EQ(added.new_value, "Sales");
+
+        auto changed = table[1];
+        EXPECT_EQ(changed.old_value, enumToStr(Task::Status::NotStarted));
+        EXPECT_EQ(changed.new_value, enumToStr(Task::Status::Completed));
+        // one changer is written once per batch
+        EXPECT_EQ(changed.changer.data(), added.changer.data());
+
+        auto removed = table[2];
+        EXPECT_TRUE(removed.changer.empty());
+        EXPECT_EQ(removed.old_value, "7");
+        EXPECT_TRUE(removed.new_value.empty());
+
+        // every value lives in the table's own buffer
+        EXPECT_GE(added.new_value.data(), table.text().data());
+        EXPECT_LE(
+            removed.old_value.data() + removed.old_value.size(),
+            table.text().data() + table.text().size()
+        );
+        EXPECT_THROW(table[3], std::out_of_range);
+        EXPECT_TRUE(ChangeRenderer().render({}).empty());
+    }
+
+    TEST(ChangeRendererTest, Write)
+    {
+        auto changer =
+            std::make_shared<InternalEmployee>(BigUint("2"), "Anna", "Lee", std::nullopt);
+        ChangeChain chain;
+        Date        date(2024, 3, 9, 14, 5);
+
+        chain.append(
+            changer,
+            ChangeValue::fromText("first\tline\nsecond"),
+            std::make_optional<ChangeLog::ValueVariant>(true),
+            PersonFields::Name,
+            ChangeLog::FieldType::String,
+            ChangeLog::FieldType::Bool,
+            ChangeLog::Action::Change,
+            date
+        );
+
+        std::string    text;
+        size_t         blocks = 0;
+        ChangeRenderer renderer;
+        renderer.write(ChangeLogView(chain).offsets(), [&](std::string_view block) {
+            text.append(block);
+            blocks++;
+        });
+
+        EXPECT_EQ(blocks, 1);
+        EXPECT_EQ(
+            text, date.getDateStr() + "\tAnna Lee\tName\tChange\tfirst line second\tTrue\n"
+        );
+    }
+
+    TEST(ChangeRendererTest, EntryText)
+    {
+        ChangeChain chain;
+        chain.append(
+            InternalEmployeePtr(),
+            std::make_optional<ChangeLog::ValueVariant>(TimeDuration(0, 1, 2, 3, 4)),
+            ChangeValue::fromText("Text"),
+            PersonFields::Name,
+            ChangeLog::FieldType::TimeDuration,
+            ChangeLog::FieldType::String,
+            ChangeLog::Action::Change
+        );
+
+        auto log = ChangeLogView(chain).back();
+        EXPECT_EQ(*log->getOldValueStr(), TimeDuration(0, 1, 2, 3, 4).getDurationStr());
+        EXPECT_EQ(*log->getNewValueStr(), "Text");
+        // built again on every call, nothing is kept on the entry
+        EXPECT_NE(log->getOldValueStr(), log->getOldValueStr());
+    }
+}  // namespace unit
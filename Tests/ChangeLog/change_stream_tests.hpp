@@ -0,0 +1,166 @@
+#include <thread>
+#include <vector>
+
+#include "ChangeLog/change_journal.hpp"
+#include "ChangeLog/change_stream.hpp"
+#include "Person/Client/client.hpp"
+#include "Task/task.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(ChangeStreamTest, BatchRead)
+    {
+        ChangeStream stream(8);
+        EXPECT_EQ(stream.getCapacity(), 8);
+
+        auto first = stream.subscribe();
+        stream.publish(ChangeEvent::entity(
+            ChangeEvent::Type::Add, EntityType::Deal, BigUint(7), Date(2024, 1, 2)
+        ));
+        auto        second = stream.subscribe();  // starts after the first event
+        ChangeChain chain(EntityType::Task, BigUint(1));
+        for (uint32_t i = 0; i < 3; i++) stream.publish(ChangeEvent::change(i, chain, 2, 3));
+
+        std::vector<ChangeEvent> batch(2);
+        ASSERT_EQ(first.read(batch), 2);
+        EXPECT_EQ(batch[0].sequence, 0);
+        EXPECT_EQ(batch[0].type, ChangeEvent::Type::Add);
+        EXPECT_EQ(batch[0].entity_type, EntityType::Deal);
+        EXPECT_EQ(batch[0].id, 7);
+        EXPECT_FALSE(batch[0].wide_id);
+        EXPECT_EQ(batch[0].minutes, Date(2024, 1, 2).getMinutes());
+        EXPECT_EQ(batch[1].type, ChangeEvent::Type::Change);
+        EXPECT_EQ(batch[1].offset, 0);
+        EXPECT_EQ(batch[1].entity_type, EntityType::Task);
+        EXPECT_EQ(batch[1].getId(), BigUint(1));
+        EXPECT_EQ(first.getLag(), 2);
+
+        ASSERT_EQ(first.read(batch), 2);
+        EXPECT_EQ(batch[1].sequence, 3);
+        EXPECT_EQ(first.read(batch), 0);
+        EXPECT_EQ(first.getLag(), 0);
+
+        EXPECT_EQ(second.getLag(), 3);
+        auto stats = stream.getStats();
+        EXPECT_EQ(stats.published, 4);
+        EXPECT_EQ(stats.subscribers, 2);
+        EXPECT_EQ(stats.max_lag, 3);
+
+        second = ChangeSubscription();
+        EXPECT_EQ(stream.getStats().subscribers, 1);
+    }
+
+    TEST(ChangeStreamTest, OverwriteDropsOldest)
+    {
+        ChangeStream stream(4);
+        auto         subscriber = stream.subscribe();
+        ChangeChain  chain;
+        for (uint32_t i = 0; i < 10; i++) stream.publish(ChangeEvent::change(i, chain, 0, 0));
+
+        std::vector<ChangeEvent> batch(10);
+        ASSERT_EQ(subscriber.read(batch), 4);
+        EXPECT_EQ(batch[0].sequence, 6);
+        EXPECT_EQ(batch[3].sequence, 9);
+        EXPECT_EQ(subscriber.getDropped(), 6);
+        EXPECT_EQ(stream.getStats().dropped, 6);
+    }
+
+    TEST(ChangeStreamTest, SubscriberLimit)
+    {
+        ChangeStream                    stream(4);
+        std::vector<ChangeSubscription> subscribers;
+        for (size_t i = 0; i < ChangeStream::max_subscribers; i++) {
+            subscribers.push_back(stream.subscribe());
+        }
+        EXPECT_THROW(stream.subscribe(), std::length_error);
+        subscribers.pop_back();
+        EXPECT_NO_THROW(stream.subscribe());
+    }
+
+    TEST(ChangeStreamTest, WaitForSlowSubscriber)
+    {
+        constexpr uint32_t producers  = 4;
+        constexpr uint32_t per_thread = 2000;
+        ChangeStream       stream(64, ChangeStream::Overflow::Wait);
+        auto               subscriber = stream.subscribe();
+
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0; t < producers; t++) {
+            threads.emplace_back([&stream, t] {
+                ChangeChain chain(EntityType::Task, BigUint(t));
+                for (uint32_t i = 0; i < per_thread; i++) {
+                    stream.publish(ChangeEvent::change(i, chain, 0, 0));
+                }
+            });
+        }
+
+        std::vector<uint32_t>    next(producers, 0);
+        std::vector<ChangeEvent> batch(16);
+        uint64_t                 expected = 0;
+        bool                     ordered  = true;
+        while (expected < producers * per_thread) {
+            size_t count = subscriber.read(batch);
+            for (size_t i = 0; i < count; i++) {
+                // sequences have no gaps and each producer's events keep their order
+                ordered &= batch[i].sequence == expected++;
+                ordered &= batch[i].offset == next[batch[i].id]++;
+            }
+            if (count == 0) std::this_thread::yield();
+        }
+        for (auto& thread : threads) thread.join();
+
+        EXPECT_TRUE(ordered);
+        EXPECT_EQ(subscriber.getDropped(), 0);
+        EXPECT_EQ(stream.getStats().dropped, 0);
+    }
+
+    TEST(ChangeStreamTest, JournalPublishesChanges)
+    {
+        auto        subscriber = ChangeStream::getInstance().subscribe();
+        ChangeChain chain(EntityType::Deal, BigUint(42));
+        chain.append(
+            InternalEmployeePtr(),
+            std::nullopt,
+            std::make_optional<ChangeLog::ValueVariant>(1),
+            DealFields::Title,
+            ChangeLog::FieldType::null,
+            ChangeLog::FieldType::Int,
+            ChangeLog::Action::Change,
+            Date(2024, 3, 4)
+        );
+
+        std::vector<ChangeEvent> batch(4);
+        ASSERT_EQ(subscriber.read(batch), 1);
+        EXPECT_EQ(batch[0].type, ChangeEvent::Type::Change);
+        EXPECT_EQ(batch[0].offset, chain.head);
+        EXPECT_EQ(batch[0].entity_type, EntityType::Deal);
+        EXPECT_EQ(batch[0].id, 42);
+        EXPECT_EQ(batch[0].field_kind, ChangeLog::FieldVariant(DealFields::Title).index());
+        EXPECT_EQ(batch[0].minutes, Date(2024, 3, 4).getMinutes());
+    }
+
+    TEST(ChangeStreamTest, EventsNameTheirEntity)
+    {
+        BigUint wide("123456789012345678901234567890");
+        auto    subscriber = ChangeStream::getInstance().subscribe();
+        auto    task       = std::make_shared<Task>(wide);
+        auto    client     = std::make_shared<Client>(BigUint(5), "Name", "Surname", std::nullopt);
+        task->_setPriority(Priority::High, nullptr);
+        client->_setName("Other", nullptr);
+        ChangeStream::getInstance().publish(
+            ChangeEvent::entity(ChangeEvent::Type::HardRemove, EntityType::Task, wide)
+        );
+
+        std::vector<ChangeEvent> batch(4);
+        ASSERT_EQ(subscriber.read(batch), 3);
+        EXPECT_EQ(batch[0].entity_type, EntityType::Task);
+        EXPECT_TRUE(batch[0].wide_id);
+        EXPECT_EQ(batch[0].getId(), wide);
+        EXPECT_EQ(batch[1].entity_type, EntityType::Client);
+        EXPECT_FALSE(batch[1].wide_id);
+        EXPECT_EQ(batch[1].getId(), BigUint(5));
+        // the same wide id keeps its number
+        EXPECT_EQ(batch[2].id, batch[0].id);
+        EXPECT_EQ(batch[2].getId(), wide);
+    }
+}  // namespace unit
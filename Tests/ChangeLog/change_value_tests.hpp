@@ -0,0 +1,73 @@
+#include "ChangeLog/change_value.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(ChangeValueTest, Inline)
+    {
+        EXPECT_TRUE(ChangeValue().empty());
+        EXPECT_TRUE(ChangeValue(std::nullopt).empty());
+        EXPECT_FALSE(ChangeValue().toVariant().has_value());
+
+        ChangeValue number(std::make_optional<ChangeLog::ValueVariant>(-42));
+        EXPECT_EQ(number.getKind(), ChangeValue::Kind::Integer);
+        EXPECT_EQ(std::get<int>(number.toVariant().value()), -42);
+
+        ChangeValue real(1.25);
+        EXPECT_EQ(real.getKind(), ChangeValue::Kind::Real);
+        EXPECT_EQ(std::get<double>(real.toVariant().value()), 1.25);
+
+        ChangeValue status(std::make_optional(Task::Status::Completed));
+        EXPECT_EQ(std::get<Task::Status>(status.toVariant().value()), Task::Status::Completed);
+
+        Date        date(2023, 11, 2, 8, 15);
+        ChangeValue date_value(date);
+        EXPECT_EQ(std::get<Date>(date_value.toVariant().value()), date);
+
+        ChangeValue duration(TimeDuration(1, 2, 3, 4, 5));
+        EXPECT_EQ(
+            std::get<TimeDuration>(duration.toVariant().value()), TimeDuration(1, 2, 3, 4, 5)
+        );
+
+        ChangeValue currency(Currencies(CryptoCurrency::BTC));
+        EXPECT_EQ(
+            std::get<Currencies>(currency.toVariant().value()), Currencies(CryptoCurrency::BTC)
+        );
+    }
+
+    TEST(ChangeValueTest, Referenced)
+    {
+        std::string text       = "Sales";
+        ChangeValue text_value = ChangeValue::fromText(text);
+        EXPECT_EQ(text_value.getKind(), ChangeValue::Kind::Text);
+        EXPECT_EQ(text_value.getText(), "Sales");
+        EXPECT_EQ(*std::get<StringPtr>(text_value.toVariant().value()), "Sales");
+
+        auto note          = std::make_shared<Note>(WeakInternalEmployee(), nullptr, "T", "Text");
+        auto optional_note = std::make_optional(note);
+
+        ChangeValue object(optional_note);
+        EXPECT_EQ(object.getKind(), ChangeValue::Kind::Object);
+        EXPECT_EQ(std::get<std::shared_ptr<Note>>(object.toVariant().value()), note);
+    }
+
+    TEST(ChangeValueTest, JournalCopy)
+    {
+        ChangeChain chain;
+        {
+            std::string text = "temporary";
+            chain.append(
+                InternalEmployeePtr(),
+                std::nullopt,
+                ChangeValue::fromText(text),
+                PersonFields::Name,
+                ChangeLog::FieldType::null,
+                ChangeLog::FieldType::String,
+                ChangeLog::Action::Add
+            );
+            text.assign(text.size(), 'x');
+        }
+        auto log = ChangeLogView(chain).back();
+        EXPECT_EQ(*std::get<StringPtr>(log->getNewValue().value()), "temporary");
+        EXPECT_EQ(*log->getNewValueStr(), "temporary");
+    }
+}  // namespace unit
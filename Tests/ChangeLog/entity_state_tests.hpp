@@ -0,0 +1,98 @@
+#include "ChangeLog/change_journal.hpp"
+#include "Task/task.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(EntityStateTest, Replay)
+    {
+        constexpr int changes = 200;  // spans several checkpoints
+        Date          start(2024, 1, 10, 9, 0);
+        ChangeChain   chain;
+
+        for (int i = 0; i < changes; i++) {
+            std::string previous = std::to_string(i - 1);
+            chain.append(
+                InternalEmployeePtr(),
+                i == 0 ? ChangeValue() : ChangeValue::fromText(previous),
+                ChangeValue::fromText(std::to_string(i)),
+                TaskFields::Title,
+                i == 0 ? ChangeLog::FieldType::null : ChangeLog::FieldType::String,
+                ChangeLog::FieldType::String,
+                ChangeLog::Action::Change,
+                Date::fromMinutes(start.getMinutes() + i)
+            );
+        }
+
+        auto& journal = ChangeJournal::getInstance();
+        auto  before  = journal.getStateAt(chain, Date::fromMinutes(start.getMinutes() - 1));
+        EXPECT_FALSE(before.contains(TaskFields::Title));
+
+        for (int i : {0, 1, 62, 63, 64, 100, 127, 128, changes - 1}) {
+            auto state = journal.getStateAt(chain, Date::fromMinutes(start.getMinutes() + i));
+            EXPECT_EQ(*state.getValueStr(TaskFields::Title), std::to_string(i));
+            EXPECT_EQ(state.getFields().size(), 1);
+        }
+        auto later = journal.getStateAt(chain, Date::fromMinutes(start.getMinutes() + 1000));
+        EXPECT_EQ(*later.getValueStr(TaskFields::Title), std::to_string(changes - 1));
+        EXPECT_FALSE(later.contains(TaskFields::Description));
+    }
+
+    TEST(EntityStateTest, ListFields)
+    {
+        Date        date(2024, 2, 1, 12, 0);
+        ChangeChain chain;
+
+        auto add = [&](const std::string& tag, int minute) {
+            chain.append(
+                InternalEmployeePtr(),
+                std::nullopt,
+                ChangeValue::fromText(tag),
+                PersonFields::Tags,
+                ChangeLog::FieldType::null,
+                ChangeLog::FieldType::String,
+                ChangeLog::Action::Add,
+                Date::fromMinutes(date.getMinutes() + minute)
+            );
+        };
+        add("vip", 0);
+        add("partner", 1);
+        chain.append(
+            InternalEmployeePtr(),
+            ChangeValue::fromText("vip"),
+            std::nullopt,
+            PersonFields::Tags,
+            ChangeLog::FieldType::String,
+            ChangeLog::FieldType::null,
+            ChangeLog::Action::Remove,
+            Date::fromMinutes(date.getMinutes() + 2)
+        );
+
+        auto& journal = ChangeJournal::getInstance();
+        auto  before  = journal.getStateAt(chain, Date::fromMinutes(date.getMinutes() + 1));
+        auto  after   = journal.getStateAt(chain, Date::fromMinutes(date.getMinutes() + 2));
+
+        auto tags = before.getValues(PersonFields::Tags);
+        ASSERT_EQ(tags.size(), 2);
+        EXPECT_EQ(*std::get<StringPtr>(tags[0]), "vip");
+        EXPECT_EQ(*std::get<StringPtr>(tags[1]), "partner");
+
+        tags = after.getValues(PersonFields::Tags);
+        ASSERT_EQ(tags.size(), 1);
+        EXPECT_EQ(*std::get<StringPtr>(tags[0]), "partner");
+    }
+
+    TEST(EntityStateTest, Entity)
+    {
+        auto changer =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Name", "Surname", std::nullopt);
+        Task task(BigUint("1"));
+        EXPECT_FALSE(task.getStateAt(Date()).contains(TaskFields::Title));
+
+        task._setTitle("Prepare offer", changer);
+        auto state = task.getStateAt(Date());
+        EXPECT_EQ(*state.getValueStr(TaskFields::Title), "Prepare offer");
+        EXPECT_EQ(
+            *std::get<StringPtr>(state.getValue(TaskFields::Title).value()), task.getTitle()
+        );
+    }
+}  // namespace unit
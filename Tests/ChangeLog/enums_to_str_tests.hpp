@@ -248,4 +248,66 @@ namespace unit {
             EXPECT_NE(ChangeLog::caseStatusToStr(status), std::string());
         }
     }
+
+    template <typename Enum>
+    void expectRoundTrip()
+    {
+        for (size_t i = 0; i < (size_t)Enum::COUNT; i++) {
+            Enum value = (Enum)i;
+            EXPECT_EQ(enumFromStr<Enum>(enumToStr(value)), value);
+        }
+    }
+
+    TEST(EnumFromStrTests, RoundTrip)
+    {
+        expectRoundTrip<Priority>();
+        expectRoundTrip<PhoneCallData::CallType>();
+        expectRoundTrip<Meeting::MeetingOutcome>();
+        expectRoundTrip<InteractionResult::ResultStatus>();
+        expectRoundTrip<BaseInteraction::InteractionType>();
+        expectRoundTrip<Deal::Status>();
+        expectRoundTrip<Gender>();
+        expectRoundTrip<AccessRole>();
+        expectRoundTrip<Client::ClientType>();
+        expectRoundTrip<Client::LeadStatus>();
+        expectRoundTrip<ExternalCompany::CompanySize>();
+        expectRoundTrip<ReportType>();
+        expectRoundTrip<CaseStatus>();
+    }
+
+    TEST(EnumFromStrTests, Unknown)
+    {
+        static_assert(enumToStr(Priority::High) == "High");
+        static_assert(enumFromStr<Priority>("Critical") == Priority::Critical);
+
+        EXPECT_EQ(enumFromStr<Priority>("high"), std::nullopt);
+        EXPECT_EQ(enumFromStr<Deal::Status>(""), std::nullopt);
+        EXPECT_EQ(enumFromStr<Task::Status>("Not started "), std::nullopt);
+        EXPECT_EQ(enumToStr((Priority)200), std::string_view());
+    }
+
+    TEST(EnumFromStrTests, Fields)
+    {
+        EXPECT_EQ(enumToStr(TaskFields::ETC), "ETC");
+        EXPECT_EQ(enumToStr(PersonFields::Notes), "Notes");
+        EXPECT_EQ(enumFromStr<DealFields>(enumToStr(DealFields::Status)), DealFields::Status);
+
+        ChangeLog log(
+            std::weak_ptr<InternalEmployee>(),
+            std::nullopt,
+            std::nullopt,
+            CaseField::Notes,
+            ChangeLog::FieldType::null,
+            ChangeLog::FieldType::null,
+            ChangeLog::Action::Change
+        );
+        EXPECT_EQ(log.getFieldStr(), "Notes");
+    }
+
+    TEST(EnumToStrTests, ClientTypeEmotional)
+    {
+        EXPECT_EQ(
+            ChangeLog::clientTypeToStr(Client::ClientType::Emotional), client_type_str::emotional
+        );
+    }
 }  // namespace unit
\ No newline at end of file
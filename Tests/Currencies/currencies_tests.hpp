@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+#include "Currencies/currencies.hpp"
+#include "Currencies/fx_rate_table.hpp"
+
+namespace unit {
+    TEST(CurrenciesTest, Metadata)
+    {
+        EXPECT_EQ(currencyInfo(CountriesCurrencies::USD).code, "USD");
+        EXPECT_EQ(currencyScale(CountriesCurrencies::USD), 2);
+        EXPECT_EQ(currencyScale(CountriesCurrencies::JPY), 0);
+        EXPECT_EQ(currencyScale(CountriesCurrencies::KWD), 3);
+        EXPECT_EQ(currencyScale(CountriesCurrencies::CLF), 4);
+        EXPECT_EQ(currencyScale(CryptoCurrency::BTC), 8);
+        EXPECT_EQ(currencyToString(CryptoCurrency::USDTETH), "USDTETH");
+        EXPECT_EQ(countriesCurrencyToString(static_cast<CountriesCurrencies>(250)), "unknow");
+        EXPECT_NE(currencyId(CountriesCurrencies::AED), currencyId(CryptoCurrency::BTC));
+    }
+    TEST(CurrenciesTest, FromCode)
+    {
+        EXPECT_EQ(currencyFromCode("EUR"), Currencies(CountriesCurrencies::EUR));
+        EXPECT_EQ(currencyFromCode("ZWG"), Currencies(CountriesCurrencies::ZWG));
+        EXPECT_EQ(currencyFromCode("STORJETH"), Currencies(CryptoCurrency::STORJETH));
+        // the ISO currency wins over the ticker spelled the same
+        EXPECT_EQ(currencyFromCode("SOS"), Currencies(CountriesCurrencies::SOS));
+
+        EXPECT_FALSE(currencyFromCode("").has_value());
+        EXPECT_FALSE(currencyFromCode("usd").has_value());
+        EXPECT_FALSE(currencyFromCode("ABCDEFGHI").has_value());
+    }
+    TEST(FxRateTableTest, EffectiveDate)
+    {
+        FxRateTable table;
+        table.setRate(CountriesCurrencies::EUR, CountriesCurrencies::USD, Date(2024, 1, 1), 11, 1);
+        table.setRate(CountriesCurrencies::EUR, CountriesCurrencies::USD, Date(2024, 6, 1), 12, 1);
+
+        EXPECT_FALSE(
+            table.findRate(CountriesCurrencies::EUR, CountriesCurrencies::USD, Date(2023, 12, 31))
+        );
+        EXPECT_EQ(
+            table.findRate(CountriesCurrencies::EUR, CountriesCurrencies::USD, Date(2024, 5, 31))
+                ->rate,
+            11
+        );
+        EXPECT_EQ(
+            table.findRate(CountriesCurrencies::EUR, CountriesCurrencies::USD, Date(2024, 6, 1))
+                ->rate,
+            12
+        );
+
+        table.setRate(CountriesCurrencies::EUR, CountriesCurrencies::USD, Date(2024, 6, 1), 13, 1);
+        EXPECT_EQ(table.size(), 2);
+
+        Money eur("10.00", CountriesCurrencies::EUR);
+        EXPECT_EQ(
+            table.convert(eur, CountriesCurrencies::USD, Date(2024, 7, 1)).toString(), "13.00"
+        );
+        EXPECT_THROW(
+            table.convert(eur, CountriesCurrencies::GBP, Date(2024, 7, 1)), std::out_of_range
+        );
+    }
+    TEST(FxRateTableTest, ConvertBatch)
+    {
+        FxRateTable table;
+        Date        date(2024, 3, 15);
+        table.setRate(CountriesCurrencies::EUR, CountriesCurrencies::USD, date, 10845, 4);
+        table.setRate(CountriesCurrencies::JPY, CountriesCurrencies::USD, date, 67, 4);
+        table.setRate(CountriesCurrencies::KWD, CountriesCurrencies::USD, date, 325, 2);
+        table.setRate(CryptoCurrency::BTC, CountriesCurrencies::USD, date, 65000, 0);
+
+        const Money::Units units[]      = {10000, 15000, 1000, 100000000, 2500, -10000};
+        const Currencies   currencies[] = {
+            CountriesCurrencies::EUR, CountriesCurrencies::JPY, CountriesCurrencies::KWD,
+            CryptoCurrency::BTC,      CountriesCurrencies::USD, CountriesCurrencies::EUR
+        };
+        Money::Units result[6];
+        table.convert(units, currencies, result, 6, CountriesCurrencies::USD, date);
+
+        EXPECT_EQ(result[0], 10845);    // 100.00 EUR
+        EXPECT_EQ(result[1], 10050);    // 15000 JPY
+        EXPECT_EQ(result[2], 325);      // 1.000 KWD
+        EXPECT_EQ(result[3], 6500000);  // 1 BTC
+        EXPECT_EQ(result[4], 2500);     // already in USD
+        EXPECT_EQ(result[5], -10845);
+
+        EXPECT_THROW(
+            table.convert(units, currencies, result, 6, CountriesCurrencies::EUR, date),
+            std::out_of_range
+        );
+    }
+}  // namespace unit
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <vector>
+
+#include "DateTime/coarse_clock.hpp"
 #include "DateTime/date.hpp"
 #include "gtest/gtest.h"
 
@@ -52,4 +56,88 @@ namespace unit {
         EXPECT_EQ(Date(2025, 1, 1) - Date(2024, 1, 1), TimeDuration(52,2, 0, 0, 0)); //leap year
         EXPECT_EQ(Date(2024, 1, 1) - Date(2023, 1, 1), TimeDuration(52, 1, 0, 0, 0)); //no leap year
     }
+    TEST(DateTest, BatchSubtraction)
+    {
+        // 11 pairs cover a full vector block and a scalar tail
+        std::vector<Date>         end;
+        std::vector<Date>         start;
+        std::vector<TimeDuration> expected;
+        for (uint8_t i = 0; i < 11; ++i) {
+            end.emplace_back(2024, 3, 1 + i, i, 30);
+            start.emplace_back(2024, 2, 27, 0, i);
+            expected.push_back(end.back() - start.back());
+        }
+        end.emplace_back(2024, 1, 1);  // negative range gives zero
+        start.emplace_back(2024, 1, 2);
+        expected.push_back(TimeDuration());
+
+        std::vector<TimeDuration> result(end.size());
+        Date::subtract(end.data(), start.data(), result.data(), end.size());
+        EXPECT_EQ(result, expected);
+        EXPECT_EQ(result[0], TimeDuration(0, 3, 0, 30, 0));
+
+        // every path the machine has, with the negative range inside a vector block
+        std::swap(end[3], end.back());
+        std::swap(start[3], start.back());
+        std::swap(expected[3], expected.back());
+        std::vector<simd::Level> levels{simd::Level::Scalar};
+        if (simd::supported() >= simd::Level::SSE41) levels.push_back(simd::Level::SSE41);
+        if (simd::supported() >= simd::Level::AVX2) levels.push_back(simd::Level::AVX2);
+        for (const simd::Level level : levels) {
+            SCOPED_TRACE(static_cast<int>(level));
+            std::fill(result.begin(), result.end(), TimeDuration(1, 0, 0, 0, 0));
+            Date::subtract(end.data(), start.data(), result.data(), end.size(), level);
+            EXPECT_EQ(result, expected);
+        }
+    }
+    TEST(DateTest, PackedCompare)
+    {
+        Date a(2024, 12, 31, 23, 59);
+        Date b(2025, 1, 1, 0, 0);
+
+        EXPECT_TRUE(a < b);
+        EXPECT_FALSE(b < a);
+        EXPECT_EQ(b.getMinutes() - a.getMinutes(), 1);
+        EXPECT_EQ(Date::fromMinutes(a.getMinutes()), a);
+        EXPECT_EQ(std::hash<Date>{}(a), std::hash<Date>{}(Date(2024, 12, 31, 23, 59)));
+        EXPECT_EQ(Date(1970, 1, 1).getMinutes(), 0);
+    }
+    TEST(DateTest, CalendarFields)
+    {
+        Date a(1900, 3, 1, 7, 5);
+        EXPECT_EQ(a.getYear(), 1900);
+        EXPECT_EQ(a.getMonth(), 3);
+        EXPECT_EQ(a.getDay(), 1);
+        EXPECT_EQ(a.getHour(), 7);
+        EXPECT_EQ(a.getMin(), 5);
+        EXPECT_EQ(a.getDateStr(), "1 Mar 1900 7:05");
+        EXPECT_EQ(a.toJsonFormat(), "1900-03-01T07:05:00");
+
+        EXPECT_EQ(Date(2000, 1, 1).julian_day(), 2451545u);
+        EXPECT_THROW(Date(1900, 2, 29), std::invalid_argument);  // not a leap year
+        EXPECT_NO_THROW(Date(2000, 2, 29));
+        EXPECT_THROW(Date(2024, 5, 0), std::invalid_argument);
+    }
+    TEST(DateTest, CoarseClock)
+    {
+        Date now;
+        EXPECT_GE(now.getYear(), 2024);
+        EXPECT_GE(now.getMonth(), 1);
+        EXPECT_LE(now.getMonth(), 12);
+        EXPECT_LE(Date().getMinutes() - now.getMinutes(), 1);
+    }
+    TEST(DateTest, CoarseClockPin)
+    {
+        int32_t pinned;
+        {
+            CoarseClock::Pin pin;
+            pinned = Date().getMinutes();
+            {
+                CoarseClock::Pin inner;
+                EXPECT_EQ(Date().getMinutes(), pinned);
+            }
+            EXPECT_EQ(Date().getMinutes(), pinned);
+        }
+        EXPECT_LE(Date().getMinutes() - pinned, 1);
+    }
 }  // namespace unit
\ No newline at end of file
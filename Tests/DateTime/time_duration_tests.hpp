@@ -17,7 +17,7 @@ namespace unit {
         // transfer hour
         TimeDuration duration3(0, 0, 40, 0, 0);
         EXPECT_EQ(duration3.getDay(), 1);
-        EXPECT_EQ(duration3.getHour(), 15);
+        EXPECT_EQ(duration3.getHour(), 16);
 
         // transfer day
         TimeDuration duration4(0, 10, 0, 0, 0);
@@ -51,7 +51,7 @@ namespace unit {
         EXPECT_EQ(duration6, duration6);
 
         duration6 += TimeDuration(1, 11, 30, 70, 70);
-        EXPECT_EQ(duration6, TimeDuration(2, 5, 6, 11, 10));
+        EXPECT_EQ(duration6, TimeDuration(2, 5, 7, 11, 10));
     }
     TEST(TimeDurationTest, Subtraction)
     {
@@ -79,8 +79,39 @@ namespace unit {
         duration6 -= TimeDuration(0, 0, 0, 0, 0);
         EXPECT_EQ(duration6, duration6);
 
-        duration6 = TimeDuration(2, 5, 6, 11, 10);
+        duration6 = TimeDuration(2, 5, 7, 11, 10);
         duration6 -= TimeDuration(1, 11, 30, 70, 70);
         EXPECT_EQ(duration6, TimeDuration(0, 0, 0, 0, 0));
     }
+    TEST(TimeDurationTest, Seconds)
+    {
+        static_assert(TimeDuration(0, 0, 1, 1, 1).getSeconds() == 3661);
+        static_assert(TimeDuration::fromSeconds(-5) == TimeDuration());
+        static_assert(sizeof(TimeDuration) == sizeof(int64_t));
+
+        TimeDuration duration = TimeDuration::fromSeconds(90061);
+        EXPECT_EQ(duration.getDay(), 1);
+        EXPECT_EQ(duration.getHour(), 1);
+        EXPECT_EQ(duration.getMin(), 1);
+        EXPECT_EQ(duration.getSec(), 1);
+        EXPECT_TRUE(TimeDuration(0, 0, 0, 0, 59) < TimeDuration(0, 0, 0, 1, 0));
+    }
+    TEST(TimeDurationTest, Format)
+    {
+        TimeDuration duration(1, 5, 11, 0, 0);
+        EXPECT_EQ(duration.getDurationStr(), "1 wk, 5 d, 11 hr, 0 min, 0 sec");
+        EXPECT_EQ(
+            TimeDuration(2, 0, 8, 30, 45).getDurationStr(), "2 wks, 0 d, 8 hr, 30 min, 45 sec"
+        );
+        EXPECT_EQ(duration.getDurationStr(TimeDuration::Day | TimeDuration::Hour), "5 d, 11 hr");
+
+        char  buffer[TimeDuration::max_chars];
+        char* end = duration.format(buffer, buffer + sizeof(buffer), TimeDuration::Hour);
+        ASSERT_NE(end, nullptr);
+        EXPECT_EQ(std::string(buffer, end), "11 hr");
+        EXPECT_EQ(duration.format(buffer, buffer + 4), nullptr);
+
+        TimeDuration longest = TimeDuration::fromSeconds(INT64_MAX);
+        EXPECT_NE(longest.format(buffer, buffer + sizeof(buffer)), nullptr);
+    }
 }  // namespace unit
\ No newline at end of file
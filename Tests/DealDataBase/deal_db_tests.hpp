@@ -0,0 +1,25 @@
+#include "DealDataBase/deal_db.hpp"
+#include "Person/Employee/internal_employee.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    // getByOwner returned the by_manager index
+    TEST(DealDataBaseTest, GetByOwnerReturnsOwners)
+    {
+        DealDataBase data_base;
+        auto         deal = std::make_shared<Deal>(BigUint("1"));
+        auto owner = std::make_shared<InternalEmployee>(BigUint("2"), "Owner", "A", std::nullopt);
+        auto manager =
+            std::make_shared<InternalEmployee>(BigUint("3"), "Manager", "B", std::nullopt);
+        data_base.add(deal);
+
+        data_base.changeOwner(deal->getId(), owner, manager);
+        data_base.changeManager(deal->getId(), manager, manager);
+
+        ASSERT_EQ(data_base.getByOwner().size(), 1);
+        EXPECT_EQ(data_base.getByOwner().at(BigUint("2")), std::vector<DealPtr>{deal});
+        EXPECT_FALSE(data_base.getByOwner().contains(BigUint("3")));
+        EXPECT_EQ(data_base.getByManager().at(BigUint("3")), std::vector<DealPtr>{deal});
+        EXPECT_EQ(data_base.findByOwner(BigUint("2")), std::vector<DealPtr>{deal});
+    }
+}  // namespace unit
@@ -0,0 +1,116 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "IndexedStore/flat_hash_map.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    namespace {
+        /// Starts every probe at the last slot, so each group read wraps into the mirror bytes
+        struct LastSlotHash {
+            auto operator()(const int key) const -> size_t
+            {
+                return ~size_t{0} << 7 | static_cast<size_t>(key & 0x7F);
+            }
+        };
+    }  // namespace
+
+    TEST(FlatHashMapTest, ErasedSlotIsReused)
+    {
+        FlatHashMap<int, int> map;
+        for (int key = 0; key < 10; ++key) map.emplace(key, key);
+
+        const auto* slot = &*map.find(3);
+        for (int round = 0; round < 10000; ++round) {
+            EXPECT_EQ(map.erase(3), 1);
+            auto [entry, added] = map.emplace(3, round);
+            ASSERT_TRUE(added);
+            ASSERT_EQ(&*entry, slot);
+        }
+        EXPECT_EQ(map.size(), 10);
+        EXPECT_EQ(map.find(3)->second, 9999);
+    }
+
+    TEST(FlatHashMapTest, RehashUnderTombstones)
+    {
+        FlatHashMap<int, int>        map;
+        std::unordered_map<int, int> expected;
+        for (int round = 0; round < 50; ++round) {
+            for (int i = 0; i < 100; ++i) {
+                const int key = round * 100 + i;
+                map.emplace(key, key);
+                expected.emplace(key, key);
+            }
+            for (int i = 0; i < 90; ++i) {
+                const int key = round * 100 + i;
+                EXPECT_EQ(map.erase(key), 1);
+                expected.erase(key);
+            }
+        }
+
+        ASSERT_EQ(map.size(), expected.size());
+        size_t seen = 0;
+        for (const auto& [key, value] : map) {
+            EXPECT_EQ(expected.at(key), value);
+            ++seen;
+        }
+        EXPECT_EQ(seen, expected.size());
+        for (int key = 0; key < 5000; ++key) EXPECT_EQ(map.contains(key), expected.contains(key));
+    }
+
+    TEST(FlatHashMapTest, ProbesWrapAroundTheEnd)
+    {
+        FlatHashMap<int, int, LastSlotHash> map;
+        for (int key = 0; key < 14; ++key) map.emplace(key, key);
+        for (int key = 0; key < 14; ++key) ASSERT_EQ(map.find(key)->second, key);
+
+        for (int key = 0; key < 14; key += 2) EXPECT_EQ(map.erase(key), 1);
+        for (int key = 0; key < 14; ++key) EXPECT_EQ(map.contains(key), key % 2 == 1);
+
+        for (int key = 100; key < 200; ++key) map.emplace(key, key);
+        for (int key = 0; key < 14; ++key) EXPECT_EQ(map.contains(key), key % 2 == 1);
+        for (int key = 100; key < 200; ++key) EXPECT_EQ(map.find(key)->second, key);
+        EXPECT_EQ(map.size(), 107);
+    }
+
+    TEST(FlatHashMapTest, TextKeysAreFoundByView)
+    {
+        FlatHashMap<std::string, int> map;
+        map.emplace("anna@mail.com", 1);
+        map.emplace("boris@mail.com", 2);
+
+        const std::string text = "xanna@mail.comx";
+        EXPECT_EQ(map.find(std::string_view(text).substr(1, 13))->second, 1);
+        EXPECT_TRUE(map.contains("boris@mail.com"));
+        EXPECT_FALSE(map.contains(std::string_view("anna")));
+        EXPECT_EQ(map.erase(std::string_view("boris@mail.com")), 1);
+        EXPECT_FALSE(map.contains("boris@mail.com"));
+    }
+
+    TEST(FlatHashMapTest, EraseDuringIteration)
+    {
+        FlatHashMap<int, int> map;
+        for (int key = 0; key < 1000; ++key) map.emplace(key, key * 2);
+
+        for (auto entry = map.begin(); entry != map.end();) {
+            auto next = entry;
+            ++next;
+            if (entry->first % 3 == 0) map.erase(entry);
+            entry = next;
+        }
+
+        EXPECT_EQ(map.size(), 666);
+        size_t seen = 0;
+        for (const auto& [key, value] : map) {
+            EXPECT_NE(key % 3, 0);
+            EXPECT_EQ(value, key * 2);
+            ++seen;
+        }
+        EXPECT_EQ(seen, 666);
+        for (int key = 0; key < 1000; ++key) EXPECT_EQ(map.contains(key), key % 3 != 0);
+    }
+}  // namespace unit
@@ -0,0 +1,183 @@
+#include <stdio.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "IndexedStore/indexed_store.hpp"
+#include "Logger/events_log.hpp"
+#include "Tests/IndexedStore/item.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    using namespace item_indexes;
+
+    TEST(IndexedStoreTest, InsertFillsEveryIndex)
+    {
+        ItemStore store("Item");
+        ItemPtr   item = makeItem(1, "Anna", 10, {"vip", "new"}, 2);
+
+        EXPECT_TRUE(store.insert(item));
+        EXPECT_EQ(store.size(), 1);
+        EXPECT_EQ(store.find(BigUint(1)), item);
+        EXPECT_EQ(store.get<ByAmount>().find(10), std::vector<ItemPtr>{item});
+        EXPECT_EQ(store.get<ByName>().find("ann"), std::vector<ItemPtr>{item});
+        EXPECT_EQ(store.get<ByTag>().find("vip"), std::vector<ItemPtr>{item});
+        EXPECT_EQ(store.get<ByTag>().find("new"), std::vector<ItemPtr>{item});
+        EXPECT_EQ(store.entitiesOf(store.get<ByStatus>().find(2)), std::vector<ItemPtr>{item});
+        EXPECT_EQ(store.rows().size(), 1);
+    }
+
+    TEST(IndexedStoreTest, InsertRejectsTakenId)
+    {
+        ItemStore store("Item");
+        ItemPtr   first  = makeItem(1, "Anna", 10, {"vip"}, 2);
+        ItemPtr   second = makeItem(1, "Boris", 20, {"new"}, 3);
+
+        EXPECT_TRUE(store.insert(first));
+        EXPECT_FALSE(store.insert(second));
+
+        EXPECT_EQ(store.size(), 1);
+        EXPECT_EQ(store.find(BigUint(1)), first);
+        EXPECT_TRUE(store.get<ByAmount>().find(20).empty());
+        EXPECT_TRUE(store.get<ByName>().find("boris").empty());
+        EXPECT_TRUE(store.get<ByTag>().find("new").empty());
+        EXPECT_TRUE(store.get<ByStatus>().find(3).empty());
+        EXPECT_EQ(store.rows().size(), 1);
+    }
+
+    TEST(IndexedStoreTest, EraseEmptiesEveryIndex)
+    {
+        ItemStore store("Item");
+        ItemPtr   first  = makeItem(1, "Anna", 10, {"vip"}, 2);
+        ItemPtr   second = makeItem(2, "Anton", 10, {"vip"}, 2);
+        store.insert(first);
+        store.insert(second);
+
+        store.erase(first);
+
+        EXPECT_EQ(store.size(), 1);
+        EXPECT_EQ(store.find(BigUint(1)), nullptr);
+        EXPECT_EQ(store.get<ByAmount>().find(10), std::vector<ItemPtr>{second});
+        EXPECT_EQ(store.get<ByName>().find("an"), std::vector<ItemPtr>{second});
+        EXPECT_EQ(store.get<ByTag>().find("vip"), std::vector<ItemPtr>{second});
+        EXPECT_EQ(store.entitiesOf(store.get<ByStatus>().find(2)), std::vector<ItemPtr>{second});
+
+        store.erase(second);
+
+        EXPECT_TRUE(store.empty());
+        EXPECT_TRUE(store.get<ById>().entries().empty());
+        EXPECT_TRUE(store.get<ByAmount>().entries().empty());
+        EXPECT_EQ(store.get<ByName>().size(), 0);
+        EXPECT_TRUE(store.get<ByTag>().entries().empty());
+        EXPECT_TRUE(store.get<ByStatus>().entries().empty());
+        EXPECT_TRUE(store.rows().empty());
+    }
+
+    TEST(IndexedStoreTest, UpdateMovesChangedIndexes)
+    {
+        ItemStore store("Item");
+        ItemPtr   item = makeItem(1, "Anna", 10, {"vip"}, 2);
+        store.insert(item);
+
+        bool changed = store.update<ByAmount, ByName, ByTag, ByStatus>(item, [&] {
+            item->amount = 20;
+            item->name   = "Boris";
+            item->tags   = {"new"};
+            item->status = 3;
+            return true;
+        });
+
+        EXPECT_TRUE(changed);
+        EXPECT_TRUE(store.get<ByAmount>().find(10).empty());
+        EXPECT_EQ(store.get<ByAmount>().find(20), std::vector<ItemPtr>{item});
+        EXPECT_TRUE(store.get<ByName>().find("anna").empty());
+        EXPECT_EQ(store.get<ByName>().find("boris"), std::vector<ItemPtr>{item});
+        EXPECT_TRUE(store.get<ByTag>().find("vip").empty());
+        EXPECT_EQ(store.get<ByTag>().find("new"), std::vector<ItemPtr>{item});
+        EXPECT_TRUE(store.get<ByStatus>().find(2).empty());
+        EXPECT_EQ(store.entitiesOf(store.get<ByStatus>().find(3)), std::vector<ItemPtr>{item});
+        EXPECT_EQ(store.get<ByTag>().entries().size(), 1);
+        EXPECT_EQ(store.get<ByStatus>().entries().size(), 1);
+    }
+
+    TEST(IndexedStoreTest, UpdateReturningFalseMovesNothing)
+    {
+        ItemStore store("Item");
+        ItemPtr   item = makeItem(1, "Anna", 10, {"vip"}, 2);
+        store.insert(item);
+
+        bool changed = store.update<ByAmount>(item, [] { return false; });
+
+        EXPECT_FALSE(changed);
+        EXPECT_EQ(store.get<ByAmount>().find(10), std::vector<ItemPtr>{item});
+    }
+
+    TEST(IndexedStoreTest, RowsOfErasedEntitiesAreReused)
+    {
+        ItemStore store("Item");
+        ItemPtr   first  = makeItem(1, "Anna", 0, {}, 1);
+        ItemPtr   second = makeItem(2, "Boris", 0, {}, 1);
+        ItemPtr   third  = makeItem(3, "Vera", 0, {}, 1);
+        store.insert(first);
+        store.insert(second);
+
+        store.erase(first);
+        store.insert(third);
+
+        EXPECT_EQ(store.rows().size(), 2);
+        EXPECT_TRUE(store.rows().contains(0));
+        EXPECT_EQ(store.entitiesOf(store.get<ByStatus>().find(1)), (std::vector{third, second}));
+    }
+
+    // Prefix search ran past the end of the prefix, finding "anton" for "anna"
+    TEST(IndexedStoreTest, TextSearchStopsAtTheFragment)
+    {
+        ItemStore store("Item");
+        ItemPtr   anna  = makeItem(1, "Anna");
+        ItemPtr   anton = makeItem(2, "Anton");
+        ItemPtr   joann = makeItem(3, "Joanna");
+        store.insert(anna);
+        store.insert(anton);
+        store.insert(joann);
+
+        EXPECT_EQ(store.get<ByName>().find("anna"), (std::vector{anna, joann}));
+        EXPECT_EQ(store.get<ByName>().find("ant"), std::vector<ItemPtr>{anton});
+        EXPECT_TRUE(store.get<ByName>().find("annab").empty());
+    }
+
+    TEST(IndexedStoreTest, BucketEraseOfMissingKeyAddsNoGroup)
+    {
+        ByTag   index;
+        ItemPtr item = makeItem(1, "Anna", 0, {"vip"});
+        index.insert(item->tags, item);
+
+        EXPECT_FALSE(index.erase({"new"}, item));
+        EXPECT_EQ(index.entries().size(), 1);
+        EXPECT_FALSE(index.entries().contains("new"));
+    }
+
+    TEST(IndexedStoreTest, MissingEntryIsLoggedAtTheCaller)
+    {
+        const std::string file_name = "indexed_store_tests.log";
+        remove(file_name.c_str());
+        EventLog::getInstance().set_file(file_name);
+
+        ItemStore store("Item");
+        ItemPtr   item = makeItem(7, "Anna", 10, {"vip"});
+        store.insert(item);
+
+        item->tags = {"new"};  // changed without `update`
+        store.erase(item);
+
+        std::ifstream file(file_name);
+        std::string   log((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        EXPECT_NE(log.find("Data inconsistency in by_tag\nItem: 7"), std::string::npos);
+        EXPECT_NE(log.find("indexed_store_tests.hpp"), std::string::npos);
+        EXPECT_EQ(log.find("by_amount"), std::string::npos);
+        EXPECT_TRUE(store.get<ByTag>().entries().contains("vip"));
+        EXPECT_FALSE(store.get<ByTag>().entries().contains("new"));
+        EXPECT_TRUE(store.empty());
+        remove(file_name.c_str());
+    }
+}  // namespace unit
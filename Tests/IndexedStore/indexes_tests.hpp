@@ -0,0 +1,249 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "IndexedStore/indexes.hpp"
+#include "Tests/IndexedStore/item.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    using namespace item_indexes;
+
+    namespace {
+        auto makeItems(const size_t count) -> std::vector<ItemPtr>
+        {
+            std::vector<ItemPtr> items;
+            for (size_t i = 0; i < count; ++i) {
+                items.push_back(makeItem(
+                    i + 1,
+                    "Item" + std::to_string(i),
+                    static_cast<int>(i % 7),
+                    {"tag" + std::to_string(i % 5)}
+                ));
+            }
+            return items;
+        }
+    }  // namespace
+
+    TEST(BucketIndexTest, EraseOfLastEntry)
+    {
+        ByTag index;
+        auto  items = makeItems(3);
+        for (const ItemPtr& item : items) index.insert({"vip"}, item);
+
+        EXPECT_TRUE(index.erase({"vip"}, items[2]));
+        EXPECT_EQ(index.find("vip"), (std::vector{items[0], items[1]}));
+
+        EXPECT_TRUE(index.erase({"vip"}, items[0]));
+        EXPECT_EQ(index.find("vip"), std::vector{items[1]});
+    }
+
+    TEST(BucketIndexTest, EraseOfMovedEntry)
+    {
+        ByTag index;
+        auto  items = makeItems(3);
+        for (const ItemPtr& item : items) index.insert({"vip"}, item);
+
+        EXPECT_TRUE(index.erase({"vip"}, items[0]));
+        EXPECT_EQ(index.find("vip"), (std::vector{items[2], items[1]}));
+
+        EXPECT_TRUE(index.erase({"vip"}, items[2]));
+        EXPECT_EQ(index.find("vip"), std::vector{items[1]});
+
+        EXPECT_TRUE(index.erase({"vip"}, items[1]));
+        EXPECT_FALSE(index.entries().contains("vip"));
+        EXPECT_FALSE(index.erase({"vip"}, items[1]));
+    }
+
+    TEST(BucketIndexTest, EntityWithTheSameKeyTwice)
+    {
+        ByTag   index;
+        auto    items = makeItems(2);
+        ItemPtr twice = items[0];
+        index.insert({"vip", "vip"}, twice);
+        index.insert({"vip"}, items[1]);
+
+        EXPECT_TRUE(index.erase({"vip"}, twice));
+        EXPECT_EQ(index.find("vip").size(), 2);
+        EXPECT_TRUE(index.erase({"vip"}, twice));
+        EXPECT_EQ(index.find("vip"), std::vector{items[1]});
+    }
+
+    TEST(BucketIndexTest, ReKeyIntoTheSameGroup)
+    {
+        ItemStore store("Item");
+        auto      items = makeItems(3);
+        for (const ItemPtr& item : items) {
+            item->tags = {"vip"};
+            store.insert(item);
+        }
+
+        store.update<ByTag>(items[0], [&] {
+            items[0]->tags = {"new", "vip"};
+            return true;
+        });
+        store.update<ByAmount>(items[1], [&] {
+            items[1]->amount = items[2]->amount;
+            return true;
+        });
+
+        std::vector<ItemPtr> group = store.get<ByTag>().find("vip");
+        std::sort(group.begin(), group.end());
+        std::vector<ItemPtr> expected = items;
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(group, expected);
+        EXPECT_EQ(store.get<ByTag>().find("new"), std::vector{items[0]});
+        EXPECT_EQ(store.get<ByAmount>().find(items[2]->amount).size(), 2);
+
+        for (const ItemPtr& item : items) {
+            EXPECT_TRUE(store.get<ByTag>().erase(item->tags, item));
+            EXPECT_TRUE(store.get<ByAmount>().erase(item->amount, item));
+        }
+        EXPECT_TRUE(store.get<ByTag>().entries().empty());
+        EXPECT_TRUE(store.get<ByAmount>().entries().empty());
+    }
+
+    TEST(BucketIndexTest, ManyRemovesInARow)
+    {
+        ItemStore store("Item");
+        auto      items = makeItems(300);
+        for (const ItemPtr& item : items) store.insert(item);
+
+        for (size_t i = 0; i < items.size(); ++i) {
+            store.erase(items[i]);
+            if (i + 1 < items.size()) {
+                const ItemPtr& next = items[i + 1];
+                const auto&    tag  = store.get<ByTag>().find(next->tags.front());
+                EXPECT_NE(std::find(tag.begin(), tag.end(), next), tag.end());
+            }
+        }
+        EXPECT_TRUE(store.empty());
+        EXPECT_TRUE(store.get<ByTag>().entries().empty());
+        EXPECT_TRUE(store.get<ByAmount>().entries().empty());
+    }
+
+    TEST(OrderedIndexTest, EraseAmongEqualKeys)
+    {
+        ByAmount index;
+        auto     items = makeItems(3);
+        for (const ItemPtr& item : items) index.insert(5, item);
+
+        EXPECT_TRUE(index.erase(5, items[1]));
+        EXPECT_EQ(index.find(5), (std::vector{items[0], items[2]}));
+        EXPECT_FALSE(index.erase(5, items[1]));
+        EXPECT_FALSE(index.erase(6, items[0]));
+
+        EXPECT_TRUE(index.erase(5, items[2]));
+        EXPECT_TRUE(index.erase(5, items[0]));
+        EXPECT_TRUE(index.entries().empty());
+    }
+
+    TEST(IndexesTest, RandomEraseOrderKeepsEveryEntryFindable)
+    {
+        ByTag    by_tag;
+        ByAmount by_amount;
+        auto     items = makeItems(500);
+        for (const ItemPtr& item : items) {
+            by_tag.insert(item->tags, item);
+            by_amount.insert(item->amount, item);
+        }
+
+        std::vector<ItemPtr> order = items;
+        std::shuffle(order.begin(), order.end(), std::mt19937(22));
+        for (size_t i = 0; i < order.size(); ++i) {
+            ASSERT_TRUE(by_tag.erase(order[i]->tags, order[i]));
+            ASSERT_TRUE(by_amount.erase(order[i]->amount, order[i]));
+            if (i % 50 != 0) continue;
+
+            size_t remaining = 0;
+            for (size_t j = i + 1; j < order.size(); ++j) {
+                const ItemPtr& item  = order[j];
+                const auto&    group = by_tag.find(item->tags.front());
+                const auto     equal = by_amount.find(item->amount);
+                EXPECT_NE(std::find(group.begin(), group.end(), item), group.end());
+                EXPECT_NE(std::find(equal.begin(), equal.end(), item), equal.end());
+                ++remaining;
+            }
+            size_t grouped = 0;
+            for (const auto& [tag, group] : by_tag.entries()) grouped += group.size();
+            EXPECT_EQ(grouped, remaining);
+            EXPECT_EQ(by_amount.entries().size(), remaining);
+        }
+        EXPECT_TRUE(by_tag.entries().empty());
+        EXPECT_TRUE(by_amount.entries().empty());
+    }
+
+    TEST(SubstringIndexTest, ShortFragmentsCheckEveryText)
+    {
+        ByName index;
+        auto   items = makeItems(3);
+        items[0]->name = "Anna";
+        items[1]->name = "Boris";
+        items[2]->name = "Ian";
+        for (const ItemPtr& item : items) index.insert({indexes::lowerCase(item->name)}, item);
+
+        EXPECT_EQ(index.find("a"), (std::vector{items[0], items[2]}));
+        EXPECT_EQ(index.find("an"), (std::vector{items[0], items[2]}));
+        EXPECT_EQ(index.find("is"), std::vector{items[1]});
+        EXPECT_TRUE(index.find("x").empty());
+
+        EXPECT_TRUE(index.erase({"ian"}, items[2]));
+        EXPECT_EQ(index.find("an"), std::vector{items[0]});
+    }
+
+    TEST(SubstringIndexTest, BytesAboveAscii)
+    {
+        ByName index;
+        auto   items = makeItems(2);
+        items[0]->name = "\xFF\xFF\xFF" "ab\xC0";
+        items[1]->name = "\x7F\x7F\x7F" "ab\x40";
+        for (const ItemPtr& item : items) index.insert({indexes::lowerCase(item->name)}, item);
+
+        EXPECT_EQ(indexes::lowerCase("\xFF\xC0" "AB"), "\xFF\xC0" "ab");
+        EXPECT_EQ(index.find("\xFF\xFF\xFF"), std::vector{items[0]});
+        EXPECT_EQ(index.find("\xFF" "ab"), std::vector{items[0]});
+        EXPECT_EQ(index.find("ab\xC0"), std::vector{items[0]});
+        EXPECT_EQ(index.find("\x7F\x7F\x7F"), std::vector{items[1]});
+        EXPECT_EQ(index.find("\xFF"), std::vector{items[0]});
+    }
+
+    TEST(SubstringIndexTest, TrigramsWithoutTheFragmentAreRejected)
+    {
+        ByName index;
+        auto   items = makeItems(2);
+        index.insert({"abcxbcd"}, items[0]);
+        index.insert({"abcd"}, items[1]);
+
+        // "abc" and "bcd" are both in "abcxbcd", "abcd" is not
+        EXPECT_EQ(index.find("abcd"), std::vector{items[1]});
+        EXPECT_EQ(index.find("xbcd"), std::vector{items[0]});
+        EXPECT_TRUE(index.find("abcdx").empty());
+    }
+
+    TEST(SubstringIndexTest, RebuildAfterManyRemovals)
+    {
+        ItemStore store("Item");
+        auto      items = makeItems(400);
+        for (const ItemPtr& item : items) store.insert(item);
+
+        for (size_t i = 0; i < items.size(); ++i) {
+            if (i % 8 != 0) store.erase(items[i]);
+        }
+        auto more = makeItems(450);
+        more.erase(more.begin(), more.begin() + 400);
+        for (const ItemPtr& item : more) store.insert(item);
+
+        const auto& by_name = store.get<ByName>();
+        EXPECT_EQ(by_name.size(), 100);
+        for (size_t i = 0; i < items.size(); ++i) {
+            const auto found = by_name.find(indexes::lowerCase(items[i]->name));
+            const bool live  = i % 8 == 0;
+            EXPECT_EQ(std::find(found.begin(), found.end(), items[i]) != found.end(), live);
+        }
+        for (const ItemPtr& item : more) {
+            EXPECT_EQ(by_name.find(indexes::lowerCase(item->name)), std::vector{item});
+        }
+        EXPECT_EQ(by_name.find("item").size(), 100);
+    }
+}  // namespace unit
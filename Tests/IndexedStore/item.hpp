@@ -0,0 +1,65 @@
+#pragma once
+#include <stdint.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "BigNum/big_uint.hpp"
+#include "IndexedStore/indexed_store.hpp"
+
+namespace unit {
+    /// Entity with a key for every index kind, changed directly by the tests
+    struct Item {
+        BigUint                  id;
+        std::string              name;
+        int                      amount = 0;
+        std::vector<std::string> tags;
+        std::optional<int>       status;
+        int                      priority = 0;
+        bool                     consent  = false;
+
+        auto getId() const -> const BigUint& { return this->id; }
+    };
+    using ItemPtr = std::shared_ptr<Item>;
+
+    inline auto makeItem(
+        const uint64_t                  id,
+        const std::string&              name,
+        const int                       amount = 0,
+        const std::vector<std::string>& tags   = {},
+        const std::optional<int>        status = std::nullopt
+    ) -> ItemPtr
+    {
+        auto item    = std::make_shared<Item>();
+        item->id     = BigUint(id);
+        item->name   = name;
+        item->amount = amount;
+        item->tags   = tags;
+        item->status = status;
+        return item;
+    }
+
+    namespace item_indexes {
+        using ById     = indexes::Unique<Item, indexes::Get<&Item::id>, "by_id">;
+        using ByAmount = indexes::Ordered<Item, indexes::Get<&Item::amount>, "by_amount">;
+        using ByName =
+            indexes::Substring<Item, indexes::Lower<indexes::Get<&Item::name>>, "by_name">;
+        using ByTag    = indexes::Bucket<Item, indexes::Get<&Item::tags>, "by_tag">;
+        using ByStatus = indexes::Bitmap<Item, indexes::Get<&Item::status>, "by_status">;
+        using ByPriority =
+            indexes::Bitmap<Item, indexes::Get<&Item::priority>, "by_priority">;
+        using ByConsent = indexes::Bitmap<Item, indexes::Get<&Item::consent>, "by_consent">;
+    }  // namespace item_indexes
+
+    using ItemStore = IndexedStore<
+        Item,
+        item_indexes::ById,
+        item_indexes::ByAmount,
+        item_indexes::ByName,
+        item_indexes::ByTag,
+        item_indexes::ByStatus,
+        item_indexes::ByPriority,
+        item_indexes::ByConsent>;
+}  // namespace unit
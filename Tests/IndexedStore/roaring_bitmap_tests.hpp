@@ -0,0 +1,186 @@
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "IndexedStore/roaring_bitmap.hpp"
+#include "Tests/IndexedStore/item.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    namespace {
+        auto rowsOf(const RoaringBitmap& bitmap) -> std::vector<uint32_t>
+        {
+            std::vector<uint32_t> rows;
+            bitmap.forEach([&](const uint32_t row) { rows.push_back(row); });
+            return rows;
+        }
+
+        /// Rows of several chunks: some dense enough for a bitset, some sparse, some empty
+        auto randomRows(std::mt19937& random) -> std::set<uint32_t>
+        {
+            std::set<uint32_t> rows;
+            for (uint32_t chunk = 0; chunk < 6; ++chunk) {
+                const uint32_t count = std::uniform_int_distribution<uint32_t>(0, 9000)(random);
+                for (uint32_t i = 0; i < count; ++i) rows.insert(chunk << 16 | (random() & 0xFFFF));
+            }
+            return rows;
+        }
+
+        auto bitmapOf(const std::set<uint32_t>& rows) -> RoaringBitmap
+        {
+            RoaringBitmap bitmap;
+            for (const uint32_t row : rows) bitmap.add(row);
+            return bitmap;
+        }
+    }  // namespace
+
+    TEST(RoaringBitmapTest, ArrayTurnsIntoBitsetPast4096AndBack)
+    {
+        RoaringBitmap bitmap;
+        for (uint32_t i = 0; i < 4096; ++i) EXPECT_TRUE(bitmap.add(i * 3));
+        EXPECT_FALSE(bitmap._isBitset(0));
+        EXPECT_FALSE(bitmap.add(3));
+
+        EXPECT_TRUE(bitmap.add(1));
+        EXPECT_TRUE(bitmap._isBitset(0));
+        EXPECT_EQ(bitmap.size(), 4097);
+        EXPECT_TRUE(bitmap.contains(1));
+        EXPECT_TRUE(bitmap.contains(4095 * 3));
+        EXPECT_FALSE(bitmap.contains(2));
+
+        EXPECT_TRUE(bitmap.remove(1));
+        EXPECT_FALSE(bitmap._isBitset(0));
+        EXPECT_FALSE(bitmap.remove(1));
+        EXPECT_EQ(bitmap.size(), 4096);
+
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < 4096; ++i) expected.push_back(i * 3);
+        EXPECT_EQ(rowsOf(bitmap), expected);
+
+        for (uint32_t i = 0; i < 4096; ++i) EXPECT_TRUE(bitmap.remove(i * 3));
+        EXPECT_TRUE(bitmap.empty());
+    }
+
+    TEST(RoaringBitmapTest, SetOperationsMatchSets)
+    {
+        std::mt19937 random(25);
+        for (int round = 0; round < 20; ++round) {
+            const std::set<uint32_t> first  = randomRows(random);
+            const std::set<uint32_t> second = randomRows(random);
+            const RoaringBitmap      left   = bitmapOf(first);
+            const RoaringBitmap      right  = bitmapOf(second);
+
+            std::vector<uint32_t> both;
+            std::vector<uint32_t> any;
+            std::vector<uint32_t> only;
+            std::set_intersection(
+                first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(both)
+            );
+            std::set_union(
+                first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(any)
+            );
+            std::set_difference(
+                first.begin(), first.end(), second.begin(), second.end(), std::back_inserter(only)
+            );
+
+            EXPECT_EQ(rowsOf(left & right), both);
+            EXPECT_EQ(rowsOf(left | right), any);
+            EXPECT_EQ(rowsOf(left - right), only);
+            EXPECT_EQ((left & right).size(), both.size());
+            EXPECT_EQ((left | right).size(), any.size());
+            EXPECT_EQ((left - right).size(), only.size());
+
+            RoaringBitmap result = left;
+            result |= right;
+            result -= right;
+            EXPECT_EQ(rowsOf(result), only);
+            result &= left;
+            EXPECT_EQ(rowsOf(result), only);
+        }
+    }
+
+    TEST(RoaringBitmapTest, StoreReusesFreedRows)
+    {
+        ItemStore            store("Item");
+        std::vector<ItemPtr> items;
+        for (uint64_t id = 1; id <= 10; ++id) {
+            items.push_back(makeItem(id, "Item", 0, {}, static_cast<int>(id % 2)));
+            store.insert(items.back());
+        }
+
+        store.erase(items[2]);
+        store.erase(items[5]);
+        store.erase(items[7]);
+        EXPECT_EQ(rowsOf(store.rows()), (std::vector<uint32_t>{0, 1, 3, 4, 6, 8, 9}));
+
+        std::vector<ItemPtr> added;
+        for (uint64_t id = 11; id <= 14; ++id) {
+            added.push_back(makeItem(id, "Item", 0, {}, 1));
+            store.insert(added.back());
+        }
+
+        std::vector<uint32_t> expected_rows(11);
+        for (uint32_t row = 0; row < 11; ++row) expected_rows[row] = row;
+        EXPECT_EQ(rowsOf(store.rows()), expected_rows);
+        for (const ItemPtr& item : added) {
+            const auto odd = store.entitiesOf(store.get<item_indexes::ByStatus>().find(1));
+            EXPECT_NE(std::find(odd.begin(), odd.end(), item), odd.end());
+        }
+        EXPECT_EQ(store.entitiesOf(store.get<item_indexes::ByStatus>().find(0)).size(), 3);
+        EXPECT_EQ(store.entitiesOf(store.get<item_indexes::ByStatus>().find(1)).size(), 8);
+    }
+
+    TEST(RoaringBitmapTest, StatusAndPriorityAndNotConsentMatchesAFilter)
+    {
+        using namespace item_indexes;
+
+        std::mt19937         random(7);
+        ItemStore            store("Item");
+        std::vector<ItemPtr> live;
+        for (uint64_t id = 1; id <= 6000; ++id) {
+            ItemPtr item = makeItem(id, "Item");
+            if (random() % 4 != 0) item->status = static_cast<int>(random() % 3);
+            item->priority = static_cast<int>(random() % 3);
+            item->consent  = random() % 2 == 0;
+            store.insert(item);
+            live.push_back(item);
+        }
+        for (int i = 0; i < 2000; ++i) {
+            const size_t index = random() % live.size();
+            ItemPtr      item  = live[index];
+            if (i % 2 == 0) {
+                store.erase(item);
+                live.erase(live.begin() + index);
+            } else {
+                store.update<ByStatus, ByPriority, ByConsent>(item, [&] {
+                    item->status   = static_cast<int>(random() % 3);
+                    item->priority = static_cast<int>(random() % 3);
+                    item->consent  = !item->consent;
+                    return true;
+                });
+            }
+        }
+
+        RoaringBitmap rows = store.get<ByStatus>().find(1);
+        rows &= store.get<ByPriority>().find(2);
+        rows -= store.get<ByConsent>().find(true);
+        std::vector<ItemPtr> found = store.entitiesOf(rows);
+
+        std::vector<ItemPtr> expected;
+        for (const ItemPtr& item : live) {
+            if (item->status == 1 && item->priority == 2 && !item->consent) {
+                expected.push_back(item);
+            }
+        }
+        std::sort(found.begin(), found.end());
+        std::sort(expected.begin(), expected.end());
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(found, expected);
+        EXPECT_EQ(rows.size(), expected.size());
+        EXPECT_EQ(store.rows().size(), live.size());
+    }
+}  // namespace unit
@@ -0,0 +1,73 @@
+#include "InteractionDataBase/interaction_data_base.hpp"
+#include "Person/Employee/internal_employee.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(InteractionDataBaseTest, UpdateLogsOneGroup)
+    {
+        InteractionDataBase data_base;
+        auto manager =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Manager", "A", std::nullopt);
+        auto meeting = std::make_shared<BaseInteraction>(
+            BigUint("2"), BaseInteraction::InteractionType::meeting
+        );
+        data_base.add(meeting);
+        size_t logged = meeting->getChangeLogs().size();
+
+        size_t changed = data_base.update(meeting->getId(), manager)
+                             .setExternalId("ext-7")
+                             .setTitle("Kick-off")
+                             .setStartDate(Date(2030, 4, 1, 10))
+                             .setEndDate(Date(2030, 4, 1, 11))
+                             .setPriority(Priority::High)
+                             .setManager(manager)
+                             .apply();
+
+        EXPECT_EQ(changed, 6);
+        auto logs = meeting->getChangeLogs();
+        ASSERT_EQ(logs.size(), logged + 6);
+        for (size_t i = logged; i < logs.size(); i++) {
+            EXPECT_EQ(logs[i]->getChangeDate(), logs[logged]->getChangeDate());
+        }
+        EXPECT_EQ(data_base.findByExternalId("ext-7"), meeting);
+        EXPECT_EQ(data_base.findByTitleSubstr("kick"), std::vector{meeting});
+        EXPECT_EQ(data_base.findByStartDate(Date(2030, 4, 1, 10)), std::vector{meeting});
+        EXPECT_EQ(data_base.getByStartDate().size(), 1);
+        EXPECT_EQ(data_base.findByEndDate(Date(2030, 4, 1, 11)), std::vector{meeting});
+        EXPECT_EQ(data_base.getByEndDate().size(), 1);
+        EXPECT_EQ(data_base.findByPriority(Priority::High), std::vector{meeting});
+        EXPECT_EQ(data_base.findByManger(manager->getId()), std::vector{meeting});
+        EXPECT_EQ(data_base.update(BigUint("3"), manager).setTitle("None").apply(), 0);
+    }
+
+    // Moving a meeting changes both dates; each date index gets one move, so a meeting that is
+    // moved back where it was keeps its place among meetings at the same time
+    TEST(InteractionDataBaseTest, UpdateMovesEachIndexOnce)
+    {
+        InteractionDataBase data_base;
+        auto manager =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Manager", "A", std::nullopt);
+        auto first  = std::make_shared<BaseInteraction>(
+            BigUint("2"), BaseInteraction::InteractionType::meeting
+        );
+        auto second = std::make_shared<BaseInteraction>(
+            BigUint("3"), BaseInteraction::InteractionType::meeting
+        );
+        data_base.add(first);
+        data_base.add(second);
+        data_base.update(first->getId(), manager).setStartDate(Date(2030, 4, 1, 10)).apply();
+        data_base.update(second->getId(), manager).setStartDate(Date(2030, 4, 1, 10)).apply();
+        ASSERT_EQ(data_base.findByStartDate(Date(2030, 4, 1, 10)), (std::vector{first, second}));
+
+        size_t changed = data_base.update(first->getId(), manager)
+                             .setStartDate(Date(2030, 4, 2, 10))
+                             .setEndDate(Date(2030, 4, 2, 11))
+                             .setStartDate(Date(2030, 4, 1, 10))
+                             .apply();
+
+        EXPECT_EQ(changed, 1);
+        EXPECT_EQ(data_base.findByStartDate(Date(2030, 4, 1, 10)), (std::vector{first, second}));
+        EXPECT_TRUE(data_base.findByStartDate(Date(2030, 4, 2, 10)).empty());
+        EXPECT_EQ(data_base.findByEndDate(Date(2030, 4, 2, 11)), std::vector{first});
+    }
+}  // namespace unit
@@ -508,7 +508,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_TRUE(client2.getCustomerAcquisitionCost().has_value());
-        EXPECT_EQ(client2.getCustomerAcquisitionCost()->num, "2499.99");
+        EXPECT_EQ(client2.getCustomerAcquisitionCost()->toString(), "2499.99");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(client2.getChangeLogs().size(), 14);
@@ -524,7 +524,7 @@ namespace unit {
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Money);
         auto new_value = std::get<std::shared_ptr<Money>>(log->getNewValue().value());
-        EXPECT_EQ(new_value->num, "2499.99");
+        EXPECT_EQ(new_value->toString(), "2499.99");
         EXPECT_EQ(*log->getNewValueStr(), std::string("2499.99 USD"));
 
         SCOPED_TRACE("Field");
@@ -554,7 +554,7 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto old_value = std::get<std::shared_ptr<Money>>(log->getOldValue().value());
-        EXPECT_EQ(old_value->num, "2499.99");
+        EXPECT_EQ(old_value->toString(), "2499.99");
         EXPECT_EQ(*log->getOldValueStr(), std::string("2499.99 USD"));
 
         SCOPED_TRACE("New value");
@@ -797,7 +797,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_TRUE(client2.getAnnualRevenue().has_value());
-        EXPECT_EQ(client2.getAnnualRevenue()->num, "12500000.00");
+        EXPECT_EQ(client2.getAnnualRevenue()->toString(), "12500000.00");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(client2.getChangeLogs().size(), 22);
@@ -813,7 +813,7 @@ namespace unit {
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Money);
         auto new_value = std::get<std::shared_ptr<Money>>(log->getNewValue().value());
-        EXPECT_EQ(new_value->num, "12500000.00");
+        EXPECT_EQ(new_value->toString(), "12500000.00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("12500000.00 USD"));
 
         SCOPED_TRACE("Field");
@@ -829,11 +829,11 @@ namespace unit {
 
     TEST(ClientTest, SetAnnualRevenue_UpdateValue)
     {
-        client2.setAnnualRevenue(Money("18750000.50", ountriesCurrencies::EUR), changer);
+        client2.setAnnualRevenue(Money("18750000.50", CountriesCurrencies::EUR), changer);
 
         SCOPED_TRACE("Value check");
         EXPECT_TRUE(client2.getAnnualRevenue().has_value());
-        EXPECT_EQ(client2.getAnnualRevenue()->num, "18750000.50");
+        EXPECT_EQ(client2.getAnnualRevenue()->toString(), "18750000.50");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(client2.getChangeLogs().size(), 23);
@@ -844,14 +844,14 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto old_value = std::get<std::shared_ptr<Money>>(log->getOldValue().value());
-        EXPECT_EQ(old_value->num, "12500000.00");
+        EXPECT_EQ(old_value->toString(), "12500000.00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("12500000.00 USD"));
 
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Money);
         auto new_value = std::get<std::shared_ptr<Money>>(log->getNewValue().value());
-        EXPECT_EQ(new_value->num, "18750000.50");
+        EXPECT_EQ(new_value->toString(), "18750000.50");
         EXPECT_EQ(*log->getNewValueStr(), std::string("18750000.50 EUR"));
 
         SCOPED_TRACE("Field");
@@ -881,7 +881,7 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto old_value = std::get<std::shared_ptr<Money>>(log->getOldValue().value());
-        EXPECT_EQ(old_value->num, "18750000.50");
+        EXPECT_EQ(old_value->toString(), "18750000.50");
         EXPECT_EQ(*log->getOldValueStr(), std::string("18750000.50 EUR"));
 
         SCOPED_TRACE("New value");
@@ -906,7 +906,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_TRUE(client2.getLifetimeValue().has_value());
-        EXPECT_EQ(client2.getLifetimeValue()->num, "450000.00");
+        EXPECT_EQ(client2.getLifetimeValue()->toString(), "450000.00");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(client2.getChangeLogs().size(), 25);
@@ -922,7 +922,7 @@ namespace unit {
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Money);
         auto new_value = std::get<std::shared_ptr<Money>>(log->getNewValue().value());
-        EXPECT_EQ(new_value->num, "450000.00");
+        EXPECT_EQ(new_value->toString(), "450000.00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("450000.00 USD"));
 
         SCOPED_TRACE("Field");
@@ -942,7 +942,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_TRUE(client2.getLifetimeValue().has_value());
-        EXPECT_EQ(client2.getLifetimeValue()->num, "487920.75");
+        EXPECT_EQ(client2.getLifetimeValue()->toString(), "487920.75");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(client2.getChangeLogs().size(), 26);
@@ -953,14 +953,14 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto old_value = std::get<std::shared_ptr<Money>>(log->getOldValue().value());
-        EXPECT_EQ(old_value->num, "450000.00");
+        EXPECT_EQ(old_value->toString(), "450000.00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("450000.00 USD"));
 
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Money);
         auto new_value = std::get<std::shared_ptr<Money>>(log->getNewValue().value());
-        EXPECT_EQ(new_value->num, "487920.75");
+        EXPECT_EQ(new_value->toString(), "487920.75");
         EXPECT_EQ(*log->getNewValueStr(), std::string("487920.75 USDT"));
 
         SCOPED_TRACE("Field");
@@ -990,7 +990,7 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto old_value = std::get<std::shared_ptr<Money>>(log->getOldValue().value());
-        EXPECT_EQ(old_value->num, "487920.75");
+        EXPECT_EQ(old_value->toString(), "487920.75");
         EXPECT_EQ(*log->getOldValueStr(), std::string("487920.75 USDT"));
 
         SCOPED_TRACE("New value");
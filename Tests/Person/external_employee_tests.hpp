@@ -22,7 +22,7 @@ namespace unit {
 
         SCOPED_TRACE("Interaction & Dates");
         EXPECT_EQ(ee.getCurrentInteraction(), nullptr);
-        EXPECT_EQ(ee.getLastContactDate(), nullptr);
+        EXPECT_EQ(ee.getLastContactDate(), std::nullopt);
 
         SCOPED_TRACE("Time & Preferences");
         EXPECT_EQ(ee.getTimeZone(), 0);
@@ -612,7 +612,7 @@ namespace unit {
 
     TEST(ExternalEmployeeTest, SetLastContactDate_SetFirstDate)
     {
-        DatePtr date = std::make_shared<Date>(2025, 3, 18);
+        Date date(2025, 3, 18);
 
         ee.setLastContactDate(date, changer);
 
@@ -635,7 +635,7 @@ namespace unit {
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto new_value = std::get<DatePtr>(log->getNewValue().value());
+        auto new_value = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(new_value, date);
         EXPECT_EQ(*log->getNewValueStr(), std::string("18 Mar 2025 0:00"));
 
@@ -652,7 +652,7 @@ namespace unit {
 
     TEST(ExternalEmployeeTest, SetLastContactDate_UpdateToNewerDate)
     {
-        DatePtr newerDate = std::make_shared<Date>(2025, 11, 29);
+        Date newerDate(2025, 11, 29);
 
         ee.setLastContactDate(newerDate, changer);
 
@@ -668,16 +668,16 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto old_value = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(old_value->getYear(), 2025);
-        EXPECT_EQ(old_value->getMonth(), 3);
-        EXPECT_EQ(old_value->getDay(), 18);
+        auto old_value = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(old_value.getYear(), 2025);
+        EXPECT_EQ(old_value.getMonth(), 3);
+        EXPECT_EQ(old_value.getDay(), 18);
         EXPECT_EQ(*log->getOldValueStr(), std::string("18 Mar 2025 0:00"));
 
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto new_value = std::get<DatePtr>(log->getNewValue().value());
+        auto new_value = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(new_value, newerDate);
         EXPECT_EQ(*log->getNewValueStr(), std::string("29 Nov 2025 0:00"));
 
@@ -694,10 +694,10 @@ namespace unit {
 
     TEST(ExternalEmployeeTest, SetLastContactDate_ClearWithNullptr)
     {
-        ee.setLastContactDate(nullptr, changer);
+        ee.setLastContactDate(std::nullopt, changer);
 
         SCOPED_TRACE("Value check");
-        EXPECT_EQ(ee.getLastContactDate(), nullptr);
+        EXPECT_FALSE(ee.getLastContactDate().has_value());
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ee.getChangeLogs().size(), 18);
@@ -707,10 +707,10 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto old_value = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(old_value->getYear(), 2025);
-        EXPECT_EQ(old_value->getMonth(), 11);
-        EXPECT_EQ(old_value->getDay(), 29);
+        auto old_value = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(old_value.getYear(), 2025);
+        EXPECT_EQ(old_value.getMonth(), 11);
+        EXPECT_EQ(old_value.getDay(), 29);
         EXPECT_EQ(*log->getOldValueStr(), std::string("29 Nov 2025 0:00"));
 
         SCOPED_TRACE("New value");
@@ -1213,7 +1213,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_NE(ee.getBudgetAuthority(), nullptr);
-        EXPECT_EQ(ee.getBudgetAuthority()->num, "750000.00");
+        EXPECT_EQ(ee.getBudgetAuthority()->toString(), "750000.00");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ee.getChangeLogs().size(), 32);
@@ -1251,7 +1251,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_EQ(ee.getBudgetAuthority(), higherBudget);
-        EXPECT_EQ(ee.getBudgetAuthority()->num, "2000000.00");
+        EXPECT_EQ(ee.getBudgetAuthority()->toString(), "2000000.00");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ee.getChangeLogs().size(), 33);
@@ -1262,7 +1262,7 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto old_value = std::get<MoneyPtr>(log->getOldValue().value());
-        EXPECT_EQ(old_value->num, "750000.00");
+        EXPECT_EQ(old_value->toString(), "750000.00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("750000.00 USD"));
 
         SCOPED_TRACE("New value");
@@ -1299,7 +1299,7 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto old_value = std::get<MoneyPtr>(log->getOldValue().value());
-        EXPECT_EQ(old_value->num, "2000000.00");
+        EXPECT_EQ(old_value->toString(), "2000000.00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("2000000.00 USD"));
 
         SCOPED_TRACE("New value");
@@ -1326,7 +1326,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_NE(ee.getSalary(), nullptr);
-        EXPECT_EQ(ee.getSalary()->num, "180000.00");
+        EXPECT_EQ(ee.getSalary()->toString(), "180000.00");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ee.getChangeLogs().size(), 35);
@@ -1364,7 +1364,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_EQ(ee.getSalary(), newSalary);
-        EXPECT_EQ(ee.getSalary()->num, "225000.00");
+        EXPECT_EQ(ee.getSalary()->toString(), "225000.00");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ee.getChangeLogs().size(), 36);
@@ -1375,7 +1375,7 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto old_value = std::get<MoneyPtr>(log->getOldValue().value());
-        EXPECT_EQ(old_value->num, "180000.00");
+        EXPECT_EQ(old_value->toString(), "180000.00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("180000.00 USD"));
 
         SCOPED_TRACE("New value");
@@ -1412,7 +1412,7 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto old_value = std::get<MoneyPtr>(log->getOldValue().value());
-        EXPECT_EQ(old_value->num, "225000.00");
+        EXPECT_EQ(old_value->toString(), "225000.00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("225000.00 USD"));
 
         SCOPED_TRACE("New value");
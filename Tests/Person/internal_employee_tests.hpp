@@ -23,11 +23,11 @@ namespace unit {
         EXPECT_EQ(ie.getAccessRole(), AccessRole::other);
         EXPECT_EQ(ie.getStatus(), EmployeeStatus::other);
 
-        EXPECT_EQ(ie.getLastLoginDate(), nullptr);
-        EXPECT_EQ(ie.getLastActionDate(), nullptr);
-        EXPECT_EQ(ie.getNextReviewDate(), nullptr);
-        EXPECT_EQ(ie.getHireDate(), nullptr);
-        EXPECT_EQ(ie.getDismissalDate(), nullptr);
+        EXPECT_EQ(ie.getLastLoginDate(), std::nullopt);
+        EXPECT_EQ(ie.getLastActionDate(), std::nullopt);
+        EXPECT_EQ(ie.getNextReviewDate(), std::nullopt);
+        EXPECT_EQ(ie.getHireDate(), std::nullopt);
+        EXPECT_EQ(ie.getDismissalDate(), std::nullopt);
 
         EXPECT_EQ(ie.getTimeZone(), 0);
         EXPECT_FALSE(ie.getIsActive());
@@ -60,7 +60,7 @@ namespace unit {
         SCOPED_TRACE("ChangeLogs size");
         ASSERT_EQ(ie.getChangeLogs().size(), 1);
 
-        auto& log = ie.getChangeLogs().back();
+        auto log = ie.getChangeLogs().back();
 
         SCOPED_TRACE("Changer");
         EXPECT_EQ(log->getChanger().lock(), changer);
@@ -96,7 +96,7 @@ namespace unit {
         SCOPED_TRACE("ChangeLogs size");
         ASSERT_EQ(ie.getChangeLogs().size(), 2);
 
-        auto& log = ie.getChangeLogs().back();
+        auto log = ie.getChangeLogs().back();
 
         SCOPED_TRACE("Changer");
         EXPECT_EQ(log->getChanger().lock(), changer);
@@ -132,7 +132,7 @@ namespace unit {
         SCOPED_TRACE("ChangeLogs size");
         ASSERT_EQ(ie.getChangeLogs().size(), 3);
 
-        auto& log = ie.getChangeLogs().back();
+        auto log = ie.getChangeLogs().back();
 
         SCOPED_TRACE("Changer");
         EXPECT_EQ(log->getChanger().lock(), changer);
@@ -635,7 +635,7 @@ namespace unit {
 
     TEST(InternalEmployeeTest, SetLastLoginDate)
     {
-        auto date = std::make_shared<Date>(2025, 12, 4);
+        auto date = Date(2025, 12, 4);
 
         ie.setLastLoginDate(date, changer);
 
@@ -655,7 +655,7 @@ namespace unit {
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_date = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_date = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_date, date);
         EXPECT_EQ(*log->getNewValueStr(), std::string("4 Dec 2025 0:00"));
 
@@ -669,7 +669,7 @@ namespace unit {
     }
     TEST(InternalEmployeeTest, SwapLastLoginDate)
     {
-        auto new_date = std::make_shared<Date>(2025, 1, 1);
+        auto new_date = Date(2025, 1, 1);
 
         ie.setLastLoginDate(new_date, changer);
 
@@ -684,14 +684,14 @@ namespace unit {
         SCOPED_TRACE("Old value  full object check");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "4 Dec 2025 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "4 Dec 2025 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("4 Dec 2025 0:00"));
 
         SCOPED_TRACE("New value  full object check");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_new = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_new = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_new, new_date);
         EXPECT_EQ(*log->getNewValueStr(), std::string("1 Jan 2025 0:00"));
 
@@ -706,10 +706,10 @@ namespace unit {
 
     TEST(InternalEmployeeTest, DelLastLoginDate)
     {
-        ie.setLastLoginDate(nullptr, changer);
+        ie.setLastLoginDate(std::nullopt, changer);
 
         SCOPED_TRACE("Value check");
-        EXPECT_EQ(ie.getLastLoginDate(), nullptr);
+        EXPECT_FALSE(ie.getLastLoginDate().has_value());
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ie.getChangeLogs().size(), 19);
@@ -719,8 +719,8 @@ namespace unit {
         SCOPED_TRACE("Old value  full object check");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "1 Jan 2025 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "1 Jan 2025 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("1 Jan 2025 0:00"));
 
         SCOPED_TRACE("New value  null");
@@ -738,7 +738,7 @@ namespace unit {
     }
     TEST(InternalEmployeeTest, SetLastActionDate)
     {
-        auto date = std::make_shared<Date>(2025, 12, 4);
+        auto date = Date(2025, 12, 4);
 
         ie.setLastActionDate(date, changer);
 
@@ -758,9 +758,9 @@ namespace unit {
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_date = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_date = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_date, date);
-        EXPECT_EQ(stored_date->getDateStr(), "4 Dec 2025 0:00");
+        EXPECT_EQ(stored_date.getDateStr(), "4 Dec 2025 0:00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("4 Dec 2025 0:00"));
 
         SCOPED_TRACE("Field");
@@ -773,7 +773,7 @@ namespace unit {
     }
     TEST(InternalEmployeeTest, SwapLastActionDate)
     {
-        auto new_date = std::make_shared<Date>(2025, 1, 1);
+        auto new_date = Date(2025, 1, 1);
 
         ie.setLastActionDate(new_date, changer);
 
@@ -788,16 +788,16 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "4 Dec 2025 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "4 Dec 2025 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("4 Dec 2025 0:00"));
 
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_new = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_new = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_new, new_date);
-        EXPECT_EQ(stored_new->getDateStr(), "1 Jan 2025 0:00");
+        EXPECT_EQ(stored_new.getDateStr(), "1 Jan 2025 0:00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("1 Jan 2025 0:00"));
 
         SCOPED_TRACE("Field");
@@ -810,10 +810,10 @@ namespace unit {
     }
     TEST(InternalEmployeeTest, DelLastActionDate)
     {
-        ie.setLastActionDate(nullptr, changer);
+        ie.setLastActionDate(std::nullopt, changer);
 
         SCOPED_TRACE("Value check");
-        EXPECT_EQ(ie.getLastActionDate(), nullptr);
+        EXPECT_FALSE(ie.getLastActionDate().has_value());
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ie.getChangeLogs().size(), 22);
@@ -823,8 +823,8 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "1 Jan 2025 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "1 Jan 2025 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("1 Jan 2025 0:00"));
 
         SCOPED_TRACE("New value");
@@ -947,7 +947,7 @@ namespace unit {
 
     TEST(InternalEmployeeTest, SetNextReviewDate)
     {
-        auto date = std::make_shared<Date>(2025, 12, 4);
+        auto date = Date(2025, 12, 4);
 
         ie.setNextReviewDate(date, changer);
 
@@ -967,9 +967,9 @@ namespace unit {
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_date = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_date = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_date, date);
-        EXPECT_EQ(stored_date->getDateStr(), "4 Dec 2025 0:00");
+        EXPECT_EQ(stored_date.getDateStr(), "4 Dec 2025 0:00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("4 Dec 2025 0:00"));
 
         SCOPED_TRACE("Field");
@@ -983,7 +983,7 @@ namespace unit {
 
     TEST(InternalEmployeeTest, SwapNextReviewDate)
     {
-        auto new_date = std::make_shared<Date>(2026, 6, 15);
+        auto new_date = Date(2026, 6, 15);
 
         ie.setNextReviewDate(new_date, changer);
 
@@ -998,16 +998,16 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "4 Dec 2025 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "4 Dec 2025 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("4 Dec 2025 0:00"));
 
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_new = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_new = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_new, new_date);
-        EXPECT_EQ(stored_new->getDateStr(), "15 Jun 2026 0:00");
+        EXPECT_EQ(stored_new.getDateStr(), "15 Jun 2026 0:00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("15 Jun 2026 0:00"));
 
         SCOPED_TRACE("Field");
@@ -1021,10 +1021,10 @@ namespace unit {
 
     TEST(InternalEmployeeTest, DelNextReviewDate)
     {
-        ie.setNextReviewDate(nullptr, changer);
+        ie.setNextReviewDate(std::nullopt, changer);
 
         SCOPED_TRACE("Value check");
-        EXPECT_EQ(ie.getNextReviewDate(), nullptr);
+        EXPECT_FALSE(ie.getNextReviewDate().has_value());
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ie.getChangeLogs().size(), 28);
@@ -1034,8 +1034,8 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "15 Jun 2026 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "15 Jun 2026 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("15 Jun 2026 0:00"));
 
         SCOPED_TRACE("New value");
@@ -1054,7 +1054,7 @@ namespace unit {
 
     TEST(InternalEmployeeTest, SetHireDate)
     {
-        auto date = std::make_shared<Date>(2023, 8, 15);
+        auto date = Date(2023, 8, 15);
 
         ie.setHireDate(date, changer);
 
@@ -1074,9 +1074,9 @@ namespace unit {
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_date = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_date = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_date, date);
-        EXPECT_EQ(stored_date->getDateStr(), "15 Aug 2023 0:00");
+        EXPECT_EQ(stored_date.getDateStr(), "15 Aug 2023 0:00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("15 Aug 2023 0:00"));
 
         SCOPED_TRACE("Field");
@@ -1090,7 +1090,7 @@ namespace unit {
 
     TEST(InternalEmployeeTest, SwapHireDate)
     {
-        auto new_date = std::make_shared<Date>(2024, 1, 10);
+        auto new_date = Date(2024, 1, 10);
 
         ie.setHireDate(new_date, changer);
 
@@ -1105,16 +1105,16 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "15 Aug 2023 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "15 Aug 2023 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("15 Aug 2023 0:00"));
 
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_new = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_new = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_new, new_date);
-        EXPECT_EQ(stored_new->getDateStr(), "10 Jan 2024 0:00");
+        EXPECT_EQ(stored_new.getDateStr(), "10 Jan 2024 0:00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("10 Jan 2024 0:00"));
 
         SCOPED_TRACE("Field");
@@ -1128,10 +1128,10 @@ namespace unit {
 
     TEST(InternalEmployeeTest, DelHireDate)
     {
-        ie.setHireDate(nullptr, changer);
+        ie.setHireDate(std::nullopt, changer);
 
         SCOPED_TRACE("Value check");
-        EXPECT_EQ(ie.getHireDate(), nullptr);
+        EXPECT_FALSE(ie.getHireDate().has_value());
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ie.getChangeLogs().size(), 31);
@@ -1141,8 +1141,8 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "10 Jan 2024 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "10 Jan 2024 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("10 Jan 2024 0:00"));
 
         SCOPED_TRACE("New value");
@@ -1160,7 +1160,7 @@ namespace unit {
     }
     TEST(InternalEmployeeTest, SetDismissalDate)
     {
-        auto date = std::make_shared<Date>(2025, 12, 31);
+        auto date = Date(2025, 12, 31);
 
         ie.setDismissalDate(date, changer);
 
@@ -1180,9 +1180,9 @@ namespace unit {
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_date = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_date = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_date, date);
-        EXPECT_EQ(stored_date->getDateStr(), "31 Dec 2025 0:00");
+        EXPECT_EQ(stored_date.getDateStr(), "31 Dec 2025 0:00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("31 Dec 2025 0:00"));
 
         SCOPED_TRACE("Field");
@@ -1196,7 +1196,7 @@ namespace unit {
 
     TEST(InternalEmployeeTest, SwapDismissalDate)
     {
-        auto new_date = std::make_shared<Date>(2026, 3, 1);
+        auto new_date = Date(2026, 3, 1);
 
         ie.setDismissalDate(new_date, changer);
 
@@ -1211,16 +1211,16 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "31 Dec 2025 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "31 Dec 2025 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("31 Dec 2025 0:00"));
 
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_new = std::get<DatePtr>(log->getNewValue().value());
+        auto stored_new = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(stored_new, new_date);
-        EXPECT_EQ(stored_new->getDateStr(), "1 Mar 2026 0:00");
+        EXPECT_EQ(stored_new.getDateStr(), "1 Mar 2026 0:00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("1 Mar 2026 0:00"));
 
         SCOPED_TRACE("Field");
@@ -1234,10 +1234,10 @@ namespace unit {
 
     TEST(InternalEmployeeTest, DelDismissalDate)
     {
-        ie.setDismissalDate(nullptr, changer);
+        ie.setDismissalDate(std::nullopt, changer);
 
         SCOPED_TRACE("Value check");
-        EXPECT_EQ(ie.getDismissalDate(), nullptr);
+        EXPECT_FALSE(ie.getDismissalDate().has_value());
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ie.getChangeLogs().size(), 34);
@@ -1247,8 +1247,8 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto stored_old = std::get<DatePtr>(log->getOldValue().value());
-        EXPECT_EQ(stored_old->getDateStr(), "1 Mar 2026 0:00");
+        auto stored_old = std::get<Date>(log->getOldValue().value());
+        EXPECT_EQ(stored_old.getDateStr(), "1 Mar 2026 0:00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("1 Mar 2026 0:00"));
 
         SCOPED_TRACE("New value");
@@ -1392,7 +1392,7 @@ namespace unit {
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Money);
         auto stored_money = std::get<MoneyPtr>(log->getNewValue().value());
         EXPECT_EQ(stored_money, salary);
-        EXPECT_EQ(stored_money->num, "150000.00");
+        EXPECT_EQ(stored_money->toString(), "150000.00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("150000.00 USD"));
 
         SCOPED_TRACE("Field");
@@ -1873,7 +1873,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         ASSERT_EQ(ie.getMonthlyQuota().size(), 1);
-        EXPECT_EQ(ie.getMonthlyQuota()[0].num, "50000.00");
+        EXPECT_EQ(ie.getMonthlyQuota()[0].toString(), "50000.00");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ie.getChangeLogs().size(), 54);
@@ -1888,7 +1888,7 @@ namespace unit {
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Money);
         auto stored_money = std::get<std::shared_ptr<Money>>(log->getNewValue().value());
-        EXPECT_EQ(stored_money->num, "50000.00");
+        EXPECT_EQ(stored_money->toString(), "50000.00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("50000.00 USD"));
 
         SCOPED_TRACE("Field");
@@ -1907,7 +1907,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_EQ(ie.getMonthlyQuota().size(), 2);
-        EXPECT_EQ(ie.getMonthlyQuota()[1].num, "85000.00");
+        EXPECT_EQ(ie.getMonthlyQuota()[1].toString(), "85000.00");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ie.getChangeLogs().size(), 55);
@@ -1922,7 +1922,7 @@ namespace unit {
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Money);
         auto stored_money = std::get<std::shared_ptr<Money>>(log->getNewValue().value());
-        EXPECT_EQ(stored_money->num, "85000.00");
+        EXPECT_EQ(stored_money->toString(), "85000.00");
         EXPECT_EQ(*log->getNewValueStr(), std::string("85000.00 USD"));
 
         SCOPED_TRACE("Field");
@@ -1939,7 +1939,7 @@ namespace unit {
 
         SCOPED_TRACE("Value check");
         EXPECT_EQ(ie.getMonthlyQuota().size(), 1);
-        EXPECT_EQ(ie.getMonthlyQuota()[0].num, "85000.00");
+        EXPECT_EQ(ie.getMonthlyQuota()[0].toString(), "85000.00");
 
         SCOPED_TRACE("Change logs size");
         EXPECT_EQ(ie.getChangeLogs().size(), 56);
@@ -1950,7 +1950,7 @@ namespace unit {
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Money);
         auto stored_money = std::get<std::shared_ptr<Money>>(log->getOldValue().value());
-        EXPECT_EQ(stored_money->num, "50000.00");
+        EXPECT_EQ(stored_money->toString(), "50000.00");
         EXPECT_EQ(*log->getOldValueStr(), std::string("50000.00 USD"));
 
         SCOPED_TRACE("New value");
@@ -1975,10 +1975,10 @@ namespace unit {
             std::nullopt,                                  
             Task::Status::InProgress,                       
             Priority::High,                                
-            std::make_shared<Date>(2025, 12, 31),         
-            std::make_shared<Date>(2025, 11, 1),            
-            nullptr,                                      
-            nullptr,                                       
+            Date(2025, 12, 31),         
+            Date(2025, 11, 1),            
+            std::nullopt,                                 
+            std::nullopt,                                  
             changer,                                    
             WeakInternalEmployee{},                       
             std::vector<WeakDealPtr>{},                    
@@ -2029,10 +2029,10 @@ namespace unit {
             std::nullopt,
             Task::Status::Overdue,
             Priority::Critical,
-            std::make_shared<Date>(2025, 12, 21),
-            std::make_shared<Date>(2025, 10, 5),
-            nullptr,
-            nullptr,
+            Date(2025, 12, 21),
+            Date(2025, 10, 5),
+            std::nullopt,
+            std::nullopt,
             changer,
             WeakInternalEmployee{},
             std::vector<WeakDealPtr>{},
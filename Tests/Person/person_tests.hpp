@@ -15,7 +15,7 @@ namespace unit {
         EXPECT_EQ(person.getSurname(), surname);
         EXPECT_EQ(person.getPatronymic(), std::nullopt);
         EXPECT_EQ(person.getPreferredLanguage(), std::nullopt);
-        EXPECT_EQ(person.getBirthday(), nullptr);
+        EXPECT_EQ(person.getBirthday(), std::nullopt);
         EXPECT_EQ(person.getPhoneNumber(), nullptr);
         EXPECT_EQ(person.getPhoneNumber(), nullptr);
         EXPECT_EQ(person.getEmail(), std::nullopt);
@@ -246,7 +246,7 @@ namespace unit {
     TEST(PersonTest, SetBirthday)
     {
         // add value
-        DatePtr new_birthday = std::make_shared<Date>(2000, 1, 1, 0, 0);
+        Date new_birthday(2000, 1, 1, 0, 0);
 
         person.setBirthday(new_birthday, changer);
 
@@ -266,7 +266,7 @@ namespace unit {
         SCOPED_TRACE("New value");
         EXPECT_TRUE(log->getNewValue().has_value());
         EXPECT_EQ(log->getNewValueFieldType(), ChangeLog::FieldType::Date);
-        auto new_value = std::get<DatePtr>(log->getNewValue().value());
+        auto new_value = std::get<Date>(log->getNewValue().value());
         EXPECT_EQ(new_value, new_birthday);
         EXPECT_EQ(*log->getNewValueStr(), "1 Jan 2000 0:00");
 
@@ -281,11 +281,11 @@ namespace unit {
         EXPECT_EQ(log->getChanger().lock(), changer);
 
         // del value
-        person.setBirthday(nullptr, changer);
+        person.setBirthday(std::nullopt, changer);
 
         SCOPED_TRACE("Value check");
-        EXPECT_EQ(
-            person.getBirthday(), nullptr
+        EXPECT_FALSE(
+            person.getBirthday().has_value()
         );  // : getBirthday  getPreferredLanguage
 
         SCOPED_TRACE("Change logs size");
@@ -296,7 +296,7 @@ namespace unit {
         SCOPED_TRACE("Old value");
         EXPECT_TRUE(log->getOldValue().has_value());
         EXPECT_EQ(log->getOldValueFieldType(), ChangeLog::FieldType::Date);
-        auto old_value = std::get<DatePtr>(log->getOldValue().value());
+        auto old_value = std::get<Date>(log->getOldValue().value());
         EXPECT_EQ(old_value, new_birthday);
         EXPECT_EQ(*log->getOldValueStr(), "1 Jan 2000 0:00");
 
@@ -0,0 +1,72 @@
+#include "Person/Employee/external_employee.hpp"
+#include "Person/Employee/internal_employee.hpp"
+#include "PersonDataBase/external_employee_db.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(ExternalEmployeeDataBaseTest, UpdateLogsOneGroup)
+    {
+        ExternalEmployeeDataBase data_base;
+        auto changer =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Changer", "A", std::nullopt);
+        auto contact =
+            std::make_shared<ExternalEmployee>(BigUint("2"), "Contact", "B", std::nullopt);
+        data_base.add(contact);
+        size_t logged = contact->getChangeLogs().size();
+
+        size_t changed = data_base.update(contact->getId(), changer)
+                             .setName("Renamed")
+                             .setInfluence(ExternalEmployee::InfluenceLevel::High)
+                             .setTimeZone(-5)
+                             .setJobTitle("Buyer")
+                             .setDepartment("Purchasing")
+                             .apply();
+
+        EXPECT_EQ(changed, 5);
+        auto logs = contact->getChangeLogs();
+        ASSERT_EQ(logs.size(), logged + 5);
+        for (size_t i = logged; i < logs.size(); i++) {
+            EXPECT_EQ(logs[i]->getChangeDate(), logs[logged]->getChangeDate());
+        }
+        EXPECT_TRUE(data_base.findByName("Contact").empty());
+        EXPECT_EQ(data_base.findByName("Renamed"), std::vector{contact});
+        EXPECT_EQ(
+            data_base.findByInfluence(ExternalEmployee::InfluenceLevel::High), std::vector{contact}
+        );
+        EXPECT_EQ(data_base.findByTimeZone(-5), std::vector{contact});
+        EXPECT_TRUE(data_base.findByTimeZone(0).empty());
+        EXPECT_EQ(data_base.findByJobTitle("Buyer"), std::vector{contact});
+        EXPECT_EQ(data_base.findByDepartment("Purchasing"), std::vector{contact});
+        EXPECT_EQ(data_base.update(BigUint("3"), changer).setName("Nobody").apply(), 0);
+    }
+
+    // A role and an other role set together move the employee once: its other role ends where
+    // it started, so it keeps its place in the group, unlike with two one-field changes
+    TEST(ExternalEmployeeDataBaseTest, UpdateMovesEachIndexOnce)
+    {
+        ExternalEmployeeDataBase data_base;
+        auto changer =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Changer", "A", std::nullopt);
+        auto first  = std::make_shared<ExternalEmployee>(BigUint("2"), "First", "B", std::nullopt);
+        auto second = std::make_shared<ExternalEmployee>(BigUint("3"), "Second", "C", std::nullopt);
+        data_base.add(first);
+        data_base.add(second);
+        data_base.changeOtherAccessRole(first->getId(), "partner", changer);
+        data_base.changeOtherAccessRole(second->getId(), "partner", changer);
+        ASSERT_EQ(data_base.findByOtherAccessRole("partner"), (std::vector{first, second}));
+
+        size_t changed = data_base.update(first->getId(), changer)
+                             .setAccessRole(AccessRole::Admin)
+                             .setOtherRole("partner")
+                             .apply();
+
+        EXPECT_EQ(changed, 2);
+        EXPECT_EQ(data_base.findByOtherAccessRole("partner"), (std::vector{first, second}));
+        EXPECT_TRUE(data_base.findByAccessRole(AccessRole::Admin).empty());
+
+        data_base.changeAccessRole(first->getId(), AccessRole::Admin, changer);
+        data_base.changeOtherAccessRole(first->getId(), "partner", changer);
+
+        EXPECT_EQ(data_base.findByOtherAccessRole("partner"), (std::vector{second, first}));
+    }
+}  // namespace unit
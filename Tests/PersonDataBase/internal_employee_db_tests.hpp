@@ -0,0 +1,88 @@
+#include "Person/Employee/internal_employee.hpp"
+#include "PersonDataBase/internal_employee_db.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    // soft_remove left the employee in the group of their manager
+    TEST(InternalEmployeeDataBaseTest, SoftRemoveDropsManagerEntry)
+    {
+        InternalEmployeeDataBase data_base;
+        auto manager =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Manager", "A", std::nullopt);
+        auto report = std::make_shared<InternalEmployee>(BigUint("2"), "Report", "B", std::nullopt);
+        data_base.add(manager);
+        data_base.add(report);
+        data_base.changeManager(report->getId(), manager, manager);
+        ASSERT_EQ(data_base.findByManager(manager->getId()), std::vector{report});
+
+        data_base.soft_remove(report->getId(), Date());
+
+        EXPECT_TRUE(data_base.findByManager(manager->getId()).empty());
+        EXPECT_FALSE(data_base.getByManager().contains(manager->getId()));
+        EXPECT_EQ(data_base.findById(report->getId()), nullptr);
+        EXPECT_EQ(data_base.getRemoved().size(), 1);
+    }
+
+    TEST(InternalEmployeeDataBaseTest, UpdateLogsOneGroup)
+    {
+        InternalEmployeeDataBase data_base;
+        auto manager =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Manager", "A", std::nullopt);
+        auto report = std::make_shared<InternalEmployee>(BigUint("2"), "Report", "B", std::nullopt);
+        data_base.add(manager);
+        data_base.add(report);
+        size_t logged = report->getChangeLogs().size();
+
+        size_t changed = data_base.update(report->getId(), manager)
+                             .setName("Renamed")
+                             .setDepartment("Sales")
+                             .setAccessRole(AccessRole::SalesRep)
+                             .setTimeZone(3)
+                             .setManager(manager)
+                             .setIsActive(true)
+                             .apply();
+
+        EXPECT_EQ(changed, 6);
+        auto logs = report->getChangeLogs();
+        ASSERT_EQ(logs.size(), logged + 6);
+        for (size_t i = logged; i < logs.size(); i++) {
+            EXPECT_EQ(logs[i]->getChangeDate(), logs[logged]->getChangeDate());
+        }
+        EXPECT_TRUE(data_base.findByName("Report").empty());
+        EXPECT_EQ(data_base.findByName("Renamed"), std::vector{report});
+        EXPECT_EQ(data_base.findByDepartment("Sales"), std::vector{report});
+        EXPECT_EQ(data_base.findByAccessRole(AccessRole::SalesRep), std::vector{report});
+        EXPECT_EQ(data_base.findByTimeZone(3), std::vector{report});
+        EXPECT_EQ(data_base.findByManager(manager->getId()), std::vector{report});
+        EXPECT_EQ(data_base.findByIsActive(true), std::vector{report});
+        EXPECT_EQ(data_base.update(BigUint("3"), manager).setName("Nobody").apply(), 0);
+    }
+
+    // A status and an other status set together move the employee once: its other status ends
+    // where it started, so it keeps its place in the group, unlike with two one-field changes
+    TEST(InternalEmployeeDataBaseTest, UpdateMovesEachIndexOnce)
+    {
+        InternalEmployeeDataBase data_base;
+        auto first  = std::make_shared<InternalEmployee>(BigUint("1"), "First", "A", std::nullopt);
+        auto second = std::make_shared<InternalEmployee>(BigUint("2"), "Second", "B", std::nullopt);
+        data_base.add(first);
+        data_base.add(second);
+        data_base.changeOtherStatus(first->getId(), "remote", first);
+        data_base.changeOtherStatus(second->getId(), "remote", first);
+        ASSERT_EQ(data_base.findByOtherStatus("remote"), (std::vector{first, second}));
+
+        size_t changed = data_base.update(first->getId(), first)
+                             .setStatus(EmployeeStatus::active)
+                             .setOtherStatus("remote")
+                             .apply();
+
+        EXPECT_EQ(changed, 2);
+        EXPECT_EQ(data_base.findByOtherStatus("remote"), (std::vector{first, second}));
+        EXPECT_TRUE(data_base.findByStatus(EmployeeStatus::active).empty());
+
+        data_base.changeStatus(first->getId(), EmployeeStatus::active, first);
+        data_base.changeOtherStatus(first->getId(), "remote", first);
+
+        EXPECT_EQ(data_base.findByOtherStatus("remote"), (std::vector{second, first}));
+    }
+}  // namespace unit
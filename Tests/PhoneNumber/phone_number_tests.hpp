@@ -24,4 +24,59 @@ namespace unit {
 
         EXPECT_TRUE(base_phone_number != phone_number);
     }
+    TEST(PhoneNumberTest, Normalization)
+    {
+        PhoneNumber plus("+79005553535");
+        EXPECT_EQ(plus.getNumber(), "79005553535");
+        EXPECT_EQ(plus, PhoneNumber("79005553535"));
+
+        PhoneNumber leading_zero("00495553535123");
+        EXPECT_EQ(leading_zero.getNumber(), "00495553535123");
+        EXPECT_EQ(leading_zero.getDigitCount(), 14);
+        EXPECT_NE(leading_zero, PhoneNumber("0495553535123"));
+
+        EXPECT_EQ(PhoneNumber("999999999999999").getNumber(), "999999999999999");
+        EXPECT_THROW(PhoneNumber("1234567890123456"), std::runtime_error);
+        EXPECT_THROW(PhoneNumber("+"), std::runtime_error);
+        EXPECT_THROW(PhoneNumber("++79005553535"), std::runtime_error);
+    }
+    TEST(PhoneNumberTest, TryParse)
+    {
+        auto number = PhoneNumber::tryParse("88005553535");
+        ASSERT_TRUE(number.has_value());
+        EXPECT_EQ(number->getKey(), PhoneNumber("88005553535").getKey());
+        EXPECT_FALSE(PhoneNumber::tryParse("8800555").has_value());
+        EXPECT_FALSE(PhoneNumber::tryParse("8800555353a").has_value());
+    }
+    TEST(PhoneNumberTest, ToChars)
+    {
+        PhoneNumber number("88005553535");
+        char        buffer[PhoneNumber::max_chars];
+
+        char*       end = number.toChars(buffer, buffer + sizeof(buffer), true);
+        ASSERT_NE(end, nullptr);
+        EXPECT_EQ(std::string(buffer, end), "+88005553535");
+
+        EXPECT_EQ(number.toChars(buffer, buffer + 11, true), nullptr);
+        end = number.toChars(buffer, buffer + 11);
+        ASSERT_NE(end, nullptr);
+        EXPECT_EQ(std::string(buffer, end), "88005553535");
+    }
+    TEST(PhoneNumberTest, Hash)
+    {
+        PhoneNumber first("88005553535");
+        PhoneNumber second("+88005553535");
+        EXPECT_EQ(std::hash<PhoneNumber>{}(first), std::hash<PhoneNumber>{}(second));
+        EXPECT_NE(first.hash(), PhoneNumber("88005553536").hash());
+    }
+    TEST(PhoneNumberTest, ParseBatch)
+    {
+        std::string_view numbers[] = {"88005553535", "+441234567890123", "8800555353a"};
+        PhoneNumber::Key keys[3]   = {};
+
+        EXPECT_EQ(PhoneNumber::parseBatch(numbers, keys, 3), 2);
+        EXPECT_EQ(keys[0], PhoneNumber("88005553535").getKey());
+        EXPECT_EQ(keys[1], PhoneNumber("441234567890123").getKey());
+        EXPECT_EQ(PhoneNumber::parseBatch(numbers, keys, 2), 2);
+    }
 }  // namespace unit
\ No newline at end of file
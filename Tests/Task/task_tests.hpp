@@ -9,7 +9,7 @@ namespace unit {
 
         SCOPED_TRACE("Constructor with only ID");
 
-        EXPECT_EQ(task.getId().num, "1");
+        EXPECT_EQ(task.getId().toString(), "1");
 
         EXPECT_TRUE(task.getTitle().empty());
         EXPECT_FALSE(task.getDescription().has_value());
@@ -250,11 +250,11 @@ namespace unit {
 
     TEST(TaskTest, setDeadline)
     {
-        auto date_ptr = std::make_shared<Date>(2030, 11, 11);
-        EXPECT_TRUE(task._setDeadline(date_ptr, changer));
+        auto expected = Date(2030, 11, 11);
+        EXPECT_TRUE(task._setDeadline(expected, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getDeadline(), date_ptr);
+        EXPECT_EQ(task.getDeadline(), expected);
         EXPECT_EQ(task.getChangeLogs().size(), 8);
         auto change = task.getChangeLogs().back();
 
@@ -263,8 +263,8 @@ namespace unit {
         EXPECT_FALSE(change->getOldValue().has_value());
         EXPECT_EQ(change->getOldValueStr(), nullptr);
         EXPECT_TRUE(change->getNewValue().has_value());
-        auto new_date = std::get<DatePtr>(change->getNewValue().value());
-        EXPECT_EQ(*new_date, *date_ptr);
+        auto new_date = std::get<Date>(change->getNewValue().value());
+        EXPECT_EQ(new_date, expected);
         EXPECT_EQ(*change->getNewValueStr(), "11 Nov 2030 0:00");
 
         SCOPED_TRACE("Check field");
@@ -275,30 +275,30 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task._setDeadline(date_ptr, changer));
+        EXPECT_FALSE(task._setDeadline(expected, changer));
     }
 
     TEST(TaskTest, changeDeadline)
     {
-        auto old_date_ptr = std::make_shared<Date>(2030, 11, 11);
+        auto expected_old = Date(2030, 11, 11);
 
-        auto new_date_ptr = std::make_shared<Date>(2032, 5, 15);
-        EXPECT_TRUE(task._setDeadline(new_date_ptr, changer));
+        auto expected_new = Date(2032, 5, 15);
+        EXPECT_TRUE(task._setDeadline(expected_new, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getDeadline(), new_date_ptr);
+        EXPECT_EQ(task.getDeadline(), expected_new);
         EXPECT_EQ(task.getChangeLogs().size(), 9);
         auto change = task.getChangeLogs().back();
 
         SCOPED_TRACE("Check change log value");
         EXPECT_EQ(change->getChanger().lock(), changer);
         EXPECT_TRUE(change->getOldValue().has_value());
-        auto old_date = std::get<DatePtr>(change->getOldValue().value());
-        EXPECT_EQ(*old_date, *old_date_ptr);
+        auto old_date = std::get<Date>(change->getOldValue().value());
+        EXPECT_EQ(old_date, expected_old);
         EXPECT_EQ(*change->getOldValueStr(), "11 Nov 2030 0:00");
         EXPECT_TRUE(change->getNewValue().has_value());
-        auto new_date = std::get<DatePtr>(change->getNewValue().value());
-        EXPECT_EQ(*new_date, *new_date_ptr);
+        auto new_date = std::get<Date>(change->getNewValue().value());
+        EXPECT_EQ(new_date, expected_new);
         EXPECT_EQ(*change->getNewValueStr(), "15 May 2032 0:00");
 
         SCOPED_TRACE("Check field");
@@ -309,24 +309,24 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task._setDeadline(new_date_ptr, changer));
+        EXPECT_FALSE(task._setDeadline(expected_new, changer));
     }
 
     TEST(TaskTest, clearDeadline)
     {
-        auto date_ptr = std::make_shared<Date>(2032, 5, 15);
-        EXPECT_TRUE(task._setDeadline(nullptr, changer));
+        auto expected = Date(2032, 5, 15);
+        EXPECT_TRUE(task._setDeadline(std::nullopt, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getDeadline(), nullptr);
+        EXPECT_FALSE(task.getDeadline().has_value());
         EXPECT_EQ(task.getChangeLogs().size(), 10);
         auto change = task.getChangeLogs().back();
 
         SCOPED_TRACE("Check change log value");
         EXPECT_EQ(change->getChanger().lock(), changer);
         EXPECT_TRUE(change->getOldValue().has_value());
-        auto old_date = std::get<DatePtr>(change->getOldValue().value());
-        EXPECT_EQ(*old_date, *date_ptr);
+        auto old_date = std::get<Date>(change->getOldValue().value());
+        EXPECT_EQ(old_date, expected);
         EXPECT_EQ(*change->getOldValueStr(), "15 May 2032 0:00");
         EXPECT_FALSE(change->getNewValue().has_value());
         EXPECT_EQ(change->getNewValueStr(), nullptr);
@@ -339,15 +339,15 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task._setDeadline(nullptr, changer));
+        EXPECT_FALSE(task._setDeadline(std::nullopt, changer));
     }
     TEST(TaskTest, setStartDate)
     {
-        auto date_ptr = std::make_shared<Date>(2020, 11, 11);
-        EXPECT_TRUE(task._setStartDate(date_ptr, changer));
+        auto expected = Date(2020, 11, 11);
+        EXPECT_TRUE(task._setStartDate(expected, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getStartDate(), date_ptr);
+        EXPECT_EQ(task.getStartDate(), expected);
         EXPECT_EQ(task.getChangeLogs().size(), 11);
         auto change = task.getChangeLogs().back();
 
@@ -356,8 +356,8 @@ namespace unit {
         EXPECT_FALSE(change->getOldValue().has_value());
         EXPECT_EQ(change->getOldValueStr(), nullptr);
         EXPECT_TRUE(change->getNewValue().has_value());
-        auto new_date = std::get<DatePtr>(change->getNewValue().value());
-        EXPECT_EQ(*new_date, *date_ptr);
+        auto new_date = std::get<Date>(change->getNewValue().value());
+        EXPECT_EQ(new_date, expected);
         EXPECT_EQ(*change->getNewValueStr(), "11 Nov 2020 0:00");
 
         SCOPED_TRACE("Check field");
@@ -368,29 +368,29 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task._setStartDate(date_ptr, changer));
+        EXPECT_FALSE(task._setStartDate(expected, changer));
     }
     TEST(TaskTest, changeStartDate)
     {
-        auto old_date_ptr = std::make_shared<Date>(2020, 11, 11);
+        auto expected_old = Date(2020, 11, 11);
 
-        auto new_date_ptr = std::make_shared<Date>(2021, 12, 25);
-        EXPECT_TRUE(task._setStartDate(new_date_ptr, changer));
+        auto expected_new = Date(2021, 12, 25);
+        EXPECT_TRUE(task._setStartDate(expected_new, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getStartDate(), new_date_ptr);
+        EXPECT_EQ(task.getStartDate(), expected_new);
         EXPECT_EQ(task.getChangeLogs().size(), 12);
         auto change = task.getChangeLogs().back();
 
         SCOPED_TRACE("Check change log value");
         EXPECT_EQ(change->getChanger().lock(), changer);
         EXPECT_TRUE(change->getOldValue().has_value());
-        auto old_date = std::get<DatePtr>(change->getOldValue().value());
-        EXPECT_EQ(*old_date, *old_date_ptr);
+        auto old_date = std::get<Date>(change->getOldValue().value());
+        EXPECT_EQ(old_date, expected_old);
         EXPECT_EQ(*change->getOldValueStr(), "11 Nov 2020 0:00");
         EXPECT_TRUE(change->getNewValue().has_value());
-        auto new_date = std::get<DatePtr>(change->getNewValue().value());
-        EXPECT_EQ(*new_date, *new_date_ptr);
+        auto new_date = std::get<Date>(change->getNewValue().value());
+        EXPECT_EQ(new_date, expected_new);
         EXPECT_EQ(*change->getNewValueStr(), "25 Dec 2021 0:00");
 
         SCOPED_TRACE("Check field");
@@ -401,24 +401,24 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task._setStartDate(new_date_ptr, changer));
+        EXPECT_FALSE(task._setStartDate(expected_new, changer));
     }
 
     TEST(TaskTest, clearStartDate)
     {
-        auto date_ptr = std::make_shared<Date>(2021, 12, 25);
-        EXPECT_TRUE(task._setStartDate(nullptr, changer));
+        auto expected = Date(2021, 12, 25);
+        EXPECT_TRUE(task._setStartDate(std::nullopt, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getStartDate(), nullptr);
+        EXPECT_FALSE(task.getStartDate().has_value());
         EXPECT_EQ(task.getChangeLogs().size(), 13);
         auto change = task.getChangeLogs().back();
 
         SCOPED_TRACE("Check change log value");
         EXPECT_EQ(change->getChanger().lock(), changer);
         EXPECT_TRUE(change->getOldValue().has_value());
-        auto old_date = std::get<DatePtr>(change->getOldValue().value());
-        EXPECT_EQ(*old_date, *date_ptr);
+        auto old_date = std::get<Date>(change->getOldValue().value());
+        EXPECT_EQ(old_date, expected);
         EXPECT_EQ(*change->getOldValueStr(), "25 Dec 2021 0:00");
         EXPECT_FALSE(change->getNewValue().has_value());
         EXPECT_EQ(change->getNewValueStr(), nullptr);
@@ -431,16 +431,16 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task._setStartDate(nullptr, changer));
+        EXPECT_FALSE(task._setStartDate(std::nullopt, changer));
     }
 
     TEST(TaskTest, setETC)
     {
-        auto duration_ptr = std::make_shared<TimeDuration>(1, 5, 11, 0, 0);
-        EXPECT_TRUE(task.setETC(duration_ptr, changer));
+        auto expected = TimeDuration(1, 5, 11, 0, 0);
+        EXPECT_TRUE(task.setETC(expected, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getETC(), duration_ptr);
+        EXPECT_EQ(task.getETC(), expected);
         EXPECT_EQ(task.getChangeLogs().size(), 14);
         auto change = task.getChangeLogs().back();
 
@@ -449,8 +449,8 @@ namespace unit {
         EXPECT_FALSE(change->getOldValue().has_value());
         EXPECT_EQ(change->getOldValueStr(), nullptr);
         EXPECT_TRUE(change->getNewValue().has_value());
-        auto new_duration = std::get<DurationPtr>(change->getNewValue().value());
-        EXPECT_EQ(*new_duration, *duration_ptr);
+        auto new_duration = std::get<TimeDuration>(change->getNewValue().value());
+        EXPECT_EQ(new_duration, expected);
         EXPECT_EQ(*change->getNewValueStr(), "1 wk, 5 d, 11 hr, 0 min, 0 sec");
 
         SCOPED_TRACE("Check field");
@@ -461,29 +461,29 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task.setETC(duration_ptr, changer));
+        EXPECT_FALSE(task.setETC(expected, changer));
     }
     TEST(TaskTest, changeETC)
     {
-        auto old_duration_ptr = std::make_shared<TimeDuration>(1, 5, 11, 0, 0);
+        auto expected_old = TimeDuration(1, 5, 11, 0, 0);
 
-        auto new_duration_ptr = std::make_shared<TimeDuration>(2, 0, 8, 30, 45);
-        EXPECT_TRUE(task.setETC(new_duration_ptr, changer));
+        auto expected_new = TimeDuration(2, 0, 8, 30, 45);
+        EXPECT_TRUE(task.setETC(expected_new, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getETC(), new_duration_ptr);
+        EXPECT_EQ(task.getETC(), expected_new);
         EXPECT_EQ(task.getChangeLogs().size(), 15);
         auto change = task.getChangeLogs().back();
 
         SCOPED_TRACE("Check change log value");
         EXPECT_EQ(change->getChanger().lock(), changer);
         EXPECT_TRUE(change->getOldValue().has_value());
-        auto old_duration = std::get<DurationPtr>(change->getOldValue().value());
-        EXPECT_EQ(*old_duration, *old_duration_ptr);
+        auto old_duration = std::get<TimeDuration>(change->getOldValue().value());
+        EXPECT_EQ(old_duration, expected_old);
         EXPECT_EQ(*change->getOldValueStr(), "1 wk, 5 d, 11 hr, 0 min, 0 sec");
         EXPECT_TRUE(change->getNewValue().has_value());
-        auto new_duration = std::get<DurationPtr>(change->getNewValue().value());
-        EXPECT_EQ(*new_duration, *new_duration_ptr);
+        auto new_duration = std::get<TimeDuration>(change->getNewValue().value());
+        EXPECT_EQ(new_duration, expected_new);
         EXPECT_EQ(*change->getNewValueStr(), "2 wks, 0 d, 8 hr, 30 min, 45 sec");
 
         SCOPED_TRACE("Check field");
@@ -494,24 +494,24 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task.setETC(new_duration_ptr, changer));
+        EXPECT_FALSE(task.setETC(expected_new, changer));
     }
 
     TEST(TaskTest, clearETC)
     {
-        auto last_duration_ptr = std::make_shared<TimeDuration>(2, 0, 8, 30, 45);
-        EXPECT_TRUE(task.setETC(nullptr, changer));
+        auto expected_old = TimeDuration(2, 0, 8, 30, 45);
+        EXPECT_TRUE(task.setETC(std::nullopt, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getETC(), nullptr);
+        EXPECT_FALSE(task.getETC().has_value());
         EXPECT_EQ(task.getChangeLogs().size(), 16);
         auto change = task.getChangeLogs().back();
 
         SCOPED_TRACE("Check change log value");
         EXPECT_EQ(change->getChanger().lock(), changer);
         EXPECT_TRUE(change->getOldValue().has_value());
-        auto old_duration = std::get<DurationPtr>(change->getOldValue().value());
-        EXPECT_EQ(*old_duration, *last_duration_ptr);
+        auto old_duration = std::get<TimeDuration>(change->getOldValue().value());
+        EXPECT_EQ(old_duration, expected_old);
         EXPECT_EQ(*change->getOldValueStr(), "2 wks, 0 d, 8 hr, 30 min, 45 sec");
         EXPECT_FALSE(change->getNewValue().has_value());
         EXPECT_EQ(change->getNewValueStr(), nullptr);
@@ -524,16 +524,16 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task.setETC(nullptr, changer));
+        EXPECT_FALSE(task.setETC(std::nullopt, changer));
     }
 
     TEST(TaskTest, setATS)
     {
-        auto duration_ptr = std::make_shared<TimeDuration>(0, 3, 6, 15, 30);
-        EXPECT_TRUE(task.setATS(duration_ptr, changer));
+        auto expected = TimeDuration(0, 3, 6, 15, 30);
+        EXPECT_TRUE(task.setATS(expected, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getATS(), duration_ptr);
+        EXPECT_EQ(task.getATS(), expected);
         EXPECT_EQ(task.getChangeLogs().size(), 17);
         auto change = task.getChangeLogs().back();
 
@@ -542,8 +542,8 @@ namespace unit {
         EXPECT_FALSE(change->getOldValue().has_value());
         EXPECT_EQ(change->getOldValueStr(), nullptr);
         EXPECT_TRUE(change->getNewValue().has_value());
-        auto new_duration = std::get<DurationPtr>(change->getNewValue().value());
-        EXPECT_EQ(*new_duration, *duration_ptr);
+        auto new_duration = std::get<TimeDuration>(change->getNewValue().value());
+        EXPECT_EQ(new_duration, expected);
         EXPECT_EQ(*change->getNewValueStr(), "0 wk, 3 d, 6 hr, 15 min, 30 sec");
 
         SCOPED_TRACE("Check field");
@@ -554,30 +554,30 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task.setATS(duration_ptr, changer));
+        EXPECT_FALSE(task.setATS(expected, changer));
     }
 
     TEST(TaskTest, changeATS)
     {
-        auto old_duration_ptr = std::make_shared<TimeDuration>(0, 3, 6, 15, 30);
+        auto expected_old = TimeDuration(0, 3, 6, 15, 30);
 
-        auto new_duration_ptr = std::make_shared<TimeDuration>(1, 0, 4, 45, 20);
-        EXPECT_TRUE(task.setATS(new_duration_ptr, changer));
+        auto expected_new = TimeDuration(1, 0, 4, 45, 20);
+        EXPECT_TRUE(task.setATS(expected_new, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getATS(), new_duration_ptr);
+        EXPECT_EQ(task.getATS(), expected_new);
         EXPECT_EQ(task.getChangeLogs().size(), 18);
         auto change = task.getChangeLogs().back();
 
         SCOPED_TRACE("Check change log value");
         EXPECT_EQ(change->getChanger().lock(), changer);
         EXPECT_TRUE(change->getOldValue().has_value());
-        auto old_duration = std::get<DurationPtr>(change->getOldValue().value());
-        EXPECT_EQ(*old_duration, *old_duration_ptr);
+        auto old_duration = std::get<TimeDuration>(change->getOldValue().value());
+        EXPECT_EQ(old_duration, expected_old);
         EXPECT_EQ(*change->getOldValueStr(), "0 wk, 3 d, 6 hr, 15 min, 30 sec");
         EXPECT_TRUE(change->getNewValue().has_value());
-        auto new_duration = std::get<DurationPtr>(change->getNewValue().value());
-        EXPECT_EQ(*new_duration, *new_duration_ptr);
+        auto new_duration = std::get<TimeDuration>(change->getNewValue().value());
+        EXPECT_EQ(new_duration, expected_new);
         EXPECT_EQ(*change->getNewValueStr(), "1 wk, 0 d, 4 hr, 45 min, 20 sec");
 
         SCOPED_TRACE("Check field");
@@ -588,24 +588,24 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task.setATS(new_duration_ptr, changer));
+        EXPECT_FALSE(task.setATS(expected_new, changer));
     }
 
     TEST(TaskTest, clearATS)
     {
-        auto last_duration_ptr = std::make_shared<TimeDuration>(1, 0, 4, 45, 20);
-        EXPECT_TRUE(task.setATS(nullptr, changer));
+        auto expected_old = TimeDuration(1, 0, 4, 45, 20);
+        EXPECT_TRUE(task.setATS(std::nullopt, changer));
 
         SCOPED_TRACE("Check value");
-        EXPECT_EQ(task.getATS(), nullptr);
+        EXPECT_FALSE(task.getATS().has_value());
         EXPECT_EQ(task.getChangeLogs().size(), 19);
         auto change = task.getChangeLogs().back();
 
         SCOPED_TRACE("Check change log value");
         EXPECT_EQ(change->getChanger().lock(), changer);
         EXPECT_TRUE(change->getOldValue().has_value());
-        auto old_duration = std::get<DurationPtr>(change->getOldValue().value());
-        EXPECT_EQ(*old_duration, *last_duration_ptr);
+        auto old_duration = std::get<TimeDuration>(change->getOldValue().value());
+        EXPECT_EQ(old_duration, expected_old);
         EXPECT_EQ(*change->getOldValueStr(), "1 wk, 0 d, 4 hr, 45 min, 20 sec");
         EXPECT_FALSE(change->getNewValue().has_value());
         EXPECT_EQ(change->getNewValueStr(), nullptr);
@@ -618,7 +618,7 @@ namespace unit {
 
         SCOPED_TRACE("Check action");
         EXPECT_EQ(change->getAction(), ChangeLog::Action::Change);
-        EXPECT_FALSE(task.setATS(nullptr, changer));
+        EXPECT_FALSE(task.setATS(std::nullopt, changer));
     }
     auto manager1 =
         std::make_shared<InternalEmployee>(BigUint("1"), "Name", "Surname", std::nullopt);
@@ -760,7 +760,7 @@ namespace unit {
         EXPECT_TRUE(change->getOldValue().has_value());
         EXPECT_EQ(*change->getOldValueStr(), "Title");
         auto old_task = std::get<TaskPtr>(change->getOldValue().value());
-        EXPECT_EQ(old_task->getId().num, "1");
+        EXPECT_EQ(old_task->getId().toString(), "1");
         EXPECT_FALSE(change->getNewValue().has_value());
         EXPECT_EQ(change->getNewValueStr(), nullptr);
 
@@ -823,7 +823,7 @@ namespace unit {
         EXPECT_TRUE(change->getOldValue().has_value());
         EXPECT_EQ(*change->getOldValueStr(), "Name");
         auto old_task = std::get<FilePtr>(change->getOldValue().value());
-        EXPECT_EQ(old_task->getId().num, "1");
+        EXPECT_EQ(old_task->getId().toString(), "1");
         EXPECT_FALSE(change->getNewValue().has_value());
         EXPECT_EQ(change->getNewValueStr(), nullptr);
 
@@ -985,7 +985,7 @@ namespace unit {
         EXPECT_EQ(change->getOldValueStr(), nullptr);
         EXPECT_TRUE(change->getNewValue().has_value());
         auto old_person = std::get<WeakPersonPtr>(change->getNewValue().value());
-        EXPECT_EQ(old_person.lock()->getId().num, "1");
+        EXPECT_EQ(old_person.lock()->getId().toString(), "1");
         EXPECT_EQ(*change->getNewValueStr(), "Name Surname");
 
         SCOPED_TRACE("Check field");
@@ -1014,7 +1014,7 @@ namespace unit {
         EXPECT_TRUE(change->getOldValue().has_value());
         EXPECT_EQ(*change->getOldValueStr(), "Name Surname");
         auto old_teem = std::get<WeakPersonPtr>(change->getOldValue().value());
-        EXPECT_EQ(old_teem.lock()->getId().num, "1");
+        EXPECT_EQ(old_teem.lock()->getId().toString(), "1");
         EXPECT_FALSE(change->getNewValue().has_value());
         EXPECT_EQ(change->getNewValueStr(), nullptr);
 
@@ -0,0 +1,137 @@
+#include "ChangeLog/change_journal.hpp"
+#include "Person/Employee/internal_employee.hpp"
+#include "TaskDataBase/task_db.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(TaskDataBaseTest, UpdateLogsOneGroup)
+    {
+        TaskDataBase data_base;
+        auto manager =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Manager", "A", std::nullopt);
+        auto task = std::make_shared<Task>(BigUint("2"));
+        data_base.add(task);
+        size_t logged = task->getChangeLogs().size();
+
+        size_t changed = data_base.update(task->getId(), manager)
+                             .setStatus(Task::Status::InProgress)
+                             .setPriority(Priority::High)
+                             .setDeadline(Date(2030, 5, 1))
+                             .setStartDate(Date(2030, 4, 1))
+                             .setManager(manager)
+                             .apply();
+
+        EXPECT_EQ(changed, 5);
+        auto logs = task->getChangeLogs();
+        ASSERT_EQ(logs.size(), logged + 5);
+        for (size_t i = logged; i < logs.size(); i++) {
+            EXPECT_EQ(logs[i]->getChangeDate(), logs[logged]->getChangeDate());
+        }
+        EXPECT_EQ(data_base.findByStatus(Task::Status::InProgress), std::vector{task});
+        EXPECT_TRUE(data_base.findByStatus(Task::Status::NotStarted).empty());
+        EXPECT_EQ(data_base.findByPriority(Priority::High), std::vector{task});
+        EXPECT_EQ(data_base.findByDeadline(Date(2030, 5, 1)), std::vector{task});
+        EXPECT_EQ(data_base.getByDeadline().size(), 1);
+        EXPECT_EQ(data_base.findByStartDate(Date(2030, 4, 1)), std::vector{task});
+        EXPECT_EQ(data_base.getByStartDate().size(), 1);
+        EXPECT_EQ(data_base.findByManager(manager->getId()), std::vector{task});
+        EXPECT_EQ(data_base.update(BigUint("3"), manager).setPriority(Priority::Low).apply(), 0);
+    }
+
+    // A field set twice keeps the last value and the task is moved once, straight to it
+    TEST(TaskDataBaseTest, UpdateMovesEachIndexOnce)
+    {
+        TaskDataBase data_base;
+        auto manager =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Manager", "A", std::nullopt);
+        auto first  = std::make_shared<Task>(BigUint("2"));
+        auto second = std::make_shared<Task>(BigUint("3"));
+        data_base.add(first);
+        data_base.add(second);
+        data_base.changeManager(first->getId(), manager, manager);
+        data_base.changeManager(second->getId(), manager, manager);
+        ASSERT_EQ(data_base.findByManager(manager->getId()), (std::vector{first, second}));
+
+        auto other =
+            std::make_shared<InternalEmployee>(BigUint("4"), "Other", "B", std::nullopt);
+        size_t changed =
+            data_base.update(first->getId(), manager).setManager(other).setManager(manager).apply();
+
+        EXPECT_EQ(changed, 0);
+        EXPECT_EQ(data_base.findByManager(manager->getId()), (std::vector{first, second}));
+        EXPECT_FALSE(data_base.getByManager().contains(other->getId()));
+    }
+
+    TEST(TaskDataBaseTest, StateStartsFromCreationValues)
+    {
+        TaskDataBase data_base;
+        auto manager =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Manager", "A", std::nullopt);
+        auto task = std::make_shared<Task>(
+            BigUint("2"),
+            "Prepare offer",
+            "For the new client",
+            std::nullopt,
+            Task::Status::InProgress,
+            Priority::High,
+            Date(2030, 5, 1),
+            std::nullopt,
+            std::nullopt,
+            std::nullopt,
+            WeakInternalEmployee(),
+            manager,
+            std::vector<WeakDealPtr>(),
+            std::vector<Note>(),
+            std::vector<StringPair>(),
+            std::vector<WeakPersonPtr>()
+        );
+        data_base.add(task);
+
+        auto state = task->getStateAt(Date());
+        EXPECT_EQ(*state.getValueStr(TaskFields::Title), "Prepare offer");
+        EXPECT_EQ(*state.getValueStr(TaskFields::Description), "For the new client");
+        EXPECT_FALSE(state.contains(TaskFields::Subject));
+        auto status = [&] { return std::get<Task::Status>(*state.getValue(TaskFields::Status)); };
+        EXPECT_EQ(status(), Task::Status::InProgress);
+        EXPECT_EQ(std::get<Date>(*state.getValue(TaskFields::Deadline)), Date(2030, 5, 1));
+        EXPECT_TRUE(state.contains(TaskFields::Manager));
+        EXPECT_TRUE(task->getStateAt(Date(2000, 1, 1)).getFields().empty());
+
+        // past the first checkpoint, which is built on top of the creation values
+        for (int i = 0; i < 70; i++) {
+            data_base.changeStatus(
+                task->getId(),
+                i % 2 == 0 ? Task::Status::Completed : Task::Status::InProgress,
+                manager
+            );
+        }
+        state = task->getStateAt(Date());
+        EXPECT_EQ(*state.getValueStr(TaskFields::Title), "Prepare offer");
+        EXPECT_EQ(status(), Task::Status::InProgress);
+    }
+
+    TEST(TaskDataBaseTest, HardRemoveDropsChangeLogs)
+    {
+        TenantScope  tenant(4);  // no other test changes anything as this manager there
+        TaskDataBase data_base;
+        auto manager =
+            std::make_shared<InternalEmployee>(BigUint("1"), "Manager", "A", std::nullopt);
+        auto task = std::make_shared<Task>(BigUint("2"));
+        data_base.add(task);
+        data_base.update(task->getId(), manager)
+            .setStatus(Task::Status::InProgress)
+            .setPriority(Priority::High)
+            .apply();
+
+        AuditQuery by_manager;
+        by_manager.changer = manager->getId();
+        ASSERT_EQ(ChangeJournal::getInstance().queryAudit(by_manager).offsets.size(), 2);
+
+        data_base.safe_remove(task->getId(), Date());
+        data_base.hard_remove(0);
+
+        EXPECT_TRUE(ChangeJournal::getInstance().queryAudit(by_manager).offsets.empty());
+        EXPECT_TRUE(task->getChangeLogs().empty());
+        EXPECT_TRUE(data_base.getRemoved().empty());
+    }
+}  // namespace unit
@@ -0,0 +1,121 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ChangeLog/change_journal.hpp"
+#include "Person/Employee/internal_employee.hpp"
+#include "PersonDataBase/internal_employee_db.hpp"
+#include "TenantContext/string_pool.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(StringPoolTest, InternGivesOneDenseSymbolPerText)
+    {
+        StringPool pool;
+
+        EXPECT_EQ(pool.intern("Sales"), 0);
+        EXPECT_EQ(pool.intern("Support"), 1);
+        EXPECT_EQ(pool.intern(std::string("Sales")), 0);
+        EXPECT_EQ(pool.intern(""), 2);
+        EXPECT_EQ(pool.size(), 3);
+        EXPECT_EQ(pool.view(1), "Support");
+        EXPECT_EQ(pool.view(2), "");
+    }
+
+    TEST(StringPoolTest, FindNeverAdds)
+    {
+        StringPool pool;
+        pool.intern("Sales");
+
+        EXPECT_EQ(pool.find("Sales"), 0);
+        EXPECT_EQ(pool.find("Support"), std::nullopt);
+        EXPECT_EQ(pool.size(), 1);
+    }
+
+    TEST(StringPoolTest, UnknownSymbolThrows)
+    {
+        StringPool pool;
+        pool.intern("Sales");
+
+        EXPECT_THROW(pool.view(1), std::out_of_range);
+        EXPECT_THROW(pool.view(StringPool::none), std::out_of_range);
+    }
+
+    TEST(StringPoolTest, ViewsStayValidAcrossChunks)
+    {
+        StringPool                    pool;
+        std::vector<std::string>      texts;
+        std::vector<std::string_view> views;
+        for (int i = 0; i < 5000; ++i) {
+            // every tenth text is long enough for a block of its own
+            texts.push_back(std::string(i % 10 == 0 ? 5000 : 20, 'a') + std::to_string(i));
+            views.push_back(pool.view(pool.intern(texts.back())));
+        }
+
+        for (size_t i = 0; i < texts.size(); ++i) {
+            EXPECT_EQ(views[i], texts[i]);
+            EXPECT_EQ(pool.find(texts[i]), i);
+        }
+    }
+
+    TEST(StringPoolTest, RemovingAnEntityDoesNotGrowThePool)
+    {
+        auto pool    = std::make_shared<StringPool>();
+        auto changer = std::make_shared<InternalEmployee>(BigUint("1"), "A", "B", std::nullopt);
+        auto first   = std::make_shared<InternalEmployee>(BigUint("2"), "C", "D", std::nullopt);
+        auto second  = std::make_shared<InternalEmployee>(BigUint("3"), "E", "F", std::nullopt);
+        InternalEmployeeDataBase data_base(pool);
+        data_base.add(first);
+        data_base.add(second);
+        data_base.changeDepartment(first->getId(), "Sales", changer);
+        data_base.changeDepartment(second->getId(), "Sales", changer);
+        ASSERT_EQ(pool->size(), 1);
+
+        data_base.changeDepartment(first->getId(), "Support", changer);
+        EXPECT_EQ(pool->size(), 2);
+        EXPECT_EQ(data_base.findByDepartment("Sales"), std::vector{second});
+        EXPECT_EQ(data_base.findByDepartment("Support"), std::vector{first});
+
+        // changed behind the data base: the removal logs the missing entry, interns nothing
+        second->_setDepartment("Marketing", changer);
+        data_base.soft_remove(first->getId(), Date());
+        data_base.soft_remove(second->getId(), Date());
+        EXPECT_EQ(pool->size(), 2);
+        EXPECT_EQ(pool->find("Marketing"), std::nullopt);
+        EXPECT_EQ(data_base.getByDepartment().size(), 1);
+        EXPECT_TRUE(data_base.findByDepartment("Other").empty());
+        EXPECT_EQ(pool->size(), 2);
+    }
+
+    TEST(StringPoolTest, ModelsKeepSymbolsOfTheirTenantPool)
+    {
+        TenantScope tenant(6);  // no other test interns anything there
+        const auto& pool = StringPool::ofTenant(6);
+        EXPECT_EQ(&StringPool::current(), &pool);
+        EXPECT_NE(StringPool::ofTenant(7), pool);
+
+        auto changer = std::make_shared<InternalEmployee>(BigUint("1"), "A", "B", std::nullopt);
+        auto first   = std::make_shared<InternalEmployee>(BigUint("2"), "C", "D", std::nullopt);
+        auto second  = std::make_shared<InternalEmployee>(BigUint("3"), "E", "F", std::nullopt);
+        InternalEmployeeDataBase data_base;
+        EXPECT_EQ(&data_base.getStringPool(), pool.get());
+
+        data_base.add(first);
+        data_base.add(second);
+        data_base.changeDepartment(first->getId(), "Sales", changer);
+        data_base.changeDepartment(second->getId(), "Sales", changer);
+        EXPECT_EQ(pool->size(), 1);
+
+        const InternedStr& department = *first->getDepartment();
+        EXPECT_EQ(department, "Sales");
+        EXPECT_EQ(department.getPool(), pool.get());
+        EXPECT_EQ(department.getSymbol(), pool->find("Sales"));
+        EXPECT_EQ(second->getDepartment()->view().data(), department.view().data());
+        EXPECT_EQ(data_base.getByDepartment().begin()->first, department.getSymbol());
+        EXPECT_EQ(data_base.findByDepartment("Sales").size(), 2);
+
+        // a text of another pool is equal by its characters
+        EXPECT_EQ(InternedStr(*StringPool::ofTenant(7), "Sales"), department);
+        EXPECT_EQ(InternedStr(), "");
+    }
+}  // namespace unit
@@ -0,0 +1,103 @@
+#include "UserSession/session_changes.hpp"
+#include "UserSession/session_manager.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(SessionChangesTest, CountAndFilter)
+    {
+        auto        session = std::make_shared<UserSession>("stream", std::nullopt, std::nullopt);
+        ChangeChain deal;
+        ChangeChain task;
+
+        {
+            SessionScope scope(session);
+            for (int i = 0; i < 3; i++) {
+                deal.append(
+                    InternalEmployeePtr(),
+                    std::nullopt,
+                    std::make_optional<ChangeLog::ValueVariant>(i),
+                    DealFields::Status,
+                    ChangeLog::FieldType::null,
+                    ChangeLog::FieldType::Int,
+                    ChangeLog::Action::Add
+                );
+            }
+            task.append(
+                InternalEmployeePtr(),
+                std::nullopt,
+                ChangeValue::fromText("Call back"),
+                TaskFields::Title,
+                ChangeLog::FieldType::null,
+                ChangeLog::FieldType::String,
+                ChangeLog::Action::Add
+            );
+        }
+        // made outside the scope, so not part of the session
+        task.append(
+            InternalEmployeePtr(),
+            std::nullopt,
+            ChangeValue::fromText("Ignored"),
+            TaskFields::Title,
+            ChangeLog::FieldType::null,
+            ChangeLog::FieldType::String,
+            ChangeLog::Action::Add
+        );
+
+        SessionChanges changes(*session);
+        ASSERT_EQ(changes.size(), 4);
+        EXPECT_EQ(session->getChangeCount(), 4);
+        EXPECT_EQ(std::vector(changes.begin(), changes.end()), session->getSessionChanges());
+
+        EXPECT_EQ(changes.getKind(0), change_kind::of<DealFields>);
+        EXPECT_EQ(changes.getKind(3), change_kind::of<TaskFields>);
+        EXPECT_EQ(changes.countByKind()[change_kind::of<DealFields>], 3);
+        EXPECT_EQ(session->getChangeKindCounts(), changes.countByKind());
+
+        EXPECT_EQ(changes.count<DealFields>(), 3);
+        EXPECT_EQ((changes.count<DealFields, TaskFields>()), 4);
+        EXPECT_EQ(changes.count(change_kind::interactions), 0);
+        EXPECT_EQ(changes.filter(change_kind::deals), ChangeLogView(deal).offsets());
+
+        auto tasks = changes.filter<TaskFields>();
+        ASSERT_EQ(tasks.size(), 1);
+        EXPECT_EQ(tasks[0], ChangeLogView(task).offsets()[0]);
+        EXPECT_EQ(*changes.getEntry(3)->getNewValueStr(), "Call back");
+        EXPECT_THROW(changes[4], std::out_of_range);
+    }
+
+    // Clients and employees change the same `PersonFields`, so the field kind does not tell them
+    // apart
+    TEST(SessionChangesTest, CountByEntityType)
+    {
+        auto        session = std::make_shared<UserSession>("types", std::nullopt, std::nullopt);
+        ChangeChain client(EntityType::Client);
+        ChangeChain employee(EntityType::InternalEmployee);
+
+        {
+            SessionScope scope(session);
+            for (ChangeChain* chain : {&client, &employee, &employee}) {
+                chain->append(
+                    InternalEmployeePtr(),
+                    std::nullopt,
+                    ChangeValue::fromText("Name"),
+                    PersonFields::Name,
+                    ChangeLog::FieldType::null,
+                    ChangeLog::FieldType::String,
+                    ChangeLog::Action::Add
+                );
+            }
+        }
+
+        SessionChanges changes(*session);
+        EXPECT_EQ(changes.count<PersonFields>(), 3);
+        EXPECT_EQ(changes.getEntityType(0), EntityType::Client);
+        EXPECT_EQ(changes.getEntityType(1), EntityType::InternalEmployee);
+        EXPECT_EQ(changes.count(EntityType::Client), 1);
+        EXPECT_EQ(changes.count(EntityType::InternalEmployee), 2);
+        EXPECT_EQ(changes.count(EntityType::Person), 0);
+        EXPECT_EQ(session->getEntityTypeCounts(), changes.countByEntityType());
+        EXPECT_EQ(changes.filter(EntityType::Client), ChangeLogView(client).offsets());
+        EXPECT_EQ(changes.filter(EntityType::InternalEmployee), ChangeLogView(employee).offsets());
+        EXPECT_THROW(changes.getEntityType(3), std::out_of_range);
+    }
+}  // namespace unit
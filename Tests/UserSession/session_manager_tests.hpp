@@ -0,0 +1,113 @@
+#include <thread>
+#include <vector>
+
+#include "ChangeLog/change_journal.hpp"
+#include "UserSession/session_manager.hpp"
+#include "gtest/gtest.h"
+
+namespace unit {
+    TEST(SessionManagerTest, Registry)
+    {
+        auto&  manager = SessionManager::getInstance();
+        auto   session = std::make_shared<UserSession>("registry", std::nullopt, std::nullopt);
+        size_t size    = manager.size();
+
+        EXPECT_TRUE(manager.addSession(session));
+        EXPECT_FALSE(manager.addSession(
+            std::make_shared<UserSession>("registry", std::nullopt, std::nullopt)
+        ));
+        EXPECT_EQ(manager.size(), size + 1);
+        EXPECT_EQ(manager.findSession("registry"), session);
+        EXPECT_EQ(manager.findSession("missing-token"), nullptr);
+
+        EXPECT_TRUE(manager.removeSession("registry"));
+        EXPECT_FALSE(manager.removeSession("registry"));
+        EXPECT_EQ(manager.findSession("registry"), nullptr);
+        EXPECT_EQ(manager.size(), size);
+    }
+
+    TEST(SessionManagerTest, Scope)
+    {
+        auto& manager = SessionManager::getInstance();
+        auto  outer   = std::make_shared<UserSession>("outer", std::nullopt, std::nullopt);
+        auto  inner   = std::make_shared<UserSession>("inner", std::nullopt, std::nullopt);
+        manager.addSession(inner);
+
+        manager.setCurrentSession(outer);
+        {
+            SessionScope scope("inner");
+            EXPECT_EQ(scope.getSession(), inner);
+            EXPECT_EQ(manager.getCurrentSession(), inner);
+        }
+        EXPECT_EQ(manager.getCurrentSession(), outer);
+        {
+            SessionScope scope("missing-token");
+            EXPECT_EQ(manager.getCurrentSession(), nullptr);
+        }
+        EXPECT_EQ(manager.getCurrentSession(), outer);
+
+        manager.setCurrentSession(nullptr);
+        manager.removeSession("inner");
+    }
+
+    TEST(SessionManagerTest, ThreadAttribution)
+    {
+        constexpr size_t thread_count = 4;
+        constexpr size_t changes      = 500;
+
+        auto&                       manager = SessionManager::getInstance();
+        std::vector<UserSessionPtr> sessions;
+        std::vector<ChangeChain>    chains(thread_count);
+        std::vector<std::thread>    threads;
+        for (size_t i = 0; i < thread_count; i++) {
+            sessions.push_back(std::make_shared<UserSession>(
+                "worker-" + std::to_string(i), std::nullopt, std::nullopt
+            ));
+            manager.addSession(sessions.back());
+        }
+
+        for (size_t i = 0; i < thread_count; i++) {
+            threads.emplace_back([&, i] {
+                SessionScope scope("worker-" + std::to_string(i));
+                for (size_t change = 0; change < changes; change++) {
+                    chains[i].append(
+                        InternalEmployeePtr(),
+                        std::nullopt,
+                        std::make_optional<ChangeLog::ValueVariant>(static_cast<int>(change)),
+                        TaskFields::Title,
+                        ChangeLog::FieldType::null,
+                        ChangeLog::FieldType::Int,
+                        ChangeLog::Action::Add
+                    );
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        for (size_t i = 0; i < thread_count; i++) {
+            EXPECT_EQ(sessions[i]->getSessionChanges(), ChangeLogView(chains[i]).offsets());
+            auto last = ChangeLogView(chains[i]).back();
+            EXPECT_EQ(std::get<int>(last->getNewValue().value()), static_cast<int>(changes - 1));
+            manager.removeSession(sessions[i]->getToken());
+        }
+        EXPECT_EQ(manager.getCurrentSession(), nullptr);
+    }
+
+    TEST(SessionManagerTest, ConcurrentLogout)
+    {
+        auto session = std::make_shared<UserSession>("logout", std::nullopt, std::nullopt);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < 4; i++) {
+            threads.emplace_back([&] {
+                while (session->getIsActive()) session->logout();
+                EXPECT_TRUE(session->getLogoutTime().has_value());
+            });
+        }
+        for (auto& thread : threads) thread.join();
+
+        OptionalDate logout_time = session->getLogoutTime();
+        session->logout();
+        EXPECT_FALSE(session->getIsActive());
+        EXPECT_EQ(session->getLogoutTime(), logout_time);
+    }
+}  // namespace unit
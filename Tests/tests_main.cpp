@@ -1,15 +1,36 @@
 #include "Tests/BigNum/big_uint_tests.hpp"
+#include "Tests/BigNum/digits_tests.hpp"
 #include "Tests/BigNum/money_tests.hpp"
 #include "Tests/ChangeLog/chagne_log_tests.hpp"
+#include "Tests/ChangeLog/change_archive_tests.hpp"
+#include "Tests/ChangeLog/change_audit_index_tests.hpp"
+#include "Tests/ChangeLog/change_journal_tests.hpp"
+#include "Tests/ChangeLog/change_renderer_tests.hpp"
+#include "Tests/ChangeLog/change_stream_tests.hpp"
+#include "Tests/ChangeLog/change_value_tests.hpp"
+#include "Tests/ChangeLog/entity_state_tests.hpp"
 #include "Tests/ChangeLog/enums_to_str_tests.hpp"
+#include "Tests/Currencies/currencies_tests.hpp"
 #include "Tests/DateTime/date_tests.hpp"
 #include "Tests/DateTime/time_duration_tests.hpp"
+#include "Tests/DealDataBase/deal_db_tests.hpp"
+#include "Tests/IndexedStore/flat_hash_map_tests.hpp"
+#include "Tests/IndexedStore/indexed_store_tests.hpp"
+#include "Tests/IndexedStore/indexes_tests.hpp"
+#include "Tests/IndexedStore/roaring_bitmap_tests.hpp"
+#include "Tests/InteractionDataBase/interaction_db_tests.hpp"
 #include "Tests/PhoneNumber/phone_number_tests.hpp"
 #include "Tests/Person/person_tests.hpp"
 #include "Tests/Person/client_tests.hpp"
 #include "Tests/Person/internal_employee_tests.hpp"
 #include "Tests/Person/external_employee_tests.hpp"
+#include "Tests/PersonDataBase/external_employee_db_tests.hpp"
+#include "Tests/PersonDataBase/internal_employee_db_tests.hpp"
 #include "Tests/Task/task_tests.hpp"
+#include "Tests/TaskDataBase/task_db_tests.hpp"
+#include "Tests/TenantContext/string_pool_tests.hpp"
+#include "Tests/UserSession/session_changes_tests.hpp"
+#include "Tests/UserSession/session_manager_tests.hpp"
 
 int main(int argc, char**argv) {
 	::testing::InitGoogleTest(&argc, argv);
@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 
 namespace errors {
     inline std::string phone_number_incorrect  = "Phone number incorrect";
@@ -14,8 +15,21 @@ namespace errors {
     inline std::string client_not_found        = "Client not found";
     inline std::string phone_number_bus        = "The phone number is busy";
     inline std::string invalid_currency_format = "Invalid currency format";
+    inline std::string money_overflow          = "Money amount overflow";
+    inline std::string money_underflow         = "Money amount below zero";
+    inline std::string currency_mismatch       = "Currency mismatch";
     inline std::string uint_constructor_error  = "Use only numbers 0...9";
     inline std::string negative_date_range     = "Negative date range";
+    inline std::string string_pool_full        = "String pool is full";
+    inline std::string unknown_symbol          = "Unknown string pool symbol";
+    inline std::string fx_rate_missing         = "No exchange rate for the date";
+    inline std::string change_journal_full     = "Change journal is full";
+    inline std::string unknown_change          = "Unknown change journal record";
+    inline std::string archive_corrupt         = "Change archive segment is corrupt";
+    inline std::string archive_missing         = "Change archive directory is not set";
+    inline std::string archive_exists          = "Change archive segment already exists";
+    inline std::string stream_subscribers_full = "Change stream has no free subscriber slot";
+    inline std::string unknown_wide_id         = "Unknown wide id of a change event";
 
 }  // namespace errors
 
@@ -59,290 +73,308 @@ namespace time_str {
 }  // namespace time_str
 
 namespace interaction_result_status_str {
-    inline std::string success         = "The meeting ended successfully";
-    inline std::string failure         = "The meeting ended unsuccessfully";
-    inline std::string partialSuccess  = "Partial progress was achieved";
-    inline std::string followUpNeeded  = "Further interaction is required";
-    inline std::string canceled        = "The meeting was canceled before completion";
-    inline std::string postponed       = "The meeting was postponed";
-    inline std::string issueIdentified = "An issue was identified requiring resolution";
-    inline std::string noOutcome       = "The meeting resulted in no specific outcome";
-    inline std::string other           = "Other result status";
+    inline constexpr std::string_view success         = "The meeting ended successfully";
+    inline constexpr std::string_view failure         = "The meeting ended unsuccessfully";
+    inline constexpr std::string_view partialSuccess  = "Partial progress was achieved";
+    inline constexpr std::string_view followUpNeeded  = "Further interaction is required";
+    inline constexpr std::string_view canceled        =
+        "The meeting was canceled before completion";
+    inline constexpr std::string_view postponed       = "The meeting was postponed";
+    inline constexpr std::string_view issueIdentified =
+        "An issue was identified requiring resolution";
+    inline constexpr std::string_view noOutcome       =
+        "The meeting resulted in no specific outcome";
+    inline constexpr std::string_view other           = "Other result status";
 }  // namespace interaction_result_status_str
 
 namespace meeting_status_str {
-    inline std::string scheduled  = "The meeting is scheduled";
-    inline std::string inProgress = "The meeting is currently in progress";
-    inline std::string completed  = "The meeting has been completed";
-    inline std::string canceled   = "The meeting was canceled";
-    inline std::string postponed  = "The meeting was postponed";
+    inline constexpr std::string_view scheduled  = "The meeting is scheduled";
+    inline constexpr std::string_view inProgress = "The meeting is currently in progress";
+    inline constexpr std::string_view completed  = "The meeting has been completed";
+    inline constexpr std::string_view canceled   = "The meeting was canceled";
+    inline constexpr std::string_view postponed  = "The meeting was postponed";
 }  // namespace meeting_status_str
 
 namespace meeting_outcome_str {
-    inline std::string closedWon            = "The meeting resulted in a successful deal";
-    inline std::string closedLost           = "The meeting resulted in a lost deal";
-    inline std::string progressMade         = "Progress was made during the meeting";
-    inline std::string followUpScheduled    = "A follow-up meeting was scheduled";
-    inline std::string informationProvided  = "Information was provided during the meeting";
-    inline std::string decisionPending      = "A decision is pending after the meeting";
-    inline std::string additionalInfoNeeded = "Additional information is required";
-    inline std::string postponed            = "The meeting was postponed";
-    inline std::string canceled             = "The meeting was canceled";
-    inline std::string redirected           = "The meeting was redirected to another party";
-    inline std::string issueIdentified      = "An issue was identified during the meeting";
-    inline std::string other                = "Other outcome";
+    inline constexpr std::string_view closedWon            =
+        "The meeting resulted in a successful deal";
+    inline constexpr std::string_view closedLost           = "The meeting resulted in a lost deal";
+    inline constexpr std::string_view progressMade         = "Progress was made during the meeting";
+    inline constexpr std::string_view followUpScheduled    = "A follow-up meeting was scheduled";
+    inline constexpr std::string_view informationProvided  =
+        "Information was provided during the meeting";
+    inline constexpr std::string_view decisionPending      =
+        "A decision is pending after the meeting";
+    inline constexpr std::string_view additionalInfoNeeded = "Additional information is required";
+    inline constexpr std::string_view postponed            = "The meeting was postponed";
+    inline constexpr std::string_view canceled             = "The meeting was canceled";
+    inline constexpr std::string_view redirected           =
+        "The meeting was redirected to another party";
+    inline constexpr std::string_view issueIdentified      =
+        "An issue was identified during the meeting";
+    inline constexpr std::string_view other                = "Other outcome";
 }  // namespace meeting_outcome_str
 
 namespace meeting_type_str {
-    inline std::string negotiation  = "The meeting is a negotiation session";
-    inline std::string presentation = "The meeting is a presentation";
-    inline std::string training     = "The meeting is a training session";
-    inline std::string other        = "Other meeting type";
+    inline constexpr std::string_view negotiation  = "The meeting is a negotiation session";
+    inline constexpr std::string_view presentation = "The meeting is a presentation";
+    inline constexpr std::string_view training     = "The meeting is a training session";
+    inline constexpr std::string_view other        = "Other meeting type";
 }  // namespace meeting_type_str
 
 namespace email_letter_type_str {
-    inline std::string incoming = "The email is incoming";
-    inline std::string outgoing = "The email is outgoing";
+    inline constexpr std::string_view incoming = "The email is incoming";
+    inline constexpr std::string_view outgoing = "The email is outgoing";
 }  // namespace email_letter_type_str
 
 namespace email_status_str {
-    inline std::string sent      = "The email was sent";
-    inline std::string delivered = "The email was delivered";
-    inline std::string failed    = "The email failed to send or deliver";
-    inline std::string draft     = "The email is a draft";
-    inline std::string scheduled = "The email is scheduled for sending";
-    inline std::string replied   = "The email has been replied to";
-    inline std::string forwarded = "The email has been forwarded";
+    inline constexpr std::string_view sent      = "The email was sent";
+    inline constexpr std::string_view delivered = "The email was delivered";
+    inline constexpr std::string_view failed    = "The email failed to send or deliver";
+    inline constexpr std::string_view draft     = "The email is a draft";
+    inline constexpr std::string_view scheduled = "The email is scheduled for sending";
+    inline constexpr std::string_view replied   = "The email has been replied to";
+    inline constexpr std::string_view forwarded = "The email has been forwarded";
 }  // namespace email_status_str
 
 namespace call_type_str {
-    inline std::string incoming = "The call is incoming";
-    inline std::string outgoing = "The call is outgoing";
-    inline std::string missed   = "The call was missed";
+    inline constexpr std::string_view incoming = "The call is incoming";
+    inline constexpr std::string_view outgoing = "The call is outgoing";
+    inline constexpr std::string_view missed   = "The call was missed";
 }  // namespace call_type_str
 
 namespace interaction_type_str {
-    inline std::string phoneCall                = "Interaction is a phone call";
-    inline std::string emailLetter              = "Interaction is an email letter";
-    inline std::string emailThread              = "Interaction is an email thread";
-    inline std::string meeting                  = "Interaction is a meeting";
-    inline std::string meetingThread            = "Interaction is a meeting thread";
-    inline std::string message                  = "Interaction is a message";
-    inline std::string correspondence           = "Interaction is correspondence";
-    inline std::string commentarySocialNetworks = "Interaction is a commentary on social networks";
-    inline std::string commentarySocialNetworksThread =
+    inline constexpr std::string_view phoneCall                = "Interaction is a phone call";
+    inline constexpr std::string_view emailLetter              = "Interaction is an email letter";
+    inline constexpr std::string_view emailThread              = "Interaction is an email thread";
+    inline constexpr std::string_view meeting                  = "Interaction is a meeting";
+    inline constexpr std::string_view meetingThread            = "Interaction is a meeting thread";
+    inline constexpr std::string_view message                  = "Interaction is a message";
+    inline constexpr std::string_view correspondence           = "Interaction is correspondence";
+    inline constexpr std::string_view commentarySocialNetworks =
+        "Interaction is a commentary on social networks";
+    inline constexpr std::string_view commentarySocialNetworksThread =
         "Interaction is a social networks commentary thread";
-    inline std::string unknown = "Interaction type is unknown";
+    inline constexpr std::string_view unknown = "Interaction type is unknown";
 }  // namespace interaction_type_str
 
 namespace priority_str {
-    inline std::string low      = "Low";
-    inline std::string medium   = "Medium";
-    inline std::string high     = "High";
-    inline std::string critical = "Critical";
-    inline std::string null     = "Other";
+    inline constexpr std::string_view low      = "Low";
+    inline constexpr std::string_view medium   = "Medium";
+    inline constexpr std::string_view high     = "High";
+    inline constexpr std::string_view critical = "Critical";
+    inline constexpr std::string_view null     = "Other";
 }  // namespace priority_str
 
 namespace payment_status_str {
-    inline std::string pending   = "Waiting for payment";
-    inline std::string completed = "Completed";
-    inline std::string failed    = "Not paid for";
-    inline std::string refunded  = "Refunded";
-    inline std::string partial   = "Partially paid for";
-    inline std::string overdue   = "Overdue";
+    inline constexpr std::string_view pending   = "Waiting for payment";
+    inline constexpr std::string_view completed = "Completed";
+    inline constexpr std::string_view failed    = "Not paid for";
+    inline constexpr std::string_view refunded  = "Refunded";
+    inline constexpr std::string_view partial   = "Partially paid for";
+    inline constexpr std::string_view overdue   = "Overdue";
 }  // namespace payment_status_str
 
 namespace deal_status_str {
-    inline std::string draft                      = "Draft";
-    inline std::string readyForCoordination       = "Ready for coordination";
-    inline std::string readyForSigned             = "Ready for signed";
-    inline std::string coordination               = "Coordination is underway";
-    inline std::string signedByCounterparty       = "Signed by the counterparty";
-    inline std::string signedBySecondSide         = "Signed by the second side";
-    inline std::string allSigned                  = "All parties signed";
-    inline std::string deleted                    = "Deleted";
-    inline std::string canceled                   = "Canceled";
-    inline std::string registered                 = "Registered";
-    inline std::string beginningDealBroken        = "Beginning of the rupture of the deal";
-    inline std::string endDealBroken              = "End of the rupture of the deal";
-    inline std::string obligationsAreProcess      = "In the process of fulfilling obligations";
-    inline std::string obligationsAreFulfilled    = "All obligations are fulfilled";
-    inline std::string obligationsAreNotFulfilled = "The obligations are not fulfilled";
-    inline std::string other                      = "Other";
+    inline constexpr std::string_view draft                      = "Draft";
+    inline constexpr std::string_view readyForCoordination       = "Ready for coordination";
+    inline constexpr std::string_view readyForSigned             = "Ready for signed";
+    inline constexpr std::string_view coordination               = "Coordination is underway";
+    inline constexpr std::string_view signedByCounterparty       = "Signed by the counterparty";
+    inline constexpr std::string_view signedBySecondSide         = "Signed by the second side";
+    inline constexpr std::string_view allSigned                  = "All parties signed";
+    inline constexpr std::string_view deleted                    = "Deleted";
+    inline constexpr std::string_view canceled                   = "Canceled";
+    inline constexpr std::string_view registered                 = "Registered";
+    inline constexpr std::string_view beginningDealBroken        =
+        "Beginning of the rupture of the deal";
+    inline constexpr std::string_view endDealBroken              = "End of the rupture of the deal";
+    inline constexpr std::string_view obligationsAreProcess      =
+        "In the process of fulfilling obligations";
+    inline constexpr std::string_view obligationsAreFulfilled    = "All obligations are fulfilled";
+    inline constexpr std::string_view obligationsAreNotFulfilled =
+        "The obligations are not fulfilled";
+    inline constexpr std::string_view other                      = "Other";
 }  // namespace deal_status_str
 
 namespace document_status_str {
-    inline std::string draft    = "Draft";
-    inline std::string active   = "Active";
-    inline std::string expired  = "Time expired";
-    inline std::string archived = "Archived";
+    inline constexpr std::string_view draft    = "Draft";
+    inline constexpr std::string_view active   = "Active";
+    inline constexpr std::string_view expired  = "Time expired";
+    inline constexpr std::string_view archived = "Archived";
 }  // namespace document_status_str
 
 namespace task_status_str {
-    inline std::string not_started = "Not started";
-    inline std::string in_progress = "In progress";
-    inline std::string completed   = "Complited";
-    inline std::string overdue     = "Overdue";
+    inline constexpr std::string_view not_started = "Not started";
+    inline constexpr std::string_view in_progress = "In progress";
+    inline constexpr std::string_view completed   = "Complited";
+    inline constexpr std::string_view overdue     = "Overdue";
 }  // namespace task_status_str
 
 namespace gender_str {
-    inline std::string male    = "Male";
-    inline std::string female  = "Female";
-    inline std::string unknown = "Unknown";
+    inline constexpr std::string_view male    = "Male";
+    inline constexpr std::string_view female  = "Female";
+    inline constexpr std::string_view unknown = "Unknown";
 }  // namespace gender_str
 
 namespace access_level_str {
-    inline std::string admin           = "Administrator";
-    inline std::string sales_rep       = "Sales Representative";
-    inline std::string executive       = "Executive";
-    inline std::string manager         = "Manager";
-    inline std::string marketing_user  = "Marketing User";
-    inline std::string read_only       = "Read Only";
-    inline std::string sales_manager   = "Sales Manager";
-    inline std::string service_manager = "Service Manager";
-    inline std::string support         = "Support";
-    inline std::string decision_maker  = "Decision Maker";
-    inline std::string influencer      = "Influencer";
-    inline std::string user            = "User";
-    inline std::string gatekeeper      = "Gatekeeper";
-    inline std::string other           = "Other";
+    inline constexpr std::string_view admin           = "Administrator";
+    inline constexpr std::string_view sales_rep       = "Sales Representative";
+    inline constexpr std::string_view executive       = "Executive";
+    inline constexpr std::string_view manager         = "Manager";
+    inline constexpr std::string_view marketing_user  = "Marketing User";
+    inline constexpr std::string_view read_only       = "Read Only";
+    inline constexpr std::string_view sales_manager   = "Sales Manager";
+    inline constexpr std::string_view service_manager = "Service Manager";
+    inline constexpr std::string_view support         = "Support";
+    inline constexpr std::string_view decision_maker  = "Decision Maker";
+    inline constexpr std::string_view influencer      = "Influencer";
+    inline constexpr std::string_view user            = "User";
+    inline constexpr std::string_view gatekeeper      = "Gatekeeper";
+    inline constexpr std::string_view other           = "Other";
 }  // namespace access_level_str
 
 namespace employee_status_str {
-    inline std::string active     = "Active";
-    inline std::string vacation   = "Vacation";
-    inline std::string fired      = "Fired";
-    inline std::string education  = "Education";
-    inline std::string internship = "Internship";
-    inline std::string probation  = "Probation";
-    inline std::string suspended  = "Suspended";
-    inline std::string sick_leave = "Sick Leave";
-    inline std::string retired    = "Retired";
-    inline std::string other      = "Other";
+    inline constexpr std::string_view active     = "Active";
+    inline constexpr std::string_view vacation   = "Vacation";
+    inline constexpr std::string_view fired      = "Fired";
+    inline constexpr std::string_view education  = "Education";
+    inline constexpr std::string_view internship = "Internship";
+    inline constexpr std::string_view probation  = "Probation";
+    inline constexpr std::string_view suspended  = "Suspended";
+    inline constexpr std::string_view sick_leave = "Sick Leave";
+    inline constexpr std::string_view retired    = "Retired";
+    inline constexpr std::string_view other      = "Other";
 }  // namespace employee_status_str
 
 namespace client_type_str {
-    inline std::string visitor          = "Visitor";
-    inline std::string lead             = "Lead";
-    inline std::string prospect         = "Prospect";
-    inline std::string customer         = "Costomer";
-    inline std::string loyal_customer   = "Loyal Customer";
-    inline std::string partner          = "Partner";
-    inline std::string potential_client = "Potential Client";
-    inline std::string lost_customer    = "Lost Customer";
-    inline std::string analytical       = "Analytical";
-    inline std::string emotional        = "Emotional";
-    inline std::string other            = "Other";
+    inline constexpr std::string_view visitor          = "Visitor";
+    inline constexpr std::string_view lead             = "Lead";
+    inline constexpr std::string_view prospect         = "Prospect";
+    inline constexpr std::string_view customer         = "Costomer";
+    inline constexpr std::string_view loyal_customer   = "Loyal Customer";
+    inline constexpr std::string_view partner          = "Partner";
+    inline constexpr std::string_view potential_client = "Potential Client";
+    inline constexpr std::string_view lost_customer    = "Lost Customer";
+    inline constexpr std::string_view analytical       = "Analytical";
+    inline constexpr std::string_view emotional        = "Emotional";
+    inline constexpr std::string_view other            = "Other";
 }  // namespace client_type_str
 
 namespace lead_status_str {
-    inline std::string new_         = "New";
-    inline std::string open         = "Open";
-    inline std::string working      = "Working";
-    inline std::string qualified    = "Qualified";
-    inline std::string unqualified  = "Unqualified";
-    inline std::string converted    = "Converted";
-    inline std::string closed       = "Closed";
-    inline std::string disqualified = "Disqualified";
-    inline std::string nurturing    = "Nurturing";
-    inline std::string lost         = "Lost";
+    inline constexpr std::string_view new_         = "New";
+    inline constexpr std::string_view open         = "Open";
+    inline constexpr std::string_view working      = "Working";
+    inline constexpr std::string_view qualified    = "Qualified";
+    inline constexpr std::string_view unqualified  = "Unqualified";
+    inline constexpr std::string_view converted    = "Converted";
+    inline constexpr std::string_view closed       = "Closed";
+    inline constexpr std::string_view disqualified = "Disqualified";
+    inline constexpr std::string_view nurturing    = "Nurturing";
+    inline constexpr std::string_view lost         = "Lost";
 }  // namespace lead_status_str
 
 namespace lead_source_str {
-    inline std::string website        = "Website";
-    inline std::string referral       = "Referral";
-    inline std::string email_campaign = "Email campaign";
-    inline std::string social_media   = "Social media";
-    inline std::string other          = "Other";
+    inline constexpr std::string_view website        = "Website";
+    inline constexpr std::string_view referral       = "Referral";
+    inline constexpr std::string_view email_campaign = "Email campaign";
+    inline constexpr std::string_view social_media   = "Social media";
+    inline constexpr std::string_view other          = "Other";
 }  // namespace lead_source_str
 
 namespace company_type_str {
-    inline std::string client   = "Client";
-    inline std::string partner  = "Partner";
-    inline std::string vendor   = "Vendor";
-    inline std::string prospect = "Prospect";
-    inline std::string supplier = "Supplier";
-    inline std::string other    = "Other";
+    inline constexpr std::string_view client   = "Client";
+    inline constexpr std::string_view partner  = "Partner";
+    inline constexpr std::string_view vendor   = "Vendor";
+    inline constexpr std::string_view prospect = "Prospect";
+    inline constexpr std::string_view supplier = "Supplier";
+    inline constexpr std::string_view other    = "Other";
 }  // namespace company_type_str
 
 namespace rating_str {
-    inline std::string hot      = "Hot";
-    inline std::string warm     = "Warm";
-    inline std::string cold     = "Cold";
-    inline std::string inactive = "Inactive";
+    inline constexpr std::string_view hot      = "Hot";
+    inline constexpr std::string_view warm     = "Warm";
+    inline constexpr std::string_view cold     = "Cold";
+    inline constexpr std::string_view inactive = "Inactive";
 }  // namespace rating_str
 
 namespace risk_level_str {
-    inline std::string low      = "Low";
-    inline std::string medium   = "Medium";
-    inline std::string high     = "High";
-    inline std::string critical = "Critical";
+    inline constexpr std::string_view low      = "Low";
+    inline constexpr std::string_view medium   = "Medium";
+    inline constexpr std::string_view high     = "High";
+    inline constexpr std::string_view critical = "Critical";
 }  // namespace risk_level_str
 
 namespace company_status_str {
-    inline std::string active   = "Active";
-    inline std::string inactive = "Inactive";
-    inline std::string archived = "Archived";
+    inline constexpr std::string_view active   = "Active";
+    inline constexpr std::string_view inactive = "Inactive";
+    inline constexpr std::string_view archived = "Archived";
 }  // namespace company_status_str
 
 namespace company_size_str {
-    inline std::string micro      = "Micro";
-    inline std::string small      = "Small";
-    inline std::string medium     = "Medium";
-    inline std::string large      = "Large";
-    inline std::string enterprise = "Enterprise";
+    inline constexpr std::string_view micro      = "Micro";
+    inline constexpr std::string_view small      = "Small";
+    inline constexpr std::string_view medium     = "Medium";
+    inline constexpr std::string_view large      = "Large";
+    inline constexpr std::string_view enterprise = "Enterprise";
 }  // namespace company_size_str
 
 namespace compliance_level_str {
-    inline std::string compliant     = "Compliant";
-    inline std::string warning       = "Warning";
-    inline std::string non_compliant = "NonCompliant";
+    inline constexpr std::string_view compliant     = "Compliant";
+    inline constexpr std::string_view warning       = "Warning";
+    inline constexpr std::string_view non_compliant = "NonCompliant";
 }  // namespace compliance_level_str
 
 namespace influence_level_str {
-    inline std::string critical = "Critical";
-    inline std::string high     = "High";
-    inline std::string medium   = "Medium";
-    inline std::string low      = "Low";
-    inline std::string very_low = "Very Low";
+    inline constexpr std::string_view critical = "Critical";
+    inline constexpr std::string_view high     = "High";
+    inline constexpr std::string_view medium   = "Medium";
+    inline constexpr std::string_view low      = "Low";
+    inline constexpr std::string_view very_low = "Very Low";
 }  // namespace influence_level_str
 
 namespace integration_status_str {
-    inline std::string connected = "Connected";
-    inline std::string pending   = "Pending";
-    inline std::string failed    = "Failed";
+    inline constexpr std::string_view connected = "Connected";
+    inline constexpr std::string_view pending   = "Pending";
+    inline constexpr std::string_view failed    = "Failed";
 }  // namespace integration_status_str
 
 namespace report_type_str {
-    inline std::string SalesSummary       = "Sales Summary";
-    inline std::string Pipeline           = "Pipeline";
-    inline std::string RevenueByManager   = "Revenue by Manager";
-    inline std::string ClientActivity     = "Client Activity";
-    inline std::string ProductPerformance = "Product Performance";
-    inline std::string EmployeeKPI        = "Employee KPI";
-    inline std::string InteractionSummary = "Interaction Summary";
-    inline std::string FinancialForecast  = "Financial Forecast";
-    inline std::string other              = "Other";
+    inline constexpr std::string_view SalesSummary       = "Sales Summary";
+    inline constexpr std::string_view Pipeline           = "Pipeline";
+    inline constexpr std::string_view RevenueByManager   = "Revenue by Manager";
+    inline constexpr std::string_view ClientActivity     = "Client Activity";
+    inline constexpr std::string_view ProductPerformance = "Product Performance";
+    inline constexpr std::string_view EmployeeKPI        = "Employee KPI";
+    inline constexpr std::string_view InteractionSummary = "Interaction Summary";
+    inline constexpr std::string_view FinancialForecast  = "Financial Forecast";
+    inline constexpr std::string_view other              = "Other";
 }  // namespace report_type_str
 
 namespace export_format_str {
-    inline std::string CSV  = "CSV";
-    inline std::string PDF  = "PDF";
-    inline std::string JSON = "JSON";
-    inline std::string XLSX = "XLSX";
+    inline constexpr std::string_view CSV  = "CSV";
+    inline constexpr std::string_view PDF  = "PDF";
+    inline constexpr std::string_view JSON = "JSON";
+    inline constexpr std::string_view XLSX = "XLSX";
 }  // namespace export_format_str
 
 namespace campaign_type_str {
-    inline std::string email      = "Email";
-    inline std::string social_ads = "Social Ads";
-    inline std::string webinar    = "Webinar";
-    inline std::string event      = "Event";
-    inline std::string other      = "Other";
+    inline constexpr std::string_view email      = "Email";
+    inline constexpr std::string_view social_ads = "Social Ads";
+    inline constexpr std::string_view webinar    = "Webinar";
+    inline constexpr std::string_view event      = "Event";
+    inline constexpr std::string_view other      = "Other";
 }  // namespace campaign_type_str
 
 namespace case_status_str {
-    inline std::string open        = "Open";
-    inline std::string in_progress = "In Progress";
-    inline std::string resolved    = "Resolved";
-    inline std::string closed      = "Closed";
+    inline constexpr std::string_view open        = "Open";
+    inline constexpr std::string_view in_progress = "In Progress";
+    inline constexpr std::string_view resolved    = "Resolved";
+    inline constexpr std::string_view closed      = "Closed";
 }  // namespace case_status_str
+
+namespace change_action_str {
+    inline constexpr std::string_view add    = "Add";
+    inline constexpr std::string_view remove = "Remove";
+    inline constexpr std::string_view change = "Change";
+}  // namespace change_action_str